@@ -10,9 +10,28 @@
 
 
 
+#define FLASH_READY 0
+#define FLASH_BUSY  1
+
+/* pages erased by flash_eraseBlock */
+#define FLASH_BLOCK_PAGES 8
+
+/* completion of flash_readDma, runs in the DMA interrupt */
+typedef void (*flash_readCallback)(uint8_t* buf, uint32_t len);
+
 uint32_t flash_init (void);
 uint32_t flash_write(uint8_t* buf, uint32_t offset, uint32_t len);
+uint32_t flash_writeStart(uint8_t* buf, uint32_t offset, uint32_t len);
+uint32_t flash_poll(void);
+void flash_tick(void);
+uint32_t flash_program(uint8_t* buf, uint32_t offset, uint32_t len);
+uint32_t flash_programStart(uint8_t* buf, uint32_t offset, uint32_t len);
+uint32_t flash_eraseBlock(uint32_t offset);
 uint32_t flash_read(uint8_t* buf, uint32_t offset, uint32_t len);
+uint32_t flash_readDma(uint8_t* buf, uint32_t offset, uint32_t len,
+        flash_readCallback done);
+uint32_t flash_readDmaBusy(void);
+void flash_dmaIntHandler(void);
 
 void flash_setToBinaryPageSize(void);
 uint16_t flash_getPageSize(void);
@@ -11,6 +11,9 @@
 #define OLED_DISPLAY_WIDTH  96
 #define OLED_DISPLAY_HEIGHT 64
 
+/* delay between oled_initNoPower and oled_powerOn */
+#define OLED_POWER_DELAY_MS 5
+
 
 typedef enum
 {
@@ -20,6 +23,8 @@ typedef enum
 
 
 void oled_init (void);
+void oled_initNoPower (void);
+void oled_powerOn (void);
 void oled_putPixel(uint8_t x, uint8_t y, oled_color_t color);
 void oled_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, oled_color_t color);
 void oled_circle(uint8_t x0, uint8_t y0, uint8_t r, oled_color_t color);
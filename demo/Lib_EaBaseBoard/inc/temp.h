@@ -8,6 +8,8 @@
 #ifndef __TEMP_H
 #define __TEMP_H
 
+/* temp_read without a sensor signal */
+#define TEMP_NO_READING (-32768)
 
 void temp_init (uint32_t (*getMsTick)(void));
 int32_t temp_read(void);
@@ -17,12 +17,39 @@ typedef enum {
 
 #define MSR_CTS 0x10
 
+/* Ring buffer sizes in bytes, powers of 2 */
+#ifndef UART2_RX_SIZE
+#define UART2_RX_SIZE 256
+#endif
+#ifndef UART2_TX_SIZE
+#define UART2_TX_SIZE 256
+#endif
+
+/*
+ * GPIO the IRQ# output of the SC16IS752 is wired to, port 0 or 2 (GPIO
+ * interrupts). Nothing in this tree says where that is: there is no
+ * schematic or pin table of the base board, and the original driver did
+ * not use the pin. Define both from the board schematic to use it, e.g.
+ * -DUART2_IRQ_PORT=2 -DUART2_IRQ_PIN=12 (P2.12 is free in this firmware,
+ * but that is not a sign of the wiring). Without them uart2_poll asks the
+ * chip every 48 character times when uart2_setTicks has given it a ms
+ * tick, and on every call otherwise.
+ */
+/* #define UART2_IRQ_PORT 2 */
+/* #define UART2_IRQ_PIN 12 */
+
 
 void uart2_init (uint32_t baudRate, uart2_channel_t chan);
 void uart2_setBaudRate(uint32_t baudRate);
+void uart2_setTicks(uint32_t (*getMsTicks)(void));
+void uart2_intHandler(void);
+void uart2_poll(void);
+uint32_t uart2_write(const uint8_t *buffer, uint32_t length);
+uint32_t uart2_read(uint8_t *buffer, uint32_t length);
 void uart2_send(uint8_t *buffer, uint32_t length);
 void uart2_sendString(uint8_t *string);
 uint32_t uart2_receive(uint8_t *buffer, uint32_t length, uint32_t blocking);
+uint32_t uart2_getLineErrors(void);
 uint8_t uart2_getModemStatus(void);
 void uart2_setModemStatus(uint8_t msr);
 
@@ -53,24 +53,6 @@
  * Local Functions
  *****************************************************************************/
 
-static int I2CRead(uint8_t addr, uint8_t* buf, uint32_t len)
-{
-	I2C_M_SETUP_Type rxsetup;
-
-	rxsetup.sl_addr7bit = addr;
-	rxsetup.tx_data = NULL;	// Get address to read at writing address
-	rxsetup.tx_length = 0;
-	rxsetup.rx_data = buf;
-	rxsetup.rx_length = len;
-	rxsetup.retransmissions_max = 3;
-
-	if (I2C_MasterTransferData(I2CDEV, &rxsetup, I2C_TRANSFER_POLLING) == SUCCESS){
-		return (0);
-	} else {
-		return (-1);
-	}
-}
-
 static int I2CWrite(uint8_t addr, uint8_t* buf, uint32_t len)
 {
 	I2C_M_SETUP_Type txsetup;
@@ -89,6 +71,25 @@ static int I2CWrite(uint8_t addr, uint8_t* buf, uint32_t len)
 	}
 }
 
+static int I2CWriteRead(uint8_t addr, uint8_t* txbuf, uint32_t txlen,
+		uint8_t* rxbuf, uint32_t rxlen)
+{
+	I2C_M_SETUP_Type setup;
+
+	setup.sl_addr7bit = addr;
+	setup.tx_data = txbuf;	// Address to read at, then a repeated start
+	setup.tx_length = txlen;
+	setup.rx_data = rxbuf;
+	setup.rx_length = rxlen;
+	setup.retransmissions_max = 3;
+
+	if (I2C_MasterTransferData(I2CDEV, &setup, I2C_TRANSFER_POLLING) == SUCCESS){
+		return (0);
+	} else {
+		return (-1);
+	}
+}
+
 
 static void eepromDelay(void)
 {
@@ -129,7 +130,6 @@ void eeprom_init (void)
 int16_t eeprom_read(uint8_t* buf, uint16_t offset, uint16_t len)
 {
     uint8_t addr = 0;
-    int i = 0;
 
     uint16_t off = offset;
 
@@ -140,9 +140,11 @@ int16_t eeprom_read(uint8_t* buf, uint16_t offset, uint16_t len)
     addr = EEPROM_I2C_ADDR1 + (offset/EEPROM_BLOCK_SIZE);
     off = offset % EEPROM_BLOCK_SIZE;
 
-    I2CWrite((addr), (uint8_t*)&off, 1);
-    for ( i = 0; i < 0x2000; i++);
-    I2CRead((addr), buf, len);
+    /* the address write and the read need no pause between them, a
+       repeated start does both in one transfer */
+    if (I2CWriteRead((addr), (uint8_t*)&off, 1, buf, len) != 0) {
+        return -1;
+    }
 
     return len;
 
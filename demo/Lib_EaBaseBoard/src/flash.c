@@ -10,6 +10,24 @@
  * NOTE: SPI must have been initialized before calling any functions in
  * this file.
  *
+ * Writes alternate between the two SRAM buffers of the DataFlash: the next
+ * page is loaded into one buffer over SPI while the other buffer is being
+ * programmed into main memory. flash_writeStart/flash_poll run this as a
+ * state machine that never waits for the device, each flash_poll reads the
+ * status register once and moves on only when the device is ready.
+ * flash_write, flash_program and flash_eraseBlock do not spin on it: the
+ * caller sleeps in __WFI while flash_tick, called from a 1 ms timer
+ * interrupt (SysTick_Handler), runs flash_poll and sets a completion flag
+ * once the device is done. Without the tick they would never return.
+ *
+ * flash_readDma reads a contiguous range with the GPDMA: one channel moves
+ * SSP1 RX into the caller's buffer, a second one clocks the bus by feeding
+ * a dummy byte to SSP1 TX. CS stays low and SSP1 is owned by the read until
+ * the completion callback runs: oled.c waits for flash_readDmaBusy, the SD
+ * card driver mmc.c for the DMA enable bits of SSP1 (SSP1->DMACR), which are
+ * set exactly as long. flash_dmaIntHandler must be called from
+ * DMA_IRQHandler and GPDMA_Init must have been called.
+ *
  */
 
 /******************************************************************************
@@ -18,6 +36,7 @@
 
 #include "lpc17xx_gpio.h"
 #include "lpc17xx_ssp.h"
+#include "lpc17xx_gpdma.h"
 #include "flash.h"
 
 /******************************************************************************
@@ -41,6 +60,12 @@
 #define FLASH_CMD_PE        0x81        /* page erase */
 #define FLASH_CMD_PP_BUF    0x82        /* page program through buffer 1 */
 
+/* buffer commands, [0] - buffer 1, [1] - buffer 2 */
+#define FLASH_CMD_BUF_WRITE(b)  ((b) ? 0x87 : 0x84) /* write into buffer */
+#define FLASH_CMD_BUF_PROG(b)   ((b) ? 0x86 : 0x83) /* buffer to main memory page with erase */
+#define FLASH_CMD_BUF_LOAD(b)   ((b) ? 0x55 : 0x53) /* main memory page to buffer */
+#define FLASH_CMD_BUF_PROG_NE(b) ((b) ? 0x89 : 0x88) /* buffer to main memory page without erase */
+
 #define FLASH_CMD_DP        0xB9        /* deep power down */
 #define FLASH_CMD_RES       0xAB        /* release from deep power down */
 
@@ -58,6 +83,20 @@
 
 #define FLAG_IS_POW2 0x01
 
+/* RX has to win over TX so the RX FIFO never overruns, channel 0 has the
+   highest priority */
+#define FLASH_DMA_RX_CH     0
+#define FLASH_DMA_TX_CH     1
+#define FLASH_DMA_TX        LPC_GPDMACH1
+#define DMA_MAX_CHUNK       4095        /* transfer size field of a channel */
+
+/* states of the write in progress */
+#define WR_IDLE     0   /* no write */
+#define WR_LOAD     1   /* next chunk can be loaded into wrBuffer */
+#define WR_FETCH    2   /* page copied into wrBuffer for a partial chunk, device busy */
+#define WR_STAGED   3   /* chunk in wrBuffer, waiting for the device to program it */
+#define WR_FINISH   4   /* last page programming */
+
 struct _flash_info
 {
     char* name;
@@ -83,6 +122,24 @@ static uint8_t  pageIsPow2 = 0;
 static uint8_t  pageSizeChanged = FALSE;
 static uint32_t flashTotalSize = 0;
 
+static uint8_t  wrState = WR_IDLE;
+static uint8_t  wrBuffer = 0;       /* SRAM buffer used for the next chunk, 0 - buffer 1 */
+static uint8_t  wrErase = 1;        /* erase pages before programming */
+static uint8_t* wrBuf = NULL;       /* data not yet loaded */
+static uint32_t wrOffset = 0;
+static uint32_t wrLen = 0;
+static uint32_t stagedOffset = 0;   /* flash offset of the chunk in wrBuffer */
+static volatile uint8_t wrWaiting = 0;  /* waitWrite sleeps, flash_tick polls */
+static volatile uint8_t wrDone = 0;     /* set by flash_tick when the write is done */
+
+static volatile uint8_t dmaBusy = 0;
+static uint8_t* dmaBuf = NULL;      /* start of the read in progress */
+static uint8_t* dmaPos = NULL;      /* destination of the next chunk */
+static uint32_t dmaLen = 0;         /* bytes not yet requested */
+static uint32_t dmaTotal = 0;
+static flash_readCallback dmaDone = NULL;
+static uint8_t dmaDummy = 0xFF;     /* clocked out while reading, in RAM for the GPDMA */
+
 static struct _flash_info flash_devices[] = {
         {"AT45DB081D", 0x1F2500, 4096, 264, 9, 0},
         {"AT45DB081D", 0x1F2500, 4096, 256, 8, FLAG_IS_POW2},
@@ -154,18 +211,9 @@ static uint8_t readStatus(void)
 }
 
 
-static void pollIsBusy(void)
+static uint8_t isReady(void)
 {
-  uint8_t status = 0;
-  int i = 0;
-
-  do
-  {
-    for (i = 0; i < 0x2000; i++);
-
-    status = readStatus();
-  }
-  while ((status & STATUS_RDY) == 0);
+    return ((readStatus() & STATUS_RDY) != 0);
 }
 
 static void setAddressBytes(uint8_t* addr, uint32_t offset)
@@ -176,7 +224,7 @@ static void setAddressBytes(uint8_t* addr, uint32_t offset)
 
         /* buffer address bits */
         addr[2] = (off & 0xff);
-        addr[1] = (off / pageSize);
+        addr[1] = (off >> 8);
 
         /* page address bits */
         addr[1] |= ((page & ((1 << (16-pageOffset))-1)) << (pageOffset-8));
@@ -191,6 +239,139 @@ static void setAddressBytes(uint8_t* addr, uint32_t offset)
     }
 }
 
+static void bufferCommand(uint8_t cmd, uint32_t offset)
+{
+    uint8_t addr[4];
+
+    addr[0] = cmd;
+    setAddressBytes(&addr[1], offset);
+
+    FLASH_CS_ON();
+
+    SSPSend(addr, 4);
+
+    FLASH_CS_OFF();
+}
+
+static uint32_t chunkLength(void)
+{
+    return MIN(pageSize - (wrOffset % pageSize), wrLen);
+}
+
+static void loadChunk(void)
+{
+    uint32_t chunk = chunkLength();
+    uint8_t addr[4];
+
+    addr[0] = FLASH_CMD_BUF_WRITE(wrBuffer);
+    setAddressBytes(&addr[1], wrOffset);
+
+    FLASH_CS_ON();
+
+    SSPSend(addr, 4);
+    SSPSend(wrBuf, chunk);
+
+    FLASH_CS_OFF();
+
+    stagedOffset = wrOffset;
+    wrBuf    += chunk;
+    wrOffset += chunk;
+    wrLen    -= chunk;
+    wrState   = WR_STAGED;
+}
+
+static uint32_t startWrite(uint8_t* buf, uint32_t offset, uint32_t len, uint8_t erase)
+{
+    if (len > flashTotalSize || len+offset > flashTotalSize) {
+        return 0;
+    }
+
+    if (pageSizeChanged || wrState != WR_IDLE || dmaBusy || len == 0) {
+        return 0;
+    }
+
+    wrBuf    = buf;
+    wrOffset = offset;
+    wrLen    = len;
+    wrErase  = erase;
+    wrState  = WR_LOAD;
+
+    (void)flash_poll();
+
+    return len;
+}
+
+static void waitWrite(void)
+{
+    if (flash_poll() == FLASH_BUSY) {
+        /* SSP1 is ours until the write is done, flash_tick can use it */
+        wrDone = 0;
+        wrWaiting = 1;
+        while (!wrDone) {
+            __WFI();
+        }
+    }
+}
+
+static Status dmaStartChunk(void)
+{
+    GPDMA_Channel_CFG_Type cfg;
+    uint32_t chunk = MIN(dmaLen, DMA_MAX_CHUNK);
+
+    cfg.ChannelNum    = FLASH_DMA_RX_CH;
+    cfg.TransferSize  = chunk;
+    cfg.TransferWidth = 0;
+    cfg.SrcMemAddr    = 0;
+    cfg.DstMemAddr    = (uint32_t)dmaPos;
+    cfg.TransferType  = GPDMA_TRANSFERTYPE_P2M;
+    cfg.SrcConn       = GPDMA_CONN_SSP1_Rx;
+    cfg.DstConn       = 0;
+    cfg.DMALLI        = 0;
+    if (GPDMA_Setup(&cfg) != SUCCESS) {
+        return ERROR;
+    }
+
+    cfg.ChannelNum    = FLASH_DMA_TX_CH;
+    cfg.SrcMemAddr    = (uint32_t)&dmaDummy;
+    cfg.DstMemAddr    = 0;
+    cfg.TransferType  = GPDMA_TRANSFERTYPE_M2P;
+    cfg.SrcConn       = 0;
+    cfg.DstConn       = GPDMA_CONN_SSP1_Tx;
+    if (GPDMA_Setup(&cfg) != SUCCESS) {
+        return ERROR;
+    }
+
+    /* same dummy byte for every frame, completion is signalled by RX only */
+    FLASH_DMA_TX->DMACCControl &= ~(GPDMA_DMACCxControl_SI | GPDMA_DMACCxControl_I);
+
+    dmaPos += chunk;
+    dmaLen -= chunk;
+
+    GPDMA_ChannelCmd(FLASH_DMA_RX_CH, ENABLE);
+    GPDMA_ChannelCmd(FLASH_DMA_TX_CH, ENABLE);
+    return SUCCESS;
+}
+
+static void dmaStop(void)
+{
+    GPDMA_ChannelCmd(FLASH_DMA_TX_CH, DISABLE);
+    GPDMA_ChannelCmd(FLASH_DMA_RX_CH, DISABLE);
+    SSP_DMACmd(LPC_SSP1, SSP_DMA_TX, DISABLE);
+    SSP_DMACmd(LPC_SSP1, SSP_DMA_RX, DISABLE);
+
+    FLASH_CS_OFF();
+
+    dmaBusy = 0;
+}
+
+static void dmaFinish(uint32_t len)
+{
+    dmaStop();
+    if (dmaDone != NULL) {
+        dmaDone(dmaBuf, len);
+    }
+}
+
 /******************************************************************************
  * Public Functions
  *****************************************************************************/
@@ -251,7 +432,8 @@ uint32_t flash_init (void)
 /******************************************************************************
  *
  * Description:
- *    Write data to flash
+ *    Start writing data to flash. The write is carried out by flash_poll,
+ *    buf must stay valid until flash_poll returns FLASH_READY.
  *
  * Params:
  *   [in] buf - data to write to flash
@@ -259,55 +441,201 @@ uint32_t flash_init (void)
  *   [in] len - number of bytes to write
  *
  * Returns:
- *   number of written bytes
+ *   number of bytes that will be written, 0 if the parameters are wrong or
+ *   another write is in progress
  *
  *****************************************************************************/
-uint32_t flash_write(uint8_t* buf, uint32_t offset, uint32_t len)
+uint32_t flash_writeStart(uint8_t* buf, uint32_t offset, uint32_t len)
 {
-    uint16_t wLen;
-    uint32_t written = 0;
-    uint8_t addr[4];
+    return startWrite(buf, offset, len, 1);
+}
 
-    if (len > flashTotalSize || len+offset > flashTotalSize) {
-        return 0;
-    }
+/******************************************************************************
+ *
+ * Description:
+ *    Like flash_writeStart but pages are programmed without the built-in
+ *    erase: bits can only go from 1 to 0, so the target has to be erased
+ *    (flash_eraseBlock) or only get bits cleared. Bytes of a page outside
+ *    the range keep their contents.
+ *
+ * Params:
+ *   [in] buf - data to write to flash
+ *   [in] offset - offset into the flash
+ *   [in] len - number of bytes to write
+ *
+ * Returns:
+ *   number of bytes that will be written, 0 if the parameters are wrong or
+ *   another write is in progress
+ *
+ *****************************************************************************/
+uint32_t flash_programStart(uint8_t* buf, uint32_t offset, uint32_t len)
+{
+    return startWrite(buf, offset, len, 0);
+}
 
-    if (pageSizeChanged) {
-        return 0;
+/******************************************************************************
+ *
+ * Description:
+ *    Advance the write started by flash_writeStart. Never waits for the
+ *    device: a call reads the status register, issues what the device can
+ *    take now and returns. Call it periodically from the main loop, e.g.
+ *    from a 1 ms timer flag.
+ *
+ * Returns:
+ *   FLASH_BUSY while the write is in progress, FLASH_READY when done
+ *
+ *****************************************************************************/
+uint32_t flash_poll(void)
+{
+    uint32_t ret = FLASH_BUSY;
+
+    while (ret == FLASH_BUSY) {
+        switch (wrState) {
+        case WR_LOAD:
+            if (wrLen == 0) {
+                wrState = WR_FINISH;
+            }
+            else if (chunkLength() == pageSize) {
+                /* the other buffer may still be programming, that is allowed */
+                loadChunk();
+            }
+            else if (isReady()) {
+                /* partial page, keep the rest of the page */
+                bufferCommand(FLASH_CMD_BUF_LOAD(wrBuffer), wrOffset);
+                wrState = WR_FETCH;
+                return FLASH_BUSY;
+            }
+            else {
+                return FLASH_BUSY;
+            }
+            break;
+
+        case WR_FETCH:
+            if (!isReady()) {
+                return FLASH_BUSY;
+            }
+            loadChunk();
+            break;
+
+        case WR_STAGED:
+            if (!isReady()) {
+                return FLASH_BUSY;
+            }
+            bufferCommand(wrErase ? FLASH_CMD_BUF_PROG(wrBuffer)
+                    : FLASH_CMD_BUF_PROG_NE(wrBuffer), stagedOffset);
+            wrBuffer ^= 1;
+            wrState = WR_LOAD;
+            break;
+
+        case WR_FINISH:
+            if (!isReady()) {
+                return FLASH_BUSY;
+            }
+            wrState = WR_IDLE;
+            break;
+
+        default:
+            ret = FLASH_READY;
+            break;
+        }
     }
 
-    /* write up to first page boundry */
-    wLen = (((( (offset%pageSize) / pageSize) + 1) * pageSize)
-            - (offset%pageSize));
-    wLen = MIN(wLen, len);
-
-    while (len) {
+    return ret;
+}
 
-        /* write address */
-        addr[0] = FLASH_CMD_PP_BUF;
-        setAddressBytes(&addr[1], offset);
+/******************************************************************************
+ *
+ * Description:
+ *    Timer part of flash_write, flash_program and flash_eraseBlock. Call it
+ *    from a 1 ms timer interrupt: while one of them waits for the device it
+ *    runs flash_poll and wakes the caller when the operation is done.
+ *
+ *****************************************************************************/
+void flash_tick(void)
+{
+    if (wrWaiting && flash_poll() == FLASH_READY) {
+        wrWaiting = 0;
+        wrDone = 1;
+    }
+}
 
-        FLASH_CS_ON();
+/******************************************************************************
+ *
+ * Description:
+ *    Write data to flash, waits until the data is programmed
+ *
+ * Params:
+ *   [in] buf - data to write to flash
+ *   [in] offset - offset into the flash
+ *   [in] len - number of bytes to write
+ *
+ * Returns:
+ *   number of written bytes
+ *
+ *****************************************************************************/
+uint32_t flash_write(uint8_t* buf, uint32_t offset, uint32_t len)
+{
+    uint32_t written = flash_writeStart(buf, offset, len);
 
-        SSPSend(addr, 4);
+    if (written) {
+        waitWrite();
+    }
 
-        /* write data */
-        SSPSend(&buf[written], wLen);
+    return written;
+}
 
-        FLASH_CS_OFF();
+/******************************************************************************
+ *
+ * Description:
+ *    Program data without erasing (see flash_programStart), waits until the
+ *    data is programmed
+ *
+ * Params:
+ *   [in] buf - data to write to flash
+ *   [in] offset - offset into the flash
+ *   [in] len - number of bytes to write
+ *
+ * Returns:
+ *   number of written bytes
+ *
+ *****************************************************************************/
+uint32_t flash_program(uint8_t* buf, uint32_t offset, uint32_t len)
+{
+    uint32_t written = flash_programStart(buf, offset, len);
 
-        /* delay to wait for a write cycle */
-        //eepromDelay();
+    if (written) {
+        waitWrite();
+    }
 
-        len     -= wLen;
-        written += wLen;
-        offset  += wLen;
-        wLen = MIN(pageSize, len);
+    return written;
+}
 
-        pollIsBusy();
+/******************************************************************************
+ *
+ * Description:
+ *    Erase the block (FLASH_BLOCK_PAGES pages) holding offset, waits until
+ *    the block is erased
+ *
+ * Params:
+ *   [in] offset - offset into the flash
+ *
+ * Returns:
+ *   TRUE if the block was erased, FALSE if the flash is busy or the
+ *   offset is wrong
+ *
+ *****************************************************************************/
+uint32_t flash_eraseBlock(uint32_t offset)
+{
+    if (offset >= flashTotalSize || pageSizeChanged
+            || wrState != WR_IDLE || dmaBusy) {
+        return FALSE;
     }
 
-    return written;
+    bufferCommand(FLASH_CMD_BE, offset);
+    wrState = WR_FINISH;
+    waitWrite();
+
+    return TRUE;
 }
 
 /******************************************************************************
@@ -321,7 +649,7 @@ uint32_t flash_write(uint8_t* buf, uint32_t offset, uint32_t len)
  *   [in] len - number of bytes to read
  *
  * Returns:
- *   number of read bytes
+ *   number of read bytes, 0 while a write or a DMA read is in progress
  *
  *****************************************************************************/
 uint32_t flash_read(uint8_t* buf, uint32_t offset, uint32_t len)
@@ -332,7 +660,7 @@ uint32_t flash_read(uint8_t* buf, uint32_t offset, uint32_t len)
         return 0;
     }
 
-    if (pageSizeChanged) {
+    if (pageSizeChanged || wrState != WR_IDLE || dmaBusy) {
         return 0;
     }
 
@@ -351,6 +679,114 @@ uint32_t flash_read(uint8_t* buf, uint32_t offset, uint32_t len)
     return len;
 }
 
+/******************************************************************************
+ *
+ * Description:
+ *    Start reading data from flash with the GPDMA. The data goes straight
+ *    into buf, the CPU is only interrupted every 4095 bytes and at the end.
+ *    To stream into a ring, start the read of the next part from the
+ *    callback.
+ *
+ * Params:
+ *   [in] buf - data buffer, has to stay valid until done is called
+ *   [in] offset - offset into the flash
+ *   [in] len - number of bytes to read
+ *   [in] done - called from the DMA interrupt with buf and the number of
+ *               bytes read (0 on a DMA error), may be NULL
+ *
+ * Returns:
+ *   number of bytes that will be read, 0 if the parameters are wrong,
+ *   the flash is busy or a GPDMA channel could not be set up
+ *
+ *****************************************************************************/
+uint32_t flash_readDma(uint8_t* buf, uint32_t offset, uint32_t len,
+        flash_readCallback done)
+{
+    uint8_t addr[5];
+
+    if (len > flashTotalSize || len+offset > flashTotalSize) {
+        return 0;
+    }
+
+    if (pageSizeChanged || wrState != WR_IDLE || dmaBusy || len == 0) {
+        return 0;
+    }
+
+    dmaBusy  = 1;
+    dmaBuf   = buf;
+    dmaPos   = buf;
+    dmaLen   = len;
+    dmaTotal = len;
+    dmaDone  = done;
+
+    addr[0] = FLASH_CMD_FAST_READ;
+
+    setAddressBytes(&addr[1], offset);
+    addr[4] = (0);
+
+    FLASH_CS_ON();
+
+    SSPSend(addr, 5);
+
+    SSP_DMACmd(LPC_SSP1, SSP_DMA_RX, ENABLE);
+    SSP_DMACmd(LPC_SSP1, SSP_DMA_TX, ENABLE);
+    if (dmaStartChunk() != SUCCESS) {
+        /* a channel is taken by someone else, read with flash_read */
+        dmaStop();
+        return 0;
+    }
+
+    return len;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Check if a flash_readDma transfer is in progress
+ *
+ * Returns:
+ *   TRUE while SSP1 is owned by the DMA read, otherwise FALSE
+ *
+ *****************************************************************************/
+uint32_t flash_readDmaBusy(void)
+{
+    return dmaBusy;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    GPDMA interrupt part of flash_readDma, call it from DMA_IRQHandler.
+ *    Interrupts of other channels are left alone.
+ *
+ *****************************************************************************/
+void flash_dmaIntHandler(void)
+{
+    if (GPDMA_IntGetStatus(GPDMA_STAT_INTERR, FLASH_DMA_RX_CH)
+            || GPDMA_IntGetStatus(GPDMA_STAT_INTERR, FLASH_DMA_TX_CH)) {
+        GPDMA_ClearIntPending(GPDMA_STATCLR_INTERR, FLASH_DMA_RX_CH);
+        GPDMA_ClearIntPending(GPDMA_STATCLR_INTERR, FLASH_DMA_TX_CH);
+        if (dmaBusy) {
+            dmaFinish(0);
+        }
+    }
+
+    if (GPDMA_IntGetStatus(GPDMA_STAT_INTTC, FLASH_DMA_RX_CH)) {
+        GPDMA_ClearIntPending(GPDMA_STATCLR_INTTC, FLASH_DMA_RX_CH);
+        if (dmaBusy) {
+            if (dmaLen) {
+                /* the TX channel has finished before the last byte came in */
+                if (dmaStartChunk() != SUCCESS) {
+                    dmaFinish(0);
+                }
+            }
+            else {
+                dmaFinish(dmaTotal);
+            }
+        }
+    }
+}
+
 /******************************************************************************
  *
  * Description:
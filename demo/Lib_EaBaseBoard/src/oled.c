@@ -22,6 +22,7 @@
 #include "lpc17xx_i2c.h"
 #include "lpc17xx_ssp.h"
 #include "oled.h"
+#include "flash.h"
 #include "font5x7.h"
 
 /******************************************************************************
@@ -36,7 +37,8 @@
 #else
 
 #define OLED_CS_OFF() GPIO_SetValue( 0, (1<<6) )
-#define OLED_CS_ON()  GPIO_ClearValue( 0, (1<<6) )
+/* SSP1 belongs to a GPDMA read of the DataFlash until it completes */
+#define OLED_CS_ON()  do { while (flash_readDmaBusy()) ; GPIO_ClearValue( 0, (1<<6) ); } while (0)
 #define OLED_DATA()   GPIO_SetValue( 2, (1<<7) )
 #define OLED_CMD()    GPIO_ClearValue( 2, (1<<7) )
 
@@ -349,13 +351,13 @@ static void vLine(uint8_t x0, uint8_t y0, uint8_t y1, oled_color_t color)
 /******************************************************************************
  *
  * Description:
- *    Initialize the OLED Display
+ *    Initialize the OLED Display without switching on its power. The
+ *    controller is set up and accepts drawing; call oled_powerOn after
+ *    OLED_POWER_DELAY_MS to light the display.
  *
  *****************************************************************************/
-void oled_init (void)
+void oled_initNoPower (void)
 {
-    int i = 0;
-
     //GPIO_SetDir(PORT0, 0, 1);
     GPIO_SetDir(2, (1<<1), 1);
     GPIO_SetDir(2, (1<<7), 1);
@@ -374,12 +376,36 @@ void oled_init (void)
     runInitSequence();
 
     memset(shadowFB, 0, SHADOW_FB_SIZE);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Switch on the power of the OLED Display (charge pump)
+ *
+ *****************************************************************************/
+void oled_powerOn (void)
+{
+    GPIO_SetValue( 2, (1<<1) );
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Initialize the OLED Display
+ *
+ *****************************************************************************/
+void oled_init (void)
+{
+    int i = 0;
+
+    oled_initNoPower();
 
     /* small delay before turning on power */
     for (i = 0; i < 0xffff; i++);
 
      /* power on */
-    GPIO_SetValue( 2, (1<<1) );
+    oled_powerOn();
 }
 
 /******************************************************************************
@@ -31,9 +31,19 @@
 /*
  * Pin 0.2 or pin 1.5 can be used as input source for the temp sensor
  * Selected by jumper J25.
+ *
+ * On the LPCXpresso LPC1769 the other position of J25 is P0.6, which is
+ * the OLED chip select, so the sensor stays on P0.2 (J25 in its default
+ * position) and UART0 is not used, see demo/src/serial.c.
  */
 //#define TEMP_USE_P0_2
 
+/*
+ * A whole reading takes below 700 ms up to 125 C. Without a sensor (J25
+ * open) the pin never toggles and temp_read gives up after this time.
+ */
+#define TEMP_TIMEOUT_MS 1000
+
 #if TEMP_TS1 == 0 && TEMP_TS0 == 0
 #define TEMP_SCALAR_DIV10 1
 #define NUM_HALF_PERIODS 340
@@ -74,6 +84,16 @@ static uint32_t (*getTicks)(void) = NULL;
  * Local Functions
  *****************************************************************************/
 
+static int waitChange(uint8_t state, uint32_t start)
+{
+    while(GET_TEMP_STATE == state) {
+        if ((getTicks() - start) > TEMP_TIMEOUT_MS) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 /******************************************************************************
  * Public Functions
  *****************************************************************************/
@@ -106,6 +126,7 @@ void temp_init (uint32_t (*getMsTicks)(void))
  * Returns:
  *    10 x T(c), i.e. 10 times the temperature in Celcius. Example:
  *    if the temperature is 22.4 degrees the returned value is 224.
+ *    TEMP_NO_READING if the sensor output does not toggle.
  *
  *****************************************************************************/
 int32_t temp_read (void)
@@ -113,6 +134,7 @@ int32_t temp_read (void)
     uint8_t state = 0;
     uint32_t t1 = 0;
     uint32_t t2 = 0;
+    uint32_t start = 0;
     int i = 0;
 
     /*
@@ -122,15 +144,20 @@ int32_t temp_read (void)
      */
 
     state = GET_TEMP_STATE;
+    start = getTicks();
 
     /* get next state change before measuring time */
-    while(GET_TEMP_STATE == state);
+    if (!waitChange(state, start)) {
+        return TEMP_NO_READING;
+    }
     state = !state;
 
     t1 = getTicks();
 
     for (i = 0; i < NUM_HALF_PERIODS; i++) {
-        while(GET_TEMP_STATE == state);
+        if (!waitChange(state, start)) {
+            return TEMP_NO_READING;
+        }
         state = !state;
     }
 
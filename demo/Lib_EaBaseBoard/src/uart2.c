@@ -9,6 +9,31 @@
 /*
  * NOTE: I2C must have been initialized before calling any functions in this
  * file.
+ *
+ * The SC16IS752 has 64 byte TX and RX FIFOs whose fill levels can be read
+ * in TXLVL and RXLVL, and THR/RHR accept or return any number of bytes in
+ * one I2C transaction (the register address is not incremented). The
+ * driver moves up to 64 bytes per transaction between the FIFOs and a TX
+ * and RX ring in RAM, instead of an LSR read and a register access per
+ * byte.
+ *
+ * The chip pulls its IRQ pin low while RX data, a line error or TX FIFO
+ * space (only while the TX ring holds data) is pending. When
+ * UART2_IRQ_PORT/PIN are defined (see uart2.h) the pin is a falling edge
+ * GPIO interrupt; uart2_intHandler only notes it, because I2C2 is shared
+ * with the other devices and polled, and the I2C transfers are made by
+ * uart2_poll from the main loop. uart2_poll also looks at the level of
+ * the pin, so an IRQ that stays low is not lost. The trigger levels are
+ * set in TLR (enhanced functions on): THR asks for data when 56 places
+ * are free and RHR when 48 characters wait, so each interrupt moves close
+ * to a FIFO in one transaction.
+ *
+ * Without the pin the chip is asked on a schedule instead: with a ms tick
+ * from uart2_setTicks, uart2_poll reads IIR once every POLL_CHARS
+ * character times (and right after uart2_write/uart2_read changed the
+ * rings) and returns at once otherwise. The FIFOs fill by POLL_CHARS in
+ * that time, so the triggers are set to 4 and each poll moves what has
+ * accumulated. Without a tick it reads IIR on every call.
  */
 
 /******************************************************************************
@@ -37,6 +62,11 @@
 #define R_MCR 0x04
 #define R_LSR 0x05
 #define R_MSR 0x06
+#define R_TXLVL 0x08
+#define R_RXLVL 0x09
+
+#define R_TLR   0x07     /* with EFR[4] and MCR[2] */
+#define R_EFR   0x02     /* with LCR = 0xBF */
 
 #define R_IOCTRL 0x0E
 #define R_EFCR   0x0F
@@ -50,6 +80,40 @@
 
 #define LSR_THRE	0x20
 #define LSR_RDR		0x01
+#define LSR_ERRORS	0x9E    /* overrun, parity, framing, break, FIFO error */
+
+#define IER_RHR		0x01    /* RX trigger level and RX time-out */
+#define IER_THR		0x02
+#define IER_RLS		0x04
+
+#define IIR_NONE	0x01
+#define IIR_SOURCE	0x3E
+#define IIR_RLS		0x06
+
+/* FIFO enable and reset, the trigger levels are in TLR */
+#define FCR_INIT	0x07
+
+#define LCR_ENHANCED	0xBF    /* access to EFR */
+#define LCR_8N1		0x03
+#define EFR_ENHANCED	0x10    /* TLR and MCR[2] writable */
+#define MCR_TLR		0x04    /* registers 6 and 7 are TCR and TLR */
+
+/* TLR: RX trigger in bits 7..4, TX trigger (free places) in bits 3..0,
+   in steps of 4 */
+#ifdef UART2_IRQ_PORT
+#define TLR_INIT	((48 / 4) << 4 | (56 / 4))
+#else
+#define TLR_INIT	((4 / 4) << 4 | (4 / 4))
+#endif
+
+/* Characters between two scheduled polls without the IRQ pin, 16 of the
+   64 places are left for the poll itself and a late tick */
+#define POLL_CHARS	48
+
+#define FIFO_SIZE	64
+
+#define RX_MASK		(UART2_RX_SIZE - 1)
+#define TX_MASK		(UART2_TX_SIZE - 1)
 
 /******************************************************************************
  * External global variables
@@ -61,22 +125,36 @@
 
 static uint8_t channel = 0;
 
+static uint8_t rxRing[UART2_RX_SIZE];
+static uint8_t txRing[UART2_TX_SIZE];
+static uint32_t rxHead = 0;
+static uint32_t rxTail = 0;
+static uint32_t txHead = 0;
+static uint32_t txTail = 0;
+static uint8_t ier = 0;
+static volatile uint32_t irqPending = 0;
+static uint32_t lineErrors = 0;
+static uint32_t (*getTicks)(void) = NULL;
+static uint32_t pollMs = 1;
+static uint32_t lastPoll = 0;
+
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
 
-static int I2CRead(uint8_t addr, uint8_t* buf, uint32_t len)
+static int I2CWriteRead(uint8_t addr, uint8_t* txbuf, uint32_t txlen,
+		uint8_t* rxbuf, uint32_t rxlen)
 {
-	I2C_M_SETUP_Type rxsetup;
+	I2C_M_SETUP_Type setup;
 
-	rxsetup.sl_addr7bit = addr;
-	rxsetup.tx_data = NULL;	// Get address to read at writing address
-	rxsetup.tx_length = 0;
-	rxsetup.rx_data = buf;
-	rxsetup.rx_length = len;
-	rxsetup.retransmissions_max = 3;
+	setup.sl_addr7bit = addr;
+	setup.tx_data = txbuf;	// Register to read, then a repeated start
+	setup.tx_length = txlen;
+	setup.rx_data = rxbuf;
+	setup.rx_length = rxlen;
+	setup.retransmissions_max = 3;
 
-	if (I2C_MasterTransferData(I2CDEV, &rxsetup, I2C_TRANSFER_POLLING) == SUCCESS){
+	if (I2C_MasterTransferData(I2CDEV, &setup, I2C_TRANSFER_POLLING) == SUCCESS){
 		return (0);
 	} else {
 		return (-1);
@@ -112,15 +190,112 @@ static void writeReg(uint8_t reg, uint8_t data)
 
 static uint8_t readReg(uint8_t reg)
 {
-    uint8_t buf[1];
+    uint8_t sub = SUB_ADDR(channel, reg);
+    uint8_t buf[1] = {0};
 
-    buf[0] = SUB_ADDR(channel, reg);
-    I2CWrite(UART2_ADDR, buf, 1);
-    I2CRead(UART2_ADDR, buf, 1);
+    I2CWriteRead(UART2_ADDR, &sub, 1, buf, 1);
 
     return buf[0];
 }
 
+/* Writes len (at most FIFO_SIZE) bytes to THR in one transaction */
+static void writeFifo(const uint8_t *data, uint32_t len)
+{
+    uint8_t buf[FIFO_SIZE + 1];
+    uint32_t i;
+
+    buf[0] = SUB_ADDR(channel, R_THR);
+    for (i = 0; i < len; i++) {
+        buf[i + 1] = data[i];
+    }
+    I2CWrite(UART2_ADDR, buf, len + 1);
+}
+
+/* Reads len (at most FIFO_SIZE) bytes from RHR in one transaction */
+static int readFifo(uint8_t *data, uint32_t len)
+{
+    uint8_t sub = SUB_ADDR(channel, R_RHR);
+
+    return I2CWriteRead(UART2_ADDR, &sub, 1, data, len);
+}
+
+static void setIer(uint8_t value)
+{
+    if (value != ier) {
+        ier = value;
+        writeReg(R_IER, ier);
+    }
+}
+
+static uint32_t pollDue(void)
+{
+#ifdef UART2_IRQ_PORT
+    return ((GPIO_ReadValue(UART2_IRQ_PORT) & (1 << UART2_IRQ_PIN)) == 0);
+#else
+    /* no pin, ask the chip when the next poll is due */
+    if (getTicks == NULL) {
+        return 1;
+    }
+    if ((getTicks() - lastPoll) >= pollMs) {
+        lastPoll = getTicks();
+        return 1;
+    }
+    return 0;
+#endif
+}
+
+/* Empties the RX FIFO into the RX ring, as far as the ring has room */
+static void serviceRx(void)
+{
+    uint32_t level = readReg(R_RXLVL);
+    uint32_t run;
+
+    while (level != 0) {
+        run = UART2_RX_SIZE - (rxHead - rxTail);
+        if (run > UART2_RX_SIZE - (rxHead & RX_MASK)) {
+            run = UART2_RX_SIZE - (rxHead & RX_MASK);
+        }
+        if (run > level) {
+            run = level;
+        }
+        if (run == 0) {
+            /* ring full: leave the rest in the FIFO until uart2_read */
+            setIer(ier & ~IER_RHR);
+            return;
+        }
+        if (readFifo(&rxRing[rxHead & RX_MASK], run) != 0) {
+            return;
+        }
+        rxHead += run;
+        level -= run;
+    }
+}
+
+/* Fills the TX FIFO from the TX ring */
+static void serviceTx(void)
+{
+    uint32_t space;
+    uint32_t run;
+
+    if (txHead != txTail) {
+        space = readReg(R_TXLVL);
+        while ((space != 0) && (txHead != txTail)) {
+            run = txHead - txTail;
+            if (run > UART2_TX_SIZE - (txTail & TX_MASK)) {
+                run = UART2_TX_SIZE - (txTail & TX_MASK);
+            }
+            if (run > space) {
+                run = space;
+            }
+            writeFifo(&txRing[txTail & TX_MASK], run);
+            txTail += run;
+            space -= run;
+        }
+    }
+    /* THR interrupt only while there is something to send */
+    setIer((txHead != txTail) ? (ier | IER_THR) : (ier & ~IER_THR));
+}
+
 
 /******************************************************************************
  * Public Functions
@@ -129,7 +304,9 @@ static uint8_t readReg(uint8_t reg)
 /******************************************************************************
  *
  * Description:
- *    Initialize the ISL29003 Device
+ *    Initialize the SC16IS752 Device, with its FIFOs and interrupts.
+ *    With UART2_IRQ_PORT/PIN defined the application calls
+ *    uart2_intHandler from EINT3_IRQHandler and enables EINT3_IRQn.
  *
  * Params:
  *   [in] baudRate - the baud rate to use
@@ -148,6 +325,33 @@ void uart2_init (uint32_t baudRate, uart2_channel_t chan)
 
     channel = chan;
     uart2_setBaudRate(baudRate);
+
+    /* trigger levels in TLR, reached through EFR[4] and MCR[2] */
+    writeReg(R_LCR, LCR_ENHANCED);
+    writeReg(R_EFR, EFR_ENHANCED);
+    writeReg(R_LCR, LCR_8N1);
+    writeReg(R_MCR, MCR_TLR);
+    writeReg(R_TLR, TLR_INIT);
+    writeReg(R_MCR, 0);
+
+    rxHead = rxTail = 0;
+    txHead = txTail = 0;
+    writeReg(R_FCR, FCR_INIT);
+    ier = 0;
+    setIer(IER_RHR | IER_RLS);
+
+#ifdef UART2_IRQ_PORT
+    /* IRQ# on a falling edge GPIO interrupt (EINT3), the other pins of
+       the port keep their setting */
+    GPIO_SetDir(UART2_IRQ_PORT, 1 << UART2_IRQ_PIN, 0);
+    GPIO_ClearInt(UART2_IRQ_PORT, 1 << UART2_IRQ_PIN);
+    if (UART2_IRQ_PORT == 0) {
+        LPC_GPIOINT->IO0IntEnF |= (1 << UART2_IRQ_PIN);
+    } else {
+        LPC_GPIOINT->IO2IntEnF |= (1 << UART2_IRQ_PIN);
+    }
+#endif
+    irqPending = 1;
 }
 
 /******************************************************************************
@@ -182,13 +386,143 @@ void uart2_setBaudRate(uint32_t baudRate)
     writeReg(R_DLH, (uint8_t)((div >> 8) & 0xff));
 
     /* line control  */
-    writeReg(R_LCR, 0x03); // 8 bit data, 1 stop bit, no parity
+    writeReg(R_LCR, LCR_8N1); // 8 bit data, 1 stop bit, no parity
+
+    /* 10 bits per character */
+    pollMs = (POLL_CHARS * 10 * 1000) / baudRate;
+    if (pollMs == 0) {
+        pollMs = 1;
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Give uart2_poll a ms tick, so that without UART2_IRQ_PORT it asks
+ *    the chip only every POLL_CHARS character times
+ *
+ * Params:
+ *   [in] getMsTicks - callback function for retrieving number of elapsed
+ *                     ticks in milliseconds, NULL to ask on every call
+ *
+ *****************************************************************************/
+void uart2_setTicks(uint32_t (*getMsTicks)(void))
+{
+    getTicks = getMsTicks;
+    if (getTicks != NULL) {
+        lastPoll = getTicks();
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    GPIO interrupt of the IRQ# pin, call from EINT3_IRQHandler. Only
+ *    notes the request, see uart2_poll.
+ *
+ *****************************************************************************/
+void uart2_intHandler(void)
+{
+#ifdef UART2_IRQ_PORT
+    if (GPIO_GetIntStatus(UART2_IRQ_PORT, UART2_IRQ_PIN, 1)) {
+        GPIO_ClearInt(UART2_IRQ_PORT, 1 << UART2_IRQ_PIN);
+        irqPending = 1;
+    }
+#endif
 }
 
 /******************************************************************************
  *
  * Description:
- *    Send data to UART
+ *    Moves data between the chip FIFOs and the rings when the chip asked
+ *    for it. Call from the main loop, never from an interrupt (I2C).
+ *
+ *****************************************************************************/
+void uart2_poll(void)
+{
+    uint8_t iir;
+
+    if (!irqPending && !pollDue()) {
+        return;
+    }
+    irqPending = 0;
+
+    iir = readReg(R_IIR);
+    if ((iir & IIR_NONE) != 0) {
+        return;     /* nothing pending, the FIFO levels need no look */
+    }
+    if ((iir & IIR_SOURCE) == IIR_RLS) {
+        if ((readReg(R_LSR) & LSR_ERRORS) != 0) {
+            lineErrors++;
+        }
+    }
+    if ((ier & IER_RHR) != 0) {
+        serviceRx();
+    }
+    serviceTx();
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Queue data for sending, without waiting
+ *
+ * Params:
+ *   [in] buffer - buffer with data
+ *   [in] length - number of bytes of data
+ *
+ * Returns:
+ *    Number of bytes queued, less than length when the TX ring is full
+ *
+ *****************************************************************************/
+uint32_t uart2_write(const uint8_t *buffer, uint32_t length)
+{
+    uint32_t n = 0;
+
+    while ((n < length) && ((txHead - txTail) < UART2_TX_SIZE)) {
+        txRing[txHead & TX_MASK] = buffer[n];
+        txHead++;
+        n++;
+    }
+    if ((n != 0) && ((ier & IER_THR) == 0)) {
+        serviceTx();        /* FIFO may be idle, no THR interrupt to come */
+    }
+    return n;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Take received data, without waiting
+ *
+ * Params:
+ *   [in] buffer - data will be written to this buffer
+ *   [in] length - length of buffer in bytes
+ *
+ * Returns:
+ *    Number of bytes received
+ *
+ *****************************************************************************/
+uint32_t uart2_read(uint8_t *buffer, uint32_t length)
+{
+    uint32_t n = 0;
+
+    while ((n < length) && (rxHead != rxTail)) {
+        buffer[n] = rxRing[rxTail & RX_MASK];
+        rxTail++;
+        n++;
+    }
+    if (((ier & IER_RHR) == 0) && ((UART2_RX_SIZE - (rxHead - rxTail)) >= FIFO_SIZE)) {
+        setIer(ier | IER_RHR);  /* room again for what waits in the FIFO */
+        irqPending = 1;
+    }
+    return n;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Send data to UART, waits until all of it is queued
  *
  * Params:
  *   [in] buffer - buffer with data
@@ -197,6 +531,8 @@ void uart2_setBaudRate(uint32_t baudRate)
  *****************************************************************************/
 void uart2_send(uint8_t *buffer, uint32_t length)
 {
+    uint32_t n;
+
     if (!buffer) {
         /* error */
         return;
@@ -204,13 +540,12 @@ void uart2_send(uint8_t *buffer, uint32_t length)
 
     while ( length != 0 )
     {
-        /* THRE status, contain valid data */
-        while ( !(readReg(R_LSR) & LSR_THRE) );
-
-        writeReg(R_THR, *buffer);
-
-        buffer++;
-        length--;
+        n = uart2_write(buffer, length);
+        buffer += n;
+        length -= n;
+        if (length != 0) {
+            uart2_poll();
+        }
     }
     return;
 }
@@ -226,19 +561,18 @@ void uart2_send(uint8_t *buffer, uint32_t length)
  *****************************************************************************/
 void uart2_sendString(uint8_t *string)
 {
+    uint32_t length = 0;
+
     if (!string) {
         /* error */
         return;
     }
 
-    while ( *string != '\0' )
+    while ( string[length] != '\0' )
     {
-        /* THRE status, contain valid data */
-        while ( !(readReg(R_LSR) & LSR_THRE) );
-        writeReg(R_THR, *string);
-
-        string++;
+        length++;
     }
+    uart2_send(string, length);
 
     return;
 }
@@ -257,39 +591,29 @@ void uart2_sendString(uint8_t *string)
 uint32_t uart2_receive(uint8_t *buffer, uint32_t length, uint32_t blocking)
 {
     uint32_t recvd = 0;
-    uint32_t toRecv = length;
 
-    if (blocking) {
+    uart2_poll();
+    recvd = uart2_read(buffer, length);
 
-        while (toRecv) {
-            /* wait for data */
-            while (!(readReg(R_LSR) & LSR_RDR));
-
-            *buffer++ = readReg(R_RHR);
-
-            recvd++;
-            toRecv--;
-        }
-
-    }
-    else {
-
-        while (toRecv) {
-            /* break if no data */
-            if (!(readReg(R_LSR) & LSR_RDR)) {
-                break;
-            }
-
-            *buffer++ = readReg(R_RHR);
-
-            recvd++;
-            toRecv--;
-        }
+    while (blocking && (recvd < length)) {
+        uart2_poll();
+        recvd += uart2_read(&buffer[recvd], length - recvd);
     }
 
     return recvd;
 }
 
+/******************************************************************************
+ *
+ * Description:
+ *    Number of line errors (overrun, parity, framing, break) seen
+ *
+ *****************************************************************************/
+uint32_t uart2_getLineErrors(void)
+{
+    return lineErrors;
+}
+
 uint8_t uart2_getModemStatus(void)
 {
     return readReg(R_MSR);
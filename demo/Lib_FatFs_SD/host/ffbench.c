@@ -0,0 +1,270 @@
+/*-----------------------------------------------------------------------*/
+/* FatFs file system layer benchmark on the host RAM disk backend        */
+/*-----------------------------------------------------------------------*/
+/* Formats the image, then runs the scenarios below and prints one line  */
+/* per scenario with the disk commands, sectors and the modeled SPI SD   */
+/* time they would take. Compare runs before and after a change in ff.c. */
+/*                                                                       */
+/*   seqwrite  two files written in turns, 1KB per f_write              */
+/*   stream    the same amount written with f_stream_write, f_sync per  */
+/*             64 sectors                                               */
+/*   append    64 byte records appended with f_sync after each          */
+/*   randread  512 byte reads at random offsets of the first file        */
+/*   dirscan   f_readdir over a directory of small files                 */
+/*-----------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ff.h"
+#include "diskio.h"
+#include "ramdisk.h"
+
+
+#define CHUNK		1024
+#define RECORD		64
+#define N_DIRFILES	64
+
+static FATFS Fs;
+static BYTE Buff[CHUNK];
+
+static DWORD SeqKB = 1024;		/* Size of each seqwrite file (KB) */
+static DWORD Records = 1000;	/* Number of appended records */
+static DWORD Reads = 1000;		/* Number of random reads */
+static DWORD Scans = 20;		/* Number of directory scans */
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Report a scenario                                                     */
+/*-----------------------------------------------------------------------*/
+
+static
+void report (
+	const char *name,
+	DWORD ops
+)
+{
+	RAMDISK_STAT st;
+
+
+	ramdisk_get_stat(&st);
+	printf("%-9s %8lu %8lu %8lu %8lu %8lu %6lu %10.1f",
+		name, (unsigned long)ops,
+		(unsigned long)st.rd_cmds, (unsigned long)st.rd_sects,
+		(unsigned long)st.wr_cmds, (unsigned long)st.wr_sects,
+		(unsigned long)st.syncs, (double)st.time_ns / 1e6);
+#if _FS_WINCACHE
+	printf(" %8lu %8lu", (unsigned long)Fs.wc_hit, (unsigned long)Fs.wc_miss);
+	Fs.wc_hit = Fs.wc_miss = 0;
+#endif
+	printf("\n");
+	ramdisk_reset_stat();
+}
+
+
+static
+void fail (
+	const char *what,
+	FRESULT res
+)
+{
+	fprintf(stderr, "ffbench: %s failed (FRESULT %d)\n", what, (int)res);
+	exit(1);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Scenarios                                                             */
+/*-----------------------------------------------------------------------*/
+
+static
+void bench_seqwrite (void)
+{
+	FIL f1, f2;
+	FRESULT res;
+	UINT bw;
+	DWORD n;
+
+
+	if ((res = f_open(&f1, "SEQ1.BIN", FA_WRITE | FA_CREATE_ALWAYS)) != FR_OK) fail("f_open", res);
+	if ((res = f_open(&f2, "SEQ2.BIN", FA_WRITE | FA_CREATE_ALWAYS)) != FR_OK) fail("f_open", res);
+	for (n = 0; n < SeqKB * 1024 / CHUNK; n++) {	/* Interleave to fragment both files */
+		memset(Buff, (int)n, CHUNK);
+		if ((res = f_write(&f1, Buff, CHUNK, &bw)) != FR_OK || bw != CHUNK) fail("f_write", res);
+		if ((res = f_write(&f2, Buff, CHUNK, &bw)) != FR_OK || bw != CHUNK) fail("f_write", res);
+	}
+	f_close(&f1);
+	f_close(&f2);
+	report("seqwrite", n * 2);
+}
+
+
+#if _USE_STREAM
+static
+void bench_stream (void)
+{
+	FIL f;
+	FRESULT res;
+	DWORD n;
+
+
+	if ((res = f_open(&f, "STREAM.BIN", FA_WRITE | FA_CREATE_ALWAYS)) != FR_OK) fail("f_open", res);
+	if ((res = f_stream_begin(&f, SeqKB * 2 * 1024)) != FR_OK) fail("f_stream_begin", res);
+	for (n = 0; n < SeqKB * 2 * 1024 / 512; n++) {
+		memset(Buff, (int)(n / 2), 512);		/* Same content as seqwrite */
+		if ((res = f_stream_write(&f, Buff)) != FR_OK) fail("f_stream_write", res);
+		if ((n % 64) == 63 && (res = f_sync(&f)) != FR_OK) fail("f_sync", res);
+	}
+	if ((res = f_stream_end(&f)) != FR_OK) fail("f_stream_end", res);
+	f_close(&f);
+	report("stream", n);
+}
+#endif
+
+
+static
+void bench_append (void)
+{
+	FIL f;
+	FRESULT res;
+	UINT bw;
+	DWORD n;
+
+
+	if ((res = f_open(&f, "LOG.BIN", FA_WRITE | FA_OPEN_ALWAYS)) != FR_OK) fail("f_open", res);
+	for (n = 0; n < Records; n++) {
+		memset(Buff, (int)n, RECORD);
+		if ((res = f_lseek(&f, f.fsize)) != FR_OK) fail("f_lseek", res);
+		if ((res = f_write(&f, Buff, RECORD, &bw)) != FR_OK || bw != RECORD) fail("f_write", res);
+		if ((res = f_sync(&f)) != FR_OK) fail("f_sync", res);
+	}
+	f_close(&f);
+	report("append", n);
+}
+
+
+static
+void bench_randread (void)
+{
+	FIL f;
+	FRESULT res;
+	UINT br;
+	DWORD n, ofs, seed = 1;
+#if _USE_FASTSEEK
+	static DWORD clmt[1024];
+#endif
+
+
+	if ((res = f_open(&f, "SEQ1.BIN", FA_READ)) != FR_OK) fail("f_open", res);
+#if _USE_FASTSEEK
+	clmt[0] = sizeof(clmt) / sizeof(clmt[0]);
+	f.cltbl = clmt;
+	res = f_lseek(&f, CREATE_LINKMAP);		/* Falls back to normal seek if the table is too small */
+	if (res != FR_OK && res != FR_NOT_ENOUGH_CORE) fail("CREATE_LINKMAP", res);
+#endif
+	for (n = 0; n < Reads; n++) {
+		seed = seed * 1103515245 + 12345;
+		ofs = (DWORD)((seed >> 8) % (f.fsize - 512));
+		if ((res = f_lseek(&f, ofs)) != FR_OK) fail("f_lseek", res);
+		if ((res = f_read(&f, Buff, 512, &br)) != FR_OK || br != 512) fail("f_read", res);
+		if (Buff[0] != (BYTE)(ofs / CHUNK)) fail("data check", FR_INT_ERR);	/* seqwrite fills each chunk with its index */
+	}
+	f_close(&f);
+	report("randread", n);
+}
+
+
+static
+void bench_dirscan (void)
+{
+	FIL f;
+	DIR dir;
+	FILINFO fno;
+	FRESULT res;
+	char name[13];
+	DWORD n, items = 0;
+
+
+	for (n = 0; n < N_DIRFILES; n++) {
+		sprintf(name, "F%03lu.TXT", (unsigned long)n);
+		if ((res = f_open(&f, name, FA_WRITE | FA_CREATE_ALWAYS)) != FR_OK) fail("f_open", res);
+		f_close(&f);
+	}
+	ramdisk_reset_stat();
+#if _FS_WINCACHE
+	Fs.wc_hit = Fs.wc_miss = 0;
+#endif
+
+	for (n = 0; n < Scans; n++) {
+		if ((res = f_opendir(&dir, "")) != FR_OK) fail("f_opendir", res);
+		for (;;) {
+			if ((res = f_readdir(&dir, &fno)) != FR_OK) fail("f_readdir", res);
+			if (!fno.fname[0]) break;
+			items++;
+		}
+	}
+	report("dirscan", items);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Main                                                                  */
+/*-----------------------------------------------------------------------*/
+
+int main (int argc, char *argv[])
+{
+	const char *image = "ffbench.img";
+	DWORD sectors = 65536;		/* 32MB, FAT16 */
+	RAMDISK_TIMING tm = { 200000, 640, 300000 };
+	FRESULT res;
+	int c;
+
+
+	while ((c = getopt(argc, argv, "i:s:c:b:p:n:")) != -1) {
+		switch (c) {
+		case 'i': image = optarg; break;
+		case 's': sectors = strtoul(optarg, NULL, 0); break;
+		case 'c': tm.cmd_ns = strtoul(optarg, NULL, 0); break;
+		case 'b': tm.byte_ns = strtoul(optarg, NULL, 0); break;
+		case 'p': tm.prog_ns = strtoul(optarg, NULL, 0); break;
+		case 'n': SeqKB = strtoul(optarg, NULL, 0); break;
+		default:
+			fprintf(stderr, "usage: %s [-i image] [-s sectors] [-c cmd_ns] [-b byte_ns] [-p prog_ns] [-n seq_kb]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	if (ramdisk_open(image, sectors) != 0) {
+		fprintf(stderr, "ffbench: cannot map %s\n", image);
+		return 1;
+	}
+	ramdisk_set_timing(&tm);
+	f_mount(0, &Fs);
+	if ((res = f_mkfs(0, 1, 4096)) != FR_OK) fail("f_mkfs", res);
+	ramdisk_reset_stat();
+
+	printf("%-9s %8s %8s %8s %8s %8s %6s %10s", "scenario", "ops",
+		"rd_cmd", "rd_sect", "wr_cmd", "wr_sect", "sync", "model_ms");
+#if _FS_WINCACHE
+	printf(" %8s %8s", "wc_hit", "wc_miss");
+#endif
+	printf("\n");
+
+	bench_seqwrite();
+#if _USE_STREAM
+	bench_stream();
+#endif
+	bench_append();
+	bench_randread();
+	bench_dirscan();
+
+	f_mount(0, NULL);
+	ramdisk_close();
+
+	return 0;
+}
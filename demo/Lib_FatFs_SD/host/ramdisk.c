@@ -0,0 +1,315 @@
+/*-----------------------------------------------------------------------*/
+/* Host diskio backend serving sectors from a memory mapped image file   */
+/*-----------------------------------------------------------------------*/
+/* Replaces mmc.c in the host build. Sector data comes from an image     */
+/* file mapped with mmap(), so nothing touches real hardware and the     */
+/* image can be inspected (or mounted by the OS) afterwards. The time a  */
+/* card on the SSP bus would need is accumulated in a counter instead of */
+/* being slept, which keeps runs fast and results reproducible.          */
+/*-----------------------------------------------------------------------*/
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "diskio.h"
+#include "ramdisk.h"
+
+
+#define SECT_SIZE	512
+#define BLOCK_BYTES	(1 + SECT_SIZE + 2)	/* Data token + data + CRC */
+
+
+static
+BYTE *Image;			/* Mapped image, NULL: not opened */
+
+static
+DWORD Sectors;			/* Image size in sectors */
+
+static
+DSTATUS Stat = STA_NOINIT;
+
+static
+RAMDISK_TIMING Timing = { 200000, 640, 300000 };	/* 200us access, 12.5MHz SCK, 300us program */
+
+static
+RAMDISK_STAT Counter;
+
+static
+DWORD StreamSect;		/* Next sector of the open streaming session (0:None) */
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Account modeled bus/card time of a transfer                           */
+/*-----------------------------------------------------------------------*/
+
+static
+void account (
+	BYTE count,		/* Number of blocks */
+	BOOL write		/* TRUE: write transfer */
+)
+{
+	unsigned long long t;
+
+
+	t = (unsigned long long)Timing.cmd_ns * ((count > 1) ? 2 : 1);	/* CMD17/24 or CMD18/25 + stop */
+	if (write && count > 1) t += Timing.cmd_ns;	/* ACMD23 as sent by mmc.c */
+	t += (unsigned long long)Timing.byte_ns * BLOCK_BYTES * count;
+	if (write) t += (unsigned long long)Timing.prog_ns * count;
+	Counter.time_ns += t;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Terminate an open streaming session (STOP_TRAN token)                 */
+/*-----------------------------------------------------------------------*/
+
+static
+void stream_stop (void)
+{
+	if (StreamSect) {
+		StreamSect = 0;
+		Counter.time_ns += Timing.cmd_ns;
+	}
+}
+
+
+
+/*--------------------------------------------------------------------------
+
+   Public Functions
+
+---------------------------------------------------------------------------*/
+
+int ramdisk_open (
+	const char *path,	/* Image file */
+	DWORD sectors		/* Size to create/extend the image to, 0: use the file size */
+)
+{
+	int fd;
+	struct stat st;
+
+
+	ramdisk_close();
+
+	fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0) return -1;
+	if (fstat(fd, &st) != 0) { close(fd); return -1; }
+	if (sectors && (DWORD)(st.st_size / SECT_SIZE) < sectors) {
+		if (ftruncate(fd, (off_t)sectors * SECT_SIZE) != 0) { close(fd); return -1; }
+	} else {
+		sectors = (DWORD)(st.st_size / SECT_SIZE);
+	}
+	if (!sectors) { close(fd); return -1; }
+
+	Image = mmap(NULL, (size_t)sectors * SECT_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (Image == MAP_FAILED) {
+		Image = NULL;
+		return -1;
+	}
+	Sectors = sectors;
+	Stat = STA_NOINIT;
+	StreamSect = 0;
+	ramdisk_reset_stat();
+
+	return 0;
+}
+
+
+void ramdisk_close (void)
+{
+	if (Image) {
+		msync(Image, (size_t)Sectors * SECT_SIZE, MS_SYNC);
+		munmap(Image, (size_t)Sectors * SECT_SIZE);
+		Image = NULL;
+	}
+	Stat = STA_NOINIT | STA_NODISK;
+}
+
+
+void ramdisk_set_timing (const RAMDISK_TIMING *timing)
+{
+	Timing = *timing;
+}
+
+
+void ramdisk_get_stat (RAMDISK_STAT *stat)
+{
+	*stat = Counter;
+}
+
+
+void ramdisk_reset_stat (void)
+{
+	memset(&Counter, 0, sizeof(Counter));
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* diskio interface                                                      */
+/*-----------------------------------------------------------------------*/
+
+DSTATUS disk_initialize (
+	BYTE drv		/* Physical drive nmuber (0) */
+)
+{
+	if (drv) return STA_NOINIT;			/* Supports only single drive */
+	if (!Image) return STA_NOINIT | STA_NODISK;
+
+	Stat &= ~STA_NOINIT;
+	return Stat;
+}
+
+
+DSTATUS disk_status (
+	BYTE drv		/* Physical drive nmuber (0) */
+)
+{
+	if (drv) return STA_NOINIT;
+	return Stat;
+}
+
+
+DRESULT disk_read (
+	BYTE drv,			/* Physical drive nmuber (0) */
+	BYTE *buff,			/* Pointer to the data buffer to store read data */
+	DWORD sector,		/* Start sector number (LBA) */
+	BYTE count			/* Sector count (1..255) */
+)
+{
+	if (drv || !count) return RES_PARERR;
+	if (Stat & STA_NOINIT) return RES_NOTRDY;
+	if (sector >= Sectors || Sectors - sector < count) return RES_PARERR;
+	stream_stop();
+
+	memcpy(buff, Image + (size_t)sector * SECT_SIZE, (size_t)count * SECT_SIZE);
+	Counter.rd_cmds++;
+	Counter.rd_sects += count;
+	account(count, FALSE);
+
+	return RES_OK;
+}
+
+
+#if _READONLY == 0
+DRESULT disk_write (
+	BYTE drv,			/* Physical drive nmuber (0) */
+	const BYTE *buff,	/* Pointer to the data to be written */
+	DWORD sector,		/* Start sector number (LBA) */
+	BYTE count			/* Sector count (1..255) */
+)
+{
+	if (drv || !count) return RES_PARERR;
+	if (Stat & STA_NOINIT) return RES_NOTRDY;
+	if (sector >= Sectors || Sectors - sector < count) return RES_PARERR;
+	stream_stop();
+
+	memcpy(Image + (size_t)sector * SECT_SIZE, buff, (size_t)count * SECT_SIZE);
+	Counter.wr_cmds++;
+	Counter.wr_sects += count;
+	account(count, TRUE);
+
+	return RES_OK;
+}
+
+
+DRESULT disk_stream_begin (
+	BYTE drv,			/* Physical drive nmuber (0) */
+	DWORD sector,		/* Start sector number (LBA) */
+	DWORD count			/* Number of sectors expected (pre-erase), 0:Unknown */
+)
+{
+	if (drv) return RES_PARERR;
+	if (Stat & STA_NOINIT) return RES_NOTRDY;
+	if (!sector || sector >= Sectors) return RES_PARERR;
+	stream_stop();
+
+	StreamSect = sector;
+	Counter.wr_cmds++;
+	Counter.time_ns += (unsigned long long)Timing.cmd_ns * (count ? 2 : 1);	/* ACMD23 + CMD25 */
+
+	return RES_OK;
+}
+
+
+DRESULT disk_stream_write (
+	BYTE drv,			/* Physical drive nmuber (0) */
+	const BYTE *buff	/* 512 byte block to be written */
+)
+{
+	if (drv) return RES_PARERR;
+	if (!StreamSect) return RES_NOTRDY;
+	if (StreamSect >= Sectors) {
+		stream_stop();
+		return RES_ERROR;
+	}
+
+	memcpy(Image + (size_t)StreamSect * SECT_SIZE, buff, SECT_SIZE);
+	StreamSect++;
+	Counter.wr_sects++;
+	Counter.time_ns += (unsigned long long)Timing.byte_ns * BLOCK_BYTES + Timing.prog_ns;
+
+	return RES_OK;
+}
+
+
+DRESULT disk_stream_end (
+	BYTE drv			/* Physical drive nmuber (0) */
+)
+{
+	if (drv) return RES_PARERR;
+	stream_stop();
+
+	return RES_OK;
+}
+#endif /* _READONLY == 0 */
+
+
+DRESULT disk_ioctl (
+	BYTE drv,		/* Physical drive nmuber (0) */
+	BYTE ctrl,		/* Control code */
+	void *buff		/* Buffer to send/receive control data */
+)
+{
+	if (drv) return RES_PARERR;
+	if (Stat & STA_NOINIT) return RES_NOTRDY;
+	stream_stop();
+
+	switch (ctrl) {
+	case CTRL_SYNC :
+		Counter.syncs++;
+		return RES_OK;
+
+	case GET_SECTOR_COUNT :
+		*(DWORD*)buff = Sectors;
+		return RES_OK;
+
+	case GET_SECTOR_SIZE :
+		*(WORD*)buff = SECT_SIZE;
+		return RES_OK;
+
+	case GET_BLOCK_SIZE :
+		*(DWORD*)buff = 1;
+		return RES_OK;
+	}
+
+	return RES_PARERR;
+}
+
+
+void disk_timerproc (void)
+{
+}
+
+
+DWORD get_fattime (void)
+{
+	return ((DWORD)(2022 - 1980) << 25) | ((DWORD)2 << 21) | ((DWORD)2 << 16)
+		| ((DWORD)2 << 11) | ((DWORD)2 << 5) | 1;	/* 2022-02-02 02:02:02 */
+}
@@ -0,0 +1,44 @@
+/*-----------------------------------------------------------------------
+/  Host RAM disk / image file diskio backend include file
+/-----------------------------------------------------------------------*/
+
+#ifndef _RAMDISK
+
+#include "integer.h"
+
+
+/* Access statistics and modeled time of the backend */
+typedef struct _RAMDISK_STAT_ {
+	DWORD	rd_cmds;		/* Number of disk_read calls */
+	DWORD	wr_cmds;		/* Number of disk_write calls */
+	DWORD	rd_sects;		/* Number of sectors read */
+	DWORD	wr_sects;		/* Number of sectors written */
+	DWORD	syncs;			/* Number of CTRL_SYNC requests */
+	unsigned long long time_ns;	/* Modeled time spent on the bus and in the card */
+} RAMDISK_STAT;
+
+
+/* Timing model of a card in SPI mode. Every read/write call costs cmd_ns
+/  (command, access time, plus one more for the stop command or token of a
+/  multiple block transfer), every block costs (token + data + CRC) bytes
+/  of byte_ns each and a written block additionally costs prog_ns. A multiple
+/  block write and a streaming session (disk_stream_*) both send ACMD23 and
+/  are modeled alike: one more command and the full prog_ns per block. How
+/  much a pre-erase shortens the busy time depends on the card and is not
+/  modeled, so the stream figures only show the saved commands. */
+typedef struct _RAMDISK_TIMING_ {
+	DWORD	cmd_ns;			/* Latency per command */
+	DWORD	byte_ns;		/* Cost per byte on the bus (8 / SCK) */
+	DWORD	prog_ns;		/* Programming busy time per written block */
+} RAMDISK_TIMING;
+
+
+int ramdisk_open (const char*, DWORD);	/* Map an image file (0:Success, -1:Error) */
+void ramdisk_close (void);				/* Unmap the image, written data is kept in the file */
+void ramdisk_set_timing (const RAMDISK_TIMING*);
+void ramdisk_get_stat (RAMDISK_STAT*);
+void ramdisk_reset_stat (void);
+
+
+#define _RAMDISK
+#endif
@@ -8,6 +8,7 @@
 #define _USE_IOCTL	1
 
 #include "integer.h"
+#include "ffconf.h"	/* _USE_STREAM, _FS_READONLY */
 
 
 /* Status of Disk Functions */
@@ -31,6 +32,11 @@ DSTATUS disk_status (BYTE);
 DRESULT disk_read (BYTE, BYTE*, DWORD, BYTE);
 #if	_READONLY == 0
 DRESULT disk_write (BYTE, const BYTE*, DWORD, BYTE);
+#if _USE_STREAM && !_FS_READONLY
+DRESULT disk_stream_begin (BYTE, DWORD, DWORD);
+DRESULT disk_stream_write (BYTE, const BYTE*);
+DRESULT disk_stream_end (BYTE);
+#endif
 #endif
 DRESULT disk_ioctl (BYTE, BYTE, void*);
 void	disk_timerproc (void);
@@ -62,6 +68,7 @@ void	disk_timerproc (void);
 #define MMC_GET_CID			12
 #define MMC_GET_OCR			13
 #define MMC_GET_SDSTAT		14
+#define MMC_GET_SCLK		15
 /* ATA/CF command */
 #define ATA_GET_REV			20
 #define ATA_GET_MODEL		21
@@ -327,6 +327,14 @@ typedef struct _FATFS_ {
 	DWORD	database;	/* Data start sector */
 	DWORD	winsect;	/* Current sector appearing in the win[] */
 	BYTE	win[_MAX_SS];/* Disk access window for Directory/FAT */
+#if _FS_WINCACHE
+	DWORD	wc_hit;		/* Number of window loads served by the cache */
+	DWORD	wc_miss;	/* Number of window loads read from the disk */
+	DWORD	wc_sect[_FS_WINCACHE];	/* Sector# held in each cache slot (0:Empty) */
+	BYTE	wc_age[_FS_WINCACHE];	/* LRU order of the slots (0:Most recently used) */
+	BYTE	wc_dirty[_FS_WINCACHE];	/* Slot dirty flag (1:must be written back) */
+	BYTE	wc_buf[_FS_WINCACHE][_MAX_SS];	/* Cached sectors */
+#endif
 } FATFS;
 
 
@@ -366,6 +374,14 @@ typedef struct _FIL_ {
 	DWORD	dir_sect;	/* Sector containing the directory entry */
 	BYTE*	dir_ptr;	/* Ponter to the directory entry in the window */
 #endif
+#if _USE_FASTSEEK
+	DWORD*	cltbl;		/* Pointer to the cluster link map table (null:Not used) */
+#endif
+#if _USE_STREAM && !_FS_READONLY
+	DWORD	strm_top;	/* First cluster reserved by f_stream_begin (0:No reservation) */
+	DWORD	strm_end;	/* Cluster next to the last reserved one */
+	DWORD	strm_sect;	/* Next sector of the open disk streaming session (0:None) */
+#endif
 #if !_FS_TINY
 	BYTE	buf[_MAX_SS];/* File R/W buffer */
 #endif
@@ -407,7 +423,8 @@ typedef enum {
 	FR_NOT_ENABLED,		/* 12 */
 	FR_NO_FILESYSTEM,	/* 13 */
 	FR_MKFS_ABORTED,	/* 14 */
-	FR_TIMEOUT			/* 15 */
+	FR_TIMEOUT,			/* 15 */
+	FR_NOT_ENOUGH_CORE	/* 16 */
 } FRESULT;
 
 
@@ -427,6 +444,11 @@ FRESULT f_stat (const XCHAR*, FILINFO*);			/* Get file status */
 FRESULT f_getfree (const XCHAR*, DWORD*, FATFS**);	/* Get number of free clusters on the drive */
 FRESULT f_truncate (FIL*);							/* Truncate file */
 FRESULT f_sync (FIL*);								/* Flush cached data of a writing file */
+#if _USE_STREAM && !_FS_READONLY
+FRESULT f_stream_begin (FIL*, DWORD);				/* Reserve contiguous space for streaming append */
+FRESULT f_stream_write (FIL*, const void*);			/* Append a sector to the stream */
+FRESULT f_stream_end (FIL*);						/* Release unused reserved space */
+#endif
 FRESULT f_unlink (const XCHAR*);					/* Delete an existing file or directory */
 FRESULT	f_mkdir (const XCHAR*);						/* Create a new directory */
 FRESULT f_chmod (const XCHAR*, BYTE, BYTE);			/* Change attriburte of the file/dir */
@@ -495,6 +517,16 @@ void ff_rel_grant(_SYNC_t);
 #define FA__ERROR			0x80
 
 
+/* Fast seek: f_lseek offset to create the cluster link map table (FIL.cltbl).
+/  Table layout in DWORDs:
+/    [0]          in: table size, out: size required for the file (2 * runs + 3)
+/    [1 + 2n]     file cluster index where run n starts, ascending
+/    [2 + 2n]     first cluster of run n
+/    [1 + 2runs]  number of clusters of the file, followed by a 0 */
+
+#define CREATE_LINKMAP		0xFFFFFFFF
+
+
 /* FAT sub type (FATFS.fs_type) */
 
 #define FS_FAT12	1
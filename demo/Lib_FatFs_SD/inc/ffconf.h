@@ -40,14 +40,40 @@
 /* To enable string functions, set _USE_STRFUNC to 1 or 2. */
 
 
+#ifndef _USE_MKFS
 #define	_USE_MKFS	0		/* 0 or 1 */
-/* To enable f_mkfs function, set _USE_MKFS to 1 and set _FS_READONLY to 0 */
+#endif
+/* To enable f_mkfs function, set _USE_MKFS to 1 and set _FS_READONLY to 0.
+/  The host benchmark build (host/Makefile) sets it from the command line. */
 
 
 #define	_USE_FORWARD	0	/* 0 or 1 */
 /* To enable f_forward function, set _USE_FORWARD to 1 and set _FS_TINY to 1. */
 
 
+#define	_FS_WINCACHE	4	/* 0 or number of sectors */
+/* When _FS_WINCACHE is not zero, move_window keeps the given number of recently
+/  used FAT/directory sectors in the file system object (_MAX_SS bytes each) with
+/  LRU replacement. Dirty sectors are written back on eviction and on f_sync, so
+/  alternating between FAT, directory and data sectors does not reload them.
+/  FATFS.wc_hit and FATFS.wc_miss count the window loads served by the cache and
+/  by the disk. */
+
+
+#define	_USE_STREAM		1	/* 0 or 1 */
+/* To enable the streaming append functions f_stream_begin, f_stream_write and
+/  f_stream_end, set _USE_STREAM to 1 and set _FS_READONLY to 0. The disk driver
+/  must provide disk_stream_begin, disk_stream_write and disk_stream_end. */
+
+
+#define	_USE_FASTSEEK	1	/* 0 or 1 */
+/* To enable fast seek feature (cluster link map table), set _USE_FASTSEEK to 1.
+/  f_lseek(fp, CREATE_LINKMAP) fills the table pointed by fp->cltbl with the
+/  contiguous cluster runs of the file. After that, f_lseek and f_read/f_write
+/  find the cluster by a binary search in the table instead of following the
+/  FAT chain. The file cannot be expanded while fp->cltbl is set. */
+
+
 
 /*---------------------------------------------------------------------------/
 / Locale and Namespace Configurations
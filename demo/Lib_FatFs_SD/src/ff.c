@@ -235,6 +235,127 @@ void unlock_fs (
 
 
 
+#if _FS_WINCACHE
+/*-----------------------------------------------------------------------*/
+/* Window cache - Mark a slot most recently used                         */
+/*-----------------------------------------------------------------------*/
+
+static
+void wc_touch (
+	FATFS *fs,		/* File system object */
+	UINT slot		/* Slot index */
+)
+{
+	UINT i;
+	BYTE age = fs->wc_age[slot];
+
+
+	for (i = 0; i < _FS_WINCACHE; i++) {
+		if (fs->wc_age[i] < age) fs->wc_age[i]++;
+	}
+	fs->wc_age[slot] = 0;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Window cache - Invalidate slots holding sectors in a range            */
+/*-----------------------------------------------------------------------*/
+
+static
+void wc_invalidate (
+	FATFS *fs,		/* File system object */
+	DWORD sect,		/* Start sector# */
+	DWORD cnt		/* Number of sectors (0xFFFFFFFF:all slots) */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < _FS_WINCACHE; i++) {
+		if (cnt == 0xFFFFFFFF) fs->wc_age[i] = (BYTE)i;
+		if (fs->wc_sect[i] - sect < cnt) {
+			fs->wc_sect[i] = 0;
+			fs->wc_dirty[i] = 0;
+		}
+	}
+}
+
+
+
+#if !_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Window cache - Write back slots holding dirty sectors in a range      */
+/*-----------------------------------------------------------------------*/
+
+static
+FRESULT wc_clean (
+	FATFS *fs,		/* File system object */
+	DWORD sect,		/* Start sector# */
+	DWORD cnt		/* Number of sectors (0xFFFFFFFF:all slots) */
+)
+{
+	UINT i;
+	BYTE nf;
+	DWORD wsect;
+
+
+	for (i = 0; i < _FS_WINCACHE; i++) {
+		wsect = fs->wc_sect[i];
+		if (fs->wc_dirty[i] && wsect - sect < cnt) {
+			if (disk_write(fs->drive, fs->wc_buf[i], wsect, 1) != RES_OK)
+				return FR_DISK_ERR;
+			fs->wc_dirty[i] = 0;
+			if (wsect < (fs->fatbase + fs->sects_fat)) {	/* In FAT area */
+				for (nf = fs->n_fats; nf > 1; nf--) {	/* Refrect the change to all FAT copies */
+					wsect += fs->sects_fat;
+					disk_write(fs->drive, fs->wc_buf[i], wsect, 1);
+				}
+			}
+		}
+	}
+
+	return FR_OK;
+}
+#endif
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Window cache - Get the slot for a sector, evict LRU one if not cached */
+/*-----------------------------------------------------------------------*/
+
+static
+FRESULT wc_slot (	/* FR_OK: *slot is set, FR_DISK_ERR: write back failed */
+	FATFS *fs,		/* File system object */
+	DWORD sector,	/* Sector# to be cached */
+	UINT *slot		/* Found or evicted slot (wc_sect[] is 0 when evicted) */
+)
+{
+	UINT i, lru = 0;
+
+
+	for (i = 0; i < _FS_WINCACHE; i++) {
+		if (fs->wc_sect[i] == sector) {
+			*slot = i;
+			return FR_OK;
+		}
+		if (fs->wc_age[i] > fs->wc_age[lru]) lru = i;
+	}
+#if !_FS_READONLY
+	if (fs->wc_dirty[lru] && wc_clean(fs, fs->wc_sect[lru], 1) != FR_OK)
+		return FR_DISK_ERR;
+#endif
+	fs->wc_sect[lru] = 0;
+	*slot = lru;
+
+	return FR_OK;
+}
+#endif /* _FS_WINCACHE */
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Change window offset                                                  */
 /*-----------------------------------------------------------------------*/
@@ -246,12 +367,24 @@ FRESULT move_window (
 )					/* Move to zero only writes back dirty window */
 {
 	DWORD wsect;
+#if _FS_WINCACHE
+	UINT slot;
+#endif
 
 
 	wsect = fs->winsect;
 	if (wsect != sector) {	/* Changed current window */
 #if !_FS_READONLY
 		if (fs->wflag) {	/* Write back dirty window if needed */
+#if _FS_WINCACHE
+			if (wc_slot(fs, wsect, &slot) != FR_OK)	/* Write back into the cache */
+				return FR_DISK_ERR;
+			mem_cpy(fs->wc_buf[slot], fs->win, SS(fs));
+			fs->wc_sect[slot] = wsect;
+			fs->wc_dirty[slot] = 1;
+			wc_touch(fs, slot);
+			fs->wflag = 0;
+#else
 			if (disk_write(fs->drive, fs->win, wsect, 1) != RES_OK)
 				return FR_DISK_ERR;
 			fs->wflag = 0;
@@ -262,11 +395,28 @@ FRESULT move_window (
 					disk_write(fs->drive, fs->win, wsect, 1);
 				}
 			}
+#endif
 		}
 #endif
 		if (sector) {
+#if _FS_WINCACHE
+			if (wc_slot(fs, sector, &slot) != FR_OK)
+				return FR_DISK_ERR;
+			if (fs->wc_sect[slot] == sector) {	/* Cache hit */
+				fs->wc_hit++;
+			} else {							/* Cache miss, load the slot */
+				fs->wc_miss++;
+				if (disk_read(fs->drive, fs->wc_buf[slot], sector, 1) != RES_OK)
+					return FR_DISK_ERR;
+				fs->wc_sect[slot] = sector;
+				fs->wc_dirty[slot] = 0;
+			}
+			mem_cpy(fs->win, fs->wc_buf[slot], SS(fs));
+			wc_touch(fs, slot);
+#else
 			if (disk_read(fs->drive, fs->win, sector, 1) != RES_OK)
 				return FR_DISK_ERR;
+#endif
 			fs->winsect = sector;
 		}
 	}
@@ -290,6 +440,10 @@ FRESULT sync (	/* FR_OK: successful, FR_DISK_ERR: failed */
 
 
 	res = move_window(fs, 0);
+#if _FS_WINCACHE
+	if (res == FR_OK)
+		res = wc_clean(fs, 0, 0xFFFFFFFF);	/* Write back dirty sectors in the cache */
+#endif
 	if (res == FR_OK) {
 		/* Update FSInfo sector if needed */
 		if (fs->fs_type == FS_FAT32 && fs->fsi_flag) {
@@ -537,6 +691,38 @@ DWORD clust2sect (	/* !=0: Sector number, 0: Failed - invalid cluster# */
 
 
 
+#if _USE_FASTSEEK
+/*-----------------------------------------------------------------------*/
+/* Fast seek - Get cluster# from the cluster link map table              */
+/*-----------------------------------------------------------------------*/
+
+static
+DWORD clmt_clust (	/* 0:Out of the map, Else:Cluster# */
+	FIL *fp,		/* Pointer to the file object with a valid link map table */
+	DWORD ofs		/* File offset to be converted */
+)
+{
+	DWORD cl, *tbl = fp->cltbl + 1;
+	UINT lo, hi, mid, runs;
+
+
+	cl = ofs / SS(fp->fs) / fp->fs->csize;		/* Cluster index in the file */
+	runs = (UINT)((fp->cltbl[0] - 3) / 2);		/* Number of fragments in the table */
+	if (!runs || cl >= tbl[runs * 2]) return 0;	/* Out of the file */
+
+	lo = 0; hi = runs - 1;
+	while (lo < hi) {						/* Find the last fragment starting at or before cl */
+		mid = (lo + hi + 1) / 2;
+		if (tbl[mid * 2] <= cl) lo = mid;
+		else hi = mid - 1;
+	}
+	return tbl[lo * 2 + 1] + (cl - tbl[lo * 2]);
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Seek directory index                             */
 /*-----------------------------------------------------------------------*/
@@ -1578,6 +1764,10 @@ FRESULT chk_mounted (	/* FR_OK(0): successful, !=0: any error occured */
 #endif
 	fs->fs_type = fmt;		/* FAT sub-type */
 	fs->winsect = 0;		/* Invalidate sector cache */
+#if _FS_WINCACHE
+	wc_invalidate(fs, 0, 0xFFFFFFFF);
+	fs->wc_hit = fs->wc_miss = 0;
+#endif
 #if _FS_RPATH
 	fs->cdir = 0;			/* Current directory (root dir) */
 #endif
@@ -1748,6 +1938,12 @@ FRESULT f_open (
 	fp->fsize = LD_DWORD(dir+DIR_FileSize);	/* File size */
 	fp->fptr = 0; fp->csect = 255;		/* File pointer */
 	fp->dsect = 0;
+#if _USE_FASTSEEK
+	fp->cltbl = 0;						/* Normal seek mode */
+#endif
+#if _USE_STREAM && !_FS_READONLY
+	fp->strm_top = fp->strm_end = fp->strm_sect = 0;	/* No streaming */
+#endif
 	fp->fs = dj.fs; fp->id = dj.fs->id;	/* Owner file system object of the file */
 
 	LEAVE_FF(dj.fs, FR_OK);
@@ -1788,8 +1984,16 @@ FRESULT f_read (
 		rbuff += rcnt, fp->fptr += rcnt, *br += rcnt, btr -= rcnt) {
 		if ((fp->fptr % SS(fp->fs)) == 0) {			/* On the sector boundary? */
 			if (fp->csect >= fp->fs->csize) {		/* On the cluster boundary? */
-				clst = (fp->fptr == 0) ?			/* On the top of the file? */
-					fp->org_clust : get_fat(fp->fs, fp->curr_clust);
+				if (fp->fptr == 0) {				/* On the top of the file? */
+					clst = fp->org_clust;
+				} else {
+#if _USE_FASTSEEK
+					if (fp->cltbl)
+						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the link map table */
+					else
+#endif
+						clst = get_fat(fp->fs, fp->curr_clust);	/* Follow cluster chain on the FAT */
+				}
 				if (clst <= 1) ABORT(fp->fs, FR_INT_ERR);
 				if (clst == 0xFFFFFFFF) ABORT(fp->fs, FR_DISK_ERR);
 				fp->curr_clust = clst;				/* Update current cluster */
@@ -1802,6 +2006,10 @@ FRESULT f_read (
 			if (cc) {								/* Read maximum contiguous sectors directly */
 				if (fp->csect + cc > fp->fs->csize)	/* Clip at cluster boundary */
 					cc = fp->fs->csize - fp->csect;
+#if _FS_WINCACHE && !_FS_READONLY
+				if (wc_clean(fp->fs, sect, cc) != FR_OK)	/* Write back cached sectors prior to direct transfer */
+					ABORT(fp->fs, FR_DISK_ERR);
+#endif
 				if (disk_read(fp->fs->drive, rbuff, sect, (BYTE)cc) != RES_OK)
 					ABORT(fp->fs, FR_DISK_ERR);
 #if !_FS_READONLY && _FS_MINIMIZE <= 2
@@ -1887,7 +2095,12 @@ FRESULT f_write (
 					if (clst == 0)					/* When there is no cluster chain, */
 						fp->org_clust = clst = create_chain(fp->fs, 0);	/* Create a new cluster chain */
 				} else {							/* Middle or end of the file */
-					clst = create_chain(fp->fs, fp->curr_clust);			/* Follow or streach cluster chain */
+#if _USE_FASTSEEK
+					if (fp->cltbl)
+						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the link map table (no stretch) */
+					else
+#endif
+						clst = create_chain(fp->fs, fp->curr_clust);	/* Follow or streach cluster chain */
 				}
 				if (clst == 0) break;				/* Could not allocate a new cluster (disk full) */
 				if (clst == 1) ABORT(fp->fs, FR_INT_ERR);
@@ -1914,6 +2127,9 @@ FRESULT f_write (
 					cc = fp->fs->csize - fp->csect;
 				if (disk_write(fp->fs->drive, wbuff, sect, (BYTE)cc) != RES_OK)
 					ABORT(fp->fs, FR_DISK_ERR);
+#if _FS_WINCACHE
+				wc_invalidate(fp->fs, sect, cc);	/* Discard cached sectors overwritten by the direct write */
+#endif
 #if _FS_TINY
 				if (fp->fs->winsect - sect < cc) {	/* Refill sector cache if it gets dirty by the direct write */
 					mem_cpy(fp->fs->win, wbuff + ((fp->fs->winsect - sect) * SS(fp->fs)), SS(fp->fs));
@@ -2009,6 +2225,245 @@ FRESULT f_sync (
 	LEAVE_FF(fp->fs, res);
 }
 
+
+
+
+#if _USE_STREAM
+/*-----------------------------------------------------------------------*/
+/* Streaming Append - Reserve contiguous clusters                        */
+/*-----------------------------------------------------------------------*/
+/* The file pointer must be at the end of the file on a sector boundary. */
+/* Clusters beyond the current one are released and a free run of       */
+/* clusters that covers size bytes is linked to the file, right after    */
+/* the current cluster when possible. The FAT is written at f_sync.      */
+
+FRESULT f_stream_begin (
+	FIL *fp,		/* Pointer to the file object */
+	DWORD size		/* Number of bytes going to be appended */
+)
+{
+	FRESULT res;
+	DWORD bcs, ncl, tail, top, cl, stat, run, n;
+
+
+	res = validate(fp->fs, fp->id);				/* Check validity of the object */
+	if (res != FR_OK) LEAVE_FF(fp->fs, res);
+	if (fp->flag & FA__ERROR)					/* Check abort flag */
+		LEAVE_FF(fp->fs, FR_INT_ERR);
+	if (!(fp->flag & FA_WRITE))					/* Check access mode */
+		LEAVE_FF(fp->fs, FR_DENIED);
+	if (fp->fptr != fp->fsize || fp->fptr % SS(fp->fs))	/* Must append on a sector boundary */
+		LEAVE_FF(fp->fs, FR_DENIED);
+
+	/* Cut the chain after the current cluster */
+	bcs = (DWORD)fp->fs->csize * SS(fp->fs);
+	tail = (fp->fptr == 0) ? 0 : fp->curr_clust;
+	if (tail) {
+		stat = get_fat(fp->fs, tail);
+		if (stat == 0xFFFFFFFF) ABORT(fp->fs, FR_DISK_ERR);
+		if (stat < 2) ABORT(fp->fs, FR_INT_ERR);
+		if (stat < fp->fs->max_clust) {
+			res = put_fat(fp->fs, tail, 0x0FFFFFFF);
+			if (res == FR_OK) res = remove_chain(fp->fs, stat);
+			if (res != FR_OK) ABORT(fp->fs, res);
+		}
+	} else if (fp->org_clust) {
+		res = remove_chain(fp->fs, fp->org_clust);
+		if (res != FR_OK) ABORT(fp->fs, res);
+		fp->org_clust = 0;
+	}
+
+	/* Number of clusters to reserve beyond the free part of the current cluster */
+	n = (tail && (fp->fptr % bcs)) ? bcs - fp->fptr % bcs : 0;
+	ncl = (size > n) ? (size - n + bcs - 1) / bcs : 0;
+	fp->strm_top = fp->strm_end = fp->strm_sect = 0;
+	if (!ncl) LEAVE_FF(fp->fs, FR_OK);
+
+	/* Find a run of ncl free clusters */
+	cl = tail ? tail + 1 : fp->fs->last_clust + 1;	/* Prefer the place next to the file */
+	if (cl < 2 || cl >= fp->fs->max_clust) cl = 2;
+	top = run = 0;
+	for (n = fp->fs->max_clust - 2; n && run < ncl; n--) {
+		stat = get_fat(fp->fs, cl);
+		if (stat == 0xFFFFFFFF) ABORT(fp->fs, FR_DISK_ERR);
+		if (stat == 1) ABORT(fp->fs, FR_INT_ERR);
+		if (stat == 0) {
+			if (!run) top = cl;
+			run++;
+		} else {
+			run = 0;
+		}
+		if (run < ncl && ++cl >= fp->fs->max_clust) {	/* Wrap around, a run cannot span it */
+			cl = 2; run = 0;
+		}
+	}
+	if (run < ncl) LEAVE_FF(fp->fs, FR_DENIED);	/* No contiguous space */
+
+	/* Link the run and append it to the file */
+	for (cl = top; cl < top + ncl; cl++) {
+		res = put_fat(fp->fs, cl, (cl + 1 < top + ncl) ? cl + 1 : 0x0FFFFFFF);
+		if (res != FR_OK) ABORT(fp->fs, res);
+	}
+	if (tail) {
+		res = put_fat(fp->fs, tail, top);
+		if (res != FR_OK) ABORT(fp->fs, res);
+	} else {
+		fp->org_clust = top;
+	}
+	fp->fs->last_clust = top + ncl - 1;
+	if (fp->fs->free_clust != 0xFFFFFFFF) {		/* Update FSInfo */
+		fp->fs->free_clust -= ncl;
+		fp->fs->fsi_flag = 1;
+	}
+	fp->strm_top = top;
+	fp->strm_end = top + ncl;
+	fp->flag |= FA__WRITTEN;
+
+	LEAVE_FF(fp->fs, FR_OK);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Streaming Append - Write a sector                                     */
+/*-----------------------------------------------------------------------*/
+/* Appends one sector of data to the reserved space. Sectors in a row    */
+/* go to the card in a single multiple block write session; the session  */
+/* is restarted when other disk access (e.g. f_sync) has closed it.      */
+
+FRESULT f_stream_write (
+	FIL *fp,			/* Pointer to the file object */
+	const void *buff	/* Pointer to the sector data (SS bytes) */
+)
+{
+	FRESULT res;
+	DRESULT dres;
+	DWORD clst, sect;
+
+
+	res = validate(fp->fs, fp->id);				/* Check validity of the object */
+	if (res != FR_OK) LEAVE_FF(fp->fs, res);
+	if (fp->flag & FA__ERROR)					/* Check abort flag */
+		LEAVE_FF(fp->fs, FR_INT_ERR);
+	if (!(fp->flag & FA_WRITE))					/* Check access mode */
+		LEAVE_FF(fp->fs, FR_DENIED);
+	if (fp->fptr != fp->fsize || fp->fptr % SS(fp->fs))	/* Must append on a sector boundary */
+		LEAVE_FF(fp->fs, FR_DENIED);
+
+	if (fp->csect >= fp->fs->csize) {			/* On the cluster boundary? */
+		if (fp->fptr == 0)
+			clst = fp->org_clust;
+		else if (fp->curr_clust >= fp->strm_top && fp->curr_clust < fp->strm_end)
+			clst = fp->curr_clust + 1;			/* Next one in the reserved run */
+		else
+			clst = fp->strm_top;				/* Top of the reserved run */
+		if (!fp->strm_top || clst < fp->strm_top || clst >= fp->strm_end)
+			LEAVE_FF(fp->fs, FR_DENIED);		/* Reserved space is used up */
+		fp->curr_clust = clst;
+		fp->csect = 0;
+	}
+	sect = clust2sect(fp->fs, fp->curr_clust);
+	if (!sect) ABORT(fp->fs, FR_INT_ERR);
+	sect += fp->csect;
+
+	dres = RES_NOTRDY;
+	if (sect == fp->strm_sect)					/* Continue the open session */
+		dres = disk_stream_write(fp->fs->drive, buff);
+	if (dres == RES_NOTRDY) {					/* Start a session for the rest of the reservation */
+		/* Pre-erase only sectors that are going to be written in this session: the rest of
+		   the run, or the rest of the old tail cluster plus the run if it follows directly.
+		   Blocks pre-erased but not written are undefined after the stop. */
+		if (fp->curr_clust >= fp->strm_top && fp->curr_clust < fp->strm_end)
+			clst = fp->strm_end - fp->curr_clust;
+		else if (fp->curr_clust + 1 == fp->strm_top)
+			clst = fp->strm_end - fp->strm_top + 1;
+		else
+			clst = 1;
+		if (disk_stream_begin(fp->fs->drive, sect, clst * fp->fs->csize - fp->csect) != RES_OK)
+			ABORT(fp->fs, FR_DISK_ERR);
+		dres = disk_stream_write(fp->fs->drive, buff);
+	}
+	if (dres != RES_OK) {
+		fp->strm_sect = 0;
+		ABORT(fp->fs, FR_DISK_ERR);
+	}
+	fp->strm_sect = sect + 1;
+
+	/* Keep the sector buffers coherent with the written sector */
+#if _FS_TINY
+	if (fp->fs->winsect == sect) {
+		mem_cpy(fp->fs->win, buff, SS(fp->fs));
+		fp->fs->wflag = 0;
+	}
+#else
+	mem_cpy(fp->buf, buff, SS(fp->fs));
+	fp->flag &= ~FA__DIRTY;
+#endif
+#if _FS_WINCACHE
+	wc_invalidate(fp->fs, sect, 1);
+#endif
+	fp->dsect = sect;
+	fp->csect++;
+	fp->fptr += SS(fp->fs);
+	fp->fsize = fp->fptr;
+	fp->flag |= FA__WRITTEN;
+
+	LEAVE_FF(fp->fs, FR_OK);
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Streaming Append - Close the session and release unused space         */
+/*-----------------------------------------------------------------------*/
+/* Call f_sync or f_close afterwards to write the FAT and the size.      */
+
+FRESULT f_stream_end (
+	FIL *fp		/* Pointer to the file object */
+)
+{
+	FRESULT res;
+	DWORD last, next;
+
+
+	res = validate(fp->fs, fp->id);				/* Check validity of the object */
+	if (res != FR_OK) LEAVE_FF(fp->fs, res);
+	if (fp->flag & FA__ERROR)					/* Check abort flag */
+		LEAVE_FF(fp->fs, FR_INT_ERR);
+
+	if (fp->strm_sect) {
+		fp->strm_sect = 0;
+		if (disk_stream_end(fp->fs->drive) != RES_OK)
+			ABORT(fp->fs, FR_DISK_ERR);
+	}
+	if (fp->strm_top) {
+		if (fp->fptr == 0) {					/* Nothing written, release the whole chain */
+			next = fp->org_clust;
+			fp->org_clust = 0;
+		} else {
+			last = fp->curr_clust;				/* Cluster holding the last written sector */
+			next = (last >= fp->strm_top && last < fp->strm_end) ? last + 1 : fp->strm_top;
+			if (next < fp->strm_end) {
+				res = put_fat(fp->fs, last, 0x0FFFFFFF);
+				if (res != FR_OK) ABORT(fp->fs, res);
+			} else {
+				next = 0;
+			}
+		}
+		if (next) {
+			res = remove_chain(fp->fs, next);
+			if (res != FR_OK) ABORT(fp->fs, res);
+		}
+		fp->strm_top = fp->strm_end = 0;
+		fp->flag |= FA__WRITTEN;
+	}
+
+	LEAVE_FF(fp->fs, FR_OK);
+}
+#endif /* _USE_STREAM */
+
 #endif /* !_FS_READONLY */
 
 
@@ -2106,12 +2561,47 @@ FRESULT f_lseek (
 {
 	FRESULT res;
 	DWORD clst, bcs, nsect, ifptr;
+#if _USE_FASTSEEK
+	DWORD *tbl, tlen, ulen, fcl, scl, pcl;
+#endif
 
 
 	res = validate(fp->fs, fp->id);		/* Check validity of the object */
 	if (res != FR_OK) LEAVE_FF(fp->fs, res);
 	if (fp->flag & FA__ERROR)			/* Check abort flag */
 		LEAVE_FF(fp->fs, FR_INT_ERR);
+#if _USE_FASTSEEK
+	if (fp->cltbl && ofs == CREATE_LINKMAP) {	/* Create the cluster link map table */
+		tbl = fp->cltbl;
+		tlen = *tbl++; ulen = 3;			/* Given table size and required table size */
+		fcl = 0;							/* Cluster index in the file */
+		clst = fp->org_clust;
+		if (clst) {
+			do {
+				scl = clst;					/* Get a fragment: top cluster and length */
+				do {
+					pcl = clst;
+					clst = get_fat(fp->fs, clst);
+					if (clst <= 1) ABORT(fp->fs, FR_INT_ERR);
+					if (clst == 0xFFFFFFFF) ABORT(fp->fs, FR_DISK_ERR);
+				} while (clst == pcl + 1);
+				ulen += 2;
+				if (ulen <= tlen) {			/* Store the fragment if the table has room */
+					*tbl++ = fcl; *tbl++ = scl;
+				}
+				fcl += pcl - scl + 1;
+			} while (clst < fp->fs->max_clust);	/* Repeat until end of the chain */
+		}
+		fp->cltbl[0] = ulen;				/* Number of items used or required */
+		if (ulen <= tlen) {
+			*tbl++ = fcl; *tbl = 0;			/* Terminate the table */
+		} else {
+			fp->cltbl = 0;					/* Table too small, back to normal seek mode */
+			res = FR_NOT_ENOUGH_CORE;
+		}
+		LEAVE_FF(fp->fs, res);
+	}
+#endif
 	if (ofs > fp->fsize					/* In read-only mode, clip offset with the file size */
 #if !_FS_READONLY
 		 && !(fp->flag & FA_WRITE)
@@ -2120,6 +2610,25 @@ FRESULT f_lseek (
 
 	ifptr = fp->fptr;
 	fp->fptr = nsect = 0; fp->csect = 255;
+#if _USE_FASTSEEK
+	if (fp->cltbl) {						/* Fast seek, no FAT access */
+		if (ofs > fp->fsize) ofs = fp->fsize;	/* Clip offset, the file cannot be expanded */
+		if (ofs > 0) {
+			bcs = (DWORD)fp->fs->csize * SS(fp->fs);	/* Cluster size (byte) */
+			clst = clmt_clust(fp, ofs - 1);	/* Cluster containing the byte before ofs */
+			if (!clst) ABORT(fp->fs, FR_INT_ERR);
+			fp->curr_clust = clst;
+			fp->fptr = ofs;
+			fp->csect = (BYTE)(((ofs - 1) % bcs + 1) / SS(fp->fs));	/* Sector offset in the cluster */
+			if (ofs % SS(fp->fs)) {
+				nsect = clust2sect(fp->fs, clst);	/* Current sector */
+				if (!nsect) ABORT(fp->fs, FR_INT_ERR);
+				nsect += fp->csect;
+				fp->csect++;
+			}
+		}
+	} else
+#endif
 	if (ofs > 0) {
 		bcs = (DWORD)fp->fs->csize * SS(fp->fs);	/* Cluster size (byte) */
 		if (ifptr > 0 &&
@@ -2740,8 +3249,16 @@ FRESULT f_forward (
 		fp->fptr += rcnt, *bf += rcnt, btr -= rcnt) {
 		if ((fp->fptr % SS(fp->fs)) == 0) {			/* On the sector boundary? */
 			if (fp->csect >= fp->fs->csize) {		/* On the cluster boundary? */
-				clst = (fp->fptr == 0) ?			/* On the top of the file? */
-					fp->org_clust : get_fat(fp->fs, fp->curr_clust);
+				if (fp->fptr == 0) {				/* On the top of the file? */
+					clst = fp->org_clust;
+				} else {
+#if _USE_FASTSEEK
+					if (fp->cltbl)
+						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the link map table */
+					else
+#endif
+						clst = get_fat(fp->fs, fp->curr_clust);	/* Follow cluster chain on the FAT */
+				}
 				if (clst <= 1) ABORT(fp->fs, FR_INT_ERR);
 				if (clst == 0xFFFFFFFF) ABORT(fp->fs, FR_DISK_ERR);
 				fp->curr_clust = clst;				/* Update current cluster */
@@ -8,6 +8,7 @@
 
 #include "lpc17xx_ssp.h"
 #include "lpc17xx_gpio.h"
+#include "lpc17xx_clkpwr.h"
 #include "diskio.h"
 
 
@@ -36,10 +37,26 @@
 #define CS_LOW()    GPIO_ClearValue( 2, 1<<2 )
 #define CS_HIGH()   GPIO_SetValue(2, 1<<2)
 
+/* Card detect switch of the socket on P2.11 (high: socket empty). The demo
+   drives P2.10/P2.11 as motor direction outputs, so the switch is not used
+   there and the socket is taken as occupied; a missing card then fails in
+   disk_initialize. */
+#ifndef SOCK_CD_USED
+#define SOCK_CD_USED	0
+#endif
 
 
-#define	FCLK_SLOW()					/* Set slow clock (100k-400k) */
-#define	FCLK_FAST()					/* Set fast clock (depends on the CSD) */
+
+/* SSP1 is shared with the OLED and the DataFlash, so the card clock is only
+   applied while the card is selected and the previous setting is restored
+   on deselect */
+#define SSP_FIFO_DEPTH		8
+#define SCLK_SLOW			400000UL	/* Identification mode clock */
+#define SCLK_FAST_MAX		25000000UL	/* Max clock of SD/MMC in SPI mode */
+
+#define	FCLK_SLOW()			set_clock(SCLK_SLOW)	/* Set slow clock (100k-400k) */
+#define	FCLK_FAST(csd)		set_clock(csd_clock(csd))	/* Set fast clock (depends on the CSD) */
+
 
 
 /*--------------------------------------------------------------------------
@@ -57,61 +74,144 @@ BYTE Timer1, Timer2;	/* 100Hz decrement timer */
 static
 BYTE CardType;			/* Card type flags */
 
-static void SSPSend(uint8_t *buf, uint32_t Length)
+static
+DWORD CardClock = SCLK_SLOW;	/* SCK rate used while the card is selected */
+
+static
+BYTE BusClaimed;		/* SSP1 clock is switched to CardClock */
+
+static
+uint32_t SavedCR0, SavedCPSR;	/* SSP1 clock setting of the other bus users */
+
+#if _READONLY == 0
+static
+BYTE Streaming;			/* A CMD25 session of disk_stream_begin() is open */
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/* Switch SSP1 to the card clock and back  (Platform dependent)          */
+/*-----------------------------------------------------------------------*/
+
+static
+void claim_bus (void)
 {
-    SSP_DATA_SETUP_Type xferConfig;
+	if (!BusClaimed) {
+		while (LPC_SSP1->DMACR) ;	/* GPDMA read of the DataFlash in progress */
+		SavedCR0 = LPC_SSP1->CR0;
+		SavedCPSR = LPC_SSP1->CPSR;
+		SSP_SetClock(LPC_SSP1, CardClock);
+		BusClaimed = 1;
+	}
+}
 
-	xferConfig.tx_data = buf;
-	xferConfig.rx_data = NULL;
-	xferConfig.length  = Length;
+static
+void release_bus (void)
+{
+	if (BusClaimed) {
+		while (LPC_SSP1->SR & SSP_SR_BSY) ;
+		LPC_SSP1->CPSR = SavedCPSR;
+		LPC_SSP1->CR0 = SavedCR0;
+		BusClaimed = 0;
+	}
+}
 
-    SSP_ReadWrite(LPC_SSP1, &xferConfig, SSP_TRANSFER_POLLING);
+static
+void set_clock (DWORD clk)
+{
+	CardClock = clk;
+	if (BusClaimed) SSP_SetClock(LPC_SSP1, CardClock);
 }
 
-void SSPReceive( uint8_t *buf, uint32_t Length )
+
+/*-----------------------------------------------------------------------*/
+/* Get max transfer rate from the TRAN_SPEED field of the CSD            */
+/*-----------------------------------------------------------------------*/
+
+static
+DWORD csd_clock (
+	const BYTE *csd		/* CSD register, NULL if it could not be read */
+)
 {
-    SSP_DATA_SETUP_Type xferConfig;
+	static const DWORD unit[4] = { 10000UL, 100000UL, 1000000UL, 10000000UL };
+	static const BYTE mul[16] = { 0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80 };
+	BYTE ts;
+	DWORD clk;
+
 
-	xferConfig.tx_data = NULL;
-	xferConfig.rx_data = buf;
-	xferConfig.length  = Length;
+	if (!csd) return SCLK_SLOW;
+	ts = csd[3];
+	if ((ts & 7) > 3) return SCLK_FAST_MAX;		/* Reserved units, faster than SPI mode anyway */
+	clk = unit[ts & 7] * mul[(ts >> 3) & 15];	/* unit is 1/10 of the rate unit */
+	if (!clk) return SCLK_SLOW;					/* Reserved value */
 
-    SSP_ReadWrite(LPC_SSP1, &xferConfig, SSP_TRANSFER_POLLING);
+	return (clk > SCLK_FAST_MAX) ? SCLK_FAST_MAX : clk;
 }
 
 
 /*-----------------------------------------------------------------------*/
-/* Transmit a byte to MMC via SPI  (Platform dependent)                  */
+/* Exchange a byte with MMC via SPI  (Platform dependent)                */
 /*-----------------------------------------------------------------------*/
 
-//#define xmit_spi(dat) (SSPSend((uint8_t*)&(dat), 1))
-static void xmit_spi(BYTE dat)
+static
+BYTE xchg_spi (BYTE dat)
 {
-    SSPSend((uint8_t*) &dat, 1);
+	LPC_SSP1->DR = dat;
+	while (!(LPC_SSP1->SR & SSP_SR_RNE)) ;
+	return (BYTE)LPC_SSP1->DR;
 }
 
+#define xmit_spi(dat)	((void)xchg_spi(dat))
+#define rcvr_spi()		xchg_spi(0xFF)
+
 
 /*-----------------------------------------------------------------------*/
-/* Receive a byte from MMC via SPI  (Platform dependent)                 */
+/* Receive/transmit a data block via SPI  (Platform dependent)           */
 /*-----------------------------------------------------------------------*/
+/* Up to SSP_FIFO_DEPTH frames are kept in flight, so SCK does not stop  */
+/* between bytes. RX FIFO is empty on entry as xchg_spi() drains it.     */
 
-static
-BYTE rcvr_spi (void)
+static __RAMFUNC
+void rcvr_spi_multi (
+	BYTE *buff,			/* Data buffer to store received data */
+	UINT btr			/* Byte count */
+)
 {
-    BYTE data = 0;
+	UINT tx = 0, rx = 0;
 
-    SSPReceive(&data, 1);
 
-    return data;
+	while (rx < btr) {
+		if ((tx < btr) && ((tx - rx) < SSP_FIFO_DEPTH) && (LPC_SSP1->SR & SSP_SR_TNF)) {
+			LPC_SSP1->DR = 0xFF;
+			tx++;
+		}
+		if (LPC_SSP1->SR & SSP_SR_RNE) {
+			buff[rx++] = (BYTE)LPC_SSP1->DR;
+		}
+	}
 }
 
-/* Alternative macro to receive data fast */
+#if _READONLY == 0
+static __RAMFUNC
+void xmit_spi_multi (
+	const BYTE *buff,	/* Data to be transmitted */
+	UINT btx			/* Byte count */
+)
+{
+	UINT tx = 0, rx = 0;
 
-#define rcvr_spi_m(dst) \
-    do { \
-        SSPReceive((uint8_t*)(dst), 1); \
-    } while(0)
 
+	while (rx < btx) {
+		if ((tx < btx) && ((tx - rx) < SSP_FIFO_DEPTH) && (LPC_SSP1->SR & SSP_SR_TNF)) {
+			LPC_SSP1->DR = buff[tx++];
+		}
+		if (LPC_SSP1->SR & SSP_SR_RNE) {
+			(void)LPC_SSP1->DR;		/* Discard received byte */
+			rx++;
+		}
+	}
+}
+#endif /* _READONLY */
 
 
 
@@ -145,6 +245,7 @@ void deselect (void)
 {
 	CS_HIGH();
 	rcvr_spi();
+	release_bus();
 }
 
 
@@ -156,6 +257,7 @@ void deselect (void)
 static
 BOOL select (void)	/* TRUE:Successful, FALSE:Timeout */
 {
+	claim_bus();
 	CS_LOW();
 	if (wait_ready() != 0xFF) {
 		deselect();
@@ -209,12 +311,7 @@ BOOL rcvr_datablock (
 	} while ((token == 0xFF) && Timer1);
 	if(token != 0xFE) return FALSE;	/* If not valid data token, retutn with error */
 
-	do {							/* Receive the data block into buffer */
-		rcvr_spi_m(buff++);
-		rcvr_spi_m(buff++);
-		rcvr_spi_m(buff++);
-		rcvr_spi_m(buff++);
-	} while (btr -= 4);
+	rcvr_spi_multi(buff, btr);		/* Receive the data block into buffer */
 	rcvr_spi();						/* Discard CRC */
 	rcvr_spi();
 
@@ -234,18 +331,14 @@ BOOL xmit_datablock (
 	BYTE token			/* Data/Stop token */
 )
 {
-	BYTE resp, wc;
+	BYTE resp;
 
 
 	if (wait_ready() != 0xFF) return FALSE;
 
 	xmit_spi(token);					/* Xmit data token */
 	if (token != 0xFD) {	/* Is data token */
-		wc = 0;
-		do {							/* Xmit the 512 byte data block to MMC */
-			xmit_spi(*buff++);
-			xmit_spi(*buff++);
-		} while (--wc);
+		xmit_spi_multi(buff, 512);		/* Xmit the 512 byte data block to MMC */
 		xmit_spi(0xFF);					/* CRC (Dummy) */
 		xmit_spi(0xFF);
 		resp = rcvr_spi();				/* Reveive data response */
@@ -305,6 +398,32 @@ BYTE send_cmd (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Terminate an open streaming session                                   */
+/*-----------------------------------------------------------------------*/
+/* Any other access to the card closes the session first, so the stream  */
+/* layer sees RES_NOTRDY on its next block and opens a new one.          */
+
+#if _READONLY == 0
+static
+BOOL stream_stop (void)	/* TRUE:Successful or no session, FALSE:Error */
+{
+	BOOL ok = TRUE;
+
+
+	if (Streaming) {
+		Streaming = 0;
+		ok = select() && xmit_datablock(0, 0xFD);	/* STOP_TRAN token */
+		deselect();
+	}
+	return ok;
+}
+#else
+#define stream_stop()	TRUE
+#endif
+
+
+
 /*--------------------------------------------------------------------------
 
    Public Functions
@@ -320,16 +439,22 @@ DSTATUS disk_initialize (
 	BYTE drv		/* Physical drive nmuber (0) */
 )
 {
-	BYTE n, cmd, ty, ocr[4];
+	BYTE n, cmd, ty, ocr[4], csd[16];
 
 	GPIO_SetDir(2, 1<<2, 1);  /* CS */
+#if SOCK_CD_USED
 	GPIO_SetDir(2, 1<<11, 0); /* Card Detect */
+#endif
 
 	if (drv) return STA_NOINIT;			/* Supports only single drive */
 	if (Stat & STA_NODISK) return Stat;	/* No card in the socket */
 
+#if _READONLY == 0
+	Streaming = 0;						/* A session does not survive re-initialization */
+#endif
 	power_on();							/* Force socket power on */
 	FCLK_SLOW();
+	claim_bus();
 	for (n = 10; n; n--) rcvr_spi();	/* 80 dummy clocks */
 
 	ty = 0;
@@ -356,11 +481,13 @@ DSTATUS disk_initialize (
 		}
 	}
 	CardType = ty;
+	if (ty && !((send_cmd(CMD9, 0) == 0) && rcvr_datablock(csd, 16)))	/* Read CSD for TRAN_SPEED */
+		csd[3] = 0;						/* Stay at slow clock if CSD is not readable */
 	deselect();
 
 	if (ty) {			/* Initialization succeded */
 		Stat &= ~STA_NOINIT;		/* Clear STA_NOINIT */
-		FCLK_FAST();
+		FCLK_FAST(csd);
 	} else {			/* Initialization failed */
 		power_off();
 	}
@@ -397,6 +524,7 @@ DRESULT disk_read (
 {
 	if (drv || !count) return RES_PARERR;
 	if (Stat & STA_NOINIT) return RES_NOTRDY;
+	if (!stream_stop()) return RES_ERROR;
 
 	if (!(CardType & CT_BLOCK)) sector *= 512;	/* Convert to byte address if needed */
 
@@ -436,6 +564,7 @@ DRESULT disk_write (
 	if (drv || !count) return RES_PARERR;
 	if (Stat & STA_NOINIT) return RES_NOTRDY;
 	if (Stat & STA_PROTECT) return RES_WRPRT;
+	if (!stream_stop()) return RES_ERROR;
 
 	if (!(CardType & CT_BLOCK)) sector *= 512;	/* Convert to byte address if needed */
 
@@ -459,6 +588,68 @@ DRESULT disk_write (
 
 	return count ? RES_ERROR : RES_OK;
 }
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Streaming Write                                                       */
+/*-----------------------------------------------------------------------*/
+/* disk_stream_begin() opens one CMD25 session with the pre-erase count  */
+/* of the sectors that are going to follow, disk_stream_write() sends    */
+/* one 512 byte block to it and disk_stream_end() sends STOP_TRAN. The   */
+/* card is deselected between the blocks (allowed while it is busy) so   */
+/* the OLED and the DataFlash can use SSP1 in the meantime.              */
+
+DRESULT disk_stream_begin (
+	BYTE drv,			/* Physical drive nmuber (0) */
+	DWORD sector,		/* Start sector number (LBA) */
+	DWORD count			/* Number of sectors expected (pre-erase), 0:Unknown */
+)
+{
+	if (drv) return RES_PARERR;
+	if (Stat & STA_NOINIT) return RES_NOTRDY;
+	if (Stat & STA_PROTECT) return RES_WRPRT;
+	if (!stream_stop()) return RES_ERROR;
+
+	if (!(CardType & CT_BLOCK)) sector *= 512;	/* Convert to byte address if needed */
+
+	if ((CardType & CT_SDC) && count)
+		send_cmd(ACMD23, (count > 0x7FFFFF) ? 0x7FFFFF : count);	/* SET_WR_BLK_ERASE_COUNT */
+	if (send_cmd(CMD25, sector) == 0)	/* WRITE_MULTIPLE_BLOCK */
+		Streaming = 1;
+	deselect();
+
+	return Streaming ? RES_OK : RES_ERROR;
+}
+
+
+DRESULT disk_stream_write (
+	BYTE drv,			/* Physical drive nmuber (0) */
+	const BYTE *buff	/* 512 byte block to be written */
+)
+{
+	BOOL ok;
+
+
+	if (drv) return RES_PARERR;
+	if (!Streaming) return RES_NOTRDY;	/* No session or it has been closed by other access */
+
+	ok = select() && xmit_datablock(buff, 0xFC);
+	deselect();
+	if (!ok) stream_stop();				/* Close the session on error */
+
+	return ok ? RES_OK : RES_ERROR;
+}
+
+
+DRESULT disk_stream_end (
+	BYTE drv			/* Physical drive nmuber (0) */
+)
+{
+	if (drv) return RES_PARERR;
+
+	return stream_stop() ? RES_OK : RES_ERROR;
+}
 #endif /* _READONLY == 0 */
 
 
@@ -504,6 +695,7 @@ DRESULT disk_ioctl (
 	}
 	else {
 		if (Stat & STA_NOINIT) return RES_NOTRDY;
+		if (!stream_stop()) return RES_ERROR;
 
 		switch (ctrl) {
 		case CTRL_SYNC :		/* Make sure that no pending write process. Do not remove this or written sector might not left updated. */
@@ -559,6 +751,13 @@ DRESULT disk_ioctl (
 			res = RES_OK;
 			break;
 
+		case MMC_GET_SCLK :		/* Get SCK rate of data transfers in Hz (DWORD) */
+			claim_bus();		/* The divider actually set for CardClock */
+			*(DWORD*)buff = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_SSP1)
+				/ ((LPC_SSP1->CPSR & SSP_CPSR_BITMASK) * (((LPC_SSP1->CR0 >> 8) & 0xFF) + 1));
+			res = RES_OK;
+			break;
+
 		case MMC_GET_CSD :		/* Receive CSD as a data block (16 bytes) */
 			if (send_cmd(CMD9, 0) == 0		/* READ_CSD */
 				&& rcvr_datablock(ptr, 16))
@@ -605,8 +804,11 @@ DRESULT disk_ioctl (
 
 void disk_timerproc (void)
 {
+#if SOCK_CD_USED
 	static BYTE pv;
-	BYTE n, s;
+	BYTE s;
+#endif
+	BYTE n;
 
 
 	n = Timer1;						/* 100Hz decrement timer */
@@ -614,6 +816,7 @@ void disk_timerproc (void)
 	n = Timer2;
 	if (n) Timer2 = --n;
 
+#if SOCK_CD_USED
 	n = pv;
 	//pv = SOCKPORT & (SOCKWP | SOCKINS);	/* Sample socket switch */
 
@@ -632,5 +835,6 @@ void disk_timerproc (void)
 
 		Stat = s;
 	}
+#endif
 }
 
@@ -7,6 +7,7 @@ C_SRCS += \
 ../src/lpc17xx_adc.c \
 ../src/lpc17xx_can.c \
 ../src/lpc17xx_clkpwr.c \
+../src/lpc17xx_crc.c \
 ../src/lpc17xx_dac.c \
 ../src/lpc17xx_emac.c \
 ../src/lpc17xx_exti.c \
@@ -33,6 +34,7 @@ OBJS += \
 ./src/lpc17xx_adc.o \
 ./src/lpc17xx_can.o \
 ./src/lpc17xx_clkpwr.o \
+./src/lpc17xx_crc.o \
 ./src/lpc17xx_dac.o \
 ./src/lpc17xx_emac.o \
 ./src/lpc17xx_exti.o \
@@ -59,6 +61,7 @@ C_DEPS += \
 ./src/lpc17xx_adc.d \
 ./src/lpc17xx_can.d \
 ./src/lpc17xx_clkpwr.d \
+./src/lpc17xx_crc.d \
 ./src/lpc17xx_dac.d \
 ./src/lpc17xx_emac.d \
 ./src/lpc17xx_exti.d \
@@ -0,0 +1,99 @@
+/**********************************************************************
+* $Id$		lpc17xx_crc.h
+*//**
+* @file		lpc17xx_crc.h
+* @brief	Contains all macro definitions and function prototypes
+* 			support for the software CRC engine on LPC17xx
+* @version	1.0
+*
+***********************************************************************
+* The LPC17xx has no CRC peripheral, this is a table driven software
+* implementation shared by the drivers and the application:
+* - CRC-32 (IEEE 802.3, reflected, polynomial 0x04C11DB7), as used by the
+*   Ethernet FCS and the EMAC hash filter
+* - CRC-16/CCITT (polynomial 0x1021, MSB first), as used by the EEPROM and
+*   flash records, the asset bundle and the remote control protocol
+* - CRC-8 (polynomial 0x07, MSB first), as used by SMBus PEC
+*
+* CRC-32 is computed a byte at a time from a 1 KB table, or four bytes at
+* a time from four such tables (slice-by-4, 4 KB) when the library is
+* built with CRC_SLICE_BY_4. Both give the same results; the tables are
+* constant and stay in flash.
+*
+* Use: crc = CRCxx_Init(); crc = CRCxx_Update(crc, data, len) for each
+* piece; result = CRCxx_Final(crc).
+**********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup CRC CRC (software CRC engine)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * @{
+ */
+
+#ifndef LPC17XX_CRC_H_
+#define LPC17XX_CRC_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc_types.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup CRC_Public_Macros CRC Public Macros
+ * @{
+ */
+
+/** Initial values, returned by the CRCxx_Init functions */
+#define CRC32_INIT			((uint32_t)0xFFFFFFFF)
+#define CRC16_INIT			((uint16_t)0xFFFF)
+#define CRC8_INIT			((uint8_t)0x00)
+
+/** Check values: the final CRC of the ASCII string "123456789" */
+#define CRC32_CHECK			((uint32_t)0xCBF43926)
+#define CRC16_CHECK			((uint16_t)0x29B1)
+#define CRC8_CHECK			((uint8_t)0xF4)
+
+/**
+ * @}
+ */
+
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup CRC_Public_Functions CRC Public Functions
+ * @{
+ */
+
+/* CRC-32 -------------------------*/
+uint32_t CRC32_Init(void);
+uint32_t CRC32_Update(uint32_t crc, const uint8_t *data, uint32_t len);
+uint32_t CRC32_Final(uint32_t crc);
+
+/* CRC-16/CCITT -------------------*/
+uint16_t CRC16_Init(void);
+uint16_t CRC16_Update(uint16_t crc, const uint8_t *data, uint32_t len);
+uint16_t CRC16_Final(uint16_t crc);
+
+/* CRC-8 --------------------------*/
+uint8_t CRC8_Init(void);
+uint8_t CRC8_Update(uint8_t crc, const uint8_t *data, uint32_t len);
+uint8_t CRC8_Final(uint8_t crc);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_CRC_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -673,6 +673,9 @@ void EMAC_SetFilterMode(uint32_t ulFilterMode, FunctionalState NewState);
 /* EMAC Packet Buffer functions */
 void EMAC_WritePacketBuffer(EMAC_PACKETBUF_Type *pDataStruct);
 void EMAC_ReadPacketBuffer(EMAC_PACKETBUF_Type *pDataStruct);
+uint8_t *EMAC_GetRxPacketPtr(void);
+uint8_t *EMAC_GetTxPacketPtr(void);
+void EMAC_SetTxPacketSize(uint32_t ulDataLen);
 
 /* EMAC Interrupt functions -------*/
 void EMAC_IntCmd(uint32_t ulIntType, FunctionalState NewState);
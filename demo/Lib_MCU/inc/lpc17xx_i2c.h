@@ -324,6 +324,21 @@ typedef enum {
 	I2C_TRANSFER_INTERRUPT			/**< Transfer in interrupt mode */
 } I2C_TRANSFER_OPT_Type;
 
+/**
+ * @brief Events passed to the master transfer hook
+ */
+typedef enum {
+	I2C_HOOK_START = 0,				/**< Polling master transfer starts */
+	I2C_HOOK_DONE,					/**< Transfer ended with a STOP, SUCCESS returned */
+	I2C_HOOK_ERROR					/**< Transfer failed, ERROR returned */
+} I2C_HOOK_EVENT_Type;
+
+/**
+ * @brief Master transfer hook, called in the context of I2C_MasterTransferData
+ */
+typedef void (*I2C_TRANSFER_HOOK_Type)(LPC_I2C_TypeDef *I2Cx, \
+		I2C_M_SETUP_Type *TransferCfg, I2C_HOOK_EVENT_Type Event);
+
 
 /**
  * @}
@@ -348,6 +363,7 @@ Status I2C_SlaveTransferData(LPC_I2C_TypeDef *I2Cx, \
 		I2C_S_SETUP_Type *TransferCfg, I2C_TRANSFER_OPT_Type Opt);
 uint32_t I2C_MasterTransferComplete(LPC_I2C_TypeDef *I2Cx);
 uint32_t I2C_SlaveTransferComplete(LPC_I2C_TypeDef *I2Cx);
+void I2C_SetTransferHook(I2C_TRANSFER_HOOK_Type Hook);
 
 
 void I2C_SetOwnSlaveAddr(LPC_I2C_TypeDef *I2Cx, I2C_OWNSLAVEADDR_CFG_Type *OwnSlaveAddrConfigStruct);
@@ -137,6 +137,9 @@ extern "C"
 #define RTC_CTIME0_MINUTES_MASK		((0x3F00))
 #define RTC_CTIME0_HOURS_MASK		((0x1F0000))
 #define RTC_CTIME0_DOW_MASK			((0x7000000))
+#define RTC_CTIME0_MINUTES_POS		(8)
+#define RTC_CTIME0_HOURS_POS		(16)
+#define RTC_CTIME0_DOW_POS			(24)
 
 /**********************************************************************
 * Consolidated Time Register 1 definitions
@@ -144,6 +147,8 @@ extern "C"
 #define RTC_CTIME1_DOM_MASK			((0x1F))
 #define RTC_CTIME1_MONTH_MASK		((0xF00))
 #define RTC_CTIME1_YEAR_MASK		((0xFFF0000))
+#define RTC_CTIME1_MONTH_POS		(8)
+#define RTC_CTIME1_YEAR_POS			(16)
 
 /**********************************************************************
 * Consolidated Time Register 2 definitions
@@ -238,6 +243,18 @@ typedef struct {
 	uint32_t YEAR; 		/*!< Years Register */
 } RTC_TIME_Type;
 
+/** @brief Coherent copy of the consolidated time registers */
+typedef struct {
+	uint16_t YEAR; 		/*!< Years */
+	uint16_t DOY; 		/*!< Day of Year */
+	uint8_t MONTH; 		/*!< Months */
+	uint8_t DOM; 		/*!< Day of Month */
+	uint8_t DOW; 		/*!< Day of Week */
+	uint8_t HOUR; 		/*!< Hours */
+	uint8_t MIN; 		/*!< Minutes */
+	uint8_t SEC; 		/*!< Seconds */
+} RTC_SNAPSHOT_Type;
+
 /** @brief RTC interrupt source */
 typedef enum {
 	RTC_INT_COUNTER_INCREASE = RTC_IRL_RTCCIF, 	/*!<  Counter Increment Interrupt */
@@ -280,6 +297,8 @@ void RTC_SetTime (LPC_RTC_TypeDef *RTCx, uint32_t Timetype, uint32_t TimeValue);
 uint32_t RTC_GetTime(LPC_RTC_TypeDef *RTCx, uint32_t Timetype);
 void RTC_SetFullTime (LPC_RTC_TypeDef *RTCx, RTC_TIME_Type *pFullTime);
 void RTC_GetFullTime (LPC_RTC_TypeDef *RTCx, RTC_TIME_Type *pFullTime);
+void RTC_GetSnapshot (LPC_RTC_TypeDef *RTCx, RTC_SNAPSHOT_Type *pSnapshot);
+void RTC_InvalidateSnapshot (LPC_RTC_TypeDef *RTCx);
 void RTC_SetAlarmTime (LPC_RTC_TypeDef *RTCx, uint32_t Timetype, uint32_t ALValue);
 uint32_t RTC_GetAlarmTime (LPC_RTC_TypeDef *RTCx, uint32_t Timetype);
 void RTC_SetFullAlarmTime (LPC_RTC_TypeDef *RTCx, RTC_TIME_Type *pFullTime);
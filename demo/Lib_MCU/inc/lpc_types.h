@@ -142,6 +142,32 @@ typedef int32_t(*PFI)();
 #define MAX(a, b) (((a) > (b)) ? (a) : (b))
 #define MIN(a, b) (((a) < (b)) ? (a) : (b))
 
+/* Functions executed from SRAM, copied there from flash by the startup code
+ * through the section table of the linker script:
+ * __RAMFUNC      local SRAM (RamLoc32), zero wait states on the I-code bus
+ * __RAMFUNC_AHB  AHB SRAM (RamAHB32), fetched over the system bus shared
+ *                with the DMA
+ * Calls between flash and SRAM go through linker veneers, so mark the
+ * callees of a hot loop as well. Only the Code Red build places them;
+ * RAMFUNC_DISABLE leaves everything in flash, e.g. to measure the gain.
+ */
+#if defined (__CODE_RED) && !defined (RAMFUNC_DISABLE)
+#define __RAMFUNC       __attribute__ ((section(".ramfunc.$RAM"), noinline))
+#define __RAMFUNC_AHB   __attribute__ ((section(".ramfunc.$RAM2"), noinline))
+#else
+#define __RAMFUNC
+#define __RAMFUNC_AHB
+#endif
+
+/* Zero initialized data in AHB SRAM (RamAHB32), the only SRAM the Ethernet
+ * DMA reaches. Only the Code Red build places it, elsewhere it is plain bss.
+ */
+#if defined (__CODE_RED)
+#define __BSS_AHB       __attribute__ ((section(".bss.$RAM2")))
+#else
+#define __BSS_AHB
+#endif
+
 /**
  * @}
  */
@@ -236,6 +236,13 @@ CAN_ERROR CAN_SetupAFLUT(LPC_CANAF_TypeDef* CANAFx, AF_SectionDef* AFSection)
 	CHECK_PARAM(PARAM_CANAFx(CANAFx));
 	CANAFx->AFMR = 0x01;
 
+	/* The table is written from the start, so is counted again */
+	CANAF_FullCAN_cnt = 0;
+	CANAF_std_cnt = 0;
+	CANAF_gstd_cnt = 0;
+	CANAF_ext_cnt = 0;
+	CANAF_gext_cnt = 0;
+
 /***** setup FullCAN Table *****/
 	if(AFSection->FullCAN_Sec == NULL)
 	{
@@ -290,7 +297,7 @@ CAN_ERROR CAN_SetupAFLUT(LPC_CANAF_TypeDef* CANAFx, AF_SectionDef* AFSection)
 				count++;
 				CANAF_FullCAN_cnt++;
 			}
-			AFSection->FullCAN_Sec = (FullCAN_Entry *)((uint32_t)(AFSection->FullCAN_Sec)+ sizeof(FullCAN_Entry));
+			AFSection->FullCAN_Sec++;
 		}
 	}
 
@@ -345,7 +352,7 @@ CAN_ERROR CAN_SetupAFLUT(LPC_CANAF_TypeDef* CANAFx, AF_SectionDef* AFSection)
 				count++;
 				CANAF_std_cnt++;
 			}
-			AFSection->SFF_Sec = (SFF_Entry *)((uint32_t)(AFSection->SFF_Sec)+ sizeof(SFF_Entry));
+			AFSection->SFF_Sec++;
 		}
 	}
 
@@ -388,7 +395,7 @@ CAN_ERROR CAN_SetupAFLUT(LPC_CANAF_TypeDef* CANAFx, AF_SectionDef* AFSection)
 			LPC_CANAF_RAM->mask[count] = entry;
 			CANAF_gstd_cnt++;
 			count++;
-			AFSection->SFF_GPR_Sec = (SFF_GPR_Entry *)((uint32_t)(AFSection->SFF_GPR_Sec)+ sizeof(SFF_GPR_Entry));
+			AFSection->SFF_GPR_Sec++;
 		}
 	}
 
@@ -421,7 +428,7 @@ CAN_ERROR CAN_SetupAFLUT(LPC_CANAF_TypeDef* CANAFx, AF_SectionDef* AFSection)
 			LPC_CANAF_RAM->mask[count] = entry;
 			CANAF_ext_cnt ++;
 			count++;
-			AFSection->EFF_Sec = (EFF_Entry *)((uint32_t)(AFSection->EFF_Sec)+ sizeof(EFF_Entry));
+			AFSection->EFF_Sec++;
 		}
 	}
 
@@ -460,7 +467,7 @@ CAN_ERROR CAN_SetupAFLUT(LPC_CANAF_TypeDef* CANAFx, AF_SectionDef* AFSection)
 			entry = (ctrl2 << 29)|(upperEID << 0);
 			LPC_CANAF_RAM->mask[count++] = entry;
 			CANAF_gext_cnt++;
-			AFSection->EFF_GPR_Sec = (EFF_GPR_Entry *)((uint32_t)(AFSection->EFF_GPR_Sec)+ sizeof(EFF_GPR_Entry));
+			AFSection->EFF_GPR_Sec++;
 		}
 	}
 	//update address values
@@ -72,7 +72,7 @@ void DAC_Init(LPC_DAC_TypeDef *DACx)
  * @param[in] 	dac_value : value 10 bit to be converted to output
  * @return 		None
  ***********************************************************************/
-void DAC_UpdateValue (LPC_DAC_TypeDef *DACx,uint32_t dac_value)
+__RAMFUNC void DAC_UpdateValue (LPC_DAC_TypeDef *DACx,uint32_t dac_value)
 {
 	uint32_t tmp;
 	CHECK_PARAM(PARAM_DACx(DACx));
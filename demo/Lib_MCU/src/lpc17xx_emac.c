@@ -32,6 +32,7 @@
 /* Includes ------------------------------------------------------------------- */
 #include "lpc17xx_emac.h"
 #include "lpc17xx_clkpwr.h"
+#include "lpc17xx_crc.h"
 
 /* If this source file built with example, the LPC17xx FW library configuration
  * file in each example directory ("lpc17xx_libcfg.h") must be included,
@@ -54,10 +55,10 @@
 /* MII Mgmt Configuration register - Clock divider setting */
 const uint8_t EMAC_clkdiv[] = { 4, 6, 8, 10, 14, 20, 28 };
 
-/* EMAC local DMA Descriptors */
+/* EMAC local DMA Descriptors, in AHB SRAM where the EMAC DMA reaches them */
 
 /** Rx Descriptor data array */
-static RX_Desc Rx_Desc[EMAC_NUM_RX_FRAG];
+static RX_Desc Rx_Desc[EMAC_NUM_RX_FRAG] __BSS_AHB;
 
 /** Rx Status data array - Must be 8-Byte aligned */
 #if defined ( __CC_ARM   )
@@ -66,19 +67,19 @@ static __align(8) RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG];
 #pragma data_alignment=8
 static RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG];
 #elif defined   (  __GNUC__  )
-static __attribute__ ((aligned (8))) RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG];
+static __attribute__ ((aligned (8))) RX_Stat Rx_Stat[EMAC_NUM_RX_FRAG] __BSS_AHB;
 #endif
 
 /** Tx Descriptor data array */
-static TX_Desc Tx_Desc[EMAC_NUM_TX_FRAG];
+static TX_Desc Tx_Desc[EMAC_NUM_TX_FRAG] __BSS_AHB;
 /** Tx Status data array */
-static TX_Stat Tx_Stat[EMAC_NUM_TX_FRAG];
+static TX_Stat Tx_Stat[EMAC_NUM_TX_FRAG] __BSS_AHB;
 
 /* EMAC local DMA buffers */
 /** Rx buffer data */
-static uint32_t rx_buf[EMAC_NUM_RX_FRAG][EMAC_ETH_MAX_FLEN>>2];
+static uint32_t rx_buf[EMAC_NUM_RX_FRAG][EMAC_ETH_MAX_FLEN>>2] __BSS_AHB;
 /** Tx buffer data */
-static uint32_t tx_buf[EMAC_NUM_TX_FRAG][EMAC_ETH_MAX_FLEN>>2];
+static uint32_t tx_buf[EMAC_NUM_TX_FRAG][EMAC_ETH_MAX_FLEN>>2] __BSS_AHB;
 
 /**
  * @}
@@ -91,7 +92,6 @@ static int32_t write_PHY (uint32_t PhyReg, uint16_t Value);
 static int32_t  read_PHY (uint32_t PhyReg);
 
 static void setEmacAddr(uint8_t abStationAddr[]);
-static int32_t emac_CRCCalc(uint8_t frame_no_fcs[], int32_t frame_len);
 
 
 /*--------------------------- rx_descr_init ---------------------------------*/
@@ -217,50 +217,6 @@ static void setEmacAddr(uint8_t abStationAddr[])
 	LPC_EMAC->SA2 = ((uint32_t)abStationAddr[1] << 8) | (uint32_t)abStationAddr[0];
 }
 
-
-/*********************************************************************//**
- * @brief		Calculates CRC code for number of bytes in the frame
- * @param[in]	frame_no_fcs	Pointer to the first byte of the frame
- * @param[in]	frame_len		length of the frame without the FCS
- * @return		the CRC as a 32 bit integer
- **********************************************************************/
-static int32_t emac_CRCCalc(uint8_t frame_no_fcs[], int32_t frame_len)
-{
-	int i; 		// iterator
-	int j; 		// another iterator
-	char byte; 	// current byte
-	int crc; 	// CRC result
-	int q0, q1, q2, q3; // temporary variables
-	crc = 0xFFFFFFFF;
-	for (i = 0; i < frame_len; i++) {
-		byte = *frame_no_fcs++;
-		for (j = 0; j < 2; j++) {
-			if (((crc >> 28) ^ (byte >> 3)) & 0x00000001) {
-				q3 = 0x04C11DB7;
-			} else {
-				q3 = 0x00000000;
-			}
-			if (((crc >> 29) ^ (byte >> 2)) & 0x00000001) {
-				q2 = 0x09823B6E;
-			} else {
-				q2 = 0x00000000;
-			}
-			if (((crc >> 30) ^ (byte >> 1)) & 0x00000001) {
-				q1 = 0x130476DC;
-			} else {
-				q1 = 0x00000000;
-			}
-			if (((crc >> 31) ^ (byte >> 0)) & 0x00000001) {
-				q0 = 0x2608EDB8;
-			} else {
-				q0 = 0x00000000;
-			}
-			crc = (crc << 4) ^ q3 ^ q2 ^ q1 ^ q0;
-			byte >>= 4;
-		}
-	}
-	return crc;
-}
 /* End of Private Functions --------------------------------------------------- */
 
 
@@ -643,10 +599,11 @@ void EMAC_SetHashFilter(uint8_t dstMAC_addr[], FunctionalState NewState)
 {
 	uint32_t *pReg;
 	uint32_t tmp;
-	int32_t crc;
+	uint32_t crc;
 
-	// Calculate the CRC from the destination MAC address
-	crc = emac_CRCCalc(dstMAC_addr, 6);
+	// Calculate the CRC from the destination MAC address. The EMAC shifts
+	// the CRC register MSB first, that is the reflected register bit reversed
+	crc = __RBIT(CRC32_Update(CRC32_Init(), dstMAC_addr, 6));
 	// Extract the value from CRC to get index value for hash filter table
 	crc = (crc >> 23) & 0x3F;
 
@@ -773,6 +730,46 @@ void EMAC_ReadPacketBuffer(EMAC_PACKETBUF_Type *pDataStruct)
 	}
 }
 
+/*********************************************************************//**
+ * @brief		Get a pointer to the Rx packet data buffer at current index due
+ * 				to RxConsumeIndex, so the frame can be processed in place
+ * @param[in]	None
+ * @return		Pointer to the first byte of the received frame
+ *
+ * Note: The buffer belongs to the application until the RxConsumeIndex is
+ * updated with EMAC_UpdateRxConsumeIndex().
+ **********************************************************************/
+uint8_t *EMAC_GetRxPacketPtr(void)
+{
+	return (uint8_t *)Rx_Desc[LPC_EMAC->RxConsumeIndex].Packet;
+}
+
+/*********************************************************************//**
+ * @brief		Get a pointer to the Tx packet data buffer at current index due
+ * 				to TxProduceIndex, so a frame can be built in place
+ * @param[in]	None
+ * @return		Pointer to the first byte of the frame to transmit
+ *
+ * Note: Check with EMAC_CheckTransmitIndex() that the buffer is free, then
+ * set the frame size with EMAC_SetTxPacketSize() and send it with
+ * EMAC_UpdateTxProduceIndex().
+ **********************************************************************/
+uint8_t *EMAC_GetTxPacketPtr(void)
+{
+	return (uint8_t *)Tx_Desc[LPC_EMAC->TxProduceIndex].Packet;
+}
+
+/*********************************************************************//**
+ * @brief		Set the size of the frame built in the Tx packet data buffer
+ * 				at current index due to TxProduceIndex
+ * @param[in]	ulDataLen	Frame size in bytes, without the FCS
+ * @return		None
+ **********************************************************************/
+void EMAC_SetTxPacketSize(uint32_t ulDataLen)
+{
+	Tx_Desc[LPC_EMAC->TxProduceIndex].Ctrl = (ulDataLen - 1) | (EMAC_TCTRL_INT | EMAC_TCTRL_LAST);
+}
+
 /*********************************************************************//**
  * @brief 		Enable/Disable interrupt for each type in EMAC
  * @param[in]	ulIntType	Interrupt Type, should be:
@@ -860,8 +857,9 @@ Bool EMAC_CheckReceiveIndex(void)
  **********************************************************************/
 Bool EMAC_CheckTransmitIndex(void)
 {
-	uint32_t tmp = LPC_EMAC->TxConsumeIndex -1;
-	if (LPC_EMAC->TxProduceIndex == tmp) {
+	uint32_t tmp = LPC_EMAC->TxProduceIndex + 1;
+	if (tmp == EMAC_NUM_TX_FRAG) tmp = 0;
+	if (LPC_EMAC->TxConsumeIndex == tmp) {
 		return FALSE;
 	} else {
 		return TRUE;
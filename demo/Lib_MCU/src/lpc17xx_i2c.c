@@ -78,6 +78,11 @@ static uint32_t I2C_SlaveComplete[3];
 
 static uint32_t I2C_MonitorBufferIndex;
 
+/**
+ * @brief Hook of polling master transfers, NULL if none
+ */
+static I2C_TRANSFER_HOOK_Type I2C_TransferHook = NULL;
+
 /* Private Functions ---------------------------------------------------------- */
 
 /* Get I2C number */
@@ -107,7 +112,7 @@ static void I2C_SetClock (LPC_I2C_TypeDef *I2Cx, uint32_t target_clock);
  * 				- LPC_I2C2
  * @return 		I2C number, could be: 0..2
  *********************************************************************/
-static int32_t I2C_getNum(LPC_I2C_TypeDef *I2Cx){
+__RAMFUNC static int32_t I2C_getNum(LPC_I2C_TypeDef *I2Cx){
 	if (I2Cx == LPC_I2C0) {
 		return (0);
 	} else if (I2Cx == LPC_I2C1) {
@@ -410,7 +415,7 @@ void I2C_IntCmd (LPC_I2C_TypeDef *I2Cx, Bool NewState)
  * 				- LPC_I2C2
  * @return 		None
  **********************************************************************/
-void I2C_MasterHandler (LPC_I2C_TypeDef  *I2Cx)
+__RAMFUNC void I2C_MasterHandler (LPC_I2C_TypeDef  *I2Cx)
 {
 	int32_t tmp;
 	uint8_t returnCode;
@@ -793,6 +798,10 @@ Status I2C_MasterTransferData(LPC_I2C_TypeDef *I2Cx, I2C_M_SETUP_Type *TransferC
 
 	if (Opt == I2C_TRANSFER_POLLING){
 
+		if (I2C_TransferHook != NULL){
+			I2C_TransferHook(I2Cx, TransferCfg, I2C_HOOK_START);
+		}
+
 		/* First Start condition -------------------------------------------------------------- */
 		TransferCfg->retransmissions_count = 0;
 retry:
@@ -930,11 +939,17 @@ retry:
 
 		/* Send STOP condition ------------------------------------------------- */
 		I2C_Stop(I2Cx);
+		if (I2C_TransferHook != NULL){
+			I2C_TransferHook(I2Cx, TransferCfg, I2C_HOOK_DONE);
+		}
 		return SUCCESS;
 
 error:
 		// Send stop condition
 		I2C_Stop(I2Cx);
+		if (I2C_TransferHook != NULL){
+			I2C_TransferHook(I2Cx, TransferCfg, I2C_HOOK_ERROR);
+		}
 		return ERROR;
 	}
 
@@ -956,6 +971,21 @@ error:
 	return ERROR;
 }
 
+/*********************************************************************//**
+ * @brief 		Install a hook called at the start and at the end of every
+ * 				master transfer in polling mode, e.g. for tracing
+ * @param[in]	Hook	Function called with the I2C peripheral, the transfer
+ * 						setup and the event, NULL removes the hook
+ * @return 		None
+ *
+ * Note: the hook runs in the caller of I2C_MasterTransferData and must not
+ * start another transfer. Interrupt mode transfers are not reported.
+ **********************************************************************/
+void I2C_SetTransferHook(I2C_TRANSFER_HOOK_Type Hook)
+{
+	I2C_TransferHook = Hook;
+}
+
 /*********************************************************************//**
  * @brief 		Receive and Transmit data in slave mode
  * @param[in]	I2Cx			I2C peripheral selected, should be
@@ -47,6 +47,16 @@
 
 #ifdef _RTC
 
+/* Private Variables ---------------------------------------------------------- */
+/** Last coherent copy of the time counters */
+static RTC_SNAPSHOT_Type SnapshotCache;
+/** Value of SnapshotTick when SnapshotCache was taken */
+static uint32_t SnapshotCacheTick;
+/** SnapshotCache may be reused, i.e. invalidation is interrupt driven */
+static Bool SnapshotCacheValid = FALSE;
+/** Incremented on every invalidation of SnapshotCache */
+static volatile uint32_t SnapshotTick = 0;
+
 /* Public Functions ----------------------------------------------------------- */
 /** @addtogroup RTC_Public_Functions
  * @{
@@ -70,6 +80,8 @@ void RTC_Init (LPC_RTC_TypeDef *RTCx)
 	RTCx->CIIR = 0x00;
 	RTCx->AMR = 0xFF;
 	RTCx->CALIBRATION = 0x00;
+
+	RTC_InvalidateSnapshot(RTCx);
 }
 
 
@@ -99,6 +111,8 @@ void RTC_ResetClockTickCounter(LPC_RTC_TypeDef *RTCx)
 
 	RTCx->CCR |= RTC_CCR_CTCRST;
 	RTCx->CCR &= (~RTC_CCR_CTCRST) & RTC_CCR_BITMASK;
+
+	RTC_InvalidateSnapshot(RTCx);
 }
 
 /*********************************************************************//**
@@ -382,6 +396,8 @@ void RTC_SetTime (LPC_RTC_TypeDef *RTCx, uint32_t Timetype, uint32_t TimeValue)
 		RTCx->YEAR = TimeValue & RTC_YEAR_MASK;
 		break;
 	}
+
+	RTC_InvalidateSnapshot(RTCx);
 }
 
 /*********************************************************************//**
@@ -446,6 +462,8 @@ void RTC_SetFullTime (LPC_RTC_TypeDef *RTCx, RTC_TIME_Type *pFullTime)
 	RTCx->SEC = pFullTime->SEC & RTC_SEC_MASK;
 	RTCx->MONTH = pFullTime->MONTH & RTC_MONTH_MASK;
 	RTCx->YEAR = pFullTime->YEAR & RTC_YEAR_MASK;
+
+	RTC_InvalidateSnapshot(RTCx);
 }
 
 
@@ -471,6 +489,68 @@ void RTC_GetFullTime (LPC_RTC_TypeDef *RTCx, RTC_TIME_Type *pFullTime)
 }
 
 
+/*********************************************************************//**
+ * @brief 		Get a coherent copy of all time counters
+ * @param[in]	RTCx	RTC peripheral selected, should be LPC_RTC
+ * @param[in]	pSnapshot Pointer to a RTC_SNAPSHOT_Type structure that
+ * 				will be filled with the current time
+ * @return 		None
+ * Note: The counters are read through the consolidated time registers
+ * CTIME0..CTIME2 and the read is repeated if the time rolled over in
+ * between, so all fields always belong to the same second.
+ * When the counter increment interrupt for seconds is enabled (CIIR),
+ * the copy is kept and returned without touching the peripheral until
+ * RTC_InvalidateSnapshot() is called, which the application must do
+ * from its RTC_IRQHandler on RTC_INT_COUNTER_INCREASE.
+ **********************************************************************/
+void RTC_GetSnapshot (LPC_RTC_TypeDef *RTCx, RTC_SNAPSHOT_Type *pSnapshot)
+{
+	uint32_t tick;
+	uint32_t ctime0, ctime1, ctime2;
+
+	CHECK_PARAM(PARAM_RTCx(RTCx));
+
+	tick = SnapshotTick;
+	if ((SnapshotCacheValid == FALSE) || (SnapshotCacheTick != tick))
+	{
+		do
+		{
+			ctime0 = RTCx->CTIME0;
+			ctime1 = RTCx->CTIME1;
+			ctime2 = RTCx->CTIME2;
+		} while (ctime0 != RTCx->CTIME0);
+
+		SnapshotCache.SEC = ctime0 & RTC_CTIME0_SECONDS_MASK;
+		SnapshotCache.MIN = (ctime0 & RTC_CTIME0_MINUTES_MASK) >> RTC_CTIME0_MINUTES_POS;
+		SnapshotCache.HOUR = (ctime0 & RTC_CTIME0_HOURS_MASK) >> RTC_CTIME0_HOURS_POS;
+		SnapshotCache.DOW = (ctime0 & RTC_CTIME0_DOW_MASK) >> RTC_CTIME0_DOW_POS;
+		SnapshotCache.DOM = ctime1 & RTC_CTIME1_DOM_MASK;
+		SnapshotCache.MONTH = (ctime1 & RTC_CTIME1_MONTH_MASK) >> RTC_CTIME1_MONTH_POS;
+		SnapshotCache.YEAR = (ctime1 & RTC_CTIME1_YEAR_MASK) >> RTC_CTIME1_YEAR_POS;
+		SnapshotCache.DOY = ctime2 & RTC_CTIME2_DOY_MASK;
+
+		SnapshotCacheTick = tick;
+		SnapshotCacheValid = ((RTCx->CIIR & RTC_CIIR_IMSEC) != 0) ? TRUE : FALSE;
+	}
+
+	*pSnapshot = SnapshotCache;
+}
+
+
+/*********************************************************************//**
+ * @brief 		Drop the time copy kept by RTC_GetSnapshot()
+ * @param[in]	RTCx	RTC peripheral selected, should be LPC_RTC
+ * @return 		None
+ * Note: Safe to call from interrupt context.
+ **********************************************************************/
+void RTC_InvalidateSnapshot (LPC_RTC_TypeDef *RTCx)
+{
+	CHECK_PARAM(PARAM_RTCx(RTCx));
+
+	SnapshotTick++;
+}
+
+
 /*********************************************************************//**
  * @brief 		Set alarm time value for each time type
  * @param[in]	RTCx	RTC peripheral selected, should be LPC_RTC
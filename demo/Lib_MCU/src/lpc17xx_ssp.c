@@ -187,7 +187,7 @@ void SSP_DeInit(LPC_SSP_TypeDef* SSPx)
 *				...
 *				- SSP_DATABIT_16: 16 bit transfer
 *******************************************************************************/
-uint8_t SSP_GetDataSize(LPC_SSP_TypeDef* SSPx)
+__RAMFUNC uint8_t SSP_GetDataSize(LPC_SSP_TypeDef* SSPx)
 {
 	CHECK_PARAM(PARAM_SSPx(SSPx));
 	return (SSPx->CR0 & (0xF));
@@ -216,6 +216,23 @@ void SSP_ConfigStructInit(SSP_CFG_Type *SSP_InitStruct)
 }
 
 
+/*********************************************************************//**
+ * @brief		Change the SCK clock rate of an already initialized SSP
+ * 				peripheral. The resulting rate is at or below target_clock.
+ * @param[in]	SSPx	SSP peripheral, should be:
+ * 				- LPC_SSP0: SSP0 peripheral
+ * 				- LPC_SSP1: SSP1 peripheral
+ * @param[in]	target_clock : clock of SSP (Hz)
+ * @return 		None
+ **********************************************************************/
+void SSP_SetClock (LPC_SSP_TypeDef *SSPx, uint32_t target_clock)
+{
+	CHECK_PARAM(PARAM_SSPx(SSPx));
+
+	setSSPclock(SSPx, target_clock);
+}
+
+
 /*********************************************************************//**
  * @brief		Enable or disable SSP peripheral's operation
  * @param[in]	SSPx	SSP peripheral, should be:
@@ -303,7 +320,7 @@ void SSP_SlaveOutputCmd(LPC_SSP_TypeDef* SSPx, FunctionalState NewState)
  * 						this depend on SSP data bit number configured)
  * @return 		none
  **********************************************************************/
-void SSP_SendData(LPC_SSP_TypeDef* SSPx, uint16_t Data)
+__RAMFUNC void SSP_SendData(LPC_SSP_TypeDef* SSPx, uint16_t Data)
 {
 	CHECK_PARAM(PARAM_SSPx(SSPx));
 
@@ -319,7 +336,7 @@ void SSP_SendData(LPC_SSP_TypeDef* SSPx, uint16_t Data)
  * 						- LPC_SSP1: SSP1 peripheral
  * @return 		Data received (16-bit long)
  **********************************************************************/
-uint16_t SSP_ReceiveData(LPC_SSP_TypeDef* SSPx)
+__RAMFUNC uint16_t SSP_ReceiveData(LPC_SSP_TypeDef* SSPx)
 {
 	CHECK_PARAM(PARAM_SSPx(SSPx));
 
@@ -342,7 +359,7 @@ uint16_t SSP_ReceiveData(LPC_SSP_TypeDef* SSPx)
  * 				Return (-1) if error.
  * Note: This function can be used in both master and slave mode.
  ***********************************************************************/
-int32_t SSP_ReadWrite (LPC_SSP_TypeDef *SSPx, SSP_DATA_SETUP_Type *dataCfg, \
+__RAMFUNC int32_t SSP_ReadWrite (LPC_SSP_TypeDef *SSPx, SSP_DATA_SETUP_Type *dataCfg, \
 						SSP_TRANSFER_Type xfType)
 {
 	uint8_t *rdata8;
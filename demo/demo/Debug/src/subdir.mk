@@ -4,32 +4,62 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../src/assets.c \
+../src/assets_data.c \
+../src/boot.c \
+../src/cangroup.c \
 ../src/cr_startup_lpc17.c \
-../src/down.c \
+../src/datetime.c \
+../src/format.c \
+../src/kvstore.c \
 ../src/main.c \
-../src/sound_8k.c \
-../src/up.c 
-
+../src/net.c \
+../src/profile.c \
+../src/proto.c \
+../src/serial.c \
+../src/stackmon.c \
+../src/telemetry.c \
+../src/trace.c 
 OBJS += \
+./src/assets.o \
+./src/assets_data.o \
+./src/boot.o \
+./src/cangroup.o \
 ./src/cr_startup_lpc17.o \
-./src/down.o \
+./src/datetime.o \
+./src/format.o \
+./src/kvstore.o \
 ./src/main.o \
-./src/sound_8k.o \
-./src/up.o 
-
+./src/net.o \
+./src/profile.o \
+./src/proto.o \
+./src/serial.o \
+./src/stackmon.o \
+./src/telemetry.o \
+./src/trace.o 
 C_DEPS += \
+./src/assets.d \
+./src/assets_data.d \
+./src/boot.d \
+./src/cangroup.d \
 ./src/cr_startup_lpc17.d \
-./src/down.d \
+./src/datetime.d \
+./src/format.d \
+./src/kvstore.d \
 ./src/main.d \
-./src/sound_8k.d \
-./src/up.d 
-
+./src/net.d \
+./src/profile.d \
+./src/proto.d \
+./src/serial.d \
+./src/stackmon.d \
+./src/telemetry.d \
+./src/trace.d 
 
 # Each subdirectory must supply rules for building sources it contributes
 src/%.o: ../src/%.c
 	@echo 'Building file: $<'
 	@echo 'Invoking: MCU C Compiler'
-	arm-none-eabi-gcc -DDEBUG -D__USE_CMSIS=CMSISv1p30_LPC17xx -D__CODE_RED -D__NEWLIB__ -I"C:\Users\247810\Desktop\EmbeddedSystems\demo\Lib_CMSISv1p30_LPC17xx\inc" -I"C:\Users\247810\Desktop\EmbeddedSystems\demo\Lib_EaBaseBoard\inc" -I"C:\Users\247810\Desktop\EmbeddedSystems\demo\Lib_MCU\inc" -O0 -g3 -Wall -c -fmessage-length=0 -fno-builtin -ffunction-sections -fmerge-constants -fmacro-prefix-map="../$(@D)/"=. -mcpu=cortex-m3 -mthumb -D__NEWLIB__ -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@:%.o=%.o)" -MT"$(@:%.o=%.d)" -o "$@" "$<"
+	arm-none-eabi-gcc -DDEBUG -D__USE_CMSIS=CMSISv1p30_LPC17xx -D__CODE_RED -D__NEWLIB__ -I"C:\Users\247810\Desktop\EmbeddedSystems\demo\Lib_CMSISv1p30_LPC17xx\inc" -I"C:\Users\247810\Desktop\EmbeddedSystems\demo\Lib_EaBaseBoard\inc" -I"C:\Users\247810\Desktop\EmbeddedSystems\demo\Lib_FatFs_SD\inc" -I"C:\Users\247810\Desktop\EmbeddedSystems\demo\Lib_MCU\inc" -O0 -g3 -Wall -c -fmessage-length=0 -fno-builtin -ffunction-sections -fmerge-constants -fmacro-prefix-map="../$(@D)/"=. -mcpu=cortex-m3 -mthumb -D__NEWLIB__ -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@:%.o=%.o)" -MT"$(@:%.o=%.d)" -o "$@" "$<"
 	@echo 'Finished building: $<'
 	@echo ' '
 
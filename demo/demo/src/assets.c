@@ -0,0 +1,237 @@
+/*****************************************************************************
+ *   assets.c:  Access to the asset bundle in internal flash or on the DataFlash
+ *
+ ******************************************************************************/
+
+/*
+ * The sounds (and any fonts or bitmaps added to ../assets) are packed by
+ * tools/assetpack.py into one bundle with a table of named entries. The
+ * bundle in assets_data.c is linked into the internal flash and used in
+ * place: assets_find returns a pointer into the table and assets_data a
+ * pointer to the data, nothing is copied to RAM.
+ *
+ * The same bundle image can be programmed into the SPI DataFlash instead
+ * for assets too large for the internal flash. assets_flashOpen looks an
+ * asset up there and assets_flashRead streams it in pieces of any size.
+ * Pieces of ASSETS_DMA_MIN bytes or more are read by the GPDMA
+ * (flash_readDma) while the CPU sleeps, shorter ones and reads the GPDMA
+ * refuses go through flash_read.
+ *
+ * assets_init checks the header and the table CRC once. The data CRCs are
+ * only checked by assets_verify as that reads the whole asset.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "LPC17xx.h"
+#include "assets.h"
+#include "flash.h"
+#include "lpc17xx_crc.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+/* Below this the command and channel setup cost more than the polled read */
+#define ASSETS_DMA_MIN      64U
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static const assets_header_t *header = NULL;    /* NULL until assets_init passed */
+static volatile Bool dmaDone = FALSE;
+static volatile uint32_t dmaRead = 0U;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Compares an entry name with a null terminated name.
+ *  @returns  		TRUE if equal.
+ *  @side effects:	None.
+ */
+static Bool nameEquals(const asset_entry_t *entry, const char *name) {
+    uint8_t i = 0U;
+    while ((i < (ASSET_NAME_MAX - 1U)) && (name[i] != '\0') && (entry->name[i] == name[i])) {
+        i++;
+    }
+    return (Bool)((i < ASSET_NAME_MAX) && (name[i] == '\0') && (entry->name[i] == '\0'));
+}
+
+/*!
+ *  @brief    		Completion of the flash_readDma of assets_flashRead.
+ *  @side effects:	Runs in the DMA interrupt.
+ */
+static void flashReadDone(uint8_t *buf, uint32_t len) {
+    (void)buf;
+    dmaRead = len;
+    dmaDone = TRUE;
+}
+
+/*!
+ *  @brief    		Checks the fixed fields of a bundle header.
+ *  @side effects:	None.
+ */
+static Bool headerValid(const assets_header_t *hdr) {
+    return (Bool)((hdr->magic == ASSETS_MAGIC) && (hdr->version == ASSETS_VERSION)
+            && (hdr->size >= (sizeof(assets_header_t) + ((uint32_t)hdr->count * sizeof(asset_entry_t)))));
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Checks the header and the table of the linked in bundle.
+ *  @returns  		Number of assets or ASSETS_ERR_FORMAT.
+ *  @side effects:	None.
+ */
+int32_t assets_init(void) {
+    const assets_header_t *hdr = (const assets_header_t *)assets_bundle;
+    int32_t output = ASSETS_ERR_FORMAT;
+
+    header = NULL;
+    if (headerValid(hdr) && (CRC16_Final(CRC16_Update(CRC16_Init(),
+            &assets_bundle[sizeof(assets_header_t)], (uint32_t)hdr->count * sizeof(asset_entry_t))) == hdr->tableCrc)) {
+        header = hdr;
+        output = (int32_t)hdr->count;
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Looks an asset of the linked in bundle up by name.
+ *  @param name		const char*,
+ *             		file name without extension.
+ *  @returns  		Entry in flash, NULL if not found or assets_init failed.
+ *  @side effects:	None.
+ */
+const asset_entry_t *assets_find(const char *name) {
+    const asset_entry_t *table = (const asset_entry_t *)&assets_bundle[sizeof(assets_header_t)];
+    const asset_entry_t *output = NULL;
+    uint16_t i;
+
+    if (header != NULL) {
+        for (i = 0U; (output == NULL) && (i < header->count); i++) {
+            if (nameEquals(&table[i], name)) {
+                output = &table[i];
+            }
+        }
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Returns the data of an asset, entry->length bytes.
+ *  @param entry	const asset_entry_t*,
+ *             		entry returned by assets_find.
+ *  @returns  		Pointer into flash, word aligned.
+ *  @side effects:	None.
+ */
+const uint8_t *assets_data(const asset_entry_t *entry) {
+    return &assets_bundle[entry->offset];
+}
+
+/*!
+ *  @brief    		Checks the data CRC of an asset of the linked in bundle.
+ *  @param entry	const asset_entry_t*,
+ *             		entry returned by assets_find.
+ *  @returns  		TRUE if the data is intact.
+ *  @side effects:	Reads the whole asset, about 1 ms per 10 kB at 100 MHz.
+ */
+Bool assets_verify(const asset_entry_t *entry) {
+    return (Bool)(CRC16_Final(CRC16_Update(CRC16_Init(), assets_data(entry), entry->length)) == entry->crc);
+}
+
+/*!
+ *  @brief    		Looks an asset up in a bundle programmed into the DataFlash.
+ *  @param bundleOffset	uint32_t,
+ *             		flash offset of the bundle.
+ *  @param name		const char*,
+ *             		file name without extension.
+ *  @param stream	asset_stream_t*,
+ *             		output, positioned at the start of the asset data.
+ *  @returns  		Length of the asset or error code.
+ *  @side effects:	flash_init has to succeed prior to running this function.
+ *             		Reads the whole table to check its CRC.
+ */
+int32_t assets_flashOpen(uint32_t bundleOffset, const char *name, asset_stream_t *stream) {
+    assets_header_t hdr;
+    asset_entry_t entry;
+    uint32_t ofs = bundleOffset + sizeof(assets_header_t);
+    uint16_t crc = CRC16_Init();
+    uint16_t i;
+    Bool found = FALSE;
+    Bool scan = FALSE;
+    int32_t output = ASSETS_ERR_FLASH;
+
+    if (flash_read((uint8_t *)&hdr, bundleOffset, sizeof(hdr)) == sizeof(hdr)) {
+        scan = headerValid(&hdr);
+        output = ASSETS_ERR_FORMAT;
+    }
+    for (i = 0U; scan && (i < hdr.count); i++) {
+        if (flash_read((uint8_t *)&entry, ofs, sizeof(entry)) != sizeof(entry)) {
+            output = ASSETS_ERR_FLASH;
+            scan = FALSE;
+        } else {
+            crc = CRC16_Update(crc, (const uint8_t *)&entry, sizeof(entry));
+            if ((!found) && nameEquals(&entry, name)) {
+                stream->entry = entry;
+                found = TRUE;
+            }
+            ofs += sizeof(entry);
+        }
+    }
+    if (scan && (CRC16_Final(crc) == hdr.tableCrc)) {
+        if (!found) {
+            output = ASSETS_ERR_NOTFOUND;
+        } else {
+            stream->offset = bundleOffset + stream->entry.offset;
+            stream->length = stream->entry.length;
+            stream->pos = 0U;
+            output = (int32_t)stream->length;
+        }
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Reads the next part of an asset opened by assets_flashOpen.
+ *  @param stream	asset_stream_t*,
+ *             		stream returned by assets_flashOpen.
+ *  @param buf		uint8_t*,
+ *             		output buffer.
+ *  @param len		uint32_t,
+ *             		bytes to read.
+ *  @returns  		Bytes read, 0 at the end of the asset or if the flash is busy.
+ *  @side effects:	Sleeps in __WFI until the GPDMA has read ASSETS_DMA_MIN bytes
+ *            		or more, must not be called from an interrupt handler.
+ */
+uint32_t assets_flashRead(asset_stream_t *stream, uint8_t *buf, uint32_t len) {
+    uint32_t left = stream->length - stream->pos;
+    uint32_t ofs = stream->offset + stream->pos;
+    uint32_t output = 0U;
+
+    if (len > left) {
+        len = left;
+    }
+    if (len >= ASSETS_DMA_MIN) {
+        dmaDone = FALSE;
+        if (flash_readDma(buf, ofs, len, flashReadDone) == len) {
+            while (!dmaDone) {
+                __WFI();
+            }
+            output = dmaRead;
+        } else {
+            output = flash_read(buf, ofs, len);
+        }
+    } else if (len != 0U) {
+        output = flash_read(buf, ofs, len);
+    } else {}
+    stream->pos += output;
+    return output;
+}
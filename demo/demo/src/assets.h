@@ -0,0 +1,76 @@
+/*****************************************************************************
+ *   assets.h:  Header file for the asset bundle (sounds, fonts, bitmaps)
+ *
+******************************************************************************/
+#ifndef __ASSETS_H
+#define __ASSETS_H
+
+#include "lpc_types.h"
+
+/* Asset types, info word of the entry in brackets */
+#define ASSET_RAW           0U  /* (0) */
+#define ASSET_WAV           1U  /* PCM RIFF/WAVE file (sample rate) */
+#define ASSET_BMP           2U  /* Windows bitmap (width | height << 16) */
+#define ASSET_FONT          3U  /* glyphs of 8 bytes (number of glyphs) */
+
+#define ASSET_NAME_MAX      16U /* including the terminating null */
+
+/* Return codes, values >= 0 mean success */
+#define ASSETS_ERR_NOTFOUND (-1)    /* no such asset */
+#define ASSETS_ERR_FORMAT   (-2)    /* no bundle or damaged table */
+#define ASSETS_ERR_FLASH    (-3)    /* DataFlash read failed */
+
+/*
+ * Bundle layout, built by tools/assetpack.py: header, table of
+ * header.count entries, then the data of each asset aligned to 4 bytes.
+ * Offsets are from the start of the bundle, all fields little endian,
+ * CRCs are CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF).
+ */
+typedef struct
+{
+    uint32_t magic;     /* ASSETS_MAGIC */
+    uint16_t version;   /* ASSETS_VERSION */
+    uint16_t count;     /* entries in the table */
+    uint32_t size;      /* bytes of the whole bundle */
+    uint16_t tableCrc;  /* CRC of the entry table */
+    uint16_t spare;
+} assets_header_t;
+
+typedef struct
+{
+    char name[ASSET_NAME_MAX];  /* file name without extension */
+    uint32_t offset;
+    uint32_t length;
+    uint16_t type;      /* ASSET_* */
+    uint16_t crc;       /* CRC of the data */
+    uint32_t info;      /* see ASSET_* */
+} asset_entry_t;
+
+#define ASSETS_MAGIC        0x31425341UL    /* "ASB1" */
+#define ASSETS_VERSION      1U
+
+/* Sequential reader of an asset stored in a bundle on the SPI DataFlash */
+typedef struct
+{
+    uint32_t offset;    /* flash offset of the data */
+    uint32_t length;
+    uint32_t pos;       /* bytes read so far */
+    asset_entry_t entry;
+} asset_stream_t;
+
+/* Bundle linked into the internal flash, generated from ../assets */
+extern const uint8_t assets_bundle[];
+
+int32_t assets_init(void);
+const asset_entry_t *assets_find(const char *name);
+const uint8_t *assets_data(const asset_entry_t *entry);
+Bool assets_verify(const asset_entry_t *entry);
+
+int32_t assets_flashOpen(uint32_t bundleOffset, const char *name, asset_stream_t *stream);
+uint32_t assets_flashRead(asset_stream_t *stream, uint8_t *buf, uint32_t len);
+
+
+#endif /* end __ASSETS_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
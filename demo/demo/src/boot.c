@@ -0,0 +1,190 @@
+/*****************************************************************************
+ *   boot.c:  Boot sequencer, timer based settle times of the slow hardware
+ *
+ ******************************************************************************/
+
+/*
+ * Slow hardware is started early and left to settle while the rest of the
+ * initialization runs: boot_after schedules the completion of a step (an
+ * optional action, e.g. switching on the OLED supply) a number of
+ * milliseconds later instead of spinning for it. boot_poll runs the steps
+ * that became due and is called from the main loop; boot_wait sleeps until
+ * a step is done where the boot cannot go on without it.
+ *
+ * Every step records the SysTick milliseconds since boot_init when it was
+ * done, boot_time(BOOT_FIRST_FRAME) is the boot time to the first frame
+ * (plus the few hundred microseconds of the startup code before main).
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "LPC17xx.h"
+#include "boot.h"
+#include "trace.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+typedef enum
+{
+    STEP_IDLE,
+    STEP_PENDING,
+    STEP_DONE
+} step_state_t;
+
+typedef struct
+{
+    step_state_t state;
+    uint32_t due;               /* ms since boot_init */
+    uint32_t time;              /* ms since boot_init when done */
+    void (*action)(void);
+} step_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint32_t (*getMs)(void) = NULL;
+static uint32_t startMs = 0U;
+static step_t steps[BOOT_STEPS];
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Milliseconds since boot_init.
+ *  @returns  		Elapsed ms.
+ *  @side effects:	None.
+ */
+static uint32_t elapsed(void) {
+    return getMs() - startMs;
+}
+
+/*!
+ *  @brief    		Completes a step, runs its action first.
+ *  @param step		boot_step_t,
+ *             		step to complete.
+ *  @returns
+ *  @side effects:	Calls the action of the step.
+ */
+static void complete(boot_step_t step) {
+    step_t *s = &steps[step];
+
+    if (s->action != NULL) {
+        s->action();
+    }
+    s->time = elapsed();
+    s->state = STEP_DONE;
+    TRACE(TRACE_BOOT, step);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Starts the boot clock, call right after SysTick_Config.
+ *  @param getMsTick	uint32_t (*)(void),
+ *             		millisecond tick counter.
+ *  @returns
+ *  @side effects:	None.
+ */
+void boot_init(uint32_t (*getMsTick)(void)) {
+    uint32_t i;
+
+    getMs = getMsTick;
+    startMs = getMs();
+    for (i = 0U; i < (uint32_t)BOOT_STEPS; i++) {
+        steps[i].state = STEP_IDLE;
+        steps[i].time = BOOT_NOT_DONE;
+        steps[i].action = NULL;
+    }
+}
+
+/*!
+ *  @brief    		Schedules the completion of a step.
+ *  @param step		boot_step_t,
+ *             		step to complete.
+ *  @param delayMs	uint32_t,
+ *             		settle time from now in ms.
+ *  @param action	void (*)(void),
+ *             		run when the step completes, NULL for none.
+ *  @returns
+ *  @side effects:	None, the action runs from boot_poll or boot_wait.
+ */
+void boot_after(boot_step_t step, uint32_t delayMs, void (*action)(void)) {
+    step_t *s = &steps[step];
+
+    s->action = action;
+    s->due = elapsed() + delayMs + 1U;      /* the first tick may be partial */
+    s->state = STEP_PENDING;
+}
+
+/*!
+ *  @brief    		Completes the steps whose settle time is over, call from the main loop.
+ *  @returns
+ *  @side effects:	Runs the actions of the completed steps.
+ */
+void boot_poll(void) {
+    uint32_t now = elapsed();
+    uint32_t i;
+
+    for (i = 0U; i < (uint32_t)BOOT_STEPS; i++) {
+        if ((steps[i].state == STEP_PENDING) && ((int32_t)(now - steps[i].due) >= 0)) {
+            complete((boot_step_t)i);
+        }
+    }
+}
+
+/*!
+ *  @brief    		Tells whether a step is complete.
+ *  @param step		boot_step_t,
+ *             		step to check.
+ *  @returns  		TRUE when done.
+ *  @side effects:	None.
+ */
+Bool boot_done(boot_step_t step) {
+    return (Bool)(steps[step].state == STEP_DONE);
+}
+
+/*!
+ *  @brief    		Sleeps until a scheduled step is complete.
+ *  @param step		boot_step_t,
+ *             		step to wait for, returns at once if it was never scheduled.
+ *  @returns
+ *  @side effects:	Runs the actions of all steps becoming due meanwhile.
+ */
+void boot_wait(boot_step_t step) {
+    boot_poll();
+    while (steps[step].state == STEP_PENDING) {
+        __WFI();
+        boot_poll();
+    }
+}
+
+/*!
+ *  @brief    		Records a step without a settle time as done now.
+ *  @param step		boot_step_t,
+ *             		step reached.
+ *  @returns
+ *  @side effects:	None.
+ */
+void boot_mark(boot_step_t step) {
+    steps[step].action = NULL;
+    complete(step);
+}
+
+/*!
+ *  @brief    		Returns when a step was completed.
+ *  @param step		boot_step_t,
+ *             		step to look up.
+ *  @returns  		ms since boot_init, BOOT_NOT_DONE if not done yet.
+ *  @side effects:	None.
+ */
+uint32_t boot_time(boot_step_t step) {
+    return steps[step].time;
+}
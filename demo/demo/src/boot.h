@@ -0,0 +1,33 @@
+/*****************************************************************************
+ *   boot.h:  Header file for the boot sequencer
+ *
+******************************************************************************/
+#ifndef __BOOT_H
+#define __BOOT_H
+
+#include "lpc_types.h"
+
+/* Boot steps with a settle time or a time worth reporting */
+typedef enum
+{
+    BOOT_OLED_POWER,            /* OLED supply switched on after the controller setup */
+    BOOT_LIGHT,                 /* first light sensor integration complete */
+    BOOT_FIRST_FRAME,           /* first complete frame on the powered display */
+    BOOT_STEPS
+} boot_step_t;
+
+#define BOOT_NOT_DONE       0xFFFFFFFFUL
+
+void boot_init(uint32_t (*getMsTick)(void));
+void boot_after(boot_step_t step, uint32_t delayMs, void (*action)(void));
+void boot_poll(void);
+Bool boot_done(boot_step_t step);
+void boot_wait(boot_step_t step);
+void boot_mark(boot_step_t step);
+uint32_t boot_time(boot_step_t step);
+
+
+#endif /* end __BOOT_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
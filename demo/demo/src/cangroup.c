@@ -0,0 +1,431 @@
+/*****************************************************************************
+ *   cangroup.c:  CAN group messages between blind controllers
+ *
+ ******************************************************************************/
+
+/*
+ * Controllers of one installation share a CAN bus. A message goes to a
+ * group, not to a controller: group g is the standard identifier
+ * CANGROUP_ID_BASE + g, so one frame reaches every member at once.
+ * A controller joins ranges of groups (e.g. its window, its floor and
+ * CANGROUP_ALL); the ranges are the group section of the acceptance filter
+ * table, so frames of other groups are dropped by the hardware and never
+ * interrupt the CPU.
+ *
+ * RX: the CAN interrupt moves accepted frames into a queue which
+ * cangroup_receive empties from the main loop. TX: cangroup_send queues a
+ * frame and the transmit interrupt feeds the queue to the controller, one
+ * frame at a time through TX buffer 1 so frames leave in queue order.
+ *
+ * Own frames are not received; the sender applies a group message to
+ * itself when cangroup_isMember says so.
+ *
+ * cangroup_selfTest runs the controller in self test mode (no
+ * acknowledge needed, own frames received through the acceptance filter)
+ * and checks that a frame of a joined group comes back unchanged and one
+ * of a group not joined is dropped. It uses the CANGROUP_TEST groups,
+ * which no controller joins, since the frames are still sent on the bus.
+ *
+ * CAN_IRQHandler must call cangroup_intHandler.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "LPC17xx.h"
+#include "lpc17xx_can.h"
+#include "lpc17xx_pinsel.h"
+#include "cangroup.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define CANGROUP_CAN        LPC_CAN1
+#define CANGROUP_CTRL       CAN1_CTRL
+#define RX_MASK             (CANGROUP_RX_SIZE - 1U)
+#define TX_MASK             (CANGROUP_TX_SIZE - 1U)
+
+#define SR_RBS              (1U << 0)   /* receive buffer full */
+#define SR_TBS1             (1U << 2)   /* TX buffer 1 free */
+#define SR_TCS1             (1U << 3)   /* TX buffer 1 sent */
+
+#define SELFTEST_DATA_A     0x5AA5C33CU
+#define SELFTEST_DATA_B     0x0FF0E11EU
+
+typedef struct
+{
+    uint8_t first;
+    uint8_t last;
+} range_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint32_t (*getMs)(void) = NULL;
+static range_t ranges[CANGROUP_MAX_RANGES];
+static uint32_t rangeCount = 0U;
+
+static cangroup_frame_t rxQueue[CANGROUP_RX_SIZE];
+static CAN_MSG_Type txQueue[CANGROUP_TX_SIZE];
+static volatile uint32_t rxHead = 0U;       /* written by the interrupt only */
+static volatile uint32_t rxTail = 0U;       /* written by cangroup_receive only */
+static volatile uint32_t txHead = 0U;       /* written by cangroup_send only */
+static volatile uint32_t txTail = 0U;       /* written with interrupts masked only */
+static cangroup_stats_t stats;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Writes the joined ranges to the acceptance filter.
+ *  @param list		const range_t*,
+ *             		ranges, ascending and apart.
+ *  @param count	uint32_t,
+ *             		number of ranges, 0 drops every frame.
+ *  @returns  		TRUE if the table was accepted.
+ *  @side effects:	No frame is accepted while the table is written.
+ */
+static Bool loadTable(const range_t *list, uint32_t count) {
+    SFF_GPR_Entry entries[CANGROUP_MAX_RANGES];
+    AF_SectionDef section = {NULL, 0U, NULL, 0U, NULL, 0U, NULL, 0U, NULL, 0U};
+    uint32_t i;
+
+    for (i = 0U; i < count; i++) {
+        entries[i].controller1 = CANGROUP_CTRL;
+        entries[i].disable1 = MSG_ENABLE;
+        entries[i].lowerID = (uint16_t)(CANGROUP_ID_BASE + list[i].first);
+        entries[i].controller2 = CANGROUP_CTRL;
+        entries[i].disable2 = MSG_ENABLE;
+        entries[i].upperID = (uint16_t)(CANGROUP_ID_BASE + list[i].last);
+    }
+    if (count != 0U) {
+        section.SFF_GPR_Sec = entries;
+        section.SFF_GPR_NumEntry = (uint8_t)count;
+    }
+    return (Bool)(CAN_SetupAFLUT(LPC_CANAF, &section) == CAN_OK);
+}
+
+/*!
+ *  @brief    		Hands queued frames to TX buffer 1 while it is free.
+ *  @returns
+ *  @side effects:	Call with interrupts masked or from the interrupt.
+ */
+static void txPump(void) {
+    while ((txTail != txHead) && ((CANGROUP_CAN->SR & SR_TBS1) != 0U)) {
+        if (CAN_SendMsg(CANGROUP_CAN, &txQueue[txTail & TX_MASK]) != SUCCESS) {
+            break;
+        }
+        txTail++;
+        stats.txFrames++;
+    }
+}
+
+/*!
+ *  @brief    		Sends one frame to itself in self test mode.
+ *  @param group	uint8_t,
+ *             		group of the frame.
+ *  @param accepted	Bool,
+ *             		TRUE if the filter must let it through.
+ *  @returns  		TRUE if the frame came back unchanged, or was dropped when not accepted.
+ *  @side effects:	Waits up to CANGROUP_SELFTEST_MS.
+ */
+static Bool loopback(uint8_t group, Bool accepted) {
+    CAN_MSG_Type msg;
+    uint32_t start;
+    Bool received = FALSE;
+    Bool output = FALSE;
+
+    if ((CANGROUP_CAN->SR & SR_TBS1) == 0U) {
+        return FALSE;
+    }
+    /* A self reception request instead of CAN_SendMsg's transmission request */
+    CANGROUP_CAN->TFI1 = (8U << 16);
+    CANGROUP_CAN->TID1 = CANGROUP_ID_BASE + group;
+    CANGROUP_CAN->TDA1 = SELFTEST_DATA_A;
+    CANGROUP_CAN->TDB1 = SELFTEST_DATA_B;
+    CANGROUP_CAN->CMR = CAN_CMR_SRR | CAN_CMR_STB1;
+
+    start = getMs();
+    while (((CANGROUP_CAN->SR & SR_TCS1) == 0U) || (!received && ((getMs() - start) < CANGROUP_SELFTEST_MS))) {
+        if ((getMs() - start) >= CANGROUP_SELFTEST_MS) {
+            return FALSE;           /* not even sent */
+        }
+        if ((CANGROUP_CAN->SR & SR_RBS) != 0U) {
+            received = TRUE;
+            if (CAN_ReceiveMsg(CANGROUP_CAN, &msg) == SUCCESS) {
+                output = (Bool)((msg.id == (CANGROUP_ID_BASE + group)) && (msg.len == 8U)
+                        && (msg.format == STD_ID_FORMAT) && (msg.type == DATA_FRAME)
+                        && (msg.dataA[0] == (uint8_t)SELFTEST_DATA_A)
+                        && (msg.dataA[3] == (uint8_t)(SELFTEST_DATA_A >> 24))
+                        && (msg.dataB[0] == (uint8_t)SELFTEST_DATA_B)
+                        && (msg.dataB[3] == (uint8_t)(SELFTEST_DATA_B >> 24)));
+            }
+        }
+    }
+    return accepted ? output : (Bool)!received;
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Opens CAN1 with empty queues and no group joined.
+ *  @param getMs	uint32_t (*)(void),
+ *             		millisecond counter, for the self test.
+ *  @returns
+ *  @side effects:	Takes CAN1, pins P0.21, P0.22 and the acceptance filter.
+ */
+void cangroup_init(uint32_t (*newGetMs)(void)) {
+    PINSEL_CFG_Type pinCfg;
+    uint8_t *p = (uint8_t *)&stats;
+    uint32_t i;
+
+    NVIC_DisableIRQ(CAN_IRQn);
+    getMs = newGetMs;
+    rxHead = 0U;
+    rxTail = 0U;
+    txHead = 0U;
+    txTail = 0U;
+    rangeCount = 0U;
+    for (i = 0U; i < sizeof(stats); i++) {
+        p[i] = 0U;
+    }
+
+    pinCfg.Funcnum = 3;
+    pinCfg.OpenDrain = 0;
+    pinCfg.Pinmode = 0;
+    pinCfg.Portnum = 0;
+    pinCfg.Pinnum = 21;
+    PINSEL_ConfigPin(&pinCfg);
+    pinCfg.Pinnum = 22;
+    PINSEL_ConfigPin(&pinCfg);
+
+    CAN_Init(CANGROUP_CAN, CANGROUP_BAUD);
+    (void)loadTable(ranges, 0U);
+
+    CAN_IRQCmd(CANGROUP_CAN, CANINT_RIE, ENABLE);
+    CAN_IRQCmd(CANGROUP_CAN, CANINT_TIE1, ENABLE);
+    CAN_IRQCmd(CANGROUP_CAN, CANINT_DOIE, ENABLE);
+    CAN_IRQCmd(CANGROUP_CAN, CANINT_BEIE, ENABLE);
+    NVIC_EnableIRQ(CAN_IRQn);
+}
+
+/*!
+ *  @brief    		Checks the controller and the acceptance filter in self test mode.
+ *  @returns  		TRUE if passed.
+ *  @side effects:	Waits up to 2 x CANGROUP_SELFTEST_MS; call with an empty TX queue.
+ *             		Sends two CANGROUP_TEST frames on the bus.
+ */
+Bool cangroup_selfTest(void) {
+    const range_t testRange = {CANGROUP_TEST, CANGROUP_TEST};
+    Bool output = FALSE;
+
+    NVIC_DisableIRQ(CAN_IRQn);
+    if (loadTable(&testRange, 1U)) {
+        CAN_ModeConfig(CANGROUP_CAN, CAN_SELFTEST_MODE, ENABLE);
+        output = (Bool)(loopback(CANGROUP_TEST, TRUE) && loopback(CANGROUP_TEST + 1U, FALSE));
+        CAN_ModeConfig(CANGROUP_CAN, CAN_SELFTEST_MODE, DISABLE);
+    }
+    (void)loadTable(ranges, rangeCount);
+    (void)CAN_IntGetStatus(CANGROUP_CAN);       /* TX interrupt of the test frames */
+    NVIC_EnableIRQ(CAN_IRQn);
+    return output;
+}
+
+/*!
+ *  @brief    		Joins the groups first..last.
+ *  @param first	uint8_t,
+ *             		first group.
+ *  @param last		uint8_t,
+ *             		last group, >= first.
+ *  @returns  		TRUE if joined, FALSE if more than CANGROUP_MAX_RANGES apart ranges.
+ *  @side effects:	Rewrites the acceptance filter.
+ */
+Bool cangroup_join(uint8_t first, uint8_t last) {
+    range_t list[CANGROUP_MAX_RANGES + 1U];
+    range_t merged[CANGROUP_MAX_RANGES + 1U];
+    uint32_t count = 0U;
+    uint32_t i;
+
+    if (first > last) {
+        return FALSE;
+    }
+    /* Insert in order of first group */
+    i = rangeCount;
+    while ((i != 0U) && (ranges[i - 1U].first > first)) {
+        list[i] = ranges[i - 1U];
+        i--;
+    }
+    list[i].first = first;
+    list[i].last = last;
+    while (i != 0U) {
+        i--;
+        list[i] = ranges[i];
+    }
+    /* Merge what overlaps or touches */
+    for (i = 0U; i <= rangeCount; i++) {
+        if ((count != 0U) && ((uint32_t)list[i].first <= ((uint32_t)merged[count - 1U].last + 1U))) {
+            if (list[i].last > merged[count - 1U].last) {
+                merged[count - 1U].last = list[i].last;
+            }
+        } else {
+            merged[count] = list[i];
+            count++;
+        }
+    }
+    if ((count > CANGROUP_MAX_RANGES) || !loadTable(merged, count)) {
+        (void)loadTable(ranges, rangeCount);
+        return FALSE;
+    }
+    for (i = 0U; i < count; i++) {
+        ranges[i] = merged[i];
+    }
+    rangeCount = count;
+    return TRUE;
+}
+
+/*!
+ *  @brief    		Leaves every group.
+ *  @returns
+ *  @side effects:	Rewrites the acceptance filter.
+ */
+void cangroup_leaveAll(void) {
+    rangeCount = 0U;
+    (void)loadTable(ranges, 0U);
+}
+
+/*!
+ *  @brief    		Tells if a group was joined.
+ *  @param group	uint8_t,
+ *             		group.
+ *  @returns  		TRUE if the controller is a member.
+ *  @side effects:	None.
+ */
+Bool cangroup_isMember(uint8_t group) {
+    uint32_t i;
+
+    for (i = 0U; i < rangeCount; i++) {
+        if ((group >= ranges[i].first) && (group <= ranges[i].last)) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/*!
+ *  @brief    		Queues a frame to a group, never waits.
+ *  @param group	uint8_t,
+ *             		destination group.
+ *  @param data		const uint8_t*,
+ *             		payload.
+ *  @param len		uint8_t,
+ *             		payload length, up to 8.
+ *  @returns  		TRUE if queued, FALSE if the queue is full or len too big.
+ *  @side effects:	None.
+ */
+Bool cangroup_send(uint8_t group, const uint8_t *data, uint8_t len) {
+    CAN_MSG_Type *msg;
+    uint32_t primask;
+    uint8_t i;
+
+    if ((len > 8U) || ((txHead - txTail) >= CANGROUP_TX_SIZE)) {
+        stats.txDropped++;
+        return FALSE;
+    }
+    msg = &txQueue[txHead & TX_MASK];
+    msg->id = CANGROUP_ID_BASE + group;
+    msg->len = len;
+    msg->format = STD_ID_FORMAT;
+    msg->type = DATA_FRAME;
+    for (i = 0U; i < 8U; i++) {
+        if (i < 4U) {
+            msg->dataA[i] = (i < len) ? data[i] : 0U;
+        } else {
+            msg->dataB[i - 4U] = (i < len) ? data[i] : 0U;
+        }
+    }
+    __DMB();
+    txHead++;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    txPump();
+    __set_PRIMASK(primask);
+    return TRUE;
+}
+
+/*!
+ *  @brief    		Takes the oldest received frame.
+ *  @param frame	cangroup_frame_t*,
+ *             		destination.
+ *  @returns  		TRUE if a frame was taken, FALSE if none waits.
+ *  @side effects:	None.
+ */
+Bool cangroup_receive(cangroup_frame_t *frame) {
+    if (rxTail == rxHead) {
+        return FALSE;
+    }
+    *frame = rxQueue[rxTail & RX_MASK];
+    __DMB();
+    rxTail++;
+    return TRUE;
+}
+
+/*!
+ *  @brief    		Copies the counters.
+ *  @param out		cangroup_stats_t*,
+ *             		destination.
+ *  @returns
+ *  @side effects:	None.
+ */
+void cangroup_getStats(cangroup_stats_t *out) {
+    *out = stats;
+}
+
+/*!
+ *  @brief    		CAN interrupt: queues received frames, feeds the TX buffer.
+ *  @returns
+ *  @side effects:	Call from CAN_IRQHandler.
+ */
+void cangroup_intHandler(void) {
+    CAN_MSG_Type msg;
+    cangroup_frame_t *frame;
+    uint32_t icr = CAN_IntGetStatus(CANGROUP_CAN);     /* reading clears all but RI */
+    uint8_t i;
+
+    while ((CANGROUP_CAN->SR & SR_RBS) != 0U) {
+        if (CAN_ReceiveMsg(CANGROUP_CAN, &msg) != SUCCESS) {
+            break;
+        }
+        if ((msg.type != DATA_FRAME) || (msg.format != STD_ID_FORMAT) || (msg.id < CANGROUP_ID_BASE)) {
+            continue;
+        }
+        if ((rxHead - rxTail) >= CANGROUP_RX_SIZE) {
+            stats.rxDropped++;
+            continue;
+        }
+        frame = &rxQueue[rxHead & RX_MASK];
+        frame->group = (uint8_t)(msg.id - CANGROUP_ID_BASE);
+        frame->len = (msg.len > 8U) ? 8U : msg.len;
+        for (i = 0U; i < 4U; i++) {
+            frame->data[i] = msg.dataA[i];
+            frame->data[i + 4U] = msg.dataB[i];
+        }
+        __DMB();
+        rxHead++;
+        stats.rxFrames++;
+    }
+    if ((icr & CAN_ICR_DOI) != 0U) {
+        stats.rxDropped++;
+        CAN_SetCommand(CANGROUP_CAN, CAN_CMR_CDO);
+    }
+    if ((icr & CAN_ICR_BEI) != 0U) {
+        stats.busErrors++;
+    }
+    txPump();
+}
@@ -0,0 +1,56 @@
+/*****************************************************************************
+ *   cangroup.h:  Header file for the CAN group messages between controllers
+ *
+******************************************************************************/
+#ifndef __CANGROUP_H
+#define __CANGROUP_H
+
+#include "lpc_types.h"
+
+/* CAN1 on P0.21 (RD1) and P0.22 (TD1), away from UART0 and UART3 */
+#define CANGROUP_BAUD           125000U
+
+/* Group g is sent with the standard identifier CANGROUP_ID_BASE + g */
+#define CANGROUP_ID_BASE        0x100U
+#define CANGROUP_ALL            0U      /* group every controller joins */
+#define CANGROUP_DEFAULT        1U      /* own group until configured */
+#define CANGROUP_TEST           0xFEU   /* groups of cangroup_selfTest, nobody joins them */
+#define CANGROUP_MAX_RANGES     4U      /* joined group ranges */
+
+/* Frame queues, powers of 2 */
+#define CANGROUP_RX_SIZE        8U
+#define CANGROUP_TX_SIZE        8U
+
+#define CANGROUP_SELFTEST_MS    10U
+
+typedef struct
+{
+    uint8_t group;
+    uint8_t len;                /* 0..8 */
+    uint8_t data[8];
+} cangroup_frame_t;
+
+typedef struct
+{
+    uint32_t rxFrames;          /* frames of joined groups */
+    uint32_t rxDropped;         /* RX queue full or controller overrun */
+    uint32_t txFrames;
+    uint32_t txDropped;         /* TX queue full */
+    uint32_t busErrors;
+} cangroup_stats_t;
+
+void cangroup_init(uint32_t (*getMs)(void));
+Bool cangroup_selfTest(void);
+Bool cangroup_join(uint8_t first, uint8_t last);
+void cangroup_leaveAll(void);
+Bool cangroup_isMember(uint8_t group);
+Bool cangroup_send(uint8_t group, const uint8_t *data, uint8_t len);
+Bool cangroup_receive(cangroup_frame_t *frame);
+void cangroup_getStats(cangroup_stats_t *stats);
+void cangroup_intHandler(void);
+
+
+#endif /* end __CANGROUP_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
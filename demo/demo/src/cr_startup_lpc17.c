@@ -48,6 +48,7 @@ extern "C" {
 #if defined (__USE_CMSIS)
 #include "system_LPC17xx.h"
 #endif
+#include "stackmon.h"
 
 //*****************************************************************************
 #if defined (__cplusplus)
@@ -206,16 +207,18 @@ void (* const g_pfnVectors[])(void) = {
 
 //*****************************************************************************
 //
-// The following are constructs created by the linker, indicating where the
-// the "data" and "bss" segments reside in memory.  The initializers for the
-// for the "data" segment resides immediately following the "text" segment.
+// The following are constructs created by the linker. The section table
+// lists the load address, address and size of every "data" section (.data
+// in RamLoc32, .data_RAM2 in RamAHB32, both including the .ramfunc code
+// of __RAMFUNC/__RAMFUNC_AHB) and the address and size of every "bss"
+// section.
 //
 //*****************************************************************************
-extern unsigned long _etext;
-extern unsigned long _data;
-extern unsigned long _edata;
-extern unsigned long _bss;
-extern unsigned long _ebss;
+extern unsigned long __data_section_table;
+extern unsigned long __data_section_table_end;
+extern unsigned long __bss_section_table;
+extern unsigned long __bss_section_table_end;
+extern unsigned long _pvHeapStart;
 
 //*****************************************************************************
 // Reset entry point for your code.
@@ -225,30 +228,56 @@ extern unsigned long _ebss;
 //*****************************************************************************
 void
 ResetISR(void) {
-    unsigned long *pulSrc, *pulDest;
+    unsigned long *pulSrc, *pulDest, *pulEnd;
+    unsigned long *pulTable;
+    unsigned long *pulStackBottom;
 
     //
-    // Copy the data segment initializers from flash to SRAM.
+    // Copy the data sections (initialized data and SRAM functions) from
+    // flash to SRAM. Nothing placed in SRAM may run before this.
     //
-    pulSrc = &_etext;
-    for(pulDest = &_data; pulDest < &_edata; )
+    for(pulTable = &__data_section_table; pulTable < &__data_section_table_end; pulTable += 3)
     {
-        *pulDest++ = *pulSrc++;
+        pulSrc = (unsigned long *)pulTable[0];
+        pulDest = (unsigned long *)pulTable[1];
+        pulEnd = (unsigned long *)(pulTable[1] + pulTable[2]);
+        while (pulDest < pulEnd)
+        {
+            *pulDest++ = *pulSrc++;
+        }
     }
 
     //
-    // Zero fill the bss segment.  This is done with inline assembly since this
-    // will clear the value of pulDest if it is not kept in a register.
+    // Zero fill the bss sections.
     //
-    __asm("    ldr     r0, =_bss\n"
-          "    ldr     r1, =_ebss\n"
-          "    mov     r2, #0\n"
-          "    .thumb_func\n"
-          "zero_loop:\n"
-          "        cmp     r0, r1\n"
-          "        it      lt\n"
-          "        strlt   r2, [r0], #4\n"
-          "        blt     zero_loop");
+    for(pulTable = &__bss_section_table; pulTable < &__bss_section_table_end; pulTable += 2)
+    {
+        pulDest = (unsigned long *)pulTable[0];
+        pulEnd = (unsigned long *)(pulTable[0] + pulTable[1]);
+        while (pulDest < pulEnd)
+        {
+            *pulDest++ = 0;
+        }
+    }
+
+    //
+    // Paint the stack reservation up to just below this frame for
+    // stackmon_used(). The ASSERT of the linker script fails the link when
+    // the data reaches into the reservation; the check here only catches a
+    // STACK_SIZE given with -D that the link did not see.
+    //
+    pulStackBottom = (unsigned long *)((unsigned long)&_vStackTop - STACK_SIZE);
+    if (&_pvHeapStart > pulStackBottom)
+    {
+        while (1)
+        {
+        }
+    }
+    __asm volatile ("mov %0, sp" : "=r" (pulSrc));
+    for(pulDest = pulStackBottom; pulDest < (pulSrc - 8); )
+    {
+        *pulDest++ = STACK_PAINT;
+    }
 
 #ifdef __USE_CMSIS
 	SystemInit();
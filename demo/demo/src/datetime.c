@@ -0,0 +1,412 @@
+/*****************************************************************************
+ *   datetime.c:  Calendar arithmetic on RTC date/time
+ *
+ ******************************************************************************/
+
+/*
+ * Dates are converted to and from a 32-bit count of seconds since
+ * 2000-01-01 00:00:00 (the first year the date editor accepts). The whole
+ * DATETIME_YEAR_MIN..DATETIME_YEAR_MAX span fits in an uint32_t, so all
+ * arithmetic is done on that value and wraps around at the span ends.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "lpc17xx_rtc.h"
+#include "datetime.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define SEC_PER_HOUR    3600UL
+#define SEC_PER_MIN     60UL
+
+/* 2000-01-01 was a Saturday */
+#define EPOCH_DOW       6U
+
+/* Days from 2000-01-01 up to 2100-01-01 */
+#define SPAN_DAYS       36525UL
+#define SPAN_SECONDS    (SPAN_DAYS * DATETIME_SEC_PER_DAY)
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+/* Days before the first of each month in a non-leap year, [12] = year length */
+static const uint16_t daysBeforeMonth[13] = {
+        0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365
+};
+
+/******************************************************************************
+ * Public variables
+ *****************************************************************************/
+
+/* Central European Time: last Sunday of March to last Sunday of October */
+const datetime_dst_t datetime_dstEU = {
+        {3U, 5U, 0U, 2U},
+        {10U, 5U, 0U, 2U},
+        SEC_PER_HOUR
+};
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Number of days between 2000-01-01 and January 1st of given year.
+ *  @param year		uint16_t,
+ *             		year, not lower than DATETIME_YEAR_MIN.
+ *  @returns  		Day count.
+ *  @side effects:	None.
+ */
+static uint32_t daysBeforeYear(uint16_t year) {
+    uint32_t n = (uint32_t)year - DATETIME_YEAR_MIN;
+    /* DATETIME_YEAR_MIN is itself a leap year divisible by 400 */
+    return (n * 365U) + ((n + 3U) / 4U) - ((n + 99U) / 100U) + ((n + 399U) / 400U);
+}
+
+/*!
+ *  @brief    		Number of days between 2000-01-01 and given date.
+ *  @returns  		Day count.
+ *  @side effects:	None.
+ */
+static uint32_t daysSinceEpoch(uint16_t year, uint8_t month, uint8_t dom) {
+    return daysBeforeYear(year) + (uint32_t)datetime_dayOfYear(year, month, dom) - 1U;
+}
+
+/*!
+ *  @brief    		Wraps value into [min, max] range.
+ *  @returns  		Wrapped value.
+ *  @side effects:	None.
+ */
+static int32_t wrap(int32_t value, int32_t min, int32_t max) {
+    int32_t span = (max - min) + 1;
+    int32_t out = (value - min) % span;
+    if (out < 0) {
+        out += span;
+    }
+    return out + min;
+}
+
+/*!
+ *  @brief    		Day of month on which a DST rule switches in given year.
+ *  @returns  		Day of month.
+ *  @side effects:	None.
+ */
+static uint8_t ruleDay(uint16_t year, const datetime_rule_t *rule) {
+    uint8_t first = datetime_dayOfWeek(year, rule->month, 1U);
+    uint8_t day = (uint8_t)(1U + ((7U + rule->dow - first) % 7U));
+    uint8_t dim = datetime_daysInMonth(year, rule->month);
+
+    day += (uint8_t)(7U * (rule->week - 1U));
+    while (day > dim) {
+        day -= 7U;
+    }
+    return day;
+}
+
+/*!
+ *  @brief    		Epoch seconds at which a DST rule switches in given year.
+ *  @returns  		Epoch seconds.
+ *  @side effects:	None.
+ */
+static uint32_t ruleEpoch(uint16_t year, const datetime_rule_t *rule) {
+    uint32_t days = daysSinceEpoch(year, rule->month, ruleDay(year, rule));
+    return (days * DATETIME_SEC_PER_DAY) + ((uint32_t)rule->hour * SEC_PER_HOUR);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Returns whether year is a leap year,
+ *					Example: 2000 is leap, 2001 is not leap, 1900 is not leap, 1600 is leap.
+ *  @param year		uint16_t,
+ *             		year to check.
+ *  @returns  		TRUE - if is leap, FALSE - otherwise.
+ *  @side effects:	None.
+ */
+Bool datetime_isLeap(uint16_t year) {
+    Bool leap = FALSE;
+    if ((year % 400U) == 0U) { leap = TRUE; }
+    else if ((year % 100U) == 0U) { leap = FALSE; }
+    else if ((year % 4U) == 0U) { leap = TRUE; }
+    else { leap = FALSE; }
+    return leap;
+}
+
+/*!
+ *  @brief    		Returns number of days in a month.
+ *  @param year		uint16_t,
+ *             		year the month belongs to.
+ *  @param month	uint8_t,
+ *             		month, 1..12.
+ *  @returns  		28..31.
+ *  @side effects:	None.
+ */
+uint8_t datetime_daysInMonth(uint16_t year, uint8_t month) {
+    uint8_t days = (uint8_t)(daysBeforeMonth[month] - daysBeforeMonth[month - 1U]);
+    if ((month == 2U) && datetime_isLeap(year)) {
+        days++;
+    }
+    return days;
+}
+
+/*!
+ *  @brief    		Returns day of week of a date.
+ *  @returns  		0..6, 0 - Sunday.
+ *  @side effects:	None.
+ */
+uint8_t datetime_dayOfWeek(uint16_t year, uint8_t month, uint8_t dom) {
+    return (uint8_t)((daysSinceEpoch(year, month, dom) + EPOCH_DOW) % 7U);
+}
+
+/*!
+ *  @brief    		Returns day of year of a date.
+ *  @returns  		1..366.
+ *  @side effects:	None.
+ */
+uint16_t datetime_dayOfYear(uint16_t year, uint8_t month, uint8_t dom) {
+    uint16_t doy = daysBeforeMonth[month - 1U] + dom;
+    if ((month > 2U) && datetime_isLeap(year)) {
+        doy++;
+    }
+    return doy;
+}
+
+/*!
+ *  @brief    		Converts date/time to seconds since 2000-01-01 00:00:00.
+ *  @param dt		const datetime_t*,
+ *             		date/time to convert, dow and doy are ignored.
+ *  @returns  		Epoch seconds.
+ *  @side effects:	None.
+ */
+uint32_t datetime_toEpoch(const datetime_t *dt) {
+    uint32_t days = daysSinceEpoch(dt->year, dt->month, dt->dom);
+    return (days * DATETIME_SEC_PER_DAY) + ((uint32_t)dt->hour * SEC_PER_HOUR)
+            + ((uint32_t)dt->min * SEC_PER_MIN) + dt->sec;
+}
+
+/*!
+ *  @brief    		Converts seconds since 2000-01-01 00:00:00 to date/time.
+ *  @param epoch	uint32_t,
+ *             		epoch seconds.
+ *  @param dt		datetime_t*,
+ *             		output, all fields including dow and doy are filled in.
+ *  @side effects:	None.
+ */
+void datetime_fromEpoch(uint32_t epoch, datetime_t *dt) {
+    uint32_t days = epoch / DATETIME_SEC_PER_DAY;
+    uint32_t rem = epoch % DATETIME_SEC_PER_DAY;
+    uint16_t year = (uint16_t)(DATETIME_YEAR_MIN + (days / 365U));
+    uint8_t month = 1U;
+
+    dt->hour = (uint8_t)(rem / SEC_PER_HOUR);
+    rem = rem % SEC_PER_HOUR;
+    dt->min = (uint8_t)(rem / SEC_PER_MIN);
+    dt->sec = (uint8_t)(rem % SEC_PER_MIN);
+    dt->dow = (uint8_t)((days + EPOCH_DOW) % 7U);
+
+    /* days / 365 never underestimates the year, step back at most twice */
+    while (daysBeforeYear(year) > days) {
+        year--;
+    }
+    days -= daysBeforeYear(year);
+    dt->year = year;
+    dt->doy = (uint16_t)(days + 1U);
+
+    if (datetime_isLeap(year) && (days >= daysBeforeMonth[2])) {
+        if (days == daysBeforeMonth[2]) {
+            /* February 29th */
+            dt->month = 2U;
+            dt->dom = 29U;
+            return;
+        }
+        days--;
+    }
+    while (days >= daysBeforeMonth[month]) {
+        month++;
+    }
+    dt->month = month;
+    dt->dom = (uint8_t)(days - daysBeforeMonth[month - 1U] + 1U);
+}
+
+/*!
+ *  @brief    		Clamps day of month to the length of the month and
+ *					recomputes day of week and day of year.
+ *  @param dt		datetime_t*,
+ *             		date/time to normalize.
+ *  @side effects:	None.
+ */
+void datetime_normalize(datetime_t *dt) {
+    uint8_t dim;
+    if (dt->year < DATETIME_YEAR_MIN) { dt->year = DATETIME_YEAR_MIN; }
+    else if (dt->year > DATETIME_YEAR_MAX) { dt->year = DATETIME_YEAR_MAX; }
+    else {}
+    if (dt->month < 1U) { dt->month = 1U; }
+    else if (dt->month > 12U) { dt->month = 12U; }
+    else {}
+    dim = datetime_daysInMonth(dt->year, dt->month);
+    if (dt->dom > dim) { dt->dom = dim; }
+    else if (dt->dom < 1U) { dt->dom = 1U; }
+    else {}
+    dt->dow = datetime_dayOfWeek(dt->year, dt->month, dt->dom);
+    dt->doy = datetime_dayOfYear(dt->year, dt->month, dt->dom);
+}
+
+/*!
+ *  @brief    		Returns a single field of date/time.
+ *  @returns  		Field value.
+ *  @side effects:	None.
+ */
+uint16_t datetime_getField(const datetime_t *dt, datetime_field_t field) {
+    uint16_t value;
+    switch (field) {
+        case DATETIME_YEAR:
+            value = dt->year;
+            break;
+        case DATETIME_MONTH:
+            value = dt->month;
+            break;
+        case DATETIME_DOM:
+            value = dt->dom;
+            break;
+        case DATETIME_HOUR:
+            value = dt->hour;
+            break;
+        case DATETIME_MIN:
+            value = dt->min;
+            break;
+        default:
+            value = dt->sec;
+            break;
+    }
+    return value;
+}
+
+/*!
+ *  @brief    		Adds delta to a single field, wrapping around within the
+ *					field range without carrying into other fields (as the date
+ *					editor does). Day of month is clamped when year or month changes.
+ *  @param dt		datetime_t*,
+ *             		date/time to modify.
+ *  @param field	datetime_field_t,
+ *             		field to change.
+ *  @param delta	int32_t,
+ *             		value to add, may be negative.
+ *  @side effects:	None.
+ */
+void datetime_addField(datetime_t *dt, datetime_field_t field, int32_t delta) {
+    switch (field) {
+        case DATETIME_YEAR:
+            dt->year = (uint16_t)wrap((int32_t)dt->year + delta,
+                    (int32_t)DATETIME_YEAR_MIN, (int32_t)DATETIME_YEAR_MAX);
+            break;
+        case DATETIME_MONTH:
+            dt->month = (uint8_t)wrap((int32_t)dt->month + delta, 1, 12);
+            break;
+        case DATETIME_DOM:
+            dt->dom = (uint8_t)wrap((int32_t)dt->dom + delta, 1,
+                    (int32_t)datetime_daysInMonth(dt->year, dt->month));
+            break;
+        case DATETIME_HOUR:
+            dt->hour = (uint8_t)wrap((int32_t)dt->hour + delta, 0, 23);
+            break;
+        case DATETIME_MIN:
+            dt->min = (uint8_t)wrap((int32_t)dt->min + delta, 0, 59);
+            break;
+        default:
+            dt->sec = (uint8_t)wrap((int32_t)dt->sec + delta, 0, 59);
+            break;
+    }
+    datetime_normalize(dt);
+}
+
+/*!
+ *  @brief    		Adds seconds to date/time, carrying into all fields.
+ *					Wraps around between DATETIME_YEAR_MAX and DATETIME_YEAR_MIN.
+ *  @param dt		datetime_t*,
+ *             		date/time to modify.
+ *  @param seconds	int32_t,
+ *             		seconds to add, may be negative.
+ *  @side effects:	None.
+ */
+void datetime_addSeconds(datetime_t *dt, int32_t seconds) {
+    uint32_t epoch = datetime_toEpoch(dt);
+    if (seconds < 0) {
+        uint32_t sub = ((uint32_t)(-(seconds + 1)) + 1U) % SPAN_SECONDS;
+        epoch = (epoch >= sub) ? (epoch - sub) : (SPAN_SECONDS - (sub - epoch));
+    } else {
+        epoch = (epoch + ((uint32_t)seconds % SPAN_SECONDS)) % SPAN_SECONDS;
+    }
+    datetime_fromEpoch(epoch, dt);
+}
+
+/*!
+ *  @brief    		Returns daylight saving offset in effect at given local standard time.
+ *  @param dt		const datetime_t*,
+ *             		local standard time.
+ *  @param rule		const datetime_dst_t*,
+ *             		DST rule, e.g. &datetime_dstEU.
+ *  @returns  		rule->offset when DST is in effect, 0 otherwise.
+ *  @side effects:	None.
+ */
+uint32_t datetime_dstOffset(const datetime_t *dt, const datetime_dst_t *rule) {
+    uint32_t now = datetime_toEpoch(dt);
+    uint32_t start = ruleEpoch(dt->year, &rule->start);
+    uint32_t end = ruleEpoch(dt->year, &rule->end);
+    Bool dst;
+
+    if (start <= end) {
+        dst = (Bool)((now >= start) && (now < end));
+    } else {
+        /* southern hemisphere, DST spans the new year */
+        dst = (Bool)((now >= start) || (now < end));
+    }
+    return dst ? rule->offset : 0U;
+}
+
+/*!
+ *  @brief    		Reads date/time from the RTC.
+ *  @param dt		datetime_t*,
+ *             		output.
+ *  @side effects:	LPC_RTC has to be initialised prior to running this function.
+ *					Goes through RTC_GetSnapshot, so all callers within the same
+ *					second share one coherent copy of the counters.
+ */
+void datetime_readRtc(datetime_t *dt) {
+    RTC_SNAPSHOT_Type snap;
+    RTC_GetSnapshot(LPC_RTC, &snap);
+
+    dt->year = snap.YEAR;
+    dt->month = snap.MONTH;
+    dt->dom = snap.DOM;
+    dt->hour = snap.HOUR;
+    dt->min = snap.MIN;
+    dt->sec = snap.SEC;
+    dt->dow = snap.DOW;
+    dt->doy = snap.DOY;
+}
+
+/*!
+ *  @brief    		Writes date/time to the RTC, including day of week and day of year.
+ *  @param dt		const datetime_t*,
+ *             		date/time to write, expected to be normalized.
+ *  @side effects:	LPC_RTC has to be initialised prior to running this function.
+ */
+void datetime_writeRtc(const datetime_t *dt) {
+    RTC_TIME_Type full;
+    full.YEAR = dt->year;
+    full.MONTH = dt->month;
+    full.DOM = dt->dom;
+    full.DOW = dt->dow;
+    full.DOY = dt->doy;
+    full.HOUR = dt->hour;
+    full.MIN = dt->min;
+    full.SEC = dt->sec;
+    RTC_SetFullTime(LPC_RTC, &full);
+}
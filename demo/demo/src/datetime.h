@@ -0,0 +1,79 @@
+/*****************************************************************************
+ *   datetime.h:  Header file for calendar arithmetic on RTC date/time
+ *
+******************************************************************************/
+#ifndef __DATETIME_H
+#define __DATETIME_H
+
+#include "lpc_types.h"
+
+/* Range of years handled by the calendar (and the date editor) */
+#define DATETIME_YEAR_MIN   2000U
+#define DATETIME_YEAR_MAX   2099U
+
+#define DATETIME_SEC_PER_DAY 86400UL
+
+/* Fields in the order they are laid out on the date editor map */
+typedef enum
+{
+    DATETIME_YEAR,
+    DATETIME_MONTH,
+    DATETIME_DOM,
+    DATETIME_HOUR,
+    DATETIME_MIN,
+    DATETIME_SEC
+} datetime_field_t;
+
+typedef struct
+{
+    uint16_t year;  /* DATETIME_YEAR_MIN..DATETIME_YEAR_MAX */
+    uint8_t month;  /* 1..12 */
+    uint8_t dom;    /* 1..31 */
+    uint8_t hour;   /* 0..23 */
+    uint8_t min;    /* 0..59 */
+    uint8_t sec;    /* 0..59 */
+    uint8_t dow;    /* 0..6, 0 - Sunday */
+    uint16_t doy;   /* 1..366 */
+} datetime_t;
+
+/* Daylight saving switch, e.g. "last Sunday of March at 2:00" */
+typedef struct
+{
+    uint8_t month;  /* 1..12 */
+    uint8_t week;   /* 1..4 - n-th occurrence of dow, 5 - last one */
+    uint8_t dow;    /* 0..6, 0 - Sunday */
+    uint8_t hour;   /* local standard time of the switch */
+} datetime_rule_t;
+
+typedef struct
+{
+    datetime_rule_t start;
+    datetime_rule_t end;
+    uint32_t offset;    /* seconds added while DST is in effect */
+} datetime_dst_t;
+
+extern const datetime_dst_t datetime_dstEU;
+
+Bool datetime_isLeap(uint16_t year);
+uint8_t datetime_daysInMonth(uint16_t year, uint8_t month);
+uint8_t datetime_dayOfWeek(uint16_t year, uint8_t month, uint8_t dom);
+uint16_t datetime_dayOfYear(uint16_t year, uint8_t month, uint8_t dom);
+
+uint32_t datetime_toEpoch(const datetime_t *dt);
+void datetime_fromEpoch(uint32_t epoch, datetime_t *dt);
+
+void datetime_normalize(datetime_t *dt);
+uint16_t datetime_getField(const datetime_t *dt, datetime_field_t field);
+void datetime_addField(datetime_t *dt, datetime_field_t field, int32_t delta);
+void datetime_addSeconds(datetime_t *dt, int32_t seconds);
+
+uint32_t datetime_dstOffset(const datetime_t *dt, const datetime_dst_t *rule);
+
+void datetime_readRtc(datetime_t *dt);
+void datetime_writeRtc(const datetime_t *dt);
+
+
+#endif /* end __DATETIME_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
@@ -1,1337 +0,0 @@
-const unsigned char sound_down[16006] = {
-    0x52, 0x49, 0x46, 0x46, 0x7C, 0x3E, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45, 
-    0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 
-    0x40, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00,0x00,
-    0x64, 0x61, 0x74, 0x61, 0x58, 0x3E, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7D, 0x7C, 0x7B, 0x7B, 0x7C, 
-    0x7D, 0x7E, 0x7F, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 
-    0x83, 0x84, 0x85, 0x86, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8D, 0x8B, 0x89, 
-    0x86, 0x82, 0x80, 0x7B, 0x78, 0x76, 0x75, 0x75, 0x76, 0x79, 0x81, 0x88, 
-    0x95, 0xA1, 0x9B, 0x96, 0x93, 0x86, 0x76, 0x66, 0x4E, 0x35, 0x27, 0x20, 
-    0x18, 0x19, 0x22, 0x2C, 0x45, 0x65, 0x80, 0x9B, 0xB5, 0xC9, 0xDB, 0xEA, 
-    0xF0, 0xE9, 0xE1, 0xD4, 0xC3, 0xB2, 0x9F, 0x8B, 0x7C, 0x72, 0x6D, 0x6B, 
-    0x6C, 0x71, 0x78, 0x82, 0x8A, 0x91, 0x94, 0x93, 0x90, 0x8A, 0x80, 0x75, 
-    0x6A, 0x60, 0x58, 0x53, 0x51, 0x52, 0x56, 0x5D, 0x66, 0x6E, 0x77, 0x7E, 
-    0x85, 0x8B, 0x8C, 0x8C, 0x89, 0x84, 0x85, 0x7C, 0x7E, 0x77, 0x7B, 0x77, 
-    0x79, 0x7C, 0x80, 0x81, 0x87, 0x94, 0x97, 0xAF, 0xC8, 0xBB, 0xB7, 0xB8, 
-    0xA4, 0x95, 0x83, 0x60, 0x3C, 0x26, 0x1A, 0x07, 0x03, 0x04, 0x06, 0x1E, 
-    0x40, 0x5E, 0x7E, 0x9D, 0xB6, 0xD2, 0xEB, 0xFA, 0xFD, 0xF7, 0xEB, 0xDD, 
-    0xCB, 0xB2, 0x98, 0x7D, 0x69, 0x5E, 0x58, 0x53, 0x56, 0x5C, 0x66, 0x74, 
-    0x83, 0x88, 0x8E, 0x93, 0x92, 0x91, 0x8B, 0x7E, 0x74, 0x6A, 0x63, 0x5B, 
-    0x5B, 0x53, 0x5A, 0x5E, 0x5E, 0x65, 0x6A, 0x74, 0x77, 0x82, 0x7E, 0x83, 
-    0x82, 0x7E, 0x7C, 0x7C, 0x75, 0x73, 0x6F, 0x7E, 0x8A, 0xAC, 0xC3, 0xB7, 
-    0xC2, 0xCC, 0xC1, 0xBF, 0xAA, 0x81, 0x63, 0x4F, 0x3B, 0x24, 0x15, 0x06, 
-    0x03, 0x15, 0x2E, 0x44, 0x60, 0x7A, 0x96, 0xB8, 0xD7, 0xED, 0xF6, 0xFD, 
-    0xFD, 0xF4, 0xE7, 0xCF, 0xB3, 0x96, 0x81, 0x70, 0x63, 0x5E, 0x58, 0x50, 
-    0x5B, 0x62, 0x69, 0x6F, 0x74, 0x77, 0x7F, 0x87, 0x7C, 0x78, 0x73, 0x69, 
-    0x6E, 0x63, 0x62, 0x57, 0x68, 0x5D, 0x6F, 0x6C, 0x6E, 0x70, 0x7C, 0x77, 
-    0x84, 0x83, 0x7A, 0x85, 0x7D, 0x82, 0x7D, 0x81, 0x79, 0x7F, 0x88, 0x82, 
-    0x84, 0x97, 0x9C, 0xB9, 0xC7, 0xB8, 0xBC, 0xBE, 0xB0, 0xB2, 0x9E, 0x7B, 
-    0x64, 0x50, 0x3F, 0x2D, 0x1E, 0x0B, 0x03, 0x14, 0x2C, 0x42, 0x66, 0x73, 
-    0x8D, 0xAB, 0xCC, 0xD6, 0xE2, 0xE6, 0xE7, 0xEC, 0xE4, 0xD4, 0xC1, 0xAD, 
-    0x97, 0x91, 0x89, 0x6A, 0x6A, 0x59, 0x5E, 0x63, 0x58, 0x5D, 0x54, 0x63, 
-    0x64, 0x6A, 0x70, 0x62, 0x7A, 0x6B, 0x7C, 0x71, 0x73, 0x6C, 0x77, 0x6A, 
-    0x79, 0x6C, 0x76, 0x6E, 0x75, 0x73, 0x74, 0x7F, 0x6E, 0x8A, 0x76, 0x8A, 
-    0x83, 0x87, 0x8F, 0x82, 0x96, 0x84, 0x93, 0x82, 0x90, 0x91, 0x9C, 0xB0, 
-    0xB0, 0xA4, 0xAC, 0xA6, 0x9D, 0xA0, 0x8B, 0x70, 0x60, 0x4F, 0x40, 0x36, 
-    0x2D, 0x28, 0x30, 0x38, 0x51, 0x58, 0x78, 0x75, 0x93, 0xA0, 0xBA, 0xBC, 
-    0xC7, 0xC9, 0xCB, 0xD3, 0xC8, 0xC6, 0xA9, 0xAA, 0x96, 0x92, 0x8B, 0x74, 
-    0x72, 0x68, 0x66, 0x6D, 0x60, 0x65, 0x5D, 0x66, 0x6F, 0x69, 0x70, 0x63, 
-    0x75, 0x6F, 0x76, 0x6B, 0x75, 0x69, 0x73, 0x73, 0x76, 0x6E, 0x77, 0x73, 
-    0x76, 0x7D, 0x79, 0x7F, 0x7C, 0x8A, 0x7E, 0x8A, 0x86, 0x8C, 0x89, 0x8D, 
-    0x8A, 0x8A, 0x8F, 0x80, 0x8C, 0x85, 0x96, 0x9A, 0xBA, 0xA2, 0x9C, 0xA0, 
-    0x95, 0x92, 0x92, 0x72, 0x5C, 0x57, 0x48, 0x4D, 0x4C, 0x3A, 0x41, 0x42, 
-    0x62, 0x64, 0x70, 0x7C, 0x80, 0x98, 0xA7, 0xAC, 0xB7, 0xB3, 0xB9, 0xB5, 
-    0xBF, 0xBA, 0xB2, 0x9E, 0x9F, 0x92, 0x92, 0x80, 0x7F, 0x6E, 0x68, 0x70, 
-    0x66, 0x6B, 0x60, 0x65, 0x69, 0x6D, 0x6E, 0x6B, 0x70, 0x6F, 0x73, 0x76, 
-    0x71, 0x6F, 0x7A, 0x6F, 0x7A, 0x71, 0x7B, 0x77, 0x77, 0x7D, 0x7F, 0x7D, 
-    0x83, 0x7F, 0x88, 0x83, 0x8C, 0x85, 0x8D, 0x83, 0x8E, 0x85, 0x92, 0x84, 
-    0x8F, 0x84, 0x8B, 0x83, 0x83, 0x8E, 0x93, 0x9C, 0x98, 0x94, 0x90, 0x8F, 
-    0x90, 0x84, 0x79, 0x6C, 0x63, 0x59, 0x5E, 0x52, 0x54, 0x46, 0x5C, 0x5A, 
-    0x69, 0x72, 0x6D, 0x85, 0x8A, 0x97, 0xA6, 0xA0, 0xAF, 0xA5, 0xB7, 0xB0, 
-    0xB5, 0xA8, 0x9B, 0xA0, 0x95, 0x92, 0x7E, 0x84, 0x74, 0x78, 0x6B, 0x70, 
-    0x69, 0x68, 0x64, 0x6C, 0x72, 0x66, 0x70, 0x6F, 0x72, 0x76, 0x73, 0x7B, 
-    0x72, 0x80, 0x71, 0x82, 0x77, 0x79, 0x75, 0x80, 0x75, 0x7D, 0x7B, 0x7A, 
-    0x86, 0x7E, 0x86, 0x81, 0x8B, 0x81, 0x98, 0x84, 0x91, 0x84, 0x8B, 0x8D, 
-    0x86, 0x87, 0x80, 0x87, 0x8D, 0x99, 0x93, 0x96, 0x8A, 0x91, 0x89, 0x8D, 
-    0x7C, 0x74, 0x60, 0x6A, 0x60, 0x5F, 0x54, 0x54, 0x57, 0x64, 0x65, 0x6F, 
-    0x76, 0x79, 0x8D, 0x90, 0xA0, 0x9B, 0xA4, 0xA5, 0xAB, 0xAA, 0xAE, 0x9F, 
-    0xA0, 0x95, 0x95, 0x8D, 0x85, 0x7A, 0x7C, 0x76, 0x72, 0x6C, 0x6E, 0x68, 
-    0x6C, 0x74, 0x66, 0x79, 0x70, 0x7A, 0x73, 0x7D, 0x7A, 0x75, 0x80, 0x74, 
-    0x7A, 0x7D, 0x71, 0x7E, 0x74, 0x83, 0x74, 0x86, 0x77, 0x83, 0x7B, 0x7F, 
-    0x86, 0x82, 0x82, 0x85, 0x88, 0x8A, 0x86, 0x82, 0x8A, 0x7F, 0x92, 0x78, 
-    0x8F, 0x8F, 0x9E, 0x9B, 0x95, 0x92, 0x91, 0x8B, 0x88, 0x81, 0x68, 0x6A, 
-    0x5D, 0x5C, 0x61, 0x50, 0x55, 0x59, 0x5E, 0x75, 0x6C, 0x7A, 0x80, 0x8A, 
-    0x95, 0xA1, 0x9A, 0xA5, 0xA4, 0xA6, 0xB2, 0xA2, 0xA6, 0xA1, 0x92, 0x96, 
-    0x91, 0x7D, 0x7B, 0x79, 0x71, 0x74, 0x6B, 0x68, 0x6C, 0x69, 0x72, 0x67, 
-    0x75, 0x70, 0x78, 0x7D, 0x73, 0x7D, 0x82, 0x78, 0x7A, 0x7F, 0x80, 0x70, 
-    0x86, 0x73, 0x84, 0x77, 0x85, 0x71, 0x82, 0x7C, 0x7B, 0x87, 0x7E, 0x86, 
-    0x87, 0x84, 0x88, 0x7E, 0x89, 0x77, 0x91, 0x9C, 0xB5, 0xAA, 0xA0, 0xA8, 
-    0x98, 0xA1, 0x93, 0x6F, 0x59, 0x52, 0x3E, 0x4B, 0x39, 0x37, 0x2C, 0x4D, 
-    0x5B, 0x63, 0x7A, 0x79, 0x90, 0x96, 0xC2, 0xAA, 0xC2, 0xA9, 0xC2, 0xB7, 
-    0xC2, 0xA6, 0xA8, 0x9E, 0x9A, 0x9A, 0x8C, 0x7C, 0x67, 0x81, 0x68, 0x6F, 
-    0x63, 0x5D, 0x68, 0x70, 0x6C, 0x6C, 0x64, 0x71, 0x6B, 0x83, 0x61, 0x7F, 
-    0x6B, 0x83, 0x76, 0x88, 0x66, 0x8C, 0x6F, 0x8A, 0x80, 0x7D, 0x83, 0x80, 
-    0x8B, 0x84, 0x82, 0x83, 0x8B, 0x7F, 0x89, 0x81, 0x80, 0x71, 0x86, 0x93, 
-    0xCE, 0xD1, 0xB4, 0xB6, 0xC5, 0xA4, 0xAE, 0x85, 0x45, 0x30, 0x2B, 0x18, 
-    0x0E, 0x0C, 0x03, 0x1D, 0x42, 0x5C, 0x71, 0x84, 0xA5, 0xB1, 0xD6, 0xE0, 
-    0xD1, 0xD1, 0xD0, 0xCB, 0xC2, 0xB9, 0x97, 0x91, 0x8F, 0x8D, 0x82, 0x83, 
-    0x77, 0x6C, 0x7F, 0x7B, 0x70, 0x6F, 0x6E, 0x6B, 0x75, 0x74, 0x5D, 0x6E, 
-    0x5D, 0x6B, 0x72, 0x6A, 0x5E, 0x61, 0x7B, 0x71, 0x7A, 0x72, 0x6A, 0x7F, 
-    0x8B, 0x83, 0x7A, 0x7B, 0x89, 0x88, 0x96, 0x88, 0x7D, 0x90, 0x86, 0x8F, 
-    0x81, 0x75, 0x67, 0x8E, 0xC8, 0xFD, 0xBF, 0xBC, 0xD7, 0xB8, 0xB9, 0xA5, 
-    0x4E, 0x30, 0x30, 0x23, 0x10, 0x09, 0x03, 0x09, 0x37, 0x5B, 0x63, 0x80, 
-    0x9E, 0xB5, 0xD9, 0xE7, 0xD9, 0xD2, 0xD4, 0xC9, 0xBC, 0xAB, 0x8B, 0x77, 
-    0x7A, 0x71, 0x6B, 0x6B, 0x6A, 0x77, 0x90, 0x8F, 0x85, 0x8D, 0x89, 0x89, 
-    0x8A, 0x77, 0x65, 0x61, 0x5F, 0x5B, 0x56, 0x50, 0x4D, 0x5D, 0x64, 0x66, 
-    0x6B, 0x70, 0x79, 0x86, 0x84, 0x7E, 0x7F, 0x8B, 0x84, 0x86, 0x85, 0x87, 
-    0x89, 0x92, 0x87, 0x87, 0x82, 0x82, 0x76, 0x7E, 0xAB, 0xFD, 0xCC, 0xB3, 
-    0xD7, 0xB0, 0xA4, 0xAE, 0x60, 0x30, 0x33, 0x29, 0x12, 0x12, 0x0B, 0x03, 
-    0x2D, 0x5F, 0x64, 0x7D, 0xA4, 0xB6, 0xD9, 0xFA, 0xEC, 0xD9, 0xDF, 0xD5, 
-    0xBC, 0xAD, 0x89, 0x65, 0x6A, 0x6E, 0x62, 0x63, 0x6E, 0x76, 0x8D, 0xB0, 
-    0xB5, 0xA4, 0xA5, 0x9F, 0x92, 0x84, 0x66, 0x42, 0x3F, 0x3F, 0x39, 0x38, 
-    0x3F, 0x3C, 0x61, 0x6A, 0x6F, 0x80, 0x81, 0x87, 0x93, 0x94, 0x86, 0x85, 
-    0x7E, 0x86, 0x84, 0x84, 0x87, 0x88, 0x91, 0x89, 0x8A, 0x84, 0x7C, 0x72, 
-    0x9F, 0xFD, 0xDC, 0xA6, 0xD4, 0xB5, 0x9F, 0xB4, 0x6E, 0x27, 0x2F, 0x2F, 
-    0x16, 0x14, 0x13, 0x03, 0x29, 0x63, 0x6E, 0x7A, 0xA4, 0xB7, 0xD2, 0xF9, 
-    0xF1, 0xD1, 0xD4, 0xD3, 0xB9, 0xA7, 0x8C, 0x61, 0x5F, 0x70, 0x67, 0x61, 
-    0x6E, 0x74, 0x8C, 0xB0, 0xB0, 0xA4, 0xB0, 0xB3, 0xA8, 0x9B, 0x83, 0x59, 
-    0x4B, 0x42, 0x2D, 0x20, 0x23, 0x26, 0x3B, 0x55, 0x5B, 0x68, 0x75, 0x8C, 
-    0x88, 0x95, 0x96, 0x99, 0x96, 0x93, 0x8D, 0x95, 0x96, 0x8F, 0x8E, 0x96, 
-    0x92, 0x8D, 0x83, 0x79, 0x6D, 0x88, 0xFA, 0xFD, 0xA9, 0xD5, 0xC7, 0xA1, 
-    0xBD, 0x89, 0x29, 0x1F, 0x2B, 0x11, 0x0A, 0x13, 0x03, 0x15, 0x53, 0x6B, 
-    0x71, 0x93, 0xA9, 0xBA, 0xDF, 0xE9, 0xCC, 0xC4, 0xC8, 0xB5, 0xA7, 0x9A, 
-    0x75, 0x64, 0x73, 0x72, 0x67, 0x71, 0x76, 0x7C, 0x9E, 0xAB, 0xA1, 0xAA, 
-    0xAE, 0xA0, 0x9D, 0x87, 0x5E, 0x4F, 0x51, 0x3C, 0x35, 0x39, 0x34, 0x45, 
-    0x5F, 0x62, 0x63, 0x79, 0x81, 0x82, 0x96, 0x8D, 0x86, 0x8D, 0x8E, 0x84, 
-    0x90, 0x85, 0x83, 0x92, 0x94, 0x8D, 0x8B, 0x90, 0x8A, 0x84, 0x7F, 0x70, 
-    0x7A, 0xE1, 0xFD, 0xB3, 0xCA, 0xC4, 0x97, 0xB1, 0x9B, 0x3F, 0x20, 0x28, 
-    0x15, 0x0D, 0x19, 0x03, 0x05, 0x40, 0x66, 0x72, 0x94, 0xAA, 0xB5, 0xDA, 
-    0xF3, 0xE0, 0xD0, 0xCD, 0xBB, 0xAD, 0xA8, 0x88, 0x6B, 0x6D, 0x71, 0x6D, 
-    0x76, 0x79, 0x77, 0x8D, 0xA3, 0xA3, 0xA3, 0x9E, 0x94, 0x8E, 0x8B, 0x76, 
-    0x5A, 0x50, 0x48, 0x41, 0x48, 0x40, 0x41, 0x4D, 0x5A, 0x6D, 0x63, 0x7E, 
-    0x6E, 0x8A, 0x8A, 0x8A, 0x8D, 0x8F, 0x90, 0x8B, 0x9E, 0x90, 0x88, 0x95, 
-    0x8D, 0x9E, 0x90, 0x8E, 0x7D, 0x84, 0x73, 0x70, 0x87, 0xE2, 0xE1, 0xB7, 
-    0xD0, 0xBB, 0x9D, 0xB2, 0x8B, 0x42, 0x29, 0x23, 0x0B, 0x0C, 0x15, 0x03, 
-    0x0E, 0x3F, 0x5C, 0x72, 0x97, 0xA9, 0xB6, 0xDA, 0xED, 0xDD, 0xD6, 0xCF, 
-    0xBC, 0xB1, 0xAD, 0x8E, 0x76, 0x73, 0x70, 0x6E, 0x7A, 0x7A, 0x78, 0x85, 
-    0x92, 0xA1, 0xA1, 0xA9, 0x91, 0x84, 0x79, 0x6A, 0x54, 0x4E, 0x3D, 0x42, 
-    0x41, 0x4C, 0x52, 0x4E, 0x65, 0x64, 0x74, 0x83, 0x85, 0x81, 0x90, 0x9D, 
-    0x88, 0x96, 0x8B, 0x91, 0x8B, 0x93, 0x86, 0x91, 0x8B, 0x88, 0x91, 0x8D, 
-    0x8E, 0x7D, 0x86, 0x79, 0x74, 0x7A, 0xB9, 0xD0, 0xAF, 0xB8, 0xB7, 0x93, 
-    0xA3, 0x96, 0x5C, 0x36, 0x2E, 0x14, 0x0D, 0x17, 0x09, 0x03, 0x2E, 0x50, 
-    0x6D, 0x90, 0xA9, 0xAA, 0xCF, 0xE6, 0xE2, 0xDE, 0xDB, 0xC1, 0xB4, 0xB8, 
-    0xA2, 0x8F, 0x82, 0x80, 0x7F, 0x7D, 0x88, 0x77, 0x84, 0x85, 0x88, 0x90, 
-    0x83, 0x78, 0x6A, 0x67, 0x67, 0x5F, 0x5F, 0x54, 0x53, 0x68, 0x56, 0x6E, 
-    0x59, 0x6F, 0x67, 0x81, 0x7E, 0x7E, 0x82, 0x8A, 0x88, 0x8E, 0x88, 0x8F, 
-    0x84, 0x90, 0x85, 0x92, 0x82, 0x8A, 0x7E, 0x90, 0x7D, 0x8C, 0x81, 0x89, 
-    0x7C, 0x80, 0x83, 0x7B, 0x6E, 0x81, 0xB4, 0xA8, 0xA8, 0xA5, 0x95, 0x8C, 
-    0x97, 0x85, 0x5F, 0x4D, 0x3A, 0x2C, 0x37, 0x40, 0x36, 0x3B, 0x4D, 0x64, 
-    0x82, 0x96, 0x9C, 0xA0, 0xAF, 0xC5, 0xBD, 0xC1, 0xB8, 0xAF, 0xA9, 0xAA, 
-    0xA3, 0xA1, 0x8B, 0x95, 0x87, 0x98, 0x80, 0x83, 0x6C, 0x73, 0x6B, 0x69, 
-    0x70, 0x5D, 0x6A, 0x5F, 0x70, 0x6C, 0x68, 0x70, 0x6D, 0x70, 0x7B, 0x76, 
-    0x7D, 0x7B, 0x7C, 0x7F, 0x76, 0x89, 0x72, 0x85, 0x7B, 0x7E, 0x8A, 0x80, 
-    0x83, 0x81, 0x81, 0x88, 0x80, 0x82, 0x87, 0x83, 0x87, 0x89, 0x86, 0x84, 
-    0x88, 0x79, 0x89, 0x7D, 0x7E, 0x80, 0x75, 0x8F, 0x86, 0x96, 0x8B, 0x8F, 
-    0x89, 0x84, 0x80, 0x81, 0x6C, 0x70, 0x5A, 0x6D, 0x5F, 0x6A, 0x68, 0x64, 
-    0x76, 0x76, 0x89, 0x80, 0x95, 0x8D, 0xA5, 0xA4, 0xA6, 0x9C, 0x9E, 0x97, 
-    0x94, 0x95, 0x8A, 0x84, 0x85, 0x81, 0x79, 0x81, 0x7A, 0x76, 0x7A, 0x76, 
-    0x7A, 0x7B, 0x79, 0x7A, 0x78, 0x77, 0x80, 0x70, 0x7D, 0x68, 0x78, 0x67, 
-    0x7E, 0x6D, 0x7C, 0x78, 0x7C, 0x79, 0x82, 0x7B, 0x81, 0x80, 0x7F, 0x84, 
-    0x82, 0x85, 0x78, 0x8B, 0x7C, 0x8C, 0x79, 0x8C, 0x7B, 0x89, 0x82, 0x86, 
-    0x83, 0x83, 0x82, 0x88, 0x82, 0x84, 0x7F, 0x87, 0x7D, 0x8A, 0x7A, 0x89, 
-    0x78, 0x8E, 0x78, 0x8A, 0x7E, 0x86, 0x81, 0x85, 0x81, 0x7E, 0x81, 0x81, 
-    0x7E, 0x7F, 0x82, 0x7B, 0x84, 0x7F, 0x7F, 0x7D, 0x80, 0x7A, 0x81, 0x7E, 
-    0x7F, 0x7A, 0x84, 0x78, 0x86, 0x7A, 0x81, 0x7D, 0x80, 0x7E, 0x7E, 0x80, 
-    0x7F, 0x81, 0x80, 0x7C, 0x82, 0x7E, 0x7E, 0x7F, 0x82, 0x7D, 0x7E, 0x83, 
-    0x80, 0x82, 0x7D, 0x82, 0x81, 0x83, 0x7B, 0x83, 0x7A, 0x87, 0x7E, 0x7D, 
-    0x85, 0x7C, 0x85, 0x7C, 0x88, 0x7C, 0x84, 0x84, 0x7D, 0x82, 0x80, 0x84, 
-    0x7F, 0x82, 0x7D, 0x83, 0x80, 0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x82, 0x7F, 
-    0x83, 0x7E, 0x7F, 0x80, 0x81, 0x7D, 0x86, 0x78, 0x84, 0x7F, 0x83, 0x7D, 
-    0x81, 0x81, 0x80, 0x80, 0x82, 0x7E, 0x81, 0x7E, 0x80, 0x80, 0x85, 0x79, 
-    0x86, 0x78, 0x86, 0x79, 0x87, 0x79, 0x85, 0x7E, 0x7D, 0x85, 0x7F, 0x80, 
-    0x80, 0x80, 0x85, 0x7D, 0x84, 0x79, 0x85, 0x7A, 0x80, 0x7F, 0x7E, 0x7F, 
-    0x7F, 0x81, 0x7D, 0x83, 0x7D, 0x81, 0x7E, 0x86, 0x7A, 0x85, 0x7F, 0x82, 
-    0x7F, 0x83, 0x81, 0x7D, 0x83, 0x7B, 0x81, 0x81, 0x82, 0x7C, 0x88, 0x7A, 
-    0x85, 0x80, 0x81, 0x81, 0x82, 0x81, 0x7F, 0x7F, 0x7E, 0x7E, 0x82, 0x7E, 
-    0x81, 0x80, 0x7C, 0x82, 0x7C, 0x84, 0x7D, 0x82, 0x7D, 0x88, 0x76, 0x86, 
-    0x7E, 0x83, 0x7D, 0x83, 0x7F, 0x80, 0x7D, 0x7F, 0x83, 0x7E, 0x84, 0x7B, 
-    0x88, 0x7E, 0x80, 0x7D, 0x83, 0x81, 0x7E, 0x84, 0x7A, 0x82, 0x7F, 0x7F, 
-    0x7F, 0x82, 0x80, 0x7F, 0x84, 0x7E, 0x82, 0x81, 0x83, 0x7C, 0x84, 0x7F, 
-    0x81, 0x81, 0x7D, 0x7F, 0x80, 0x81, 0x7E, 0x82, 0x7C, 0x7F, 0x7F, 0x80, 
-    0x81, 0x7C, 0x7D, 0x85, 0x7C, 0x82, 0x7F, 0x84, 0x7B, 0x89, 0x7C, 0x84, 
-    0x7E, 0x83, 0x84, 0x7F, 0x7E, 0x81, 0x7F, 0x85, 0x79, 0x85, 0x7C, 0x7E, 
-    0x80, 0x81, 0x7E, 0x7A, 0x83, 0x7E, 0x7F, 0x82, 0x7E, 0x81, 0x82, 0x81, 
-    0x81, 0x80, 0x85, 0x7D, 0x80, 0x85, 0x7C, 0x86, 0x81, 0x7D, 0x7E, 0x85, 
-    0x79, 0x84, 0x7D, 0x7E, 0x7F, 0x83, 0x7D, 0x80, 0x83, 0x7B, 0x87, 0x80, 
-    0x86, 0x7D, 0x84, 0x7E, 0x83, 0x7F, 0x82, 0x75, 0x89, 0x77, 0x85, 0x75, 
-    0x86, 0x77, 0x83, 0x7D, 0x7B, 0x8B, 0x77, 0x86, 0x7A, 0x8C, 0x79, 0x86, 
-    0x82, 0x80, 0x7D, 0x84, 0x7B, 0x84, 0x7E, 0x84, 0x7D, 0x86, 0x7A, 0x84, 
-    0x80, 0x84, 0x7F, 0x7F, 0x81, 0x7C, 0x8A, 0x76, 0x83, 0x7E, 0x80, 0x7C, 
-    0x86, 0x7B, 0x81, 0x79, 0x83, 0x7B, 0x85, 0x7B, 0x83, 0x7F, 0x87, 0x7D, 
-    0x84, 0x80, 0x81, 0x7E, 0x82, 0x81, 0x7D, 0x80, 0x7D, 0x7F, 0x7F, 0x80, 
-    0x7B, 0x85, 0x7C, 0x85, 0x7F, 0x85, 0x7B, 0x85, 0x7F, 0x7E, 0x82, 0x80, 
-    0x81, 0x7E, 0x87, 0x7B, 0x84, 0x7F, 0x7F, 0x83, 0x80, 0x80, 0x7E, 0x80, 
-    0x82, 0x7C, 0x84, 0x7A, 0x83, 0x7D, 0x87, 0x78, 0x85, 0x7B, 0x82, 0x79, 
-    0x83, 0x79, 0x86, 0x7E, 0x82, 0x7E, 0x83, 0x80, 0x7E, 0x83, 0x84, 0x7E, 
-    0x86, 0x81, 0x82, 0x7C, 0x7A, 0x80, 0x82, 0x82, 0x7F, 0x84, 0x7D, 0x7D, 
-    0x7D, 0x80, 0x7F, 0x82, 0x7C, 0x86, 0x7E, 0x82, 0x7A, 0x88, 0x77, 0x89, 
-    0x7C, 0x85, 0x80, 0x84, 0x7A, 0x7D, 0x89, 0x77, 0x88, 0x81, 0x81, 0x78, 
-    0x85, 0x7E, 0x82, 0x85, 0x87, 0x7A, 0x89, 0x7D, 0x82, 0x80, 0x82, 0x73, 
-    0x88, 0x76, 0x7F, 0x7C, 0x82, 0x72, 0x84, 0x7B, 0x81, 0x7D, 0x83, 0x7D, 
-    0x7C, 0x83, 0x80, 0x86, 0x7D, 0x83, 0x7C, 0x86, 0x81, 0x7F, 0x80, 0x83, 
-    0x7A, 0x84, 0x85, 0x85, 0x7E, 0x86, 0x7C, 0x81, 0x82, 0x7F, 0x7C, 0x80, 
-    0x7A, 0x81, 0x85, 0x80, 0x7D, 0x82, 0x81, 0x83, 0x84, 0x84, 0x81, 0x80, 
-    0x88, 0x80, 0x82, 0x81, 0x85, 0x7A, 0x88, 0x7D, 0x81, 0x7A, 0x7F, 0x77, 
-    0x80, 0x7B, 0x78, 0x78, 0x7F, 0x78, 0x80, 0x7D, 0x7E, 0x7C, 0x80, 0x7C, 
-    0x82, 0x81, 0x7F, 0x7D, 0x81, 0x82, 0x81, 0x85, 0x82, 0x85, 0x84, 0x84, 
-    0x79, 0x8B, 0x83, 0x80, 0x7F, 0x87, 0x80, 0x89, 0x83, 0x85, 0x7E, 0x80, 
-    0x7D, 0x7C, 0x81, 0x7C, 0x79, 0x7E, 0x85, 0x7E, 0x81, 0x7F, 0x7B, 0x7E, 
-    0x82, 0x7B, 0x7C, 0x7F, 0x7F, 0x7E, 0x85, 0x81, 0x81, 0x81, 0x7F, 0x7A, 
-    0x7F, 0x82, 0x84, 0x84, 0x83, 0x7B, 0x7E, 0x7F, 0x83, 0x83, 0x85, 0x83, 
-    0x82, 0x80, 0x7D, 0x81, 0x82, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x82, 0x80, 
-    0x80, 0x7F, 0x7D, 0x79, 0x7E, 0x7E, 0x80, 0x82, 0x80, 0x7C, 0x80, 0x7D, 
-    0x7B, 0x7E, 0x7F, 0x7C, 0x7F, 0x82, 0x82, 0x86, 0x89, 0x89, 0x88, 0x87, 
-    0x85, 0x7F, 0x82, 0x7E, 0x7F, 0x7F, 0x87, 0x89, 0x8D, 0x8D, 0x89, 0x7E, 
-    0x79, 0x6E, 0x6C, 0x6B, 0x6F, 0x70, 0x72, 0x71, 0x6F, 0x6C, 0x70, 0x70, 
-    0x72, 0x7B, 0x7D, 0x83, 0x85, 0x8A, 0x89, 0x8E, 0x8E, 0x91, 0x92, 0x93, 
-    0x94, 0x93, 0x97, 0x94, 0x92, 0x89, 0x7C, 0x77, 0x74, 0x6E, 0x73, 0xB6, 
-    0xF6, 0xFD, 0xDE, 0xB2, 0x64, 0x36, 0x2E, 0x35, 0x33, 0x42, 0x42, 0x3A, 
-    0x46, 0x65, 0x74, 0x81, 0x89, 0x7D, 0x6A, 0x70, 0x7B, 0x84, 0x8D, 0x9A, 
-    0x92, 0x9E, 0xB1, 0xB9, 0xAA, 0xA3, 0x8E, 0x80, 0x85, 0x99, 0x97, 0x95, 
-    0x8F, 0x85, 0x80, 0x8C, 0x8E, 0x8B, 0x89, 0x88, 0x80, 0x82, 0x83, 0x79, 
-    0x6D, 0x6E, 0x6E, 0x76, 0x7E, 0x7E, 0x73, 0x6C, 0x65, 0x58, 0x3F, 0x92, 
-    0xE6, 0xFD, 0xD5, 0xBE, 0x69, 0x35, 0x31, 0x44, 0x43, 0x53, 0x57, 0x4C, 
-    0x57, 0x78, 0x8C, 0x95, 0x96, 0x7A, 0x5D, 0x67, 0x7B, 0x88, 0x99, 0xA3, 
-    0x96, 0x9B, 0xB0, 0xB3, 0x9F, 0x91, 0x7F, 0x76, 0x87, 0x9F, 0x9F, 0x95, 
-    0x8B, 0x7D, 0x7C, 0x8B, 0x93, 0x8B, 0x85, 0x7F, 0x79, 0x78, 0x7C, 0x74, 
-    0x6D, 0x6D, 0x73, 0x72, 0x7D, 0x70, 0x6F, 0x43, 0x6A, 0xCB, 0xFD, 0xEA, 
-    0xC4, 0x8C, 0x32, 0x24, 0x3A, 0x51, 0x58, 0x61, 0x58, 0x51, 0x6C, 0x8A, 
-    0x9A, 0x94, 0x7A, 0x5B, 0x58, 0x6F, 0x88, 0x9D, 0xA4, 0x98, 0x89, 0x97, 
-    0xA8, 0xAD, 0x9D, 0x8A, 0x74, 0x78, 0x8B, 0x9E, 0x9E, 0x95, 0x87, 0x81, 
-    0x88, 0x93, 0x93, 0x88, 0x7B, 0x71, 0x74, 0x7C, 0x7F, 0x76, 0x71, 0x6C, 
-    0x74, 0x74, 0x80, 0x6F, 0x70, 0x3C, 0x6F, 0xCF, 0xFD, 0xE1, 0xBA, 0x85, 
-    0x2D, 0x23, 0x48, 0x61, 0x64, 0x68, 0x62, 0x56, 0x73, 0x98, 0xA5, 0x90, 
-    0x6F, 0x51, 0x4C, 0x6D, 0x94, 0xA6, 0xA0, 0x8F, 0x85, 0x8D, 0xA4, 0xAF, 
-    0xA1, 0x7E, 0x6C, 0x70, 0x88, 0x9C, 0xA2, 0x91, 0x7E, 0x78, 0x87, 0x96, 
-    0x9B, 0x8F, 0x7C, 0x71, 0x74, 0x80, 0x84, 0x7F, 0x72, 0x6F, 0x71, 0x7C, 
-    0x7D, 0x76, 0x62, 0x49, 0x9D, 0xE8, 0xFD, 0xC7, 0xA8, 0x53, 0x17, 0x2E, 
-    0x5A, 0x64, 0x63, 0x67, 0x5A, 0x5C, 0x86, 0xA5, 0x9C, 0x7C, 0x5F, 0x4C, 
-    0x5A, 0x84, 0xA4, 0xA3, 0x94, 0x88, 0x8A, 0x9E, 0xAC, 0x9E, 0x7D, 0x6C, 
-    0x6F, 0x85, 0x9C, 0xA6, 0x95, 0x80, 0x79, 0x85, 0x93, 0x9C, 0x93, 0x81, 
-    0x72, 0x74, 0x7D, 0x82, 0x7E, 0x77, 0x6F, 0x72, 0x76, 0x78, 0x66, 0x50, 
-    0xAB, 0xF9, 0xFD, 0xC5, 0xA7, 0x4B, 0x0B, 0x2C, 0x56, 0x59, 0x5F, 0x66, 
-    0x56, 0x5C, 0x8C, 0xA2, 0x91, 0x75, 0x5C, 0x4C, 0x60, 0x8D, 0xA6, 0x9F, 
-    0x93, 0x8D, 0x94, 0x9F, 0x9F, 0x89, 0x74, 0x6D, 0x7D, 0x92, 0xA2, 0x9F, 
-    0x8E, 0x7E, 0x81, 0x8D, 0x99, 0x98, 0x8D, 0x7C, 0x74, 0x76, 0x7D, 0x80, 
-    0x7C, 0x75, 0x71, 0x76, 0x72, 0x69, 0x51, 0xA0, 0xF3, 0xFD, 0xCA, 0xA7, 
-    0x5C, 0x14, 0x28, 0x58, 0x58, 0x56, 0x60, 0x5B, 0x57, 0x85, 0xA4, 0x90, 
-    0x6F, 0x5D, 0x50, 0x60, 0x8D, 0xAA, 0x9E, 0x8F, 0x8E, 0x95, 0x9F, 0xA0, 
-    0x8A, 0x71, 0x6A, 0x7F, 0x94, 0xA2, 0x9C, 0x8C, 0x7C, 0x80, 0x8F, 0x9B, 
-    0x99, 0x8E, 0x7F, 0x77, 0x7A, 0x7E, 0x7D, 0x77, 0x74, 0x71, 0x77, 0x74, 
-    0x72, 0x54, 0x80, 0xE2, 0xFD, 0xD4, 0xAD, 0x7A, 0x28, 0x21, 0x4E, 0x5D, 
-    0x58, 0x59, 0x5B, 0x58, 0x78, 0x99, 0x97, 0x79, 0x60, 0x53, 0x5F, 0x83, 
-    0xA2, 0xA5, 0x94, 0x8F, 0x99, 0xA3, 0x96, 0x84, 0x70, 0x69, 0x78, 0x96, 
-    0xA5, 0x9F, 0x90, 0x83, 0x80, 0x8C, 0x9B, 0x9B, 0x8E, 0x82, 0x7B, 0x7A, 
-    0x7C, 0x7E, 0x76, 0x72, 0x6E, 0x76, 0x76, 0x78, 0x5B, 0x6D, 0xCE, 0xFD, 
-    0xDC, 0xB2, 0x8A, 0x3C, 0x21, 0x47, 0x5A, 0x52, 0x51, 0x54, 0x54, 0x70, 
-    0x96, 0x97, 0x7D, 0x66, 0x58, 0x60, 0x80, 0x9D, 0xA0, 0x92, 0x8F, 0x9B, 
-    0xA8, 0xA0, 0x8A, 0x70, 0x66, 0x72, 0x90, 0xA2, 0xA0, 0x90, 0x85, 0x83, 
-    0x8E, 0x9C, 0x9E, 0x91, 0x83, 0x7B, 0x7C, 0x7E, 0x7E, 0x73, 0x6E, 0x6D, 
-    0x75, 0x7B, 0x7A, 0x73, 0x56, 0x76, 0xDB, 0xFD, 0xD4, 0xA9, 0x7A, 0x38, 
-    0x33, 0x55, 0x5B, 0x4D, 0x4A, 0x4A, 0x54, 0x7A, 0x94, 0x8B, 0x74, 0x63, 
-    0x60, 0x7A, 0x99, 0xA4, 0x98, 0x8B, 0x8A, 0x9A, 0xA7, 0x9B, 0x83, 0x6E, 
-    0x6F, 0x80, 0x9B, 0xA1, 0x97, 0x86, 0x81, 0x85, 0x98, 0xA0, 0x9A, 0x8A, 
-    0x7F, 0x7A, 0x7D, 0x7E, 0x79, 0x6D, 0x6B, 0x70, 0x7A, 0x81, 0x7D, 0x75, 
-    0x60, 0x5B, 0xB2, 0xFD, 0xEB, 0xB8, 0x91, 0x4E, 0x33, 0x4E, 0x62, 0x52, 
-    0x48, 0x47, 0x4C, 0x69, 0x86, 0x83, 0x6E, 0x5D, 0x5B, 0x72, 0x96, 0xA6, 
-    0x9D, 0x8A, 0x86, 0x97, 0xAA, 0xA2, 0x8C, 0x75, 0x6D, 0x78, 0x94, 0x9E, 
-    0x95, 0x88, 0x84, 0x88, 0x9A, 0xA6, 0xA3, 0x94, 0x88, 0x81, 0x82, 0x83, 
-    0x7D, 0x72, 0x6B, 0x6E, 0x78, 0x81, 0x7E, 0x7A, 0x6D, 0x69, 0x50, 0x6B, 
-    0xDB, 0xFD, 0xCA, 0xAA, 0x79, 0x48, 0x44, 0x5D, 0x55, 0x41, 0x3F, 0x43, 
-    0x58, 0x7B, 0x80, 0x77, 0x66, 0x60, 0x70, 0x8D, 0x9C, 0x9C, 0x8F, 0x88, 
-    0x94, 0xA8, 0xA4, 0x90, 0x7D, 0x73, 0x78, 0x8F, 0x97, 0x90, 0x87, 0x82, 
-    0x87, 0x97, 0xA0, 0x9E, 0x94, 0x8C, 0x89, 0x89, 0x86, 0x7C, 0x71, 0x6C, 
-    0x6D, 0x79, 0x7D, 0x7E, 0x7A, 0x74, 0x69, 0x6D, 0x60, 0x66, 0xC3, 0xFD, 
-    0xD7, 0xB7, 0x8C, 0x58, 0x42, 0x4F, 0x4C, 0x38, 0x36, 0x38, 0x47, 0x6A, 
-    0x75, 0x76, 0x6B, 0x65, 0x73, 0x8B, 0x9C, 0xA1, 0x96, 0x91, 0x9B, 0xAD, 
-    0xA9, 0x97, 0x85, 0x77, 0x78, 0x8B, 0x92, 0x92, 0x8C, 0x87, 0x8A, 0x95, 
-    0x9F, 0xA1, 0x9A, 0x92, 0x8C, 0x8B, 0x86, 0x7D, 0x73, 0x6C, 0x6C, 0x74, 
-    0x79, 0x7B, 0x7B, 0x71, 0x6D, 0x6B, 0x6E, 0x5A, 0x72, 0xD6, 0xFD, 0xDA, 
-    0xBF, 0x8A, 0x57, 0x3D, 0x49, 0x3E, 0x2D, 0x2C, 0x29, 0x3A, 0x5C, 0x6A, 
-    0x73, 0x6E, 0x6F, 0x7B, 0x90, 0xA2, 0xA4, 0x9C, 0x9A, 0xA2, 0xAE, 0xA8, 
-    0x9A, 0x8A, 0x79, 0x79, 0x86, 0x8D, 0x92, 0x8F, 0x8C, 0x8C, 0x95, 0x9F, 
-    0xA1, 0x9D, 0x96, 0x8D, 0x89, 0x85, 0x7C, 0x74, 0x6C, 0x6C, 0x70, 0x75, 
-    0x77, 0x77, 0x74, 0x71, 0x6B, 0x6D, 0x5F, 0x6E, 0xBE, 0xF0, 0xDF, 0xC4, 
-    0x9E, 0x6A, 0x44, 0x4B, 0x41, 0x2B, 0x28, 0x1F, 0x25, 0x43, 0x5B, 0x6C, 
-    0x75, 0x7A, 0x7F, 0x90, 0xA2, 0xA6, 0xA8, 0xA1, 0x9E, 0xAA, 0xAC, 0xA2, 
-    0x95, 0x84, 0x79, 0x7D, 0x86, 0x8B, 0x8F, 0x91, 0x8E, 0x94, 0x9D, 0x9E, 
-    0x9D, 0x98, 0x8E, 0x88, 0x83, 0x7D, 0x77, 0x71, 0x6D, 0x6D, 0x70, 0x72, 
-    0x74, 0x75, 0x74, 0x73, 0x71, 0x6B, 0x66, 0x90, 0xD0, 0xDF, 0xC7, 0xB6, 
-    0x94, 0x5C, 0x53, 0x56, 0x37, 0x2E, 0x2B, 0x19, 0x26, 0x40, 0x53, 0x69, 
-    0x7B, 0x7F, 0x88, 0x99, 0xA1, 0xAC, 0xB0, 0xA6, 0xA6, 0xA8, 0xA7, 0xA4, 
-    0x95, 0x84, 0x7D, 0x7C, 0x7F, 0x88, 0x8E, 0x8C, 0x8F, 0x94, 0x97, 0x9C, 
-    0x9D, 0x96, 0x90, 0x87, 0x81, 0x7F, 0x7A, 0x73, 0x70, 0x6E, 0x6B, 0x6E, 
-    0x72, 0x73, 0x76, 0x76, 0x73, 0x71, 0x6B, 0x7D, 0xAE, 0xCC, 0xBC, 0xB3, 
-    0xAC, 0x76, 0x62, 0x6F, 0x4D, 0x3D, 0x3F, 0x23, 0x1E, 0x2F, 0x3A, 0x50, 
-    0x6C, 0x77, 0x81, 0x92, 0x9A, 0xA8, 0xB6, 0xB2, 0xB1, 0xB1, 0xA7, 0xA7, 
-    0x9F, 0x8D, 0x86, 0x7F, 0x77, 0x7D, 0x83, 0x82, 0x88, 0x8D, 0x8E, 0x97, 
-    0x9C, 0x99, 0x99, 0x92, 0x88, 0x84, 0x7F, 0x78, 0x76, 0x72, 0x6B, 0x6B, 
-    0x6C, 0x6D, 0x72, 0x73, 0x73, 0x73, 0x6F, 0x6F, 0x84, 0xB0, 0xC4, 0xB0, 
-    0xB5, 0xAB, 0x75, 0x74, 0x74, 0x4D, 0x49, 0x41, 0x22, 0x23, 0x2E, 0x33, 
-    0x4D, 0x66, 0x6E, 0x7F, 0x91, 0x98, 0xAB, 0xB8, 0xB6, 0xB8, 0xB4, 0xAA, 
-    0xAB, 0xA2, 0x8F, 0x8A, 0x81, 0x75, 0x7A, 0x7E, 0x7D, 0x85, 0x8B, 0x8C, 
-    0x94, 0x98, 0x97, 0x99, 0x92, 0x8A, 0x86, 0x80, 0x7A, 0x79, 0x73, 0x6C, 
-    0x6C, 0x6A, 0x6B, 0x6F, 0x6E, 0x6F, 0x72, 0x70, 0x70, 0x7D, 0x9F, 0xBE, 
-    0xB2, 0xAE, 0xB8, 0x8C, 0x77, 0x82, 0x5F, 0x4E, 0x51, 0x32, 0x24, 0x2D, 
-    0x2D, 0x3D, 0x5A, 0x66, 0x73, 0x87, 0x8F, 0x9D, 0xB1, 0xB4, 0xB7, 0xB9, 
-    0xAF, 0xAC, 0xAB, 0x9B, 0x8F, 0x88, 0x7A, 0x77, 0x7C, 0x7A, 0x7E, 0x86, 
-    0x88, 0x8E, 0x94, 0x95, 0x97, 0x95, 0x8E, 0x8A, 0x86, 0x7F, 0x7C, 0x77, 
-    0x6F, 0x6D, 0x6B, 0x69, 0x6C, 0x6E, 0x6D, 0x71, 0x72, 0x72, 0x74, 0x7B, 
-    0x97, 0xBC, 0xB3, 0xAA, 0xBC, 0x96, 0x78, 0x88, 0x68, 0x4F, 0x56, 0x3A, 
-    0x25, 0x2E, 0x2B, 0x34, 0x52, 0x60, 0x6A, 0x83, 0x8C, 0x98, 0xAE, 0xB4, 
-    0xB6, 0xBC, 0xB3, 0xAC, 0xAF, 0xA0, 0x91, 0x8D, 0x80, 0x77, 0x7D, 0x7C, 
-    0x7C, 0x85, 0x87, 0x8C, 0x94, 0x95, 0x96, 0x96, 0x90, 0x8B, 0x87, 0x80, 
-    0x7B, 0x78, 0x70, 0x6C, 0x6B, 0x68, 0x6A, 0x6D, 0x6B, 0x6E, 0x72, 0x71, 
-    0x74, 0x76, 0x78, 0x92, 0xBD, 0xB6, 0xA8, 0xC2, 0xA2, 0x7C, 0x8F, 0x72, 
-    0x4F, 0x58, 0x3F, 0x24, 0x2D, 0x2A, 0x2B, 0x49, 0x59, 0x62, 0x7C, 0x88, 
-    0x93, 0xAB, 0xB2, 0xB5, 0xC0, 0xB8, 0xB3, 0xB8, 0xA4, 0x94, 0x93, 0x81, 
-    0x78, 0x80, 0x7B, 0x79, 0x84, 0x85, 0x89, 0x94, 0x95, 0x96, 0x99, 0x92, 
-    0x8C, 0x8B, 0x82, 0x7D, 0x7A, 0x70, 0x6A, 0x6A, 0x67, 0x67, 0x6A, 0x6A, 
-    0x6B, 0x6F, 0x71, 0x73, 0x76, 0x75, 0x7E, 0xA3, 0xBD, 0xAA, 0xB6, 0xBF, 
-    0x8D, 0x87, 0x8C, 0x5F, 0x54, 0x53, 0x2F, 0x22, 0x29, 0x20, 0x2C, 0x4B, 
-    0x55, 0x68, 0x83, 0x8D, 0x9E, 0xB1, 0xB7, 0xBF, 0xC4, 0xC0, 0xBF, 0xB4, 
-    0xA2, 0x9A, 0x8D, 0x7F, 0x7F, 0x7D, 0x79, 0x80, 0x85, 0x87, 0x8F, 0x94, 
-    0x94, 0x98, 0x96, 0x8E, 0x8B, 0x86, 0x7E, 0x7B, 0x74, 0x6C, 0x69, 0x66, 
-    0x63, 0x66, 0x68, 0x68, 0x6C, 0x6E, 0x6F, 0x73, 0x77, 0x75, 0x77, 0x8B, 
-    0xB2, 0xB4, 0xA8, 0xC3, 0xAE, 0x85, 0x94, 0x7F, 0x59, 0x5D, 0x4B, 0x26, 
-    0x27, 0x28, 0x1D, 0x36, 0x4D, 0x54, 0x70, 0x87, 0x8E, 0xA5, 0xB5, 0xB7, 
-    0xC5, 0xCB, 0xC1, 0xBD, 0xB4, 0xA0, 0x96, 0x8F, 0x82, 0x80, 0x80, 0x7D, 
-    0x80, 0x86, 0x88, 0x8F, 0x95, 0x95, 0x96, 0x94, 0x8D, 0x88, 0x82, 0x7B, 
-    0x76, 0x70, 0x69, 0x67, 0x65, 0x63, 0x65, 0x67, 0x67, 0x6C, 0x70, 0x72, 
-    0x75, 0x77, 0x77, 0x75, 0x74, 0x88, 0xAB, 0xA8, 0xA2, 0xBE, 0xA6, 0x87, 
-    0x98, 0x7F, 0x5D, 0x66, 0x52, 0x31, 0x37, 0x33, 0x26, 0x3E, 0x50, 0x56, 
-    0x71, 0x85, 0x8B, 0x9F, 0xAD, 0xB3, 0xC3, 0xC5, 0xBC, 0xBD, 0xB1, 0x9E, 
-    0x9C, 0x93, 0x86, 0x89, 0x87, 0x7E, 0x85, 0x89, 0x85, 0x8D, 0x93, 0x90, 
-    0x92, 0x90, 0x88, 0x84, 0x7E, 0x76, 0x74, 0x70, 0x69, 0x67, 0x66, 0x63, 
-    0x66, 0x69, 0x68, 0x6C, 0x6F, 0x6F, 0x75, 0x78, 0x78, 0x79, 0x78, 0x73, 
-    0x73, 0x7F, 0x97, 0xA3, 0x9C, 0xA3, 0xA4, 0x8E, 0x8B, 0x8B, 0x76, 0x6C, 
-    0x6A, 0x54, 0x47, 0x4C, 0x46, 0x48, 0x59, 0x60, 0x69, 0x7D, 0x87, 0x91, 
-    0xA3, 0xAA, 0xAC, 0xB4, 0xB2, 0xAC, 0xAB, 0xA2, 0x98, 0x93, 0x8E, 0x8A, 
-    0x8A, 0x89, 0x84, 0x87, 0x89, 0x8A, 0x90, 0x92, 0x8F, 0x8C, 0x88, 0x81, 
-    0x7E, 0x7B, 0x76, 0x71, 0x6D, 0x68, 0x66, 0x65, 0x65, 0x64, 0x66, 0x6A, 
-    0x6C, 0x70, 0x72, 0x76, 0x78, 0x77, 0x77, 0x76, 0x75, 0x74, 0x78, 0x81, 
-    0x8C, 0x90, 0x94, 0x9C, 0x99, 0x95, 0x94, 0x8C, 0x81, 0x7C, 0x71, 0x66, 
-    0x63, 0x60, 0x5D, 0x61, 0x66, 0x69, 0x73, 0x7F, 0x86, 0x8E, 0x97, 0x9A, 
-    0x9E, 0xA1, 0xA2, 0x9E, 0x9E, 0x98, 0x92, 0x90, 0x8B, 0x89, 0x86, 0x87, 
-    0x86, 0x8A, 0x8C, 0x8D, 0x8F, 0x8F, 0x8B, 0x8A, 0x88, 0x83, 0x7F, 0x7D, 
-    0x74, 0x70, 0x6C, 0x6A, 0x6A, 0x69, 0x67, 0x6A, 0x68, 0x6B, 0x6D, 0x6F, 
-    0x71, 0x6F, 0x73, 0x73, 0x71, 0x74, 0x73, 0x75, 0x74, 0x79, 0x81, 0x87, 
-    0x8C, 0x91, 0x95, 0x92, 0x92, 0x92, 0x8D, 0x89, 0x88, 0x83, 0x7D, 0x7D, 
-    0x78, 0x76, 0x76, 0x79, 0x7B, 0x7F, 0x83, 0x85, 0x89, 0x89, 0x8D, 0x8E, 
-    0x91, 0x90, 0x8F, 0x8E, 0x89, 0x8B, 0x87, 0x85, 0x84, 0x86, 0x83, 0x85, 
-    0x83, 0x84, 0x85, 0x85, 0x86, 0x83, 0x87, 0x7B, 0x82, 0x7B, 0x79, 0x76, 
-    0x75, 0x72, 0x6F, 0x71, 0x6B, 0x6C, 0x6D, 0x6E, 0x6D, 0x72, 0x6E, 0x75, 
-    0x75, 0x78, 0x7A, 0x7D, 0x7E, 0x81, 0x81, 0x84, 0x85, 0x87, 0x89, 0x88, 
-    0x8D, 0x8D, 0x93, 0x92, 0x8E, 0x8C, 0x8A, 0x86, 0x86, 0x82, 0x81, 0x7C, 
-    0x7D, 0x79, 0x7D, 0x77, 0x7C, 0x76, 0x7E, 0x79, 0x80, 0x80, 0x82, 0x82, 
-    0x86, 0x81, 0x8B, 0x84, 0x8B, 0x84, 0x86, 0x85, 0x87, 0x84, 0x88, 0x83, 
-    0x87, 0x80, 0x89, 0x7E, 0x84, 0x7F, 0x7E, 0x7B, 0x7C, 0x7E, 0x7C, 0x7C, 
-    0x7B, 0x7E, 0x7B, 0x7C, 0x7C, 0x7A, 0x7B, 0x76, 0x7C, 0x73, 0x79, 0x76, 
-    0x7A, 0x77, 0x7D, 0x78, 0x7E, 0x78, 0x82, 0x7E, 0x81, 0x7F, 0x83, 0x80, 
-    0x83, 0x83, 0x82, 0x84, 0x83, 0x83, 0x84, 0x81, 0x86, 0x7E, 0x84, 0x81, 
-    0x83, 0x81, 0x8A, 0x82, 0x8C, 0x78, 0x90, 0x7E, 0x83, 0x8D, 0x7C, 0x8B, 
-    0x81, 0x82, 0x83, 0x80, 0x85, 0x82, 0x81, 0x87, 0x7A, 0x8A, 0x78, 0x8E, 
-    0x76, 0x8B, 0x77, 0x86, 0x79, 0x7F, 0x7B, 0x78, 0x78, 0x77, 0x78, 0x72, 
-    0x78, 0x70, 0x79, 0x74, 0x77, 0x7B, 0x7F, 0x7E, 0x83, 0x81, 0x87, 0x80, 
-    0x8C, 0x83, 0x89, 0x84, 0x82, 0x83, 0x85, 0x84, 0x83, 0x7D, 0x89, 0x7E, 
-    0x85, 0x84, 0x88, 0x7C, 0x84, 0x84, 0x81, 0x84, 0x7B, 0x83, 0x76, 0x86, 
-    0x74, 0x7C, 0x70, 0x7C, 0x74, 0x7B, 0x7C, 0x7D, 0x7F, 0x84, 0x83, 0x87, 
-    0x81, 0x8A, 0x85, 0x83, 0x89, 0x7F, 0x8E, 0x75, 0x90, 0x75, 0x8E, 0x7B, 
-    0x87, 0x81, 0x82, 0x81, 0x80, 0x82, 0x85, 0x82, 0x85, 0x79, 0x86, 0x74, 
-    0x83, 0x73, 0x79, 0x73, 0x78, 0x79, 0x76, 0x7C, 0x74, 0x81, 0x81, 0x83, 
-    0x84, 0x7D, 0x8B, 0x7C, 0x89, 0x79, 0x88, 0x76, 0x8C, 0x7A, 0x89, 0x80, 
-    0x87, 0x7A, 0x8B, 0x7B, 0x89, 0x7E, 0x87, 0x7F, 0x85, 0x81, 0x83, 0x7F, 
-    0x7B, 0x83, 0x82, 0x79, 0x83, 0x77, 0x88, 0x74, 0x83, 0x77, 0x8B, 0x7C, 
-    0x82, 0x74, 0x8F, 0x77, 0x8C, 0x76, 0x7E, 0x77, 0x81, 0x7B, 0x78, 0x85, 
-    0x7C, 0x86, 0x84, 0x81, 0x8B, 0x84, 0x83, 0x8F, 0x7D, 0x8B, 0x7C, 0x7E, 
-    0x78, 0x84, 0x74, 0x88, 0x74, 0x8B, 0x7C, 0x77, 0x8A, 0x75, 0x8E, 0x79, 
-    0x8E, 0x76, 0x82, 0x7D, 0x7B, 0x76, 0x88, 0x6A, 0x87, 0x74, 0x8A, 0x79, 
-    0x84, 0x84, 0x75, 0x8A, 0x82, 0x87, 0x7F, 0x8C, 0x7A, 0x86, 0x83, 0x79, 
-    0x75, 0x91, 0x6F, 0x82, 0x7D, 0x81, 0x7C, 0x8C, 0x78, 0x8C, 0x79, 0x92, 
-    0x75, 0x90, 0x7C, 0x88, 0x72, 0x8C, 0x70, 0x81, 0x7B, 0x7B, 0x80, 0x7D, 
-    0x7E, 0x84, 0x7A, 0x8F, 0x78, 0x92, 0x79, 0x8C, 0x7B, 0x85, 0x7E, 0x75, 
-    0x80, 0x78, 0x7E, 0x7E, 0x7C, 0x7B, 0x8C, 0x77, 0x8E, 0x75, 0x93, 0x7B, 
-    0x85, 0x8B, 0x74, 0x8D, 0x6D, 0x8B, 0x68, 0x93, 0x66, 0x8C, 0x70, 0x90, 
-    0x71, 0x94, 0x77, 0x89, 0x87, 0x7E, 0x8A, 0x81, 0x7A, 0x88, 0x75, 0x79, 
-    0x8B, 0x6A, 0x95, 0x5F, 0xA1, 0x56, 0xAB, 0x5E, 0xA6, 0x5B, 0xB2, 0x4B, 
-    0xB4, 0x59, 0x9F, 0x61, 0x9C, 0x62, 0xA1, 0x5C, 0xAB, 0x4D, 0xB6, 0x4C, 
-    0xAF, 0x5E, 0x97, 0x6F, 0x95, 0x78, 0x7C, 0x95, 0x57, 0xB1, 0x4C, 0xAB, 
-    0x52, 0x9B, 0x6D, 0x85, 0x7F, 0x77, 0x88, 0x69, 0xA8, 0x50, 0xBD, 0x3B, 
-    0xCD, 0x3D, 0xC6, 0x4F, 0xB2, 0x4E, 0xBC, 0x40, 0xC8, 0x3A, 0xC8, 0x39, 
-    0xB7, 0x63, 0x73, 0xAD, 0x37, 0xD8, 0x16, 0xE9, 0x22, 0xB7, 0x61, 0x85, 
-    0x83, 0x71, 0x9E, 0x53, 0xB7, 0x51, 0xB0, 0x4F, 0xBB, 0x4B, 0xAC, 0x6A, 
-    0x8C, 0x72, 0x92, 0x68, 0xA0, 0x4F, 0xBD, 0x40, 0xB5, 0x5E, 0x8E, 0x7A, 
-    0x77, 0x98, 0x59, 0xAB, 0x68, 0x73, 0xA9, 0x44, 0xBE, 0x51, 0x9C, 0x7E, 
-    0x6E, 0xA2, 0x68, 0x81, 0x8D, 0x7B, 0x6B, 0xB2, 0x3E, 0xD8, 0x1C, 0xF7, 
-    0x09, 0xE6, 0x38, 0xAC, 0x71, 0x78, 0x9D, 0x59, 0xA7, 0x58, 0x9F, 0x62, 
-    0x93, 0x7C, 0x68, 0xA4, 0x4F, 0xA9, 0x5A, 0x9E, 0x5D, 0xA2, 0x53, 0xB2, 
-    0x58, 0x9B, 0x71, 0x78, 0x9D, 0x56, 0xB5, 0x4F, 0xB4, 0x50, 0xAF, 0x5B, 
-    0x97, 0x89, 0x5D, 0xB7, 0x4D, 0xA2, 0x7A, 0x76, 0x95, 0x6F, 0x7A, 0x9A, 
-    0x5F, 0x9D, 0x6F, 0x7D, 0x8F, 0x69, 0x93, 0x74, 0x83, 0x83, 0x79, 0x8A, 
-    0x68, 0x9E, 0x66, 0x93, 0x77, 0x7E, 0x98, 0x5B, 0xB0, 0x5C, 0x9C, 0x73, 
-    0x82, 0x8C, 0x6A, 0x91, 0x76, 0x89, 0x67, 0xAB, 0x40, 0xBE, 0x45, 0xB4, 
-    0x57, 0x93, 0x86, 0x5B, 0xB3, 0x4C, 0xB3, 0x52, 0xAD, 0x56, 0xA3, 0x67, 
-    0x95, 0x6E, 0x85, 0x87, 0x64, 0xA5, 0x5D, 0x98, 0x73, 0x91, 0x64, 0xA9, 
-    0x61, 0x8C, 0x92, 0x5A, 0xB9, 0x3A, 0xC3, 0x55, 0x82, 0xA2, 0x60, 0x7D, 
-    0x9D, 0x5F, 0x9B, 0x6A, 0x95, 0x7A, 0x6D, 0x98, 0x7D, 0x64, 0xB6, 0x3C, 
-    0xBF, 0x43, 0xA2, 0x93, 0x36, 0xE9, 0x22, 0xAF, 0x8A, 0x4D, 0xC9, 0x35, 
-    0xC8, 0x4D, 0x85, 0xB7, 0x1D, 0xF7, 0x14, 0xD6, 0x34, 0xB5, 0x86, 0x4A, 
-    0xD4, 0x28, 0xCA, 0x41, 0xAE, 0x6E, 0x79, 0x8F, 0x6F, 0x7D, 0x8B, 0x70, 
-    0x86, 0x81, 0x79, 0x82, 0x76, 0x91, 0x80, 0x5D, 0xC8, 0x22, 0xCF, 0x5B, 
-    0x7D, 0xA8, 0x41, 0xC8, 0x49, 0x95, 0xA1, 0x39, 0xD5, 0x3D, 0xAB, 0x68, 
-    0x88, 0x86, 0x70, 0x91, 0x83, 0x61, 0xBA, 0x3C, 0xBF, 0x6D, 0x55, 0xD6, 
-    0x29, 0xB2, 0x7C, 0x6B, 0x9E, 0x65, 0x89, 0x7C, 0x83, 0x70, 0x96, 0x65, 
-    0x91, 0x7B, 0x79, 0x88, 0x76, 0x8F, 0x62, 0xA6, 0x71, 0x70, 0xA9, 0x64, 
-    0x84, 0x87, 0x7D, 0x74, 0xA8, 0x4C, 0xAF, 0x5F, 0x84, 0x88, 0x70, 0x96, 
-    0x61, 0x98, 0x76, 0x7E, 0x81, 0x98, 0x50, 0xB5, 0x51, 0xAA, 0x57, 0xA5, 
-    0x6F, 0x7C, 0x9D, 0x5C, 0xA3, 0x62, 0xA3, 0x6D, 0x71, 0xBB, 0x35, 0xB2, 
-    0x89, 0x5A, 0xAA, 0x55, 0xA6, 0x63, 0x7D, 0xAD, 0x33, 0xCE, 0x3F, 0xA4, 
-    0x7E, 0x58, 0xD4, 0x11, 0xD3, 0x69, 0x5A, 0xB5, 0x6E, 0x58, 0xC6, 0x40, 
-    0x9C, 0x92, 0x43, 0xE1, 0x17, 0xC8, 0x79, 0x49, 0xC9, 0x4D, 0x9D, 0x81, 
-    0x5E, 0xCD, 0x35, 0x8F, 0xC5, 0x1B, 0xB9, 0x8C, 0x45, 0xB9, 0x5D, 0x8A, 
-    0x96, 0x47, 0xC4, 0x51, 0x80, 0xA6, 0x50, 0xA3, 0x71, 0x7A, 0x98, 0x5D, 
-    0xA1, 0x78, 0x6A, 0xA8, 0x67, 0x81, 0x98, 0x5E, 0xA2, 0x6F, 0x79, 0x96, 
-    0x75, 0x7E, 0x82, 0x8B, 0x67, 0x9F, 0x60, 0x8A, 0x92, 0x53, 0xA7, 0x79, 
-    0x64, 0x9D, 0x72, 0x79, 0x8C, 0x7D, 0x81, 0x7B, 0x80, 0x82, 0x7A, 0x84, 
-    0x80, 0x86, 0x6F, 0x95, 0x7E, 0x73, 0x98, 0x7B, 0x72, 0x9B, 0x6F, 0x82, 
-    0x93, 0x6A, 0x8D, 0x7F, 0x70, 0x95, 0x69, 0x86, 0x8B, 0x64, 0x92, 0x80, 
-    0x70, 0x92, 0x6F, 0x85, 0x80, 0x70, 0x91, 0x74, 0x7C, 0x8A, 0x77, 0x7D, 
-    0x84, 0x80, 0x76, 0x8F, 0x7F, 0x8B, 0x82, 0x8D, 0x86, 0x77, 0x97, 0x76, 
-    0x7A, 0x83, 0x79, 0xC0, 0xD6, 0xB4, 0xC3, 0xA6, 0x62, 0x74, 0x64, 0x42, 
-    0x3F, 0x28, 0x1B, 0x19, 0x31, 0x50, 0x60, 0x75, 0x92, 0x96, 0x8D, 0xE4, 
-    0xC3, 0x8B, 0xC7, 0xAA, 0x8A, 0x7E, 0x76, 0x97, 0x7E, 0x69, 0x88, 0x80, 
-    0x86, 0x9A, 0x80, 0x83, 0x8E, 0x83, 0x7E, 0x82, 0x8A, 0x82, 0x72, 0x77, 
-    0x7C, 0x78, 0x80, 0x88, 0x7E, 0x83, 0x82, 0x74, 0x75, 0x67, 0xAF, 0xFD, 
-    0xD7, 0xD6, 0xCE, 0x6D, 0x5C, 0x67, 0x42, 0x2F, 0x28, 0x14, 0x03, 0x14, 
-    0x48, 0x5E, 0x73, 0x9E, 0xA5, 0xA2, 0xB8, 0xBF, 0xAF, 0x9F, 0x92, 0x7A, 
-    0x6C, 0x7A, 0x83, 0x80, 0x89, 0x96, 0x99, 0xA0, 0xB2, 0xB0, 0x9F, 0x99, 
-    0x8C, 0x7C, 0x7C, 0x81, 0x7A, 0x74, 0x77, 0x77, 0x72, 0x79, 0x81, 0x7B, 
-    0x78, 0x77, 0x70, 0x67, 0x6C, 0x6E, 0x6C, 0x71, 0x76, 0x78, 0x7C, 0x82, 
-    0x80, 0x76, 0x75, 0xC4, 0xFD, 0xD9, 0xCC, 0xB4, 0x60, 0x53, 0x56, 0x3C, 
-    0x36, 0x29, 0x1A, 0x16, 0x34, 0x62, 0x78, 0x95, 0xB1, 0xA6, 0xA1, 0xAC, 
-    0xA5, 0x94, 0x86, 0x79, 0x6D, 0x70, 0x88, 0x92, 0x97, 0xA7, 0xAD, 0xAD, 
-    0xB3, 0xAF, 0xA3, 0x91, 0x86, 0x7D, 0x76, 0x7C, 0x7D, 0x7B, 0x7B, 0x7D, 
-    0x7A, 0x7A, 0x7C, 0x7C, 0x75, 0x73, 0x6E, 0x67, 0x65, 0x69, 0x6B, 0x70, 
-    0x7A, 0x7D, 0x7F, 0x81, 0x81, 0x7D, 0x75, 0x6C, 0xB6, 0xFD, 0xE1, 0xC4, 
-    0xA9, 0x63, 0x4C, 0x4C, 0x45, 0x40, 0x2A, 0x20, 0x21, 0x3B, 0x67, 0x82, 
-    0x9F, 0xAF, 0x9D, 0x98, 0x9D, 0x99, 0x8E, 0x7F, 0x79, 0x6F, 0x73, 0x8F, 
-    0x9D, 0xA2, 0xAB, 0xAE, 0xB1, 0xAF, 0xA8, 0x9B, 0x89, 0x7F, 0x79, 0x79, 
-    0x81, 0x81, 0x80, 0x7E, 0x7C, 0x7C, 0x7D, 0x7D, 0x78, 0x74, 0x6F, 0x6F, 
-    0x6C, 0x6A, 0x6A, 0x6C, 0x71, 0x78, 0x7F, 0x82, 0x81, 0x7E, 0x7E, 0x77, 
-    0x78, 0x68, 0x96, 0xF7, 0xFD, 0xD0, 0xAC, 0x74, 0x4A, 0x3D, 0x41, 0x44, 
-    0x2F, 0x1E, 0x20, 0x35, 0x5E, 0x82, 0xA6, 0xB3, 0x9F, 0x91, 0x8E, 0x90, 
-    0x89, 0x82, 0x7E, 0x73, 0x76, 0x8E, 0xA6, 0xB3, 0xB3, 0xB2, 0xAF, 0xAA, 
-    0xA4, 0x99, 0x8A, 0x7C, 0x72, 0x75, 0x7D, 0x84, 0x86, 0x84, 0x7E, 0x78, 
-    0x77, 0x79, 0x76, 0x73, 0x70, 0x6E, 0x6B, 0x6D, 0x6F, 0x70, 0x71, 0x75, 
-    0x78, 0x80, 0x82, 0x80, 0x7B, 0x78, 0x77, 0x76, 0x6B, 0x72, 0xD0, 0xFD, 
-    0xE0, 0xB5, 0x88, 0x5B, 0x3E, 0x41, 0x4C, 0x47, 0x37, 0x31, 0x3D, 0x5A, 
-    0x7F, 0xA2, 0xB1, 0x9F, 0x89, 0x7F, 0x7D, 0x7E, 0x81, 0x81, 0x79, 0x76, 
-    0x84, 0x98, 0xAD, 0xB5, 0xB1, 0xA2, 0x95, 0x94, 0x94, 0x91, 0x84, 0x76, 
-    0x6F, 0x72, 0x7D, 0x88, 0x8C, 0x85, 0x79, 0x75, 0x76, 0x79, 0x78, 0x72, 
-    0x6C, 0x69, 0x6F, 0x77, 0x7D, 0x7D, 0x77, 0x73, 0x75, 0x7B, 0x81, 0x81, 
-    0x7D, 0x77, 0x74, 0x76, 0x77, 0x75, 0x6E, 0xBF, 0xFD, 0xE8, 0xBA, 0x8D, 
-    0x60, 0x3C, 0x3B, 0x4C, 0x4E, 0x3E, 0x35, 0x45, 0x62, 0x87, 0xA9, 0xB6, 
-    0xA0, 0x7F, 0x73, 0x73, 0x7A, 0x80, 0x7F, 0x79, 0x77, 0x88, 0x9F, 0xB7, 
-    0xC0, 0xB8, 0xA5, 0x90, 0x86, 0x8A, 0x8E, 0x88, 0x7B, 0x73, 0x75, 0x7D, 
-    0x89, 0x8C, 0x85, 0x79, 0x72, 0x75, 0x79, 0x7A, 0x75, 0x6D, 0x67, 0x6A, 
-    0x74, 0x7E, 0x81, 0x7C, 0x78, 0x75, 0x79, 0x7E, 0x7E, 0x78, 0x74, 0x73, 
-    0x77, 0x7E, 0x81, 0x7D, 0x73, 0x76, 0xC9, 0xFD, 0xDD, 0xAE, 0x83, 0x56, 
-    0x39, 0x42, 0x55, 0x4F, 0x39, 0x3A, 0x52, 0x74, 0x9B, 0xB2, 0xAD, 0x88, 
-    0x6C, 0x6B, 0x74, 0x7C, 0x7C, 0x77, 0x72, 0x7C, 0x9D, 0xBD, 0xC8, 0xBA, 
-    0xA1, 0x8F, 0x87, 0x8B, 0x8C, 0x87, 0x7C, 0x75, 0x79, 0x84, 0x8F, 0x8E, 
-    0x83, 0x77, 0x73, 0x76, 0x7C, 0x7C, 0x75, 0x6D, 0x69, 0x6D, 0x76, 0x7E, 
-    0x80, 0x7A, 0x78, 0x79, 0x7D, 0x7D, 0x79, 0x75, 0x72, 0x73, 0x78, 0x7C, 
-    0x7E, 0x7F, 0x7F, 0x7B, 0x75, 0x82, 0xD3, 0xFD, 0xCE, 0x9D, 0x7D, 0x5A, 
-    0x48, 0x4C, 0x54, 0x42, 0x2C, 0x40, 0x65, 0x89, 0xA4, 0xA6, 0x97, 0x79, 
-    0x70, 0x7B, 0x7C, 0x73, 0x6A, 0x6A, 0x79, 0x96, 0xB5, 0xC2, 0xB9, 0xA6, 
-    0x99, 0x93, 0x93, 0x89, 0x79, 0x6E, 0x72, 0x84, 0x94, 0x94, 0x8B, 0x7F, 
-    0x78, 0x7B, 0x7F, 0x7C, 0x75, 0x6D, 0x70, 0x76, 0x7B, 0x7B, 0x74, 0x70, 
-    0x74, 0x7C, 0x84, 0x81, 0x7A, 0x75, 0x71, 0x74, 0x78, 0x7B, 0x78, 0x78, 
-    0x7B, 0x81, 0x84, 0x84, 0x7D, 0x76, 0x79, 0xAC, 0xFD, 0xE6, 0x9E, 0x84, 
-    0x6A, 0x59, 0x50, 0x4F, 0x40, 0x1F, 0x35, 0x66, 0x87, 0x9A, 0x95, 0x8F, 
-    0x83, 0x7F, 0x8C, 0x81, 0x66, 0x5D, 0x68, 0x82, 0x9B, 0xAB, 0xB2, 0xA7, 
-    0xA6, 0xAF, 0xA7, 0x96, 0x80, 0x70, 0x70, 0x7B, 0x8B, 0x91, 0x86, 0x7E, 
-    0x82, 0x87, 0x8A, 0x7D, 0x6F, 0x69, 0x6E, 0x7A, 0x7D, 0x77, 0x70, 0x6C, 
-    0x75, 0x80, 0x82, 0x7F, 0x7A, 0x7A, 0x7F, 0x7E, 0x79, 0x73, 0x71, 0x76, 
-    0x7C, 0x81, 0x80, 0x7E, 0x82, 0x85, 0x82, 0x7F, 0x80, 0x96, 0xEF, 0xFD, 
-    0xA4, 0x85, 0x78, 0x66, 0x51, 0x3F, 0x39, 0x14, 0x29, 0x60, 0x7B, 0x8B, 
-    0x83, 0x8D, 0x96, 0x91, 0x98, 0x82, 0x65, 0x64, 0x73, 0x8A, 0x95, 0x96, 
-    0xA1, 0xA5, 0xAE, 0xB8, 0xAA, 0x97, 0x84, 0x7A, 0x82, 0x82, 0x83, 0x81, 
-    0x7A, 0x81, 0x88, 0x89, 0x82, 0x75, 0x75, 0x79, 0x7A, 0x79, 0x6F, 0x6A, 
-    0x6F, 0x74, 0x7A, 0x78, 0x75, 0x7B, 0x7F, 0x83, 0x81, 0x79, 0x74, 0x75, 
-    0x79, 0x7D, 0x79, 0x78, 0x7B, 0x80, 0x8A, 0x8B, 0x84, 0x80, 0x7D, 0x7F, 
-    0x86, 0xD8, 0xFD, 0xA3, 0x80, 0x8A, 0x7E, 0x63, 0x40, 0x3A, 0x1A, 0x2E, 
-    0x62, 0x6C, 0x72, 0x70, 0x8C, 0xA5, 0x9E, 0x9D, 0x85, 0x6D, 0x75, 0x81, 
-    0x87, 0x7F, 0x7F, 0x97, 0xA3, 0xAE, 0xB2, 0xA3, 0x97, 0x91, 0x92, 0x8D, 
-    0x7C, 0x79, 0x7F, 0x7D, 0x83, 0x81, 0x7D, 0x7D, 0x7C, 0x83, 0x7C, 0x74, 
-    0x73, 0x6F, 0x71, 0x71, 0x70, 0x72, 0x74, 0x7A, 0x80, 0x7E, 0x7F, 0x7F, 
-    0x7D, 0x7C, 0x78, 0x77, 0x77, 0x75, 0x7C, 0x7E, 0x82, 0x83, 0x85, 0x86, 
-    0x84, 0x83, 0x81, 0x7A, 0xA1, 0xFD, 0xD1, 0x80, 0x91, 0x90, 0x7B, 0x4B, 
-    0x39, 0x25, 0x1A, 0x53, 0x5B, 0x59, 0x62, 0x7C, 0xA5, 0xA3, 0x9F, 0x95, 
-    0x80, 0x89, 0x8C, 0x82, 0x77, 0x73, 0x8F, 0x9C, 0x9F, 0xA9, 0x9F, 0x9E, 
-    0xA7, 0xA0, 0x93, 0x81, 0x82, 0x87, 0x78, 0x79, 0x75, 0x75, 0x7D, 0x7D, 
-    0x81, 0x7B, 0x7A, 0x7D, 0x75, 0x71, 0x70, 0x6D, 0x71, 0x72, 0x75, 0x79, 
-    0x78, 0x7F, 0x7F, 0x7D, 0x7D, 0x7A, 0x7D, 0x7B, 0x78, 0x78, 0x77, 0x7E, 
-    0x84, 0x83, 0x86, 0x83, 0x85, 0x84, 0x7F, 0x80, 0xCF, 0xFD, 0x9B, 0x85, 
-    0xA7, 0x92, 0x6C, 0x42, 0x32, 0x18, 0x37, 0x55, 0x3D, 0x48, 0x66, 0x91, 
-    0xA4, 0x9C, 0xA0, 0x97, 0x9E, 0xA5, 0x89, 0x78, 0x73, 0x83, 0x90, 0x87, 
-    0x90, 0x97, 0xA2, 0xAD, 0xA6, 0x9E, 0x96, 0x95, 0x96, 0x80, 0x71, 0x71, 
-    0x72, 0x78, 0x71, 0x73, 0x79, 0x7D, 0x85, 0x7A, 0x74, 0x75, 0x75, 0x73, 
-    0x6C, 0x6B, 0x73, 0x75, 0x7A, 0x78, 0x7A, 0x81, 0x81, 0x82, 0x7E, 0x7B, 
-    0x7E, 0x7D, 0x7D, 0x7E, 0x7D, 0x82, 0x83, 0x84, 0x82, 0x7C, 0x9E, 0xFD, 
-    0xD7, 0x7F, 0xAA, 0xB1, 0x86, 0x5F, 0x37, 0x19, 0x20, 0x45, 0x2C, 0x21, 
-    0x4B, 0x71, 0x92, 0x9B, 0x9E, 0xA4, 0xB3, 0xC3, 0xA1, 0x85, 0x81, 0x82, 
-    0x8A, 0x7C, 0x76, 0x80, 0x91, 0xA8, 0xA8, 0x9D, 0x9F, 0xA8, 0xAB, 0x94, 
-    0x84, 0x7C, 0x72, 0x75, 0x6C, 0x61, 0x6A, 0x75, 0x7C, 0x7A, 0x78, 0x7C, 
-    0x7C, 0x7E, 0x74, 0x6C, 0x70, 0x71, 0x72, 0x71, 0x73, 0x7B, 0x7F, 0x81, 
-    0x7E, 0x80, 0x86, 0x83, 0x7E, 0x7B, 0x7E, 0x85, 0x82, 0x7F, 0x80, 0x82, 
-    0x80, 0x8E, 0xF1, 0xEE, 0x8C, 0xB1, 0xC6, 0x94, 0x75, 0x47, 0x19, 0x18, 
-    0x38, 0x1A, 0x03, 0x30, 0x51, 0x71, 0x91, 0x97, 0x9F, 0xBF, 0xD7, 0xB8, 
-    0xA2, 0xA0, 0x8F, 0x8D, 0x82, 0x6D, 0x6D, 0x7F, 0x8E, 0x8D, 0x96, 0x9E, 
-    0xA3, 0xB3, 0xAA, 0x98, 0x8F, 0x86, 0x7D, 0x70, 0x65, 0x61, 0x65, 0x6F, 
-    0x6E, 0x6E, 0x76, 0x7B, 0x7E, 0x7C, 0x78, 0x79, 0x7A, 0x79, 0x73, 0x71, 
-    0x75, 0x77, 0x79, 0x78, 0x7B, 0x82, 0x83, 0x82, 0x82, 0x85, 0x86, 0x85, 
-    0x86, 0x80, 0x80, 0x8F, 0xC8, 0xDE, 0xA0, 0xA0, 0xBF, 0xA2, 0x86, 0x64, 
-    0x36, 0x29, 0x39, 0x28, 0x0B, 0x1C, 0x3A, 0x52, 0x73, 0x85, 0x8C, 0xA8, 
-    0xCD, 0xC8, 0xB7, 0xB6, 0xAC, 0xA2, 0x9B, 0x84, 0x70, 0x73, 0x7F, 0x7A, 
-    0x7A, 0x86, 0x8D, 0x9B, 0xA5, 0x9E, 0x9C, 0x9C, 0x96, 0x87, 0x7C, 0x73, 
-    0x69, 0x68, 0x67, 0x62, 0x66, 0x6C, 0x72, 0x74, 0x78, 0x7A, 0x7C, 0x80, 
-    0x7F, 0x7B, 0x7B, 0x7C, 0x7A, 0x78, 0x77, 0x79, 0x7B, 0x7C, 0x7E, 0x7F, 
-    0x83, 0x86, 0x88, 0x88, 0x86, 0x8A, 0xA1, 0xC9, 0xBD, 0x9C, 0xA8, 0xAB, 
-    0x95, 0x84, 0x67, 0x43, 0x3B, 0x42, 0x32, 0x21, 0x29, 0x38, 0x49, 0x64, 
-    0x76, 0x7C, 0x92, 0xB1, 0xBB, 0xBB, 0xBC, 0xB9, 0xB3, 0xB1, 0xA7, 0x92, 
-    0x85, 0x82, 0x7C, 0x76, 0x75, 0x75, 0x79, 0x82, 0x88, 0x88, 0x8C, 0x90, 
-    0x8F, 0x8D, 0x89, 0x82, 0x7C, 0x79, 0x75, 0x6F, 0x6B, 0x6A, 0x6A, 0x6C, 
-    0x6E, 0x70, 0x74, 0x79, 0x7D, 0x7F, 0x81, 0x83, 0x83, 0x85, 0x84, 0x83, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x83, 0x84, 0x88, 
-    0x8E, 0x8B, 0x87, 0x86, 0x84, 0x81, 0x7D, 0x78, 0x72, 0x6D, 0x6D, 0x6C, 
-    0x6A, 0x69, 0x69, 0x6C, 0x70, 0x76, 0x7A, 0x7E, 0x84, 0x89, 0x8D, 0x91, 
-    0x94, 0x96, 0x97, 0x97, 0x97, 0x95, 0x94, 0x92, 0x8F, 0x8C, 0x8B, 0x88, 
-    0x86, 0x84, 0x82, 0x7F, 0x7D, 0x7D, 0x7C, 0x7A, 0x78, 0x78, 0x77, 0x76, 
-    0x76, 0x76, 0x75, 0x74, 0x74, 0x75, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7B, 
-    0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 
-    0x85, 0x85, 0x85, 0x84, 0x84, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7D, 0x7C, 0x7C, 
-    0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x81, 
-    0x82, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x87, 
-    0x86, 0x85, 0x83, 0x82, 0x81, 0x7F, 0x7D, 0x7C, 0x7A, 0x7A, 0x78, 0x78, 
-    0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7B, 0x7C, 0x7E, 0x7E, 0x80, 
-    0x81, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x82, 
-    0x82, 0x83, 0x83, 0x84, 0x83, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 
-    0x82, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 
-    0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 
-    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x81, 0x81, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x7F, 0x83, 0x7B, 0x8F, 0x87, 
-    0x76, 0x7D, 0x74, 0x7F, 0x7C, 0x7D, 0x7B, 0x7C, 0x7D, 0x80, 0x83, 0x85, 
-    0x85, 0x84, 0x83, 0x84, 0x82, 0x8A, 0x83, 0x7E, 0x82, 0x81, 0x80, 0x7E, 
-    0x7C, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 
-    0x7E, 0x81, 0x7F, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 
-    0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 
-    0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7E, 
-    0x7E, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 
-    0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x87, 
-    0x87, 0x87, 0x87, 0x86, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x80, 
-    0x7F, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 
-    0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 
-    0x7F, 0x7F, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 
-    0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7E, 0x7E, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 
-    0x7A, 0x7B, 0x7B, 0x7B, 0x7D, 0x7E, 0x7F, 0x80, 0x82, 0x83, 0x84, 0x86, 
-    0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x86, 0x86, 0x85, 0x84, 
-    0x82, 0x82, 0x80, 0x7F, 0x7F, 0x7E, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 
-    0x7B, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 0x7D, 0x7E, 0x80, 0x81, 0x82, 
-    0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7F, 0x7E, 0x7D, 
-    0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x81, 0x82, 
-    0x83, 0x84, 0x85, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x85, 
-    0x84, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 
-    0x80, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x81, 0x80, 
-    0x7F, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x78, 0x78, 0x78, 0x79, 0x7B, 0x7C, 
-    0x7D, 0x7F, 0x81, 0x82, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x89, 0x89, 
-    0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x7F, 0x7E, 0x7D, 
-    0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 
-    0x7D, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x84, 0x84, 0x85, 0x85, 0x85, 
-    0x84, 0x83, 0x82, 0x81, 0x80, 0x7F, 0x7C, 0x7B, 0x79, 0x79, 0x78, 0x79, 
-    0x79, 0x79, 0x79, 0x7A, 0x7B, 0x7D, 0x7F, 0x81, 0x83, 0x85, 0x86, 0x88, 
-    0x89, 0x8A, 0x8B, 0x8B, 0x8B, 0x8A, 0x89, 0x88, 0x86, 0x85, 0x84, 0x83, 
-    0x81, 0x80, 0x7E, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 
-    0x81, 0x82, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 
-    0x7F, 0x7E, 0x7C, 0x7B, 0x7A, 0x79, 0x78, 0x78, 0x78, 0x78, 0x79, 0x7A, 
-    0x7C, 0x7D, 0x7F, 0x81, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8A, 0x8A, 
-    0x8A, 0x8A, 0x89, 0x88, 0x86, 0x85, 0x83, 0x81, 0x80, 0x7F, 0x7E, 0x7D, 
-    0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 
-    0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x82, 
-    0x83, 0x84, 0x84, 0x85, 0x85, 0x84, 0x84, 0x83, 0x82, 0x81, 0x7F, 0x7F, 
-    0x7C, 0x7C, 0x7A, 0x7B, 0x88, 0x79, 0x7C, 0x6F, 0x73, 0x6E, 0x7D, 0x7C, 
-    0x8A, 0x85, 0x8C, 0x81, 0x86, 0x7F, 0x88, 0x8E, 0x8E, 0x8E, 0x86, 0x85, 
-    0x7C, 0x85, 0x8F, 0x95, 0x8B, 0x7D, 0x69, 0x61, 0x64, 0x6D, 0x7F, 0x8B, 
-    0x94, 0x8F, 0x8A, 0x85, 0x80, 0x7B, 0x7C, 0x80, 0x80, 0x84, 0x81, 0x87, 
-    0x7F, 0x7F, 0x73, 0x70, 0x68, 0x6E, 0x71, 0x7C, 0x83, 0x8A, 0x8B, 0x89, 
-    0x87, 0x85, 0x85, 0x86, 0x88, 0x87, 0x85, 0x7F, 0x7E, 0x74, 0x7F, 0x96, 
-    0x98, 0x99, 0x7E, 0x5F, 0x38, 0x36, 0x34, 0x59, 0x72, 0x9E, 0xA1, 0xAD, 
-    0xA0, 0xA1, 0x97, 0xA5, 0xAB, 0xB1, 0xAA, 0x9E, 0x87, 0x71, 0x68, 0x66, 
-    0x6D, 0x75, 0x7F, 0x7C, 0x78, 0x73, 0x71, 0x74, 0x7E, 0x88, 0x8F, 0x8D, 
-    0x87, 0x7A, 0x70, 0x6C, 0x73, 0x7C, 0x90, 0x95, 0x9B, 0x98, 0x8B, 0x82, 
-    0x79, 0x72, 0x70, 0x68, 0x64, 0x5B, 0x4E, 0x48, 0x45, 0x49, 0x56, 0x64, 
-    0x77, 0x84, 0x90, 0x9B, 0xA2, 0xAB, 0xB6, 0xBD, 0xC3, 0xC4, 0xBF, 0xB5, 
-    0xA5, 0x97, 0x87, 0x7D, 0x73, 0x6E, 0x68, 0x64, 0x60, 0x5F, 0x62, 0x67, 
-    0x70, 0x77, 0x7F, 0x82, 0x85, 0x82, 0x81, 0x7F, 0x7E, 0x7D, 0x7C, 0x7D, 
-    0x79, 0x78, 0x75, 0x76, 0x74, 0x79, 0x7C, 0x82, 0x86, 0x88, 0x8A, 0x8A, 
-    0x90, 0x95, 0xA6, 0xB9, 0xBB, 0xC7, 0xB9, 0xA3, 0x86, 0x68, 0x52, 0x3B, 
-    0x2D, 0x28, 0x1E, 0x19, 0x1E, 0x22, 0x33, 0x4D, 0x6B, 0x8E, 0xA7, 0xC3, 
-    0xD2, 0xD6, 0xD8, 0xD4, 0xCD, 0xC3, 0xB8, 0xAE, 0x9E, 0x8E, 0x82, 0x6F, 
-    0x68, 0x61, 0x61, 0x65, 0x6C, 0x74, 0x79, 0x80, 0x80, 0x7F, 0x7D, 0x7C, 
-    0x7A, 0x78, 0x78, 0x77, 0x74, 0x74, 0x71, 0x71, 0x70, 0x74, 0x78, 0x7B, 
-    0x7E, 0x7F, 0x85, 0x86, 0x8A, 0x88, 0x89, 0x8E, 0x93, 0xB4, 0xD1, 0xD8, 
-    0xE8, 0xDF, 0xB8, 0x92, 0x62, 0x40, 0x22, 0x10, 0x10, 0x04, 0x03, 0x0E, 
-    0x12, 0x24, 0x43, 0x65, 0x8E, 0xB2, 0xD5, 0xEC, 0xEC, 0xF1, 0xE5, 0xD2, 
-    0xC5, 0xB2, 0xA0, 0x8C, 0x7D, 0x71, 0x5E, 0x5A, 0x5A, 0x5E, 0x6B, 0x7F, 
-    0x92, 0x9B, 0xA5, 0xA0, 0x94, 0x84, 0x78, 0x6C, 0x64, 0x65, 0x62, 0x5F, 
-    0x5D, 0x5F, 0x5F, 0x65, 0x6E, 0x78, 0x83, 0x8D, 0x91, 0x91, 0x94, 0x90, 
-    0x8B, 0x84, 0x80, 0x82, 0x85, 0xA8, 0xD5, 0xDA, 0xF8, 0xF6, 0xC6, 0x9D, 
-    0x63, 0x3A, 0x17, 0x06, 0x0A, 0x03, 0x06, 0x16, 0x19, 0x29, 0x4A, 0x66, 
-    0x8E, 0xB3, 0xD7, 0xED, 0xEB, 0xEF, 0xDC, 0xC0, 0xB2, 0x9B, 0x8A, 0x7C, 
-    0x72, 0x6B, 0x5E, 0x62, 0x6A, 0x6E, 0x87, 0x99, 0xAE, 0xB7, 0xBB, 0xB0, 
-    0x94, 0x7F, 0x5E, 0x4F, 0x44, 0x49, 0x4E, 0x52, 0x60, 0x60, 0x6A, 0x6E, 
-    0x7A, 0x84, 0x8F, 0x98, 0x97, 0x98, 0x91, 0x8B, 0x81, 0x79, 0x77, 0x7B, 
-    0x91, 0xC0, 0xD3, 0xE6, 0xFC, 0xD3, 0xB3, 0x81, 0x4B, 0x28, 0x08, 0x09, 
-    0x03, 0x03, 0x15, 0x1D, 0x26, 0x43, 0x60, 0x80, 0xA9, 0xCA, 0xE8, 0xEB, 
-    0xEA, 0xDF, 0xBB, 0xA7, 0x90, 0x7C, 0x73, 0x6D, 0x6D, 0x68, 0x6B, 0x74, 
-    0x7A, 0x89, 0xA0, 0xB6, 0xBF, 0xC3, 0xBD, 0x9E, 0x81, 0x63, 0x4B, 0x3E, 
-    0x40, 0x49, 0x4E, 0x5B, 0x64, 0x69, 0x6F, 0x7B, 0x83, 0x8B, 0x96, 0x97, 
-    0x93, 0x8C, 0x85, 0x7C, 0x75, 0x73, 0x78, 0x85, 0xB5, 0xD1, 0xDE, 0xFD, 
-    0xE2, 0xBF, 0x99, 0x62, 0x3B, 0x10, 0x0A, 0x09, 0x03, 0x15, 0x23, 0x2A, 
-    0x41, 0x5F, 0x7B, 0xA2, 0xC1, 0xE1, 0xE9, 0xE1, 0xDB, 0xB7, 0x9B, 0x86, 
-    0x71, 0x69, 0x65, 0x6D, 0x6E, 0x6F, 0x7B, 0x83, 0x8D, 0xA2, 0xB6, 0xC7, 
-    0xC6, 0xC1, 0xA7, 0x80, 0x63, 0x45, 0x3B, 0x39, 0x48, 0x55, 0x5D, 0x6C, 
-    0x6D, 0x72, 0x77, 0x82, 0x88, 0x8F, 0x94, 0x8F, 0x89, 0x7D, 0x79, 0x6F, 
-    0x71, 0x7A, 0x8A, 0xC1, 0xD5, 0xE6, 0xFD, 0xDC, 0xBD, 0x90, 0x5C, 0x36, 
-    0x10, 0x0C, 0x0A, 0x06, 0x19, 0x26, 0x2D, 0x47, 0x64, 0x85, 0xAC, 0xCB, 
-    0xEB, 0xEB, 0xE0, 0xD1, 0xA8, 0x8A, 0x74, 0x66, 0x62, 0x63, 0x6F, 0x72, 
-    0x74, 0x81, 0x8B, 0x96, 0xAC, 0xBE, 0xC8, 0xC4, 0xBB, 0xA2, 0x7B, 0x65, 
-    0x4D, 0x43, 0x43, 0x4C, 0x58, 0x59, 0x67, 0x6B, 0x6E, 0x78, 0x80, 0x88, 
-    0x88, 0x8C, 0x87, 0x80, 0x7C, 0x78, 0x75, 0x75, 0x81, 0x8A, 0xB1, 0xD8, 
-    0xE1, 0xFB, 0xF1, 0xCB, 0xA3, 0x6C, 0x42, 0x17, 0x03, 0x07, 0x03, 0x0B, 
-    0x20, 0x2C, 0x3D, 0x5C, 0x7D, 0xA3, 0xC0, 0xDC, 0xE9, 0xD8, 0xCA, 0xAE, 
-    0x8B, 0x75, 0x68, 0x67, 0x66, 0x6C, 0x76, 0x76, 0x7A, 0x88, 0x96, 0xA5, 
-    0xBA, 0xC7, 0xC6, 0xB7, 0xA6, 0x87, 0x67, 0x55, 0x49, 0x47, 0x49, 0x56, 
-    0x5E, 0x60, 0x6D, 0x71, 0x78, 0x7E, 0x87, 0x8A, 0x87, 0x88, 0x82, 0x7B, 
-    0x76, 0x76, 0x76, 0x7D, 0x8C, 0xA5, 0xD2, 0xE8, 0xF6, 0xFD, 0xD8, 0xAE, 
-    0x7B, 0x4A, 0x26, 0x07, 0x05, 0x05, 0x03, 0x10, 0x20, 0x31, 0x4F, 0x76, 
-    0x9F, 0xC3, 0xD9, 0xE9, 0xDE, 0xC3, 0xAD, 0x8F, 0x7A, 0x6F, 0x6D, 0x6E, 
-    0x6A, 0x6D, 0x71, 0x75, 0x83, 0x9A, 0xAF, 0xC0, 0xCB, 0xC6, 0xB2, 0x99, 
-    0x81, 0x67, 0x58, 0x52, 0x52, 0x54, 0x56, 0x5E, 0x61, 0x67, 0x73, 0x7B, 
-    0x83, 0x86, 0x88, 0x85, 0x80, 0x7D, 0x7B, 0x78, 0x76, 0x78, 0x7C, 0x87, 
-    0x98, 0xBC, 0xE6, 0xEF, 0xFA, 0xEF, 0xC0, 0x91, 0x5C, 0x38, 0x19, 0x04, 
-    0x08, 0x05, 0x03, 0x10, 0x25, 0x3F, 0x65, 0x93, 0xBD, 0xD6, 0xDC, 0xDD, 
-    0xC6, 0xAB, 0x99, 0x89, 0x7F, 0x74, 0x70, 0x6C, 0x61, 0x64, 0x70, 0x82, 
-    0x99, 0xB3, 0xC5, 0xC8, 0xBF, 0xAF, 0x98, 0x84, 0x74, 0x68, 0x60, 0x54, 
-    0x52, 0x4D, 0x51, 0x5B, 0x67, 0x76, 0x7D, 0x84, 0x85, 0x83, 0x82, 0x82, 
-    0x82, 0x7F, 0x7D, 0x79, 0x76, 0x77, 0x85, 0x98, 0xBA, 0xEB, 0xF6, 0xF6, 
-    0xE7, 0xB7, 0x8D, 0x5C, 0x41, 0x2E, 0x15, 0x10, 0x0A, 0x03, 0x0A, 0x22, 
-    0x46, 0x70, 0x97, 0xBA, 0xCE, 0xC8, 0xC5, 0xBC, 0xAC, 0xA4, 0x98, 0x8F, 
-    0x7A, 0x65, 0x5F, 0x5A, 0x61, 0x75, 0x8F, 0xA5, 0xAF, 0xB7, 0xB8, 0xAF, 
-    0xA6, 0xA0, 0x98, 0x83, 0x6F, 0x5D, 0x4B, 0x46, 0x4C, 0x5B, 0x67, 0x6E, 
-    0x77, 0x79, 0x7A, 0x7F, 0x88, 0x8C, 0x8A, 0x87, 0x7F, 0x77, 0x72, 0x73, 
-    0x7A, 0x87, 0x9B, 0xB9, 0xE6, 0xED, 0xE5, 0xDD, 0xB5, 0x90, 0x6A, 0x4F, 
-    0x3C, 0x1B, 0x0D, 0x07, 0x03, 0x0E, 0x2A, 0x4F, 0x72, 0x8F, 0xAA, 0xBD, 
-    0xBE, 0xC1, 0xC7, 0xBD, 0xB2, 0x9E, 0x8B, 0x77, 0x60, 0x61, 0x67, 0x6C, 
-    0x79, 0x87, 0x96, 0x9E, 0xA7, 0xB7, 0xB7, 0xB6, 0xAF, 0x9D, 0x81, 0x63, 
-    0x57, 0x4C, 0x4B, 0x4F, 0x5A, 0x5D, 0x5E, 0x6A, 0x76, 0x82, 0x8A, 0x92, 
-    0x90, 0x87, 0x83, 0x80, 0x7E, 0x78, 0x77, 0x7A, 0x84, 0x96, 0xC4, 0xF4, 
-    0xEE, 0xE5, 0xD0, 0xA7, 0x89, 0x67, 0x5B, 0x45, 0x1A, 0x09, 0x03, 0x03, 
-    0x17, 0x38, 0x5E, 0x78, 0x85, 0x9D, 0xB3, 0xBB, 0xCB, 0xD0, 0xC4, 0xAD, 
-    0x8F, 0x85, 0x78, 0x6C, 0x71, 0x6F, 0x6C, 0x6E, 0x7A, 0x95, 0xA7, 0xB9, 
-    0xBF, 0xB3, 0xA1, 0x8F, 0x88, 0x7A, 0x6D, 0x62, 0x53, 0x4A, 0x49, 0x59, 
-    0x66, 0x70, 0x78, 0x7C, 0x81, 0x84, 0x8F, 0x95, 0x8F, 0x84, 0x7C, 0x78, 
-    0x72, 0x73, 0x7D, 0x8D, 0xA5, 0xDB, 0xF2, 0xD7, 0xD5, 0xBB, 0x9E, 0x8A, 
-    0x64, 0x56, 0x2A, 0x03, 0x06, 0x04, 0x12, 0x29, 0x3D, 0x5A, 0x6B, 0x84, 
-    0xAF, 0xC4, 0xCA, 0xD0, 0xC2, 0xB8, 0xAA, 0x9C, 0x9C, 0x82, 0x6F, 0x6D, 
-    0x69, 0x77, 0x81, 0x99, 0x9F, 0x91, 0x96, 0x96, 0x9C, 0x94, 0x8B, 0x81, 
-    0x67, 0x65, 0x66, 0x6B, 0x67, 0x63, 0x6A, 0x6B, 0x79, 0x85, 0x8C, 0x8C, 
-    0x85, 0x87, 0x84, 0x84, 0x81, 0x7A, 0x77, 0x6E, 0x77, 0x8D, 0xC1, 0xF3, 
-    0xC9, 0xB6, 0xC1, 0xA0, 0x9C, 0x7E, 0x5C, 0x40, 0x03, 0x0C, 0x23, 0x15, 
-    0x21, 0x2C, 0x3E, 0x5F, 0x7A, 0xA7, 0xBB, 0xAB, 0xBB, 0xC5, 0xC1, 0xC4, 
-    0xAD, 0xA2, 0x8E, 0x7C, 0x96, 0x8D, 0x80, 0x7A, 0x77, 0x85, 0x82, 0x94, 
-    0x90, 0x81, 0x83, 0x83, 0x8C, 0x7E, 0x77, 0x74, 0x6B, 0x72, 0x75, 0x7B, 
-    0x74, 0x73, 0x7D, 0x80, 0x85, 0x7E, 0x81, 0x7E, 0x79, 0x82, 0x7F, 0x7C, 
-    0x71, 0x83, 0xC2, 0xF1, 0xC1, 0x9E, 0xC7, 0xA4, 0x95, 0x7E, 0x44, 0x36, 
-    0x03, 0x14, 0x30, 0x09, 0x1A, 0x35, 0x54, 0x78, 0x83, 0x9E, 0xA6, 0x9F, 
-    0xBB, 0xC6, 0xAC, 0xA7, 0xA0, 0x9F, 0xA0, 0x9C, 0xA1, 0x87, 0x83, 0x90, 
-    0x8F, 0x8C, 0x7E, 0x88, 0x8A, 0x8A, 0x8F, 0x83, 0x7F, 0x7B, 0x81, 0x80, 
-    0x72, 0x73, 0x6E, 0x71, 0x72, 0x6E, 0x70, 0x6E, 0x75, 0x80, 0x7D, 0x7A, 
-    0x7E, 0x85, 0x86, 0x7C, 0x89, 0xBD, 0xEE, 0xBC, 0x96, 0xCF, 0xAF, 0x85, 
-    0x6F, 0x3A, 0x3E, 0x20, 0x1B, 0x30, 0x03, 0x1A, 0x4A, 0x54, 0x68, 0x6D, 
-    0x87, 0xA6, 0x9D, 0xAA, 0xB2, 0xA0, 0xB0, 0xAE, 0xA1, 0x9B, 0x8F, 0xA1, 
-    0x9B, 0x92, 0x8A, 0x81, 0x92, 0x8C, 0x8D, 0x8A, 0x8C, 0x98, 0x90, 0x8D, 
-    0x81, 0x80, 0x80, 0x7A, 0x79, 0x6E, 0x72, 0x75, 0x73, 0x72, 0x70, 0x75, 
-    0x79, 0x7A, 0x76, 0x77, 0x7D, 0x79, 0x79, 0x89, 0xBC, 0xD9, 0x95, 0x9E, 
-    0xDE, 0x9F, 0x7C, 0x66, 0x4A, 0x55, 0x23, 0x1B, 0x24, 0x0C, 0x35, 0x46, 
-    0x42, 0x63, 0x76, 0x95, 0xA3, 0x92, 0xB0, 0xBE, 0xB0, 0xB8, 0xA3, 0xA5, 
-    0xA7, 0x94, 0x99, 0x89, 0x84, 0x8F, 0x88, 0x83, 0x81, 0x91, 0x92, 0x90, 
-    0x96, 0x8E, 0x90, 0x8B, 0x83, 0x79, 0x76, 0x78, 0x6D, 0x6C, 0x69, 0x6C, 
-    0x6E, 0x6F, 0x71, 0x72, 0x7B, 0x7A, 0x78, 0x80, 0x7B, 0x86, 0x9E, 0xCC, 
-    0xC4, 0x8B, 0xD3, 0xD9, 0x7C, 0x81, 0x6B, 0x5E, 0x48, 0x12, 0x26, 0x24, 
-    0x16, 0x30, 0x30, 0x49, 0x71, 0x71, 0x8B, 0x98, 0x9B, 0xBE, 0xB0, 0xAA, 
-    0xBA, 0xA9, 0xAC, 0x9A, 0x8F, 0x9D, 0x8A, 0x8F, 0x82, 0x84, 0x8F, 0x86, 
-    0x8A, 0x88, 0x98, 0x93, 0x8C, 0x8C, 0x85, 0x87, 0x78, 0x79, 0x72, 0x74, 
-    0x71, 0x6B, 0x6F, 0x6E, 0x75, 0x6F, 0x76, 0x77, 0x78, 0x7E, 0x76, 0x82, 
-    0x8F, 0xA8, 0xC5, 0x9A, 0xAF, 0xDC, 0x96, 0x83, 0x8B, 0x69, 0x5B, 0x33, 
-    0x29, 0x36, 0x1E, 0x24, 0x34, 0x3D, 0x61, 0x64, 0x72, 0x95, 0x92, 0xA5, 
-    0xB2, 0xAA, 0xB8, 0xAF, 0xA8, 0xA8, 0x94, 0x9B, 0x94, 0x83, 0x8A, 0x86, 
-    0x88, 0x7F, 0x88, 0x8D, 0x8C, 0x91, 0x8C, 0x90, 0x8A, 0x88, 0x80, 0x7E, 
-    0x7B, 0x73, 0x73, 0x6F, 0x71, 0x6D, 0x70, 0x6F, 0x71, 0x78, 0x72, 0x78, 
-    0x7A, 0x7F, 0x8C, 0x93, 0xBA, 0xAC, 0x9E, 0xCF, 0xAD, 0x89, 0x97, 0x79, 
-    0x65, 0x50, 0x36, 0x3A, 0x2C, 0x21, 0x32, 0x37, 0x50, 0x5E, 0x63, 0x87, 
-    0x8E, 0x94, 0xAC, 0xAA, 0xB0, 0xB2, 0xA8, 0xAA, 0xA0, 0x98, 0x97, 0x8A, 
-    0x89, 0x83, 0x81, 0x84, 0x84, 0x88, 0x8D, 0x91, 0x8E, 0x8E, 0x8D, 0x88, 
-    0x84, 0x7F, 0x7C, 0x77, 0x74, 0x70, 0x6F, 0x6E, 0x6E, 0x70, 0x6F, 0x74, 
-    0x75, 0x77, 0x79, 0x7F, 0x8A, 0x8F, 0xAE, 0xAD, 0xA2, 0xC2, 0xB1, 0x94, 
-    0x9B, 0x84, 0x6D, 0x5B, 0x44, 0x3E, 0x31, 0x29, 0x31, 0x35, 0x49, 0x58, 
-    0x5C, 0x79, 0x88, 0x8D, 0xA2, 0xA9, 0xAE, 0xB0, 0xAB, 0xAC, 0xA2, 0x98, 
-    0x97, 0x8D, 0x86, 0x8B, 0x86, 0x82, 0x88, 0x89, 0x88, 0x8C, 0x8E, 0x89, 
-    0x89, 0x89, 0x82, 0x7E, 0x7E, 0x78, 0x73, 0x75, 0x75, 0x71, 0x72, 0x75, 
-    0x74, 0x74, 0x78, 0x7A, 0x79, 0x80, 0x88, 0x8A, 0xA1, 0xA8, 0xA1, 0xB1, 
-    0xAD, 0x9A, 0x94, 0x87, 0x76, 0x61, 0x50, 0x49, 0x39, 0x31, 0x38, 0x39, 
-    0x45, 0x56, 0x60, 0x70, 0x7F, 0x8D, 0x9A, 0xA0, 0xAA, 0xAD, 0xA8, 0xA8, 
-    0xA4, 0x9C, 0x97, 0x95, 0x8E, 0x87, 0x87, 0x84, 0x80, 0x81, 0x86, 0x88, 
-    0x88, 0x8A, 0x89, 0x87, 0x84, 0x82, 0x7F, 0x7E, 0x7D, 0x7A, 0x77, 0x76, 
-    0x75, 0x73, 0x73, 0x75, 0x75, 0x75, 0x77, 0x7D, 0x81, 0x89, 0x9E, 0xA5, 
-    0xA2, 0xAD, 0xAF, 0x9E, 0x90, 0x8B, 0x7D, 0x60, 0x50, 0x4E, 0x3B, 0x2D, 
-    0x38, 0x40, 0x41, 0x4F, 0x65, 0x71, 0x78, 0x8C, 0x9F, 0xA1, 0xA6, 0xB0, 
-    0xAE, 0xA7, 0xA3, 0xA1, 0x99, 0x92, 0x8C, 0x88, 0x87, 0x84, 0x7F, 0x81, 
-    0x88, 0x85, 0x82, 0x87, 0x89, 0x82, 0x80, 0x83, 0x80, 0x79, 0x7C, 0x7B, 
-    0x76, 0x77, 0x78, 0x75, 0x75, 0x77, 0x77, 0x75, 0x7C, 0x84, 0x89, 0x9B, 
-    0xAB, 0xA8, 0xA7, 0xB2, 0xA9, 0x8E, 0x85, 0x80, 0x63, 0x4A, 0x46, 0x3C, 
-    0x2A, 0x2D, 0x3D, 0x40, 0x48, 0x61, 0x72, 0x79, 0x8A, 0x9F, 0xA6, 0xA7, 
-    0xB0, 0xB2, 0xAA, 0xA6, 0xA5, 0x9E, 0x94, 0x8C, 0x88, 0x80, 0x7A, 0x7C, 
-    0x7D, 0x7F, 0x83, 0x88, 0x89, 0x88, 0x89, 0x8A, 0x88, 0x87, 0x86, 0x82, 
-    0x7F, 0x7C, 0x78, 0x75, 0x73, 0x73, 0x71, 0x71, 0x71, 0x72, 0x78, 0x81, 
-    0x8E, 0xA2, 0xAC, 0xA5, 0xAB, 0xB3, 0x9F, 0x8C, 0x88, 0x73, 0x55, 0x4A, 
-    0x44, 0x31, 0x27, 0x35, 0x3E, 0x3F, 0x54, 0x6A, 0x71, 0x80, 0x96, 0xA2, 
-    0xA5, 0xAE, 0xB6, 0xAF, 0xA9, 0xAB, 0xA6, 0x9B, 0x94, 0x93, 0x8D, 0x80, 
-    0x80, 0x83, 0x7D, 0x7C, 0x83, 0x82, 0x7C, 0x80, 0x83, 0x7E, 0x7E, 0x84, 
-    0x80, 0x7D, 0x81, 0x80, 0x79, 0x7A, 0x7C, 0x77, 0x75, 0x76, 0x77, 0x79, 
-    0x83, 0x92, 0x9A, 0x98, 0xA2, 0xA9, 0x9A, 0x95, 0x94, 0x80, 0x6A, 0x60, 
-    0x54, 0x40, 0x37, 0x3F, 0x3D, 0x3B, 0x4D, 0x5A, 0x60, 0x72, 0x85, 0x90, 
-    0x99, 0xA6, 0xAE, 0xAC, 0xAD, 0xB0, 0xAB, 0xA4, 0x9E, 0x99, 0x90, 0x86, 
-    0x84, 0x80, 0x7B, 0x7C, 0x7F, 0x7D, 0x7D, 0x81, 0x80, 0x80, 0x85, 0x87, 
-    0x84, 0x85, 0x85, 0x80, 0x7D, 0x7D, 0x78, 0x73, 0x73, 0x70, 0x6C, 0x70, 
-    0x77, 0x7F, 0x91, 0x97, 0x98, 0xA6, 0xA7, 0x9B, 0x9B, 0x96, 0x80, 0x6F, 
-    0x66, 0x55, 0x41, 0x3F, 0x41, 0x39, 0x3F, 0x51, 0x57, 0x61, 0x76, 0x85, 
-    0x8E, 0x9B, 0xAA, 0xAC, 0xAB, 0xB1, 0xAE, 0xA7, 0xA7, 0x9E, 0x94, 0x91, 
-    0x89, 0x83, 0x83, 0x81, 0x7C, 0x7D, 0x7E, 0x79, 0x7A, 0x7D, 0x7B, 0x7C, 
-    0x80, 0x7F, 0x7D, 0x80, 0x7F, 0x7B, 0x7C, 0x7B, 0x77, 0x76, 0x76, 0x75, 
-    0x79, 0x83, 0x92, 0x95, 0x97, 0xA6, 0xA5, 0x99, 0x9D, 0x97, 0x80, 0x74, 
-    0x6B, 0x58, 0x45, 0x43, 0x41, 0x37, 0x3E, 0x4E, 0x50, 0x5B, 0x71, 0x7D, 
-    0x87, 0x99, 0xA7, 0xA9, 0xAC, 0xB4, 0xAD, 0xA5, 0xAA, 0xA3, 0x93, 0x91, 
-    0x8F, 0x83, 0x80, 0x83, 0x7D, 0x79, 0x7F, 0x7E, 0x79, 0x7D, 0x80, 0x7D, 
-    0x80, 0x83, 0x81, 0x80, 0x81, 0x7F, 0x7C, 0x7C, 0x78, 0x76, 0x75, 0x71, 
-    0x71, 0x76, 0x7B, 0x86, 0x92, 0x91, 0x9A, 0xA4, 0x9C, 0x9A, 0x9D, 0x8D, 
-    0x7D, 0x76, 0x68, 0x54, 0x4B, 0x49, 0x3F, 0x3D, 0x4B, 0x4E, 0x53, 0x67, 
-    0x74, 0x7E, 0x90, 0x9F, 0xA4, 0xA9, 0xB1, 0xAF, 0xA8, 0xAB, 0xA7, 0x9B, 
-    0x96, 0x94, 0x89, 0x84, 0x86, 0x7F, 0x7A, 0x7E, 0x7C, 0x76, 0x79, 0x7A, 
-    0x77, 0x7B, 0x80, 0x7D, 0x7E, 0x82, 0x7F, 0x7D, 0x7F, 0x7D, 0x79, 0x7A, 
-    0x78, 0x77, 0x7B, 0x83, 0x8A, 0x8C, 0x91, 0x99, 0x95, 0x94, 0x97, 0x8D, 
-    0x81, 0x7D, 0x71, 0x62, 0x59, 0x53, 0x4A, 0x45, 0x4D, 0x4F, 0x52, 0x60, 
-    0x6B, 0x74, 0x85, 0x93, 0x9B, 0xA3, 0xAB, 0xAC, 0xAA, 0xAB, 0xA7, 0xA0, 
-    0x9C, 0x95, 0x8D, 0x8A, 0x85, 0x7F, 0x7D, 0x7C, 0x78, 0x79, 0x7A, 0x79, 
-    0x7A, 0x7D, 0x7F, 0x80, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7D, 0x7C, 0x7A, 
-    0x77, 0x76, 0x76, 0x75, 0x78, 0x7F, 0x84, 0x85, 0x8B, 0x90, 0x8E, 0x91, 
-    0x93, 0x8B, 0x85, 0x81, 0x77, 0x6C, 0x65, 0x5E, 0x55, 0x53, 0x56, 0x55, 
-    0x5A, 0x65, 0x6C, 0x75, 0x84, 0x8E, 0x96, 0x9F, 0xA5, 0xA6, 0xA6, 0xA7, 
-    0xA3, 0x9F, 0x9B, 0x93, 0x8E, 0x8A, 0x84, 0x80, 0x7F, 0x7B, 0x7A, 0x7D, 
-    0x7B, 0x7B, 0x7E, 0x7E, 0x7C, 0x7F, 0x7F, 0x7C, 0x7C, 0x7C, 0x78, 0x78, 
-    0x79, 0x76, 0x76, 0x77, 0x76, 0x76, 0x79, 0x7A, 0x7C, 0x83, 0x85, 0x86, 
-    0x8C, 0x8E, 0x8D, 0x90, 0x8F, 0x89, 0x86, 0x82, 0x7A, 0x72, 0x6E, 0x67, 
-    0x60, 0x60, 0x5F, 0x5E, 0x64, 0x6B, 0x70, 0x79, 0x84, 0x8B, 0x92, 0x9A, 
-    0x9E, 0xA0, 0xA2, 0xA2, 0x9E, 0x9B, 0x96, 0x8F, 0x8B, 0x86, 0x80, 0x7D, 
-    0x7B, 0x78, 0x78, 0x79, 0x7A, 0x7B, 0x7D, 0x7E, 0x7F, 0x81, 0x81, 0x80, 
-    0x7E, 0x7B, 0x79, 0x77, 0x76, 0x74, 0x73, 0x73, 0x73, 0x74, 0x77, 0x79, 
-    0x7E, 0x82, 0x85, 0x8A, 0x8D, 0x8E, 0x90, 0x90, 0x8D, 0x8B, 0x87, 0x81, 
-    0x7C, 0x77, 0x72, 0x6C, 0x69, 0x67, 0x67, 0x6A, 0x6E, 0x72, 0x78, 0x7E, 
-    0x84, 0x89, 0x8F, 0x93, 0x95, 0x97, 0x98, 0x96, 0x93, 0x91, 0x8E, 0x89, 
-    0x86, 0x84, 0x80, 0x7D, 0x7D, 0x7C, 0x7B, 0x7C, 0x7D, 0x7D, 0x7D, 0x7E, 
-    0x7E, 0x7D, 0x7D, 0x7C, 0x7A, 0x7A, 0x7A, 0x78, 0x78, 0x79, 0x79, 0x79, 
-    0x7B, 0x7D, 0x80, 0x83, 0x85, 0x87, 0x89, 0x8A, 0x8A, 0x8B, 0x89, 0x86, 
-    0x83, 0x80, 0x7C, 0x78, 0x74, 0x70, 0x6E, 0x6D, 0x6D, 0x6E, 0x71, 0x74, 
-    0x77, 0x7C, 0x80, 0x84, 0x88, 0x8C, 0x8E, 0x90, 0x91, 0x91, 0x90, 0x8F, 
-    0x8E, 0x8B, 0x89, 0x87, 0x84, 0x82, 0x81, 0x80, 0x7E, 0x7E, 0x7E, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7A, 0x7B, 0x7C, 
-    0x7C, 0x7D, 0x7F, 0x80, 0x82, 0x84, 0x85, 0x86, 0x87, 0x87, 0x86, 0x86, 
-    0x84, 0x82, 0x7F, 0x7C, 0x79, 0x77, 0x75, 0x73, 0x72, 0x72, 0x72, 0x73, 
-    0x75, 0x77, 0x79, 0x7C, 0x7F, 0x82, 0x85, 0x88, 0x8A, 0x8B, 0x8C, 0x8D, 
-    0x8E, 0x8E, 0x8D, 0x8C, 0x8B, 0x89, 0x87, 0x86, 0x85, 0x83, 0x81, 0x80, 
-    0x7E, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x79, 0x79, 0x7A, 0x7B, 0x7B, 0x7C, 
-    0x7D, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x84, 0x84, 0x85, 0x86, 0x85, 
-    0x85, 0x84, 0x83, 0x82, 0x80, 0x7E, 0x7C, 0x7A, 0x78, 0x77, 0x75, 0x75, 
-    0x74, 0x74, 0x75, 0x76, 0x78, 0x79, 0x7B, 0x7E, 0x80, 0x83, 0x86, 0x88, 
-    0x8A, 0x8B, 0x8D, 0x8D, 0x8E, 0x8D, 0x8C, 0x8B, 0x89, 0x87, 0x85, 0x84, 
-    0x82, 0x80, 0x7F, 0x7D, 0x7D, 0x7C, 0x7D, 0x7A, 0x81, 0x7C, 0x77, 0x80, 
-    0x7C, 0x7E, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x82, 0x82, 0x83, 0x83, 
-    0x83, 0x83, 0x82, 0x82, 0x80, 0x7F, 0x7D, 0x7B, 0x79, 0x77, 0x76, 0x75, 
-    0x74, 0x74, 0x73, 0x75, 0x75, 0x7E, 0x7B, 0x7B, 0x7F, 0x80, 0x87, 0x8F, 
-    0x8B, 0x8C, 0x8B, 0x8B, 0x8B, 0x8D, 0x8B, 0x8A, 0x8A, 0x88, 0x84, 0x83, 
-    0x83, 0x7E, 0x93, 0x8C, 0x83, 0x7B, 0x74, 0x6F, 0x6F, 0x67, 0x67, 0x65, 
-    0x6C, 0x71, 0x78, 0x76, 0x79, 0x7D, 0x89, 0xA2, 0xD7, 0xDA, 0xE0, 0xDB, 
-    0xB0, 0x98, 0x93, 0x68, 0x4F, 0x2C, 0x0E, 0x03, 0x11, 0x30, 0x4A, 0x5E, 
-    0x82, 0x87, 0xA1, 0xC2, 0xC0, 0xBA, 0xB2, 0x8F, 0x85, 0x87, 0x79, 0x71, 
-    0x76, 0x70, 0x72, 0x93, 0xA3, 0x97, 0x95, 0x8C, 0x72, 0x7B, 0x83, 0x6F, 
-    0x6C, 0x75, 0x6E, 0x7E, 0x91, 0x8D, 0x85, 0x8C, 0x86, 0x7E, 0x81, 0x7C, 
-    0x6C, 0x67, 0x75, 0x82, 0xD2, 0xFD, 0xD4, 0xC6, 0x9B, 0x51, 0x5F, 0x58, 
-    0x35, 0x2C, 0x21, 0x22, 0x45, 0x6E, 0x93, 0x92, 0x97, 0x9D, 0x89, 0x9C, 
-    0xA0, 0x71, 0x68, 0x5A, 0x4E, 0x7B, 0x9A, 0xA9, 0xB6, 0xB0, 0xB9, 0xC1, 
-    0xBC, 0xA8, 0x7B, 0x60, 0x60, 0x5F, 0x71, 0x84, 0x7B, 0x7F, 0x89, 0x88, 
-    0x8F, 0x8C, 0x74, 0x6E, 0x6E, 0x70, 0x79, 0x7C, 0x73, 0x70, 0x71, 0x77, 
-    0x7F, 0x80, 0x7D, 0x72, 0x6F, 0x7E, 0xCD, 0xFD, 0xDE, 0xBE, 0x91, 0x4E, 
-    0x53, 0x4E, 0x41, 0x3C, 0x25, 0x2F, 0x5E, 0x80, 0xA9, 0xAC, 0x92, 0x84, 
-    0x6B, 0x6E, 0x7D, 0x66, 0x61, 0x5F, 0x60, 0x92, 0xB8, 0xC9, 0xD2, 0xB2, 
-    0x98, 0x9A, 0x93, 0x86, 0x79, 0x60, 0x60, 0x71, 0x89, 0x99, 0x9C, 0x87, 
-    0x7E, 0x79, 0x79, 0x7E, 0x7B, 0x71, 0x71, 0x73, 0x7D, 0x88, 0x85, 0x7D, 
-    0x7A, 0x77, 0x7C, 0x80, 0x7D, 0x72, 0x6B, 0x63, 0x9D, 0xFD, 0xFD, 0xCF, 
-    0xB3, 0x63, 0x38, 0x45, 0x3D, 0x41, 0x2F, 0x21, 0x4C, 0x70, 0x96, 0xC7, 
-    0xAA, 0x86, 0x6C, 0x50, 0x63, 0x6F, 0x66, 0x77, 0x6E, 0x7C, 0xB1, 0xCA, 
-    0xD6, 0xCB, 0x9C, 0x86, 0x81, 0x78, 0x7A, 0x76, 0x69, 0x71, 0x81, 0x92, 
-    0x9A, 0x92, 0x7E, 0x73, 0x70, 0x79, 0x83, 0x83, 0x7B, 0x79, 0x78, 0x80, 
-    0x86, 0x87, 0x7F, 0x7A, 0x76, 0x7A, 0x7B, 0x79, 0x71, 0x69, 0x71, 0xCA, 
-    0xFD, 0xDA, 0xBB, 0x92, 0x3F, 0x35, 0x40, 0x45, 0x47, 0x35, 0x46, 0x6C, 
-    0x78, 0xB1, 0xC2, 0x90, 0x74, 0x56, 0x46, 0x5E, 0x6C, 0x82, 0x89, 0x83, 
-    0xA1, 0xBA, 0xC5, 0xCD, 0xB4, 0x84, 0x6A, 0x68, 0x6F, 0x7E, 0x8C, 0x8A, 
-    0x82, 0x86, 0x8A, 0x8E, 0x86, 0x7B, 0x73, 0x70, 0x78, 0x87, 0x89, 0x81, 
-    0x7A, 0x77, 0x78, 0x80, 0x88, 0x85, 0x7D, 0x75, 0x75, 0x72, 0x74, 0x70, 
-    0x6C, 0x64, 0xA5, 0xFD, 0xF1, 0xC8, 0xAF, 0x58, 0x23, 0x31, 0x3D, 0x48, 
-    0x42, 0x46, 0x6A, 0x73, 0x96, 0xC6, 0xA7, 0x7A, 0x64, 0x45, 0x48, 0x63, 
-    0x7F, 0x95, 0x92, 0x9B, 0xB3, 0xB8, 0xBD, 0xBA, 0x98, 0x6D, 0x62, 0x66, 
-    0x75, 0x89, 0x99, 0x93, 0x87, 0x84, 0x84, 0x82, 0x7C, 0x79, 0x76, 0x74, 
-    0x7D, 0x85, 0x84, 0x7C, 0x7B, 0x78, 0x79, 0x82, 0x89, 0x85, 0x7C, 0x76, 
-    0x72, 0x6F, 0x73, 0x73, 0x6E, 0x69, 0xB0, 0xFD, 0xEC, 0xC3, 0xAA, 0x52, 
-    0x20, 0x2F, 0x3D, 0x4B, 0x46, 0x50, 0x73, 0x76, 0x9A, 0xC6, 0xA4, 0x76, 
-    0x5F, 0x3F, 0x42, 0x5F, 0x83, 0x9E, 0x99, 0xA4, 0xB7, 0xB4, 0xB7, 0xB4, 
-    0x90, 0x67, 0x62, 0x6C, 0x80, 0x94, 0xA2, 0x94, 0x7F, 0x7B, 0x7B, 0x7F, 
-    0x7D, 0x7F, 0x78, 0x73, 0x7B, 0x85, 0x85, 0x7C, 0x7B, 0x76, 0x7A, 0x83, 
-    0x8D, 0x87, 0x7D, 0x75, 0x6E, 0x6F, 0x74, 0x7B, 0x78, 0x71, 0x68, 0x7E, 
-    0xDC, 0xFD, 0xD6, 0xB6, 0x7F, 0x2B, 0x22, 0x3A, 0x4C, 0x57, 0x4C, 0x65, 
-    0x76, 0x80, 0xB0, 0xBF, 0x8A, 0x67, 0x4C, 0x39, 0x50, 0x74, 0x9C, 0xA4, 
-    0x9D, 0xAB, 0xB3, 0xAF, 0xB3, 0xA6, 0x7A, 0x5C, 0x5D, 0x6F, 0x84, 0xA5, 
-    0xB6, 0x9F, 0x80, 0x74, 0x70, 0x71, 0x78, 0x81, 0x7D, 0x74, 0x7A, 0x80, 
-    0x7C, 0x75, 0x78, 0x76, 0x78, 0x86, 0x90, 0x8B, 0x7E, 0x76, 0x6D, 0x6D, 
-    0x75, 0x7E, 0x7E, 0x78, 0x6F, 0x6E, 0x78, 0xC8, 0xFD, 0xDB, 0xB0, 0x88, 
-    0x3F, 0x23, 0x3E, 0x4F, 0x5C, 0x52, 0x5F, 0x7A, 0x80, 0xA1, 0xC0, 0x95, 
-    0x64, 0x4F, 0x3D, 0x4B, 0x6E, 0x96, 0xA8, 0x9E, 0xA2, 0xB3, 0xAF, 0xAF, 
-    0xA6, 0x82, 0x5C, 0x4E, 0x6A, 0x90, 0xB1, 0xBD, 0xAB, 0x7D, 0x64, 0x63, 
-    0x6E, 0x7C, 0x81, 0x83, 0x75, 0x75, 0x7A, 0x83, 0x7C, 0x76, 0x75, 0x75, 
-    0x80, 0x8F, 0x94, 0x86, 0x77, 0x6A, 0x6A, 0x71, 0x7F, 0x86, 0x85, 0x7B, 
-    0x77, 0x71, 0x72, 0x7B, 0xC3, 0xFD, 0xDA, 0xB0, 0x8D, 0x46, 0x21, 0x3A, 
-    0x48, 0x55, 0x4E, 0x5A, 0x79, 0x7E, 0x99, 0xBB, 0x98, 0x67, 0x56, 0x44, 
-    0x4B, 0x6C, 0x92, 0xAA, 0xA4, 0xA5, 0xB4, 0xAD, 0xA8, 0xA4, 0x89, 0x65, 
-    0x58, 0x69, 0x7E, 0xAB, 0xC1, 0xB6, 0x85, 0x6D, 0x5E, 0x61, 0x74, 0x83, 
-    0x8C, 0x79, 0x79, 0x74, 0x7A, 0x75, 0x7C, 0x7B, 0x74, 0x7D, 0x88, 0x8F, 
-    0x86, 0x81, 0x73, 0x6C, 0x6F, 0x7D, 0x87, 0x87, 0x82, 0x7C, 0x74, 0x72, 
-    0x75, 0x77, 0x77, 0x8B, 0xE0, 0xFD, 0xD5, 0xB2, 0x83, 0x2A, 0x13, 0x29, 
-    0x3C, 0x4F, 0x53, 0x6E, 0x82, 0x82, 0xA2, 0xBA, 0x8E, 0x67, 0x55, 0x3E, 
-    0x47, 0x6D, 0x9B, 0xB5, 0xB2, 0xB6, 0xB7, 0xA7, 0x9E, 0x9B, 0x84, 0x66, 
-    0x5F, 0x71, 0x85, 0xA3, 0xBA, 0xB2, 0x84, 0x67, 0x5B, 0x5F, 0x6F, 0x83, 
-    0x90, 0x80, 0x76, 0x72, 0x77, 0x75, 0x7C, 0x81, 0x7B, 0x7C, 0x83, 0x8B, 
-    0x84, 0x80, 0x78, 0x71, 0x71, 0x7B, 0x87, 0x86, 0x83, 0x7D, 0x76, 0x70, 
-    0x73, 0x7C, 0x78, 0x79, 0x80, 0xC8, 0xFD, 0xE8, 0xC2, 0x96, 0x3E, 0x06, 
-    0x18, 0x2C, 0x4C, 0x5B, 0x6D, 0x82, 0x7E, 0x8E, 0xB2, 0xA3, 0x77, 0x65, 
-    0x46, 0x3D, 0x5A, 0x89, 0xB5, 0xC0, 0xBE, 0xBB, 0xA7, 0x94, 0x96, 0x8D, 
-    0x76, 0x67, 0x69, 0x75, 0x89, 0xB4, 0xC0, 0xAB, 0x7D, 0x66, 0x4C, 0x52, 
-    0x6A, 0x88, 0x90, 0x82, 0x7F, 0x70, 0x6E, 0x6B, 0x7D, 0x7E, 0x7C, 0x82, 
-    0x86, 0x88, 0x80, 0x84, 0x77, 0x73, 0x72, 0x80, 0x87, 0x88, 0x88, 0x80, 
-    0x77, 0x6D, 0x73, 0x79, 0x79, 0x7F, 0x85, 0xAD, 0xEF, 0xF4, 0xCB, 0xA4, 
-    0x5D, 0x0E, 0x09, 0x1B, 0x3C, 0x5B, 0x69, 0x80, 0x87, 0x84, 0x9F, 0xAC, 
-    0x86, 0x6E, 0x56, 0x3E, 0x4B, 0x71, 0xA2, 0xC2, 0xC8, 0xC4, 0xB7, 0x9B, 
-    0x8E, 0x8C, 0x7E, 0x70, 0x6E, 0x79, 0x88, 0x97, 0xA3, 0x9F, 0x8A, 0x73, 
-    0x65, 0x62, 0x6B, 0x79, 0x86, 0x83, 0x7B, 0x74, 0x72, 0x71, 0x78, 0x80, 
-    0x83, 0x83, 0x84, 0x84, 0x80, 0x7C, 0x78, 0x76, 0x75, 0x79, 0x81, 0x85, 
-    0x84, 0x81, 0x7E, 0x79, 0x78, 0x79, 0x7C, 0x7B, 0x7C, 0x76, 0x7B, 0x85, 
-    0xC4, 0xFB, 0xEA, 0xBF, 0x90, 0x3C, 0x03, 0x0F, 0x26, 0x4E, 0x62, 0x72, 
-    0x85, 0x81, 0x87, 0xAB, 0xA9, 0x85, 0x74, 0x53, 0x40, 0x51, 0x7B, 0xAC, 
-    0xC6, 0xC9, 0xC4, 0xAD, 0x8E, 0x8B, 0x88, 0x7E, 0x72, 0x72, 0x7A, 0x82, 
-    0x91, 0xA2, 0xA1, 0x88, 0x73, 0x63, 0x60, 0x67, 0x7A, 0x88, 0x84, 0x7A, 
-    0x73, 0x70, 0x6D, 0x78, 0x82, 0x85, 0x82, 0x83, 0x83, 0x7E, 0x7C, 0x7B, 
-    0x79, 0x75, 0x79, 0x80, 0x85, 0x85, 0x84, 0x81, 0x7A, 0x78, 0x7A, 0x7A, 
-    0x7D, 0x7C, 0x7C, 0x83, 0x92, 0xD1, 0xF9, 0xDB, 0xB1, 0x80, 0x29, 0x03, 
-    0x0F, 0x29, 0x54, 0x65, 0x78, 0x8A, 0x80, 0x89, 0xAB, 0x9D, 0x83, 0x75, 
-    0x53, 0x47, 0x57, 0x7E, 0xAF, 0xC4, 0xC9, 0xC8, 0xAB, 0x8D, 0x89, 0x85, 
-    0x7B, 0x7A, 0x81, 0x7F, 0x7E, 0x86, 0x91, 0x89, 0x80, 0x76, 0x72, 0x6B, 
-    0x70, 0x7F, 0x83, 0x7F, 0x7A, 0x79, 0x70, 0x74, 0x7D, 0x85, 0x85, 0x84, 
-    0x83, 0x7B, 0x78, 0x77, 0x7C, 0x79, 0x79, 0x7C, 0x7F, 0x7F, 0x81, 0x84, 
-    0x7E, 0x7D, 0x7C, 0x7D, 0x7C, 0x7E, 0x7F, 0x7B, 0x73, 0x79, 0x82, 0xBA, 
-    0xFA, 0xEF, 0xCA, 0x9F, 0x46, 0x07, 0x04, 0x13, 0x42, 0x58, 0x69, 0x87, 
-    0x7E, 0x82, 0xAD, 0xB0, 0x9B, 0x8E, 0x63, 0x49, 0x46, 0x5D, 0x97, 0xBB, 
-    0xC9, 0xD3, 0xBE, 0x9A, 0x8E, 0x8D, 0x87, 0x82, 0x7D, 0x72, 0x6D, 0x74, 
-    0x85, 0x90, 0x91, 0x84, 0x7B, 0x6C, 0x68, 0x74, 0x7E, 0x80, 0x7B, 0x78, 
-    0x6E, 0x70, 0x77, 0x83, 0x88, 0x85, 0x82, 0x7D, 0x79, 0x78, 0x7F, 0x7D, 
-    0x7A, 0x7A, 0x7A, 0x7B, 0x80, 0x87, 0x86, 0x84, 0x7F, 0x7B, 0x78, 0x78, 
-    0x7A, 0x7B, 0x75, 0x7D, 0x84, 0xA9, 0xF4, 0xF7, 0xD3, 0xB3, 0x61, 0x15, 
-    0x03, 0x05, 0x2E, 0x4D, 0x5F, 0x87, 0x85, 0x7C, 0xA3, 0xAD, 0xA0, 0x9D, 
-    0x7A, 0x5B, 0x49, 0x49, 0x7A, 0xA2, 0xBA, 0xD6, 0xD0, 0xAD, 0x9A, 0x90, 
-    0x86, 0x80, 0x7C, 0x79, 0x72, 0x74, 0x8E, 0xA0, 0x97, 0x80, 0x72, 0x5B, 
-    0x53, 0x67, 0x82, 0x8A, 0x86, 0x7D, 0x6B, 0x60, 0x64, 0x7B, 0x89, 0x8D, 
-    0x8F, 0x8A, 0x7D, 0x76, 0x7D, 0x7C, 0x7B, 0x7B, 0x7D, 0x7C, 0x7E, 0x85, 
-    0x89, 0x84, 0x7E, 0x7C, 0x78, 0x75, 0x7B, 0x81, 0x7D, 0x77, 0x83, 0x8B, 
-    0xC1, 0xF4, 0xE4, 0xCB, 0x9C, 0x45, 0x13, 0x03, 0x0D, 0x39, 0x4C, 0x6D, 
-    0x8A, 0x7C, 0x88, 0xA4, 0xA2, 0xA7, 0xA0, 0x7E, 0x69, 0x4E, 0x54, 0x7A, 
-    0x93, 0xB6, 0xD3, 0xCA, 0xB4, 0xA4, 0x95, 0x8A, 0x89, 0x84, 0x7B, 0x6D, 
-    0x65, 0x6D, 0x79, 0x80, 0x8D, 0x90, 0x7E, 0x74, 0x6D, 0x6A, 0x6F, 0x77, 
-    0x7C, 0x7C, 0x75, 0x72, 0x78, 0x7A, 0x81, 0x88, 0x87, 0x80, 0x7E, 0x7A, 
-    0x77, 0x79, 0x7A, 0x7B, 0x7A, 0x7C, 0x7F, 0x81, 0x81, 0x85, 0x84, 0x7F, 
-    0x7D, 0x7D, 0x7A, 0x78, 0x73, 0x78, 0x80, 0x94, 0xDC, 0xF4, 0xDB, 0xD0, 
-    0x90, 0x3E, 0x14, 0x03, 0x18, 0x2F, 0x44, 0x75, 0x80, 0x7A, 0x97, 0xA1, 
-    0xA3, 0xAF, 0xA1, 0x91, 0x74, 0x57, 0x60, 0x6A, 0x7B, 0xA7, 0xBF, 0xC0, 
-    0xBB, 0xB0, 0xA0, 0x92, 0x89, 0x83, 0x7A, 0x68, 0x66, 0x6E, 0x6D, 0x79, 
-    0x89, 0x87, 0x80, 0x7A, 0x71, 0x6E, 0x6E, 0x74, 0x7C, 0x78, 0x74, 0x79, 
-    0x76, 0x77, 0x82, 0x88, 0x88, 0x87, 0x83, 0x7F, 0x7B, 0x79, 0x7C, 0x7B, 
-    0x77, 0x7A, 0x7B, 0x7C, 0x82, 0x86, 0x85, 0x83, 0x80, 0x7C, 0x76, 0x70, 
-    0x7C, 0x87, 0xB1, 0xE8, 0xE1, 0xD8, 0xBA, 0x6F, 0x39, 0x0E, 0x03, 0x17, 
-    0x23, 0x4C, 0x70, 0x6F, 0x85, 0x99, 0x9D, 0xB3, 0xB5, 0xB1, 0xA4, 0x7A, 
-    0x6A, 0x63, 0x5A, 0x76, 0x97, 0xAB, 0xBD, 0xBF, 0xB8, 0xAC, 0x99, 0x8F, 
-    0x95, 0x85, 0x77, 0x70, 0x5E, 0x5B, 0x61, 0x6E, 0x7E, 0x82, 0x84, 0x82, 
-    0x75, 0x6C, 0x73, 0x71, 0x73, 0x78, 0x76, 0x76, 0x76, 0x7B, 0x84, 0x88, 
-    0x89, 0x8D, 0x85, 0x7D, 0x7E, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7B, 
-    0x7E, 0x80, 0x80, 0x86, 0x82, 0x7B, 0x7D, 0x84, 0x92, 0xC8, 0xE3, 0xDA, 
-    0xD8, 0xA2, 0x63, 0x2D, 0x03, 0x06, 0x09, 0x21, 0x51, 0x62, 0x70, 0x89, 
-    0x90, 0xA2, 0xB3, 0xB9, 0xC5, 0xAC, 0x92, 0x83, 0x63, 0x5E, 0x6E, 0x80, 
-    0x9A, 0xAD, 0xB4, 0xB8, 0xA9, 0xA4, 0xA4, 0x99, 0x92, 0x8B, 0x75, 0x61, 
-    0x58, 0x51, 0x5C, 0x68, 0x78, 0x87, 0x81, 0x7F, 0x7A, 0x72, 0x70, 0x74, 
-    0x74, 0x75, 0x74, 0x74, 0x78, 0x78, 0x81, 0x88, 0x88, 0x8A, 0x88, 0x83, 
-    0x80, 0x7F, 0x7E, 0x7F, 0x7B, 0x7B, 0x7C, 0x78, 0x7D, 0x81, 0x83, 0x85, 
-    0x85, 0x7F, 0x81, 0x86, 0x96, 0xC9, 0xD9, 0xD8, 0xD7, 0xA2, 0x69, 0x32, 
-    0x0B, 0x06, 0x03, 0x1E, 0x43, 0x50, 0x65, 0x7B, 0x85, 0x9B, 0xAD, 0xC1, 
-    0xCE, 0xBD, 0xB2, 0x98, 0x73, 0x6A, 0x68, 0x71, 0x86, 0x96, 0xA6, 0xAA, 
-    0xA3, 0xA6, 0xA0, 0x9A, 0x9E, 0x9A, 0x8E, 0x88, 0x78, 0x66, 0x5A, 0x4F, 
-    0x58, 0x5A, 0x65, 0x75, 0x77, 0x7C, 0x7C, 0x79, 0x75, 0x74, 0x72, 0x75, 
-    0x74, 0x79, 0x81, 0x81, 0x8A, 0x8C, 0x8C, 0x8C, 0x89, 0x88, 0x84, 0x81, 
-    0x80, 0x7F, 0x7B, 0x7D, 0x7C, 0x7A, 0x7D, 0x7D, 0x7F, 0x7F, 0x7C, 0x85, 
-    0x8B, 0xA2, 0xCC, 0xCF, 0xD3, 0xC9, 0x96, 0x67, 0x34, 0x18, 0x0D, 0x08, 
-    0x23, 0x38, 0x43, 0x5A, 0x6B, 0x7C, 0x94, 0xAA, 0xC6, 0xCD, 0xC8, 0xC3, 
-    0xA5, 0x8D, 0x7E, 0x76, 0x79, 0x7E, 0x8B, 0x94, 0x92, 0x94, 0x98, 0x94, 
-    0x9A, 0xA1, 0xA1, 0x9D, 0x8F, 0x7E, 0x6B, 0x59, 0x56, 0x57, 0x5B, 0x66, 
-    0x6E, 0x72, 0x75, 0x75, 0x78, 0x79, 0x7A, 0x7E, 0x7D, 0x7A, 0x7B, 0x7A, 
-    0x7D, 0x82, 0x85, 0x87, 0x86, 0x86, 0x85, 0x85, 0x86, 0x85, 0x83, 0x82, 
-    0x7F, 0x7D, 0x7D, 0x7C, 0x7E, 0x7F, 0x80, 0x82, 0x82, 0x80, 0x7D, 0x7F, 
-    0x84, 0x95, 0xB4, 0xBA, 0xC1, 0xBE, 0x9C, 0x79, 0x54, 0x3C, 0x2E, 0x29, 
-    0x37, 0x40, 0x46, 0x53, 0x5E, 0x6B, 0x7F, 0x98, 0xB2, 0xBE, 0xC3, 0xC2, 
-    0xAE, 0x9D, 0x90, 0x87, 0x83, 0x82, 0x85, 0x85, 0x80, 0x81, 0x83, 0x84, 
-    0x90, 0x98, 0x99, 0x98, 0x8F, 0x83, 0x73, 0x67, 0x65, 0x61, 0x63, 0x6A, 
-    0x6B, 0x6F, 0x72, 0x77, 0x7C, 0x7C, 0x7F, 0x7F, 0x7C, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x81, 0x83, 0x83, 0x81, 0x85, 0x87, 0x86, 0x89, 0x85, 0x83, 0x80, 
-    0x81, 0x81, 0x80, 0x7E, 0x81, 0x81, 0x84, 0x86, 0x85, 0x82, 0x7F, 0x7D, 
-    0x7B, 0x7B, 0x88, 0xA4, 0xAB, 0xB1, 0xB4, 0x9C, 0x7D, 0x61, 0x4E, 0x42, 
-    0x3C, 0x45, 0x4A, 0x47, 0x4D, 0x55, 0x61, 0x73, 0x8D, 0xA7, 0xB2, 0xB8, 
-    0xB9, 0xAC, 0xA0, 0x9A, 0x96, 0x93, 0x8F, 0x8E, 0x89, 0x81, 0x81, 0x84, 
-    0x84, 0x8A, 0x8E, 0x8B, 0x85, 0x7F, 0x7A, 0x73, 0x70, 0x72, 0x70, 0x6F, 
-    0x71, 0x6F, 0x72, 0x74, 0x7A, 0x7D, 0x7D, 0x7E, 0x7D, 0x7B, 0x7C, 0x7F, 
-    0x7D, 0x7D, 0x7D, 0x80, 0x7E, 0x80, 0x83, 0x82, 0x84, 0x87, 0x86, 0x84, 
-    0x81, 0x82, 0x85, 0x82, 0x85, 0x80, 0x80, 0x80, 0x83, 0x81, 0x7F, 0x7D, 
-    0x7A, 0x78, 0x7A, 0x8C, 0xA5, 0xAC, 0xB3, 0xB0, 0x97, 0x7B, 0x66, 0x59, 
-    0x4E, 0x4C, 0x4E, 0x4C, 0x47, 0x4B, 0x54, 0x65, 0x78, 0x91, 0xA5, 0xAB, 
-    0xAD, 0xAA, 0xA4, 0x9E, 0x9C, 0x9C, 0x99, 0x90, 0x8A, 0x82, 0x7C, 0x7B, 
-    0x7D, 0x7F, 0x81, 0x80, 0x7F, 0x7C, 0x7B, 0x7D, 0x7C, 0x7C, 0x79, 0x79, 
-    0x77, 0x78, 0x7C, 0x7E, 0x80, 0x82, 0x7E, 0x80, 0x7E, 0x7B, 0x7D, 0x7F, 
-    0x7E, 0x7C, 0x7C, 0x7D, 0x7E, 0x7E, 0x7F, 0x81, 0x7E, 0x80, 0x7D, 0x7D, 
-    0x7E, 0x7E, 0x7C, 0x7D, 0x7F, 0x7F, 0x83, 0x84, 0x82, 0x81, 0x7F, 0x7B, 
-    0x78, 0x7B, 0x8A, 0xA0, 0xAB, 0xAD, 0xA9, 0x95, 0x80, 0x6F, 0x65, 0x5C, 
-    0x58, 0x53, 0x4B, 0x46, 0x49, 0x52, 0x63, 0x78, 0x8D, 0x9B, 0xA1, 0xA6, 
-    0xA7, 0xA7, 0xA9, 0xAA, 0xA5, 0x9F, 0x97, 0x8D, 0x82, 0x7B, 0x78, 0x75, 
-    0x75, 0x77, 0x77, 0x79, 0x7C, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7D, 0x7D, 0x7B, 0x7C, 0x7B, 0x7B, 0x7C, 0x7D, 
-    0x7C, 0x7E, 0x7B, 0x7E, 0x7D, 0x7C, 0x7A, 0x7B, 0x78, 0x7B, 0x7D, 0x7E, 
-    0x7D, 0x7F, 0x7F, 0x81, 0x83, 0x85, 0x82, 0x82, 0x82, 0x7F, 0x7D, 0x7C, 
-    0x7C, 0x83, 0x90, 0x9C, 0xA0, 0x9F, 0x97, 0x8A, 0x7D, 0x77, 0x72, 0x6C, 
-    0x67, 0x62, 0x5B, 0x56, 0x5A, 0x62, 0x6C, 0x78, 0x83, 0x89, 0x8E, 0x93, 
-    0x98, 0x9C, 0xA1, 0xA3, 0xA2, 0x9F, 0x99, 0x92, 0x8F, 0x8A, 0x82, 0x7D, 
-    0x7B, 0x77, 0x75, 0x75, 0x76, 0x76, 0x77, 0x77, 0x77, 0x78, 0x79, 0x7C, 
-    0x7E, 0x7E, 0x7D, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7C, 
-    0x7C, 0x7C, 0x7D, 0x7E, 0x7E, 0x85, 0x84, 0x7F, 0x84, 0x82, 0x80, 0x82, 
-    0x81, 0x7E, 0x7F, 0x7F, 0x7C, 0x7D, 0x7E, 0x7D, 0x7D, 0x7F, 0x7B, 0x7B, 
-    0x7E, 0x84, 0x8D, 0x92, 0x92, 0x94, 0x94, 0x8A, 0x88, 0x87, 0x7D, 0x77, 
-    0x75, 0x6A, 0x61, 0x63, 0x62, 0x62, 0x6B, 0x72, 0x75, 0x7D, 0x86, 0x8C, 
-    0x94, 0x9E, 0xA0, 0xA0, 0xA2, 0x9C, 0x95, 0x91, 0x8A, 0x81, 0x7B, 0x76, 
-    0x70, 0x6F, 0x71, 0x72, 0x76, 0x7A, 0x7C, 0x80, 0x84, 0x87, 0x89, 0x8B, 
-    0x8A, 0x88, 0x87, 0x84, 0x80, 0x7E, 0x7A, 0x76, 0x74, 0x72, 0x70, 0x71, 
-    0x72, 0x73, 0x75, 0x78, 0x7A, 0x7C, 0x7F, 0x81, 0x82, 0x84, 0x84, 0x84, 
-    0x84, 0x83, 0x82, 0x80, 0x7F, 0x7F, 0x85, 0x8F, 0x91, 0x8F, 0x98, 0x99, 
-    0x8C, 0x8F, 0x8E, 0x7E, 0x78, 0x75, 0x65, 0x5A, 0x5C, 0x58, 0x55, 0x60, 
-    0x65, 0x68, 0x75, 0x7F, 0x86, 0x91, 0x9C, 0xA2, 0xA6, 0xAA, 0xA9, 0xA5, 
-    0xA1, 0x9A, 0x93, 0x8B, 0x81, 0x7C, 0x76, 0x72, 0x73, 0x74, 0x75, 0x77, 
-    0x7B, 0x7C, 0x7F, 0x83, 0x84, 0x84, 0x85, 0x84, 0x81, 0x7F, 0x7D, 0x7A, 
-    0x77, 0x74, 0x70, 0x6E, 0x6E, 0x6D, 0x6F, 0x72, 0x74, 0x77, 0x7B, 0x7E, 
-    0x81, 0x84, 0x86, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x86, 0x84, 0x81, 
-    0x80, 0x81, 0x8B, 0x94, 0x8E, 0x93, 0x9F, 0x90, 0x8A, 0x92, 0x83, 0x75, 
-    0x75, 0x69, 0x56, 0x56, 0x56, 0x4F, 0x58, 0x60, 0x62, 0x6C, 0x79, 0x81, 
-    0x8C, 0x98, 0xA0, 0xA5, 0xAB, 0xAB, 0xAB, 0xA9, 0xA2, 0x9D, 0x95, 0x8A, 
-    0x83, 0x7D, 0x77, 0x76, 0x76, 0x75, 0x75, 0x78, 0x79, 0x7A, 0x7F, 0x81, 
-    0x81, 0x83, 0x81, 0x7F, 0x7E, 0x7C, 0x79, 0x77, 0x74, 0x70, 0x6E, 0x6D, 
-    0x6C, 0x6F, 0x71, 0x73, 0x77, 0x7A, 0x7D, 0x81, 0x84, 0x86, 0x88, 0x8A, 
-    0x89, 0x8A, 0x8A, 0x89, 0x88, 0x87, 0x85, 0x83, 0x80, 0x7D, 0x80, 0x8C, 
-    0x91, 0x8A, 0x94, 0x9A, 0x8B, 0x8B, 0x8F, 0x7F, 0x75, 0x74, 0x66, 0x57, 
-    0x59, 0x56, 0x53, 0x5C, 0x60, 0x64, 0x6E, 0x78, 0x81, 0x8E, 0x98, 0x9E, 
-    0xA6, 0xAB, 0xAA, 0xAB, 0xA9, 0xA2, 0x9C, 0x93, 0x89, 0x83, 0x7D, 0x79, 
-    0x77, 0x77, 0x76, 0x76, 0x79, 0x7A, 0x7D, 0x80, 0x82, 0x83, 0x83, 0x81, 
-    0x80, 0x7E, 0x7B, 0x78, 0x74, 0x70, 0x6C, 0x6B, 0x6A, 0x6B, 0x6D, 0x6F, 
-    0x74, 0x77, 0x7B, 0x80, 0x83, 0x86, 0x89, 0x8B, 0x8A, 0x8A, 0x8B, 0x8C, 
-    0x8B, 0x88, 0x85, 0x83, 0x81, 0x7E, 0x7C, 0x7B, 0x7A, 0x7C, 0x88, 0x89, 
-    0x87, 0x92, 0x93, 0x8E, 0x8F, 0x8E, 0x84, 0x7E, 0x7B, 0x6E, 0x69, 0x66, 
-    0x62, 0x63, 0x65, 0x66, 0x6A, 0x70, 0x77, 0x7F, 0x89, 0x8F, 0x96, 0x9C, 
-    0x9B, 0x9E, 0x9E, 0x99, 0x96, 0x91, 0x8A, 0x83, 0x81, 0x7D, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7C, 0x7D, 0x80, 0x83, 0x84, 0x85, 0x85, 0x84, 0x82, 0x81, 
-    0x7E, 0x7B, 0x78, 0x74, 0x71, 0x6F, 0x6E, 0x6E, 0x6F, 0x72, 0x75, 0x78, 
-    0x7B, 0x7E, 0x81, 0x84, 0x86, 0x88, 0x88, 0x87, 0x87, 0x86, 0x84, 0x83, 
-    0x82, 0x80, 0x7F, 0x7E, 0x80, 0x88, 0x87, 0x87, 0x8C, 0x8B, 0x88, 0x88, 
-    0x87, 0x7F, 0x7C, 0x78, 0x70, 0x6D, 0x6A, 0x69, 0x6B, 0x6D, 0x6F, 0x73, 
-    0x78, 0x7D, 0x85, 0x8C, 0x90, 0x93, 0x95, 0x95, 0x96, 0x94, 0x92, 0x8F, 
-    0x8B, 0x87, 0x83, 0x80, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84, 
-    0x85, 0x86, 0x85, 0x83, 0x80, 0x7E, 0x7B, 0x79, 0x76, 0x73, 0x71, 0x6F, 
-    0x6E, 0x6F, 0x70, 0x73, 0x75, 0x78, 0x7B, 0x7E, 0x80, 0x82, 0x84, 0x85, 
-    0x85, 0x85, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x82, 0x85, 0x89, 0x89, 0x8A, 0x8B, 0x89, 0x87, 0x86, 0x83, 0x7E, 0x7B, 
-    0x77, 0x74, 0x72, 0x72, 0x73, 0x74, 0x77, 0x79, 0x7D, 0x7F, 0x82, 0x87, 
-    0x89, 0x8A, 0x8C, 0x8C, 0x8A, 0x8B, 0x89, 0x88, 0x87, 0x85, 0x83, 0x83, 
-    0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x84, 0x84, 0x83, 0x82, 0x81, 
-    0x7E, 0x7C, 0x7A, 0x78, 0x77, 0x76, 0x76, 0x75, 0x76, 0x77, 0x77, 0x79, 
-    0x79, 0x7A, 0x7B, 0x7C, 0x7C, 0x7C, 0x7C, 0x7B, 0x7C, 0x7C, 0x7D, 0x7E, 
-    0x7F, 0x80, 0x81, 0x82, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x89, 0x89, 
-    0x89, 0x88, 0x87, 0x86, 0x83, 0x82, 0x81, 0x7F, 0x7E, 0x7E, 0x7D, 0x7C, 
-    0x7C, 0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 
-    0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 
-    0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 
-    0x7D, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x82, 
-    0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 
-    0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 
-    0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 
-    0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 
-    0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x80, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-};
-int sound_sz_down = sizeof(sound_down);
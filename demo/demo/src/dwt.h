@@ -0,0 +1,33 @@
+/*****************************************************************************
+ *   dwt.h:  Cycle counter of the Data Watchpoint and Trace unit
+ *
+******************************************************************************/
+#ifndef __DWT_H
+#define __DWT_H
+
+#include "LPC17xx.h"
+
+/*
+ * CMSIS 1.30 core_cm3.h has no DWT definitions, the registers used are
+ * here. The host simulator maps them to its own (sim/inc/LPC17xx.h).
+ */
+#ifndef DWT_CTRL
+#define DWT_CTRL            (*(volatile uint32_t *)0xE0001000UL)
+#define DWT_CYCCNT          (*(volatile uint32_t *)0xE0001004UL)
+#endif
+#define DWT_CTRL_CYCCNTENA  (1UL << 0)
+
+/*
+ * Enables the trace blocks (DWT and ITM) and starts CYCCNT, one count per
+ * CPU clock. The counter is left running, so several modules may call it.
+ */
+#define DWT_START()         do { \
+                                CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+                                DWT_CTRL |= DWT_CTRL_CYCCNTENA; \
+                            } while (0)
+
+
+#endif /* end __DWT_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
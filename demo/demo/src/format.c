@@ -0,0 +1,317 @@
+/*****************************************************************************
+ *   format.c:  Integer to text conversion for OLED strings
+ *
+ ******************************************************************************/
+
+/*
+ * Digits are produced two at a time from a lookup table of "00".."99", so a
+ * number costs one division by 100 per digit pair. Division by a constant is
+ * turned into a multiplication by the compiler, the hardware divider is not
+ * used at all: format_fixed converts the whole scaled value and inserts the
+ * decimal point into the digits instead of dividing by 10^decimals.
+ *
+ * Fields of 2..5 characters that the number fills without growing them
+ * (clock fields, sensor readings) are written in place, like format_date:
+ * the digits go straight into str, zero padded, and the leading zeros are
+ * turned into spaces unless FORMAT_ZEROPAD is given. Left aligned and
+ * negative numbers take the general path.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "format.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define FIELD_MIN       2U
+#define FIELD_MAX       5U
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+/* Smallest value that does not fit in n digits, n = 0..FIELD_MAX */
+static const uint32_t fieldLimit[FIELD_MAX + 1U] = {1U, 10U, 100U, 1000U, 10000U, 100000U};
+
+static const char digitPairs[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Writes two decimal digits of value (0..99).
+ *  @side effects:	None.
+ */
+static void putPair(unsigned char *str, uint32_t value) {
+    uint32_t i = value * 2U;
+    str[0] = (unsigned char)digitPairs[i];
+    str[1] = (unsigned char)digitPairs[i + 1U];
+}
+
+/*!
+ *  @brief    		Writes value as exactly n digits (FIELD_MIN..FIELD_MAX), zero padded.
+ *  @side effects:	None.
+ */
+static inline void putField(unsigned char *str, uint32_t value, uint8_t n) {
+    uint32_t v = value;
+    uint32_t q;
+    if (n >= 4U) {
+        q = v / 100U;
+        putPair(&str[n - 2U], v - (q * 100U));
+        v = q;
+    }
+    /* two or three digits left */
+    if ((n & 1U) != 0U) {
+        q = v / 100U;
+        putPair(&str[1], v - (q * 100U));
+        str[0] = (unsigned char)('0' + q);
+    } else {
+        putPair(&str[0], v);
+    }
+}
+
+/*!
+ *  @brief    		Turns the leading zeros of the first n characters into spaces.
+ *  @side effects:	None.
+ */
+static void blankZeros(unsigned char *str, uint8_t n) {
+    uint8_t i = 0U;
+    while ((i < n) && (str[i] == '0')) {
+        str[i] = ' ';
+        i++;
+    }
+}
+
+/*!
+ *  @brief    		Writes decimal digits of value backwards, ending right before 'end'.
+ *  @param end		unsigned char*,
+ *             		one past the position of the last digit.
+ *  @param value	uint32_t,
+ *             		value to convert.
+ *  @returns  		Number of digits written (1..10).
+ *  @side effects:	None.
+ */
+static uint8_t putDigits(unsigned char *end, uint32_t value) {
+    unsigned char *p = end;
+    uint32_t v = value;
+    while (v >= 100U) {
+        uint32_t q = v / 100U;
+        p -= 2;
+        putPair(p, v - (q * 100U));
+        v = q;
+    }
+    if (v >= 10U) {
+        p -= 2;
+        putPair(p, v);
+    } else {
+        p--;
+        *p = (unsigned char)('0' + v);
+    }
+    return (uint8_t)(end - p);
+}
+
+/*!
+ *  @brief    		Copies sign and digits to str applying width and flags.
+ *  @returns  		Length of str without the null character.
+ *  @side effects:	None.
+ */
+static uint8_t emit(unsigned char *str, Bool negative, const unsigned char *digits,
+        uint8_t count, uint8_t width, uint8_t flags) {
+    uint8_t len = count + (negative ? 1U : 0U);
+    uint8_t pad = (width > len) ? (uint8_t)(width - len) : 0U;
+    uint8_t pos = 0U;
+    uint8_t i;
+
+    if (((flags & (FORMAT_LEFT | FORMAT_ZEROPAD)) == 0U)) {
+        for (i = 0U; i < pad; i++) { str[pos++] = ' '; }
+    }
+    if (negative) {
+        str[pos++] = '-';
+    }
+    if (((flags & FORMAT_LEFT) == 0U) && ((flags & FORMAT_ZEROPAD) != 0U)) {
+        for (i = 0U; i < pad; i++) { str[pos++] = '0'; }
+    }
+    for (i = 0U; i < count; i++) {
+        str[pos++] = digits[i];
+    }
+    if ((flags & FORMAT_LEFT) != 0U) {
+        for (i = 0U; i < pad; i++) { str[pos++] = ' '; }
+    }
+    str[pos] = '\0';
+    return pos;
+}
+
+/*!
+ *  @brief    		Converts magnitude with the decimal point inserted, then applies width
+ *             		and flags (the general path of format_uint and format_fixed).
+ *  @returns  		Length of str without the null character.
+ *  @side effects:	None.
+ */
+static uint8_t emitNumber(unsigned char *str, Bool negative, uint32_t magnitude,
+        uint8_t decimals, uint8_t width, uint8_t flags) {
+    unsigned char buf[FORMAT_MAX_DIGITS + 1U];
+    unsigned char *end = &buf[FORMAT_MAX_DIGITS + 1U];
+    uint8_t count = putDigits(end, magnitude);
+    uint8_t i;
+
+    if (decimals > 0U) {
+        /* At least one digit before the point, then move those one to the left */
+        while (count <= decimals) {
+            count++;
+            *(end - count) = '0';
+        }
+        for (i = count; i > decimals; i--) {
+            *(end - i - 1) = *(end - i);
+        }
+        *(end - decimals - 1) = '.';
+        count++;
+    }
+    return emit(str, negative, end - count, count, width, flags);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Converts unsigned value to decimal text. Adds null character at the end.
+ *  @param str		unsigned char*,
+ *             		output, at least MAX(width, 10) + 1 bytes.
+ *  @param value	uint32_t,
+ *             		value to convert.
+ *  @param width	uint8_t,
+ *             		minimal field width, 0 - no padding. Longer numbers are not truncated.
+ *  @param flags	uint8_t,
+ *             		FORMAT_ZEROPAD and/or FORMAT_LEFT, 0 - right aligned, padded with spaces.
+ *  @returns  		Length of str without the null character.
+ *  @side effects:	None.
+ */
+uint8_t format_uint(unsigned char *str, uint32_t value, uint8_t width, uint8_t flags) {
+    if ((width >= FIELD_MIN) && (width <= FIELD_MAX) && ((flags & FORMAT_LEFT) == 0U)
+            && (value < fieldLimit[width])) {
+        putField(str, value, width);
+        if ((flags & FORMAT_ZEROPAD) == 0U) {
+            blankZeros(str, width - 1U);
+        }
+        str[width] = '\0';
+        return width;
+    }
+    return emitNumber(str, FALSE, value, 0U, width, flags);
+}
+
+/*!
+ *  @brief    		Converts signed fixed-point value to decimal text, e.g.
+ *					value = -53, decimals = 1 gives "-5.3". Adds null character at the end.
+ *  @param str		unsigned char*,
+ *             		output, at least MAX(width, FORMAT_MAX_DIGITS + 1) + 1 bytes.
+ *  @param value	int32_t,
+ *             		value scaled by 10^decimals.
+ *  @param decimals	uint8_t,
+ *             		number of digits after the decimal point, 0..FORMAT_MAX_DECIMALS.
+ *  @param width	uint8_t,
+ *             		minimal field width, 0 - no padding.
+ *  @param flags	uint8_t,
+ *             		FORMAT_ZEROPAD and/or FORMAT_LEFT, 0 - right aligned, padded with spaces.
+ *  @returns  		Length of str without the null character, 0 (empty str) if decimals is
+ *             		over FORMAT_MAX_DECIMALS.
+ *  @side effects:	None.
+ */
+uint8_t format_fixed(unsigned char *str, int32_t value, uint8_t decimals, uint8_t width, uint8_t flags) {
+    uint8_t i;
+
+    if (decimals > FORMAT_MAX_DECIMALS) {
+        str[0] = '\0';
+        return 0U;
+    }
+    /* digits before and after the point fill width - 1 characters */
+    if ((width >= FIELD_MIN) && (width <= FIELD_MAX) && (decimals > 0U) && (decimals < (width - 1U))
+            && (value >= 0) && ((flags & FORMAT_LEFT) == 0U) && ((uint32_t)value < fieldLimit[width - 1U])) {
+        putField(str, (uint32_t)value, width - 1U);
+        for (i = width - 1U; i > (width - 1U - decimals); i--) {
+            str[i] = str[i - 1U];
+        }
+        str[width - 1U - decimals] = '.';
+        if ((flags & FORMAT_ZEROPAD) == 0U) {
+            blankZeros(str, width - 2U - decimals);
+        }
+        str[width] = '\0';
+        return width;
+    }
+    if (value < 0) {
+        return emitNumber(str, TRUE, (uint32_t)(-(value + 1)) + 1U, decimals, width, flags);
+    }
+    return emitNumber(str, FALSE, (uint32_t)value, decimals, width, flags);
+}
+
+/*!
+ *  @brief    		Writes date as "YYYY-MM-DD". Adds null character at the end.
+ *  @param str		unsigned char*,
+ *             		output, at least 11 bytes.
+ *  @param dt		const datetime_t*,
+ *             		date to convert.
+ *  @returns  		Length of str without the null character (10).
+ *  @side effects:	None.
+ */
+uint8_t format_date(unsigned char *str, const datetime_t *dt) {
+    putPair(&str[0], (uint32_t)dt->year / 100U);
+    putPair(&str[2], (uint32_t)dt->year % 100U);
+    str[4] = '-';
+    putPair(&str[5], dt->month);
+    str[7] = '-';
+    putPair(&str[8], dt->dom);
+    str[10] = '\0';
+    return 10U;
+}
+
+/*!
+ *  @brief    		Writes time as "HH:MM:SS". Adds null character at the end.
+ *  @param str		unsigned char*,
+ *             		output, at least 9 bytes.
+ *  @param dt		const datetime_t*,
+ *             		time to convert.
+ *  @returns  		Length of str without the null character (8).
+ *  @side effects:	None.
+ */
+uint8_t format_time(unsigned char *str, const datetime_t *dt) {
+    putPair(&str[0], dt->hour);
+    str[2] = ':';
+    putPair(&str[3], dt->min);
+    str[5] = ':';
+    putPair(&str[6], dt->sec);
+    str[8] = '\0';
+    return 8U;
+}
+
+/*!
+ *  @brief    		Writes time as "HH:MM". Adds null character at the end.
+ *  @param str		unsigned char*,
+ *             		output, at least 6 bytes.
+ *  @param hour		uint8_t,
+ *             		0..23.
+ *  @param min		uint8_t,
+ *             		0..59.
+ *  @returns  		Length of str without the null character (5).
+ *  @side effects:	None.
+ */
+uint8_t format_hhmm(unsigned char *str, uint8_t hour, uint8_t min) {
+    putPair(&str[0], hour);
+    str[2] = ':';
+    putPair(&str[3], min);
+    str[5] = '\0';
+    return 5U;
+}
@@ -0,0 +1,31 @@
+/*****************************************************************************
+ *   format.h:  Header file for integer to text conversion
+ *
+******************************************************************************/
+#ifndef __FORMAT_H
+#define __FORMAT_H
+
+#include "lpc_types.h"
+#include "datetime.h"
+
+/* Pad with '0' instead of ' ' (placed after the sign) */
+#define FORMAT_ZEROPAD  0x01U
+/* Align to the left, i.e. pad with spaces on the right */
+#define FORMAT_LEFT     0x02U
+
+/* Longest output of format_uint/format_fixed without padding, "-4294967295" */
+#define FORMAT_MAX_DIGITS 11U
+/* Most digits after the point format_fixed accepts */
+#define FORMAT_MAX_DECIMALS 9U
+
+uint8_t format_uint(unsigned char *str, uint32_t value, uint8_t width, uint8_t flags);
+uint8_t format_fixed(unsigned char *str, int32_t value, uint8_t decimals, uint8_t width, uint8_t flags);
+uint8_t format_date(unsigned char *str, const datetime_t *dt);
+uint8_t format_time(unsigned char *str, const datetime_t *dt);
+uint8_t format_hhmm(unsigned char *str, uint8_t hour, uint8_t min);
+
+
+#endif /* end __FORMAT_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
@@ -0,0 +1,615 @@
+/*****************************************************************************
+ *   kvstore.c:  Log-structured key/value store on the SPI DataFlash
+ *
+ ******************************************************************************/
+
+/*
+ * Every put appends one page to a circular log of KV_BLOCKS flash blocks;
+ * nothing is updated in place. A page holds a header, the key and the
+ * value. Pages are programmed without erase into blocks erased ahead of
+ * time, first with the commit byte left erased (0xFF) and then the commit
+ * byte alone is cleared. A page whose commit byte is not KV_COMMITTED was
+ * cut off by a reset and is ignored, so a put either fully happened or not.
+ *
+ * The RAM index maps a 16-bit key hash to the page of the newest record of
+ * that key (linear probing, the key itself is compared on the flash). It is
+ * rebuilt by kv_init from the page headers, the highest sequence number
+ * wins. A delete appends a tombstone record.
+ *
+ * When the head is about to enter a new block and fewer than KV_RESERVE
+ * erased blocks would remain, the oldest block is collected: its live
+ * records are appended again and the block is erased. Older copies of a
+ * key can only be in that same block, so its tombstones can be dropped.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "kvstore.h"
+#include "flash.h"
+#include "lpc17xx_crc.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define KV_FIRST_BLOCK      0U      /* flash block the store starts at */
+#define KV_BLOCKS           128U    /* 1024 pages, the rest of the flash is free for other use */
+#define KV_PAGES            (KV_BLOCKS * FLASH_BLOCK_PAGES)
+#define KV_RESERVE          1U      /* erased blocks kept for garbage collection */
+
+#define KV_INDEX_SIZE       256U    /* power of 2 */
+#define KV_INDEX_MASK       (KV_INDEX_SIZE - 1U)
+#define KV_INDEX_LIMIT      ((KV_INDEX_SIZE * 3U) / 4U)
+
+#define KV_PAGE_MAX         528U    /* largest DataFlash page */
+#define KV_MAGIC            0x564BU /* "KV" */
+#define KV_BLANK            0xFFFFU
+#define KV_COMMITTED        0x00U
+#define KV_FLAG_DELETED     0x01U
+
+#define NO_PAGE             0xFFFFU
+#define SLOT_DELETED        0x8000U /* slot page flag, newest record is a tombstone */
+#define SLOT_PAGE           0x7FFFU
+
+/* CRC covers the bytes before the crc field, the key and the value */
+#define HEADER_CRC_LEN      10U
+#define HEADER_COMMIT_OFS   12U
+
+typedef struct
+{
+    uint16_t magic;     /* KV_MAGIC, KV_BLANK - erased page */
+    uint8_t keyLen;     /* 1..KV_MAX_KEY */
+    uint8_t flags;      /* KV_FLAG_* */
+    uint32_t seq;       /* increases with every record written */
+    uint16_t valLen;
+    uint16_t crc;       /* CRC-16/CCITT */
+    uint8_t commit;     /* KV_COMMITTED once the page is fully programmed */
+    uint8_t spare[3];
+} kv_header_t;
+
+typedef union
+{
+    kv_header_t hdr;                /* keeps the buffer word aligned */
+    uint8_t byte[KV_PAGE_MAX];
+} kv_page_t;
+
+typedef struct
+{
+    uint16_t hash;
+    uint16_t page;      /* NO_PAGE - empty slot */
+} kv_slot_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static kv_slot_t slots[KV_INDEX_SIZE];
+static uint16_t used = 0U;          /* occupied slots */
+
+static uint16_t pageSize = 0U;
+static uint16_t head = 0U;          /* next page to write */
+static uint16_t tailBlock = 0U;     /* oldest block of the log */
+static uint32_t nextSeq = 1U;
+static Bool ready = FALSE;
+static Bool collecting = FALSE;
+
+static kv_page_t pageBuf;           /* record being written or read */
+static uint8_t *const page = pageBuf.byte;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Flash offset of a store page.
+ *  @side effects:	None.
+ */
+static uint32_t pageOffset(uint16_t p) {
+    return (((uint32_t)KV_FIRST_BLOCK * FLASH_BLOCK_PAGES) + p) * pageSize;
+}
+
+/*!
+ *  @brief    		Length of a null terminated key.
+ *  @returns  		0..KV_MAX_KEY, KV_MAX_KEY + 1 if the key is too long.
+ *  @side effects:	None.
+ */
+static uint8_t keyLength(const char *key) {
+    uint8_t n = 0U;
+    while ((n <= KV_MAX_KEY) && (key[n] != '\0')) {
+        n++;
+    }
+    return n;
+}
+
+/*!
+ *  @brief    		FNV-1a hash of the key folded to 16 bits.
+ *  @side effects:	None.
+ */
+static uint16_t hashKey(const uint8_t *key, uint8_t len) {
+    uint32_t h = 2166136261UL;
+    uint8_t i;
+    for (i = 0U; i < len; i++) {
+        h = (h ^ key[i]) * 16777619UL;
+    }
+    return (uint16_t)((h >> 16) ^ (h & 0xFFFFU));
+}
+
+/*!
+ *  @brief    		CRC of the record in page[].
+ *  @side effects:	None.
+ */
+static uint16_t recordCrc(void) {
+    const kv_header_t *hdr = (const kv_header_t *)page;
+    uint16_t crc = CRC16_Update(CRC16_Init(), page, HEADER_CRC_LEN);
+    crc = CRC16_Update(crc, &page[sizeof(kv_header_t)], (uint32_t)hdr->keyLen + hdr->valLen);
+    return CRC16_Final(crc);
+}
+
+static Bool readHeader(uint16_t p, kv_header_t *hdr) {
+    return (Bool)(flash_read((uint8_t *)hdr, pageOffset(p), sizeof(kv_header_t)) == sizeof(kv_header_t));
+}
+
+/*!
+ *  @brief    		Checks a header read from the flash.
+ *  @returns  		TRUE if it belongs to a committed record.
+ *  @side effects:	None.
+ */
+static Bool isRecord(const kv_header_t *hdr) {
+    return (Bool)((hdr->magic == KV_MAGIC) && (hdr->commit == KV_COMMITTED)
+            && (hdr->keyLen > 0U) && (hdr->keyLen <= KV_MAX_KEY)
+            && ((sizeof(kv_header_t) + hdr->keyLen + hdr->valLen) <= pageSize));
+}
+
+/*!
+ *  @brief    		Reads header and key of page p into page[].
+ *  @returns  		TRUE if it is a committed record.
+ *  @side effects:	None.
+ */
+static Bool readKey(uint16_t p) {
+    kv_header_t *hdr = (kv_header_t *)page;
+    Bool output = FALSE;
+    if (readHeader(p, hdr) && isRecord(hdr)) {
+        output = (Bool)(flash_read(&page[sizeof(kv_header_t)], pageOffset(p) + sizeof(kv_header_t),
+                hdr->keyLen) == hdr->keyLen);
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Looks the key up in the index.
+ *  @param key		const uint8_t*,
+ *             		key, not null terminated.
+ *  @param len		uint8_t,
+ *             		key length.
+ *  @param pos		uint16_t*,
+ *             		output, slot of the key or the empty slot to insert it at.
+ *  @returns  		TRUE if found.
+ *  @side effects:	Overwrites page[].
+ */
+static Bool findSlot(const uint8_t *key, uint8_t len, uint16_t *pos) {
+    uint16_t h = hashKey(key, len);
+    uint16_t i = h & KV_INDEX_MASK;
+    Bool output = FALSE;
+
+    while ((!output) && (slots[i].page != NO_PAGE)) {
+        if ((slots[i].hash == h) && readKey(slots[i].page & SLOT_PAGE)
+                && (pageBuf.hdr.keyLen == len)) {
+            uint8_t n = 0U;
+            while ((n < len) && (page[sizeof(kv_header_t) + n] == key[n])) {
+                n++;
+            }
+            output = (Bool)(n == len);
+        }
+        if (!output) {
+            i = (i + 1U) & KV_INDEX_MASK;
+        }
+    }
+    *pos = i;
+    return output;
+}
+
+/*!
+ *  @brief    		Removes a slot, moving later entries of the probe run back.
+ *  @side effects:	None.
+ */
+static void removeSlot(uint16_t i) {
+    uint16_t j = i;
+    for (;;) {
+        uint16_t k;
+        j = (j + 1U) & KV_INDEX_MASK;
+        if (slots[j].page == NO_PAGE) {
+            break;
+        }
+        k = slots[j].hash & KV_INDEX_MASK;
+        if (((j > i) && ((k <= i) || (k > j))) || ((j < i) && (k <= i) && (k > j))) {
+            slots[i] = slots[j];
+            i = j;
+        }
+    }
+    slots[i].page = NO_PAGE;
+    used--;
+}
+
+/*!
+ *  @brief    		Pages of the log between the oldest block and the head.
+ *  @side effects:	None.
+ */
+static uint16_t usedPages(void) {
+    return (uint16_t)((head + KV_PAGES - (tailBlock * FLASH_BLOCK_PAGES)) % KV_PAGES);
+}
+
+/*!
+ *  @brief    		Erases the block unless all its pages are blank already.
+ *  @returns  		KV_OK or KV_ERR_FLASH.
+ *  @side effects:	None.
+ */
+static int32_t ensureErased(uint16_t block) {
+    kv_header_t hdr;
+    uint16_t p = block * FLASH_BLOCK_PAGES;
+    uint8_t n;
+    Bool blank = TRUE;
+    int32_t output = KV_OK;
+
+    for (n = 0U; blank && (n < FLASH_BLOCK_PAGES); n++) {
+        blank = (Bool)(readHeader(p + n, &hdr) && (hdr.magic == KV_BLANK) && (hdr.commit == 0xFFU));
+    }
+    if ((!blank) && (!flash_eraseBlock(pageOffset(p)))) {
+        output = KV_ERR_FLASH;
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Programs the record in page[] at the head and commits it.
+ *  @returns  		Page written or KV_ERR_FLASH.
+ *  @side effects:	Advances the head.
+ */
+static int32_t writePage(void) {
+    kv_header_t *hdr = (kv_header_t *)page;
+    uint32_t ofs = pageOffset(head);
+    uint8_t commit = KV_COMMITTED;
+    int32_t output = KV_ERR_FLASH;
+
+    hdr->magic = KV_MAGIC;
+    hdr->seq = nextSeq;
+    hdr->crc = recordCrc();
+    hdr->commit = 0xFFU;
+    if ((flash_program(page, ofs, pageSize) == pageSize)
+            && (flash_program(&commit, ofs + HEADER_COMMIT_OFS, 1U) == 1U)) {
+        output = (int32_t)head;
+        nextSeq++;
+    }
+    head = (uint16_t)((head + 1U) % KV_PAGES);     /* a failed page is skipped */
+    return output;
+}
+
+static int32_t makeRoom(void);
+
+/*!
+ *  @brief    		Garbage collects the oldest block.
+ *  @returns  		KV_OK, KV_ERR_FULL if nothing could be freed, KV_ERR_FLASH.
+ *  @side effects:	Overwrites page[].
+ */
+static int32_t collect(void) {
+    uint16_t first = tailBlock * FLASH_BLOCK_PAGES;
+    uint8_t n;
+    int32_t output = KV_OK;
+
+    if (tailBlock == (head / FLASH_BLOCK_PAGES)) {
+        output = KV_ERR_FULL;
+    }
+    collecting = TRUE;
+    for (n = 0U; (output == KV_OK) && (n < FLASH_BLOCK_PAGES); n++) {
+        uint16_t p = first + n;
+        uint16_t pos;
+        kv_header_t *hdr = (kv_header_t *)page;
+        uint8_t key[KV_MAX_KEY];
+        uint8_t i;
+
+        if (readKey(p)) {
+            uint8_t len = hdr->keyLen;
+            for (i = 0U; i < len; i++) {
+                key[i] = page[sizeof(kv_header_t) + i];
+            }
+            if (findSlot(key, len, &pos) && ((slots[pos].page & SLOT_PAGE) == p)) {
+                if ((slots[pos].page & SLOT_DELETED) != 0U) {
+                    removeSlot(pos);                /* no older copy left */
+                } else {
+                    output = makeRoom();
+                    if ((output == KV_OK) && (flash_read(page, pageOffset(p), pageSize) != pageSize)) {
+                        output = KV_ERR_FLASH;
+                    }
+                    if (output == KV_OK) {
+                        output = writePage();
+                    }
+                    if (output >= 0) {
+                        slots[pos].page = (uint16_t)output;
+                        output = KV_OK;
+                    }
+                }
+            }
+        }
+    }
+    collecting = FALSE;
+
+    if (output == KV_OK) {
+        if (!flash_eraseBlock(pageOffset(first))) {
+            output = KV_ERR_FLASH;
+        } else {
+            tailBlock = (uint16_t)((tailBlock + 1U) % KV_BLOCKS);
+        }
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Makes sure the head page can be programmed, collecting old
+ *             		blocks when the head enters a new block.
+ *  @returns  		KV_OK, KV_ERR_FULL or KV_ERR_FLASH.
+ *  @side effects:	Overwrites page[].
+ */
+static int32_t makeRoom(void) {
+    int32_t output = KV_OK;
+    uint16_t tries = 0U;
+
+    if ((head % FLASH_BLOCK_PAGES) == 0U) {
+        if (!collecting) {
+            /* a block without stale records frees nothing, go on with the next */
+            while ((output == KV_OK)
+                    && ((KV_PAGES - usedPages()) < ((KV_RESERVE + 1U) * FLASH_BLOCK_PAGES))) {
+                output = (tries < KV_BLOCKS) ? collect() : KV_ERR_FULL;
+                tries++;
+            }
+        }
+        /* copies made by the collection may have moved the head into the block */
+        if ((output == KV_OK) && ((head % FLASH_BLOCK_PAGES) == 0U)) {
+            output = ensureErased(head / FLASH_BLOCK_PAGES);
+        }
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Appends a record and points the index at it.
+ *  @returns  		KV_OK or error code.
+ *  @side effects:	Overwrites page[].
+ */
+static int32_t append(const uint8_t *key, uint8_t keyLen, const uint8_t *value, uint16_t len, uint8_t flags) {
+    kv_header_t *hdr = (kv_header_t *)page;
+    uint16_t pos = 0U;
+    uint16_t i;
+    Bool found = FALSE;
+    int32_t output = makeRoom();
+
+    if (output == KV_OK) {
+        found = findSlot(key, keyLen, &pos);
+        if ((!found) && (used >= KV_INDEX_LIMIT)) {
+            output = KV_ERR_INDEX;
+        }
+    }
+    if (output == KV_OK) {
+        for (i = 0U; i < pageSize; i++) {
+            page[i] = 0xFFU;
+        }
+        hdr->keyLen = keyLen;
+        hdr->flags = flags;
+        hdr->valLen = len;
+        for (i = 0U; i < keyLen; i++) {
+            page[sizeof(kv_header_t) + i] = key[i];
+        }
+        for (i = 0U; i < len; i++) {
+            page[sizeof(kv_header_t) + keyLen + i] = value[i];
+        }
+        output = writePage();
+    }
+    if (output >= 0) {
+        if (!found) {
+            slots[pos].hash = hashKey(key, keyLen);
+            used++;
+        }
+        slots[pos].page = (uint16_t)output | (((flags & KV_FLAG_DELETED) != 0U) ? SLOT_DELETED : 0U);
+        output = KV_OK;
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Adds a record found at boot to the index, keeping the newest one.
+ *  @returns  		KV_OK or KV_ERR_INDEX.
+ *  @side effects:	Overwrites page[].
+ */
+static int32_t indexPage(uint16_t p, const kv_header_t *hdr, const uint8_t *key) {
+    kv_header_t old;
+    uint16_t pos;
+    int32_t output = KV_OK;
+    uint16_t flag = ((hdr->flags & KV_FLAG_DELETED) != 0U) ? SLOT_DELETED : 0U;
+
+    if (findSlot(key, hdr->keyLen, &pos)) {
+        if (readHeader(slots[pos].page & SLOT_PAGE, &old) && ((int32_t)(hdr->seq - old.seq) > 0)) {
+            slots[pos].page = p | flag;
+        }
+    } else if (used < KV_INDEX_LIMIT) {
+        slots[pos].hash = hashKey(key, hdr->keyLen);
+        slots[pos].page = p | flag;
+        used++;
+    } else {
+        output = KV_ERR_INDEX;
+    }
+    return output;
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Mounts the store: scans the page headers and rebuilds the
+ *             		index. An area without any record is erased (formatted).
+ *  @returns  		Number of keys (including deleted ones not collected yet) or error code.
+ *  @side effects:	flash_init has to succeed prior to running this function.
+ *             		Takes about a second, first boot with a format longer.
+ */
+int32_t kv_init(void) {
+    kv_header_t hdr;
+    uint8_t key[KV_MAX_KEY];
+    uint32_t minSeq = 0U;
+    uint32_t maxSeq = 0U;
+    uint16_t last = NO_PAGE;
+    uint16_t p;
+    uint16_t i;
+    int32_t output = KV_OK;
+
+    ready = FALSE;
+    pageSize = flash_getPageSize();
+    if ((pageSize == 0U) || (pageSize > KV_PAGE_MAX)) {
+        output = KV_ERR_FLASH;
+    }
+    for (i = 0U; i < KV_INDEX_SIZE; i++) {
+        slots[i].page = NO_PAGE;
+    }
+    used = 0U;
+
+    for (p = 0U; (output == KV_OK) && (p < KV_PAGES); p++) {
+        if (!readKey(p)) {
+            continue;
+        }
+        hdr = *(const kv_header_t *)page;
+        for (i = 0U; i < hdr.keyLen; i++) {
+            key[i] = page[sizeof(kv_header_t) + i];
+        }
+        /* sequence numbers compare modulo 2^32, the first record sets both ends */
+        if ((last == NO_PAGE) || ((int32_t)(hdr.seq - minSeq) < 0)) {
+            minSeq = hdr.seq;
+            tailBlock = p / FLASH_BLOCK_PAGES;
+        }
+        if ((last == NO_PAGE) || ((int32_t)(hdr.seq - maxSeq) > 0)) {
+            maxSeq = hdr.seq;
+            last = p;
+        }
+        output = indexPage(p, &hdr, key);
+    }
+
+    if ((output == KV_OK) && (last == NO_PAGE)) {
+        for (i = 0U; (output == KV_OK) && (i < KV_BLOCKS); i++) {
+            output = ensureErased(i);
+        }
+        head = 0U;
+        tailBlock = 0U;
+        nextSeq = 1U;
+    } else if (output == KV_OK) {
+        /* skip pages cut off after the newest record */
+        head = (uint16_t)((last + 1U) % KV_PAGES);
+        while ((head % FLASH_BLOCK_PAGES) != 0U) {
+            if (readHeader(head, &hdr) && (hdr.magic == KV_BLANK)) {
+                break;
+            }
+            head++;
+        }
+        head = (uint16_t)(head % KV_PAGES);
+        nextSeq = maxSeq + 1U;
+    } else {}
+
+    if (output == KV_OK) {
+        ready = TRUE;
+        output = (int32_t)used;
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Stores a value, replacing the previous one.
+ *  @param key		const char*,
+ *             		null terminated key, 1..KV_MAX_KEY characters.
+ *  @param value	const void*,
+ *             		data to store.
+ *  @param len		uint16_t,
+ *             		data length, up to kv_maxValue(key).
+ *  @returns  		KV_OK or error code.
+ *  @side effects:	Blocks while the page is programmed, longer when a block
+ *             		has to be collected.
+ */
+int32_t kv_put(const char *key, const void *value, uint16_t len) {
+    uint8_t keyLen = keyLength(key);
+    int32_t output = KV_ERR_FLASH;
+
+    if ((keyLen == 0U) || (keyLen > KV_MAX_KEY) || (len > kv_maxValue(key))) {
+        output = KV_ERR_PARAM;
+    } else if (ready) {
+        output = append((const uint8_t *)key, keyLen, (const uint8_t *)value, len, 0U);
+    } else {}
+    return output;
+}
+
+/*!
+ *  @brief    		Reads a value.
+ *  @param key		const char*,
+ *             		null terminated key.
+ *  @param value	void*,
+ *             		output buffer.
+ *  @param size		uint16_t,
+ *             		size of value, a longer value is truncated.
+ *  @returns  		Length of the stored value or error code.
+ *  @side effects:	None.
+ */
+int32_t kv_get(const char *key, void *value, uint16_t size) {
+    uint8_t keyLen = keyLength(key);
+    uint16_t pos;
+    int32_t output = KV_ERR_NOTFOUND;
+
+    if ((keyLen == 0U) || (keyLen > KV_MAX_KEY)) {
+        output = KV_ERR_PARAM;
+    } else if (!ready) {
+        output = KV_ERR_FLASH;
+    } else if (findSlot((const uint8_t *)key, keyLen, &pos) && ((slots[pos].page & SLOT_DELETED) == 0U)) {
+        const kv_header_t *hdr = (const kv_header_t *)page;
+        uint16_t i;
+        if ((flash_read(page, pageOffset(slots[pos].page & SLOT_PAGE), pageSize) != pageSize)
+                || (recordCrc() != hdr->crc)) {
+            output = KV_ERR_FLASH;
+        } else {
+            for (i = 0U; (i < hdr->valLen) && (i < size); i++) {
+                ((uint8_t *)value)[i] = page[sizeof(kv_header_t) + keyLen + i];
+            }
+            output = (int32_t)hdr->valLen;
+        }
+    } else {}
+    return output;
+}
+
+/*!
+ *  @brief    		Deletes a key.
+ *  @param key		const char*,
+ *             		null terminated key.
+ *  @returns  		KV_OK or error code.
+ *  @side effects:	Writes a tombstone page.
+ */
+int32_t kv_delete(const char *key) {
+    uint8_t keyLen = keyLength(key);
+    uint16_t pos;
+    int32_t output = KV_ERR_NOTFOUND;
+
+    if ((keyLen == 0U) || (keyLen > KV_MAX_KEY)) {
+        output = KV_ERR_PARAM;
+    } else if (!ready) {
+        output = KV_ERR_FLASH;
+    } else if (findSlot((const uint8_t *)key, keyLen, &pos) && ((slots[pos].page & SLOT_DELETED) == 0U)) {
+        output = append((const uint8_t *)key, keyLen, NULL, 0U, KV_FLAG_DELETED);
+    } else {}
+    return output;
+}
+
+/*!
+ *  @brief    		Longest value that can be stored under key.
+ *  @returns  		Bytes, 0 if the store is not mounted or the key is too long.
+ *  @side effects:	None.
+ */
+uint16_t kv_maxValue(const char *key) {
+    uint8_t keyLen = keyLength(key);
+    uint16_t output = 0U;
+    if ((keyLen <= KV_MAX_KEY) && (pageSize > (sizeof(kv_header_t) + keyLen))) {
+        output = (uint16_t)(pageSize - sizeof(kv_header_t) - keyLen);
+    }
+    return output;
+}
@@ -0,0 +1,31 @@
+/*****************************************************************************
+ *   kvstore.h:  Header file for the key/value store on the SPI DataFlash
+ *
+******************************************************************************/
+#ifndef __KVSTORE_H
+#define __KVSTORE_H
+
+#include "lpc_types.h"
+
+/* Longest key, keys are null terminated strings */
+#define KV_MAX_KEY          16U
+
+/* Return codes, values >= 0 mean success */
+#define KV_OK               0
+#define KV_ERR_NOTFOUND     (-1)    /* no such key */
+#define KV_ERR_FULL         (-2)    /* no space left after garbage collection */
+#define KV_ERR_PARAM        (-3)    /* key or value too long */
+#define KV_ERR_FLASH        (-4)    /* flash missing, busy or data corrupted */
+#define KV_ERR_INDEX        (-5)    /* too many keys for the RAM index */
+
+int32_t kv_init(void);
+int32_t kv_put(const char *key, const void *value, uint16_t len);
+int32_t kv_get(const char *key, void *value, uint16_t size);
+int32_t kv_delete(const char *key);
+uint16_t kv_maxValue(const char *key);
+
+
+#endif /* end __KVSTORE_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
@@ -15,6 +15,7 @@
 #include "temp.h"
 #include "lpc17xx_dac.h"
 #include "lpc17xx_ssp.h"
+#include "lpc17xx_gpdma.h"
 
 
 #include "joystick.h"
@@ -26,21 +27,33 @@
 #include "rgb.h"
 #include "light.h"
 #include "eeprom.h"
+#include "flash.h"
+
+#include "datetime.h"
+#include "format.h"
+#include "telemetry.h"
+#include "assets.h"
+#include "profile.h"
+#include "trace.h"
+#include "boot.h"
+#include "serial.h"
+#include "proto.h"
+#include "cangroup.h"
+#include "net.h"
 
 #define NUM_SAMPLES 1000
 #define EEPROM_OFFSET 256
+#define TELEMETRY_PERIOD 1000U  // ms between lux/temperature records
+#define LIGHT_SETTLE_MS 100U    // first 16 bit integration of the light sensor
 
 //////////////////////////////////////////////
 //Global vars
-static Bool leapYear = FALSE;
 static uint32_t msTicks = 0;
 static Bool editing = FALSE;
 static Bool directionOfNextAlarm;  //True - up, False - down
 static uint8_t eeprom_buffer[20];
-extern int sound_sz_up;
-extern int sound_sz_down;
-extern unsigned char sound_up[21396];
-extern unsigned char sound_down[16006];
+static const uint8_t *soundData[2] = {NULL, NULL};    // [0] - down, [1] - up, from the asset bundle
+static uint32_t soundLen[2] = {0, 0};
 static Bool disableSound = FALSE;
 static uint32_t cnt = 0;
 static uint32_t sound_offset = 0;
@@ -49,12 +62,17 @@ static uint32_t lumenActivation = 500;
 static int32_t prevCount = -1;
 static Bool sound_to_play; //True - up, False - down
 static int8_t roleteState = 0; //Zmienna odpowiedzialn za stan rolety -1 - dol, 0 - nieokreślony, 1 - gora
+static int32_t lastTemp = 0;        // last telemetry reading, temp_read blocks
+static uint16_t streamPeriod = 0U;  // ms between PROTO_SENSORS messages, 0 - off
+static Bool canOnline = FALSE;      // CAN self test passed
+static uint8_t canGroup = CANGROUP_DEFAULT; // own CAN group, besides CANGROUP_ALL
 //////////////////////////////////////////////
 struct alarm_struct {
     Bool MODE; //Down->0, Up->1
     uint8_t HOUR;
     uint8_t MIN;
 };
+static struct alarm_struct *remoteAlarm = NULL;   // alarms of main, for remote requests
 struct pos {
     uint8_t x;
     uint8_t y;
@@ -65,12 +83,6 @@ struct pos {
 //HEADER SECTION
 
 
-uint32_t len(uint32_t val);
-
-void uint32_t_to_str(uint32_t val,unsigned char *str);
-
-static void isLeap(void);
-
 static void init_ssp(void);
 
 static void init_i2c(void);
@@ -99,11 +111,9 @@ static void showLuxometerReading(void);
 
 static void showEditmode(Bool editmode);
 
-static void showPresentTime(struct alarm_struct alarm[], int8_t y);
+static void showPresentTime(const datetime_t *now, struct alarm_struct alarm[], int8_t y);
 
-static void valToString(uint32_t value,unsigned char *str, uint8_t len);
-
-static void chooseTime(struct pos map[4][3], int32_t LPC_values[], struct alarm_struct alarm[], int8_t x, int8_t y);
+static void chooseTime(struct pos map[4][3], const datetime_t *now, struct alarm_struct alarm[], int8_t x, int8_t y);
 
 static Bool JoystickControls(char key, Bool edit,Bool *prevStateJoyRight,Bool *prevStateJoyLeft,Bool *prevStateJoyUp,Bool *prevStateJoyDown);
 
@@ -115,11 +125,9 @@ static void configTimer2(void);
 
 void TIMER2_IRQHandler(void);
 
-static void changeValue(int16_t value, int32_t LPC_values[], struct alarm_struct alarm[2], uint8_t x, uint8_t y);
-
-static void correctDateValues(void);
+static void changeValue(int16_t value, datetime_t *now, struct alarm_struct alarm[2], uint8_t x, uint8_t y);
 
-static void setNextAlarm(struct alarm_struct alarm[]);
+static void setNextAlarm(const datetime_t *now, struct alarm_struct alarm[]);
 
 static int8_t read_time_from_eeprom(struct alarm_struct alarm[]);
 
@@ -127,8 +135,24 @@ static int8_t write_time_to_eeprom(struct alarm_struct alarm[]);
 
 void RTC_IRQHandler(void);
 
+void DMA_IRQHandler(void);
+
+void UART3_IRQHandler(void);
+
+void CAN_IRQHandler(void);
+
+void ENET_IRQHandler(void);
+
 static void activateMotor(void);
 
+static void setActivationMode(uint8_t mode);
+
+static uint32_t sensorRecord(uint8_t *out);
+
+static uint32_t remoteRequest(uint8_t type, const uint8_t *data, uint32_t len, uint8_t *resp);
+
+static void joinCanGroups(void);
+
 ///////////////////////////////////////////////////////
 ///LIB FUNCTION HEADERS TO SATISFY MISRA
 uint32_t GPIO_ReadValue(uint8_t portNum);
@@ -136,62 +160,11 @@ uint32_t GPIO_ReadValue(uint8_t portNum);
 uint32_t SysTick_Config(uint32_t ticks);
 
 void RTC_Init (LPC_RTC_TypeDef *RTCx);
-///////////////////////////////////////////////////////
-
-/*!
- *  @brief    		Returns length of uint32_t number.
- *  @param val  	uint32_t,
- *             		value to check the length of.
- *  @returns  		Lenght of param 'val'.
- *  @side effects:  None.
- */
-uint32_t len(uint32_t val) {
-    uint32_t i = 0;
-    uint32_t param_val = val;
-    while (param_val > 0U) {
-        i++;
-        param_val /= 10;
-    }
-    return i;
-}
 
-/*!
- *  @brief    		Converts uint32_t number into char array. Adds null character at the end.
- *  @param val  	uint32_t,
- *             		value to convert to char array.
- *  @param str 		char*,
- *             		char array to write to, of length value + 1 (for null char at the end).
- *  @returns  		
- *  @side effects:	For this function to be safe, char* str parameter has to be carefully initialised with proper size.
- */
-void uint32_t_to_str(uint32_t val,unsigned char *str) {
-    uint32_t val_len = len(val);
-    uint32_t param_val = val;
-    for (int32_t i = (int32_t)val_len - 1; i >= 0; i--) {
-        str[i] = (char)((param_val % 10U) + '0');
-        param_val /= 10;
-    }
-    for (int32_t i = val_len; i < 6; i++) {
-        str[i] = ' ';
-    }
-    str[5] = '\0';
-}
+void RTC_InvalidateSnapshot (LPC_RTC_TypeDef *RTCx);
 
-/*!
- *  @brief    		Returns bool value whether or not Real Time Clock: Year is a leap year or not,
-					Example: 2000 is leap, 2001 is not leap, 1900 is not leap, 1600 is leap.
- *  @returns  		TRUE - if is leap, FALSE - otherwise.
- *  @side effects:	LPC_RTC has to be initialised prior to running this function.
- */
-void isLeap(void) {
-    Bool a = FALSE;
-    if ((LPC_RTC->YEAR % 400) == 0) { a = TRUE; }
-    else if ((LPC_RTC->YEAR % 100) == 0) { a = FALSE; }
-    else if ((LPC_RTC->YEAR % 4) == 0) { a = TRUE; }
-    else { a = FALSE; }
-    leapYear = a;
-    return;
-}
+void disk_timerproc (void);
+///////////////////////////////////////////////////////
 
 /*!
  *  @brief    Initializes a SSP
@@ -304,6 +277,8 @@ Bool checkDifference(void) {
  */
 void PWM_Right(void) {
     if (!(GPIO_ReadValue(2) & ((uint32_t)1U << 11U))) {
+        (void)telemetry_push(TELEMETRY_MOTOR, TELEMETRY_MOTOR_RIGHT, (uint32_t)(int32_t)roleteState);
+        TRACE(TRACE_MOTOR, TELEMETRY_MOTOR_RIGHT);
         GPIO_ClearValue(2, ((uint32_t)1U << 10U));
         GPIO_SetValue(2, ((uint32_t)1U << 11U));
     }
@@ -316,6 +291,8 @@ void PWM_Right(void) {
  */
 void PWM_Left(void) {
     if (!(GPIO_ReadValue(2) & ((uint32_t)1U << 10U))) {
+        (void)telemetry_push(TELEMETRY_MOTOR, TELEMETRY_MOTOR_LEFT, (uint32_t)(int32_t)roleteState);
+        TRACE(TRACE_MOTOR, TELEMETRY_MOTOR_LEFT);
         GPIO_ClearValue(2, ((uint32_t)1U << 11U));
         GPIO_SetValue(2, ((uint32_t)1U << 10U));
     }
@@ -324,9 +301,13 @@ void PWM_Left(void) {
 /*!
  *  @brief			Stops motor rotation, by clearing proper GPIO pins
  *  @returns
- *  @side effects:  None.
+ *  @side effects:  Logs a motor record when the motor was running.
  */
 void PWM_Stop_Mov(void) {
+    if ((GPIO_ReadValue(2) & ((uint32_t)3U << 10U)) != 0U) {
+        (void)telemetry_push(TELEMETRY_MOTOR, TELEMETRY_MOTOR_STOP, (uint32_t)(int32_t)roleteState);
+        TRACE(TRACE_MOTOR, TELEMETRY_MOTOR_STOP);
+    }
     GPIO_ClearValue(2, ((uint32_t)3U << 10U));
 }
 
@@ -347,10 +328,10 @@ void PWM_Stop_Mov(void) {
 					[37-40] - “data” “data” chunk header. Marks the beginning of the data section.
 					[41-44] - File size (data) Size of the data section.
  *  @param to_validate Bool,
- *            		Selector which sound to validate, TRUE - validate extern const unsinged char sound_up[], FALSE - validate extern const unsigned char sound_down[]
+ *            		Selector which sound to validate, TRUE - validate asset "up", FALSE - validate asset "down" of the asset bundle
  *  @returns  		int32_t sampleRate equal to sample rate from wav file IF validation passes,
  * 					IF validation fails, returns error code:
- * 					-1 - missing or wrong format (RIFF expected)
+ * 					-1 - missing asset or wrong format (RIFF expected)
  * 					-2 - missing or wrong format (WAVE expected)
  * 					-3 - missing "fmt"
  * 					-4 - missing or unsupported sample rate (8000 expected)
@@ -360,74 +341,82 @@ void PWM_Stop_Mov(void) {
 int32_t get_sample_rate(Bool to_validate) {
     cnt = 0;
     int32_t error = 0;
-    unsigned char *sound_8k;
-    if (to_validate) {
-        sound_8k = sound_up;
-    } else {
-        sound_8k = sound_down;
-    }
-    /* ChunkID */
-    if ((sound_8k[cnt] != (unsigned char)'R')
-    &&(sound_8k[cnt + 1U] != (unsigned char)'I')
-    &&(sound_8k[cnt + 2U] != (unsigned char)'F')
-    &&(sound_8k[cnt + 3U] != (unsigned char)'F')) {
-        //Wrong format (RIFF)
+    int32_t sampleRate = 0;
+    uint8_t idx = to_validate ? 1U : 0U;
+    const asset_entry_t *asset = assets_find(to_validate ? "up" : "down");
+    const uint8_t *sound_8k;
+    if ((asset == NULL) || (asset->type != ASSET_WAV) || (asset->length < 44U)) {
+        //Missing sound
         error = -1;
-    }
-    cnt += 4U;
-
-    /* skip chunk size*/
-    cnt += 4U;
-
-    /* Format */
-    if ((sound_8k[cnt] != (unsigned char)'W')
-    && (sound_8k[cnt + 1U] != (unsigned char)'A')
-    && (sound_8k[cnt + 2U] != (unsigned char)'V')
-    && (sound_8k[cnt + 3U] != (unsigned char)'E')) {
-        //Wrong format (WAVE)
-        error = -2;
-    }
-    cnt += 4U;
-
-    /* SubChunk1ID */
-    if ((sound_8k[cnt] != (unsigned char)'f')
-    && (sound_8k[cnt + 1U] != (unsigned char)'m')
-    && (sound_8k[cnt + 2U] != (unsigned char)'t')
-    && (sound_8k[cnt + 3U] != (unsigned char)' ')) {
-        //Missing fmt
-        error = -3;
-    }
-    cnt += 4U;
+    } else {
+        sound_8k = assets_data(asset);
+        /* ChunkID */
+        if ((sound_8k[cnt] != (unsigned char)'R')
+        &&(sound_8k[cnt + 1U] != (unsigned char)'I')
+        &&(sound_8k[cnt + 2U] != (unsigned char)'F')
+        &&(sound_8k[cnt + 3U] != (unsigned char)'F')) {
+            //Wrong format (RIFF)
+            error = -1;
+        }
+        cnt += 4U;
+
+        /* skip chunk size*/
+        cnt += 4U;
+
+        /* Format */
+        if ((sound_8k[cnt] != (unsigned char)'W')
+        && (sound_8k[cnt + 1U] != (unsigned char)'A')
+        && (sound_8k[cnt + 2U] != (unsigned char)'V')
+        && (sound_8k[cnt + 3U] != (unsigned char)'E')) {
+            //Wrong format (WAVE)
+            error = -2;
+        }
+        cnt += 4U;
+
+        /* SubChunk1ID */
+        if ((sound_8k[cnt] != (unsigned char)'f')
+        && (sound_8k[cnt + 1U] != (unsigned char)'m')
+        && (sound_8k[cnt + 2U] != (unsigned char)'t')
+        && (sound_8k[cnt + 3U] != (unsigned char)' ')) {
+            //Missing fmt
+            error = -3;
+        }
+        cnt += 4U;
 
-    /* skip chunk size, audio format, num channels */
-    cnt += 8U;
+        /* skip chunk size, audio format, num channels */
+        cnt += 8U;
 
-    int32_t sampleRate = (sound_8k[cnt] | (sound_8k[cnt + 1U] << 8) |
+        sampleRate = (sound_8k[cnt] | (sound_8k[cnt + 1U] << 8) |
                           (sound_8k[cnt + 2U] << 16) | (sound_8k[cnt + 3U] << 24));
 
-    if (sampleRate != 8000) {
-        //Only 8kHz supported
-        error = -4;
-    }
+        if (sampleRate != 8000) {
+            //Only 8kHz supported
+            error = -4;
+        }
 
-    cnt += 4U;
+        cnt += 4U;
 
-    /* skip byte rate, align, bits per sample */
-    cnt += 8U;
+        /* skip byte rate, align, bits per sample */
+        cnt += 8U;
 
-    /* SubChunk2ID */
-    if ((sound_8k[cnt] != (unsigned char)'d')
-    && (sound_8k[cnt + 1U] != (unsigned char)'a')
-    && (sound_8k[cnt + 2U] != (unsigned char)'t')
-    && (sound_8k[cnt + 3U] != (unsigned char)'a')) {
-        //Missing data
-        error = -5;
+        /* SubChunk2ID */
+        if ((sound_8k[cnt] != (unsigned char)'d')
+        && (sound_8k[cnt + 1U] != (unsigned char)'a')
+        && (sound_8k[cnt + 2U] != (unsigned char)'t')
+        && (sound_8k[cnt + 3U] != (unsigned char)'a')) {
+            //Missing data
+            error = -5;
+        }
+        cnt += 4U;
+
+        /* skip chunk size */
+        cnt += 4U;
+        sound_offset = cnt;
+        if (error == 0) {
+            soundData[idx] = sound_8k;
+            soundLen[idx] = asset->length;
+        }
     }
-    cnt += 4U;
-
-    /* skip chunk size */
-    cnt += 4U;
-    sound_offset = cnt;
     if(error != 0) {
         sampleRate = error;
     }
@@ -437,36 +426,41 @@ int32_t get_sample_rate(Bool to_validate) {
 /*!
  *  @brief    		Reads temperature value and prepares a char array to be displayed on OLED screen.
  *  @param temp_str	char*,
- *             		char array to write to, of length value + 4 ("xx.x C", where xxx is a value returned by temp_read()).
+ *             		char array to write to, at least FORMAT_MAX_DIGITS + 5 long ("xx.x C", "-xx.x C").
  *  @returns
- *  @side effects:	For this function to be safe, char* temp_str parameter has to be carefully initialized with proper size, reaching negative value causes loop to break preemptively.
+ *  @side effects:	None.
  */
 void write_temp_on_screen(unsigned char *temp_str) {
     int32_t temp = temp_read();
-    for (int32_t i = 3; i >= 0; i--) {
-        temp_str[i] = (char) ((temp % 10) + '0');
-        if (temp <= 0) {
-            break;
-        }
-        if (i == 2) {
-            temp_str[i] = '.';
-        } else {
-            temp = temp / 10;
+    uint8_t n;
+
+    if (temp != TEMP_NO_READING) {
+        n = format_fixed(temp_str, temp, 1U, 4U, 0U);
+    } else {
+        for (n = 0U; n < 4U; n++) {
+            temp_str[n] = '-';
         }
     }
-    temp_str[4] = ' ';
-    temp_str[5] = 'C';
-    temp_str[6] = '\0';
+    temp_str[n] = ' ';
+    temp_str[n + 1U] = 'C';
+    temp_str[n + 2U] = '\0';
 }
 
 /*!
  *  @brief    Function that increment amount of msTicks
  *  @returns
  *  @side effects:
- *            None.
+ *            Runs the SD card timers every 10 ms and the status poll of a
+ *            DataFlash write being waited for.
  */
 void SysTick_Handler(void) {
+    PROFILE_BEGIN(PROFILE_SYSTICK_ISR);
     msTicks++;
+    flash_tick();
+    if ((msTicks % 10U) == 0U) {
+        disk_timerproc();
+    }
+    PROFILE_END(PROFILE_SYSTICK_ISR);
 }
 
 /*!
@@ -487,7 +481,7 @@ uint32_t getMsTicks(void) {
  *            Program gets slowly when funtion is procceding
  */
 void showOurTemp(void) {
-    unsigned char naszString[7];
+    unsigned char naszString[FORMAT_MAX_DIGITS + 5U];
     write_temp_on_screen(naszString);
     oled_putString(1, 0, naszString, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
 }
@@ -501,7 +495,7 @@ void showOurTemp(void) {
 void showLuxometerReading(void) {
     uint32_t light_val = light_read();
     unsigned char xdd[6];
-    uint32_t_to_str(light_val, xdd);
+    (void)format_uint(xdd, light_val, 5U, FORMAT_LEFT);
     oled_putString(43, 1, xdd, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
 }
 
@@ -526,6 +520,8 @@ void showEditmode(Bool editmode) {
 
 /*!
  *  @brief    Function shows present time and alarms on screen
+ *  @param const datetime_t *now
+ *             Current RTC date and time
  *  @param struct alarm_struct  alarm[]
  *             struct table which has alarms data
  *  @param int8_t y
@@ -534,97 +530,24 @@ void showEditmode(Bool editmode) {
  *  @side effects:
  *            Not handling OLED errors
  */
-void showPresentTime(struct alarm_struct alarm[], int8_t y) {
-    unsigned char date_str[10];
-    uint16_t year = LPC_RTC->YEAR;
-
-    for (int8_t i = 3; i >= 0; i--) {
-        date_str[i] = (unsigned char)((uint8_t)(year % 10U) + '0');
-        if (year == 0U) {
-            break;
-        }
-        year = year / 10U;
-    }
-    date_str[4] = '-';
-
-    uint8_t month = LPC_RTC->MONTH;
-    for (uint8_t i = 6U; i >= 5U; i--) {
-        date_str[i] = (unsigned char)((uint8_t)(month % 10U) + '0');
-        if (month == 0U) {
-            break;
-        }
-        month = month / 10U;
-    }
-
-    date_str[7] = '-';
-
-    uint8_t day = LPC_RTC->DOM;
-    for (uint8_t i = 9U; i >= 8U; i--) {
-        date_str[i] = (unsigned char)((uint8_t)(day % 10U) + '0');
-        if (day == 0U) {
-            break;
-        }
-        day = day / 10U;
-    }
-
+void showPresentTime(const datetime_t *now, struct alarm_struct alarm[], int8_t y) {
+    unsigned char date_str[11];
     unsigned char time_str[9];
+    unsigned char alarm_str[8];
+    unsigned char activation[8];
 
-    uint8_t hour = LPC_RTC->HOUR;
-
-    for (int8_t i = 1; i >= 0; i--) {
-        time_str[i] = (unsigned char)((uint8_t)(hour % 10U) + '0');
-        hour = hour / 10U;
-    }
-
-
-    time_str[2] = ':';
-
-    uint8_t minute = LPC_RTC->MIN;
-
-    for (uint8_t i = 4U; i >= 3U; i--) {
-        time_str[i] = (unsigned char)((uint8_t)(minute % 10U) + '0');
-        minute = minute / 10U;
-    }
-
-
-    time_str[5] = ':';
+    (void)format_date(date_str, now);
+    (void)format_time(time_str, now);
 
-    uint8_t sec = LPC_RTC->SEC;
-    for (uint8_t i = 7U; i >= 6U; i--) {
-        time_str[i] = (unsigned char)((uint8_t)(sec % 10U) + '0');
-        sec = sec / 10U;
-    }
-    unsigned char alarm_str[8];
-    alarm_str[7] = '\0';
-    uint8_t min;
     if (y == 3) {
         alarm_str[0] = 'U';
-        alarm_str[1] = ' ';
-        hour = alarm[1].HOUR;
-        min = alarm[1].MIN;
+        (void)format_hhmm(&alarm_str[2], alarm[1].HOUR, alarm[1].MIN);
     } else {
         alarm_str[0] = 'D';
-        alarm_str[1] = ' ';
-        hour = alarm[0].HOUR;
-        min = alarm[0].MIN;
+        (void)format_hhmm(&alarm_str[2], alarm[0].HOUR, alarm[0].MIN);
     }
+    alarm_str[1] = ' ';
 
-    for (uint8_t i = 3U; i >= 2U; i--) {
-        alarm_str[i] = (unsigned char)((uint8_t)(hour % 10U) + '0');
-
-
-        hour = hour / 10U;
-    }
-    alarm_str[4] = ':';
-
-    for (uint8_t i = 6U; i >= 5U; i--) {
-        alarm_str[i] = (unsigned char)((uint8_t)(min % 10U) + '0');
-
-
-        min = min / 10U;
-    }
-    time_str[8] = '\0';
-    unsigned char activation[8];
     if (activationMode == 0U) {
         activation[0] = 'N';
     } else if (activationMode == 1U) {
@@ -635,45 +558,14 @@ void showPresentTime(struct alarm_struct alarm[], int8_t y) {
         activation[0] = 'B';
     }
     activation[1] = ' ';
-    uint32_t lumens_to_display = lumenActivation;
-    for (uint8_t i = 6U; i >= 2U; i--) {
-        activation[i] = (unsigned char)((uint8_t)(lumens_to_display % 10U) + '0');
+    (void)format_uint(&activation[2], lumenActivation, 5U, 0U);
 
-        if ((lumens_to_display == 0U) && (i != 6U)) {
-            activation[i] = ' ';
-        }
-        lumens_to_display = lumens_to_display / 10U;
-    }
-
-    activation[7] = '\0';
     oled_putString(1, 12, date_str, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
     oled_putString(1, 24, time_str, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
     oled_putString(37, 36, alarm_str, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
     oled_putString(31, 48, activation, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
 }
 
-/*!
- *  @brief    Converts uint32_t value to an char arrow
- *  @param uint32_t value
- *            A value to convert
- *  @param char* str
- *            A char arrow catch a converted value
- *  @param uint8_t len
- *            length of arrow
- *  @returns
- *  @side effects:
- *            None.
- */
-void valToString(uint32_t value,unsigned char *str, uint8_t len) {
-    int i = len;
-    uint32_t param_val = value;
-    str[i] = '\0';
-    for (int j = i - 1; j >= 0; j--) {
-        str[j] = (char)((uint8_t)(param_val % 10U) + '0');
-        param_val = param_val / 10U;
-    }
-}
-
 /*!
  *  @brief    Function that allows us to change these fields:
  *            Actual date and time,
@@ -682,8 +574,8 @@ void valToString(uint32_t value,unsigned char *str, uint8_t len) {
  *            Lumen activation level
  *  @param struct pos map[4][3]
  *            A map of positions
- *  @param int32_t LPC_values[]
- *            An arrow of LPC_RTC values
+ *  @param const datetime_t *now
+ *            Current RTC date and time
  *  @param struct alarm_struct alarm[]
  *            An arrow of alarm values
  *  @param int8_t x
@@ -694,17 +586,17 @@ void valToString(uint32_t value,unsigned char *str, uint8_t len) {
  *  @side effects:
  *            None.
  */
-void chooseTime(struct pos map[4][3], int32_t LPC_values[], struct alarm_struct alarm[], int8_t x, int8_t y) {
-    unsigned char str[5];
+void chooseTime(struct pos map[4][3], const datetime_t *now, struct alarm_struct alarm[], int8_t x, int8_t y) {
+    unsigned char str[6];
     uint8_t leng = map[y][x].length;
     uint8_t toAdd = 0;
     if ((x + (y * 3)) < 6) {
-        valToString(LPC_values[x + (y * 3)], str, leng);
+        (void)format_uint(str, datetime_getField(now, (datetime_field_t)(x + (y * 3))), leng, FORMAT_ZEROPAD);
     } else if ((x + (y * 3)) < 12) {
-        if (x == 1) { valToString(alarm[y - 2].HOUR, str, leng); }
-        else if (x == 2) { valToString(alarm[y - 2].MIN, str, leng); }
+        if (x == 1) { (void)format_uint(str, alarm[y - 2].HOUR, leng, FORMAT_ZEROPAD); }
+        else if (x == 2) { (void)format_uint(str, alarm[y - 2].MIN, leng, FORMAT_ZEROPAD); }
         else {}
-        if (x != 0) { setNextAlarm(alarm); }
+        if (x != 0) { setNextAlarm(now, alarm); }
         else {}
     } else {
         if (x == 0) {
@@ -728,7 +620,7 @@ void chooseTime(struct pos map[4][3], int32_t LPC_values[], struct alarm_struct
                 toAdd = 18U;
             }
             else {}
-            valToString(lumenActivation, str, len(lumenActivation));
+            (void)format_uint(str, lumenActivation, 0U, 0U);
         }
         else {}
 
@@ -856,17 +748,18 @@ void initTimer0(void) {
  *  @side effects:
  *            Execute even if the sound is not correctly loaded
  */
-void TIMER0_IRQHandler(void) {
+__RAMFUNC void TIMER0_IRQHandler(void) {
+    PROFILE_BEGIN(PROFILE_TIMER0_ISR);
+    TRACE(TRACE_TIMER0_ENTER, LPC_TIM0->IR);
     if (LPC_TIM0->IR & (1U << 0U)) {
         LPC_TIM0->IR = (1U << 0U);
         if (!disableSound) {
-            if (sound_to_play) {
-                if (cnt++ < sound_sz_up) { DAC_UpdateValue(LPC_DAC, (uint32_t)(sound_up[cnt])); }
-            } else {
-                if (cnt++ < sound_sz_down) { DAC_UpdateValue(LPC_DAC, (uint32_t)(sound_down[cnt])); }
-            }
+            uint8_t idx = sound_to_play ? 1U : 0U;
+            if (cnt++ < soundLen[idx]) { DAC_UpdateValue(LPC_DAC, (uint32_t)(soundData[idx][cnt])); }
         }
     }
+    TRACE(TRACE_TIMER0_EXIT, 0U);
+    PROFILE_END(PROFILE_TIMER0_ISR);
 }
 
 /*!
@@ -890,8 +783,8 @@ void configTimer2(void) {
  *  @brief    Changes a value x,y in pos
  *  @param int16_t value
  *            Value to add
- *  @param int32_t LPC_values[]
- *            Arrow of LPC Values
+ *  @param datetime_t *now
+ *            Current RTC date and time, updated when a date field is changed
  *  @param struct alarm_struct alarm[2]
  *            Arrow of alarm values
  *  @param uint8_t x
@@ -901,12 +794,13 @@ void configTimer2(void) {
  *  @returns  
  *  @side effects:
  *            None
- */void changeValue(int16_t value, int32_t LPC_values[], struct alarm_struct alarm[2], uint8_t x, uint8_t y) {
+ */void changeValue(int16_t value, datetime_t *now, struct alarm_struct alarm[2], uint8_t x, uint8_t y) {
     uint8_t pos_on_map = (y * 3U) + x;
     int32_t tmp;
     uint8_t i = 0U;
     if (pos_on_map < 6U) {
-        tmp = LPC_values[pos_on_map] + value;
+        datetime_addField(now, (datetime_field_t)pos_on_map, value);
+        datetime_writeRtc(now);
     } else if (pos_on_map < 12U) {
         if (pos_on_map < 9U) { i = 0U; }
         else { i = 1U; }
@@ -924,69 +818,6 @@ void configTimer2(void) {
     }
     else {}
     switch (pos_on_map) {
-        case 0:
-            if (tmp > 2099) { tmp = 2000; }
-            else if (tmp < 2000) { tmp = 2099; }
-            else {}
-            LPC_RTC->YEAR = tmp;
-            break;
-        case 1:
-            if (tmp > 12) { tmp = 1; }
-            else if (tmp < 1) { tmp = 12; }
-            else {}
-            LPC_RTC->MONTH = tmp;
-            break;
-        case 2:
-            if ((LPC_values[1] == 1)
-            || (LPC_values[1] == 3)
-            || (LPC_values[1] == 5)
-            || (LPC_values[1] == 7)
-            || (LPC_values[1] == 8 )
-            || (LPC_values[1] == 10)
-            || (LPC_values[1] == 12)) {
-                if (tmp > 31) { tmp = 1; }
-                else if (tmp < 1) { tmp = 31; }
-                else {}
-            } else if ((LPC_values[1] == 4 )
-            || (LPC_values[1] == 6)
-            || (LPC_values[1] == 9)
-            || (LPC_values[1] == 11)) {
-                if (tmp > 30) { tmp = 1; }
-                else if (tmp < 1) { tmp = 30; }
-                else {}
-            } else if (LPC_values[1] == 2) {
-                isLeap();
-                if (leapYear) {
-                    if (tmp > 29) { tmp = 1; }
-                    else if (tmp < 1) { tmp = 29; }
-                    else {}
-                } else {
-                    if (tmp > 28) { tmp = 1; }
-                    else if (tmp < 1) { tmp = 28; }
-                    else {}
-                }
-            }
-            else {}
-            LPC_RTC->DOM = tmp;
-            break;
-        case 3:
-            if (tmp > 23) { tmp = 0; }
-            else if (tmp < 0) { tmp = 23; }
-            else {}
-            LPC_RTC->HOUR = tmp;
-            break;
-        case 4:
-            if (tmp > 59) { tmp = 0; }
-            else if (tmp < 0) { tmp = 59; }
-            else {}
-            LPC_RTC->MIN = tmp;
-            break;
-        case 5:
-            if (tmp > 59) { tmp = 0; }
-            else if (tmp < 0) { tmp = 59; }
-            else {}
-            LPC_RTC->SEC = tmp;
-            break;
         case 6:
         case 9:
             break;
@@ -1008,12 +839,7 @@ void configTimer2(void) {
             if (tmp > 3) { tmp = 0; }
             else if (tmp < 0) { tmp = 3; }
             else {}
-            activationMode = (uint8_t)tmp;
-            if ((activationMode == 1U) || (activationMode == 3U)) {
-                LPC_RTC->AMR &= ~((1U << 2) | (1U << 1) | (1U << 0));
-            } else {
-                LPC_RTC->AMR |= ((1U << 2) | (1U << 1) | (1U << 0));
-            }
+            setActivationMode((uint8_t)tmp);
             break;
         case 13:
             if (tmp < 0) { tmp = 64000; }
@@ -1026,47 +852,29 @@ void configTimer2(void) {
     }
 }
 
-/*!
- *  @brief    Correct days of month when it's incorrect
- *  @returns  
- *  @side effects:
- *            None
- */
-void correctDateValues(void) {
-    isLeap();
-    const uint8_t lenghts[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-    if (LPC_RTC->DOM > lenghts[LPC_RTC->MONTH - 1]) {
-        if (leapYear && (LPC_RTC->MONTH == 2)) {
-            if (LPC_RTC->DOM > 29) {
-                LPC_RTC->DOM = 29;
-            }
-        } else {
-            LPC_RTC->DOM = lenghts[LPC_RTC->MONTH - 1];
-        }
-    }
-}
-
 /*!
  *  @brief    Sets nearest alarm in the future
+ *  @param const datetime_t *now
+ *            Current RTC date and time
  *  @param struct alarm_struct alarm[]
  *            Arrow of alarms
  *  @returns  
  *  @side effects:
  *            When the alarm was in the same minute, and next alarm will be in the next minute, programm sets again an alarm that was a moment ago
  */
-void setNextAlarm(struct alarm_struct alarm[]) {
-    int32_t hour0Diff = alarm[0].HOUR - LPC_RTC->HOUR + 24;
+void setNextAlarm(const datetime_t *now, struct alarm_struct alarm[]) {
+    int32_t hour0Diff = alarm[0].HOUR - now->hour + 24;
     hour0Diff = hour0Diff % 24;
-    int32_t minute0Diff = alarm[0].MIN - LPC_RTC->MIN + 60;
+    int32_t minute0Diff = alarm[0].MIN - now->min + 60;
     minute0Diff = minute0Diff % 60;
-    int32_t second0Diff = 60 - LPC_RTC->SEC;
+    int32_t second0Diff = 60 - now->sec;
     second0Diff = second0Diff % 60;
 
-    int32_t hour1Diff = alarm[1].HOUR - LPC_RTC->HOUR + 24;
+    int32_t hour1Diff = alarm[1].HOUR - now->hour + 24;
     hour1Diff = hour1Diff % 24;
-    int32_t minute1Diff = alarm[1].MIN - LPC_RTC->MIN + 60;
+    int32_t minute1Diff = alarm[1].MIN - now->min + 60;
     minute1Diff = minute1Diff % 60;
-    int32_t second1Diff = 60 - LPC_RTC->SEC;
+    int32_t second1Diff = 60 - now->sec;
     second1Diff = second1Diff % 60;
 
     LPC_RTC->ALSEC = 0;
@@ -1135,17 +943,20 @@ int8_t read_time_from_eeprom(struct alarm_struct alarm[]) {
         errorCode = -6;
     }
     if(errorCode == 0) {
-        LPC_RTC->YEAR = (uint16_t)((eeprom_buffer[5] * 100U) + eeprom_buffer[6]);
-        LPC_RTC->MONTH = eeprom_buffer[7];
-        LPC_RTC->DOM = eeprom_buffer[8];
-        LPC_RTC->HOUR = eeprom_buffer[9];
-        LPC_RTC->MIN = eeprom_buffer[10];
-        LPC_RTC->SEC = eeprom_buffer[11];
+        datetime_t stored;
+        stored.year = (uint16_t)((eeprom_buffer[5] * 100U) + eeprom_buffer[6]);
+        stored.month = eeprom_buffer[7];
+        stored.dom = eeprom_buffer[8];
+        stored.hour = eeprom_buffer[9];
+        stored.min = eeprom_buffer[10];
+        stored.sec = eeprom_buffer[11];
+        datetime_normalize(&stored);
+        datetime_writeRtc(&stored);
         alarm[0].HOUR = eeprom_buffer[12];
         alarm[0].MIN = eeprom_buffer[13];
         alarm[1].HOUR = eeprom_buffer[14];
         alarm[1].MIN = eeprom_buffer[15];
-        setNextAlarm(alarm);
+        setNextAlarm(&stored, alarm);
     }
     return errorCode;
 }
@@ -1163,18 +974,20 @@ int8_t read_time_from_eeprom(struct alarm_struct alarm[]) {
 int8_t write_time_to_eeprom(struct alarm_struct alarm[]) {
     const char header[] = "TIME";
     int8_t errorCode = 0;
+    datetime_t now;
+    datetime_readRtc(&now);
     for (uint8_t i = 0U; i < 4U; i++) {
         eeprom_buffer[i] = (uint8_t)(header[i]);
         eeprom_buffer[i + 16U] = (uint8_t)(header[i]);
     }
     eeprom_buffer[4] = 20U;
-    eeprom_buffer[5] = (uint8_t)(LPC_RTC->YEAR / 100U);
-    eeprom_buffer[6] = (uint8_t)(LPC_RTC->YEAR % 100U);
-    eeprom_buffer[7] = LPC_RTC->MONTH;
-    eeprom_buffer[8] = LPC_RTC->DOM;
-    eeprom_buffer[9] = LPC_RTC->HOUR;
-    eeprom_buffer[10] = LPC_RTC->MIN;
-    eeprom_buffer[11] = LPC_RTC->SEC;
+    eeprom_buffer[5] = (uint8_t)(now.year / 100U);
+    eeprom_buffer[6] = (uint8_t)(now.year % 100U);
+    eeprom_buffer[7] = now.month;
+    eeprom_buffer[8] = now.dom;
+    eeprom_buffer[9] = now.hour;
+    eeprom_buffer[10] = now.min;
+    eeprom_buffer[11] = now.sec;
     eeprom_buffer[12] = alarm[0].HOUR;
     eeprom_buffer[13] = alarm[0].MIN;
     eeprom_buffer[14] = alarm[1].HOUR;
@@ -1190,9 +1003,15 @@ int8_t write_time_to_eeprom(struct alarm_struct alarm[]) {
  *  @brief    RTC Interrupts Handler
  *  @returns  
  *  @side effects:
- *            None
+ *            Invalidates cached RTC snapshot on every second increment
  */
 void RTC_IRQHandler(void) {
+    PROFILE_BEGIN(PROFILE_RTC_ISR);
+    TRACE(TRACE_RTC_ENTER, LPC_RTC->ILR);
+    if (LPC_RTC->ILR & 1) {
+        LPC_RTC->ILR = 1;
+        RTC_InvalidateSnapshot(LPC_RTC);
+    }
     if (LPC_RTC->ILR & 2) {
         LPC_RTC->ILR = 2;
         cnt = sound_offset;
@@ -1205,6 +1024,49 @@ void RTC_IRQHandler(void) {
             PWM_Left();
         }
     }
+    TRACE(TRACE_RTC_EXIT, 0U);
+    PROFILE_END(PROFILE_RTC_ISR);
+}
+
+/*!
+ *  @brief    GPDMA Interrupts Handler, passes the interrupt on to the drivers using DMA channels
+ *  @returns
+ *  @side effects:
+ *            Completion callbacks of the drivers run from here
+ */
+void DMA_IRQHandler(void) {
+    flash_dmaIntHandler();
+    serial_dmaIntHandler();
+}
+
+/*!
+ *  @brief    UART3 Interrupts Handler, RX FIFO and TX refill of the serial service
+ *  @returns
+ *  @side effects:
+ *            Flow control hooks of the serial service run from here
+ */
+void UART3_IRQHandler(void) {
+    serial_intHandler();
+}
+
+/*!
+ *  @brief    CAN Interrupts Handler, RX queue and TX refill of the group messages
+ *  @returns
+ *  @side effects:
+ *            None
+ */
+void CAN_IRQHandler(void) {
+    cangroup_intHandler();
+}
+
+/*!
+ *  @brief    Ethernet Interrupts Handler, RX ring walk of the UDP endpoint
+ *  @returns
+ *  @side effects:
+ *            ARP requests are answered from here
+ */
+void ENET_IRQHandler(void) {
+    net_intHandler();
 }
 
 /*!
@@ -1236,23 +1098,235 @@ void activateMotor(void) {
     } else {}
 }
 
+/*!
+ *  @brief    Sets the activation mode and enables the RTC alarm for the modes using it
+ *  @param uint8_t mode
+ *            0 - none, 1 - alarms, 2 - light, 3 - both
+ *  @returns
+ *  @side effects:
+ *            None
+ */
+void setActivationMode(uint8_t mode) {
+    activationMode = mode;
+    if ((activationMode == 1U) || (activationMode == 3U)) {
+        LPC_RTC->AMR &= ~((1U << 2) | (1U << 1) | (1U << 0));
+    } else {
+        LPC_RTC->AMR |= ((1U << 2) | (1U << 1) | (1U << 0));
+    }
+}
+
+/*!
+ *  @brief    Builds a sensor record of the remote protocol
+ *  @param uint8_t *out
+ *            Destination, PROTO_SENSORS_LEN bytes
+ *  @returns  PROTO_SENSORS_LEN
+ *  @side effects:
+ *            Temperature is the last telemetry reading, temp_read blocks for too long
+ */
+uint32_t sensorRecord(uint8_t *out) {
+    uint32_t fields[3];
+    uint32_t motor = GPIO_ReadValue(2);
+
+    fields[0] = getMsTicks();
+    fields[1] = light_read();
+    fields[2] = (uint32_t)lastTemp;
+    for (uint8_t i = 0U; i < 12U; i++) {
+        out[i] = (uint8_t)(fields[i / 4U] >> ((i % 4U) * 8U));
+    }
+    if ((motor & ((uint32_t)1U << 10U)) != 0U) {
+        out[12] = TELEMETRY_MOTOR_LEFT;
+    } else if ((motor & ((uint32_t)1U << 11U)) != 0U) {
+        out[12] = TELEMETRY_MOTOR_RIGHT;
+    } else {
+        out[12] = TELEMETRY_MOTOR_STOP;
+    }
+    out[13] = (uint8_t)roleteState;
+    return PROTO_SENSORS_LEN;
+}
+
+/*!
+ *  @brief    Answers a request of the remote protocol, see proto.h
+ *  @param uint8_t type
+ *            Request type, PROTO_*
+ *  @param const uint8_t *data
+ *            Request payload
+ *  @param uint32_t len
+ *            Payload length
+ *  @param uint8_t *resp
+ *            Response payload, status first
+ *  @returns  Response length
+ *  @side effects:
+ *            Moves the motor, changes alarms and settings like the joystick does
+ */
+uint32_t remoteRequest(uint8_t type, const uint8_t *data, uint32_t len, uint8_t *resp) {
+    uint32_t respLen = 1U;
+    uint32_t value;
+    datetime_t now;
+
+    resp[0] = PROTO_OK;
+    switch (type) {
+        case PROTO_PING:
+            resp[1] = PROTO_VERSION;
+            respLen = 2U;
+            break;
+        case PROTO_MOVE:
+            if (len != 1U) {
+                resp[0] = PROTO_ERR_LENGTH;
+            } else if (data[0] == PROTO_MOVE_STOP) {
+                PWM_Stop_Mov();
+            } else if (data[0] == PROTO_MOVE_UP) {
+                prevCount = -1;     // like the buttons, the stall check starts over
+                if (roleteState != 1) { PWM_Left(); }
+            } else if (data[0] == PROTO_MOVE_DOWN) {
+                prevCount = -1;
+                if (roleteState != -1) { PWM_Right(); }
+            } else {
+                resp[0] = PROTO_ERR_VALUE;
+            }
+            break;
+        case PROTO_GET_SCHEDULE:
+            for (uint8_t i = 0U; i < 2U; i++) {
+                resp[1U + (i * 3U)] = (uint8_t)remoteAlarm[i].MODE;
+                resp[2U + (i * 3U)] = remoteAlarm[i].HOUR;
+                resp[3U + (i * 3U)] = remoteAlarm[i].MIN;
+            }
+            respLen = 7U;
+            break;
+        case PROTO_SET_SCHEDULE:
+            if (len != 6U) {
+                resp[0] = PROTO_ERR_LENGTH;
+                break;
+            }
+            for (uint8_t i = 0U; i < 2U; i++) {
+                if ((data[i * 3U] > 1U) || (data[1U + (i * 3U)] > 23U) || (data[2U + (i * 3U)] > 59U)) {
+                    resp[0] = PROTO_ERR_VALUE;
+                }
+            }
+            if (resp[0] == PROTO_OK) {
+                for (uint8_t i = 0U; i < 2U; i++) {
+                    remoteAlarm[i].MODE = (Bool)data[i * 3U];
+                    remoteAlarm[i].HOUR = data[1U + (i * 3U)];
+                    remoteAlarm[i].MIN = data[2U + (i * 3U)];
+                }
+                datetime_readRtc(&now);
+                setNextAlarm(&now, remoteAlarm);
+            }
+            break;
+        case PROTO_GET_CONFIG:
+        case PROTO_SET_CONFIG:
+            if (len != ((type == PROTO_SET_CONFIG) ? 5U : 1U)) {
+                resp[0] = PROTO_ERR_LENGTH;
+                break;
+            }
+            if (type == PROTO_SET_CONFIG) {
+                value = (uint32_t)data[1] | ((uint32_t)data[2] << 8) | ((uint32_t)data[3] << 16) | ((uint32_t)data[4] << 24);
+                if ((data[0] == PROTO_CFG_MODE) && (value <= 3U)) {
+                    setActivationMode((uint8_t)value);
+                } else if ((data[0] == PROTO_CFG_LUX_LEVEL) && (value <= 64000U)) {
+                    lumenActivation = value;
+                } else if ((data[0] == PROTO_CFG_GROUP) && (value > CANGROUP_ALL) && (value < CANGROUP_TEST)) {
+                    canGroup = (uint8_t)value;
+                    joinCanGroups();
+                } else {
+                    resp[0] = PROTO_ERR_VALUE;
+                }
+            } else {
+                if (data[0] == PROTO_CFG_MODE) {
+                    value = activationMode;
+                } else if (data[0] == PROTO_CFG_LUX_LEVEL) {
+                    value = lumenActivation;
+                } else if (data[0] == PROTO_CFG_GROUP) {
+                    value = canGroup;
+                } else {
+                    resp[0] = PROTO_ERR_VALUE;
+                }
+            }
+            if (resp[0] == PROTO_OK) {
+                resp[1] = data[0];
+                for (uint8_t i = 0U; i < 4U; i++) {
+                    resp[2U + i] = (uint8_t)(value >> (i * 8U));
+                }
+                respLen = 6U;
+            }
+            break;
+        case PROTO_STREAM:
+            if (len != 2U) {
+                resp[0] = PROTO_ERR_LENGTH;
+            } else {
+                streamPeriod = (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+            }
+            break;
+        case PROTO_GET_SENSORS:
+            respLen = 1U + sensorRecord(&resp[1]);
+            break;
+        case PROTO_GROUP:
+            /* One CAN frame of type and payload to every member, this controller included */
+            if ((len < 2U) || (len > (2U + PROTO_GROUP_MAX_PAYLOAD))) {
+                resp[0] = PROTO_ERR_LENGTH;
+            } else if ((data[1] == PROTO_GROUP) || (data[0] >= CANGROUP_TEST)) {
+                resp[0] = PROTO_ERR_VALUE;
+            } else if (!canOnline || !cangroup_send(data[0], &data[1], (uint8_t)(len - 1U))) {
+                resp[0] = PROTO_ERR_BUSY;
+            } else if (cangroup_isMember(data[0])) {
+                uint8_t local[PROTO_MAX_PAYLOAD];
+                (void)remoteRequest(data[1], &data[2], len - 2U, local);
+            } else {}
+            break;
+        default:
+            resp[0] = PROTO_ERR_TYPE;
+            break;
+    }
+    return respLen;
+}
+
+/*!
+ *  @brief    Joins CANGROUP_ALL and the own group, if the CAN self test passed
+ *  @returns
+ *  @side effects:
+ *            Rewrites the CAN acceptance filter
+ */
+void joinCanGroups(void) {
+    if (canOnline) {
+        cangroup_leaveAll();
+        (void)cangroup_join(CANGROUP_ALL, CANGROUP_ALL);
+        (void)cangroup_join(canGroup, canGroup);
+    }
+}
+
 int main(void) {
+    TRACE_INIT();
+    if ((Bool)SysTick_Config(SystemCoreClock / 1000)) {
+        while(1){}; // error
+    }
+    boot_init(&getMsTicks);
     init_i2c();
     init_ssp();
+
+    /* Slow hardware first, it settles while the rest is initialized */
+    oled_initNoPower();
+    boot_after(BOOT_OLED_POWER, OLED_POWER_DELAY_MS, &oled_powerOn);
+
+    light_enable();
+    light_setMode(LIGHT_MODE_D1); //visible + infrared
+    light_setRange(LIGHT_RANGE_64000);
+    light_setWidth(LIGHT_WIDTH_16BITS);
+    light_setIrqInCycles(LIGHT_CYCLE_1);
+    boot_after(BOOT_LIGHT, LIGHT_SETTLE_MS, NULL);
+
     eeprom_init();
     joystick_init();
-    oled_init();
 
     Bool prevStateJoyRight = TRUE;
     Bool prevStateJoyLeft = TRUE;
     Bool prevStateJoyUp = TRUE;
     Bool prevStateJoyDown = TRUE;
 
-    if ((Bool)SysTick_Config(SystemCoreClock / 1000)) {
-        while(1){}; // error
-    }
+    PROFILE_INIT();
 
     temp_init(&getMsTicks);
+    telemetry_init(&getMsTicks);
+    uint32_t telemetryTime = getMsTicks();
+    uint32_t streamTime = telemetryTime;
 
     PWM_vInit();
     Bool prevStateJoyClick = TRUE;
@@ -1268,26 +1342,32 @@ int main(void) {
     GPIO_ClearValue(0, ((uint32_t)1U << 28U)); //LM4811-up/dn
     GPIO_ClearValue(2, ((uint32_t)1U << 13U)); //LM4811-shutdn
 
-    light_enable();
-    light_setMode(LIGHT_MODE_D1); //visible + infrared
-    light_setRange(LIGHT_RANGE_64000);
-    light_setWidth(LIGHT_WIDTH_16BITS);
-    light_setIrqInCycles(LIGHT_CYCLE_1);
-
     RTC_Init(LPC_RTC);
-    LPC_RTC->YEAR = 2022;
-    LPC_RTC->MONTH = 2;
-    LPC_RTC->DOM = 2;
-    LPC_RTC->HOUR = 2;
-    LPC_RTC->MIN = 2;
-    LPC_RTC->SEC = 2;
+    datetime_t now = {2022, 2, 2, 2, 2, 2, 0, 0};
+    datetime_normalize(&now);
+    datetime_writeRtc(&now);
     LPC_RTC->CCR = 1;
 
     LPC_RTC->AMR &= ~((1U << 2U) | (1U << 1U) | (1U << 0U));
     LPC_RTC->ILR = 1;
-    LPC_RTC->CIIR = 0;
+    LPC_RTC->CIIR = 1;                              // Second increment interrupt keeps RTC snapshot fresh
     NVIC_EnableIRQ(RTC_IRQn);
 
+    GPDMA_Init();
+    NVIC_EnableIRQ(DMA_IRQn);
+#ifndef PROFILE_ENABLE
+    /* a profiling build keeps UART3 for the profile dump, no serial requests then */
+    proto_init(PROTO_BAUD, &remoteRequest);
+#endif
+
+    cangroup_init(&getMsTicks);
+    canOnline = cangroup_selfTest();
+    if (canOnline) {
+        joinCanGroups();
+    } else {
+        //err handle, no group messages
+    }
+
     PINSEL_CFG_Type PinCfg;
 
     PinCfg.Funcnum = 2;
@@ -1301,21 +1381,48 @@ int main(void) {
 
     GPIO_SetDir(0, (1U << 4U), 0);
     GPIO_SetDir(1, ((uint32_t)1U << 31U), 0);
-    oled_clearScreen(OLED_COLOR_BLACK);
-
-    unsigned char naszString[4];
-    write_temp_on_screen(naszString);
-    oled_putString(1, 0, naszString, OLED_COLOR_WHITE, OLED_COLOR_BLACK);
-    showLuxometerReading();
 
     PWM_Stop_Mov();
     uint32_t ifCheckTheTemp = 0;
 
+    uint8_t posX = 0;
+    uint8_t posY = 0;
+
+    struct alarm_struct alarm[2] = {{0, 2,  2},
+                                    {1, 22, 22}};
+    remoteAlarm = alarm;
+    struct pos map[5][3] = {
+            {{1,  12, 4}, {31, 12, 2}, {49, 12, 2}},
+            {{1,  24, 2}, {19, 24, 2}, {37, 24, 2}},
+            {{37, 36, 1}, {49, 36, 2}, {67, 36, 2}},
+            {{37, 36, 1}, {49, 36, 2}, {67, 36, 2}},
+            {{31, 48, 1}, {43, 48, 5}, {73, 48, 0}}};
+    setNextAlarm(&now, alarm);
+
+    int8_t eeprom_read_ret_value = read_time_from_eeprom(alarm);
+    if (eeprom_read_ret_value != 0) {
+        //err handle
+    }
+    datetime_readRtc(&now);
+
+    /* First frame from the stored time and alarms, the sensors follow in the loop */
+    oled_clearScreen(OLED_COLOR_BLACK);
     //const unsigned char xdx[] = "ALARM:\0";
     oled_putString(1, 36,(uint8_t*) "ALARM:\0", OLED_COLOR_WHITE, OLED_COLOR_BLACK);
     //const unsigned char dxd[] = "MODE:\0";
     oled_putString(1, 48,(uint8_t*) "MODE:\0", OLED_COLOR_WHITE, OLED_COLOR_BLACK);
+    showEditmode(editing);
+    chooseTime(map, &now, alarm, posX, posY);
+    showPresentTime(&now, alarm, posY);
+    boot_wait(BOOT_OLED_POWER);
+    boot_mark(BOOT_FIRST_FRAME);
 
+    showOurTemp();
+
+    /* Sounds are first needed by an alarm */
+    if (assets_init() <= 0) {
+        //err handle, sounds are disabled below
+    }
     sampleRate = get_sample_rate(1);
     if (sampleRate < 0) {
         //err handle
@@ -1327,28 +1434,21 @@ int main(void) {
         disableSound = TRUE;
     }
 
-    uint8_t posX = 0;
-    uint8_t posY = 0;
-
-    struct alarm_struct alarm[2] = {{0, 2,  2},
-                                    {1, 22, 22}};
-    struct pos map[5][3] = {
-            {{1,  12, 4}, {31, 12, 2}, {49, 12, 2}},
-            {{1,  24, 2}, {19, 24, 2}, {37, 24, 2}},
-            {{37, 36, 1}, {49, 36, 2}, {67, 36, 2}},
-            {{37, 36, 1}, {49, 36, 2}, {67, 36, 2}},
-            {{31, 48, 1}, {43, 48, 5}, {73, 48, 0}}};
-    setNextAlarm(alarm);
-
-    int8_t eeprom_read_ret_value = read_time_from_eeprom(alarm);
-    if (eeprom_read_ret_value != 0) {
-        //err handle
+    /* The PHY negotiates for seconds without a cable, so after the first frame */
+    {
+        const uint8_t mac[6] = NET_MAC;
+        const uint8_t ip[4] = NET_IP;
+        if (!net_init(mac, ip, &remoteRequest)) {
+            //err handle, no UDP requests
+        }
     }
+
     configTimer2();
     while (1) {
+        PROFILE_BEGIN(PROFILE_MAIN_LOOP);
 
         uint32_t joyClick = ((GPIO_ReadValue(0) & ((uint32_t)1U << 17U)) >> 17U);
-        int32_t LPC_values[] = {LPC_RTC->YEAR, LPC_RTC->MONTH, LPC_RTC->DOM, LPC_RTC->HOUR, LPC_RTC->MIN, LPC_RTC->SEC};
+        datetime_readRtc(&now);
         Bool joyClickDiff = joyClick - prevStateJoyClick;
 
         if ((joyClickDiff) && (!editing) && (!joyClick)) {
@@ -1363,7 +1463,11 @@ int main(void) {
         }
         prevStateJoyClick = joyClick;
 
-        showEditmode(editing);
+        {
+            PROFILE_BEGIN(PROFILE_EDIT_MODE);
+            showEditmode(editing);
+            PROFILE_END(PROFILE_EDIT_MODE);
+        }
 
         if (!editing) {
             if (JoystickControls('u', FALSE,&prevStateJoyRight,&prevStateJoyLeft,&prevStateJoyUp,&prevStateJoyDown)) {
@@ -1384,33 +1488,49 @@ int main(void) {
             }
         } else {
             if (JoystickControls('u', TRUE,&prevStateJoyRight,&prevStateJoyLeft,&prevStateJoyUp,&prevStateJoyDown)) {
-                changeValue(1, LPC_values, alarm, posX, posY);
+                changeValue(1, &now, alarm, posX, posY);
             }
             if (JoystickControls('d', TRUE,&prevStateJoyRight,&prevStateJoyLeft,&prevStateJoyUp,&prevStateJoyDown)) {
-                changeValue(-1, LPC_values, alarm, posX, posY);
+                changeValue(-1, &now, alarm, posX, posY);
             }
             if (JoystickControls('l', TRUE,&prevStateJoyRight,&prevStateJoyLeft,&prevStateJoyUp,&prevStateJoyDown)) {
-                changeValue(-5, LPC_values, alarm, posX, posY);
+                changeValue(-5, &now, alarm, posX, posY);
             }
             if (JoystickControls('r', TRUE,&prevStateJoyRight,&prevStateJoyLeft,&prevStateJoyUp,&prevStateJoyDown)) {
-                changeValue(5, LPC_values, alarm, posX, posY);
+                changeValue(5, &now, alarm, posX, posY);
             }
         }
 
-        chooseTime(map, LPC_values, alarm, posX, posY);
-        correctDateValues();
-        showPresentTime(alarm, posY);
+        {
+            PROFILE_BEGIN(PROFILE_CHOOSE_TIME);
+            chooseTime(map, &now, alarm, posX, posY);
+            PROFILE_END(PROFILE_CHOOSE_TIME);
+        }
+        {
+            PROFILE_BEGIN(PROFILE_PRESENT_TIME);
+            showPresentTime(&now, alarm, posY);
+            PROFILE_END(PROFILE_PRESENT_TIME);
+        }
 
         ifCheckTheTemp++;
         if ((ifCheckTheTemp % ((uint32_t)1U << 10U)) == 0U) {
+            PROFILE_BEGIN(PROFILE_EEPROM_WRITE);
             int8_t eeprom_write_ret_value = write_time_to_eeprom(alarm);
+            PROFILE_END(PROFILE_EEPROM_WRITE);
             if (eeprom_write_ret_value != 0) {
                 //err handle
             }
         }
-        showLuxometerReading();
+        boot_poll();
+        if (boot_done(BOOT_LIGHT)) {
+            PROFILE_BEGIN(PROFILE_LUX);
+            showLuxometerReading();
+            PROFILE_END(PROFILE_LUX);
+        }
         if ((ifCheckTheTemp % ((uint32_t)1U << 8U)) == 0U) {
+            PROFILE_BEGIN(PROFILE_TEMP);
             showOurTemp();
+            PROFILE_END(PROFILE_TEMP);
         }
 
         uint32_t but1 = ((GPIO_ReadValue(0) >> 4U) & (uint32_t)0x01);
@@ -1430,6 +1550,47 @@ int main(void) {
             }
             PWM_Stop_Mov();
         }
-        activateMotor();
+        {
+            PROFILE_BEGIN(PROFILE_MOTOR);
+            activateMotor();
+            PROFILE_END(PROFILE_MOTOR);
+        }
+
+        if ((getMsTicks() - telemetryTime) >= TELEMETRY_PERIOD) {
+            telemetryTime += TELEMETRY_PERIOD;
+            (void)telemetry_push(TELEMETRY_LUX, (int32_t)light_read(), lumenActivation);
+            {
+                int32_t temp = temp_read();
+                if (temp != TEMP_NO_READING) {
+                    lastTemp = temp;
+                    (void)telemetry_push(TELEMETRY_TEMP, lastTemp, 0U);
+                }
+            }
+        }
+        proto_poll();
+        net_poll();
+        {
+            /* Group messages carry a request without seq, nobody waits for the response */
+            cangroup_frame_t frame;
+            uint8_t resp[PROTO_MAX_PAYLOAD];
+            while (cangroup_receive(&frame)) {
+                if ((frame.len != 0U) && (frame.data[0] != PROTO_GROUP)) {
+                    (void)remoteRequest(frame.data[0], &frame.data[1], frame.len - 1U, resp);
+                }
+            }
+        }
+        if ((streamPeriod != 0U) && ((getMsTicks() - streamTime) >= streamPeriod)) {
+            uint8_t record[PROTO_SENSORS_LEN];
+            streamTime = getMsTicks();
+            (void)proto_send(PROTO_SENSORS, record, sensorRecord(record));
+        }
+        {
+            PROFILE_BEGIN(PROFILE_TELEMETRY);
+            telemetry_service();
+            PROFILE_END(PROFILE_TELEMETRY);
+        }
+
+        PROFILE_POLL();
+        PROFILE_END(PROFILE_MAIN_LOOP);
     }
 }
@@ -0,0 +1,441 @@
+/*****************************************************************************
+ *   net.c:  UDP endpoint of the remote control protocol on the EMAC
+ *
+ ******************************************************************************/
+
+/*
+ * Just enough ARP, IPv4 and UDP to answer requests of proto.h sent as UDP
+ * datagrams: ARP requests for the own address are answered, IPv4 UDP
+ * datagrams to NET_UDP_PORT are handed to the request handler, everything
+ * else is dropped. No ARP cache, no routing: a reply goes to the MAC
+ * address its request came from.
+ *
+ * Nothing is copied. Frames are parsed where the EMAC DMA put them, in the
+ * RX descriptor buffers, and replies are built in the TX descriptor buffer
+ * at TxProduceIndex; the request handler reads its payload from the one and
+ * writes its response into the other.
+ *
+ * The EMAC RX done interrupt walks the RX ring in order. ARP requests are
+ * answered at once from the interrupt. A UDP request stays in its
+ * descriptor and stops the walk until net_poll has run the handler in the
+ * main loop, where it is safe to move the motor or write the EEPROM; the
+ * frames behind it wait in the ring meanwhile.
+ *
+ * ENET_IRQHandler must call net_intHandler.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "LPC17xx.h"
+#include "lpc17xx_emac.h"
+#include "lpc17xx_pinsel.h"
+#include "net.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+/* Ethernet header */
+#define ETH_DST             0U
+#define ETH_SRC             6U
+#define ETH_TYPE            12U
+#define ETH_HLEN            14U
+#define ETH_TYPE_IP         0x0800U
+#define ETH_TYPE_ARP        0x0806U
+
+/* ARP for IPv4 over Ethernet, offsets in the frame */
+#define ARP_HTYPE           14U
+#define ARP_PTYPE           16U
+#define ARP_HLEN            18U
+#define ARP_PLEN            19U
+#define ARP_OPER            20U
+#define ARP_SHA             22U
+#define ARP_SPA             28U
+#define ARP_THA             32U
+#define ARP_TPA             38U
+#define ARP_FRAME_LEN       42U
+#define ARP_REQUEST         1U
+#define ARP_REPLY           2U
+
+/* IPv4 header, offsets in the header */
+#define IP_VHL              0U
+#define IP_LEN              2U
+#define IP_ID               4U
+#define IP_FRAG             6U
+#define IP_TTL              8U
+#define IP_PROTO            9U
+#define IP_SUM              10U
+#define IP_SRC              12U
+#define IP_DST              16U
+#define IP_HLEN             20U
+#define IP_PROTO_UDP        17U
+#define IP_FRAG_MASK        0x3FFFU     /* more fragments, offset */
+#define IP_DONT_FRAG        0x4000U
+#define IP_DEF_TTL          64U
+
+/* UDP header, offsets in the header */
+#define UDP_SPORT           0U
+#define UDP_DPORT           2U
+#define UDP_LEN             4U
+#define UDP_SUM             6U
+#define UDP_HLEN            8U
+
+/* type and seq before the payload of proto.h */
+#define MSG_HLEN            2U
+
+#define RX_ERRORS           (EMAC_RINFO_CRC_ERR | EMAC_RINFO_SYM_ERR | EMAC_RINFO_ALIGN_ERR \
+                            | EMAC_RINFO_OVERRUN | EMAC_RINFO_NO_DESCR)
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint8_t ownMac[6];
+static uint8_t ownIp[4];
+static proto_handler_t requestHandler = NULL;
+static volatile Bool requestPending = FALSE;    /* UDP request at RxConsumeIndex */
+static uint16_t ipId = 0U;
+static net_stats_t stats;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static uint16_t get16(const uint8_t *p) {
+    return (uint16_t)(((uint16_t)p[0] << 8) | p[1]);
+}
+
+static void put16(uint8_t *p, uint16_t value) {
+    p[0] = (uint8_t)(value >> 8);
+    p[1] = (uint8_t)value;
+}
+
+static void copy(uint8_t *dst, const uint8_t *src, uint32_t len) {
+    uint32_t i;
+
+    for (i = 0U; i < len; i++) {
+        dst[i] = src[i];
+    }
+}
+
+static Bool equal(const uint8_t *a, const uint8_t *b, uint32_t len) {
+    uint32_t i;
+
+    for (i = 0U; i < len; i++) {
+        if (a[i] != b[i]) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/*!
+ *  @brief    		Adds bytes to an Internet checksum, as big endian 16 bit words.
+ *  @param sum		uint32_t,
+ *             		sum so far, 0 to start.
+ *  @param data		const uint8_t*,
+ *             		bytes, an odd length only for the last call.
+ *  @param len		uint32_t,
+ *             		number of bytes.
+ *  @returns  		The sum, unfolded.
+ *  @side effects:	None.
+ */
+static uint32_t sumAdd(uint32_t sum, const uint8_t *data, uint32_t len) {
+    uint32_t i;
+
+    for (i = 0U; (i + 1U) < len; i += 2U) {
+        sum += ((uint32_t)data[i] << 8) | data[i + 1U];
+    }
+    if ((len & 1U) != 0U) {
+        sum += (uint32_t)data[len - 1U] << 8;
+    }
+    return sum;
+}
+
+/* One's complement of the folded sum: the checksum to store, 0 when checking a correct one */
+static uint16_t sumFold(uint32_t sum) {
+    while ((sum >> 16) != 0U) {
+        sum = (sum & 0xFFFFU) + (sum >> 16);
+    }
+    return (uint16_t)~sum;
+}
+
+/* Sum of the UDP pseudo header: addresses at ip + IP_SRC, protocol, UDP length */
+static uint32_t sumPseudo(const uint8_t *ip, uint16_t udpLen) {
+    return sumAdd(0U, &ip[IP_SRC], 8U) + IP_PROTO_UDP + udpLen;
+}
+
+/*!
+ *  @brief    		Tells if a frame is an ARP request for the own address.
+ *  @param frame	const uint8_t*,
+ *             		frame in its RX descriptor.
+ *  @param len		uint32_t,
+ *             		received length.
+ *  @returns  		TRUE if it wants an answer.
+ *  @side effects:	None.
+ */
+static Bool isArpRequest(const uint8_t *frame, uint32_t len) {
+    return (Bool)((len >= ARP_FRAME_LEN) && (get16(&frame[ETH_TYPE]) == ETH_TYPE_ARP)
+            && (get16(&frame[ARP_HTYPE]) == 1U) && (get16(&frame[ARP_PTYPE]) == ETH_TYPE_IP)
+            && (frame[ARP_HLEN] == 6U) && (frame[ARP_PLEN] == 4U)
+            && (get16(&frame[ARP_OPER]) == ARP_REQUEST) && equal(&frame[ARP_TPA], ownIp, 4U));
+}
+
+/*!
+ *  @brief    		Answers an ARP request, building the reply in the TX descriptor.
+ *  @param frame	const uint8_t*,
+ *             		request in its RX descriptor.
+ *  @returns
+ *  @side effects:	Sends a frame.
+ */
+static void arpReply(const uint8_t *frame) {
+    uint8_t *out;
+
+    if (!EMAC_CheckTransmitIndex()) {
+        stats.txBusy++;
+        return;
+    }
+    out = EMAC_GetTxPacketPtr();
+    copy(&out[ETH_DST], &frame[ETH_SRC], 6U);
+    copy(&out[ETH_SRC], ownMac, 6U);
+    put16(&out[ETH_TYPE], ETH_TYPE_ARP);
+    put16(&out[ARP_HTYPE], 1U);
+    put16(&out[ARP_PTYPE], ETH_TYPE_IP);
+    out[ARP_HLEN] = 6U;
+    out[ARP_PLEN] = 4U;
+    put16(&out[ARP_OPER], ARP_REPLY);
+    copy(&out[ARP_SHA], ownMac, 6U);
+    copy(&out[ARP_SPA], ownIp, 4U);
+    copy(&out[ARP_THA], &frame[ARP_SHA], 6U);
+    copy(&out[ARP_TPA], &frame[ARP_SPA], 4U);
+    EMAC_SetTxPacketSize(ARP_FRAME_LEN);        /* the MAC pads to 60 bytes */
+    EMAC_UpdateTxProduceIndex();
+    stats.arpReplies++;
+}
+
+/*!
+ *  @brief    		Tells if a frame is a well formed request to NET_UDP_PORT.
+ *  @param frame	const uint8_t*,
+ *             		frame in its RX descriptor.
+ *  @param len		uint32_t,
+ *             		received length.
+ *  @returns  		TRUE if it is for the request handler.
+ *  @side effects:	None.
+ */
+static Bool isRequest(const uint8_t *frame, uint32_t len) {
+    const uint8_t *ip = &frame[ETH_HLEN];
+    const uint8_t *udp;
+    uint32_t ipHlen;
+    uint32_t ipLen;
+    uint32_t udpLen;
+
+    if ((len < (ETH_HLEN + IP_HLEN + UDP_HLEN + MSG_HLEN)) || (get16(&frame[ETH_TYPE]) != ETH_TYPE_IP)
+            || ((ip[IP_VHL] >> 4) != 4U) || (ip[IP_PROTO] != IP_PROTO_UDP)
+            || ((get16(&ip[IP_FRAG]) & IP_FRAG_MASK) != 0U) || !equal(&ip[IP_DST], ownIp, 4U)) {
+        return FALSE;
+    }
+    ipHlen = (uint32_t)(ip[IP_VHL] & 0x0FU) * 4U;
+    ipLen = get16(&ip[IP_LEN]);
+    if ((ipHlen < IP_HLEN) || (ipLen > (len - ETH_HLEN)) || (ipLen < (ipHlen + UDP_HLEN + MSG_HLEN))
+            || (sumFold(sumAdd(0U, ip, ipHlen)) != 0U)) {
+        return FALSE;
+    }
+    udp = &ip[ipHlen];
+    udpLen = get16(&udp[UDP_LEN]);
+    if ((get16(&udp[UDP_DPORT]) != NET_UDP_PORT) || (udpLen > (ipLen - ipHlen))
+            || (udpLen < (UDP_HLEN + MSG_HLEN)) || (udpLen > (UDP_HLEN + MSG_HLEN + PROTO_MAX_PAYLOAD))
+            || ((udp[UDP_HLEN] & PROTO_RESPONSE) != 0U)) {
+        return FALSE;
+    }
+    /* A zero checksum was not computed by the sender */
+    return (Bool)((get16(&udp[UDP_SUM]) == 0U)
+            || (sumFold(sumAdd(sumPseudo(ip, (uint16_t)udpLen), udp, udpLen)) == 0U));
+}
+
+/*!
+ *  @brief    		Runs the handler on the request at RxConsumeIndex, the response
+ *             		is written into the TX descriptor behind the headers of the reply.
+ *  @returns
+ *  @side effects:	Sends a frame.
+ */
+static void answer(void) {
+    const uint8_t *frame = EMAC_GetRxPacketPtr();
+    const uint8_t *ip = &frame[ETH_HLEN];
+    const uint8_t *udp = &ip[(ip[IP_VHL] & 0x0FU) * 4U];
+    const uint8_t *msg = &udp[UDP_HLEN];
+    uint8_t *out;
+    uint8_t *oip;
+    uint8_t *oudp;
+    uint8_t *omsg;
+    uint32_t respLen;
+    uint16_t udpLen;
+    uint16_t sum;
+
+    if (!EMAC_CheckTransmitIndex()) {
+        stats.txBusy++;
+        return;
+    }
+    out = EMAC_GetTxPacketPtr();
+    oip = &out[ETH_HLEN];
+    oudp = &oip[IP_HLEN];
+    omsg = &oudp[UDP_HLEN];
+
+    omsg[MSG_HLEN] = PROTO_ERR_TYPE;
+    respLen = 1U;
+    if (requestHandler != NULL) {
+        respLen = requestHandler(msg[0], &msg[MSG_HLEN], get16(&udp[UDP_LEN]) - UDP_HLEN - MSG_HLEN,
+                &omsg[MSG_HLEN]);
+    }
+    omsg[0] = (uint8_t)(msg[0] | PROTO_RESPONSE);
+    omsg[1] = msg[1];
+    udpLen = (uint16_t)(UDP_HLEN + MSG_HLEN + respLen);
+
+    copy(&out[ETH_DST], &frame[ETH_SRC], 6U);
+    copy(&out[ETH_SRC], ownMac, 6U);
+    put16(&out[ETH_TYPE], ETH_TYPE_IP);
+
+    oip[IP_VHL] = 0x45U;
+    oip[IP_VHL + 1U] = 0U;
+    put16(&oip[IP_LEN], (uint16_t)(IP_HLEN + udpLen));
+    put16(&oip[IP_ID], ipId++);
+    put16(&oip[IP_FRAG], IP_DONT_FRAG);
+    oip[IP_TTL] = IP_DEF_TTL;
+    oip[IP_PROTO] = IP_PROTO_UDP;
+    put16(&oip[IP_SUM], 0U);
+    copy(&oip[IP_SRC], ownIp, 4U);
+    copy(&oip[IP_DST], &ip[IP_SRC], 4U);
+    put16(&oip[IP_SUM], sumFold(sumAdd(0U, oip, IP_HLEN)));
+
+    put16(&oudp[UDP_SPORT], NET_UDP_PORT);
+    put16(&oudp[UDP_DPORT], get16(&udp[UDP_SPORT]));
+    put16(&oudp[UDP_LEN], udpLen);
+    put16(&oudp[UDP_SUM], 0U);
+    sum = sumFold(sumAdd(sumPseudo(oip, udpLen), oudp, udpLen));
+    put16(&oudp[UDP_SUM], (sum == 0U) ? 0xFFFFU : sum);
+
+    EMAC_SetTxPacketSize(ETH_HLEN + IP_HLEN + udpLen);
+    EMAC_UpdateTxProduceIndex();
+    stats.requests++;
+}
+
+/*!
+ *  @brief    		Walks the RX ring up to the next UDP request, answering ARP and
+ *             		releasing what is not for this station.
+ *  @returns
+ *  @side effects:	Call from the interrupt or with it disabled.
+ */
+static void scan(void) {
+    uint8_t *frame;
+    uint32_t len;
+
+    while (!requestPending && EMAC_CheckReceiveIndex()) {
+        frame = EMAC_GetRxPacketPtr();
+        len = EMAC_GetReceiveDataSize() + 1U;
+        stats.rxFrames++;
+        if ((EMAC_CheckReceiveDataStatus(RX_ERRORS) == SET)
+                || (EMAC_CheckReceiveDataStatus(EMAC_RINFO_LAST_FLAG) == RESET)) {
+            stats.rxErrors++;
+        } else if (isArpRequest(frame, len)) {
+            arpReply(frame);
+        } else if (isRequest(frame, len)) {
+            requestPending = TRUE;
+            break;              /* stays in its descriptor until net_poll */
+        } else {
+            stats.ignored++;
+        }
+        EMAC_UpdateRxConsumeIndex();
+    }
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Brings up the EMAC and the PHY and starts answering.
+ *  @param mac		const uint8_t[6],
+ *             		station address, NET_MAC.
+ *  @param ip		const uint8_t[4],
+ *             		IPv4 address, NET_IP.
+ *  @param handler	proto_handler_t,
+ *             		request handler, runs from net_poll.
+ *  @returns  		TRUE if up, FALSE if the PHY did not answer or negotiate.
+ *  @side effects:	Takes the RMII pins of port 1. Waits for the auto negotiation,
+ *             		seconds without a cable.
+ */
+Bool net_init(const uint8_t mac[6], const uint8_t ip[4], proto_handler_t handler) {
+    static const uint8_t rmiiPins[] = {0U, 1U, 4U, 8U, 9U, 10U, 14U, 15U, 16U, 17U};
+    PINSEL_CFG_Type pinCfg;
+    EMAC_CFG_Type emacCfg;
+    uint8_t *p = (uint8_t *)&stats;
+    uint32_t i;
+
+    copy(ownMac, mac, 6U);
+    copy(ownIp, ip, 4U);
+    requestHandler = handler;
+    requestPending = FALSE;
+    for (i = 0U; i < sizeof(stats); i++) {
+        p[i] = 0U;
+    }
+
+    pinCfg.Funcnum = 1;
+    pinCfg.OpenDrain = 0;
+    pinCfg.Pinmode = 0;
+    pinCfg.Portnum = 1;
+    for (i = 0U; i < sizeof(rmiiPins); i++) {
+        pinCfg.Pinnum = rmiiPins[i];
+        PINSEL_ConfigPin(&pinCfg);
+    }
+
+    emacCfg.Mode = EMAC_MODE_AUTO;
+    emacCfg.pbEMAC_Addr = ownMac;
+    if (EMAC_Init(&emacCfg) != SUCCESS) {
+        return FALSE;
+    }
+    /* TX descriptors are taken back by their index, no interrupt needed */
+    EMAC_IntCmd(EMAC_INT_TX_DONE, DISABLE);
+    EMAC_IntCmd(EMAC_INT_RX_DONE, ENABLE);
+    NVIC_EnableIRQ(ENET_IRQn);
+    return TRUE;
+}
+
+/*!
+ *  @brief    		Answers a waiting UDP request, from the main loop.
+ *  @returns
+ *  @side effects:	Calls the request handler with the EMAC interrupt disabled.
+ */
+void net_poll(void) {
+    if (!requestPending) {
+        return;
+    }
+    NVIC_DisableIRQ(ENET_IRQn);
+    answer();
+    EMAC_UpdateRxConsumeIndex();
+    requestPending = FALSE;
+    scan();
+    NVIC_EnableIRQ(ENET_IRQn);
+}
+
+/*!
+ *  @brief    		Copies the counters.
+ *  @param out		net_stats_t*,
+ *             		destination.
+ *  @returns
+ *  @side effects:	None.
+ */
+void net_getStats(net_stats_t *out) {
+    *out = stats;
+}
+
+/*!
+ *  @brief    		EMAC interrupt: answers ARP, finds the next UDP request.
+ *  @returns
+ *  @side effects:	Call from ENET_IRQHandler.
+ */
+void net_intHandler(void) {
+    if (EMAC_IntGetStatus(EMAC_INT_RX_DONE) == SET) {
+        scan();
+    }
+}
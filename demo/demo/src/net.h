@@ -0,0 +1,42 @@
+/*****************************************************************************
+ *   net.h:  Header file for the UDP endpoint of the remote control protocol
+ *
+******************************************************************************/
+#ifndef __NET_H
+#define __NET_H
+
+#include "lpc_types.h"
+#include "proto.h"
+
+/*
+ * A request is one UDP datagram to NET_UDP_PORT: type, seq and payload of
+ * proto.h, without CRC and COBS; the UDP checksum and the datagram length
+ * take their place. The response goes back to the sender's address and
+ * port as type | PROTO_RESPONSE, seq and the response payload.
+ */
+#define NET_UDP_PORT            4950U
+
+/* Station address, locally administered */
+#define NET_MAC                 {0x02U, 0x1BU, 0x17U, 0x69U, 0x00U, 0x01U}
+#define NET_IP                  {192U, 168U, 0U, 50U}
+
+typedef struct
+{
+    uint32_t rxFrames;          /* frames taken from the RX ring */
+    uint32_t rxErrors;          /* CRC, symbol, alignment errors, overruns */
+    uint32_t arpReplies;
+    uint32_t requests;          /* UDP requests answered */
+    uint32_t ignored;           /* not for this station, malformed or bad checksum */
+    uint32_t txBusy;            /* replies dropped, no free TX descriptor */
+} net_stats_t;
+
+Bool net_init(const uint8_t mac[6], const uint8_t ip[4], proto_handler_t handler);
+void net_poll(void);
+void net_getStats(net_stats_t *stats);
+void net_intHandler(void);
+
+
+#endif /* end __NET_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
@@ -0,0 +1,409 @@
+/*****************************************************************************
+ *   profile.c:  Cycle counter profiling zones with a dump over UART3
+ *
+ ******************************************************************************/
+
+/*
+ * Each zone is timed with the DWT cycle counter (CYCCNT, one count per CPU
+ * clock, wraps after 42 s at 100 MHz, longer zones are not supported).
+ * profile_record folds a measurement into count/min/max/total of the zone
+ * with interrupts masked, so zones in handlers and in task code can share
+ * the table; the masked section is a few instructions long. The cost of
+ * the begin/end pair itself is measured once by profile_init and
+ * subtracted from every measurement.
+ *
+ * profile_poll checks UART3 (P0.0 TXD, P0.1 RXD, 115200 8N1, the USB
+ * serial port of the base board) for a command byte:
+ *
+ *   'p'  dump the table
+ *   'r'  reset the table
+ *   's'  run the SD card sector benchmark
+ *
+ * The dump is plain text, one zone per line, and is rendered by
+ * tools/profreport.py:
+ *
+ *   profile begin <cpu clock Hz> <overhead cycles>
+ *   zone <name> <count> <min> <max> <total>
+ *   stack <high-water mark bytes> <reservation bytes>
+ *   boot <oled power ms> <light sensor ms> <first frame ms>
+ *   profile end
+ *
+ * The dump is sent blocking (about 50 ms), which shows up in the zone
+ * that contains the profile_poll call.
+ *
+ * The sector benchmark times disk_read and disk_write of mmc.c over the
+ * last SD_BENCH_SECTORS sectors of the card, one sector per call (CMD17,
+ * CMD24) and SD_BENCH_BURST sectors per call (CMD18, CMD25). Every burst
+ * is read before it is written back unchanged, only the write is timed;
+ * the write passes end with CTRL_SYNC so the busy time of the last block
+ * counts. The card holds the same data afterwards unless power fails
+ * during the run. The result, also rendered by tools/profreport.py:
+ *
+ *   sdbench begin <cpu clock Hz> <SCK Hz>
+ *   sd <read|write> <sectors per call> <sectors> <cycles>
+ *   sdbench end
+ *
+ * or "sd error <read|write> <DRESULT>" if a call fails.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "LPC17xx.h"
+#include "lpc17xx_uart.h"
+#include "lpc17xx_pinsel.h"
+#include "format.h"
+#include "dwt.h"
+#include "stackmon.h"
+#include "boot.h"
+#include "diskio.h"
+#include "profile.h"
+
+#ifdef PROFILE_ENABLE
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define PROFILE_UART        LPC_UART3
+#define PROFILE_BAUD        115200U
+
+#define CALIBRATION_RUNS    8U
+#define LINE_SIZE           96U
+
+#define SD_SECTOR           512U
+#define SD_BENCH_SECTORS    64U     /* multiple of SD_BENCH_BURST */
+#define SD_BENCH_BURST      4U      /* sectors per multiple block call */
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static const char *const zoneNames[PROFILE_ZONES] = {
+    "main_loop",
+    "present_time",
+    "choose_time",
+    "edit_mode",
+    "lux",
+    "temp",
+    "motor",
+    "eeprom_write",
+    "telemetry",
+    "systick_isr",
+    "timer0_isr",
+    "rtc_isr"
+};
+
+static profile_stat_t stats[PROFILE_ZONES];
+static uint32_t overhead = 0U;
+
+static BYTE sdBuf[SD_BENCH_BURST * SD_SECTOR];
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Appends a string to a line buffer.
+ *  @returns  		New length of the line.
+ *  @side effects:	None.
+ */
+static uint32_t putString(unsigned char *line, uint32_t len, const char *str) {
+    while ((*str != '\0') && (len < (LINE_SIZE - 1U))) {
+        line[len] = (unsigned char)*str;
+        len++;
+        str++;
+    }
+    return len;
+}
+
+/*!
+ *  @brief    		Appends a space and a decimal number of up to 64 bits to a line buffer.
+ *  @returns  		New length of the line.
+ *  @side effects:	None.
+ */
+static uint32_t putNumber(unsigned char *line, uint32_t len, uint64_t value) {
+    line[len] = (unsigned char)' ';
+    len++;
+    if (value >= 1000000000ULL) {
+        len += format_uint(&line[len], (uint32_t)(value / 1000000000ULL), 0U, 0U);
+        len += format_uint(&line[len], (uint32_t)(value % 1000000000ULL), 9U, FORMAT_ZEROPAD);
+    } else {
+        len += format_uint(&line[len], (uint32_t)value, 0U, 0U);
+    }
+    return len;
+}
+
+/*!
+ *  @brief    		Sends a line buffer followed by CR LF.
+ *  @side effects:	Blocks until the line is in the UART FIFO.
+ */
+static void sendLine(unsigned char *line, uint32_t len) {
+    line[len] = (unsigned char)'\r';
+    line[len + 1U] = (unsigned char)'\n';
+    (void)UART_Send(PROFILE_UART, line, len + 2U, BLOCKING);
+}
+
+/*!
+ *  @brief    		Times one pass of the sector benchmark and sends its line.
+ *  @param first	DWORD,
+ *             		first sector of the area.
+ *  @param perCall	uint32_t,
+ *             		sectors per disk_read/disk_write call, 1 or SD_BENCH_BURST.
+ *  @param write	Bool,
+ *             		TRUE to write the sectors back, FALSE to read them.
+ *  @returns  		TRUE on success.
+ *  @side effects:	Uses SSP1 and the card for up to a few seconds.
+ */
+static Bool sdPass(DWORD first, uint32_t perCall, Bool write) {
+    unsigned char line[LINE_SIZE + 2U];
+    const char *op = write ? "write" : "read";
+    uint32_t cycles = 0U;
+    uint32_t start;
+    uint32_t len;
+    uint32_t i;
+    DRESULT res = RES_OK;
+
+    for (i = 0U; (i < SD_BENCH_SECTORS) && (res == RES_OK); i += perCall) {
+        if (write) {
+            res = disk_read(0, sdBuf, first + i, (BYTE)perCall);
+            start = profile_cycles();
+            if (res == RES_OK) {
+                res = disk_write(0, sdBuf, first + i, (BYTE)perCall);
+            }
+        } else {
+            start = profile_cycles();
+            res = disk_read(0, sdBuf, first + i, (BYTE)perCall);
+        }
+        cycles += profile_cycles() - start;
+    }
+    if (write && (res == RES_OK)) {
+        start = profile_cycles();
+        res = disk_ioctl(0, CTRL_SYNC, NULL);
+        cycles += profile_cycles() - start;
+    }
+
+    if (res == RES_OK) {
+        len = putString(line, 0U, "sd ");
+        len = putString(line, len, op);
+        len = putNumber(line, len, perCall);
+        len = putNumber(line, len, SD_BENCH_SECTORS);
+        len = putNumber(line, len, cycles);
+    } else {
+        len = putString(line, 0U, "sd error ");
+        len = putString(line, len, op);
+        len = putNumber(line, len, (uint32_t)res);
+    }
+    sendLine(line, len);
+    return (Bool)(res == RES_OK);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Starts the cycle counter, measures the zone overhead and opens UART3.
+ *  @returns
+ *  @side effects:	Takes UART3 and pins P0.0, P0.1.
+ */
+void profile_init(void) {
+    UART_CFG_Type uartCfg;
+    PINSEL_CFG_Type pinCfg;
+    uint32_t i;
+    uint32_t start;
+    uint32_t cycles;
+
+    DWT_START();
+
+    overhead = 0xFFFFFFFFUL;
+    for (i = 0U; i < CALIBRATION_RUNS; i++) {
+        start = profile_cycles();
+        cycles = profile_cycles() - start;
+        if (cycles < overhead) {
+            overhead = cycles;
+        }
+    }
+    profile_reset();
+
+    pinCfg.Funcnum = 2;
+    pinCfg.OpenDrain = 0;
+    pinCfg.Pinmode = 0;
+    pinCfg.Portnum = 0;
+    pinCfg.Pinnum = 0;
+    PINSEL_ConfigPin(&pinCfg);
+    pinCfg.Pinnum = 1;
+    PINSEL_ConfigPin(&pinCfg);
+
+    UART_ConfigStructInit(&uartCfg);
+    uartCfg.Baud_rate = PROFILE_BAUD;
+    UART_Init(PROFILE_UART, &uartCfg);
+    UART_TxCmd(PROFILE_UART, ENABLE);
+}
+
+/*!
+ *  @brief    		Reads the cycle counter.
+ *  @returns  		CPU cycles, wrapping.
+ *  @side effects:	None.
+ */
+uint32_t profile_cycles(void) {
+    return DWT_CYCCNT;
+}
+
+/*!
+ *  @brief    		Adds a measurement to a zone, use PROFILE_END instead.
+ *  @param zone		profile_zone_t,
+ *             		zone measured.
+ *  @param cycles	uint32_t,
+ *             		cycles between PROFILE_BEGIN and PROFILE_END.
+ *  @returns
+ *  @side effects:	Masks interrupts for a few instructions.
+ */
+void profile_record(profile_zone_t zone, uint32_t cycles) {
+    profile_stat_t *s = &stats[zone];
+    uint32_t primask;
+
+    cycles = (cycles > overhead) ? (cycles - overhead) : 0U;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    s->count++;
+    s->total += cycles;
+    if (cycles < s->min) {
+        s->min = cycles;
+    }
+    if (cycles > s->max) {
+        s->max = cycles;
+    }
+    __set_PRIMASK(primask);
+}
+
+/*!
+ *  @brief    		Returns a consistent copy of the statistics of a zone.
+ *  @param zone		profile_zone_t,
+ *             		zone to read.
+ *  @param stat		profile_stat_t*,
+ *             		output, min is 0xFFFFFFFF while count is 0.
+ *  @returns
+ *  @side effects:	Masks interrupts for the copy.
+ */
+void profile_get(profile_zone_t zone, profile_stat_t *stat) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stat = stats[zone];
+    __set_PRIMASK(primask);
+}
+
+/*!
+ *  @brief    		Clears the statistics of all zones.
+ *  @returns
+ *  @side effects:	Masks interrupts while clearing.
+ */
+void profile_reset(void) {
+    uint32_t primask = __get_PRIMASK();
+    uint32_t i;
+
+    __disable_irq();
+    for (i = 0U; i < (uint32_t)PROFILE_ZONES; i++) {
+        stats[i].count = 0U;
+        stats[i].min = 0xFFFFFFFFUL;
+        stats[i].max = 0U;
+        stats[i].total = 0U;
+    }
+    __set_PRIMASK(primask);
+}
+
+/*!
+ *  @brief    		Sends the table over UART3, see the format at the top of the file.
+ *  @returns
+ *  @side effects:	Blocks for about 50 ms.
+ */
+void profile_dump(void) {
+    unsigned char line[LINE_SIZE + 2U];
+    profile_stat_t s;
+    uint32_t len;
+    uint32_t i;
+
+    len = putString(line, 0U, "profile begin");
+    len = putNumber(line, len, SystemCoreClock);
+    len = putNumber(line, len, overhead);
+    sendLine(line, len);
+    for (i = 0U; i < (uint32_t)PROFILE_ZONES; i++) {
+        profile_get((profile_zone_t)i, &s);
+        len = putString(line, 0U, "zone ");
+        len = putString(line, len, zoneNames[i]);
+        len = putNumber(line, len, s.count);
+        len = putNumber(line, len, (s.count != 0U) ? s.min : 0U);
+        len = putNumber(line, len, s.max);
+        len = putNumber(line, len, s.total);
+        sendLine(line, len);
+    }
+    len = putString(line, 0U, "stack");
+    len = putNumber(line, len, stackmon_used());
+    len = putNumber(line, len, stackmon_size());
+    sendLine(line, len);
+    len = putString(line, 0U, "boot");
+    for (i = 0U; i < (uint32_t)BOOT_STEPS; i++) {
+        len = putNumber(line, len, boot_time((boot_step_t)i));
+    }
+    sendLine(line, len);
+    len = putString(line, 0U, "profile end");
+    sendLine(line, len);
+}
+
+/*!
+ *  @brief    		Runs the SD card sector benchmark and sends the result over UART3,
+ *             		see the format at the top of the file.
+ *  @returns
+ *  @side effects:	Blocks for up to a few seconds, rewrites the last
+ *             		SD_BENCH_SECTORS sectors of the card with their own data.
+ *             		Initializes the card if FatFs has not done so yet.
+ */
+void profile_sdBench(void) {
+    unsigned char line[LINE_SIZE + 2U];
+    DWORD sectors = 0U;
+    DWORD sclk = 0U;
+    DWORD first;
+    uint32_t len;
+
+    if (((disk_status(0) & STA_NOINIT) == 0U) || ((disk_initialize(0) & STA_NOINIT) == 0U)) {
+        (void)disk_ioctl(0, GET_SECTOR_COUNT, &sectors);
+        (void)disk_ioctl(0, MMC_GET_SCLK, &sclk);
+    }
+    len = putString(line, 0U, "sdbench begin");
+    len = putNumber(line, len, SystemCoreClock);
+    len = putNumber(line, len, sclk);
+    sendLine(line, len);
+    if (sectors <= SD_BENCH_SECTORS) {
+        len = putString(line, 0U, "sd error card");
+        len = putNumber(line, len, (uint32_t)RES_NOTRDY);
+        sendLine(line, len);
+    } else {
+        first = sectors - SD_BENCH_SECTORS;
+        (void)(sdPass(first, 1U, FALSE) && sdPass(first, SD_BENCH_BURST, FALSE)
+                && sdPass(first, 1U, TRUE) && sdPass(first, SD_BENCH_BURST, TRUE));
+    }
+    len = putString(line, 0U, "sdbench end");
+    sendLine(line, len);
+}
+
+/*!
+ *  @brief    		Handles a command byte from UART3, call from the main loop.
+ *  @returns
+ *  @side effects:	Dumps (blocking), resets the table or runs the SD benchmark on request.
+ */
+void profile_poll(void) {
+    uint8_t cmd;
+
+    if (UART_Receive(PROFILE_UART, &cmd, 1U, NONE_BLOCKING) == 1U) {
+        if ((cmd == (uint8_t)'p') || (cmd == (uint8_t)'P')) {
+            profile_dump();
+        } else if ((cmd == (uint8_t)'r') || (cmd == (uint8_t)'R')) {
+            profile_reset();
+        } else if ((cmd == (uint8_t)'s') || (cmd == (uint8_t)'S')) {
+            profile_sdBench();
+        } else {}
+    }
+}
+
+#endif /* PROFILE_ENABLE */
@@ -0,0 +1,78 @@
+/*****************************************************************************
+ *   profile.h:  Header file for the cycle counter profiling zones
+ *
+******************************************************************************/
+#ifndef __PROFILE_H
+#define __PROFILE_H
+
+#include "lpc_types.h"
+
+/*
+ * Zones measured in the application. Names are in profile.c, keep both in
+ * the same order.
+ */
+typedef enum
+{
+    PROFILE_MAIN_LOOP = 0,      /* one pass of the main loop */
+    PROFILE_PRESENT_TIME,       /* showPresentTime */
+    PROFILE_CHOOSE_TIME,        /* chooseTime */
+    PROFILE_EDIT_MODE,          /* showEditmode */
+    PROFILE_LUX,                /* showLuxometerReading */
+    PROFILE_TEMP,               /* showOurTemp, includes temp_read */
+    PROFILE_MOTOR,              /* activateMotor */
+    PROFILE_EEPROM_WRITE,       /* write_time_to_eeprom */
+    PROFILE_TELEMETRY,          /* telemetry_service */
+    PROFILE_SYSTICK_ISR,        /* SysTick_Handler */
+    PROFILE_TIMER0_ISR,         /* TIMER0_IRQHandler (sound) */
+    PROFILE_RTC_ISR,            /* RTC_IRQHandler */
+    PROFILE_ZONES
+} profile_zone_t;
+
+/* Statistics of one zone in CPU cycles, measurement overhead subtracted */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} profile_stat_t;
+
+/*
+ * Instrumentation is only built with PROFILE_ENABLE defined (compiler
+ * symbol of the project). Without it the zones and the calls below
+ * compile to nothing and the module adds no code.
+ *
+ * PROFILE_BEGIN and PROFILE_END of one zone must be in the same block.
+ * Zones may nest and may be used in interrupt handlers.
+ */
+#ifdef PROFILE_ENABLE
+
+#define PROFILE_BEGIN(zone)     uint32_t profileStart_##zone = profile_cycles()
+#define PROFILE_END(zone)       profile_record((zone), profile_cycles() - profileStart_##zone)
+
+#define PROFILE_INIT()          profile_init()
+#define PROFILE_POLL()          profile_poll()
+
+void profile_init(void);
+uint32_t profile_cycles(void);
+void profile_record(profile_zone_t zone, uint32_t cycles);
+void profile_get(profile_zone_t zone, profile_stat_t *stat);
+void profile_reset(void);
+void profile_dump(void);
+void profile_sdBench(void);
+void profile_poll(void);
+
+#else
+
+#define PROFILE_BEGIN(zone)
+#define PROFILE_END(zone)
+#define PROFILE_INIT()
+#define PROFILE_POLL()
+
+#endif
+
+
+#endif /* end __PROFILE_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
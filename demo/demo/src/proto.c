@@ -0,0 +1,292 @@
+/*****************************************************************************
+ *   proto.c:  Framed remote control protocol on the serial service
+ *
+ ******************************************************************************/
+
+/*
+ * Messages are COBS encoded, so a 0 byte only ever appears as the end of a
+ * frame and the receiver finds the next frame after any error by looking
+ * for it. proto_poll looks for the 0 in the RX ring of serial.c with
+ * serial_peek and decodes the frame in place (COBS never makes data
+ * longer), then checks the CRC and hands the payload to the request
+ * handler still inside the ring. Only a frame that wraps around the end of
+ * the ring is copied to a local buffer first.
+ *
+ * Requests carry a seq chosen by the host, which the response repeats so
+ * the host can match them and detect lost answers. Messages the board
+ * sends on its own (sensor stream) count their seq up from 0, a gap tells
+ * the host a message was lost. A message that does not fit into the TX
+ * ring is dropped and counted, proto never waits for the line.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "serial.h"
+#include "proto.h"
+#include "lpc17xx_crc.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define FRAME_MAX           (2U + PROTO_MAX_PAYLOAD + 2U)   /* type, seq, payload, CRC */
+#define ENCODED_MAX         (FRAME_MAX + (FRAME_MAX / 254U) + 1U)
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static proto_handler_t requestHandler = NULL;
+static Bool opened = FALSE;             /* proto_init called, the serial service is ours */
+static uint32_t scanned = 0U;           /* bytes of the RX ring known to hold no 0 */
+static Bool skipping = FALSE;           /* dropping an overlong frame up to its end */
+static uint8_t txSeq = 0U;
+static uint8_t linear[ENCODED_MAX];     /* frame that wraps around the RX ring */
+static proto_stats_t stats;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		COBS encodes a frame, without the final 0.
+ *  @param in		const uint8_t*,
+ *             		frame.
+ *  @param len		uint32_t,
+ *             		bytes in the frame.
+ *  @param out		uint8_t*,
+ *             		destination, len + len / 254 + 1 bytes.
+ *  @returns  		Encoded length.
+ *  @side effects:	None.
+ */
+static uint32_t cobsEncode(const uint8_t *in, uint32_t len, uint8_t *out) {
+    uint32_t code = 0U;
+    uint32_t o = 1U;
+    uint8_t run = 1U;
+    uint32_t i;
+
+    for (i = 0U; i < len; i++) {
+        if (in[i] == 0U) {
+            out[code] = run;
+            code = o;
+            o++;
+            run = 1U;
+        } else {
+            out[o] = in[i];
+            o++;
+            run++;
+            if (run == 0xFFU) {
+                out[code] = run;
+                code = o;
+                o++;
+                run = 1U;
+            }
+        }
+    }
+    out[code] = run;
+    return o;
+}
+
+/*!
+ *  @brief    		COBS decodes a frame in place.
+ *  @param buf		uint8_t*,
+ *             		encoded frame without the final 0, overwritten with the decoded one.
+ *  @param len		uint32_t,
+ *             		encoded length.
+ *  @returns  		Decoded length, 0 if the encoding is broken.
+ *  @side effects:	None.
+ */
+static uint32_t cobsDecode(uint8_t *buf, uint32_t len) {
+    uint32_t i = 0U;
+    uint32_t o = 0U;
+    uint32_t j;
+    uint8_t code;
+
+    while (i < len) {
+        code = buf[i];
+        i++;
+        if ((code == 0U) || ((i + code - 1U) > len)) {
+            return 0U;
+        }
+        for (j = 1U; j < code; j++) {
+            buf[o] = buf[i];
+            o++;
+            i++;
+        }
+        if ((code != 0xFFU) && (i < len)) {
+            buf[o] = 0U;
+            o++;
+        }
+    }
+    return o;
+}
+
+/*!
+ *  @brief    		Sends one frame.
+ *  @returns  		TRUE if queued, FALSE if the TX ring had no room.
+ *  @side effects:	None.
+ */
+static Bool sendFrame(uint8_t type, uint8_t seq, const uint8_t *data, uint32_t len) {
+    uint8_t frame[FRAME_MAX];
+    uint8_t enc[ENCODED_MAX + 1U];
+    uint32_t i;
+    uint32_t n;
+    uint16_t crc;
+    Bool output = FALSE;
+
+    if (opened && (len <= PROTO_MAX_PAYLOAD)) {
+        frame[0] = type;
+        frame[1] = seq;
+        for (i = 0U; i < len; i++) {
+            frame[2U + i] = data[i];
+        }
+        crc = CRC16_Final(CRC16_Update(CRC16_Init(), frame, len + 2U));
+        frame[len + 2U] = (uint8_t)crc;
+        frame[len + 3U] = (uint8_t)(crc >> 8);
+        n = cobsEncode(frame, len + 4U, enc);
+        enc[n] = 0U;
+        n++;
+        if (serial_txFree() >= n) {
+            (void)serial_write(enc, n);
+            output = TRUE;
+        }
+    }
+    if (!output) {
+        stats.txDropped++;
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Decodes, checks and answers the frame at the start of the RX ring.
+ *  @param len		uint32_t,
+ *             		encoded length without the final 0.
+ *  @returns
+ *  @side effects:	Calls the request handler, sends the response.
+ */
+static void handleFrame(uint32_t len) {
+    uint8_t resp[PROTO_MAX_PAYLOAD];
+    uint8_t *frame;
+    uint8_t *rest;
+    uint32_t run;
+    uint32_t n;
+    uint32_t i;
+    uint32_t respLen;
+
+    if (len > ENCODED_MAX) {
+        stats.badFrames++;
+        return;
+    }
+    run = serial_peek(0U, &frame);
+    if (run < len) {
+        for (i = 0U; i < run; i++) {
+            linear[i] = frame[i];
+        }
+        (void)serial_peek(run, &rest);
+        for (i = run; i < len; i++) {
+            linear[i] = rest[i - run];
+        }
+        frame = linear;
+    }
+
+    n = cobsDecode(frame, len);
+    if ((n < 4U) || (n > FRAME_MAX) || ((frame[0] & PROTO_RESPONSE) != 0U)) {
+        stats.badFrames++;
+    } else if (CRC16_Final(CRC16_Update(CRC16_Init(), frame, n - 2U)) != (uint16_t)(frame[n - 2U] | ((uint16_t)frame[n - 1U] << 8))) {
+        stats.crcErrors++;
+    } else {
+        stats.frames++;
+        resp[0] = PROTO_ERR_TYPE;
+        respLen = 1U;
+        if (requestHandler != NULL) {
+            respLen = requestHandler(frame[0], &frame[2], n - 4U, resp);
+        }
+        (void)sendFrame((uint8_t)(frame[0] | PROTO_RESPONSE), frame[1], resp, respLen);
+    }
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Opens the serial service and installs the request handler.
+ *  @param baud		uint32_t,
+ *             		line speed, PROTO_BAUD for the host tool.
+ *  @param handler	proto_handler_t,
+ *             		answers the requests.
+ *  @returns
+ *  @side effects:	See serial_init.
+ */
+void proto_init(uint32_t baud, proto_handler_t handler) {
+    requestHandler = handler;
+    scanned = 0U;
+    skipping = FALSE;
+    serial_init(baud);
+    opened = TRUE;
+}
+
+/*!
+ *  @brief    		Handles the complete requests received, call from the main loop.
+ *  @returns
+ *  @side effects:	Calls the request handler, sends the responses.
+ */
+void proto_poll(void) {
+    uint8_t *data;
+    uint32_t run;
+    uint32_t i;
+
+    run = opened ? serial_peek(scanned, &data) : 0U;
+    while (run != 0U) {
+        for (i = 0U; (i < run) && (data[i] != 0U); i++) {}
+        if (i == run) {
+            scanned += run;
+            if (scanned > ENCODED_MAX) {
+                serial_consume(scanned);        /* no frame is that long, drop it */
+                scanned = 0U;
+                skipping = TRUE;
+            }
+        } else {
+            if (skipping) {
+                skipping = FALSE;
+                stats.badFrames++;
+            } else if ((scanned + i) != 0U) {
+                handleFrame(scanned + i);
+            } else {}
+            serial_consume(scanned + i + 1U);
+            scanned = 0U;
+        }
+        run = serial_peek(scanned, &data);
+    }
+}
+
+/*!
+ *  @brief    		Sends a message of the board, e.g. PROTO_SENSORS.
+ *  @param type		uint8_t,
+ *             		message type.
+ *  @param data		const uint8_t*,
+ *             		payload.
+ *  @param len		uint32_t,
+ *             		payload length, up to PROTO_MAX_PAYLOAD.
+ *  @returns  		TRUE if queued, FALSE if dropped (also before proto_init).
+ *  @side effects:	None, never waits.
+ */
+Bool proto_send(uint8_t type, const uint8_t *data, uint32_t len) {
+    Bool output = sendFrame(type, txSeq, data, len);
+
+    txSeq++;                    /* also on drop, so the host sees a gap */
+    return output;
+}
+
+/*!
+ *  @brief    		Copies the counters.
+ *  @param out		proto_stats_t*,
+ *             		destination.
+ *  @returns
+ *  @side effects:	None.
+ */
+void proto_getStats(proto_stats_t *out) {
+    *out = stats;
+}
@@ -0,0 +1,81 @@
+/*****************************************************************************
+ *   proto.h:  Header file for the framed remote control protocol
+ *
+******************************************************************************/
+#ifndef __PROTO_H
+#define __PROTO_H
+
+#include "lpc_types.h"
+
+/*
+ * A message is type, seq, payload and a CRC-16/CCITT (polynomial 0x1021,
+ * init 0xFFFF) of the three, little endian; it is COBS encoded and ends
+ * with a 0 byte. Numbers in payloads are little endian. Decoded by
+ * tools/blindctl.py, keep both in step.
+ */
+#define PROTO_VERSION           2U
+#define PROTO_BAUD              921600U
+#define PROTO_MAX_PAYLOAD       32U
+
+/* Requests from the host, answered with type | PROTO_RESPONSE and the same seq.
+   Every response payload starts with a PROTO_OK/PROTO_ERR_* status byte. */
+#define PROTO_PING              0x01U   /* -> version */
+#define PROTO_MOVE              0x02U   /* u8 PROTO_MOVE_* */
+#define PROTO_GET_SCHEDULE      0x03U   /* -> 2 x {u8 mode (0 down, 1 up), u8 hour, u8 min} */
+#define PROTO_SET_SCHEDULE      0x04U   /* 2 x {u8 mode, u8 hour, u8 min} */
+#define PROTO_GET_CONFIG        0x05U   /* u8 PROTO_CFG_* -> u8 key, i32 value */
+#define PROTO_SET_CONFIG        0x06U   /* u8 PROTO_CFG_*, i32 value */
+#define PROTO_STREAM            0x07U   /* u16 period ms of PROTO_SENSORS messages, 0 stops */
+#define PROTO_GET_SENSORS       0x08U   /* -> sensor record */
+#define PROTO_GROUP             0x09U   /* u8 group, u8 type, payload: the request to a CAN group */
+#define PROTO_RESPONSE          0x80U
+
+/* Messages from the board, seq counts them */
+#define PROTO_SENSORS           0x40U   /* sensor record */
+
+/* Sensor record: u32 time ms, u32 lux, i32 temperature 0.1 C,
+   u8 motor (TELEMETRY_MOTOR_*), i8 blind (-1 down, 0 unknown, 1 up) */
+#define PROTO_SENSORS_LEN       14U
+
+/* Payload of a group request, type and payload fill one CAN frame */
+#define PROTO_GROUP_MAX_PAYLOAD 7U
+
+#define PROTO_MOVE_STOP         0U
+#define PROTO_MOVE_UP           1U
+#define PROTO_MOVE_DOWN         2U
+
+#define PROTO_CFG_MODE          0U      /* activation mode 0..3 (N, A, L, B) */
+#define PROTO_CFG_LUX_LEVEL     1U      /* lumen activation level 0..64000 */
+#define PROTO_CFG_GROUP         2U      /* own CAN group 1..CANGROUP_TEST-1 */
+
+#define PROTO_OK                0U
+#define PROTO_ERR_LENGTH        1U
+#define PROTO_ERR_VALUE         2U
+#define PROTO_ERR_TYPE          3U
+#define PROTO_ERR_BUSY          4U      /* CAN off or its queue full */
+
+/*
+ * Request handler of the application. data points into the RX ring and
+ * is valid during the call only. Writes the response payload, status
+ * byte first, to resp (PROTO_MAX_PAYLOAD bytes) and returns its length.
+ */
+typedef uint32_t (*proto_handler_t)(uint8_t type, const uint8_t *data, uint32_t len, uint8_t *resp);
+
+typedef struct
+{
+    uint32_t frames;            /* requests handled */
+    uint32_t crcErrors;
+    uint32_t badFrames;         /* COBS errors, too short or too long */
+    uint32_t txDropped;         /* messages that did not fit into the TX ring */
+} proto_stats_t;
+
+void proto_init(uint32_t baud, proto_handler_t handler);
+void proto_poll(void);
+Bool proto_send(uint8_t type, const uint8_t *data, uint32_t len);
+void proto_getStats(proto_stats_t *stats);
+
+
+#endif /* end __PROTO_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
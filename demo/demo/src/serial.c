@@ -0,0 +1,519 @@
+/*****************************************************************************
+ *   serial.c:  Buffered UART3 service, interrupt RX and GPDMA TX
+ *
+ ******************************************************************************/
+
+/*
+ * UART3 (P0.0 TXD, P0.1 RXD, the USB serial port of the base board) with
+ * a RAM ring in each direction, so task code never waits for the line:
+ * serial_write queues what fits and returns, serial_read takes what has
+ * arrived. UART0 cannot be used, its only TXD0 pin P0.2 is the input of
+ * the temperature sensor.
+ *
+ * RX: the FIFO interrupts at 8 characters (RDA) and after 4 character
+ * times of silence with fewer waiting (CTI), so single bytes are not lost
+ * in the FIFO and a burst costs one interrupt per 8 bytes. The handler
+ * drains the FIFO into the RX ring and counts line errors. When the ring
+ * passes SERIAL_RX_STOP the rxThrottle hook is asked to stop the sender,
+ * when serial_read brings it below SERIAL_RX_GO to let it go on.
+ *
+ * TX: a contiguous run of at least SERIAL_DMA_MIN bytes in the TX ring is
+ * handed to the GPDMA (channel SERIAL_DMA_CH, UART3 TX request, FIFO DMA
+ * mode), which feeds the FIFO without the CPU. Shorter runs are written 16
+ * bytes at a time from the THRE interrupt. The txAllowed hook is asked
+ * before every block; when it refuses, TX stops until serial_kick.
+ *
+ * serial_peek and serial_consume let a parser work on the received bytes
+ * in place, without copying them out of the RX ring first.
+ *
+ * Each ring has one producer and one consumer, head and tail are each
+ * written by one side only. The TX start is shared by task code, the UART
+ * and the GPDMA interrupt and runs with interrupts masked.
+ *
+ * UART3_IRQHandler must call serial_intHandler and DMA_IRQHandler must
+ * call serial_dmaIntHandler. The GPDMA is used only if GPDMA_Init has been
+ * called before serial_init; without it or when the channel cannot be set
+ * up, all TX goes through the THRE interrupt.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "LPC17xx.h"
+#include "lpc17xx_uart.h"
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_gpdma.h"
+#include "serial.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define SERIAL_UART         LPC_UART3
+#define RX_MASK             (SERIAL_RX_SIZE - 1U)
+#define TX_MASK             (SERIAL_TX_SIZE - 1U)
+#define DMA_MAX_CHUNK       4095U       /* transfer size field of a channel */
+
+#define LINE_ERRORS         (UART_LSR_OE | UART_LSR_PE | UART_LSR_FE | UART_LSR_BI)
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint8_t rxRing[SERIAL_RX_SIZE];
+static uint8_t txRing[SERIAL_TX_SIZE];
+static volatile uint32_t rxHead = 0U;       /* written by the interrupt only */
+static volatile uint32_t rxTail = 0U;       /* written by serial_read only */
+static volatile uint32_t txHead = 0U;       /* written by serial_write only */
+static volatile uint32_t txTail = 0U;       /* written with interrupts masked only */
+static volatile uint32_t txDmaLen = 0U;     /* bytes of the GPDMA block in flight, 0 - none */
+
+static Bool useDma = FALSE;
+static Bool throttled = FALSE;
+static serial_flow_t flow = {NULL, NULL};
+static serial_stats_t stats;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Counts the errors of a line status value.
+ *  @param lsr		uint32_t,
+ *             		UART LSR, reading it cleared the error bits.
+ *  @returns
+ *  @side effects:	None.
+ */
+static void countErrors(uint32_t lsr) {
+    if ((lsr & LINE_ERRORS) != 0U) {
+        if ((lsr & UART_LSR_OE) != 0U) {
+            stats.overruns++;
+        }
+        if ((lsr & UART_LSR_PE) != 0U) {
+            stats.parityErrors++;
+        }
+        if ((lsr & UART_LSR_FE) != 0U) {
+            stats.framingErrors++;
+        }
+        if ((lsr & UART_LSR_BI) != 0U) {
+            stats.breaks++;
+        }
+    }
+}
+
+/*!
+ *  @brief    		Moves the RX FIFO into the RX ring, from the interrupt.
+ *  @returns
+ *  @side effects:	May call the rxThrottle hook.
+ */
+static void rxDrain(void) {
+    uint32_t lsr;
+    uint32_t head = rxHead;
+    uint32_t count;
+    uint8_t byte;
+
+    for (;;) {
+        lsr = SERIAL_UART->LSR;
+        countErrors(lsr);
+        if ((lsr & UART_LSR_RDR) == 0U) {
+            break;
+        }
+        byte = (uint8_t)SERIAL_UART->RBR;
+        if ((head - rxTail) < SERIAL_RX_SIZE) {
+            rxRing[head & RX_MASK] = byte;
+            head++;
+            stats.rxBytes++;
+        } else {
+            stats.rxDropped++;
+        }
+    }
+    rxHead = head;
+
+    count = head - rxTail;
+    if (count > stats.rxPeak) {
+        stats.rxPeak = count;
+    }
+    if ((!throttled) && (count >= SERIAL_RX_STOP)) {
+        throttled = TRUE;
+        if (flow.rxThrottle != NULL) {
+            flow.rxThrottle(TRUE);
+        }
+    }
+}
+
+/*!
+ *  @brief    		Hands a contiguous run of the TX ring to the GPDMA.
+ *  @param run		uint32_t,
+ *             		bytes from txTail up to the end of the ring.
+ *  @returns  		TRUE if the block was started.
+ *  @side effects:	Takes channel SERIAL_DMA_CH.
+ */
+static Bool dmaStart(uint32_t run) {
+    GPDMA_Channel_CFG_Type cfg;
+    Bool output = FALSE;
+
+    if (run > DMA_MAX_CHUNK) {
+        run = DMA_MAX_CHUNK;
+    }
+    cfg.ChannelNum    = SERIAL_DMA_CH;
+    cfg.TransferSize  = run;
+    cfg.TransferWidth = 0U;
+    cfg.SrcMemAddr    = (uint32_t)(uintptr_t)&txRing[txTail & TX_MASK];
+    cfg.DstMemAddr    = 0U;
+    cfg.TransferType  = GPDMA_TRANSFERTYPE_M2P;
+    cfg.SrcConn       = 0U;
+    cfg.DstConn       = GPDMA_CONN_UART3_Tx;
+    cfg.DMALLI        = 0U;
+    if (GPDMA_Setup(&cfg) == SUCCESS) {
+        txDmaLen = run;
+        GPDMA_ChannelCmd(SERIAL_DMA_CH, ENABLE);
+        output = TRUE;
+    } else {
+        useDma = FALSE;             /* e.g. channel taken, stay with the FIFO */
+    }
+    return output;
+}
+
+/*!
+ *  @brief    		Starts the next TX block unless one is in flight, interrupts masked.
+ *  @returns
+ *  @side effects:	May call the txAllowed hook, enables or disables the THRE interrupt.
+ */
+static void txPump(void) {
+    uint32_t count;
+    uint32_t run;
+    uint32_t i;
+
+    if (txDmaLen == 0U) {
+        count = txHead - txTail;
+        if ((count == 0U) || ((flow.txAllowed != NULL) && (!flow.txAllowed()))) {
+            SERIAL_UART->IER &= ~UART_IER_THREINT_EN;
+        } else {
+            run = SERIAL_TX_SIZE - (txTail & TX_MASK);
+            if (run > count) {
+                run = count;
+            }
+            if (useDma && (run >= SERIAL_DMA_MIN) && dmaStart(run)) {
+                SERIAL_UART->IER &= ~UART_IER_THREINT_EN;
+            } else {
+                if ((SERIAL_UART->LSR & UART_LSR_THRE) != 0U) {
+                    for (i = 0U; (i < (uint32_t)UART_TX_FIFO_SIZE) && (i < count); i++) {
+                        SERIAL_UART->THR = txRing[(txTail + i) & TX_MASK];
+                    }
+                    txTail += i;
+                    stats.txBytes += i;
+                }
+                SERIAL_UART->IER |= UART_IER_THREINT_EN;
+            }
+        }
+    }
+}
+
+/*!
+ *  @brief    		Runs txPump with interrupts masked.
+ *  @returns
+ *  @side effects:	See txPump.
+ */
+static void txKick(void) {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    txPump();
+    __set_PRIMASK(primask);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Opens UART3 8N1 with empty rings and enables its interrupt.
+ *  @param baud		uint32_t,
+ *             		line speed, up to 921600.
+ *  @returns
+ *  @side effects:	Takes UART3, pins P0.0, P0.1, GPDMA channel SERIAL_DMA_CH;
+ *             		sets the UART3 clock to CCLK.
+ */
+void serial_init(uint32_t baud) {
+    UART_CFG_Type uartCfg;
+    UART_FIFO_CFG_Type fifoCfg;
+    PINSEL_CFG_Type pinCfg;
+    uint8_t *p = (uint8_t *)&stats;
+    uint32_t i;
+
+    NVIC_DisableIRQ(UART3_IRQn);
+    rxHead = 0U;
+    rxTail = 0U;
+    txHead = 0U;
+    txTail = 0U;
+    txDmaLen = 0U;
+    throttled = FALSE;
+    for (i = 0U; i < sizeof(stats); i++) {
+        p[i] = 0U;
+    }
+
+    /* not UART0: its TXD0 is P0.2, the MAX6576 output (J25) */
+    pinCfg.Funcnum = 2;
+    pinCfg.OpenDrain = 0;
+    pinCfg.Pinmode = 0;
+    pinCfg.Portnum = 0;
+    pinCfg.Pinnum = 0;
+    PINSEL_ConfigPin(&pinCfg);
+    pinCfg.Pinnum = 1;
+    PINSEL_ConfigPin(&pinCfg);
+
+    /* at CCLK/4 the divisor for 921600 would be below the 3 the fractional divider needs */
+    CLKPWR_SetPCLKDiv(CLKPWR_PCLKSEL_UART3, CLKPWR_PCLKSEL_CCLK_DIV_1);
+
+    UART_ConfigStructInit(&uartCfg);
+    uartCfg.Baud_rate = baud;
+    UART_Init((LPC_UART_TypeDef *)SERIAL_UART, &uartCfg);
+
+    fifoCfg.FIFO_ResetRxBuf = ENABLE;
+    fifoCfg.FIFO_ResetTxBuf = ENABLE;
+    fifoCfg.FIFO_DMAMode = ENABLE;
+    fifoCfg.FIFO_Level = UART_FIFO_TRGLEV2;
+    UART_FIFOConfig((LPC_UART_TypeDef *)SERIAL_UART, &fifoCfg);
+    UART_TxCmd((LPC_UART_TypeDef *)SERIAL_UART, ENABLE);
+
+    useDma = (Bool)((LPC_SC->PCONP & CLKPWR_PCONP_PCGPDMA) != 0U);
+
+    UART_IntConfig((LPC_UART_TypeDef *)SERIAL_UART, UART_INTCFG_RBR, ENABLE);
+    UART_IntConfig((LPC_UART_TypeDef *)SERIAL_UART, UART_INTCFG_RLS, ENABLE);
+    NVIC_EnableIRQ(UART3_IRQn);
+}
+
+/*!
+ *  @brief    		Installs the flow control hooks.
+ *  @param newFlow	const serial_flow_t*,
+ *             		hooks, copied; NULL removes both.
+ *  @returns
+ *  @side effects:	None.
+ */
+void serial_setFlow(const serial_flow_t *newFlow) {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (newFlow != NULL) {
+        flow = *newFlow;
+    } else {
+        flow.rxThrottle = NULL;
+        flow.txAllowed = NULL;
+    }
+    __set_PRIMASK(primask);
+}
+
+/*!
+ *  @brief    		Queues bytes for sending, never waits.
+ *  @param buf		const uint8_t*,
+ *             		data.
+ *  @param len		uint32_t,
+ *             		bytes in buf.
+ *  @returns  		Bytes queued, less than len if the TX ring is full.
+ *  @side effects:	Starts the TX if it was idle. Task code only.
+ */
+uint32_t serial_write(const uint8_t *buf, uint32_t len) {
+    uint32_t head = txHead;
+    uint32_t n = SERIAL_TX_SIZE - (head - txTail);
+    uint32_t i;
+
+    if (n > len) {
+        n = len;
+    }
+    for (i = 0U; i < n; i++) {
+        txRing[(head + i) & TX_MASK] = buf[i];
+    }
+    __DMB();                        /* data in the ring before it is published */
+    txHead = head + n;
+    stats.txDropped += len - n;
+    txKick();
+    return n;
+}
+
+/*!
+ *  @brief    		Takes received bytes out of the RX ring.
+ *  @param buf		uint8_t*,
+ *             		destination.
+ *  @param len		uint32_t,
+ *             		size of buf.
+ *  @returns  		Bytes copied, 0 if nothing has arrived.
+ *  @side effects:	May call the rxThrottle hook. Task code only.
+ */
+uint32_t serial_read(uint8_t *buf, uint32_t len) {
+    uint32_t tail = rxTail;
+    uint32_t n = rxHead - tail;
+    uint32_t i;
+
+    if (n > len) {
+        n = len;
+    }
+    for (i = 0U; i < n; i++) {
+        buf[i] = rxRing[(tail + i) & RX_MASK];
+    }
+    serial_consume(n);
+    return n;
+}
+
+/*!
+ *  @brief    		Gives access to received bytes inside the RX ring, for parsing in place.
+ *  @param offset	uint32_t,
+ *             		bytes to skip from the oldest received byte.
+ *  @param data		uint8_t**,
+ *             		set to the first byte after offset.
+ *  @returns  		Bytes that follow contiguously, 0 if none (data is not set then).
+ *  @side effects:	None. The bytes belong to the caller, who may modify them,
+ *             		until serial_consume. Task code only.
+ */
+uint32_t serial_peek(uint32_t offset, uint8_t **data) {
+    uint32_t count = rxHead - rxTail;
+    uint32_t pos;
+    uint32_t run = 0U;
+
+    if (offset < count) {
+        pos = (rxTail + offset) & RX_MASK;
+        run = SERIAL_RX_SIZE - pos;
+        if (run > (count - offset)) {
+            run = count - offset;
+        }
+        *data = &rxRing[pos];
+    }
+    return run;
+}
+
+/*!
+ *  @brief    		Releases received bytes, after serial_peek.
+ *  @param len		uint32_t,
+ *             		bytes to drop from the oldest one on.
+ *  @returns
+ *  @side effects:	May call the rxThrottle hook. Task code only.
+ */
+void serial_consume(uint32_t len) {
+    uint32_t count = rxHead - rxTail;
+    uint32_t primask;
+
+    if (len > count) {
+        len = count;
+    }
+    rxTail += len;
+
+    if (throttled) {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        if ((rxHead - rxTail) <= SERIAL_RX_GO) {
+            throttled = FALSE;
+            if (flow.rxThrottle != NULL) {
+                flow.rxThrottle(FALSE);
+            }
+        }
+        __set_PRIMASK(primask);
+    }
+}
+
+/*!
+ *  @brief    		Bytes waiting in the RX ring.
+ *  @returns  		Count.
+ *  @side effects:	None.
+ */
+uint32_t serial_rxCount(void) {
+    return rxHead - rxTail;
+}
+
+/*!
+ *  @brief    		Free space in the TX ring.
+ *  @returns  		Bytes serial_write would take now.
+ *  @side effects:	None.
+ */
+uint32_t serial_txFree(void) {
+    return SERIAL_TX_SIZE - (txHead - txTail);
+}
+
+/*!
+ *  @brief    		Tells whether everything queued has left the UART.
+ *  @returns  		TRUE if the TX ring, the GPDMA and the transmitter are empty.
+ *  @side effects:	None.
+ */
+Bool serial_txIdle(void) {
+    return (Bool)((txHead == txTail) && (txDmaLen == 0U)
+                  && ((SERIAL_UART->LSR & UART_LSR_TEMT) != 0U));
+}
+
+/*!
+ *  @brief    		Restarts the TX after the txAllowed hook refused it.
+ *  @returns
+ *  @side effects:	Calls the txAllowed hook.
+ */
+void serial_kick(void) {
+    txKick();
+}
+
+/*!
+ *  @brief    		Copies the counters.
+ *  @param out		serial_stats_t*,
+ *             		destination.
+ *  @returns
+ *  @side effects:	Masks interrupts while copying.
+ */
+void serial_getStats(serial_stats_t *out) {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *out = stats;
+    __set_PRIMASK(primask);
+}
+
+/*!
+ *  @brief    		UART3 interrupt, call from UART3_IRQHandler.
+ *  @returns
+ *  @side effects:	Fills the RX ring, refills the TX FIFO.
+ */
+void serial_intHandler(void) {
+    uint32_t iir = SERIAL_UART->IIR;
+    uint32_t id;
+
+    while ((iir & UART_IIR_INTSTAT_PEND) == 0U) {
+        id = iir & UART_IIR_INTID_MASK;
+        if (id == UART_IIR_INTID_THRE) {
+            txKick();
+        } else if (id == UART_IIR_INTID_CTI) {
+            stats.timeouts++;
+            rxDrain();
+        } else if ((id == UART_IIR_INTID_RDA) || (id == UART_IIR_INTID_RLS)) {
+            rxDrain();
+        } else {}
+        iir = SERIAL_UART->IIR;
+    }
+}
+
+/*!
+ *  @brief    		GPDMA interrupt of the TX channel, call from DMA_IRQHandler.
+ *  @returns
+ *  @side effects:	Starts the next TX block.
+ */
+void serial_dmaIntHandler(void) {
+    uint32_t primask;
+
+    if (GPDMA_IntGetStatus(GPDMA_STAT_INTERR, SERIAL_DMA_CH)) {
+        GPDMA_ClearIntPending(GPDMA_STATCLR_INTERR, SERIAL_DMA_CH);
+        GPDMA_ChannelCmd(SERIAL_DMA_CH, DISABLE);
+        primask = __get_PRIMASK();
+        __disable_irq();
+        useDma = FALSE;             /* the block is sent again through the FIFO */
+        txDmaLen = 0U;
+        txPump();
+        __set_PRIMASK(primask);
+    }
+    if (GPDMA_IntGetStatus(GPDMA_STAT_INTTC, SERIAL_DMA_CH)) {
+        GPDMA_ClearIntPending(GPDMA_STATCLR_INTTC, SERIAL_DMA_CH);
+        GPDMA_ChannelCmd(SERIAL_DMA_CH, DISABLE);
+        primask = __get_PRIMASK();
+        __disable_irq();
+        txTail += txDmaLen;
+        stats.txBytes += txDmaLen;
+        stats.dmaBlocks++;
+        txDmaLen = 0U;
+        txPump();
+        __set_PRIMASK(primask);
+    }
+}
@@ -0,0 +1,71 @@
+/*****************************************************************************
+ *   serial.h:  Header file for the buffered UART3 service
+ *
+******************************************************************************/
+#ifndef __SERIAL_H
+#define __SERIAL_H
+
+#include "lpc_types.h"
+
+/* Ring buffer sizes in bytes, powers of 2 */
+#ifndef SERIAL_RX_SIZE
+#define SERIAL_RX_SIZE          256U
+#endif
+#ifndef SERIAL_TX_SIZE
+#define SERIAL_TX_SIZE          1024U
+#endif
+
+/* RX ring levels for the throttle hook: stop above, go again below */
+#define SERIAL_RX_STOP          ((SERIAL_RX_SIZE * 3U) / 4U)
+#define SERIAL_RX_GO            (SERIAL_RX_SIZE / 4U)
+
+/* Contiguous TX bytes sent with the GPDMA instead of the THRE interrupt */
+#define SERIAL_DMA_MIN          32U
+
+/* GPDMA channel of the TX blocks (0 and 1 belong to flash.c) */
+#define SERIAL_DMA_CH           2U
+
+/* Flow control hooks, either may be NULL */
+typedef struct
+{
+    void (*rxThrottle)(Bool stop);  /* RX ring passed SERIAL_RX_STOP (TRUE) or SERIAL_RX_GO (FALSE),
+                                       e.g. drive RTS or send XOFF/XON; called from the interrupt */
+    Bool (*txAllowed)(void);        /* asked before each TX chunk, e.g. read CTS; FALSE holds
+                                       the TX until serial_kick */
+} serial_flow_t;
+
+/* Counters since serial_init */
+typedef struct
+{
+    uint32_t rxBytes;               /* bytes put into the RX ring */
+    uint32_t txBytes;               /* bytes handed to the UART */
+    uint32_t rxDropped;             /* bytes lost, RX ring full */
+    uint32_t txDropped;             /* bytes refused by serial_write, TX ring full */
+    uint32_t overruns;              /* RX FIFO overruns */
+    uint32_t framingErrors;
+    uint32_t parityErrors;
+    uint32_t breaks;
+    uint32_t timeouts;              /* character time-out interrupts */
+    uint32_t dmaBlocks;             /* TX blocks sent by the GPDMA */
+    uint32_t rxPeak;                /* most bytes waiting in the RX ring */
+} serial_stats_t;
+
+void serial_init(uint32_t baud);
+void serial_setFlow(const serial_flow_t *flow);
+uint32_t serial_write(const uint8_t *buf, uint32_t len);
+uint32_t serial_read(uint8_t *buf, uint32_t len);
+uint32_t serial_peek(uint32_t offset, uint8_t **data);
+void serial_consume(uint32_t len);
+uint32_t serial_rxCount(void);
+uint32_t serial_txFree(void);
+Bool serial_txIdle(void);
+void serial_kick(void);
+void serial_getStats(serial_stats_t *stats);
+void serial_intHandler(void);
+void serial_dmaIntHandler(void);
+
+
+#endif /* end __SERIAL_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
@@ -1,2674 +0,0 @@
-const unsigned char sound_8k[] = {
-    0x52, 0x49, 0x46, 0x46, 0x24, 0x7D, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45, 
-    0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 
-    0x40, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 
-    0x64, 0x61, 0x74, 0x61, 0x00, 0x7D, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 
-    0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 
-    0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 
-    0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x82, 0x81, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 
-    0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x7F, 0x80, 0x80, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 
-    0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x7F, 0x7B, 0x7D, 0x82, 0x84, 0x82, 0x80, 
-    0x81, 0x81, 0x81, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x81, 0x81, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7F, 
-    0x7D, 0x7F, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x81, 0x80, 0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x81, 
-    0x80, 0x80, 0x7C, 0x72, 0x79, 0x8E, 0x91, 0x80, 0x82, 0x85, 0x82, 0x7E, 
-    0x7E, 0x81, 0x80, 0x7F, 0x7E, 0x7E, 0x81, 0x82, 0x81, 0x7B, 0x7B, 0x7F, 
-    0x7D, 0x7E, 0x80, 0x80, 0x7F, 0x79, 0x78, 0x84, 0x91, 0x88, 0x79, 0x77, 
-    0x7D, 0x83, 0x80, 0x7F, 0x81, 0x83, 0x83, 0x83, 0x84, 0x82, 0x80, 0x7D, 
-    0x7A, 0x7B, 0x80, 0x83, 0x85, 0x85, 0x81, 0x7F, 0x7F, 0x80, 0x81, 0x7F, 
-    0x7C, 0x7C, 0x81, 0x83, 0x80, 0x82, 0x85, 0x85, 0x7F, 0x7B, 0x7F, 0x7E, 
-    0x82, 0x86, 0x7C, 0x79, 0x7E, 0x84, 0x81, 0x81, 0x81, 0x81, 0x86, 0x82, 
-    0x7B, 0x76, 0x7E, 0x7F, 0x7E, 0x7E, 0x7F, 0x83, 0x7F, 0x7D, 0x7E, 0x82, 
-    0x86, 0x82, 0x7E, 0x7D, 0x83, 0x84, 0x7F, 0x7E, 0x7D, 0x7D, 0x81, 0x82, 
-    0x82, 0x80, 0x7D, 0x7E, 0x80, 0x80, 0x7E, 0x82, 0x81, 0x7D, 0x80, 0x84, 
-    0x82, 0x7E, 0x7E, 0x81, 0x86, 0x81, 0x80, 0x87, 0x84, 0x7D, 0x7F, 0x83, 
-    0x7F, 0x80, 0x80, 0x7D, 0x80, 0x81, 0x7C, 0x7C, 0x81, 0x83, 0x83, 0x80, 
-    0x82, 0x85, 0x80, 0x7E, 0x7D, 0x79, 0x7A, 0x80, 0x83, 0x82, 0x83, 0x8A, 
-    0x8A, 0x85, 0x85, 0x82, 0x77, 0x74, 0x76, 0x69, 0x6E, 0x7A, 0x86, 0x8B, 
-    0x8A, 0x91, 0x8A, 0x8A, 0x85, 0x86, 0x71, 0x69, 0x77, 0x6A, 0x6F, 0x78, 
-    0x81, 0x85, 0x85, 0x7F, 0x7B, 0x8C, 0x8F, 0x83, 0x84, 0x8E, 0x8E, 0x87, 
-    0x85, 0x89, 0x86, 0x78, 0x7E, 0x84, 0x86, 0x88, 0x7B, 0x75, 0x77, 0x82, 
-    0x84, 0x81, 0x95, 0x90, 0x88, 0x7A, 0x71, 0x78, 0x7B, 0x86, 0x81, 0x7E, 
-    0x82, 0x88, 0x86, 0x79, 0x7D, 0x78, 0x6C, 0x6F, 0x82, 0x8D, 0x88, 0x88, 
-    0x84, 0x6A, 0x62, 0x6E, 0x70, 0x72, 0x7C, 0x95, 0x8C, 0x8B, 0x8D, 0x80, 
-    0x88, 0x81, 0x7A, 0x62, 0x6D, 0x7F, 0x78, 0x7A, 0x87, 0x9E, 0x7E, 0x69, 
-    0x7B, 0x77, 0x7A, 0x7D, 0x8C, 0x98, 0x99, 0x98, 0x92, 0x91, 0x85, 0x84, 
-    0x6C, 0x65, 0x79, 0x90, 0x97, 0x8E, 0x87, 0x6F, 0x72, 0x6D, 0x6B, 0x85, 
-    0x8F, 0x79, 0x7F, 0x7B, 0x77, 0x7C, 0x8A, 0xA3, 0x8D, 0x6C, 0x63, 0xAD, 
-    0x9D, 0x74, 0x66, 0x83, 0x9C, 0x77, 0x6C, 0x7F, 0x87, 0x8A, 0x6A, 0x81, 
-    0x9D, 0x94, 0x8F, 0x7F, 0x85, 0x86, 0x6C, 0x66, 0x7C, 0x91, 0x83, 0x76, 
-    0x73, 0x60, 0x70, 0x6E, 0x69, 0x7B, 0x84, 0x8B, 0x91, 0x8A, 0x8B, 0x5E, 
-    0x75, 0x6A, 0x6E, 0x76, 0x9E, 0xA4, 0x8B, 0x97, 0x91, 0x8C, 0x85, 0x84, 
-    0x82, 0x7F, 0x7C, 0x8D, 0x65, 0x56, 0x76, 0x6D, 0x61, 0x84, 0xA1, 0x7C, 
-    0x8F, 0x8A, 0x8F, 0x5B, 0x68, 0x7A, 0x6D, 0x92, 0x6C, 0x85, 0x7B, 0x8F, 
-    0xBE, 0x81, 0xA0, 0x8F, 0x91, 0x8C, 0x57, 0x83, 0x6C, 0x8C, 0xA9, 0x7D, 
-    0x9D, 0x82, 0x9E, 0x56, 0x57, 0x7E, 0x67, 0x78, 0x7B, 0xA5, 0x60, 0x89, 
-    0x79, 0x8C, 0xA5, 0x77, 0x99, 0x79, 0x97, 0x6B, 0x64, 0x8F, 0x64, 0xB1, 
-    0x7E, 0x88, 0x92, 0x7C, 0x92, 0x79, 0x86, 0x7B, 0x6F, 0x4C, 0x66, 0x73, 
-    0x72, 0x69, 0x8F, 0x99, 0x7A, 0x8B, 0x80, 0x81, 0x51, 0x77, 0x6A, 0x6F, 
-    0x7E, 0x7D, 0x84, 0x78, 0x84, 0x7E, 0x7F, 0xB4, 0x8A, 0x9D, 0x8B, 0xA1, 
-    0x8A, 0x5D, 0x8E, 0x78, 0xA9, 0x7D, 0x88, 0x8D, 0x80, 0x90, 0x85, 0x5A, 
-    0x61, 0x6F, 0x73, 0x9F, 0x64, 0x68, 0x7D, 0x70, 0x77, 0x98, 0x97, 0x86, 
-    0x87, 0x8E, 0x80, 0x9F, 0x63, 0x69, 0x83, 0x5E, 0x85, 0x92, 0x5E, 0x82, 
-    0x85, 0xA8, 0x83, 0xA0, 0x89, 0x94, 0x72, 0x51, 0x89, 0x70, 0x79, 0x72, 
-    0x84, 0xA1, 0x8E, 0x9A, 0x8A, 0x78, 0x75, 0x95, 0x81, 0x87, 0x6A, 0x5D, 
-    0x7B, 0x8B, 0x5E, 0x71, 0xAA, 0x83, 0x81, 0x88, 0x90, 0x87, 0x54, 0x74, 
-    0x6D, 0x77, 0x6C, 0x7E, 0x84, 0x6F, 0x91, 0x79, 0x94, 0xAD, 0x8C, 0x8F, 
-    0x95, 0x71, 0x68, 0x80, 0x82, 0xA6, 0x84, 0x7A, 0x95, 0x8B, 0x82, 0x8D, 
-    0x77, 0x48, 0x78, 0x69, 0xA4, 0x73, 0x63, 0x7C, 0x71, 0x6F, 0x83, 0xAA, 
-    0x82, 0x87, 0x8D, 0x7D, 0x8E, 0x94, 0x5D, 0x62, 0x6F, 0x9C, 0x5E, 0x66, 
-    0x83, 0x78, 0x79, 0x98, 0x99, 0x89, 0x94, 0x72, 0x5D, 0x7A, 0x7A, 0x7F, 
-    0x7B, 0x71, 0x9C, 0xA5, 0x91, 0x96, 0xA1, 0x75, 0x79, 0xA0, 0x7A, 0x7C, 
-    0x59, 0x86, 0x89, 0x58, 0x74, 0x9A, 0x9C, 0x76, 0x8A, 0x8D, 0x7D, 0x9A, 
-    0x54, 0x5F, 0x71, 0x7B, 0x70, 0x69, 0x82, 0x78, 0x7F, 0x78, 0xAD, 0x96, 
-    0x86, 0x9E, 0x87, 0x57, 0x7D, 0x84, 0x9C, 0x96, 0x6B, 0x8A, 0x9B, 0x86, 
-    0x89, 0x8E, 0x63, 0x57, 0x79, 0x66, 0xAF, 0x68, 0x66, 0x7F, 0x6B, 0x7C, 
-    0x9E, 0x9D, 0x81, 0x8D, 0x8A, 0x7B, 0x9B, 0x5A, 0x65, 0x8A, 0x90, 0x48, 
-    0x7C, 0x7B, 0x80, 0x79, 0x84, 0xAA, 0x87, 0x95, 0x80, 0x5E, 0x7A, 0x72, 
-    0x87, 0x69, 0x7F, 0x80, 0x99, 0xA5, 0x89, 0x9F, 0x7C, 0x8B, 0x8F, 0x7A, 
-    0x8D, 0x56, 0x72, 0x63, 0x7A, 0x70, 0x81, 0xB4, 0x76, 0x90, 0x84, 0x8C, 
-    0x88, 0x4E, 0x6E, 0x75, 0xA1, 0x4B, 0x76, 0x82, 0x70, 0x88, 0x63, 0xA6, 
-    0x96, 0x8B, 0x8F, 0x8E, 0x7D, 0x59, 0x88, 0x8B, 0x95, 0x89, 0x58, 0xA6, 
-    0x8D, 0x8B, 0x84, 0x93, 0x68, 0x50, 0x7B, 0x6F, 0x86, 0x6B, 0x79, 0x7F, 
-    0x6A, 0xA2, 0x9D, 0x91, 0x8C, 0x87, 0x90, 0x7A, 0x6B, 0x69, 0x9B, 0x96, 
-    0x47, 0x7E, 0x76, 0x87, 0x77, 0x7C, 0xAA, 0x8C, 0x91, 0x8C, 0x69, 0x75, 
-    0x75, 0x84, 0x65, 0x7A, 0x82, 0x7C, 0xB2, 0x90, 0x93, 0x8D, 0x8C, 0x89, 
-    0x7D, 0x8D, 0x67, 0x54, 0x94, 0x74, 0x5A, 0x77, 0xA5, 0x8A, 0x77, 0x88, 
-    0x88, 0x82, 0x52, 0x67, 0x7F, 0x9D, 0x53, 0x68, 0x76, 0x6E, 0x88, 0x68, 
-    0x86, 0xB1, 0x85, 0x93, 0x8C, 0x9F, 0x61, 0x68, 0x8B, 0x8E, 0x95, 0x51, 
-    0x8E, 0xAB, 0x7F, 0x92, 0x86, 0x90, 0x46, 0x78, 0x6C, 0x84, 0xA8, 0x48, 
-    0x8D, 0x64, 0x89, 0xAB, 0x86, 0x9A, 0x7E, 0x91, 0x88, 0x62, 0x91, 0x91, 
-    0x84, 0x62, 0x4D, 0x88, 0x6F, 0x84, 0x6F, 0x8D, 0xA9, 0x82, 0x9B, 0x80, 
-    0x64, 0x7C, 0x70, 0x7C, 0x67, 0x8F, 0x74, 0x9D, 0xAB, 0x83, 0xA0, 0x87, 
-    0x90, 0x80, 0x8C, 0x6A, 0x57, 0xB3, 0x65, 0x5F, 0x73, 0x94, 0x9B, 0x6D, 
-    0x8E, 0x7B, 0x94, 0x5C, 0x53, 0x81, 0x8E, 0x8F, 0x46, 0x6A, 0x77, 0x76, 
-    0x77, 0x64, 0xA4, 0x98, 0x89, 0x9A, 0x8A, 0x99, 0x55, 0x7D, 0x98, 0x82, 
-    0x8E, 0x58, 0x99, 0x99, 0x83, 0x8F, 0x8A, 0x76, 0x4A, 0x7C, 0x70, 0xA9, 
-    0x78, 0x58, 0x7D, 0x6E, 0x79, 0x8F, 0xAC, 0x87, 0x8A, 0x92, 0x81, 0x99, 
-    0x8C, 0x60, 0xA2, 0x6B, 0x49, 0x7C, 0x78, 0x7C, 0x70, 0xA2, 0x92, 0x8A, 
-    0x9B, 0x6B, 0x6A, 0x7A, 0x9D, 0x60, 0x62, 0x85, 0x76, 0xA3, 0x94, 0x98, 
-    0x8D, 0x86, 0x95, 0x70, 0x84, 0x87, 0x96, 0x60, 0x3E, 0xAE, 0x60, 0x60, 
-    0x8B, 0x9A, 0x80, 0x85, 0x93, 0x4F, 0x74, 0x8C, 0x96, 0x81, 0x4A, 0x80, 
-    0x79, 0x6E, 0x7C, 0x7D, 0xAA, 0x88, 0x9C, 0x81, 0x96, 0x8C, 0x4D, 0x93, 
-    0x8B, 0x92, 0x72, 0x52, 0xAD, 0x89, 0x89, 0x84, 0x90, 0x5E, 0x57, 0x8A, 
-    0x94, 0x8B, 0x57, 0x71, 0x74, 0x73, 0x70, 0x9C, 0xA7, 0x7B, 0x96, 0x84, 
-    0x91, 0x97, 0x7E, 0x8A, 0x7F, 0x73, 0x47, 0x79, 0x78, 0x6B, 0x7E, 0x9D, 
-    0x8F, 0x8B, 0x8E, 0x63, 0x6B, 0xA1, 0x79, 0x53, 0x74, 0x79, 0x7D, 0xA4, 
-    0x96, 0x91, 0x92, 0x85, 0x55, 0xA2, 0x8B, 0x90, 0x5F, 0x60, 0xBB, 0x66, 
-    0x67, 0x72, 0xA1, 0x93, 0x6F, 0xA5, 0x7B, 0x6F, 0x6C, 0x8C, 0x97, 0x7B, 
-    0x64, 0x68, 0x75, 0x6E, 0x7B, 0x76, 0xAE, 0x93, 0x87, 0x94, 0x90, 0x8D, 
-    0x4B, 0x92, 0x92, 0x7D, 0x63, 0x63, 0xA2, 0x8F, 0x85, 0x93, 0x79, 0x5B, 
-    0x66, 0x89, 0xA0, 0x79, 0x5F, 0x75, 0x72, 0x76, 0x71, 0xAB, 0x9A, 0x80, 
-    0x8E, 0x84, 0x99, 0x8E, 0x8C, 0x7D, 0x80, 0x6E, 0x45, 0x7C, 0x6F, 0x6F, 
-    0x7B, 0x9E, 0x8F, 0x87, 0x96, 0x62, 0x65, 0xA5, 0x74, 0x57, 0x6E, 0x7E, 
-    0x76, 0x8E, 0xAA, 0x8B, 0x9D, 0x4C, 0x9E, 0x9B, 0x84, 0x6D, 0x6D, 0xAF, 
-    0x78, 0x68, 0x72, 0x73, 0xB4, 0x77, 0x8C, 0x8F, 0x90, 0x6D, 0x5A, 0xA7, 
-    0x83, 0x8F, 0x54, 0x65, 0x7A, 0x6A, 0x7E, 0x79, 0xB1, 0x82, 0x8F, 0x94, 
-    0x81, 0x95, 0x4B, 0x8C, 0x8F, 0x81, 0x74, 0x4F, 0xA7, 0x88, 0x8B, 0x8D, 
-    0x71, 0x5F, 0x69, 0x73, 0x85, 0xA4, 0x77, 0x5C, 0x79, 0x6F, 0x79, 0xA8, 
-    0x97, 0x83, 0x8E, 0x8A, 0x8E, 0x96, 0x8B, 0x7F, 0x8D, 0x52, 0x4D, 0x81, 
-    0x6C, 0x72, 0x87, 0x9C, 0x83, 0x96, 0x88, 0x57, 0x7D, 0x97, 0x85, 0x55, 
-    0x68, 0x88, 0x6D, 0xA0, 0x97, 0x9F, 0x5B, 0x8A, 0xAB, 0x80, 0x73, 0x67, 
-    0xB3, 0x80, 0x68, 0x6A, 0x79, 0x81, 0x9F, 0x86, 0x83, 0x99, 0x89, 0x4F, 
-    0x85, 0xA3, 0x86, 0x84, 0x51, 0x70, 0x72, 0x74, 0x77, 0x81, 0xA9, 0x7E, 
-    0x99, 0x86, 0x90, 0x75, 0x5A, 0xA8, 0x78, 0x90, 0x6B, 0x5C, 0xA5, 0x7D, 
-    0x95, 0x75, 0x93, 0x70, 0x46, 0x7F, 0x83, 0xAA, 0x5E, 0x55, 0x7E, 0x65, 
-    0x77, 0xA0, 0x9D, 0x80, 0x90, 0x8D, 0x86, 0x94, 0x90, 0x80, 0x88, 0x54, 
-    0x54, 0x7E, 0x73, 0x71, 0x88, 0x9F, 0x84, 0x98, 0x7F, 0x5D, 0x82, 0x8F, 
-    0x96, 0x65, 0x60, 0x86, 0x74, 0x9D, 0xA0, 0x74, 0x79, 0xA6, 0x8F, 0x84, 
-    0x60, 0xB6, 0x88, 0x7F, 0x52, 0x6E, 0x85, 0x64, 0xA7, 0x87, 0x81, 0xA2, 
-    0x6F, 0x5B, 0x8F, 0xAA, 0x7A, 0x82, 0x55, 0x6B, 0x7B, 0x72, 0x7A, 0x7A, 
-    0xA9, 0x81, 0x94, 0x8B, 0x88, 0x67, 0x80, 0x9B, 0x7C, 0x8C, 0x77, 0x5E, 
-    0x95, 0x86, 0x88, 0x7B, 0x8E, 0x5D, 0x51, 0x85, 0x94, 0x9A, 0x54, 0x5B, 
-    0x7E, 0x62, 0x73, 0xA9, 0x94, 0x80, 0x92, 0x8A, 0x87, 0x97, 0x8F, 0x7C, 
-    0x86, 0x4A, 0x61, 0x7C, 0x74, 0x73, 0x8A, 0xA1, 0x83, 0x9D, 0x6F, 0x63, 
-    0x91, 0x90, 0x95, 0x62, 0x67, 0x87, 0x75, 0x81, 0x80, 0xAD, 0x8D, 0x8C, 
-    0x97, 0x86, 0x99, 0x90, 0x89, 0x77, 0x4B, 0x77, 0x6B, 0x78, 0xA0, 0x8A, 
-    0x8B, 0x89, 0x6F, 0x58, 0xA4, 0x93, 0x7C, 0x7B, 0x4D, 0x7C, 0x72, 0x7A, 
-    0x73, 0x80, 0xA2, 0x7D, 0x99, 0x8D, 0x62, 0x93, 0x95, 0x86, 0x87, 0x84, 
-    0x96, 0x4E, 0x67, 0x9C, 0x85, 0x89, 0x7C, 0x5C, 0x64, 0x90, 0xA4, 0x80, 
-    0x58, 0x69, 0x76, 0x63, 0x7B, 0xB0, 0x8D, 0x87, 0x8A, 0x6E, 0x98, 0x98, 
-    0x8E, 0x7A, 0x7D, 0x4D, 0x6D, 0x7B, 0x78, 0x73, 0x91, 0x95, 0x89, 0x94, 
-    0x5F, 0x79, 0x9F, 0x88, 0x90, 0x6F, 0x61, 0x85, 0x74, 0x73, 0x93, 0xA9, 
-    0x82, 0x8A, 0x90, 0x8C, 0x92, 0x8F, 0x7D, 0x7E, 0x49, 0x70, 0x6E, 0x7D, 
-    0xA0, 0x85, 0x8A, 0x85, 0x63, 0x6B, 0xAA, 0x85, 0x84, 0x6C, 0x54, 0x79, 
-    0x71, 0x7C, 0x6D, 0x84, 0xA3, 0x7A, 0xA9, 0x56, 0x91, 0xB5, 0x6E, 0x9B, 
-    0x76, 0x9E, 0x76, 0x51, 0x77, 0x93, 0x98, 0x75, 0x8D, 0x5B, 0x61, 0xAA, 
-    0x8B, 0x89, 0x5A, 0x6A, 0x73, 0x66, 0x84, 0xA5, 0x91, 0x8D, 0x57, 0x82, 
-    0xA7, 0x93, 0x93, 0x7C, 0x85, 0x48, 0x78, 0x7A, 0x7B, 0x73, 0x91, 0x95, 
-    0x8B, 0x86, 0x62, 0x8B, 0x9B, 0x89, 0x83, 0x8C, 0x73, 0x65, 0x79, 0x6A, 
-    0x95, 0xA0, 0x60, 0x8D, 0x9A, 0x88, 0x91, 0x87, 0x8E, 0x62, 0x56, 0x72, 
-    0x64, 0x92, 0x91, 0x8D, 0x89, 0x82, 0x66, 0x86, 0xA0, 0x78, 0x8D, 0x5D, 
-    0x5A, 0x7B, 0x6D, 0x81, 0x65, 0x98, 0x90, 0x8C, 0x6B, 0x7C, 0xC0, 0x7E, 
-    0x86, 0x8B, 0x89, 0x93, 0x61, 0x63, 0x71, 0xA8, 0x81, 0x7B, 0x99, 0x5C, 
-    0x6A, 0x9B, 0x8C, 0x8E, 0x51, 0x6E, 0x77, 0x66, 0x83, 0xA7, 0x99, 0x60, 
-    0x60, 0xAA, 0x92, 0x9A, 0x8C, 0x90, 0x71, 0x53, 0x83, 0x74, 0x84, 0x6F, 
-    0xA2, 0x87, 0x91, 0x89, 0x60, 0x87, 0x94, 0x92, 0x7A, 0x94, 0x6D, 0x62, 
-    0x7E, 0x67, 0x93, 0x72, 0x76, 0xAB, 0x83, 0x95, 0x8B, 0x98, 0x82, 0x5B, 
-    0x67, 0x6A, 0x72, 0x89, 0x95, 0x8C, 0x87, 0x87, 0x91, 0x7F, 0x87, 0x7D, 
-    0x80, 0x57, 0x54, 0x76, 0x6A, 0x77, 0x65, 0x93, 0x8E, 0x53, 0xA7, 0x6B, 
-    0x7C, 0xA5, 0x88, 0x99, 0x82, 0xA5, 0x5C, 0x69, 0x85, 0x95, 0x94, 0x78, 
-    0x9A, 0x70, 0x58, 0xAF, 0x95, 0x87, 0x4A, 0x7E, 0x69, 0x65, 0x8C, 0xA7, 
-    0x70, 0x64, 0x80, 0xA7, 0x8E, 0x9A, 0x93, 0x8D, 0x68, 0x5D, 0x80, 0x77, 
-    0x83, 0x6E, 0xA2, 0x85, 0x97, 0x8A, 0x5A, 0x88, 0x98, 0x8A, 0x80, 0x94, 
-    0x66, 0x65, 0x7F, 0x6A, 0x7E, 0x70, 0x92, 0x9E, 0x80, 0x95, 0x8D, 0x9B, 
-    0x73, 0x8B, 0x81, 0x47, 0x70, 0x7A, 0x99, 0x7D, 0x86, 0x85, 0x80, 0x84, 
-    0x7C, 0x7D, 0x86, 0x59, 0x51, 0x67, 0x6B, 0x75, 0x70, 0x78, 0x75, 0x82, 
-    0x7E, 0x78, 0x97, 0xAC, 0x8D, 0x9C, 0x8C, 0xA2, 0x73, 0x6A, 0x7F, 0x9C, 
-    0x93, 0x81, 0xA0, 0x69, 0x65, 0xB6, 0x84, 0x94, 0x67, 0x5E, 0x78, 0x63, 
-    0x85, 0x6B, 0x89, 0x6E, 0x81, 0xB0, 0x7F, 0xA8, 0x8B, 0x8E, 0x6C, 0x58, 
-    0x84, 0x6F, 0x8C, 0x61, 0x9D, 0x9B, 0x86, 0x88, 0x54, 0x91, 0x97, 0x89, 
-    0x83, 0x8F, 0x72, 0x5E, 0x7D, 0x6A, 0x7A, 0x70, 0x92, 0x93, 0x7F, 0x93, 
-    0x8D, 0x90, 0x7B, 0x7D, 0x8A, 0x58, 0x5C, 0x6F, 0x67, 0x9B, 0x82, 0x86, 
-    0x85, 0x85, 0x8B, 0x75, 0x93, 0x54, 0x59, 0x73, 0x63, 0x7D, 0x6F, 0x83, 
-    0x7D, 0x77, 0x81, 0x78, 0xAE, 0x9D, 0x92, 0x9A, 0x89, 0xAA, 0x73, 0x68, 
-    0x7F, 0x98, 0x94, 0x7A, 0xA0, 0x72, 0x63, 0xAC, 0x8B, 0x8D, 0x85, 0x57, 
-    0x6F, 0x69, 0x7B, 0x72, 0x7E, 0x73, 0x94, 0x9F, 0x83, 0x9C, 0x95, 0x88, 
-    0x56, 0x6D, 0x75, 0x76, 0x8A, 0x63, 0x9E, 0x9A, 0x88, 0x75, 0x5E, 0xA0, 
-    0x94, 0x89, 0x82, 0x94, 0x7B, 0x55, 0x81, 0x68, 0x79, 0x6E, 0x86, 0x97, 
-    0x81, 0x99, 0x8A, 0x8D, 0x80, 0x7E, 0x87, 0x72, 0x52, 0x6C, 0x62, 0x82, 
-    0x99, 0x7F, 0x8F, 0x81, 0x89, 0x7D, 0x86, 0x58, 0x5D, 0x75, 0x67, 0x73, 
-    0x78, 0x80, 0x7E, 0x7E, 0x78, 0x7F, 0xB6, 0x90, 0x96, 0x98, 0x8B, 0xA5, 
-    0x77, 0x65, 0x78, 0x98, 0x92, 0x7D, 0x97, 0x86, 0x5C, 0x8B, 0x9D, 0x82, 
-    0x93, 0x59, 0x66, 0x70, 0x6E, 0x7E, 0x72, 0x7A, 0x98, 0x91, 0x8B, 0x8C, 
-    0xA0, 0x85, 0x4C, 0x7A, 0x6E, 0x77, 0x86, 0x6F, 0x96, 0x9F, 0x8A, 0x6A, 
-    0x6C, 0xA6, 0x93, 0x8A, 0x84, 0x95, 0x87, 0x51, 0x7F, 0x6E, 0x75, 0x6F, 
-    0x77, 0x9C, 0x87, 0x9A, 0x8C, 0x8A, 0x88, 0x7C, 0x84, 0x7F, 0x54, 0x67, 
-    0x64, 0x83, 0x99, 0x7B, 0x92, 0x80, 0x87, 0x7E, 0x82, 0x57, 0x5E, 0x72, 
-    0x66, 0x71, 0x77, 0x7F, 0x7C, 0x7E, 0x76, 0x85, 0xB4, 0x8C, 0x98, 0x93, 
-    0x8D, 0xA1, 0x7E, 0x62, 0x74, 0x91, 0x96, 0x7D, 0x96, 0x86, 0x5A, 0x9D, 
-    0x8F, 0x87, 0x8B, 0x7E, 0x56, 0x60, 0x75, 0x72, 0x7A, 0x6C, 0x95, 0x98, 
-    0x84, 0x93, 0x97, 0x89, 0x48, 0x80, 0x6E, 0x6F, 0x8C, 0x74, 0x87, 0xAA, 
-    0x8B, 0x65, 0x7C, 0xAB, 0x8F, 0x8C, 0x88, 0x96, 0x8A, 0x52, 0x7F, 0x74, 
-    0x73, 0x71, 0x7F, 0x94, 0x8A, 0x9A, 0x8B, 0x86, 0x8D, 0x7B, 0x84, 0x81, 
-    0x4D, 0x6A, 0x66, 0x7E, 0x9B, 0x7B, 0x90, 0x81, 0x86, 0x7C, 0x85, 0x59, 
-    0x5A, 0x75, 0x64, 0x72, 0x77, 0x7E, 0x7B, 0x7E, 0x74, 0x88, 0xB3, 0x88, 
-    0x99, 0x91, 0x90, 0x99, 0x8F, 0x64, 0x65, 0x94, 0x90, 0x82, 0x8C, 0x8E, 
-    0x75, 0x8A, 0x8B, 0x82, 0x87, 0x82, 0x53, 0x59, 0x6E, 0x70, 0x7A, 0x66, 
-    0x9A, 0x97, 0x84, 0x90, 0x92, 0x90, 0x48, 0x7E, 0x72, 0x6E, 0x89, 0x79, 
-    0x85, 0x7F, 0xA1, 0x7D, 0x78, 0xB1, 0x91, 0x97, 0x8A, 0x96, 0x9B, 0x5A, 
-    0x78, 0x75, 0x72, 0x75, 0x73, 0x91, 0x94, 0x93, 0x93, 0x81, 0x90, 0x83, 
-    0x81, 0x80, 0x4B, 0x6E, 0x6A, 0x6F, 0xA0, 0x7E, 0x8D, 0x81, 0x85, 0x7D, 
-    0x85, 0x61, 0x53, 0x75, 0x62, 0x70, 0x78, 0x7A, 0x7A, 0x7D, 0x75, 0x7C, 
-    0xB3, 0x8B, 0x93, 0x95, 0x8B, 0x96, 0x91, 0x66, 0x61, 0x96, 0x8F, 0x80, 
-    0x89, 0x8D, 0x7E, 0x73, 0x95, 0x7E, 0x88, 0x84, 0x52, 0x5D, 0x6A, 0x72, 
-    0x79, 0x66, 0xA1, 0x90, 0x88, 0x8C, 0x92, 0x96, 0x47, 0x7B, 0x74, 0x6D, 
-    0x88, 0x79, 0x89, 0x74, 0xA3, 0x86, 0x75, 0xBB, 0x8B, 0x9D, 0x89, 0x94, 
-    0xA0, 0x63, 0x72, 0x77, 0x73, 0x77, 0x70, 0x9C, 0x94, 0x91, 0x95, 0x80, 
-    0x91, 0x85, 0x81, 0x83, 0x4C, 0x68, 0x6E, 0x6A, 0x9E, 0x83, 0x8C, 0x7F, 
-    0x86, 0x7F, 0x84, 0x64, 0x53, 0x73, 0x64, 0x6F, 0x78, 0x7B, 0x79, 0x7E, 
-    0x73, 0x7D, 0xB2, 0x8A, 0x92, 0x93, 0x8C, 0x92, 0x93, 0x75, 0x54, 0x8F, 
-    0x90, 0x82, 0x85, 0x8D, 0x78, 0x6B, 0x9C, 0x7C, 0x87, 0x87, 0x5A, 0x59, 
-    0x69, 0x72, 0x79, 0x6B, 0xA3, 0x8C, 0x8A, 0x87, 0x96, 0x94, 0x45, 0x7B, 
-    0x73, 0x6D, 0x83, 0x7F, 0x86, 0x79, 0x8D, 0x82, 0xA4, 0xA5, 0x8C, 0x9A, 
-    0x8C, 0x94, 0x96, 0x7F, 0x5D, 0x7D, 0x6E, 0x70, 0x78, 0x8D, 0xA4, 0x8A, 
-    0x8D, 0x85, 0x8C, 0x8A, 0x7B, 0x8F, 0x49, 0x60, 0x77, 0x62, 0xA2, 0x84, 
-    0x8D, 0x7C, 0x84, 0x83, 0x82, 0x66, 0x52, 0x74, 0x63, 0x6C, 0x7B, 0x7A, 
-    0x7B, 0x7D, 0x74, 0x7D, 0xB2, 0x8E, 0x91, 0x96, 0x8B, 0x94, 0x8E, 0x8C, 
-    0x52, 0x79, 0x97, 0x83, 0x86, 0x89, 0x7D, 0x74, 0x92, 0x81, 0x82, 0x89, 
-    0x6B, 0x49, 0x6D, 0x68, 0x7A, 0x6C, 0x9D, 0x90, 0x87, 0x87, 0x93, 0x91, 
-    0x47, 0x7A, 0x76, 0x6C, 0x7F, 0x83, 0x85, 0x7E, 0x84, 0x9A, 0xA3, 0x9A, 
-    0x90, 0x97, 0x8C, 0x94, 0x8E, 0x94, 0x6B, 0x61, 0x74, 0x67, 0x7F, 0x72, 
-    0x91, 0x95, 0x8B, 0x91, 0x85, 0x94, 0x82, 0x89, 0x5A, 0x52, 0x7C, 0x63, 
-    0xA2, 0x87, 0x8B, 0x86, 0x82, 0x8B, 0x80, 0x68, 0x52, 0x73, 0x67, 0x69, 
-    0x7C, 0x7D, 0x7C, 0x79, 0x7C, 0x71, 0xA7, 0x9D, 0x89, 0x9B, 0x88, 0x98, 
-    0x8C, 0x92, 0x5B, 0x6B, 0x9F, 0x7E, 0x89, 0x83, 0x89, 0x86, 0x7C, 0x85, 
-    0x7C, 0x88, 0x72, 0x40, 0x6D, 0x60, 0x7C, 0x68, 0x96, 0x96, 0x83, 0x89, 
-    0x8C, 0x88, 0x4C, 0x78, 0x75, 0x6F, 0x7D, 0x81, 0x89, 0x7D, 0x84, 0x97, 
-    0x9C, 0x9E, 0x92, 0x99, 0x8F, 0x97, 0x92, 0x91, 0x83, 0x56, 0x74, 0x6A, 
-    0x7B, 0x74, 0x7D, 0xA5, 0x8D, 0x8F, 0x88, 0x8F, 0x8B, 0x82, 0x64, 0x4E, 
-    0x7A, 0x68, 0x9C, 0x8C, 0x88, 0x8B, 0x81, 0x8A, 0x7F, 0x77, 0x4B, 0x70, 
-    0x6B, 0x64, 0x7B, 0x7C, 0x7D, 0x76, 0x7D, 0x70, 0x9A, 0xA8, 0x84, 0x9E, 
-    0x86, 0x96, 0x8E, 0x92, 0x63, 0x64, 0xA4, 0x7A, 0x89, 0x82, 0x89, 0x8D, 
-    0x76, 0x84, 0x7A, 0x85, 0x79, 0x3E, 0x6B, 0x5D, 0x7B, 0x67, 0x8E, 0x9D, 
-    0x7F, 0x8B, 0x88, 0x89, 0x4E, 0x75, 0x78, 0x6E, 0x7C, 0x7F, 0x8B, 0x7C, 
-    0x87, 0x87, 0x97, 0xAD, 0x8E, 0x9D, 0x8F, 0x9B, 0x96, 0x8C, 0x94, 0x57, 
-    0x71, 0x6D, 0x77, 0x79, 0x76, 0xAF, 0x89, 0x8C, 0x8C, 0x8C, 0x8D, 0x81, 
-    0x6C, 0x47, 0x79, 0x66, 0x92, 0x95, 0x83, 0x90, 0x7C, 0x8A, 0x7F, 0x7D, 
-    0x4C, 0x69, 0x70, 0x5F, 0x7A, 0x7C, 0x7C, 0x78, 0x7B, 0x70, 0x8F, 0xAE, 
-    0x83, 0x9D, 0x89, 0x92, 0x90, 0x90, 0x74, 0x56, 0xA4, 0x7D, 0x85, 0x84, 
-    0x84, 0x91, 0x75, 0x83, 0x7C, 0x7F, 0x84, 0x3E, 0x67, 0x5F, 0x75, 0x6C, 
-    0x88, 0x9F, 0x80, 0x8B, 0x89, 0x83, 0x51, 0x75, 0x78, 0x70, 0x79, 0x82, 
-    0x8B, 0x7F, 0x89, 0x85, 0x9E, 0xAB, 0x8F, 0x9D, 0x90, 0x9C, 0x97, 0x89, 
-    0x99, 0x73, 0x5A, 0x70, 0x73, 0x79, 0x72, 0xA0, 0x76, 0x85, 0xA2, 0x86, 
-    0x92, 0x87, 0x76, 0x4B, 0x76, 0x69, 0x8E, 0xA0, 0x7E, 0x94, 0x7E, 0x89, 
-    0x87, 0x85, 0x54, 0x5B, 0x76, 0x59, 0x7A, 0x7C, 0x79, 0x7C, 0x75, 0x75, 
-    0x7C, 0xB1, 0x89, 0x92, 0x8E, 0x87, 0x97, 0x87, 0x8F, 0x51, 0x8D, 0x8E, 
-    0x78, 0x8C, 0x7D, 0x8B, 0x7A, 0x7E, 0x80, 0x76, 0x8E, 0x47, 0x5C, 0x68, 
-    0x68, 0x74, 0x88, 0x9C, 0x83, 0x89, 0x8A, 0x74, 0x5A, 0x75, 0x7F, 0x71, 
-    0x72, 0x86, 0x89, 0x82, 0x87, 0x85, 0xA2, 0xA3, 0x93, 0x98, 0x91, 0x9F, 
-    0x93, 0x90, 0x8C, 0x93, 0x61, 0x5A, 0x7D, 0x6E, 0x77, 0x80, 0x78, 0x86, 
-    0xA4, 0x8F, 0x8C, 0x92, 0x7E, 0x4D, 0x78, 0x64, 0x8D, 0xA3, 0x7F, 0x93, 
-    0x84, 0x8A, 0x88, 0x84, 0x83, 0x48, 0x68, 0x60, 0x6D, 0x7F, 0x6C, 0x84, 
-    0x6D, 0x75, 0x76, 0x89, 0xA7, 0x89, 0x95, 0x85, 0x90, 0x8E, 0x93, 0x62, 
-    0x6C, 0xA5, 0x75, 0x89, 0x86, 0x82, 0x87, 0x7B, 0x82, 0x71, 0x90, 0x5B, 
-    0x4B, 0x74, 0x5E, 0x74, 0x88, 0x99, 0x86, 0x86, 0x8E, 0x66, 0x62, 0x70, 
-    0x9B, 0x70, 0x60, 0x8B, 0x81, 0x84, 0x7F, 0x84, 0xA2, 0x97, 0x92, 0x97, 
-    0x93, 0xA1, 0x91, 0x95, 0x84, 0x97, 0x74, 0x4F, 0x80, 0x6E, 0x74, 0x7A, 
-    0x7C, 0x84, 0xA2, 0x95, 0x8A, 0x92, 0x86, 0x50, 0x78, 0x66, 0x85, 0xA8, 
-    0x82, 0x8F, 0x89, 0x8A, 0x89, 0x83, 0x88, 0x66, 0x52, 0x67, 0x67, 0x7F, 
-    0x6C, 0x7B, 0x76, 0x6B, 0x7C, 0x79, 0xA0, 0x9B, 0x8A, 0x8F, 0x89, 0x8F, 
-    0x96, 0x6E, 0x61, 0xA5, 0x7E, 0x80, 0x89, 0x87, 0x87, 0x7B, 0x84, 0x6F, 
-    0x8C, 0x66, 0x44, 0x76, 0x5E, 0x6F, 0x8A, 0x97, 0x86, 0x85, 0x8F, 0x61, 
-    0x63, 0x70, 0xA1, 0x8A, 0x4A, 0x89, 0x7E, 0x83, 0x7B, 0x81, 0x90, 0x7D, 
-    0xA1, 0x9B, 0x94, 0xA8, 0x93, 0x9A, 0x84, 0x92, 0x8B, 0x51, 0x7A, 0x71, 
-    0x74, 0x76, 0x82, 0x82, 0x98, 0x9E, 0x89, 0x8D, 0x8B, 0x56, 0x75, 0x69, 
-    0x7D, 0xA8, 0x85, 0x8E, 0x88, 0x8C, 0x81, 0x88, 0x81, 0x7B, 0x5A, 0x55, 
-    0x6D, 0x75, 0x72, 0x71, 0x79, 0x6B, 0x74, 0x7E, 0x83, 0xA8, 0x8E, 0x8B, 
-    0x90, 0x87, 0x98, 0x7C, 0x5B, 0xA0, 0x86, 0x80, 0x84, 0x8B, 0x87, 0x7A, 
-    0x89, 0x6F, 0x87, 0x71, 0x40, 0x76, 0x62, 0x69, 0x8C, 0x97, 0x84, 0x86, 
-    0x8F, 0x62, 0x60, 0x76, 0x97, 0x9C, 0x50, 0x75, 0x86, 0x7D, 0x7D, 0x7E, 
-    0x87, 0x7E, 0xA2, 0x9C, 0x91, 0xA9, 0x98, 0x95, 0x8B, 0x88, 0x97, 0x61, 
-    0x66, 0x78, 0x70, 0x76, 0x80, 0x80, 0x90, 0xA2, 0x8D, 0x89, 0x92, 0x5D, 
-    0x6D, 0x71, 0x75, 0xA8, 0x88, 0x8F, 0x87, 0x8E, 0x82, 0x85, 0x88, 0x77, 
-    0x79, 0x45, 0x67, 0x76, 0x6F, 0x72, 0x71, 0x73, 0x6A, 0x83, 0x75, 0x8E, 
-    0xAC, 0x80, 0x97, 0x87, 0x91, 0x93, 0x59, 0x9A, 0x8B, 0x81, 0x83, 0x84, 
-    0x8F, 0x74, 0x8E, 0x76, 0x7C, 0x7C, 0x3E, 0x71, 0x66, 0x65, 0x8C, 0x96, 
-    0x86, 0x83, 0x91, 0x60, 0x5D, 0x7C, 0x92, 0x9D, 0x5A, 0x69, 0x89, 0x7B, 
-    0x7D, 0x7D, 0x84, 0x82, 0x8D, 0x9F, 0x98, 0xA5, 0x9E, 0x90, 0x92, 0x86, 
-    0x96, 0x7E, 0x56, 0x7A, 0x6D, 0x76, 0x7E, 0x7C, 0x93, 0xA0, 0x8F, 0x87, 
-    0x91, 0x64, 0x68, 0x76, 0x6F, 0xA6, 0x8A, 0x8F, 0x88, 0x8F, 0x85, 0x7E, 
-    0x8C, 0x74, 0x81, 0x48, 0x5F, 0x7A, 0x6B, 0x74, 0x6F, 0x74, 0x6B, 0x7D, 
-    0x7C, 0x7A, 0xB1, 0x89, 0x90, 0x90, 0x88, 0xA1, 0x67, 0x88, 0x95, 0x7C, 
-    0x89, 0x7D, 0x91, 0x76, 0x87, 0x7F, 0x74, 0x80, 0x40, 0x6B, 0x6B, 0x60, 
-    0x8F, 0x94, 0x86, 0x83, 0x8F, 0x5B, 0x5C, 0x84, 0x91, 0x97, 0x62, 0x63, 
-    0x89, 0x7A, 0x7E, 0x7E, 0x82, 0x7E, 0x84, 0x98, 0xA4, 0xA5, 0xA1, 0x90, 
-    0x94, 0x8A, 0x8F, 0x92, 0x57, 0x72, 0x73, 0x71, 0x82, 0x7A, 0x8F, 0xA1, 
-    0x8F, 0x87, 0x90, 0x67, 0x67, 0x77, 0x6E, 0xA2, 0x8B, 0x90, 0x87, 0x8E, 
-    0x88, 0x79, 0x8D, 0x73, 0x84, 0x4D, 0x58, 0x7B, 0x69, 0x73, 0x6E, 0x74, 
-    0x6D, 0x78, 0x80, 0x71, 0xA9, 0x94, 0x8A, 0x95, 0x84, 0xA1, 0x77, 0x7D, 
-    0x98, 0x7B, 0x8A, 0x7C, 0x8D, 0x7C, 0x81, 0x85, 0x73, 0x80, 0x44, 0x66, 
-    0x6E, 0x5E, 0x8F, 0x93, 0x87, 0x84, 0x8C, 0x5A, 0x5D, 0x86, 0x92, 0x94, 
-    0x6E, 0x5C, 0x88, 0x7A, 0x7E, 0x7F, 0x81, 0x7C, 0x82, 0x89, 0xAB, 0xAA, 
-    0xA1, 0x92, 0x94, 0x90, 0x89, 0x9E, 0x65, 0x64, 0x7B, 0x6C, 0x83, 0x7C, 
-    0x85, 0xA3, 0x92, 0x85, 0x90, 0x69, 0x69, 0x77, 0x6E, 0x9E, 0x8B, 0x92, 
-    0x86, 0x8C, 0x8B, 0x76, 0x8E, 0x72, 0x84, 0x58, 0x4D, 0x7D, 0x67, 0x73, 
-    0x6C, 0x74, 0x6E, 0x73, 0x82, 0x6E, 0x9D, 0x9E, 0x86, 0x97, 0x84, 0x9C, 
-    0x85, 0x7D, 0x93, 0x7E, 0x88, 0x7D, 0x89, 0x7E, 0x7E, 0x85, 0x76, 0x7B, 
-    0x46, 0x65, 0x6E, 0x5F, 0x91, 0x90, 0x88, 0x85, 0x8B, 0x5A, 0x5D, 0x83, 
-    0x93, 0x94, 0x75, 0x5A, 0x87, 0x7B, 0x7E, 0x80, 0x80, 0x7A, 0x84, 0x82, 
-    0xAA, 0xB1, 0x9F, 0x97, 0x94, 0x93, 0x88, 0x9E, 0x76, 0x59, 0x7D, 0x6B, 
-    0x81, 0x7E, 0x7E, 0xA3, 0x96, 0x84, 0x91, 0x69, 0x6A, 0x76, 0x6F, 0x9C, 
-    0x89, 0x94, 0x87, 0x8B, 0x8D, 0x76, 0x8C, 0x73, 0x83, 0x61, 0x46, 0x7D, 
-    0x67, 0x73, 0x6A, 0x72, 0x70, 0x70, 0x82, 0x6F, 0x92, 0xA3, 0x86, 0x96, 
-    0x86, 0x97, 0x8D, 0x83, 0x8B, 0x81, 0x85, 0x7F, 0x85, 0x80, 0x7D, 0x84, 
-    0x78, 0x7A, 0x48, 0x63, 0x6D, 0x61, 0x98, 0x87, 0x8B, 0x83, 0x8C, 0x5C, 
-    0x59, 0x82, 0x93, 0x94, 0x7A, 0x58, 0x87, 0x7A, 0x7F, 0x7F, 0x7F, 0x7B, 
-    0x85, 0x7F, 0xA3, 0xB8, 0x9E, 0x9A, 0x94, 0x94, 0x8B, 0x9A, 0x88, 0x54, 
-    0x79, 0x70, 0x7D, 0x82, 0x79, 0xA0, 0x9B, 0x82, 0x93, 0x6D, 0x69, 0x77, 
-    0x70, 0x9D, 0x85, 0x95, 0x89, 0x88, 0x8F, 0x76, 0x8A, 0x75, 0x81, 0x6A, 
-    0x40, 0x7A, 0x68, 0x72, 0x6A, 0x70, 0x72, 0x6E, 0x81, 0x72, 0x87, 0xA7, 
-    0x88, 0x94, 0x88, 0x94, 0x92, 0x84, 0x8A, 0x83, 0x85, 0x81, 0x83, 0x82, 
-    0x7B, 0x84, 0x78, 0x7D, 0x4B, 0x5F, 0x6C, 0x66, 0x9F, 0x7D, 0x8D, 0x80, 
-    0x8C, 0x5C, 0x55, 0x82, 0x91, 0x93, 0x7B, 0x57, 0x86, 0x79, 0x7F, 0x7C, 
-    0x7E, 0x7C, 0x83, 0x7F, 0x9B, 0xBE, 0x9E, 0x9C, 0x95, 0x93, 0x8F, 0x95, 
-    0x95, 0x59, 0x6F, 0x77, 0x78, 0x85, 0x77, 0x92, 0xA1, 0x85, 0x94, 0x6F, 
-    0x69, 0x7B, 0x6E, 0xA0, 0x82, 0x95, 0x8D, 0x85, 0x90, 0x78, 0x89, 0x79, 
-    0x7F, 0x6F, 0x3E, 0x78, 0x68, 0x72, 0x69, 0x6E, 0x75, 0x6D, 0x7E, 0x75, 
-    0x81, 0xA5, 0x8C, 0x92, 0x8A, 0x91, 0x94, 0x83, 0x89, 0x84, 0x84, 0x81, 
-    0x81, 0x82, 0x7B, 0x83, 0x79, 0x7D, 0x4B, 0x5F, 0x6A, 0x6F, 0x9F, 0x78, 
-    0x8E, 0x7E, 0x8C, 0x5B, 0x53, 0x83, 0x91, 0x90, 0x7B, 0x56, 0x84, 0x78, 
-    0x7F, 0x7A, 0x7D, 0x7E, 0x81, 0x80, 0x95, 0xC0, 0xA0, 0x9B, 0x96, 0x93, 
-    0x93, 0x92, 0x9A, 0x66, 0x64, 0x7C, 0x79, 0x84, 0x77, 0x85, 0x9D, 0x8E, 
-    0x91, 0x72, 0x67, 0x81, 0x6D, 0xA1, 0x84, 0x92, 0x92, 0x84, 0x8F, 0x7B, 
-    0x88, 0x7C, 0x7F, 0x76, 0x3D, 0x75, 0x69, 0x70, 0x6C, 0x6A, 0x76, 0x6D, 
-    0x7C, 0x78, 0x7C, 0xA3, 0x90, 0x8E, 0x8B, 0x8E, 0x96, 0x83, 0x89, 0x85, 
-    0x83, 0x82, 0x80, 0x82, 0x7B, 0x82, 0x7A, 0x7E, 0x4D, 0x5C, 0x6B, 0x75, 
-    0x9B, 0x77, 0x8C, 0x7F, 0x8A, 0x5A, 0x52, 0x85, 0x93, 0x8B, 0x7F, 0x55, 
-    0x82, 0x79, 0x7D, 0x79, 0x7B, 0x7F, 0x7E, 0x83, 0x8C, 0xC0, 0xA6, 0x99, 
-    0x98, 0x93, 0x95, 0x92, 0x99, 0x79, 0x5D, 0x80, 0x7C, 0x7D, 0x78, 0x7D, 
-    0x9C, 0x90, 0x8E, 0x73, 0x63, 0x86, 0x6C, 0xA2, 0x86, 0x8E, 0x95, 0x83, 
-    0x8E, 0x7D, 0x89, 0x7C, 0x7F, 0x7C, 0x3D, 0x74, 0x6C, 0x6E, 0x6E, 0x68, 
-    0x77, 0x6E, 0x7A, 0x79, 0x7A, 0xA2, 0x92, 0x8E, 0x8D, 0x8D, 0x97, 0x83, 
-    0x88, 0x85, 0x84, 0x83, 0x81, 0x83, 0x7B, 0x81, 0x7A, 0x7D, 0x4F, 0x59, 
-    0x6E, 0x79, 0x95, 0x79, 0x89, 0x81, 0x85, 0x58, 0x52, 0x8B, 0x95, 0x84, 
-    0x81, 0x53, 0x81, 0x78, 0x7B, 0x79, 0x7A, 0x80, 0x7B, 0x85, 0x88, 0xBF, 
-    0xAA, 0x95, 0x9A, 0x93, 0x96, 0x95, 0x96, 0x85, 0x64, 0x88, 0x7A, 0x70, 
-    0x7B, 0x75, 0x9C, 0x8E, 0x8D, 0x71, 0x61, 0x87, 0x6A, 0xA4, 0x86, 0x8C, 
-    0x93, 0x80, 0x8F, 0x7F, 0x8A, 0x7E, 0x7E, 0x80, 0x3F, 0x72, 0x6D, 0x6D, 
-    0x6F, 0x65, 0x77, 0x71, 0x7B, 0x7C, 0x7A, 0xA2, 0x94, 0x8E, 0x8E, 0x8C, 
-    0x98, 0x84, 0x88, 0x86, 0x84, 0x83, 0x80, 0x83, 0x7B, 0x81, 0x7B, 0x7C, 
-    0x56, 0x57, 0x71, 0x71, 0x91, 0x7E, 0x84, 0x85, 0x80, 0x58, 0x53, 0x95, 
-    0x93, 0x80, 0x85, 0x4F, 0x81, 0x76, 0x7B, 0x7B, 0x79, 0x80, 0x78, 0x88, 
-    0x82, 0xBE, 0xAD, 0x90, 0x9D, 0x92, 0x97, 0x96, 0x95, 0x88, 0x82, 0x8E, 
-    0x69, 0x66, 0x7A, 0x6F, 0x9B, 0x8A, 0x8A, 0x6A, 0x61, 0x82, 0x6B, 0xA5, 
-    0x84, 0x8C, 0x8B, 0x7F, 0x92, 0x80, 0x8D, 0x80, 0x7B, 0x82, 0x46, 0x6E, 
-    0x6E, 0x6E, 0x70, 0x64, 0x78, 0x75, 0x7D, 0x7E, 0x7A, 0xA4, 0x95, 0x8E, 
-    0x92, 0x8D, 0x99, 0x86, 0x89, 0x86, 0x86, 0x84, 0x80, 0x84, 0x7B, 0x81, 
-    0x7C, 0x7C, 0x5F, 0x54, 0x6E, 0x67, 0x8D, 0x86, 0x80, 0x8B, 0x78, 0x55, 
-    0x5F, 0xA2, 0x8A, 0x80, 0x84, 0x4C, 0x7F, 0x74, 0x7D, 0x7B, 0x7A, 0x7E, 
-    0x76, 0x8A, 0x80, 0xC0, 0xA8, 0x8B, 0xA0, 0x90, 0x97, 0x98, 0x94, 0x86, 
-    0x85, 0x91, 0x5F, 0x66, 0x79, 0x6F, 0xA5, 0x7D, 0x8E, 0x5E, 0x69, 0x7D, 
-    0x6E, 0xA8, 0x7C, 0x90, 0x84, 0x81, 0x92, 0x7E, 0x8F, 0x7B, 0x7B, 0x82, 
-    0x4E, 0x69, 0x6E, 0x70, 0x6D, 0x66, 0x78, 0x77, 0x7C, 0x7F, 0x7B, 0xA7, 
-    0x95, 0x8F, 0x94, 0x8D, 0x98, 0x87, 0x8A, 0x87, 0x89, 0x85, 0x81, 0x86, 
-    0x7B, 0x82, 0x7D, 0x7C, 0x65, 0x50, 0x6B, 0x61, 0x8A, 0x8E, 0x7E, 0x91, 
-    0x6A, 0x54, 0x7B, 0xA4, 0x81, 0x86, 0x7F, 0x4D, 0x7C, 0x77, 0x7D, 0x7C, 
-    0x7B, 0x79, 0x78, 0x89, 0x82, 0xC2, 0xA0, 0x8B, 0xA0, 0x8D, 0x98, 0x9A, 
-    0x90, 0x85, 0x86, 0x8F, 0x56, 0x6F, 0x70, 0x83, 0xA5, 0x72, 0x90, 0x4E, 
-    0x78, 0x6F, 0x79, 0xA5, 0x76, 0x96, 0x7A, 0x89, 0x8C, 0x7F, 0x8F, 0x73, 
-    0x7F, 0x7E, 0x56, 0x64, 0x70, 0x6F, 0x6A, 0x68, 0x76, 0x7A, 0x7B, 0x7F, 
-    0x7C, 0xAA, 0x93, 0x92, 0x94, 0x8D, 0x97, 0x88, 0x8A, 0x87, 0x89, 0x84, 
-    0x80, 0x87, 0x7C, 0x83, 0x7E, 0x7C, 0x66, 0x4D, 0x6C, 0x5F, 0x8C, 0x8F, 
-    0x81, 0x90, 0x54, 0x66, 0x93, 0x99, 0x7F, 0x8A, 0x77, 0x4E, 0x7E, 0x78, 
-    0x7D, 0x7F, 0x7A, 0x78, 0x7C, 0x88, 0x89, 0xC1, 0x97, 0x8F, 0x9E, 0x8B, 
-    0x9E, 0x97, 0x8D, 0x86, 0x89, 0x87, 0x50, 0x77, 0x6D, 0x9E, 0x8E, 0x7B, 
-    0x82, 0x4A, 0x83, 0x62, 0x8C, 0x99, 0x79, 0x95, 0x74, 0x93, 0x82, 0x88, 
-    0x87, 0x70, 0x82, 0x78, 0x5A, 0x62, 0x72, 0x6C, 0x6A, 0x69, 0x77, 0x7B, 
-    0x7A, 0x7E, 0x80, 0xAC, 0x90, 0x95, 0x93, 0x8F, 0x95, 0x87, 0x8A, 0x88, 
-    0x89, 0x84, 0x81, 0x88, 0x7C, 0x85, 0x7D, 0x7D, 0x62, 0x4E, 0x6D, 0x60, 
-    0x97, 0x87, 0x8A, 0x7D, 0x4B, 0x80, 0x97, 0x92, 0x7F, 0x8F, 0x6B, 0x52, 
-    0x84, 0x76, 0x82, 0x7C, 0x7A, 0x78, 0x7D, 0x8B, 0x8D, 0xBE, 0x91, 0x95, 
-    0x99, 0x8D, 0xA2, 0x92, 0x8D, 0x87, 0x89, 0x81, 0x53, 0x75, 0x74, 0xA5, 
-    0x7E, 0x84, 0x6C, 0x55, 0x81, 0x5F, 0x9C, 0x8C, 0x81, 0x8D, 0x78, 0x92, 
-    0x7C, 0x8F, 0x7B, 0x74, 0x81, 0x76, 0x5C, 0x61, 0x73, 0x69, 0x6B, 0x68, 
-    0x7A, 0x79, 0x7B, 0x7C, 0x87, 0xAD, 0x8D, 0x98, 0x90, 0x91, 0x93, 0x87, 
-    0x8C, 0x87, 0x8B, 0x83, 0x82, 0x88, 0x7B, 0x87, 0x7B, 0x7E, 0x61, 0x51, 
-    0x68, 0x6C, 0x9D, 0x7D, 0x8E, 0x66, 0x53, 0x8A, 0x97, 0x8B, 0x82, 0x8E, 
-    0x58, 0x62, 0x82, 0x78, 0x85, 0x77, 0x7D, 0x75, 0x84, 0x8B, 0x94, 0xBD, 
-    0x8B, 0x9C, 0x92, 0x93, 0xA3, 0x8D, 0x8E, 0x85, 0x8D, 0x79, 0x58, 0x74, 
-    0x7D, 0xA3, 0x78, 0x86, 0x57, 0x68, 0x77, 0x6A, 0xA7, 0x7E, 0x8B, 0x82, 
-    0x80, 0x8B, 0x7E, 0x8F, 0x72, 0x7A, 0x7E, 0x70, 0x57, 0x69, 0x70, 0x68, 
-    0x6A, 0x6B, 0x7E, 0x76, 0x7F, 0x79, 0x91, 0xAA, 0x8B, 0x9B, 0x8C, 0x95, 
-    0x8F, 0x87, 0x8C, 0x87, 0x8B, 0x80, 0x86, 0x85, 0x7C, 0x87, 0x79, 0x7D, 
-    0x66, 0x59, 0x64, 0x80, 0x92, 0x79, 0x8A, 0x55, 0x5B, 0x89, 0x99, 0x81, 
-    0x8A, 0x7F, 0x4E, 0x74, 0x77, 0x7E, 0x80, 0x78, 0x7F, 0x76, 0x8C, 0x86, 
-    0xAC, 0xB2, 0x89, 0xA3, 0x8B, 0x9D, 0x9D, 0x8F, 0x8D, 0x89, 0x89, 0x83, 
-    0x61, 0x68, 0x77, 0x9C, 0x83, 0x7A, 0x56, 0x73, 0x70, 0x7F, 0xA0, 0x7F, 
-    0x8F, 0x7F, 0x86, 0x81, 0x84, 0x8B, 0x77, 0x7B, 0x7E, 0x67, 0x55, 0x70, 
-    0x6D, 0x69, 0x67, 0x71, 0x7C, 0x75, 0x81, 0x7D, 0x7D, 0xAE, 0x91, 0x97, 
-    0x8F, 0x95, 0x93, 0x84, 0x8F, 0x88, 0x88, 0x85, 0x83, 0x85, 0x7C, 0x85, 
-    0x7E, 0x77, 0x7C, 0x67, 0x5A, 0x5D, 0x80, 0x8E, 0x7D, 0x86, 0x7D, 0x85, 
-    0x61, 0x5C, 0x6B, 0x66, 0x73, 0x6D, 0x7A, 0x7E, 0x85, 0x8A, 0x81, 0x86, 
-    0x87, 0x82, 0xAB, 0xAA, 0x9D, 0xA3, 0x9E, 0x9E, 0x91, 0x93, 0x90, 0x8A, 
-    0x87, 0x83, 0x87, 0x88, 0x7F, 0x4F, 0x69, 0x67, 0x6A, 0x6C, 0x71, 0x9D, 
-    0x8C, 0x87, 0x8A, 0x85, 0x8B, 0x7A, 0x87, 0x77, 0x80, 0x83, 0x84, 0x55, 
-    0x5A, 0x74, 0x66, 0x70, 0x69, 0x77, 0x77, 0x77, 0x83, 0x79, 0xAA, 0x9C, 
-    0x7D, 0x9B, 0x8B, 0x97, 0x88, 0x8B, 0x8F, 0x86, 0x8A, 0x82, 0x8C, 0x82, 
-    0x81, 0x81, 0x75, 0x70, 0x6E, 0x66, 0x76, 0x90, 0x76, 0x7E, 0x7D, 0x7A, 
-    0x78, 0x7A, 0x79, 0x7D, 0x55, 0x52, 0x6D, 0x69, 0x72, 0x75, 0x7C, 0x78, 
-    0x7F, 0x86, 0x83, 0x8E, 0xB4, 0x9E, 0x9B, 0x99, 0x9F, 0xA0, 0x92, 0x98, 
-    0x90, 0x8C, 0x8F, 0x8A, 0x88, 0x8A, 0x71, 0x59, 0x67, 0x6D, 0x74, 0x6F, 
-    0x76, 0x75, 0x81, 0xA7, 0x8B, 0x94, 0x8D, 0x8B, 0x88, 0x7B, 0x8D, 0x82, 
-    0x90, 0x62, 0x4F, 0x76, 0x64, 0x7B, 0x6A, 0x74, 0x76, 0x75, 0x7B, 0x81, 
-    0xB3, 0x8D, 0x8E, 0x8F, 0x84, 0x90, 0x86, 0x8A, 0x7E, 0x86, 0x7B, 0x84, 
-    0x71, 0x4A, 0x7C, 0x5F, 0x84, 0x93, 0x80, 0x8D, 0x7F, 0x8C, 0x76, 0x85, 
-    0x83, 0x73, 0x87, 0x6E, 0x8B, 0x5F, 0x4E, 0x79, 0x62, 0x6D, 0x68, 0x7C, 
-    0x74, 0x7B, 0x87, 0x79, 0x90, 0x83, 0x8B, 0x84, 0x94, 0xBA, 0x98, 0xA1, 
-    0x99, 0xA1, 0x92, 0x92, 0x9A, 0x87, 0x90, 0x8A, 0x7D, 0x5A, 0x6C, 0x78, 
-    0x6B, 0x7B, 0x98, 0x8D, 0x84, 0x88, 0x87, 0x7F, 0x83, 0x80, 0x72, 0x4B, 
-    0x66, 0x6B, 0x70, 0x6A, 0x83, 0xA7, 0x80, 0x91, 0x8E, 0x81, 0x5A, 0x6D, 
-    0x73, 0x6C, 0x7D, 0x78, 0x8C, 0xAB, 0x8D, 0x95, 0x87, 0x8F, 0x86, 0x80, 
-    0x8C, 0x73, 0x61, 0x77, 0x74, 0x80, 0x6D, 0x7A, 0x77, 0x74, 0xA5, 0x8D, 
-    0x96, 0x92, 0x8F, 0x8C, 0x82, 0x8C, 0x87, 0x59, 0x67, 0x7E, 0x6B, 0x68, 
-    0x79, 0x83, 0x77, 0x80, 0x83, 0x7A, 0x7E, 0x76, 0x7A, 0x7B, 0x79, 0x88, 
-    0x7B, 0x9C, 0xA7, 0x93, 0x95, 0x94, 0x9A, 0x89, 0x8F, 0x8D, 0x82, 0x8A, 
-    0x68, 0x68, 0x82, 0x81, 0x87, 0x78, 0x7C, 0x7B, 0x7B, 0x7B, 0x7A, 0x7A, 
-    0x74, 0x53, 0x53, 0x60, 0x6B, 0x6F, 0x6E, 0x73, 0x6F, 0x7E, 0x78, 0x9F, 
-    0xAA, 0x91, 0x95, 0x94, 0x7C, 0x61, 0x8B, 0x78, 0x82, 0x79, 0x9B, 0xB1, 
-    0x93, 0xA0, 0x95, 0x94, 0x87, 0x84, 0x93, 0x70, 0x5F, 0x74, 0x6F, 0x78, 
-    0x7E, 0x94, 0x71, 0x83, 0x8C, 0x90, 0x8C, 0x8D, 0x8A, 0x84, 0x85, 0x83, 
-    0x83, 0x82, 0x7C, 0x66, 0x5B, 0x61, 0x6F, 0x74, 0x6D, 0x76, 0x78, 0x80, 
-    0x84, 0x6E, 0x79, 0x77, 0x7A, 0x78, 0x7E, 0x89, 0xB2, 0xA0, 0x96, 0x98, 
-    0x94, 0x94, 0x8B, 0x8B, 0x85, 0x85, 0x84, 0x62, 0x77, 0x7C, 0x87, 0x89, 
-    0x74, 0x80, 0x79, 0x7D, 0x77, 0x7D, 0x77, 0x78, 0x59, 0x48, 0x68, 0x6A, 
-    0x6F, 0x6A, 0x72, 0x73, 0x79, 0x7A, 0x9B, 0xAC, 0x93, 0x93, 0x9B, 0x79, 
-    0x68, 0x8E, 0x7C, 0x84, 0x7D, 0xAC, 0xA3, 0x96, 0x9D, 0x93, 0x96, 0x81, 
-    0x8D, 0x85, 0x87, 0x74, 0x54, 0x72, 0x6F, 0x71, 0x86, 0x96, 0x59, 0x67, 
-    0x8A, 0x9E, 0x8A, 0x8B, 0x8C, 0x89, 0x83, 0x7F, 0x8C, 0x7B, 0x51, 0x6B, 
-    0x65, 0x7B, 0x95, 0x8F, 0x61, 0x69, 0x7B, 0x8A, 0x6C, 0x74, 0x7A, 0x70, 
-    0x7E, 0x74, 0x9F, 0xB4, 0x95, 0x9C, 0x84, 0x93, 0x92, 0x92, 0x8D, 0x83, 
-    0x8B, 0x7B, 0x82, 0x85, 0x7D, 0x7D, 0x74, 0x71, 0x71, 0x78, 0x78, 0x79, 
-    0x6A, 0x62, 0x72, 0x64, 0x72, 0x87, 0x7E, 0x60, 0x4E, 0x69, 0x6A, 0x73, 
-    0x78, 0x7A, 0x81, 0x7C, 0x89, 0x8C, 0x8B, 0x94, 0x8A, 0x8F, 0x87, 0xB8, 
-    0xB8, 0xA3, 0xAB, 0x9B, 0xA0, 0x94, 0x97, 0x93, 0x86, 0x5F, 0x69, 0x76, 
-    0x78, 0xA4, 0x90, 0x84, 0x7F, 0x83, 0x6E, 0x56, 0x83, 0x61, 0x5A, 0x6E, 
-    0x62, 0x9E, 0x97, 0x8B, 0x8A, 0x79, 0x86, 0x78, 0x85, 0x76, 0x50, 0x6E, 
-    0x86, 0xA0, 0x63, 0x5B, 0x7F, 0x63, 0x6C, 0x68, 0x8D, 0xAD, 0x8C, 0x96, 
-    0x89, 0x97, 0x92, 0x87, 0x8D, 0x5E, 0x5A, 0x71, 0x68, 0x87, 0xA0, 0x8E, 
-    0x8D, 0x83, 0x87, 0x83, 0x84, 0x81, 0x76, 0x7E, 0x77, 0x7C, 0x8A, 0x80, 
-    0x77, 0x50, 0x59, 0x66, 0x7E, 0xA6, 0x77, 0x62, 0x7F, 0xAE, 0x6A, 0x67, 
-    0x89, 0x78, 0x7B, 0x75, 0x88, 0x94, 0xC0, 0xA4, 0x98, 0x9A, 0x96, 0xA2, 
-    0x8F, 0x8A, 0x9B, 0x68, 0x62, 0x79, 0x90, 0x98, 0x7D, 0x8C, 0x7F, 0x82, 
-    0x87, 0x7C, 0x87, 0x78, 0x7E, 0x53, 0x4C, 0x71, 0x6C, 0x70, 0x61, 0x6F, 
-    0x6D, 0x78, 0xAA, 0x8A, 0x94, 0x8A, 0x8F, 0x8A, 0x88, 0x65, 0x6F, 0x77, 
-    0x6E, 0x75, 0x77, 0xAF, 0x98, 0x8F, 0x8E, 0x8B, 0x94, 0x81, 0x8E, 0x88, 
-    0x73, 0x53, 0x65, 0x70, 0x6D, 0x7A, 0x6E, 0x78, 0x6E, 0x8C, 0xA6, 0x88, 
-    0x99, 0x84, 0x8F, 0x82, 0x86, 0x8C, 0x86, 0x70, 0x4F, 0x6E, 0x98, 0x99, 
-    0x61, 0x64, 0x77, 0x76, 0x6F, 0xA1, 0x9E, 0x94, 0x62, 0x60, 0x7E, 0x7A, 
-    0x88, 0x81, 0xAC, 0x8C, 0x91, 0x99, 0x93, 0x9D, 0x85, 0x82, 0x7E, 0x7E, 
-    0x86, 0x82, 0x82, 0x65, 0x87, 0x7E, 0x78, 0x80, 0x76, 0x7E, 0x64, 0x69, 
-    0x61, 0x62, 0x78, 0x65, 0x6B, 0x6E, 0x7E, 0x97, 0x90, 0x88, 0x71, 0x6F, 
-    0x7C, 0x7F, 0x81, 0x93, 0xBB, 0x97, 0x99, 0x99, 0x6A, 0x7F, 0x7B, 0x82, 
-    0x73, 0xA6, 0xAC, 0x90, 0xA3, 0x8E, 0x98, 0x85, 0x7F, 0x6F, 0x54, 0x8A, 
-    0x91, 0x83, 0x81, 0x7C, 0x72, 0x67, 0x79, 0x85, 0x5B, 0x47, 0x6E, 0x5D, 
-    0x84, 0xA1, 0x8E, 0x8D, 0x80, 0x8D, 0x77, 0x80, 0x8D, 0x7B, 0x80, 0x78, 
-    0x60, 0x61, 0x73, 0x70, 0x77, 0x93, 0x8E, 0x6D, 0x5B, 0x86, 0x78, 0x7E, 
-    0x76, 0xAE, 0x9C, 0x8A, 0x9C, 0x90, 0x97, 0x55, 0x77, 0x6B, 0x7F, 0xB5, 
-    0x82, 0x9E, 0x8B, 0x92, 0x89, 0x7F, 0x91, 0x75, 0x82, 0x75, 0x78, 0x89, 
-    0x5C, 0x67, 0x6C, 0x64, 0x76, 0x71, 0x8E, 0x95, 0x89, 0x8E, 0x80, 0x63, 
-    0x6D, 0x7A, 0x7B, 0x72, 0x92, 0x7D, 0x7A, 0x89, 0x85, 0x88, 0x8B, 0x81, 
-    0xA1, 0xAC, 0x93, 0xA1, 0x96, 0x91, 0x8E, 0x8A, 0x86, 0x80, 0x74, 0x6E, 
-    0x7A, 0x8C, 0x79, 0x82, 0x7A, 0x76, 0x78, 0x6F, 0x74, 0x6F, 0x73, 0x56, 
-    0x47, 0x62, 0x63, 0x6E, 0x70, 0x6C, 0x84, 0xA5, 0x8A, 0x94, 0x8E, 0x99, 
-    0x73, 0x5C, 0x76, 0x83, 0xB3, 0x82, 0x97, 0x64, 0x71, 0x87, 0x77, 0x81, 
-    0x7E, 0xB6, 0x89, 0x90, 0x9E, 0x90, 0x9D, 0x80, 0x67, 0x61, 0x6E, 0x9E, 
-    0x6B, 0x63, 0x7E, 0x77, 0x86, 0xA2, 0x95, 0x93, 0x86, 0x8B, 0x7D, 0x85, 
-    0x6D, 0x72, 0x7C, 0x6B, 0x94, 0x95, 0x80, 0x8C, 0x8D, 0x76, 0x6E, 0x6D, 
-    0x5F, 0x75, 0x7D, 0x94, 0x8C, 0x92, 0x6C, 0x59, 0x77, 0x65, 0x7C, 0x74, 
-    0x75, 0x92, 0xA6, 0x95, 0x99, 0x98, 0x91, 0x86, 0x86, 0x81, 0x71, 0x8D, 
-    0x8B, 0x7F, 0x87, 0x7F, 0x88, 0x7B, 0x74, 0x79, 0x74, 0x75, 0x6E, 0x6A, 
-    0x63, 0x67, 0x62, 0x5E, 0x6E, 0x6E, 0x7C, 0xA1, 0x71, 0x65, 0x7D, 0x83, 
-    0x7C, 0x99, 0xB4, 0x94, 0x9B, 0x97, 0x8A, 0x62, 0x84, 0x7D, 0x83, 0x72, 
-    0x9F, 0xB9, 0x8F, 0xA3, 0x98, 0x8F, 0x88, 0x88, 0x85, 0x65, 0x8F, 0x84, 
-    0x78, 0x79, 0x78, 0x70, 0x75, 0x85, 0x70, 0x4A, 0x57, 0x70, 0x5F, 0x8E, 
-    0x9E, 0x8A, 0x8C, 0x82, 0x8F, 0x7F, 0x82, 0x72, 0x70, 0x8A, 0x79, 0x6D, 
-    0x6E, 0x78, 0x82, 0x8F, 0x8E, 0x75, 0x59, 0x75, 0x7B, 0x77, 0x7D, 0x80, 
-    0xA3, 0xA4, 0x8B, 0x9B, 0x8C, 0x9B, 0x56, 0x6E, 0x71, 0x9A, 0xAD, 0x80, 
-    0xA0, 0x89, 0x8F, 0x89, 0x80, 0x84, 0x74, 0x7E, 0x6E, 0x79, 0x89, 0x6A, 
-    0x5F, 0x5E, 0x64, 0x6A, 0x86, 0x80, 0x83, 0x8C, 0x7F, 0x62, 0x65, 0x78, 
-    0x79, 0x74, 0x88, 0xB0, 0x6B, 0x75, 0x8A, 0x7E, 0x93, 0xA6, 0x69, 0x81, 
-    0x85, 0x90, 0xAE, 0x9F, 0x9C, 0x93, 0x91, 0x87, 0x8E, 0x95, 0x6F, 0x8B, 
-    0x7A, 0x6C, 0x8A, 0x7E, 0x80, 0x77, 0x75, 0x66, 0x76, 0x65, 0x46, 0x63, 
-    0x61, 0x5F, 0x88, 0x87, 0x5A, 0x83, 0x6C, 0x90, 0xA4, 0x8E, 0x9A, 0x90, 
-    0x76, 0x6D, 0x86, 0x86, 0x94, 0xA5, 0x82, 0x94, 0x7B, 0x64, 0x7E, 0x79, 
-    0x77, 0x70, 0x85, 0x78, 0x8E, 0xB8, 0x8D, 0x9C, 0x8A, 0x86, 0x8A, 0x80, 
-    0x7B, 0x73, 0x9A, 0x6F, 0x55, 0x7D, 0x68, 0x9E, 0x8B, 0x78, 0x88, 0x7C, 
-    0x8E, 0x68, 0x6B, 0x6A, 0x7A, 0x9C, 0x76, 0x8E, 0x8F, 0x78, 0x71, 0x6A, 
-    0x68, 0x69, 0x74, 0x72, 0x7E, 0x9F, 0x93, 0x8E, 0x84, 0x78, 0x6A, 0x6B, 
-    0x72, 0x75, 0x7C, 0x80, 0x86, 0x8C, 0x87, 0x96, 0xB7, 0x92, 0x95, 0x91, 
-    0x91, 0x8F, 0x8C, 0x8E, 0x85, 0x88, 0x83, 0x7E, 0x83, 0x77, 0x79, 0x70, 
-    0x6F, 0x6A, 0x5C, 0x67, 0x70, 0x80, 0x71, 0x78, 0x82, 0x6D, 0x6C, 0x6E, 
-    0x6B, 0x73, 0x97, 0x6E, 0x6A, 0x85, 0x7F, 0x85, 0xAD, 0x9E, 0x96, 0x93, 
-    0x98, 0x73, 0x6F, 0x80, 0x79, 0x81, 0x77, 0x87, 0x92, 0x7D, 0x96, 0xB1, 
-    0x88, 0x90, 0x8F, 0x89, 0x85, 0x8F, 0x87, 0x7F, 0x87, 0x7E, 0x77, 0x74, 
-    0x68, 0x83, 0x7E, 0x6C, 0x46, 0x66, 0x6A, 0x68, 0x9E, 0x84, 0x8A, 0x87, 
-    0x84, 0x8A, 0x6F, 0x77, 0x79, 0x84, 0x7A, 0x78, 0x80, 0x6E, 0x82, 0x7B, 
-    0x68, 0x75, 0x7C, 0x74, 0x7A, 0x95, 0x7C, 0x77, 0x85, 0x86, 0x87, 0x87, 
-    0x85, 0x9B, 0xAF, 0x93, 0xA0, 0x70, 0x76, 0x9B, 0xA2, 0x89, 0x90, 0x93, 
-    0x87, 0x85, 0x87, 0x7B, 0x83, 0x78, 0x72, 0x75, 0x7B, 0x77, 0x5D, 0x5F, 
-    0x64, 0x75, 0x6D, 0x65, 0x83, 0x8E, 0x7E, 0x83, 0x75, 0x6F, 0x74, 0x6E, 
-    0x70, 0x71, 0xA9, 0x8A, 0x5E, 0x82, 0x7C, 0x7C, 0x9F, 0x9C, 0x98, 0x85, 
-    0x69, 0x87, 0x83, 0x82, 0x9B, 0xAC, 0x85, 0x8E, 0x98, 0x8A, 0x89, 0x8C, 
-    0x78, 0x70, 0x78, 0x7D, 0x89, 0x86, 0x7A, 0x7B, 0x73, 0x70, 0x7B, 0x54, 
-    0x55, 0x71, 0x97, 0x6D, 0x5E, 0x7F, 0x77, 0x71, 0x90, 0x9F, 0x8B, 0x90, 
-    0x92, 0x89, 0x6E, 0x7C, 0x84, 0x87, 0x8D, 0x91, 0x8C, 0x7A, 0x7C, 0x7E, 
-    0x68, 0x74, 0x7E, 0x79, 0x7C, 0x89, 0x85, 0xAA, 0xA1, 0x95, 0x92, 0x8A, 
-    0x8E, 0x88, 0x86, 0x8C, 0x68, 0x5A, 0x75, 0x69, 0x98, 0x8B, 0x86, 0x80, 
-    0x79, 0x86, 0x79, 0x71, 0x65, 0x76, 0x86, 0x7E, 0x85, 0x7B, 0x73, 0x71, 
-    0x67, 0x63, 0x6C, 0x73, 0x77, 0x85, 0x8D, 0x99, 0x90, 0x7A, 0x79, 0x72, 
-    0x6B, 0x78, 0x9A, 0x76, 0x73, 0x8C, 0x82, 0x8E, 0x7E, 0xAF, 0xA3, 0x8B, 
-    0x96, 0x8C, 0x99, 0x86, 0x8E, 0x85, 0x7B, 0x8B, 0x7E, 0x82, 0x7E, 0x7D, 
-    0x77, 0x6F, 0x70, 0x62, 0x72, 0x71, 0x70, 0x76, 0x6C, 0x73, 0x78, 0x63, 
-    0x65, 0x74, 0x9A, 0x8B, 0x5C, 0x76, 0x7E, 0x7E, 0x82, 0xB2, 0x9B, 0x95, 
-    0x97, 0x97, 0x89, 0x7C, 0x89, 0x7A, 0x6D, 0x72, 0x7F, 0x86, 0x7D, 0x8B, 
-    0x7A, 0x9F, 0xA2, 0x8D, 0x94, 0x8E, 0x96, 0x7E, 0x8A, 0x80, 0x7B, 0x8B, 
-    0x75, 0x84, 0x76, 0x7F, 0x7F, 0x7D, 0x51, 0x4C, 0x70, 0x58, 0x9C, 0x8A, 
-    0x83, 0x8E, 0x7F, 0x7F, 0x6C, 0x7C, 0x72, 0x81, 0x79, 0x5A, 0x7E, 0x7B, 
-    0x8A, 0x99, 0x80, 0x6C, 0x6E, 0x7D, 0x70, 0x7F, 0x80, 0x9D, 0x82, 0x70, 
-    0x8F, 0x89, 0x8E, 0x7E, 0x8E, 0xAB, 0x8F, 0xA2, 0x8D, 0x6B, 0x7E, 0x79, 
-    0xAB, 0x86, 0x92, 0x90, 0x7F, 0x8B, 0x78, 0x84, 0x80, 0x77, 0x7C, 0x5A, 
-    0x61, 0x6D, 0x7F, 0x82, 0x73, 0x72, 0x63, 0x67, 0x67, 0x6E, 0x7B, 0x80, 
-    0x7F, 0x8D, 0x94, 0x92, 0x94, 0x84, 0x7D, 0x76, 0x8A, 0x88, 0x5E, 0x76, 
-    0x7D, 0x76, 0x8B, 0xA9, 0x98, 0x84, 0x5F, 0x76, 0x79, 0x77, 0x9A, 0xA9, 
-    0x8B, 0x8B, 0x8E, 0x8D, 0x82, 0x8F, 0x7D, 0x76, 0x80, 0x7B, 0x82, 0x84, 
-    0x7D, 0x72, 0x5C, 0x5F, 0x6E, 0x7C, 0x8F, 0x89, 0x7B, 0x6A, 0x8C, 0x97, 
-    0x58, 0x67, 0x75, 0x74, 0x70, 0xA0, 0xA9, 0x90, 0x99, 0x89, 0x88, 0x81, 
-    0x89, 0x87, 0x75, 0x77, 0x71, 0x78, 0x75, 0x93, 0xA7, 0x59, 0x69, 0x76, 
-    0x73, 0x7C, 0x85, 0x83, 0x99, 0xAE, 0x91, 0x97, 0x97, 0x93, 0x8A, 0x7E, 
-    0x7F, 0x84, 0x8B, 0x53, 0x65, 0x79, 0x5F, 0xA0, 0x8C, 0x7F, 0x88, 0x80, 
-    0x84, 0x79, 0x84, 0x7D, 0x82, 0x73, 0x54, 0x6E, 0x6D, 0x73, 0x7F, 0x77, 
-    0x7B, 0x77, 0x78, 0x7E, 0x90, 0x96, 0x7B, 0x6F, 0x75, 0x88, 0x89, 0x74, 
-    0x82, 0x83, 0x81, 0x89, 0x71, 0x7D, 0x83, 0x81, 0x7F, 0x7A, 0xB2, 0x9B, 
-    0x93, 0x8E, 0x88, 0x90, 0x82, 0x90, 0x86, 0x82, 0x88, 0x7C, 0x81, 0x7B, 
-    0x84, 0x6B, 0x54, 0x62, 0x68, 0x6F, 0x74, 0x94, 0x89, 0x80, 0x6C, 0x6D, 
-    0x85, 0x7A, 0x6F, 0x6C, 0x74, 0x9D, 0x9C, 0x6A, 0x74, 0x89, 0x7A, 0x81, 
-    0xAB, 0x93, 0x98, 0x94, 0x91, 0x7C, 0x8F, 0x98, 0x82, 0x70, 0x58, 0x75, 
-    0x79, 0x71, 0x87, 0x73, 0x88, 0xA2, 0x86, 0x8B, 0x8B, 0x94, 0x7C, 0x82, 
-    0x88, 0x85, 0x8C, 0x82, 0x84, 0x7B, 0x67, 0x83, 0x6C, 0x4B, 0x5E, 0x69, 
-    0x6B, 0x6A, 0xA6, 0x91, 0x8A, 0x8C, 0x84, 0x83, 0x5E, 0x79, 0x8A, 0x80, 
-    0x78, 0x81, 0x8D, 0x8E, 0x8C, 0x7C, 0x81, 0x8D, 0x65, 0x61, 0x75, 0x94, 
-    0x8F, 0x72, 0x84, 0x7F, 0x76, 0x79, 0x80, 0x7F, 0x7E, 0x7F, 0xA2, 0xA3, 
-    0x9E, 0x89, 0x6A, 0x98, 0x99, 0x8B, 0x8E, 0x8A, 0x90, 0x7D, 0x88, 0x89, 
-    0x84, 0x83, 0x5D, 0x63, 0x61, 0x76, 0x90, 0x81, 0x7D, 0x76, 0x6E, 0x60, 
-    0x6D, 0x74, 0x6E, 0x75, 0x6F, 0x7B, 0x8A, 0x91, 0x9E, 0x94, 0x73, 0x7C, 
-    0x94, 0x8A, 0x64, 0x69, 0x7E, 0x74, 0x7A, 0xA6, 0x9C, 0x92, 0x87, 0x56, 
-    0x77, 0x73, 0x87, 0x78, 0x93, 0xAA, 0x85, 0x9A, 0x8A, 0x94, 0x86, 0x74, 
-    0x84, 0x75, 0x7F, 0x83, 0x86, 0x80, 0x76, 0x5E, 0x5B, 0x71, 0x87, 0x7D, 
-    0x62, 0x8A, 0x8D, 0x89, 0x72, 0x56, 0x7C, 0x6C, 0x76, 0x80, 0xAC, 0x9A, 
-    0x94, 0x93, 0x88, 0x8F, 0x87, 0x75, 0x8A, 0x87, 0x68, 0x65, 0x83, 0x8D, 
-    0x90, 0x7E, 0x6D, 0x6A, 0x6C, 0x71, 0x7D, 0x7D, 0x7E, 0x84, 0x92, 0xAD, 
-    0x99, 0x9D, 0x90, 0x8D, 0x84, 0x83, 0x90, 0x88, 0x8F, 0x74, 0x4D, 0x77, 
-    0x60, 0x89, 0x99, 0x78, 0x89, 0x7C, 0x8E, 0x7D, 0x83, 0x8A, 0x77, 0x86, 
-    0x51, 0x5A, 0x7A, 0x74, 0x7B, 0x66, 0x82, 0x91, 0x76, 0x69, 0x79, 0x99, 
-    0x8C, 0x79, 0x7F, 0x7F, 0x81, 0x79, 0x7B, 0x85, 0x9E, 0x99, 0x90, 0x96, 
-    0x91, 0x65, 0x77, 0x77, 0x77, 0x73, 0x86, 0xAB, 0x87, 0x92, 0x8A, 0x8E, 
-    0x86, 0x7B, 0x89, 0x79, 0x7E, 0x7E, 0x69, 0x72, 0x68, 0x71, 0x79, 0x77, 
-    0x62, 0x5F, 0x71, 0x7E, 0xA0, 0x92, 0x8C, 0x95, 0x8C, 0x7E, 0x5F, 0x72, 
-    0x74, 0x7B, 0x7D, 0x84, 0xA2, 0x97, 0x72, 0x6B, 0x79, 0x74, 0x7D, 0xA6, 
-    0x92, 0x92, 0x97, 0x73, 0x85, 0x9F, 0x8B, 0x88, 0x7D, 0x87, 0x5C, 0x60, 
-    0x7B, 0x6F, 0x7F, 0x61, 0x9B, 0x99, 0x7E, 0x9B, 0x8B, 0x8E, 0x80, 0x8B, 
-    0x83, 0x7E, 0x83, 0x79, 0x82, 0x5C, 0x5E, 0x7E, 0x91, 0x80, 0x4D, 0x66, 
-    0x6E, 0x7A, 0x6E, 0x97, 0xB2, 0x86, 0x93, 0x88, 0x82, 0x76, 0x74, 0x8B, 
-    0x8C, 0x85, 0x72, 0x82, 0x92, 0x8A, 0x90, 0x7F, 0x76, 0x61, 0x67, 0x6F, 
-    0x7C, 0x7B, 0x94, 0xAC, 0x8F, 0x8D, 0x95, 0x6E, 0x5A, 0x73, 0x6D, 0x7B, 
-    0x76, 0xAB, 0x9D, 0x8E, 0x94, 0x5C, 0x6E, 0x8D, 0x9A, 0x82, 0x83, 0x96, 
-    0x89, 0x87, 0x7F, 0x8A, 0x82, 0x71, 0x5C, 0x54, 0x6F, 0x79, 0x8F, 0x8D, 
-    0x86, 0x8D, 0x71, 0x6B, 0x6B, 0x69, 0x6B, 0x6D, 0x82, 0x8E, 0x86, 0x84, 
-    0x91, 0x94, 0x7C, 0x74, 0x8D, 0x92, 0x89, 0x68, 0x6C, 0x7C, 0x7B, 0x7B, 
-    0x8A, 0xAF, 0x8B, 0x90, 0x88, 0x59, 0x7B, 0x75, 0x7C, 0x6E, 0x98, 0x9F, 
-    0x84, 0x9A, 0x87, 0x95, 0x86, 0x7E, 0x87, 0x7A, 0x87, 0x70, 0x77, 0x76, 
-    0x7A, 0x84, 0x6C, 0x6E, 0x71, 0x70, 0x6E, 0x77, 0x97, 0x93, 0x8D, 0x92, 
-    0x7A, 0x5A, 0x71, 0x73, 0x6E, 0x80, 0xA5, 0x8C, 0x92, 0x8F, 0x92, 0x8E, 
-    0x87, 0x82, 0x81, 0x6B, 0x54, 0x6E, 0x73, 0x85, 0x88, 0x8B, 0x95, 0x87, 
-    0x8A, 0x51, 0x6D, 0x79, 0x6C, 0x82, 0x70, 0x94, 0xAB, 0x8E, 0x94, 0x87, 
-    0x94, 0x82, 0x8C, 0x84, 0x86, 0x84, 0x52, 0x76, 0x75, 0x72, 0x9C, 0x93, 
-    0x80, 0x81, 0x84, 0x6F, 0x85, 0x98, 0x7E, 0x8B, 0x7F, 0x7E, 0x6D, 0x67, 
-    0x6E, 0x68, 0x69, 0x70, 0x88, 0x88, 0x94, 0x97, 0x7C, 0x7D, 0x85, 0x8C, 
-    0x78, 0x65, 0x72, 0x79, 0x84, 0x7D, 0x97, 0xA8, 0x93, 0x8E, 0x8A, 0x64, 
-    0x66, 0x7A, 0x72, 0x77, 0x70, 0xA7, 0x99, 0x8C, 0x94, 0x8A, 0x90, 0x7C, 
-    0x85, 0x82, 0x7E, 0x90, 0x7B, 0x6E, 0x77, 0x76, 0x69, 0x5F, 0x6B, 0x6F, 
-    0x79, 0x8B, 0x93, 0x8E, 0x8B, 0x8B, 0x87, 0x75, 0x66, 0x6D, 0x71, 0x79, 
-    0x7E, 0x7B, 0x7D, 0x92, 0x9E, 0x87, 0x95, 0x67, 0x64, 0x78, 0x73, 0x79, 
-    0x86, 0xB4, 0x8F, 0x93, 0x93, 0x89, 0x92, 0x7D, 0x84, 0x7E, 0x82, 0x5B, 
-    0x63, 0x79, 0x6A, 0x7D, 0x65, 0x81, 0xA7, 0x88, 0x93, 0x8A, 0x95, 0x83, 
-    0x8A, 0x7E, 0x6B, 0x82, 0x74, 0x87, 0x8E, 0x7F, 0x7A, 0x6F, 0x75, 0x75, 
-    0x8C, 0x80, 0x5F, 0x6E, 0x6E, 0x7A, 0x77, 0xA1, 0x98, 0x85, 0x8B, 0x82, 
-    0x84, 0x7F, 0x8F, 0x92, 0x82, 0x7F, 0x7D, 0x8C, 0x6A, 0x68, 0x71, 0x63, 
-    0x71, 0x82, 0xA4, 0x94, 0x8E, 0x6C, 0x7C, 0x9D, 0x88, 0x85, 0x8A, 0x6B, 
-    0x56, 0x71, 0x78, 0x7C, 0x83, 0x73, 0x9A, 0x9D, 0x8D, 0x98, 0x9C, 0x71, 
-    0x59, 0x79, 0x8A, 0x9F, 0x8C, 0x8C, 0x8D, 0x8B, 0x81, 0x86, 0x87, 0x6E, 
-    0x62, 0x60, 0x70, 0x86, 0x87, 0x82, 0x7B, 0x79, 0x73, 0x76, 0x70, 0x6E, 
-    0x72, 0x70, 0x78, 0x85, 0x89, 0x8D, 0x98, 0x90, 0x7F, 0x70, 0x75, 0x79, 
-    0x74, 0x8D, 0xA5, 0x9A, 0x7D, 0x67, 0x86, 0x73, 0x7B, 0xA0, 0x8F, 0x88, 
-    0x94, 0x72, 0x6A, 0x81, 0x7B, 0x73, 0x73, 0xA4, 0x8E, 0x94, 0x93, 0x8F, 
-    0x90, 0x78, 0x86, 0x75, 0x6D, 0x8B, 0x7C, 0x78, 0x75, 0x7E, 0x74, 0x67, 
-    0x6A, 0x60, 0x73, 0x7E, 0x84, 0x89, 0x7C, 0x8C, 0x8C, 0x7E, 0x82, 0x57, 
-    0x5F, 0x6B, 0x70, 0x73, 0x7C, 0xB5, 0x91, 0x95, 0x93, 0x8D, 0x8F, 0x71, 
-    0x74, 0x76, 0x89, 0x8D, 0x87, 0x8D, 0x7C, 0x7C, 0x84, 0x96, 0x8E, 0x87, 
-    0x92, 0x69, 0x61, 0x79, 0x79, 0x7C, 0x73, 0x76, 0x9E, 0x99, 0x91, 0x97, 
-    0x95, 0x8D, 0x86, 0x82, 0x63, 0x80, 0x97, 0x7E, 0x8A, 0x64, 0x5D, 0x74, 
-    0x6C, 0x6C, 0x78, 0xA6, 0x88, 0x90, 0x8F, 0x8C, 0x96, 0x7F, 0x7F, 0x75, 
-    0x60, 0x66, 0x7B, 0x79, 0x68, 0x79, 0x7B, 0x84, 0x8D, 0x8B, 0x8A, 0x70, 
-    0x61, 0x68, 0x75, 0x7B, 0x7E, 0x88, 0xA1, 0x97, 0x8E, 0x8F, 0x91, 0x8D, 
-    0x82, 0x82, 0x85, 0x82, 0x8E, 0x67, 0x56, 0x70, 0x67, 0x6F, 0x6D, 0x71, 
-    0x9E, 0x9A, 0x8E, 0x91, 0x8E, 0x90, 0x83, 0x88, 0x7F, 0x86, 0x7F, 0x79, 
-    0x84, 0x83, 0x73, 0x6B, 0x6B, 0x6B, 0x76, 0x79, 0x83, 0x83, 0x86, 0x84, 
-    0x7B, 0x7A, 0x7A, 0x86, 0x7E, 0x80, 0x7F, 0x85, 0x88, 0x88, 0x93, 0x81, 
-    0x9C, 0x97, 0x90, 0x82, 0x5C, 0x7B, 0x6F, 0x7A, 0x77, 0x7B, 0xAC, 0x90, 
-    0x94, 0x8D, 0x8D, 0x91, 0x7F, 0x88, 0x80, 0x82, 0x8B, 0x60, 0x5A, 0x6D, 
-    0x6E, 0x6D, 0x6C, 0x6D, 0x8C, 0x9C, 0x84, 0x8E, 0x89, 0x8C, 0x83, 0x84, 
-    0x7B, 0x7E, 0x82, 0x7B, 0x83, 0x80, 0x7B, 0x77, 0x67, 0x60, 0x78, 0x8B, 
-    0x89, 0x7F, 0x61, 0x60, 0x71, 0x6E, 0x71, 0x8B, 0xA2, 0x8A, 0x90, 0x90, 
-    0x84, 0x96, 0x92, 0x88, 0x7F, 0x7D, 0x82, 0x6F, 0x72, 0x72, 0x74, 0x75, 
-    0x71, 0x86, 0x91, 0x9A, 0x8D, 0x84, 0x87, 0x7C, 0x8D, 0x9A, 0x96, 0x90, 
-    0x8E, 0x87, 0x5D, 0x76, 0x79, 0x7A, 0x77, 0x76, 0x7D, 0x9E, 0xA2, 0x8D, 
-    0x94, 0x84, 0x8C, 0x64, 0x5A, 0x7B, 0x7A, 0xA3, 0x84, 0x90, 0x89, 0x84, 
-    0x8F, 0x76, 0x71, 0x53, 0x68, 0x72, 0x89, 0x90, 0x82, 0x89, 0x68, 0x64, 
-    0x65, 0x79, 0x72, 0x67, 0x79, 0x6C, 0x76, 0x7D, 0x8F, 0x99, 0x85, 0x78, 
-    0x72, 0x7A, 0x7C, 0x80, 0x7E, 0x81, 0x8E, 0x98, 0x92, 0x99, 0x96, 0x8A, 
-    0x89, 0x83, 0x8A, 0x7D, 0x5A, 0x77, 0x6F, 0x7D, 0x7E, 0x73, 0x81, 0x75, 
-    0x83, 0x76, 0xA4, 0xA1, 0x8C, 0x9A, 0x89, 0x94, 0x8C, 0x8C, 0x7E, 0x6F, 
-    0x79, 0x7A, 0x8A, 0x82, 0x7D, 0x75, 0x5F, 0x6B, 0x71, 0x7B, 0x8C, 0x92, 
-    0x83, 0x7B, 0x76, 0x77, 0x75, 0x6E, 0x76, 0x87, 0x89, 0x8A, 0x88, 0x93, 
-    0x8E, 0x83, 0x66, 0x5D, 0x71, 0x6F, 0x76, 0x7C, 0xA4, 0x98, 0x90, 0x87, 
-    0x7D, 0x8A, 0x82, 0x75, 0x71, 0x7D, 0x8A, 0x9B, 0x95, 0x8D, 0x8D, 0x88, 
-    0x79, 0x76, 0x79, 0x5C, 0x68, 0x6E, 0x6D, 0x78, 0x7E, 0x79, 0x96, 0x9F, 
-    0x85, 0x8F, 0x8B, 0x90, 0x8E, 0x8D, 0x88, 0x82, 0x86, 0x7D, 0x89, 0x82, 
-    0x7C, 0x85, 0x5C, 0x54, 0x69, 0x6D, 0x6C, 0x74, 0xA1, 0x89, 0x89, 0x8C, 
-    0x84, 0x85, 0x7F, 0x7A, 0x6E, 0x6F, 0x80, 0x88, 0x8E, 0x83, 0x7E, 0x7C, 
-    0x78, 0x7C, 0x7A, 0x7A, 0x78, 0x74, 0x6E, 0x75, 0x81, 0x82, 0x84, 0x8D, 
-    0x94, 0x92, 0x8F, 0x91, 0x9C, 0x97, 0x8F, 0x90, 0x88, 0x86, 0x77, 0x66, 
-    0x6B, 0x6B, 0x71, 0x73, 0x76, 0x7E, 0x78, 0x8D, 0xA7, 0x8C, 0x92, 0x8B, 
-    0x8F, 0x88, 0x86, 0x8D, 0x7F, 0x77, 0x7A, 0x84, 0x83, 0x77, 0x6D, 0x5E, 
-    0x65, 0x6D, 0x7E, 0x89, 0x83, 0x7F, 0x6B, 0x63, 0x66, 0x6E, 0x76, 0x83, 
-    0x91, 0x88, 0x8B, 0x91, 0x87, 0x80, 0x80, 0x83, 0x7E, 0x80, 0x83, 0x88, 
-    0x92, 0x87, 0x7F, 0x65, 0x67, 0x75, 0x72, 0x77, 0x7A, 0xAA, 0x98, 0x92, 
-    0x99, 0x91, 0x96, 0x87, 0x89, 0x84, 0x6E, 0x6D, 0x6E, 0x70, 0x71, 0x77, 
-    0x79, 0x76, 0x78, 0xA0, 0x9A, 0x8D, 0x93, 0x8A, 0x90, 0x8A, 0x84, 0x7E, 
-    0x8B, 0x8C, 0x7B, 0x7F, 0x86, 0x7E, 0x6B, 0x62, 0x69, 0x71, 0x71, 0x83, 
-    0x93, 0x7F, 0x84, 0x7D, 0x52, 0x66, 0x6D, 0x70, 0x6A, 0x94, 0xA3, 0x8D, 
-    0x9D, 0x92, 0x96, 0x8A, 0x80, 0x71, 0x66, 0x7B, 0x81, 0x82, 0x76, 0x76, 
-    0x7A, 0x6E, 0x7A, 0x81, 0x90, 0x86, 0x7D, 0x85, 0x8D, 0x98, 0x96, 0x92, 
-    0x8B, 0x87, 0x84, 0x79, 0x69, 0x68, 0x72, 0x75, 0x71, 0x7C, 0x79, 0x98, 
-    0xA0, 0x87, 0x8C, 0x8A, 0x8C, 0x8A, 0x69, 0x5F, 0x79, 0x71, 0x98, 0x93, 
-    0x8D, 0x8C, 0x8B, 0x87, 0x69, 0x75, 0x6D, 0x73, 0x8D, 0x7D, 0x88, 0x72, 
-    0x66, 0x72, 0x6D, 0x78, 0x7D, 0x8A, 0x82, 0x7D, 0x74, 0x77, 0x88, 0x85, 
-    0x84, 0x8D, 0x88, 0x83, 0x83, 0x7B, 0x75, 0x79, 0x75, 0x77, 0x7D, 0x86, 
-    0x96, 0x91, 0x8B, 0x91, 0x8D, 0x83, 0x97, 0x8B, 0x5C, 0x75, 0x78, 0x8F, 
-    0xA0, 0x8D, 0x69, 0x6F, 0x7E, 0x73, 0x7A, 0x85, 0xA4, 0x8F, 0x85, 0x8B, 
-    0x94, 0x90, 0x85, 0x88, 0x77, 0x79, 0x85, 0x7A, 0x7E, 0x67, 0x64, 0x67, 
-    0x69, 0x75, 0x7B, 0x88, 0x85, 0x82, 0x7B, 0x70, 0x71, 0x70, 0x71, 0x76, 
-    0x7F, 0x93, 0x8C, 0x8D, 0x77, 0x72, 0x77, 0x85, 0x75, 0x68, 0x81, 0x7A, 
-    0x9A, 0xA5, 0x91, 0x9F, 0x83, 0x70, 0x77, 0x7E, 0x82, 0x80, 0x91, 0x8E, 
-    0x90, 0x90, 0x93, 0x94, 0x84, 0x7E, 0x7E, 0x80, 0x6E, 0x5B, 0x6E, 0x6E, 
-    0x77, 0x73, 0x79, 0x7A, 0x9B, 0x97, 0x86, 0x92, 0x8E, 0x8F, 0x89, 0x88, 
-    0x80, 0x82, 0x86, 0x78, 0x85, 0x6D, 0x60, 0x73, 0x65, 0x61, 0x6C, 0x6F, 
-    0x77, 0xA3, 0x8F, 0x89, 0x91, 0x85, 0x71, 0x6C, 0x79, 0x88, 0x90, 0x82, 
-    0x7D, 0x82, 0x7A, 0x85, 0x87, 0x80, 0x85, 0x84, 0x74, 0x70, 0x79, 0x74, 
-    0x77, 0x7A, 0x7C, 0x87, 0x88, 0x88, 0x8D, 0x8B, 0x8F, 0x99, 0x98, 0x91, 
-    0x93, 0x8C, 0x88, 0x82, 0x88, 0x62, 0x58, 0x73, 0x6A, 0x75, 0x6F, 0x7D, 
-    0x75, 0x9D, 0x9D, 0x88, 0x97, 0x89, 0x8E, 0x84, 0x82, 0x85, 0x86, 0x82, 
-    0x79, 0x7C, 0x67, 0x68, 0x72, 0x69, 0x74, 0x80, 0x84, 0x7C, 0x76, 0x67, 
-    0x6B, 0x74, 0x71, 0x7A, 0x89, 0x8E, 0x8F, 0x89, 0x84, 0x88, 0x86, 0x7D, 
-    0x7C, 0x8A, 0x94, 0x90, 0x8C, 0x84, 0x6B, 0x6F, 0x77, 0x71, 0x76, 0x78, 
-    0x80, 0x7C, 0xA7, 0xA6, 0x96, 0x9A, 0x8C, 0x90, 0x85, 0x88, 0x8E, 0x84, 
-    0x8A, 0x69, 0x57, 0x6B, 0x6F, 0x75, 0x68, 0x70, 0x81, 0x9D, 0x8D, 0x8F, 
-    0x8F, 0x8B, 0x87, 0x82, 0x82, 0x83, 0x87, 0x7F, 0x79, 0x7F, 0x73, 0x6D, 
-    0x68, 0x67, 0x6F, 0x85, 0x88, 0x83, 0x75, 0x66, 0x83, 0x65, 0x66, 0x6D, 
-    0x74, 0x72, 0x95, 0xA8, 0x93, 0x9F, 0x98, 0x8C, 0x7A, 0x82, 0x8B, 0x87, 
-    0x88, 0x83, 0x7A, 0x6B, 0x73, 0x7D, 0x72, 0x7A, 0x7F, 0x7D, 0x7C, 0x83, 
-    0x87, 0x8A, 0x9C, 0x9C, 0x8F, 0x8C, 0x8F, 0x8D, 0x89, 0x81, 0x61, 0x6C, 
-    0x77, 0x77, 0x78, 0x77, 0x7F, 0x9F, 0x8D, 0x87, 0x90, 0x8B, 0x8C, 0x6D, 
-    0x5B, 0x69, 0x8A, 0xA0, 0x7D, 0x93, 0x85, 0x88, 0x7A, 0x5A, 0x73, 0x7B, 
-    0x84, 0x78, 0x77, 0x78, 0x6F, 0x73, 0x67, 0x70, 0x7B, 0x7B, 0x79, 0x6E, 
-    0x76, 0x7D, 0x81, 0x80, 0x8B, 0x91, 0x8B, 0x8D, 0x8C, 0x89, 0x83, 0x75, 
-    0x73, 0x77, 0x7F, 0x83, 0x8A, 0xA0, 0x83, 0x72, 0x87, 0x92, 0x8E, 0x76, 
-    0x7A, 0x76, 0x92, 0xA6, 0x90, 0x97, 0x95, 0x76, 0x5B, 0x78, 0x76, 0x7F, 
-    0x75, 0x86, 0xA3, 0x89, 0x94, 0x91, 0x8D, 0x7F, 0x7C, 0x81, 0x71, 0x84, 
-    0x78, 0x6C, 0x74, 0x6F, 0x6F, 0x6A, 0x74, 0x79, 0x7C, 0x7D, 0x81, 0x7E, 
-    0x71, 0x6D, 0x73, 0x70, 0x7F, 0x96, 0x85, 0x70, 0x7E, 0x89, 0x76, 0x76, 
-    0x73, 0x7C, 0x76, 0x88, 0xAC, 0x94, 0x9A, 0x93, 0x8D, 0x6D, 0x72, 0x84, 
-    0x7E, 0x89, 0x82, 0x7C, 0x83, 0x8A, 0x95, 0x8D, 0x8D, 0x86, 0x82, 0x81, 
-    0x81, 0x8F, 0x69, 0x5A, 0x73, 0x6B, 0x73, 0x74, 0x7C, 0x74, 0x98, 0x9E, 
-    0x8A, 0x9A, 0x92, 0x92, 0x85, 0x80, 0x85, 0x83, 0x84, 0x7C, 0x82, 0x67, 
-    0x5A, 0x6B, 0x66, 0x66, 0x8C, 0x98, 0x82, 0x8C, 0x89, 0x81, 0x64, 0x70, 
-    0x7B, 0x7E, 0x81, 0x7E, 0x81, 0x77, 0x7C, 0x8D, 0x87, 0x86, 0x84, 0x7C, 
-    0x7E, 0x85, 0x79, 0x72, 0x79, 0x79, 0x79, 0x81, 0x8C, 0x84, 0x82, 0x82, 
-    0x8C, 0x8F, 0x93, 0x8F, 0x91, 0x9D, 0x8C, 0x90, 0x8A, 0x8D, 0x87, 0x5B, 
-    0x69, 0x72, 0x74, 0x75, 0x75, 0x7D, 0x9D, 0x95, 0x8A, 0x8C, 0x8E, 0x88, 
-    0x80, 0x82, 0x7D, 0x81, 0x7F, 0x78, 0x7C, 0x6E, 0x6D, 0x6E, 0x69, 0x6C, 
-    0x6B, 0x6B, 0x6E, 0x7A, 0x74, 0x6F, 0x75, 0x78, 0x7D, 0x7F, 0x85, 0x8A, 
-    0x8A, 0x7C, 0x82, 0x89, 0x7F, 0x8D, 0xA3, 0x92, 0x7D, 0x87, 0x90, 0x88, 
-    0x76, 0x6B, 0x75, 0x78, 0x76, 0x88, 0xAC, 0x97, 0x95, 0x93, 0x89, 0x7F, 
-    0x81, 0x91, 0x88, 0x85, 0x81, 0x83, 0x86, 0x75, 0x6E, 0x5B, 0x62, 0x69, 
-    0x6A, 0x72, 0x77, 0x81, 0x84, 0x8F, 0x97, 0x99, 0x8F, 0x8F, 0x86, 0x7A, 
-    0x90, 0x8E, 0x8E, 0x88, 0x74, 0x86, 0x87, 0x81, 0x65, 0x65, 0x82, 0x7F, 
-    0x70, 0x51, 0x6A, 0x70, 0x69, 0x70, 0x7E, 0xA5, 0x89, 0x93, 0x79, 0x76, 
-    0xAA, 0x83, 0x71, 0x79, 0x9E, 0x8A, 0x66, 0x80, 0x8C, 0x87, 0x6D, 0x75, 
-    0x8F, 0x76, 0x6E, 0x78, 0x7E, 0x7F, 0x82, 0x85, 0x89, 0x98, 0x85, 0x8C, 
-    0x9B, 0x8D, 0x8D, 0x86, 0x82, 0x6D, 0x7B, 0x83, 0x6E, 0x71, 0x73, 0x81, 
-    0x7C, 0x7B, 0x7C, 0x79, 0x82, 0x79, 0x9B, 0x9F, 0x91, 0x97, 0x89, 0x90, 
-    0x8A, 0x8B, 0x83, 0x80, 0x84, 0x70, 0x77, 0x7B, 0x6C, 0x72, 0x6A, 0x70, 
-    0x74, 0x68, 0x66, 0x68, 0x67, 0x69, 0x6E, 0x78, 0x86, 0x87, 0x7F, 0x7D, 
-    0x87, 0x90, 0x87, 0x77, 0x78, 0x8B, 0x9D, 0x85, 0x7A, 0x94, 0x95, 0x79, 
-    0x77, 0x85, 0x7C, 0x74, 0x7D, 0x7D, 0x87, 0xA7, 0xA0, 0x94, 0x93, 0x91, 
-    0x91, 0x89, 0x81, 0x73, 0x71, 0x74, 0x74, 0x6F, 0x74, 0x89, 0x86, 0x7C, 
-    0x85, 0x89, 0x7D, 0x72, 0x7A, 0x7A, 0x7D, 0x85, 0x86, 0x8D, 0x92, 0x93, 
-    0x8C, 0x88, 0x8B, 0x87, 0x75, 0x7C, 0x86, 0x80, 0x82, 0x78, 0x7C, 0x78, 
-    0x74, 0x5F, 0x4C, 0x5F, 0x63, 0x6A, 0x74, 0x93, 0x9B, 0x8A, 0x8D, 0x88, 
-    0x88, 0x7D, 0x7A, 0x80, 0x7A, 0x7F, 0x7B, 0x74, 0x7D, 0x80, 0x85, 0x75, 
-    0x78, 0x84, 0x81, 0x7E, 0x78, 0x87, 0x92, 0x90, 0x7D, 0x84, 0x8E, 0x8D, 
-    0x7E, 0x7A, 0x87, 0x88, 0x85, 0x86, 0x8D, 0x92, 0x8A, 0x83, 0x88, 0x83, 
-    0x82, 0x76, 0x76, 0x7A, 0x7D, 0x84, 0xA2, 0x99, 0x90, 0x90, 0x8D, 0x89, 
-    0x83, 0x87, 0x80, 0x7B, 0x77, 0x71, 0x7C, 0x73, 0x73, 0x70, 0x64, 0x66, 
-    0x63, 0x66, 0x68, 0x73, 0x6F, 0x78, 0x7C, 0x80, 0x82, 0x7E, 0x7F, 0x7F, 
-    0x77, 0x79, 0x7D, 0x87, 0x88, 0x8A, 0x85, 0x87, 0x8E, 0x83, 0x77, 0x73, 
-    0x79, 0x78, 0x7F, 0x85, 0xA1, 0xA4, 0x93, 0x94, 0x82, 0x8A, 0x85, 0x83, 
-    0x7E, 0x7F, 0x81, 0x79, 0x82, 0x7F, 0x87, 0x84, 0x78, 0x73, 0x78, 0x7D, 
-    0x7D, 0x7E, 0x81, 0x88, 0x90, 0x8A, 0x85, 0x8D, 0x86, 0x7C, 0x7A, 0x7E, 
-    0x8C, 0x8E, 0x88, 0x84, 0x78, 0x74, 0x76, 0x76, 0x6D, 0x68, 0x69, 0x69, 
-    0x74, 0x7E, 0x95, 0x96, 0x88, 0x88, 0x81, 0x82, 0x82, 0x87, 0x80, 0x73, 
-    0x77, 0x72, 0x78, 0x81, 0x85, 0x80, 0x78, 0x78, 0x77, 0x77, 0x7B, 0x7E, 
-    0x7A, 0x7A, 0x80, 0x82, 0x88, 0x89, 0x7E, 0x79, 0x7D, 0x85, 0x91, 0xA2, 
-    0x99, 0x8E, 0x8A, 0x8C, 0x88, 0x82, 0x7E, 0x76, 0x74, 0x76, 0x80, 0x90, 
-    0x9B, 0x95, 0x8C, 0x87, 0x86, 0x86, 0x83, 0x7F, 0x7B, 0x70, 0x74, 0x76, 
-    0x7A, 0x78, 0x78, 0x74, 0x6C, 0x6F, 0x69, 0x72, 0x6E, 0x77, 0x77, 0x78, 
-    0x7E, 0x7F, 0x80, 0x72, 0x75, 0x77, 0x81, 0x90, 0x93, 0x91, 0x8D, 0x8D, 
-    0x88, 0x86, 0x7C, 0x72, 0x76, 0x74, 0x76, 0x78, 0x84, 0x97, 0x9D, 0x95, 
-    0x8E, 0x8F, 0x7C, 0x7A, 0x7E, 0x7C, 0x7D, 0x7E, 0x84, 0x85, 0x86, 0x81, 
-    0x86, 0x83, 0x76, 0x89, 0x75, 0x6C, 0x7D, 0x7C, 0x85, 0x89, 0xA5, 0x90, 
-    0x8E, 0x8E, 0x85, 0x8B, 0x82, 0x86, 0x83, 0x7C, 0x7B, 0x76, 0x6E, 0x63, 
-    0x6E, 0x66, 0x62, 0x74, 0x81, 0x8D, 0x89, 0x89, 0x86, 0x7D, 0x79, 0x74, 
-    0x76, 0x78, 0x7C, 0x7B, 0x7E, 0x80, 0x7D, 0x77, 0x7B, 0x7A, 0x7B, 0x7F, 
-    0x7D, 0x7D, 0x7F, 0x87, 0x84, 0x7D, 0x7C, 0x7D, 0x81, 0x87, 0x97, 0x95, 
-    0x8E, 0x90, 0x88, 0x85, 0x89, 0x88, 0x71, 0x74, 0x7B, 0x7A, 0x82, 0x7E, 
-    0x97, 0xA9, 0x8E, 0x94, 0x8E, 0x90, 0x88, 0x87, 0x84, 0x7B, 0x81, 0x7A, 
-    0x7D, 0x7B, 0x72, 0x70, 0x66, 0x68, 0x72, 0x77, 0x74, 0x76, 0x79, 0x6F, 
-    0x71, 0x6E, 0x6F, 0x79, 0x86, 0x8C, 0x85, 0x85, 0x84, 0x83, 0x83, 0x7D, 
-    0x76, 0x75, 0x7B, 0x77, 0x7C, 0x84, 0x89, 0x9A, 0x9B, 0x8E, 0x93, 0x86, 
-    0x7D, 0x8A, 0x80, 0x7A, 0x8C, 0x8D, 0x79, 0x79, 0x74, 0x66, 0x73, 0x72, 
-    0x75, 0x7E, 0xA0, 0x96, 0x90, 0x91, 0x8A, 0x91, 0x71, 0x6C, 0x7E, 0x80, 
-    0x88, 0x8A, 0x8E, 0x84, 0x82, 0x81, 0x73, 0x71, 0x6C, 0x64, 0x68, 0x70, 
-    0x76, 0x80, 0x94, 0x95, 0x89, 0x89, 0x85, 0x80, 0x72, 0x78, 0x80, 0x76, 
-    0x7F, 0x85, 0x7F, 0x7D, 0x7A, 0x7C, 0x7B, 0x7C, 0x78, 0x7D, 0x83, 0x7E, 
-    0x87, 0x8D, 0x82, 0x7D, 0x83, 0x83, 0x8D, 0x9A, 0x8E, 0x73, 0x76, 0x7D, 
-    0x7F, 0x7E, 0x89, 0xAA, 0x93, 0x8F, 0x91, 0x8F, 0x8B, 0x84, 0x84, 0x78, 
-    0x7E, 0x83, 0x7E, 0x7E, 0x76, 0x6E, 0x69, 0x6E, 0x71, 0x70, 0x70, 0x72, 
-    0x71, 0x6B, 0x76, 0x7A, 0x7D, 0x7C, 0x77, 0x79, 0x70, 0x71, 0x7A, 0x7E, 
-    0x87, 0x89, 0x8A, 0x91, 0x89, 0x84, 0x8B, 0x80, 0x7C, 0x81, 0x7E, 0x7D, 
-    0x81, 0x88, 0x88, 0x90, 0x98, 0x8F, 0x94, 0x92, 0x90, 0x82, 0x67, 0x73, 
-    0x74, 0x78, 0x76, 0x94, 0xA2, 0x8A, 0x94, 0x8A, 0x8E, 0x87, 0x7C, 0x81, 
-    0x73, 0x71, 0x6D, 0x7A, 0x87, 0x78, 0x7D, 0x7E, 0x81, 0x7C, 0x74, 0x7C, 
-    0x79, 0x6E, 0x6B, 0x74, 0x77, 0x74, 0x78, 0x88, 0x8E, 0x81, 0x82, 0x8B, 
-    0x8D, 0x80, 0x7C, 0x84, 0x83, 0x81, 0x7E, 0x77, 0x7B, 0x81, 0x76, 0x75, 
-    0x7C, 0x7B, 0x7E, 0x8A, 0x8B, 0x79, 0x7A, 0x84, 0x8A, 0x84, 0x7B, 0x80, 
-    0x7D, 0x7C, 0x82, 0x86, 0x86, 0x98, 0xA5, 0x8F, 0x8E, 0x94, 0x8C, 0x88, 
-    0x84, 0x83, 0x7A, 0x7F, 0x85, 0x7F, 0x80, 0x73, 0x76, 0x78, 0x78, 0x76, 
-    0x67, 0x65, 0x6B, 0x71, 0x73, 0x73, 0x7A, 0x7C, 0x7B, 0x75, 0x75, 0x76, 
-    0x7A, 0x84, 0x97, 0x96, 0x8D, 0x88, 0x80, 0x7C, 0x80, 0x86, 0x79, 0x77, 
-    0x7F, 0x84, 0x81, 0x81, 0x8D, 0x8E, 0x82, 0x89, 0x90, 0x8E, 0x86, 0x80, 
-    0x81, 0x81, 0x80, 0x7B, 0x7B, 0x85, 0x89, 0x7F, 0x86, 0x98, 0x91, 0x75, 
-    0x6C, 0x80, 0x83, 0x86, 0x92, 0x88, 0x89, 0x7F, 0x83, 0x7E, 0x77, 0x7F, 
-    0x78, 0x71, 0x71, 0x74, 0x6B, 0x6A, 0x75, 0x71, 0x6D, 0x75, 0x7B, 0x7F, 
-    0x88, 0x93, 0x8E, 0x87, 0x8B, 0x8F, 0x81, 0x71, 0x75, 0x75, 0x77, 0x7B, 
-    0x7D, 0x7E, 0x83, 0x89, 0x83, 0x7F, 0x81, 0x7B, 0x7A, 0x7E, 0x7F, 0x7E, 
-    0x87, 0x8F, 0x86, 0x81, 0x87, 0x86, 0x80, 0x89, 0x91, 0x8E, 0x88, 0x74, 
-    0x78, 0x7D, 0x86, 0x9C, 0x91, 0x8C, 0x8B, 0x8A, 0x88, 0x86, 0x87, 0x78, 
-    0x7B, 0x72, 0x70, 0x7C, 0x76, 0x71, 0x70, 0x71, 0x6D, 0x72, 0x7F, 0x83, 
-    0x7B, 0x73, 0x7A, 0x85, 0x87, 0x86, 0x83, 0x7E, 0x7E, 0x80, 0x7F, 0x80, 
-    0x80, 0x7D, 0x7C, 0x7C, 0x80, 0x80, 0x7D, 0x80, 0x88, 0x8E, 0x90, 0x8F, 
-    0x88, 0x80, 0x80, 0x7D, 0x7A, 0x80, 0x84, 0x75, 0x6D, 0x78, 0x81, 0x90, 
-    0x9A, 0x8D, 0x8B, 0x8A, 0x89, 0x89, 0x82, 0x75, 0x77, 0x74, 0x72, 0x7D, 
-    0x83, 0x7B, 0x79, 0x7D, 0x74, 0x70, 0x78, 0x7C, 0x7C, 0x76, 0x74, 0x7D, 
-    0x83, 0x89, 0x8F, 0x8A, 0x83, 0x83, 0x82, 0x80, 0x81, 0x85, 0x84, 0x81, 
-    0x7C, 0x7E, 0x83, 0x81, 0x7C, 0x7F, 0x86, 0x84, 0x7E, 0x82, 0x84, 0x7C, 
-    0x79, 0x7C, 0x7A, 0x77, 0x7A, 0x7B, 0x7D, 0x7D, 0x98, 0xA4, 0x91, 0x95, 
-    0x90, 0x90, 0x8A, 0x84, 0x79, 0x77, 0x78, 0x78, 0x81, 0x81, 0x7B, 0x7E, 
-    0x79, 0x75, 0x74, 0x77, 0x79, 0x79, 0x76, 0x73, 0x7A, 0x7E, 0x83, 0x85, 
-    0x7E, 0x72, 0x72, 0x77, 0x78, 0x7A, 0x7C, 0x7D, 0x7D, 0x7D, 0x81, 0x87, 
-    0x86, 0x84, 0x8A, 0x91, 0x89, 0x83, 0x87, 0x81, 0x7D, 0x7F, 0x7D, 0x7A, 
-    0x7A, 0x7E, 0x7E, 0x80, 0x82, 0x92, 0xA3, 0x92, 0x93, 0x91, 0x8E, 0x8C, 
-    0x88, 0x88, 0x81, 0x77, 0x73, 0x78, 0x7B, 0x73, 0x77, 0x73, 0x6E, 0x72, 
-    0x74, 0x7B, 0x7B, 0x7A, 0x78, 0x7C, 0x81, 0x84, 0x87, 0x85, 0x80, 0x78, 
-    0x72, 0x76, 0x78, 0x78, 0x79, 0x7B, 0x7F, 0x8E, 0x9B, 0x90, 0x87, 0x8B, 
-    0x8A, 0x86, 0x83, 0x82, 0x7E, 0x79, 0x80, 0x81, 0x74, 0x74, 0x74, 0x6F, 
-    0x6E, 0x74, 0x7C, 0x8B, 0xA3, 0x95, 0x91, 0x92, 0x8F, 0x8C, 0x85, 0x88, 
-    0x79, 0x7A, 0x7C, 0x74, 0x7A, 0x76, 0x77, 0x70, 0x6C, 0x73, 0x78, 0x85, 
-    0x89, 0x89, 0x85, 0x86, 0x8D, 0x8B, 0x88, 0x83, 0x7F, 0x76, 0x70, 0x76, 
-    0x7A, 0x80, 0x79, 0x77, 0x7B, 0x7E, 0x80, 0x7E, 0x85, 0x84, 0x83, 0x8D, 
-    0x88, 0x82, 0x87, 0x8A, 0x81, 0x77, 0x79, 0x79, 0x77, 0x77, 0x7A, 0x7D, 
-    0x80, 0x8F, 0xA3, 0x92, 0x92, 0x91, 0x8C, 0x8A, 0x88, 0x89, 0x81, 0x7C, 
-    0x77, 0x73, 0x77, 0x74, 0x76, 0x74, 0x71, 0x72, 0x6E, 0x71, 0x77, 0x7A, 
-    0x7C, 0x83, 0x86, 0x83, 0x82, 0x81, 0x7D, 0x77, 0x78, 0x7F, 0x7E, 0x7A, 
-    0x7D, 0x80, 0x7E, 0x7D, 0x81, 0x83, 0x87, 0x90, 0x95, 0x90, 0x89, 0x8B, 
-    0x8C, 0x85, 0x7F, 0x7F, 0x79, 0x6E, 0x6E, 0x72, 0x78, 0x7B, 0x8A, 0x9D, 
-    0x8D, 0x8F, 0x8E, 0x8D, 0x8B, 0x87, 0x88, 0x7B, 0x79, 0x78, 0x79, 0x7D, 
-    0x76, 0x73, 0x6E, 0x70, 0x75, 0x73, 0x74, 0x75, 0x77, 0x79, 0x83, 0x8B, 
-    0x8D, 0x90, 0x8C, 0x82, 0x7C, 0x7F, 0x84, 0x7F, 0x7B, 0x7D, 0x7E, 0x7C, 
-    0x82, 0x86, 0x82, 0x80, 0x85, 0x85, 0x81, 0x83, 0x88, 0x87, 0x80, 0x7C, 
-    0x80, 0x7D, 0x75, 0x72, 0x75, 0x77, 0x7B, 0x81, 0x97, 0x9E, 0x91, 0x92, 
-    0x8E, 0x8E, 0x89, 0x88, 0x86, 0x7D, 0x7B, 0x78, 0x7C, 0x7C, 0x76, 0x73, 
-    0x6D, 0x6D, 0x71, 0x71, 0x72, 0x75, 0x79, 0x7C, 0x7F, 0x82, 0x84, 0x82, 
-    0x7B, 0x77, 0x7A, 0x7E, 0x7D, 0x7E, 0x80, 0x7F, 0x7F, 0x82, 0x84, 0x83, 
-    0x86, 0x89, 0x87, 0x82, 0x85, 0x8B, 0x8B, 0x87, 0x8A, 0x8F, 0x8A, 0x7B, 
-    0x76, 0x76, 0x78, 0x7A, 0x7D, 0x8B, 0x9F, 0x94, 0x8F, 0x90, 0x8D, 0x8B, 
-    0x85, 0x86, 0x7D, 0x77, 0x79, 0x79, 0x7B, 0x74, 0x74, 0x71, 0x6E, 0x72, 
-    0x72, 0x73, 0x76, 0x7A, 0x79, 0x7B, 0x81, 0x84, 0x83, 0x7B, 0x7A, 0x7D, 
-    0x7D, 0x7E, 0x80, 0x81, 0x80, 0x82, 0x84, 0x82, 0x81, 0x84, 0x89, 0x87, 
-    0x83, 0x86, 0x8A, 0x84, 0x7E, 0x81, 0x85, 0x7F, 0x75, 0x72, 0x72, 0x75, 
-    0x77, 0x7A, 0x80, 0x93, 0x9D, 0x8F, 0x91, 0x90, 0x8F, 0x8B, 0x89, 0x81, 
-    0x77, 0x7B, 0x7A, 0x7C, 0x7C, 0x7B, 0x7B, 0x76, 0x78, 0x79, 0x79, 0x79, 
-    0x7B, 0x7A, 0x79, 0x85, 0x89, 0x84, 0x7F, 0x7F, 0x7C, 0x77, 0x7A, 0x7C, 
-    0x7B, 0x7A, 0x7D, 0x7F, 0x7E, 0x7F, 0x85, 0x88, 0x85, 0x85, 0x89, 0x8A, 
-    0x84, 0x7F, 0x83, 0x86, 0x81, 0x7B, 0x78, 0x76, 0x77, 0x79, 0x7B, 0x7F, 
-    0x8C, 0xA0, 0x93, 0x90, 0x91, 0x8F, 0x8C, 0x87, 0x88, 0x81, 0x7C, 0x7B, 
-    0x78, 0x7C, 0x7A, 0x79, 0x74, 0x71, 0x72, 0x70, 0x71, 0x71, 0x71, 0x74, 
-    0x7F, 0x85, 0x82, 0x80, 0x7E, 0x79, 0x75, 0x77, 0x7B, 0x7B, 0x7C, 0x80, 
-    0x83, 0x82, 0x84, 0x89, 0x8B, 0x89, 0x8A, 0x8E, 0x8C, 0x86, 0x85, 0x88, 
-    0x89, 0x85, 0x81, 0x79, 0x72, 0x70, 0x73, 0x76, 0x79, 0x7F, 0x8D, 0x9E, 
-    0x93, 0x91, 0x90, 0x8D, 0x8A, 0x85, 0x84, 0x7A, 0x7B, 0x7A, 0x77, 0x76, 
-    0x72, 0x76, 0x74, 0x70, 0x73, 0x77, 0x7A, 0x79, 0x7F, 0x84, 0x89, 0x88, 
-    0x85, 0x83, 0x7F, 0x7D, 0x7E, 0x7E, 0x7A, 0x7B, 0x7F, 0x7D, 0x7A, 0x7C, 
-    0x82, 0x84, 0x83, 0x86, 0x8C, 0x8D, 0x88, 0x86, 0x86, 0x83, 0x81, 0x7F, 
-    0x77, 0x71, 0x70, 0x72, 0x79, 0x86, 0x83, 0x7F, 0x91, 0x92, 0x81, 0x91, 
-    0x91, 0x8B, 0x88, 0x87, 0x7A, 0x70, 0x7E, 0x7D, 0x6F, 0x69, 0x70, 0x78, 
-    0x72, 0x7C, 0x97, 0x93, 0x88, 0x88, 0x7E, 0x77, 0x85, 0x8E, 0x80, 0x76, 
-    0x80, 0x7F, 0x77, 0x79, 0x82, 0x85, 0x7D, 0x75, 0x79, 0x84, 0x85, 0x7F, 
-    0x7F, 0x85, 0x86, 0x8A, 0x90, 0x8D, 0x8C, 0x86, 0x79, 0x69, 0x67, 0x6D, 
-    0x70, 0x70, 0x74, 0x82, 0x95, 0x94, 0x8D, 0x8D, 0x89, 0x89, 0x84, 0x7C, 
-    0x78, 0x79, 0x7E, 0x84, 0x86, 0x82, 0x83, 0x82, 0x76, 0x70, 0x75, 0x73, 
-    0x73, 0x77, 0x77, 0x79, 0x7E, 0x81, 0x84, 0x85, 0x84, 0x83, 0x83, 0x84, 
-    0x8A, 0x8E, 0x95, 0x95, 0x90, 0x8A, 0x7C, 0x6F, 0x6A, 0x6F, 0x74, 0x77, 
-    0x85, 0xA2, 0x9A, 0x92, 0x91, 0x8D, 0x88, 0x80, 0x62, 0x5F, 0x6D, 0x71, 
-    0x72, 0x7A, 0x85, 0x93, 0x97, 0x8A, 0x89, 0x82, 0x7F, 0x80, 0x7E, 0x7F, 
-    0x86, 0x83, 0x84, 0x8C, 0x86, 0x7A, 0x75, 0x6B, 0x66, 0x71, 0x76, 0x79, 
-    0x84, 0x88, 0x7D, 0x76, 0x7B, 0x86, 0x83, 0x81, 0x7A, 0x75, 0x84, 0x96, 
-    0x91, 0x85, 0x83, 0x7D, 0x6E, 0x6C, 0x77, 0x7E, 0x7D, 0x78, 0x7C, 0x8B, 
-    0x9A, 0x95, 0x8C, 0x84, 0x6F, 0x66, 0x6C, 0x73, 0x79, 0x79, 0x7F, 0x80, 
-    0x8C, 0x9F, 0x9C, 0x93, 0x8D, 0x85, 0x76, 0x77, 0x7B, 0x7E, 0x89, 0x8A, 
-    0x85, 0x91, 0x93, 0x87, 0x81, 0x86, 0x82, 0x80, 0x80, 0x7A, 0x66, 0x65, 
-    0x6A, 0x6E, 0x6C, 0x7C, 0x99, 0x76, 0x83, 0x96, 0x8B, 0x8B, 0x87, 0x8A, 
-    0x80, 0x80, 0x4B, 0x6A, 0x70, 0x70, 0x6F, 0x9B, 0x9A, 0x8A, 0x95, 0x88, 
-    0x91, 0x8C, 0x7E, 0x8D, 0x68, 0x57, 0x78, 0x7B, 0x66, 0x77, 0xA4, 0x82, 
-    0x89, 0x6C, 0x61, 0xA9, 0x8F, 0x8B, 0x5B, 0x6D, 0x84, 0x69, 0xA2, 0x9A, 
-    0x88, 0x75, 0x7B, 0xA4, 0x8E, 0x75, 0x6F, 0x79, 0x7B, 0xA9, 0x93, 0x9A, 
-    0x90, 0x8D, 0x7F, 0x42, 0x7B, 0x74, 0x76, 0x7B, 0x68, 0xAD, 0x98, 0x67, 
-    0x7A, 0x6F, 0x7F, 0x62, 0x94, 0x9F, 0x8C, 0xA3, 0x88, 0x95, 0x8C, 0x82, 
-    0x8C, 0x60, 0x47, 0x80, 0x8A, 0x58, 0x6D, 0x78, 0x73, 0x6E, 0x96, 0x95, 
-    0x81, 0x90, 0x7B, 0x84, 0x86, 0x84, 0x96, 0x4D, 0x8E, 0x82, 0x46, 0x6D, 
-    0x8F, 0xA3, 0x65, 0x93, 0x66, 0x49, 0xA4, 0x8E, 0x88, 0x82, 0x83, 0x99, 
-    0x67, 0x58, 0x82, 0x76, 0x74, 0x68, 0xB6, 0x76, 0x6C, 0x9D, 0x6D, 0x8F, 
-    0x7B, 0xA6, 0xA2, 0x8F, 0xA2, 0x87, 0xA3, 0x88, 0x97, 0x8D, 0x65, 0x85, 
-    0x56, 0x6F, 0x81, 0xA9, 0x81, 0x8B, 0x7B, 0x4E, 0x7B, 0x64, 0x8E, 0x9B, 
-    0x6A, 0xA1, 0x87, 0x95, 0x89, 0x8B, 0x53, 0x5F, 0x74, 0x6A, 0xAA, 0x6A, 
-    0x68, 0x85, 0x70, 0x98, 0x9E, 0x95, 0x87, 0x85, 0x90, 0x4F, 0x7E, 0x7A, 
-    0x79, 0x7C, 0x7B, 0xA9, 0x5C, 0x6D, 0x7F, 0x70, 0x75, 0x69, 0xA0, 0x98, 
-    0x8F, 0x9B, 0x85, 0x98, 0x7C, 0x8E, 0x79, 0x81, 0x64, 0x4E, 0x78, 0x62, 
-    0x8E, 0x81, 0x5C, 0x7F, 0x68, 0x80, 0x97, 0x9A, 0x8A, 0x86, 0x92, 0x7F, 
-    0x8B, 0x93, 0x7B, 0x57, 0x6A, 0x72, 0x9C, 0x8C, 0x7E, 0x91, 0x6E, 0x47, 
-    0x85, 0xA2, 0x8C, 0x8B, 0x84, 0x84, 0x77, 0x97, 0x58, 0x6F, 0x76, 0x65, 
-    0x76, 0x71, 0x88, 0x89, 0x81, 0x84, 0x80, 0x8D, 0xAC, 0xA5, 0x96, 0x8E, 
-    0x9F, 0x98, 0x8D, 0x98, 0x8F, 0x8C, 0x69, 0x56, 0x70, 0x88, 0xA0, 0x79, 
-    0x89, 0x6E, 0x4F, 0x72, 0x65, 0x87, 0xA1, 0x74, 0x7C, 0x93, 0x8B, 0x92, 
-    0x84, 0x51, 0x66, 0x66, 0x79, 0xA4, 0x7F, 0x5E, 0x80, 0x79, 0x81, 0xA9, 
-    0x96, 0x8A, 0x82, 0x8F, 0x67, 0x67, 0x8C, 0x6E, 0xA6, 0x86, 0x59, 0x70, 
-    0x6E, 0x7D, 0x71, 0x6B, 0x7F, 0xA6, 0x8E, 0x88, 0x9A, 0x90, 0x88, 0x85, 
-    0x83, 0x77, 0x90, 0x6F, 0x45, 0x7D, 0x60, 0x89, 0xA0, 0x50, 0x71, 0x72, 
-    0x76, 0x7C, 0xA9, 0x97, 0x89, 0x96, 0x7E, 0x8E, 0x8F, 0x53, 0x8F, 0x6B, 
-    0x84, 0x93, 0x86, 0x86, 0x7E, 0x92, 0x36, 0x9D, 0x98, 0x73, 0x98, 0x70, 
-    0x97, 0x55, 0x62, 0x7B, 0x92, 0xA6, 0x43, 0x78, 0x6D, 0x78, 0x8D, 0x6C, 
-    0x8F, 0x78, 0x89, 0xAA, 0x9A, 0xA5, 0x94, 0xA0, 0x88, 0x87, 0x97, 0x8C, 
-    0x95, 0x60, 0x5E, 0x6F, 0x81, 0xA4, 0x7A, 0x89, 0x7A, 0x49, 0x6A, 0x6C, 
-    0x8A, 0x6A, 0x8C, 0xA4, 0x7B, 0x9E, 0x89, 0x9F, 0x65, 0x4C, 0x7B, 0x59, 
-    0xA6, 0x8A, 0x5E, 0x88, 0x6E, 0xB5, 0x85, 0x98, 0x8E, 0x82, 0x78, 0x45, 
-    0x94, 0x72, 0x8D, 0xA9, 0x7F, 0x67, 0x5B, 0x84, 0x65, 0x78, 0x6D, 0x98, 
-    0x97, 0x7C, 0x9A, 0x90, 0x8F, 0x85, 0x81, 0x79, 0x79, 0x8C, 0x74, 0x4E, 
-    0x69, 0x6F, 0x68, 0xA1, 0x72, 0x58, 0x74, 0x71, 0x79, 0x93, 0xAB, 0x8D, 
-    0x8E, 0x89, 0x87, 0x95, 0x61, 0x9C, 0x91, 0x79, 0x7B, 0x8C, 0x68, 0x50, 
-    0xAF, 0x78, 0x7E, 0x8D, 0x80, 0x88, 0x85, 0x53, 0x66, 0x72, 0x83, 0xA8, 
-    0x81, 0x97, 0x66, 0x6E, 0x72, 0x73, 0x8A, 0x68, 0x8E, 0x7C, 0xA5, 0xAD, 
-    0x99, 0xAC, 0x8F, 0x93, 0x87, 0x8A, 0x93, 0x7D, 0x96, 0x70, 0x56, 0x7F, 
-    0x9E, 0x8E, 0x6A, 0x81, 0x7A, 0x42, 0x61, 0x8F, 0x98, 0x4E, 0x6F, 0x8C, 
-    0x9E, 0x89, 0x92, 0x8E, 0x77, 0x4A, 0x6B, 0x6A, 0x7D, 0x81, 0x81, 0x78, 
-    0x80, 0xB5, 0x98, 0x96, 0x97, 0x52, 0x73, 0x77, 0x85, 0xB0, 0x91, 0x98, 
-    0x4B, 0x77, 0x6E, 0x7C, 0x76, 0x6F, 0xA6, 0x73, 0x86, 0x93, 0x92, 0x92, 
-    0x7F, 0x83, 0x6B, 0x83, 0x7A, 0x7D, 0x6A, 0x41, 0x77, 0x5E, 0x73, 0x70, 
-    0x72, 0x71, 0x72, 0x77, 0x8C, 0xB0, 0x92, 0x8E, 0x8F, 0x8B, 0x8E, 0x8F, 
-    0x8F, 0x84, 0x8F, 0x4B, 0x60, 0x75, 0x93, 0x9A, 0x7C, 0x88, 0x81, 0x84, 
-    0x89, 0x70, 0x58, 0x77, 0x6C, 0x90, 0x9F, 0x91, 0xA1, 0x58, 0x70, 0x72, 
-    0x78, 0x85, 0x75, 0x90, 0x6B, 0xAA, 0xB5, 0x92, 0xAE, 0x8F, 0x93, 0x80, 
-    0x8C, 0x8D, 0x8F, 0x66, 0x86, 0xA1, 0x57, 0x61, 0xA5, 0x81, 0x77, 0x64, 
-    0x5E, 0x63, 0x6F, 0x73, 0x70, 0x81, 0x76, 0xAD, 0x94, 0x84, 0x9B, 0x8A, 
-    0x49, 0x73, 0x6F, 0x88, 0xAE, 0x8D, 0x61, 0x6D, 0xA3, 0x98, 0x8D, 0x7D, 
-    0x54, 0x7E, 0x66, 0xAA, 0x92, 0x95, 0x69, 0x58, 0x72, 0x5C, 0x8A, 0x68, 
-    0x95, 0x8C, 0x71, 0x92, 0x86, 0x9F, 0x82, 0x83, 0x7F, 0x74, 0x87, 0x80, 
-    0x81, 0x82, 0x5D, 0x4E, 0x66, 0x74, 0x8B, 0x50, 0x79, 0x6E, 0x78, 0x76, 
-    0x9C, 0xB3, 0x87, 0x97, 0x8A, 0x8A, 0x96, 0x8B, 0x9B, 0x6B, 0x56, 0x6C, 
-    0x88, 0xAB, 0x7F, 0x96, 0x7C, 0x84, 0x81, 0x84, 0x5D, 0x6C, 0x7A, 0x65, 
-    0xA2, 0x9C, 0x9A, 0x94, 0x51, 0x7C, 0x69, 0x80, 0x79, 0x7E, 0xB5, 0x82, 
-    0x71, 0xA9, 0xA5, 0x9D, 0x85, 0x89, 0x86, 0x7E, 0x8F, 0x88, 0x88, 0x8B, 
-    0x62, 0x68, 0x79, 0x55, 0x7F, 0x8D, 0x7C, 0x73, 0x4B, 0x75, 0x74, 0x76, 
-    0x74, 0x76, 0xAD, 0x85, 0x96, 0x93, 0x90, 0x64, 0x64, 0x70, 0x87, 0xA6, 
-    0x8C, 0x89, 0x5F, 0x75, 0x97, 0x98, 0x5B, 0x79, 0x77, 0xA1, 0x87, 0x97, 
-    0x91, 0x5B, 0x7D, 0x61, 0x70, 0x78, 0x74, 0xAC, 0x77, 0x8A, 0x8A, 0x89, 
-    0x93, 0x7C, 0x8A, 0x76, 0x70, 0x8B, 0x80, 0x84, 0x7F, 0x81, 0x47, 0x5B, 
-    0x6E, 0x66, 0x70, 0x67, 0x78, 0x71, 0x7E, 0x86, 0x86, 0xA5, 0x9A, 0x93, 
-    0x8C, 0x8C, 0x9D, 0x8F, 0x8A, 0x60, 0x79, 0x9B, 0x93, 0x8B, 0x83, 0x8C, 
-    0x7C, 0x83, 0x6C, 0x51, 0x84, 0x66, 0x81, 0xA4, 0x84, 0xA5, 0x6D, 0x60, 
-    0x7A, 0x6E, 0x81, 0x65, 0xAA, 0x93, 0x93, 0x8B, 0x74, 0xBC, 0x83, 0x8C, 
-    0x84, 0x85, 0x8A, 0x82, 0x90, 0x7D, 0x8B, 0x87, 0x5A, 0x59, 0x62, 0x6C, 
-    0x9A, 0x7A, 0x83, 0x76, 0x54, 0x74, 0x6F, 0x78, 0x75, 0xA8, 0x8D, 0x83, 
-    0x98, 0x95, 0x82, 0x54, 0x74, 0x77, 0xA8, 0x83, 0x99, 0x70, 0x5E, 0x8B, 
-    0x6E, 0x85, 0x75, 0xA3, 0x9C, 0x78, 0xA9, 0x62, 0x7C, 0x7C, 0x6D, 0x79, 
-    0x65, 0x8A, 0x9C, 0x91, 0x8B, 0x8B, 0x8D, 0x80, 0x81, 0x8D, 0x5E, 0x69, 
-    0xA3, 0x78, 0x89, 0x80, 0x89, 0x73, 0x3C, 0x75, 0x54, 0x99, 0x80, 0x46, 
-    0x82, 0x64, 0x90, 0x6F, 0x81, 0xB4, 0x80, 0x92, 0x7A, 0x99, 0x92, 0x86, 
-    0x8E, 0x7D, 0x8B, 0x88, 0x84, 0x7E, 0x7D, 0x7E, 0x77, 0x47, 0x63, 0x77, 
-    0x6C, 0xA1, 0x92, 0x85, 0x98, 0x61, 0x68, 0x77, 0x79, 0x7C, 0x6C, 0x9B, 
-    0x9F, 0xA3, 0x88, 0x5D, 0xC0, 0x8E, 0x8D, 0x95, 0x87, 0x9B, 0x86, 0x8E, 
-    0x87, 0x8A, 0x94, 0x5E, 0x55, 0x63, 0x73, 0xA8, 0x76, 0x87, 0x87, 0x4F, 
-    0x68, 0x73, 0x6F, 0x9B, 0x94, 0x88, 0x7D, 0x95, 0x91, 0x8A, 0x85, 0x49, 
-    0x69, 0x9C, 0x84, 0x93, 0x72, 0x58, 0x81, 0x6B, 0x75, 0x84, 0xB5, 0x82, 
-    0x86, 0x91, 0x57, 0x82, 0x7F, 0x6E, 0x79, 0x68, 0x80, 0xA7, 0x95, 0x8B, 
-    0x91, 0x8B, 0x78, 0x86, 0x88, 0x71, 0x58, 0x7F, 0x92, 0x8C, 0x83, 0x8A, 
-    0x85, 0x41, 0x6D, 0x63, 0x89, 0xA1, 0x63, 0x5F, 0x73, 0x7F, 0x7A, 0x7F, 
-    0xB0, 0x81, 0x8D, 0x7B, 0x8F, 0x9A, 0x84, 0x94, 0x83, 0x7C, 0x85, 0x87, 
-    0x80, 0x75, 0x86, 0x69, 0x3B, 0x75, 0x64, 0x9F, 0x98, 0x7D, 0x96, 0x5E, 
-    0x69, 0x75, 0x75, 0x7D, 0x71, 0x7E, 0x8B, 0xB2, 0x99, 0xA0, 0x82, 0x60, 
-    0x8D, 0xA3, 0x94, 0x92, 0x9C, 0x8C, 0x86, 0x92, 0x83, 0x97, 0x53, 0x5A, 
-    0x6A, 0x6E, 0xA7, 0x88, 0x93, 0x77, 0x53, 0x6C, 0x63, 0xB2, 0x86, 0x83, 
-    0x84, 0x81, 0x94, 0x84, 0x93, 0x8C, 0x6B, 0x40, 0x90, 0x91, 0x82, 0x8A, 
-    0x47, 0x73, 0x69, 0x72, 0x8A, 0xAA, 0x8C, 0x81, 0x76, 0x52, 0x85, 0x82, 
-    0x75, 0x73, 0x75, 0x74, 0xA9, 0xA6, 0x8A, 0x99, 0x8B, 0x7C, 0x84, 0x87, 
-    0x86, 0x5E, 0x63, 0x88, 0x9E, 0x82, 0x8B, 0x96, 0x49, 0x63, 0x66, 0x83, 
-    0x9E, 0x86, 0x62, 0x5C, 0x84, 0x71, 0x87, 0xA9, 0x83, 0x8C, 0x77, 0x89, 
-    0x96, 0x8C, 0x91, 0x85, 0x80, 0x77, 0x85, 0x88, 0x72, 0x8B, 0x5A, 0x43, 
-    0x71, 0x73, 0xAF, 0x7D, 0x99, 0x5E, 0x58, 0x86, 0x69, 0x89, 0x6F, 0x83, 
-    0x76, 0x7B, 0xC3, 0x96, 0xA9, 0x94, 0x60, 0x73, 0x7B, 0xBC, 0x96, 0x96, 
-    0x91, 0x88, 0x90, 0x83, 0x9B, 0x55, 0x5F, 0x69, 0x72, 0xA3, 0x80, 0xA5, 
-    0x6A, 0x51, 0x68, 0x7F, 0xA4, 0x7B, 0x80, 0x47, 0x74, 0xAB, 0x87, 0x9D, 
-    0x87, 0x92, 0x59, 0x5D, 0xAC, 0x7B, 0x9C, 0x3D, 0x6B, 0x75, 0x64, 0xAA, 
-    0x9E, 0x89, 0x8A, 0x64, 0x59, 0x73, 0x87, 0x76, 0x6E, 0x7A, 0x6F, 0xAB, 
-    0xA3, 0x93, 0x93, 0x82, 0x81, 0x7F, 0x87, 0x7E, 0x5F, 0x6C, 0x8B, 0x9A, 
-    0x83, 0x8C, 0x97, 0x66, 0x4A, 0x64, 0x88, 0x97, 0x8B, 0x66, 0x5B, 0x7D, 
-    0x77, 0x78, 0x98, 0x9C, 0x81, 0x81, 0x85, 0x93, 0x91, 0x91, 0x89, 0x80, 
-    0x7E, 0x80, 0x8B, 0x7A, 0x85, 0x63, 0x44, 0x72, 0xA0, 0x8D, 0x81, 0x95, 
-    0x50, 0x60, 0x7D, 0x73, 0x7E, 0x74, 0x81, 0x73, 0x7F, 0xB9, 0xA9, 0x9D, 
-    0x92, 0x80, 0x5D, 0x79, 0x8F, 0x82, 0xA5, 0xA0, 0x8E, 0x8B, 0x98, 0x93, 
-    0x5B, 0x6C, 0x8A, 0x95, 0x7D, 0x86, 0x9F, 0x5E, 0x57, 0x81, 0x92, 0x77, 
-    0x8D, 0x5C, 0x50, 0x70, 0x87, 0xA7, 0x81, 0x94, 0x82, 0x7F, 0x7B, 0x83, 
-    0x8A, 0x7C, 0x56, 0x51, 0x6E, 0x71, 0x91, 0xA8, 0x7F, 0x91, 0x4D, 0x68, 
-    0x75, 0x76, 0x7A, 0x6A, 0x83, 0x74, 0xB6, 0xA1, 0x91, 0x9C, 0x7F, 0x82, 
-    0x7F, 0x8B, 0x86, 0x69, 0x83, 0x86, 0x8F, 0x82, 0x8D, 0x8C, 0x71, 0x7B, 
-    0x6D, 0x7E, 0x7B, 0x89, 0x52, 0x4D, 0x74, 0x67, 0x76, 0x6D, 0x7B, 0x94, 
-    0x8E, 0x92, 0x8E, 0x98, 0x96, 0x90, 0x8D, 0x83, 0x93, 0x87, 0x89, 0x79, 
-    0x55, 0x74, 0xA1, 0x91, 0x7F, 0x8D, 0x8D, 0x4C, 0x70, 0x78, 0x76, 0x7B, 
-    0x72, 0x7F, 0x76, 0x87, 0xBC, 0x9C, 0x97, 0x8D, 0x9B, 0x61, 0x68, 0x95, 
-    0x6A, 0x9E, 0x9E, 0x88, 0x8E, 0x93, 0x78, 0x52, 0x9D, 0x8A, 0x81, 0x85, 
-    0x84, 0x71, 0x55, 0x84, 0x99, 0x7F, 0x72, 0x85, 0x63, 0x3E, 0x77, 0x76, 
-    0xA0, 0x84, 0x8E, 0x82, 0x7F, 0x8F, 0x7A, 0x80, 0x7B, 0x50, 0x55, 0x6C, 
-    0x78, 0x86, 0xA2, 0x99, 0x74, 0x50, 0x7D, 0x73, 0x7A, 0x72, 0x7C, 0x7B, 
-    0x9A, 0xB1, 0x97, 0x9D, 0x91, 0x89, 0x7A, 0x80, 0x8D, 0x84, 0x87, 0x7E, 
-    0x84, 0x64, 0x64, 0x7C, 0x8E, 0x85, 0x7A, 0x81, 0x80, 0x7F, 0x57, 0x6B, 
-    0x6F, 0x6F, 0x70, 0x75, 0x80, 0x81, 0x81, 0x94, 0xA7, 0x92, 0x95, 0x97, 
-    0x98, 0x90, 0x94, 0x8C, 0x91, 0x6F, 0x5C, 0x7B, 0xA3, 0x8C, 0x85, 0x88, 
-    0x86, 0x7E, 0x4A, 0x74, 0x74, 0x71, 0x6C, 0x73, 0x7C, 0xA6, 0x9A, 0x8F, 
-    0x8A, 0x8E, 0x80, 0x8D, 0x6E, 0x57, 0x82, 0x6C, 0x7F, 0xA6, 0x87, 0x96, 
-    0x7A, 0x4F, 0x7D, 0x9F, 0x8A, 0x7C, 0x9A, 0x5E, 0x62, 0x84, 0x98, 0x95, 
-    0x81, 0x77, 0x7A, 0x70, 0x45, 0x7E, 0x6F, 0x84, 0xA3, 0x7E, 0x8D, 0x8C, 
-    0x94, 0x7B, 0x4C, 0x6C, 0x6E, 0x8C, 0x6C, 0x86, 0xAB, 0x99, 0x7D, 0x5F, 
-    0x7D, 0x77, 0x79, 0x6F, 0x79, 0x82, 0x89, 0xBA, 0x95, 0x9B, 0x98, 0x87, 
-    0x88, 0x7B, 0x8C, 0x83, 0x82, 0x81, 0x76, 0x89, 0x4D, 0x6B, 0x68, 0x6C, 
-    0xA1, 0x76, 0x87, 0x88, 0x60, 0x63, 0x70, 0xA7, 0x85, 0x56, 0x70, 0x6F, 
-    0x83, 0x75, 0x80, 0xB0, 0x8E, 0x90, 0x8F, 0x8F, 0x99, 0x8C, 0x8C, 0x81, 
-    0x57, 0x6E, 0x7F, 0xAC, 0x85, 0x87, 0x86, 0x86, 0x77, 0x49, 0x79, 0x6F, 
-    0x6D, 0x70, 0x6C, 0x98, 0xAA, 0x94, 0x91, 0x87, 0x90, 0x7C, 0x8E, 0x81, 
-    0x51, 0x7A, 0x6F, 0x75, 0x9D, 0xA0, 0x78, 0x61, 0x6B, 0x90, 0x9B, 0x88, 
-    0x8F, 0x93, 0x5D, 0x6A, 0x88, 0xA8, 0x8C, 0x8A, 0x7A, 0x70, 0x89, 0x77, 
-    0x59, 0x71, 0x66, 0x87, 0x96, 0x85, 0x96, 0x87, 0x8A, 0x47, 0x66, 0x7A, 
-    0xA0, 0x96, 0x7A, 0x98, 0x78, 0x5E, 0x7E, 0x72, 0x79, 0x67, 0x76, 0x6D, 
-    0x7D, 0x93, 0xAF, 0x9D, 0x8F, 0x91, 0x8C, 0x89, 0x8B, 0x8F, 0x80, 0x80, 
-    0x82, 0x76, 0x88, 0x50, 0x68, 0x67, 0x6B, 0xA1, 0x7C, 0x8C, 0x89, 0x5F, 
-    0x60, 0x70, 0xAD, 0x83, 0x87, 0x57, 0x64, 0x82, 0x6E, 0x84, 0x82, 0xA5, 
-    0x90, 0x8D, 0x92, 0x8E, 0xA1, 0x81, 0x8A, 0x55, 0x66, 0x91, 0xA7, 0x8A, 
-    0x89, 0x8C, 0x89, 0x72, 0x4C, 0x75, 0x6F, 0x6B, 0x70, 0x6D, 0x8D, 0xB2, 
-    0x98, 0x8D, 0x8C, 0x8F, 0x82, 0x83, 0x90, 0x62, 0x61, 0x78, 0x6B, 0x84, 
-    0x72, 0x87, 0x79, 0x6F, 0xA7, 0x8C, 0x95, 0x8D, 0x96, 0x64, 0x65, 0x97, 
-    0xA2, 0x8C, 0x8B, 0x81, 0x81, 0x77, 0x8C, 0x65, 0x4F, 0x71, 0x67, 0x9B, 
-    0x83, 0x93, 0x89, 0x83, 0x58, 0x56, 0x7D, 0x9C, 0x8C, 0x7F, 0x89, 0x79, 
-    0x5E, 0x7F, 0x76, 0x7B, 0x67, 0x71, 0x73, 0x75, 0x91, 0xB0, 0x9D, 0x91, 
-    0x92, 0x91, 0x8D, 0x8F, 0x90, 0x7F, 0x84, 0x80, 0x7B, 0x81, 0x4D, 0x71, 
-    0x61, 0x6E, 0x9D, 0x81, 0x8A, 0x8B, 0x6A, 0x57, 0x75, 0xAC, 0x80, 0x8F, 
-    0x69, 0x52, 0x83, 0x6D, 0x85, 0x81, 0x7A, 0x9A, 0x9C, 0x8D, 0x94, 0xA1, 
-    0x92, 0x82, 0x63, 0x64, 0x9E, 0xAC, 0x80, 0x8F, 0x89, 0x8D, 0x71, 0x4E, 
-    0x72, 0x6B, 0x6D, 0x65, 0x77, 0x7D, 0xAD, 0xA3, 0x84, 0x8F, 0x90, 0x85, 
-    0x87, 0x84, 0x8A, 0x70, 0x5B, 0x6A, 0x77, 0x75, 0x79, 0x78, 0x77, 0x9E, 
-    0x88, 0x8B, 0x88, 0x98, 0x65, 0x5E, 0x9B, 0x96, 0x8F, 0x89, 0x81, 0x87, 
-    0x6F, 0x8A, 0x69, 0x47, 0x73, 0x5E, 0x9C, 0x85, 0x90, 0x90, 0x84, 0x60, 
-    0x52, 0x87, 0xA0, 0x88, 0x85, 0x85, 0x8B, 0x57, 0x7D, 0x7A, 0x7A, 0x6D, 
-    0x6C, 0x7B, 0x72, 0x91, 0xB5, 0x98, 0x98, 0x91, 0x96, 0x8F, 0x8E, 0x93, 
-    0x7E, 0x88, 0x7E, 0x82, 0x6E, 0x51, 0x79, 0x5B, 0x72, 0x9A, 0x87, 0x87, 
-    0x8A, 0x80, 0x4B, 0x7A, 0xA6, 0x86, 0x88, 0x80, 0x53, 0x70, 0x73, 0x7B, 
-    0x81, 0x70, 0x8F, 0xA4, 0x84, 0x95, 0x9A, 0x96, 0x7E, 0x5B, 0x78, 0xA1, 
-    0x9E, 0x87, 0x87, 0x8D, 0x8C, 0x5B, 0x5A, 0x71, 0x6B, 0x6B, 0x64, 0x7D, 
-    0x74, 0xAE, 0xA2, 0x83, 0x97, 0x89, 0x8E, 0x86, 0x87, 0x89, 0x86, 0x89, 
-    0x45, 0x72, 0x70, 0x78, 0x71, 0x75, 0xA3, 0x7D, 0x8D, 0x83, 0x92, 0x8C, 
-    0x6E, 0x95, 0x7E, 0x86, 0x89, 0x7B, 0x83, 0x71, 0x87, 0x59, 0x4A, 0x72, 
-    0x59, 0x98, 0x8D, 0x86, 0x8A, 0x8D, 0x6F, 0x4D, 0x99, 0x9F, 0x87, 0x88, 
-    0x87, 0x92, 0x53, 0x81, 0x79, 0x79, 0x73, 0x70, 0x84, 0x70, 0x94, 0xBA, 
-    0x94, 0x9D, 0x94, 0x99, 0x8E, 0x92, 0x93, 0x7F, 0x8C, 0x7F, 0x86, 0x58, 
-    0x5F, 0x75, 0x5D, 0x6B, 0x98, 0x8F, 0x84, 0x87, 0x93, 0x68, 0x60, 0x9C, 
-    0x8C, 0x80, 0x82, 0x79, 0x4E, 0x6A, 0x76, 0x77, 0x6B, 0x7B, 0xA6, 0x82, 
-    0x8B, 0x94, 0x90, 0x90, 0x69, 0x94, 0x87, 0x85, 0x95, 0x79, 0x8A, 0x7F, 
-    0x4C, 0x5F, 0x69, 0x6E, 0x67, 0x6B, 0x7C, 0x6D, 0xA5, 0xA1, 0x8E, 0x9B, 
-    0x89, 0x97, 0x87, 0x89, 0x92, 0x87, 0x8E, 0x4B, 0x6C, 0x71, 0x78, 0x75, 
-    0x78, 0xA8, 0x7F, 0x8E, 0x86, 0x92, 0x91, 0x80, 0x8F, 0x7E, 0x86, 0x89, 
-    0x80, 0x81, 0x77, 0x82, 0x61, 0x58, 0x67, 0x68, 0x92, 0x87, 0x82, 0x82, 
-    0x87, 0x8A, 0x52, 0x99, 0x92, 0x80, 0x82, 0x7E, 0x8A, 0x47, 0x7F, 0x71, 
-    0x70, 0x77, 0x6D, 0x86, 0x71, 0x8A, 0xB9, 0x96, 0x9E, 0x95, 0x9D, 0x8E, 
-    0x95, 0x96, 0x84, 0x8C, 0x87, 0x79, 0x4B, 0x70, 0x6F, 0x68, 0x6F, 0x70, 
-    0xA0, 0x90, 0x8F, 0x91, 0x8C, 0x7A, 0x64, 0xA6, 0x81, 0x83, 0x90, 0x52, 
-    0x61, 0x70, 0x75, 0x71, 0x71, 0xA5, 0x7F, 0x8C, 0x86, 0x90, 0x97, 0x7D, 
-    0x8E, 0x80, 0x7B, 0x8D, 0x81, 0x85, 0x68, 0x4C, 0x67, 0x5E, 0x6E, 0x68, 
-    0x70, 0x78, 0x6C, 0x9A, 0xA2, 0x93, 0x97, 0x8D, 0x89, 0x87, 0x93, 0x90, 
-    0x89, 0x8F, 0x52, 0x63, 0x76, 0x75, 0x78, 0x72, 0xA4, 0x88, 0x88, 0x8F, 
-    0x90, 0x97, 0x7E, 0x90, 0x83, 0x81, 0x8F, 0x81, 0x82, 0x7B, 0x7E, 0x75, 
-    0x76, 0x7B, 0x74, 0x69, 0x4F, 0x79, 0x92, 0x7F, 0x8A, 0x83, 0x87, 0x80, 
-    0x84, 0x7E, 0x82, 0x80, 0x44, 0x70, 0x70, 0x76, 0x80, 0x77, 0x7F, 0x76, 
-    0x83, 0xB0, 0xA0, 0xA1, 0x93, 0xA0, 0x94, 0x92, 0x9D, 0x91, 0x89, 0x8C, 
-    0x5F, 0x52, 0x75, 0x87, 0x8B, 0x51, 0x72, 0x6C, 0x95, 0xA2, 0x89, 0x98, 
-    0x84, 0x67, 0x83, 0x96, 0x8A, 0x90, 0x72, 0x45, 0x6F, 0x70, 0x78, 0x72, 
-    0x97, 0x93, 0x61, 0x76, 0x95, 0xA7, 0x8C, 0x83, 0x90, 0x7E, 0x8C, 0x8D, 
-    0x90, 0x64, 0x4E, 0x6E, 0x59, 0x6D, 0x70, 0x77, 0x74, 0x68, 0x97, 0x9C, 
-    0x93, 0x99, 0x86, 0x8F, 0x82, 0x8D, 0x8F, 0x85, 0x94, 0x4E, 0x59, 0x71, 
-    0x6E, 0x77, 0x69, 0x7D, 0x71, 0x7B, 0xA8, 0x95, 0x9B, 0x8C, 0x91, 0x8D, 
-    0x83, 0x95, 0x8A, 0x88, 0x82, 0x80, 0x7C, 0x82, 0x7E, 0x81, 0x53, 0x4A, 
-    0x66, 0x76, 0xA6, 0x83, 0x91, 0x87, 0x8A, 0x8B, 0x80, 0x90, 0x7F, 0x47, 
-    0x64, 0x68, 0x7B, 0x7A, 0x7C, 0x81, 0x70, 0x7F, 0xAE, 0x98, 0x9E, 0x94, 
-    0x97, 0x91, 0x8F, 0x9E, 0x90, 0x90, 0x87, 0x53, 0x5E, 0x9B, 0x8A, 0x86, 
-    0x4E, 0x62, 0x6D, 0x70, 0xAE, 0x88, 0x91, 0x8C, 0x66, 0x7A, 0x94, 0x96, 
-    0x86, 0x80, 0x59, 0x4E, 0x7B, 0x72, 0x7D, 0x73, 0x72, 0x74, 0x79, 0x85, 
-    0xB4, 0xA6, 0x8C, 0x93, 0x95, 0x91, 0x95, 0xA2, 0x62, 0x5A, 0x74, 0x60, 
-    0x77, 0x73, 0x79, 0x78, 0x66, 0x91, 0xA0, 0x90, 0x95, 0x8D, 0x88, 0x7E, 
-    0x8E, 0x8E, 0x7F, 0x93, 0x59, 0x4B, 0x70, 0x67, 0x74, 0x68, 0x73, 0x75, 
-    0x6B, 0x94, 0xA2, 0x91, 0x8D, 0x89, 0x8E, 0x80, 0x90, 0x90, 0x86, 0x86, 
-    0x7F, 0x7B, 0x81, 0x7A, 0x82, 0x51, 0x45, 0x6E, 0x5A, 0x9A, 0x95, 0x8B, 
-    0x8A, 0x87, 0x92, 0x80, 0x8F, 0x8C, 0x4A, 0x62, 0x66, 0x79, 0x7E, 0x78, 
-    0x8A, 0x74, 0x79, 0xAE, 0x9B, 0x9A, 0x99, 0x97, 0x91, 0x8D, 0xA1, 0x91, 
-    0x93, 0x85, 0x54, 0x8B, 0x8F, 0x7E, 0x89, 0x59, 0x52, 0x6C, 0x62, 0x9E, 
-    0x98, 0x8A, 0x88, 0x83, 0x85, 0x84, 0x95, 0x83, 0x77, 0x86, 0x3F, 0x67, 
-    0x7C, 0x6F, 0x76, 0x6D, 0x74, 0x75, 0x7B, 0xA5, 0xA9, 0x96, 0x92, 0x97, 
-    0x9B, 0x8A, 0xA7, 0x68, 0x5A, 0x79, 0x65, 0x74, 0x74, 0x7E, 0x77, 0x71, 
-    0x7F, 0xA4, 0x98, 0x91, 0x94, 0x8A, 0x82, 0x8E, 0x8F, 0x85, 0x88, 0x81, 
-    0x43, 0x65, 0x6B, 0x6B, 0x71, 0x68, 0x77, 0x6D, 0x7B, 0xA6, 0x91, 0x8E, 
-    0x87, 0x8D, 0x85, 0x85, 0x96, 0x87, 0x86, 0x82, 0x7A, 0x7F, 0x78, 0x84, 
-    0x59, 0x3D, 0x6D, 0x58, 0x83, 0x9F, 0x8B, 0x8C, 0x83, 0x92, 0x84, 0x87, 
-    0x93, 0x52, 0x5A, 0x69, 0x70, 0x83, 0x73, 0x8A, 0x79, 0x76, 0x85, 0xA2, 
-    0xA6, 0x97, 0x9D, 0x91, 0x92, 0x9F, 0x98, 0x99, 0x84, 0x80, 0x88, 0x80, 
-    0x84, 0x80, 0x76, 0x3E, 0x69, 0x61, 0x7E, 0xA6, 0x84, 0x8E, 0x80, 0x8B, 
-    0x86, 0x85, 0x8D, 0x79, 0x86, 0x6E, 0x4B, 0x74, 0x6D, 0x75, 0x70, 0x69, 
-    0x7A, 0x73, 0x9C, 0xAB, 0x94, 0x9E, 0x8F, 0xA0, 0x89, 0x9D, 0x72, 0x5C, 
-    0x7B, 0x66, 0x78, 0x6F, 0x7F, 0x7D, 0x71, 0x7F, 0x75, 0xA8, 0x9C, 0x92, 
-    0x95, 0x83, 0x99, 0x8B, 0x8C, 0x8B, 0x81, 0x85, 0x56, 0x57, 0x6C, 0x69, 
-    0x74, 0x63, 0x73, 0x70, 0x7E, 0xA4, 0x88, 0x90, 0x87, 0x8B, 0x89, 0x83, 
-    0x92, 0x88, 0x85, 0x7C, 0x7B, 0x7B, 0x7A, 0x77, 0x38, 0x61, 0x5D, 0x6F, 
-    0x9F, 0x85, 0x94, 0x82, 0x8C, 0x89, 0x7F, 0x98, 0x5C, 0x55, 0x6B, 0x65, 
-    0x84, 0x73, 0x86, 0x7F, 0x76, 0x81, 0x7D, 0x96, 0xB0, 0x99, 0x9B, 0x92, 
-    0xA5, 0x9F, 0x98, 0x97, 0x8B, 0x87, 0x7E, 0x84, 0x7F, 0x81, 0x57, 0x54, 
-    0x6A, 0x61, 0x90, 0x97, 0x86, 0x8B, 0x80, 0x8D, 0x81, 0x8C, 0x85, 0x7E, 
-    0x82, 0x6D, 0x4E, 0x71, 0x6C, 0x74, 0x6A, 0x6D, 0x75, 0x8B, 0xAE, 0x91, 
-    0x9F, 0x92, 0x96, 0x90, 0x94, 0x79, 0x5D, 0x7E, 0x68, 0x75, 0x73, 0x76, 
-    0x84, 0x72, 0x7A, 0x7A, 0x82, 0xA9, 0x97, 0x97, 0x8A, 0x96, 0x95, 0x8A, 
-    0x8F, 0x8A, 0x7D, 0x87, 0x5C, 0x52, 0x71, 0x69, 0x72, 0x64, 0x76, 0x72, 
-    0x7E, 0xA5, 0x87, 0x91, 0x88, 0x8C, 0x8C, 0x81, 0x93, 0x87, 0x83, 0x7B, 
-    0x7C, 0x7A, 0x7A, 0x4B, 0x53, 0x62, 0x62, 0x9E, 0x83, 0x8E, 0x8D, 0x84, 
-    0x8C, 0x7B, 0x98, 0x5C, 0x53, 0x73, 0x5E, 0x82, 0x73, 0x85, 0x80, 0x76, 
-    0x81, 0x7D, 0x8A, 0xAD, 0xA0, 0x98, 0x94, 0xA2, 0xA0, 0x96, 0x9A, 0x8D, 
-    0x86, 0x84, 0x81, 0x81, 0x7F, 0x7E, 0x49, 0x5B, 0x69, 0x6B, 0x9D, 0x86, 
-    0x8B, 0x82, 0x87, 0x8B, 0x83, 0x8E, 0x80, 0x7E, 0x81, 0x5A, 0x5A, 0x74, 
-    0x6C, 0x74, 0x69, 0x6F, 0x87, 0xAC, 0x91, 0x9B, 0x96, 0x96, 0x8D, 0x97, 
-    0x7E, 0x5A, 0x83, 0x6C, 0x73, 0x77, 0x75, 0x85, 0x78, 0x76, 0x7E, 0x7A, 
-    0xA4, 0x9D, 0x95, 0x8E, 0x94, 0x99, 0x88, 0x91, 0x8D, 0x80, 0x83, 0x7B, 
-    0x49, 0x67, 0x6E, 0x6D, 0x6A, 0x6A, 0x7A, 0x6D, 0x98, 0x97, 0x84, 0x92, 
-    0x84, 0x91, 0x81, 0x8C, 0x8F, 0x82, 0x80, 0x7A, 0x7B, 0x7C, 0x55, 0x4D, 
-    0x64, 0x59, 0x99, 0x88, 0x86, 0x91, 0x83, 0x8D, 0x7A, 0x96, 0x56, 0x58, 
-    0x77, 0x5D, 0x7F, 0x75, 0x86, 0x80, 0x7A, 0x7F, 0x80, 0x87, 0xA4, 0xA8, 
-    0x94, 0x97, 0xA2, 0x9F, 0x96, 0x9A, 0x92, 0x84, 0x8A, 0x7F, 0x82, 0x7E, 
-    0x84, 0x66, 0x3F, 0x70, 0x5F, 0x84, 0x95, 0x82, 0x8A, 0x7C, 0x90, 0x81, 
-    0x8A, 0x88, 0x7C, 0x7E, 0x79, 0x5C, 0x5D, 0x72, 0x6E, 0x71, 0x67, 0x7A, 
-    0xB0, 0x8F, 0x9A, 0x95, 0x97, 0x90, 0x92, 0x88, 0x50, 0x85, 0x74, 0x70, 
-    0x79, 0x77, 0x8A, 0x78, 0x77, 0x7F, 0x78, 0x9C, 0xA3, 0x95, 0x90, 0x94, 
-    0x9F, 0x88, 0x91, 0x8E, 0x85, 0x7E, 0x85, 0x61, 0x50, 0x72, 0x69, 0x6D, 
-    0x68, 0x76, 0x75, 0x71, 0xA7, 0x88, 0x8C, 0x8C, 0x8A, 0x8E, 0x80, 0x93, 
-    0x86, 0x80, 0x80, 0x75, 0x82, 0x54, 0x4F, 0x6B, 0x53, 0x94, 0x8C, 0x83, 
-    0x8D, 0x87, 0x8C, 0x7A, 0x91, 0x4D, 0x64, 0x75, 0x62, 0x7C, 0x75, 0x85, 
-    0x7E, 0x7E, 0x7A, 0x83, 0x85, 0x97, 0xB0, 0x8D, 0x99, 0xA1, 0x9D, 0x95, 
-    0x96, 0x93, 0x82, 0x8C, 0x80, 0x80, 0x83, 0x7C, 0x7E, 0x41, 0x5E, 0x6D, 
-    0x62, 0x96, 0x8B, 0x87, 0x81, 0x89, 0x8D, 0x81, 0x90, 0x7F, 0x7D, 0x80, 
-    0x6C, 0x53, 0x6F, 0x6F, 0x73, 0x6D, 0x6B, 0xAE, 0x97, 0x91, 0x9B, 0x93, 
-    0x95, 0x8F, 0x8B, 0x51, 0x7F, 0x7C, 0x70, 0x78, 0x78, 0x86, 0x79, 0x7B, 
-    0x7E, 0x7A, 0x92, 0xA7, 0x95, 0x90, 0x94, 0x9F, 0x8C, 0x8C, 0x92, 0x84, 
-    0x84, 0x7D, 0x84, 0x5D, 0x52, 0x75, 0x61, 0x6E, 0x68, 0x79, 0x68, 0x91, 
-    0x9E, 0x7C, 0x96, 0x87, 0x8E, 0x86, 0x85, 0x8D, 0x81, 0x84, 0x77, 0x81, 
-    0x69, 0x44, 0x6F, 0x54, 0x8A, 0x94, 0x7D, 0x8D, 0x85, 0x8E, 0x7F, 0x87, 
-    0x4F, 0x67, 0x74, 0x65, 0x76, 0x79, 0x83, 0x7F, 0x7F, 0x7B, 0x83, 0x88, 
-    0x8B, 0xB5, 0x8F, 0x99, 0xA2, 0x9B, 0x97, 0x94, 0x95, 0x84, 0x8C, 0x84, 
-    0x7E, 0x89, 0x79, 0x87, 0x5D, 0x44, 0x74, 0x59, 0x86, 0x95, 0x81, 0x87, 
-    0x81, 0x92, 0x7F, 0x8D, 0x87, 0x79, 0x82, 0x72, 0x4F, 0x69, 0x6F, 0x70, 
-    0x72, 0x65, 0x9C, 0xA4, 0x8A, 0x9B, 0x93, 0x95, 0x91, 0x85, 0x56, 0x7B, 
-    0x80, 0x74, 0x74, 0x7B, 0x80, 0x7B, 0x7F, 0x79, 0x82, 0x80, 0xA5, 0xA1, 
-    0x8C, 0x9A, 0x9C, 0x94, 0x89, 0x93, 0x8A, 0x81, 0x87, 0x7B, 0x7F, 0x4A, 
-    0x69, 0x6A, 0x67, 0x6D, 0x70, 0x6F, 0x7C, 0xA5, 0x81, 0x8B, 0x91, 0x88, 
-    0x8A, 0x83, 0x89, 0x85, 0x83, 0x7B, 0x7A, 0x7A, 0x5A, 0x65, 0x5F, 0x7F, 
-    0x8D, 0x7A, 0x83, 0x84, 0x85, 0x82, 0x79, 0x4A, 0x6D, 0x6C, 0x6B, 0x6E, 
-    0x77, 0x81, 0x7E, 0x80, 0x7E, 0x85, 0x8A, 0x81, 0xB6, 0x97, 0x9A, 0xA7, 
-    0x9A, 0x9D, 0x95, 0x97, 0x8B, 0x8E, 0x89, 0x7F, 0x8B, 0x7B, 0x87, 0x6A, 
-    0x3E, 0x73, 0x58, 0x8C, 0x90, 0x80, 0x89, 0x7D, 0x92, 0x7B, 0x8B, 0x86, 
-    0x79, 0x80, 0x65, 0x70, 0x5A, 0x68, 0x74, 0x68, 0x73, 0x6E, 0x95, 0xA9, 
-    0x92, 0x9E, 0x8B, 0xA4, 0x7A, 0x5D, 0x87, 0x73, 0x84, 0x71, 0x7D, 0x83, 
-    0x7B, 0x88, 0x7B, 0x80, 0x83, 0xAA, 0x94, 0x8F, 0x9A, 0x94, 0x93, 0x89, 
-    0x8E, 0x50, 0x97, 0x93, 0x7A, 0x7A, 0x47, 0x82, 0x60, 0x73, 0x70, 0x77, 
-    0xA7, 0x76, 0x92, 0x7A, 0x8A, 0x94, 0x76, 0x85, 0x73, 0x8C, 0x7D, 0x81, 
-    0x7E, 0x73, 0x7D, 0x70, 0x59, 0x4D, 0x61, 0x92, 0x84, 0x7D, 0x86, 0x84, 
-    0x8E, 0x72, 0x4C, 0x74, 0x6C, 0x71, 0x6C, 0x79, 0x85, 0x83, 0x8A, 0x7D, 
-    0x8B, 0x86, 0x92, 0xB7, 0x95, 0x9E, 0xA3, 0x9F, 0x9B, 0x96, 0xA0, 0x77, 
-    0x60, 0x7A, 0x67, 0x91, 0x9D, 0x8C, 0x8D, 0x7F, 0x8D, 0x7A, 0x64, 0x7A, 
-    0x87, 0x81, 0x62, 0x68, 0x81, 0x8F, 0x97, 0x80, 0x7B, 0x80, 0x63, 0x52, 
-    0x6E, 0x6C, 0x90, 0x9E, 0x82, 0x92, 0x87, 0x97, 0x70, 0x50, 0x76, 0x69, 
-    0x7F, 0x70, 0x8B, 0x93, 0x7A, 0xAC, 0x8B, 0x89, 0x8D, 0x83, 0x86, 0x79, 
-    0x8D, 0x85, 0x86, 0x68, 0x62, 0x6F, 0x6C, 0x74, 0x8F, 0x99, 0x85, 0x8C, 
-    0x85, 0x88, 0x8B, 0x7F, 0x83, 0x7D, 0x83, 0x6E, 0x54, 0x6B, 0x6B, 0x73, 
-    0x70, 0x9F, 0x98, 0x88, 0x94, 0x89, 0x92, 0x66, 0x58, 0x77, 0x63, 0x97, 
-    0x98, 0x90, 0x92, 0x91, 0x83, 0x5C, 0x79, 0x74, 0x73, 0x7E, 0x78, 0x8E, 
-    0x94, 0xA1, 0xA0, 0x8B, 0x8B, 0x86, 0x8E, 0x7A, 0x94, 0x6A, 0x5A, 0x7C, 
-    0x73, 0x77, 0x87, 0xAB, 0x7E, 0x84, 0x82, 0x85, 0x80, 0x58, 0x77, 0x6C, 
-    0x75, 0x89, 0x81, 0x8D, 0x8C, 0x7A, 0x53, 0x69, 0x9D, 0x90, 0x87, 0x90, 
-    0x85, 0x6F, 0x70, 0x7A, 0x9C, 0x87, 0x81, 0x85, 0x7B, 0x8D, 0x59, 0x6F, 
-    0x71, 0x70, 0x77, 0x71, 0xB6, 0x8D, 0x90, 0x8B, 0x81, 0x8A, 0x7A, 0x8F, 
-    0x84, 0x81, 0x8D, 0x60, 0x5F, 0x6C, 0x71, 0x6F, 0x69, 0x7C, 0x9B, 0x92, 
-    0x93, 0x91, 0x90, 0x8D, 0x8C, 0x83, 0x89, 0x72, 0x5B, 0x76, 0x70, 0x78, 
-    0x75, 0xAD, 0x8E, 0x8A, 0x92, 0x8C, 0x8D, 0x8D, 0x62, 0x5A, 0x73, 0x74, 
-    0x72, 0xA3, 0x9C, 0x97, 0x66, 0x61, 0x85, 0x71, 0x81, 0x74, 0xB0, 0x91, 
-    0x91, 0xA1, 0x86, 0x94, 0x82, 0x7D, 0x7F, 0x7B, 0x93, 0x53, 0x68, 0x70, 
-    0x68, 0x77, 0x62, 0x9F, 0x8A, 0x83, 0x87, 0x80, 0x88, 0x49, 0x7F, 0x68, 
-    0x8E, 0xA8, 0x7B, 0xA0, 0x63, 0x63, 0x75, 0x64, 0x86, 0x93, 0x92, 0x86, 
-    0x89, 0x9F, 0x5C, 0x6C, 0x73, 0x62, 0x77, 0x6E, 0xAA, 0xA1, 0x66, 0x7D, 
-    0x80, 0x7C, 0x77, 0x85, 0xA9, 0x88, 0x99, 0x8B, 0x90, 0x9A, 0x5F, 0x6A, 
-    0x99, 0x8A, 0x8B, 0x84, 0x96, 0x5A, 0x67, 0x75, 0x6B, 0x7B, 0xA1, 0x72, 
-    0x5F, 0x7D, 0x76, 0xAC, 0x8D, 0x8D, 0x8E, 0x8A, 0x8C, 0x5A, 0x77, 0x91, 
-    0x9A, 0x80, 0x6F, 0x96, 0x88, 0x82, 0x7D, 0x86, 0x5D, 0x47, 0x71, 0x66, 
-    0x71, 0x90, 0xA6, 0x8A, 0x71, 0x5D, 0x7B, 0x71, 0x7A, 0x72, 0xAC, 0x95, 
-    0x92, 0x9B, 0x90, 0x92, 0x85, 0x7A, 0x7F, 0x81, 0x8E, 0x73, 0x59, 0x73, 
-    0x6D, 0x76, 0x6B, 0x7C, 0x9A, 0x91, 0x8D, 0x8C, 0x8C, 0x8D, 0x51, 0x7C, 
-    0x67, 0x86, 0xAC, 0x87, 0x95, 0x94, 0x6F, 0x5D, 0x71, 0x98, 0x90, 0x80, 
-    0x93, 0x64, 0x6E, 0x79, 0x7B, 0x7B, 0x70, 0xA8, 0x8F, 0x77, 0x66, 0x89, 
-    0x7E, 0x74, 0x7D, 0x7E, 0xAC, 0x95, 0x91, 0x8C, 0x88, 0x93, 0x77, 0x5A, 
-    0x60, 0x8D, 0x9B, 0x7D, 0x8D, 0x8D, 0x63, 0x5B, 0x6E, 0x67, 0x73, 0xA4, 
-    0x70, 0x5D, 0x85, 0x78, 0xA6, 0x90, 0x89, 0x8E, 0x84, 0x8C, 0x78, 0x9A, 
-    0x7C, 0x82, 0x82, 0x6A, 0x8F, 0x82, 0x7F, 0x79, 0x80, 0x45, 0x4B, 0x78, 
-    0x61, 0x7B, 0xA4, 0x84, 0x95, 0x65, 0x64, 0x7B, 0x75, 0x71, 0x91, 0xAA, 
-    0x86, 0xA1, 0x9B, 0x5A, 0xAA, 0x91, 0x7B, 0x8E, 0x86, 0x97, 0x78, 0x60, 
-    0x72, 0x75, 0x75, 0x69, 0x84, 0xA1, 0x91, 0x9F, 0x87, 0x90, 0x8F, 0x4A, 
-    0x7D, 0x6C, 0x84, 0xA7, 0x8A, 0x94, 0x91, 0x75, 0x56, 0x78, 0xA0, 0x81, 
-    0x8B, 0x87, 0x58, 0x7B, 0x76, 0x76, 0x9D, 0x8F, 0x84, 0x92, 0x5A, 0x6F, 
-    0x82, 0x76, 0x71, 0x75, 0xA9, 0x89, 0x99, 0x8E, 0x81, 0x91, 0x70, 0x82, 
-    0x55, 0x59, 0x8A, 0x97, 0x86, 0x7D, 0x98, 0x5D, 0x50, 0x77, 0x5E, 0x82, 
-    0x9F, 0x5F, 0x72, 0x7E, 0x84, 0x82, 0xA8, 0x92, 0x8A, 0x90, 0x86, 0x94, 
-    0x8F, 0x80, 0x8A, 0x80, 0x77, 0x88, 0x8C, 0x79, 0x80, 0x43, 0x58, 0x69, 
-    0x71, 0x6D, 0x7C, 0xAE, 0x8A, 0x6B, 0x6A, 0x82, 0x82, 0x6E, 0x8B, 0xAB, 
-    0x8E, 0x9F, 0x9F, 0x6D, 0x75, 0xAC, 0x87, 0x87, 0x88, 0x94, 0x8D, 0x8C, 
-    0x73, 0x66, 0x72, 0x62, 0x6C, 0x7F, 0x88, 0xA0, 0x8A, 0x87, 0x79, 0x59, 
-    0x72, 0x71, 0x73, 0x84, 0xA4, 0x8A, 0x8F, 0x90, 0x92, 0x5A, 0x64, 0xA0, 
-    0x7C, 0x8E, 0x5D, 0x6D, 0x81, 0x67, 0x92, 0x9C, 0x89, 0x98, 0x61, 0x65, 
-    0x76, 0x81, 0x7D, 0x6E, 0xB0, 0x8D, 0x8C, 0x9A, 0x86, 0x8F, 0x76, 0x7F, 
-    0x7A, 0x47, 0x71, 0x78, 0xA5, 0x7E, 0x86, 0x92, 0x5D, 0x59, 0x6D, 0x6F, 
-    0x7A, 0xA4, 0x8A, 0x56, 0x89, 0x7B, 0x88, 0xA8, 0x8C, 0x90, 0x85, 0x90, 
-    0x89, 0x90, 0x88, 0x81, 0x88, 0x73, 0x7E, 0x95, 0x6A, 0x48, 0x70, 0x5C, 
-    0x6B, 0x76, 0x76, 0x7E, 0x7C, 0x7E, 0x7D, 0x87, 0x89, 0x85, 0x85, 0xA5, 
-    0xA1, 0x9D, 0x9E, 0x9B, 0x69, 0x75, 0xA7, 0x8D, 0x89, 0x8B, 0x8D, 0x87, 
-    0x85, 0x7D, 0x7C, 0x84, 0x44, 0x5A, 0x81, 0x93, 0x84, 0x85, 0x6E, 0x76, 
-    0x57, 0x5B, 0x73, 0x72, 0x9B, 0x7E, 0x88, 0x85, 0x8B, 0x99, 0x3A, 0x8C, 
-    0x90, 0x7F, 0x71, 0x52, 0x92, 0x6B, 0x81, 0xA4, 0x8E, 0xA1, 0x6B, 0x6B, 
-    0x7C, 0x76, 0x90, 0x6F, 0xB0, 0x94, 0x92, 0x9A, 0x8E, 0x94, 0x7F, 0x7D, 
-    0x88, 0x64, 0x58, 0x76, 0x7E, 0x9E, 0x84, 0x8C, 0x87, 0x72, 0x50, 0x73, 
-    0x71, 0xAB, 0x83, 0x5F, 0x7C, 0x7F, 0x82, 0x7C, 0xB3, 0x8C, 0x86, 0x95, 
-    0x83, 0x94, 0x8B, 0x87, 0x84, 0x7A, 0x7B, 0x86, 0x76, 0x40, 0x78, 0x5C, 
-    0x78, 0xA6, 0x63, 0x63, 0x7A, 0x7B, 0x6E, 0x7B, 0x88, 0x7D, 0x7E, 0x91, 
-    0xA5, 0x9D, 0x90, 0x9F, 0x84, 0x4D, 0x7E, 0xA6, 0x8B, 0x8B, 0x90, 0x81, 
-    0x8A, 0x83, 0x84, 0x70, 0x43, 0x6F, 0x92, 0x80, 0x79, 0x96, 0x7F, 0x4A, 
-    0x6E, 0x5F, 0x6E, 0x74, 0x72, 0xA2, 0x82, 0x94, 0x91, 0x94, 0x89, 0x84, 
-    0x84, 0x7A, 0x72, 0x5A, 0x72, 0x7E, 0x72, 0x95, 0xA0, 0x94, 0x75, 0x5E, 
-    0x85, 0x74, 0x87, 0x6E, 0xAC, 0xA1, 0x8B, 0xA0, 0x8B, 0x96, 0x85, 0x7F, 
-    0x7A, 0x86, 0x5C, 0x5F, 0x7E, 0x6E, 0xA4, 0x89, 0x81, 0x8F, 0x5E, 0x5E, 
-    0x77, 0x74, 0x8D, 0x96, 0x65, 0x7A, 0x88, 0x81, 0x9D, 0xAB, 0x87, 0x8A, 
-    0x91, 0x85, 0x89, 0x95, 0x7E, 0x88, 0x7C, 0x7C, 0x76, 0x4B, 0x6F, 0x60, 
-    0x8D, 0x80, 0x8D, 0x61, 0x5C, 0x88, 0x65, 0x79, 0x79, 0xA6, 0x94, 0x80, 
-    0x97, 0x89, 0x97, 0x7E, 0x93, 0x5F, 0x4F, 0x7D, 0x7F, 0xA6, 0x7B, 0x91, 
-    0x84, 0x7D, 0x88, 0x61, 0x7B, 0x87, 0x83, 0x6E, 0x69, 0x9A, 0x56, 0x6E, 
-    0x71, 0x97, 0x94, 0x51, 0x73, 0x72, 0xA7, 0x90, 0x8A, 0x97, 0x84, 0x98, 
-    0x80, 0x79, 0x5E, 0x70, 0x77, 0x6F, 0x7D, 0x7F, 0xB9, 0xA1, 0x75, 0x66, 
-    0x86, 0x84, 0x7F, 0x7B, 0x9B, 0xA9, 0x92, 0x96, 0x95, 0x9A, 0x8A, 0x7E, 
-    0x82, 0x74, 0x92, 0x57, 0x62, 0x71, 0x78, 0x9E, 0x72, 0x88, 0x7F, 0x7B, 
-    0x4C, 0x6E, 0x72, 0x7C, 0x73, 0x6F, 0x7A, 0x81, 0x84, 0xA9, 0x93, 0x8B, 
-    0x86, 0x8F, 0x82, 0x88, 0x91, 0x83, 0x83, 0x84, 0x70, 0x49, 0x77, 0x5C, 
-    0x8E, 0x88, 0x83, 0x84, 0x48, 0x85, 0x6C, 0x78, 0x6F, 0x9B, 0xA4, 0x78, 
-    0x9B, 0x8D, 0x90, 0x8C, 0x80, 0x87, 0x46, 0x78, 0x72, 0x72, 0xA0, 0x91, 
-    0x92, 0x7E, 0x8D, 0x89, 0x7C, 0x8C, 0x7C, 0x85, 0x79, 0x63, 0x6B, 0x71, 
-    0x6E, 0xA0, 0x89, 0x86, 0x62, 0x66, 0x76, 0x98, 0x9E, 0x80, 0x9A, 0x89, 
-    0x8A, 0x8C, 0x52, 0x77, 0x72, 0x70, 0x73, 0x79, 0x9C, 0xB2, 0x71, 0x75, 
-    0x84, 0x85, 0x83, 0x7E, 0x97, 0xA6, 0x97, 0x98, 0x8F, 0xA0, 0x89, 0x89, 
-    0x84, 0x74, 0x8A, 0x7F, 0x49, 0x72, 0x65, 0x6D, 0x99, 0x79, 0x85, 0x7F, 
-    0x8D, 0x4F, 0x62, 0x78, 0x66, 0x7D, 0x69, 0x7E, 0x85, 0x7C, 0xAF, 0x8E, 
-    0x8F, 0x85, 0x8F, 0x87, 0x81, 0x97, 0x7F, 0x87, 0x83, 0x47, 0x70, 0x66, 
-    0x80, 0x9B, 0x71, 0x98, 0x57, 0x66, 0x76, 0x72, 0x7A, 0x6D, 0xB7, 0x7E, 
-    0x8D, 0x9B, 0x88, 0x92, 0x7F, 0x81, 0x87, 0x59, 0x6A, 0x77, 0x76, 0x9F, 
-    0x8E, 0x89, 0x83, 0x8B, 0x87, 0x7A, 0x8F, 0x7C, 0x88, 0x6D, 0x4D, 0x83, 
-    0x69, 0x86, 0xA6, 0x7F, 0x8F, 0x53, 0x76, 0x6A, 0x9C, 0xA2, 0x7B, 0xA4, 
-    0x7A, 0xA0, 0x6D, 0x59, 0x88, 0x65, 0x7A, 0x6D, 0x8F, 0x87, 0x86, 0x95, 
-    0x77, 0x90, 0x82, 0x8B, 0x8B, 0xA8, 0xA1, 0x93, 0x99, 0x92, 0x96, 0x86, 
-    0x88, 0x83, 0x7C, 0x80, 0x81, 0x51, 0x5C, 0x6B, 0x65, 0x91, 0x76, 0x87, 
-    0x7B, 0x89, 0x6C, 0x45, 0x7A, 0x61, 0x75, 0x6D, 0x73, 0x88, 0x72, 0xAB, 
-    0x94, 0x8A, 0x8C, 0x87, 0x92, 0x78, 0x94, 0x83, 0x8B, 0x5F, 0x59, 0x79, 
-    0x68, 0xAB, 0x7D, 0x87, 0x83, 0x4D, 0x7A, 0x67, 0x89, 0x67, 0x92, 0xA9, 
-    0x78, 0xA4, 0x88, 0x94, 0x88, 0x77, 0x8A, 0x76, 0x59, 0x76, 0x7A, 0x72, 
-    0x9F, 0x96, 0x82, 0x8B, 0x8C, 0x84, 0x82, 0x8B, 0x84, 0x7A, 0x53, 0x6E, 
-    0x7F, 0x6D, 0x94, 0xA7, 0x7B, 0x8F, 0x5D, 0x6C, 0x6D, 0xA0, 0x99, 0x80, 
-    0x9D, 0x83, 0x9D, 0x54, 0x6C, 0x83, 0x62, 0xA4, 0x91, 0x68, 0x79, 0x8C, 
-    0x85, 0x6F, 0x8A, 0x7D, 0x81, 0x86, 0xA6, 0x9D, 0x95, 0x93, 0x93, 0x86, 
-    0x7D, 0x93, 0x7E, 0x7E, 0x85, 0x7F, 0x4D, 0x5D, 0x71, 0x5A, 0x92, 0x80, 
-    0x83, 0x7E, 0x8C, 0x6D, 0x49, 0x7D, 0x66, 0x75, 0x70, 0x75, 0x89, 0x74, 
-    0xAB, 0x97, 0x8D, 0x8C, 0x8D, 0x93, 0x7C, 0x94, 0x8A, 0x7D, 0x52, 0x6F, 
-    0x6C, 0x96, 0x98, 0x79, 0x8F, 0x6C, 0x56, 0x75, 0x6D, 0x85, 0x62, 0x97, 
-    0x9D, 0x87, 0x9E, 0x87, 0x95, 0x7C, 0x79, 0x8D, 0x6E, 0x5E, 0x7B, 0x74, 
-    0x6E, 0x95, 0x9E, 0x81, 0x8F, 0x89, 0x85, 0x87, 0x87, 0x8C, 0x69, 0x58, 
-    0x77, 0x77, 0x73, 0x9C, 0xA5, 0x78, 0x91, 0x73, 0x57, 0x71, 0x96, 0x9E, 
-    0x7E, 0x95, 0x8D, 0x8E, 0x4F, 0x75, 0x75, 0x93, 0x8B, 0x8E, 0x62, 0x6F, 
-    0x92, 0x74, 0x7C, 0x7F, 0x80, 0x7A, 0x9A, 0xA7, 0x8F, 0x9C, 0x8D, 0x8D, 
-    0x82, 0x83, 0x94, 0x7C, 0x87, 0x78, 0x88, 0x54, 0x52, 0x79, 0x50, 0x8D, 
-    0x8A, 0x82, 0x86, 0x90, 0x70, 0x4A, 0x81, 0x69, 0x73, 0x78, 0x75, 0x86, 
-    0x7C, 0xAF, 0x97, 0x93, 0x8C, 0x8F, 0x93, 0x7D, 0x90, 0x93, 0x5F, 0x60, 
-    0x6F, 0x89, 0x9D, 0x83, 0x89, 0x81, 0x56, 0x62, 0x74, 0x74, 0x7B, 0x6A, 
-    0x9B, 0x97, 0x92, 0x96, 0x8B, 0x8C, 0x76, 0x7E, 0x88, 0x76, 0x60, 0x73, 
-    0x73, 0x6E, 0x87, 0xA1, 0x85, 0x8B, 0x86, 0x86, 0x87, 0x87, 0x8B, 0x56, 
-    0x65, 0x75, 0x73, 0x79, 0x9D, 0xA4, 0x78, 0x90, 0x73, 0x57, 0x72, 0x90, 
-    0xA3, 0x7B, 0x92, 0x94, 0x84, 0x55, 0x70, 0x86, 0x96, 0x81, 0x8E, 0x53, 
-    0x80, 0x87, 0x7A, 0x7B, 0x7F, 0x7F, 0x7A, 0xAB, 0x97, 0x95, 0x98, 0x89, 
-    0x8E, 0x7F, 0x89, 0x91, 0x80, 0x83, 0x76, 0x8B, 0x5F, 0x4E, 0x75, 0x51, 
-    0x86, 0x8F, 0x80, 0x8B, 0x8F, 0x68, 0x52, 0x7E, 0x6E, 0x73, 0x7C, 0x74, 
-    0x85, 0x7C, 0xA1, 0xA7, 0x92, 0x90, 0x8D, 0x97, 0x7F, 0x90, 0x94, 0x63, 
-    0x5A, 0x82, 0x9B, 0x88, 0x85, 0x8A, 0x77, 0x46, 0x6D, 0x6F, 0x71, 0x7A, 
-    0x6B, 0x94, 0x9C, 0x90, 0x97, 0x87, 0x89, 0x7A, 0x7F, 0x83, 0x83, 0x5F, 
-    0x6E, 0x74, 0x73, 0x6C, 0x7C, 0xA7, 0x89, 0x8A, 0x8D, 0x8A, 0x96, 0x7B, 
-    0x58, 0x74, 0x74, 0x7C, 0x75, 0xAA, 0x99, 0x85, 0x95, 0x73, 0x59, 0x6D, 
-    0x88, 0xA3, 0x7C, 0x90, 0x8F, 0x8C, 0x51, 0x6A, 0xA5, 0x7A, 0x88, 0x72, 
-    0x51, 0x84, 0x78, 0x82, 0x71, 0x85, 0x78, 0x77, 0xB2, 0x8B, 0x9E, 0x8F, 
-    0x85, 0x90, 0x7C, 0x91, 0x85, 0x87, 0x82, 0x77, 0x8D, 0x5D, 0x54, 0x73, 
-    0x57, 0x82, 0x93, 0x85, 0x8A, 0x92, 0x66, 0x57, 0x81, 0x6F, 0x78, 0x91, 
-    0x6F, 0x79, 0x87, 0x7E, 0x9C, 0xAB, 0x8A, 0x94, 0x93, 0x8B, 0x8C, 0x9B, 
-    0x56, 0x80, 0xA6, 0x6F, 0x92, 0x80, 0x8F, 0x58, 0x55, 0x6D, 0x66, 0x7C, 
-    0x68, 0x78, 0x8D, 0x9B, 0x97, 0x8A, 0x89, 0x88, 0x80, 0x7B, 0x84, 0x8E, 
-    0x58, 0x6E, 0x75, 0x6E, 0x71, 0x73, 0x98, 0x94, 0x88, 0x95, 0x85, 0x9C, 
-    0x78, 0x57, 0x77, 0x70, 0x7D, 0x80, 0xAC, 0x91, 0x88, 0x95, 0x76, 0x57, 
-    0x6E, 0x7C, 0xA5, 0x7B, 0x90, 0x8B, 0x93, 0x61, 0x8C, 0x90, 0x6C, 0x8E, 
-    0x5E, 0x4F, 0x7D, 0x77, 0x7D, 0x6F, 0x86, 0x6F, 0x82, 0xB0, 0x86, 0x9F, 
-    0x83, 0x8E, 0x8F, 0x81, 0x93, 0x72, 0x95, 0x81, 0x7D, 0x8A, 0x66, 0x59, 
-    0x6D, 0x5E, 0x84, 0x99, 0x89, 0x89, 0x94, 0x5F, 0x5F, 0x83, 0x6B, 0x98, 
-    0xA3, 0x7A, 0x5E, 0x87, 0x79, 0x88, 0xB2, 0x82, 0x94, 0x8E, 0x85, 0x93, 
-    0x8C, 0x88, 0x82, 0x82, 0x72, 0x80, 0x94, 0x4D, 0x64, 0x6E, 0x5C, 0x74, 
-    0x6D, 0x7E, 0x70, 0x92, 0xA4, 0x86, 0x9B, 0x86, 0x92, 0x80, 0x82, 0x8C, 
-    0x8E, 0x6B, 0x5A, 0x7C, 0x66, 0x78, 0x6E, 0x93, 0x9F, 0x84, 0x99, 0x7F, 
-    0xA2, 0x5F, 0x5B, 0x7D, 0x6A, 0x7E, 0x8D, 0xAC, 0x89, 0x90, 0x90, 0x81, 
-    0x57, 0x69, 0x71, 0x9C, 0x86, 0x87, 0x91, 0x87, 0x8B, 0x7E, 0x7D, 0x78, 
-    0x85, 0x53, 0x4E, 0x80, 0x6F, 0x7B, 0x74, 0x7F, 0x71, 0x89, 0xAE, 0x81, 
-    0x9A, 0x83, 0x91, 0x8A, 0x84, 0x99, 0x72, 0x93, 0x83, 0x7A, 0x89, 0x62, 
-    0x5A, 0x6B, 0x61, 0x83, 0x9C, 0x8B, 0x8E, 0x90, 0x53, 0x70, 0x7B, 0x7C, 
-    0xA8, 0x8D, 0x92, 0x56, 0x87, 0x77, 0x84, 0xB8, 0x76, 0x9B, 0x84, 0x88, 
-    0x98, 0x82, 0x91, 0x77, 0x84, 0x70, 0x89, 0x64, 0x54, 0x80, 0x61, 0x6D, 
-    0x6E, 0x7C, 0x7D, 0x72, 0x98, 0x9F, 0x93, 0x94, 0x8B, 0x93, 0x7D, 0x91, 
-    0x87, 0x8C, 0x78, 0x50, 0x77, 0x69, 0x78, 0x68, 0x9C, 0x97, 0x83, 0x92, 
-    0x87, 0x8C, 0x4D, 0x6E, 0x76, 0x6B, 0x84, 0xA4, 0x9A, 0x87, 0x93, 0x86, 
-    0x88, 0x5B, 0x5E, 0x6C, 0x89, 0x9A, 0x7D, 0x95, 0x84, 0x8E, 0x7C, 0x72, 
-    0x8A, 0x75, 0x47, 0x69, 0x72, 0x75, 0x7B, 0x7C, 0x7F, 0x6D, 0x97, 0xA4, 
-    0x88, 0x98, 0x86, 0x93, 0x85, 0x8D, 0x95, 0x7B, 0x92, 0x7F, 0x7B, 0x84, 
-    0x6D, 0x51, 0x6E, 0x63, 0x83, 0x9F, 0x85, 0x97, 0x84, 0x52, 0x79, 0x6E, 
-    0xA1, 0x92, 0x91, 0x84, 0x50, 0x94, 0x67, 0x97, 0xAB, 0x7B, 0x9B, 0x7D, 
-    0x96, 0x8C, 0x8C, 0x8A, 0x76, 0x82, 0x79, 0x77, 0x53, 0x75, 0x71, 0x6C, 
-    0x6A, 0x76, 0x7F, 0x7A, 0x7C, 0x93, 0xA7, 0x90, 0x94, 0x90, 0x8C, 0x88, 
-    0x8F, 0x82, 0x8E, 0x74, 0x4F, 0x77, 0x6D, 0x71, 0x6C, 0xA1, 0x8F, 0x85, 
-    0x8F, 0x8A, 0x6E, 0x56, 0x77, 0x6D, 0x8C, 0x9F, 0x8B, 0x95, 0x81, 0x94, 
-    0x79, 0x88, 0x6B, 0x45, 0x72, 0x5F, 0xAC, 0x83, 0x89, 0x93, 0x7A, 0x82, 
-    0x71, 0x94, 0x62, 0x4C, 0x7D, 0x5D, 0x84, 0x78, 0x83, 0x85, 0x6D, 0xA6, 
-    0x94, 0x95, 0x93, 0x8E, 0x92, 0x82, 0x97, 0x91, 0x86, 0x82, 0x88, 0x79, 
-    0x81, 0x76, 0x49, 0x71, 0x63, 0x7F, 0xA2, 0x81, 0xA2, 0x6D, 0x61, 0x73, 
-    0x86, 0xB1, 0x74, 0xA2, 0x6E, 0x57, 0x8F, 0x67, 0xA8, 0x9A, 0x85, 0x8E, 
-    0x81, 0x99, 0x83, 0x96, 0x7B, 0x79, 0x82, 0x7A, 0x5D, 0x68, 0x76, 0x6C, 
-    0x71, 0x67, 0x7D, 0x7D, 0x7E, 0x7A, 0x98, 0xA7, 0x8B, 0x99, 0x8C, 0x8F, 
-    0x8C, 0x89, 0x83, 0x8F, 0x66, 0x56, 0x79, 0x6F, 0x6C, 0x7E, 0xA4, 0x84, 
-    0x89, 0x92, 0x74, 0x5B, 0x6E, 0x71, 0xA2, 0x84, 0x8F, 0x8E, 0x8A, 0x86, 
-    0x84, 0x7D, 0x82, 0x61, 0x46, 0x67, 0x69, 0xA3, 0x88, 0x89, 0x87, 0x79, 
-    0x87, 0x77, 0x90, 0x53, 0x5A, 0x7E, 0x63, 0x86, 0x7B, 0x8B, 0x7E, 0x79, 
-    0xAC, 0x8F, 0x9F, 0x8B, 0x95, 0x8E, 0x85, 0x98, 0x92, 0x71, 0x69, 0x9A, 
-    0x7E, 0x80, 0x8C, 0x55, 0x66, 0x6D, 0x71, 0xA1, 0x8C, 0x9A, 0x6D, 0x61, 
-    0x8C, 0x9E, 0x97, 0x7A, 0x97, 0x6B, 0x4B, 0x89, 0x76, 0x83, 0x91, 0x8C, 
-    0x82, 0x91, 0x96, 0x8E, 0x8D, 0x7C, 0x7D, 0x86, 0x74, 0x57, 0x7E, 0x6C, 
-    0x74, 0x74, 0x6C, 0x80, 0x7D, 0x7D, 0x74, 0xA6, 0x9E, 0x88, 0x9B, 0x88, 
-    0x94, 0x87, 0x88, 0x82, 0x8B, 0x59, 0x5A, 0x7A, 0x6A, 0x6E, 0x8A, 0x9F, 
-    0x7B, 0x93, 0x7C, 0x55, 0x78, 0x6C, 0xA2, 0x82, 0x87, 0x8E, 0x78, 0x99, 
-    0x79, 0x90, 0x74, 0x82, 0x5B, 0x42, 0x7B, 0x66, 0xA4, 0x84, 0x85, 0x89, 
-    0x7C, 0x8C, 0x7F, 0x82, 0x45, 0x74, 0x76, 0x69, 0x8B, 0x7E, 0x89, 0x77, 
-    0x8F, 0xA9, 0x91, 0xA1, 0x85, 0x9C, 0x85, 0x8D, 0x9B, 0x8C, 0x6B, 0x5B, 
-    0x86, 0x97, 0x80, 0x93, 0x76, 0x55, 0x72, 0x6C, 0x79, 0xA2, 0x98, 0x87, 
-    0x89, 0x8E, 0x8C, 0x8F, 0x86, 0x7F, 0x76, 0x45, 0x6D, 0x7D, 0x71, 0x77, 
-    0x7B, 0x7F, 0x9C, 0x92, 0x8D, 0x89, 0x91, 0x7B, 0x8E, 0x6A, 0x5C, 0x8A, 
-    0x70, 0x79, 0x76, 0x7B, 0x7E, 0x80, 0x7E, 0x77, 0xB1, 0x91, 0x8E, 0x98, 
-    0x87, 0x97, 0x87, 0x85, 0x83, 0x81, 0x49, 0x69, 0x74, 0x6C, 0x70, 0x9A, 
-    0x8C, 0x84, 0x7B, 0x58, 0x7B, 0x72, 0x98, 0x8A, 0x7E, 0x91, 0x78, 0x7E, 
-    0x95, 0x85, 0x8A, 0x6E, 0x8E, 0x43, 0x61, 0x77, 0x6D, 0xA5, 0x76, 0x8C, 
-    0x83, 0x85, 0x87, 0x88, 0x64, 0x4D, 0x7F, 0x6C, 0x75, 0x8A, 0x7B, 0x86, 
-    0x76, 0xA2, 0x99, 0x99, 0x97, 0x8A, 0x98, 0x81, 0x96, 0x99, 0x83, 0x5D, 
-    0x68, 0x80, 0x9F, 0x85, 0x91, 0x85, 0x54, 0x6C, 0x72, 0x71, 0x91, 0xA1, 
-    0x89, 0x88, 0x8E, 0x92, 0x8C, 0x8B, 0x7C, 0x83, 0x4E, 0x63, 0x7F, 0x71, 
-    0x79, 0x75, 0x91, 0x94, 0x8A, 0x93, 0x80, 0x94, 0x7D, 0x8B, 0x59, 0x67, 
-    0x87, 0x70, 0x7C, 0x75, 0x80, 0x7A, 0x7E, 0x7F, 0x77, 0xB1, 0x8D, 0x94, 
-    0x91, 0x8C, 0x99, 0x85, 0x83, 0x86, 0x71, 0x4A, 0x71, 0x72, 0x6B, 0x7B, 
-    0x9F, 0x84, 0x60, 0x6E, 0x7A, 0x72, 0x98, 0x8F, 0x88, 0x84, 0x8C, 0x86, 
-    0x81, 0x94, 0x80, 0x7F, 0x77, 0x7E, 0x4B, 0x6C, 0x69, 0x7D, 0x95, 0x74, 
-    0x92, 0x80, 0x83, 0x89, 0x7D, 0x4F, 0x64, 0x7B, 0x6D, 0x78, 0x86, 0x7D, 
-    0x83, 0x7C, 0xA5, 0x98, 0x9A, 0x8F, 0x93, 0x90, 0x8A, 0x96, 0x98, 0x6F, 
-    0x60, 0x6D, 0x82, 0xA5, 0x80, 0x98, 0x7E, 0x55, 0x71, 0x72, 0x78, 0x8F, 
-    0xA2, 0x86, 0x89, 0x93, 0x8F, 0x8D, 0x89, 0x7A, 0x84, 0x51, 0x61, 0x7F, 
-    0x71, 0x77, 0x74, 0x9C, 0x8B, 0x8C, 0x8F, 0x81, 0x91, 0x81, 0x81, 0x51, 
-    0x75, 0x7F, 0x75, 0x7C, 0x76, 0x84, 0x77, 0x7F, 0x7C, 0x7C, 0xAF, 0x8C, 
-    0x97, 0x8B, 0x93, 0x97, 0x84, 0x83, 0x88, 0x62, 0x52, 0x76, 0x71, 0x6F, 
-    0x7E, 0x7F, 0x69, 0x77, 0x80, 0x76, 0x8E, 0xA4, 0x84, 0x8D, 0x85, 0x91, 
-    0x8B, 0x88, 0x87, 0x81, 0x7B, 0x80, 0x7A, 0x46, 0x70, 0x64, 0x85, 0x87, 
-    0x7E, 0x8B, 0x7D, 0x87, 0x83, 0x67, 0x55, 0x6E, 0x73, 0x6C, 0x79, 0x85, 
-    0x7E, 0x81, 0x82, 0xA6, 0x97, 0x96, 0x8E, 0x95, 0x8D, 0x8F, 0x94, 0x93, 
-    0x5F, 0x6C, 0x6B, 0x94, 0x9E, 0x7E, 0x9E, 0x6F, 0x59, 0x75, 0x74, 0x7B, 
-    0x97, 0x9D, 0x81, 0x8D, 0x93, 0x8D, 0x8D, 0x85, 0x7B, 0x82, 0x4E, 0x68, 
-    0x7D, 0x71, 0x74, 0x7F, 0xA2, 0x81, 0x95, 0x88, 0x88, 0x8C, 0x84, 0x75, 
-    0x52, 0x7F, 0x78, 0x7B, 0x7A, 0x7B, 0x84, 0x73, 0x82, 0x7B, 0x7E, 0xAB, 
-    0x92, 0x97, 0x8A, 0x98, 0x95, 0x83, 0x85, 0x86, 0x58, 0x5E, 0x75, 0x71, 
-    0x75, 0x77, 0x78, 0x71, 0x79, 0x80, 0x78, 0xA3, 0x96, 0x85, 0x8C, 0x85, 
-    0x93, 0x85, 0x89, 0x82, 0x81, 0x79, 0x84, 0x6D, 0x47, 0x73, 0x61, 0x90, 
-    0x7E, 0x82, 0x87, 0x7E, 0x87, 0x7D, 0x5D, 0x5A, 0x70, 0x71, 0x6C, 0x7E, 
-    0x83, 0x7E, 0x83, 0x7F, 0xA4, 0x9D, 0x92, 0x92, 0x92, 0x8F, 0x8E, 0x98, 
-    0x87, 0x58, 0x79, 0x6C, 0xA6, 0x8E, 0x87, 0x9D, 0x5F, 0x62, 0x75, 0x77, 
-    0x7B, 0x9F, 0x97, 0x7E, 0x94, 0x90, 0x8C, 0x8D, 0x80, 0x80, 0x7C, 0x4B, 
-    0x72, 0x79, 0x72, 0x71, 0x91, 0x99, 0x80, 0x98, 0x80, 0x8D, 0x86, 0x88, 
-    0x69, 0x57, 0x83, 0x74, 0x80, 0x76, 0x80, 0x8B, 0x6A, 0x82, 0x77, 0x81, 
-    0xA9, 0x93, 0x96, 0x8A, 0x9B, 0x90, 0x82, 0x88, 0x83, 0x63, 0x5D, 0x70, 
-    0x73, 0x72, 0x75, 0x77, 0x72, 0x78, 0x7D, 0x81, 0xA6, 0x8F, 0x88, 0x88, 
-    0x87, 0x8E, 0x85, 0x8B, 0x7F, 0x84, 0x78, 0x86, 0x64, 0x4D, 0x6F, 0x69, 
-    0x96, 0x75, 0x88, 0x84, 0x81, 0x89, 0x73, 0x53, 0x67, 0x6E, 0x72, 0x6E, 
-    0x82, 0x83, 0x7E, 0x85, 0x79, 0xA2, 0xA5, 0x8D, 0x99, 0x8D, 0x96, 0x8E, 
-    0x9B, 0x77, 0x5F, 0x7C, 0x76, 0xAC, 0x81, 0x92, 0x94, 0x54, 0x6B, 0x73, 
-    0x79, 0x7A, 0xA6, 0x8E, 0x80, 0x97, 0x8D, 0x8C, 0x8A, 0x7C, 0x85, 0x6D, 
-    0x4D, 0x7A, 0x74, 0x71, 0x74, 0xA0, 0x89, 0x87, 0x94, 0x7E, 0x8F, 0x82, 
-    0x87, 0x59, 0x64, 0x82, 0x72, 0x84, 0x6E, 0x9D, 0x9D, 0x51, 0x83, 0x6F, 
-    0x86, 0xA2, 0x91, 0x94, 0x86, 0x9E, 0x86, 0x81, 0x8C, 0x7A, 0x84, 0x76, 
-    0x64, 0x62, 0x6B, 0x6F, 0x70, 0x6B, 0x71, 0x7B, 0x83, 0xA3, 0x8D, 0x8C, 
-    0x87, 0x89, 0x89, 0x82, 0x8F, 0x83, 0x87, 0x7C, 0x89, 0x5C, 0x53, 0x6E, 
-    0x7C, 0x93, 0x74, 0x8C, 0x84, 0x85, 0x91, 0x61, 0x58, 0x70, 0x6C, 0x74, 
-    0x71, 0x88, 0x83, 0x81, 0x85, 0x79, 0xA2, 0xAA, 0x92, 0x9C, 0x8B, 0x9C, 
-    0x8F, 0x99, 0x6A, 0x69, 0x78, 0x8C, 0xA0, 0x7C, 0x9B, 0x84, 0x53, 0x70, 
-    0x72, 0x78, 0x78, 0xA9, 0x84, 0x84, 0x94, 0x8B, 0x8B, 0x82, 0x7C, 0x86, 
-    0x5A, 0x57, 0x79, 0x70, 0x6B, 0x81, 0xA4, 0x7A, 0x91, 0x89, 0x81, 0x8A, 
-    0x81, 0x80, 0x4C, 0x72, 0x78, 0x77, 0x7C, 0x73, 0xB1, 0x85, 0x58, 0x7D, 
-    0x6F, 0x8A, 0xA1, 0x92, 0x8E, 0x8D, 0x9A, 0x81, 0x86, 0x88, 0x7E, 0x7F, 
-    0x7D, 0x6E, 0x57, 0x72, 0x6E, 0x73, 0x67, 0x75, 0x7D, 0x83, 0xA9, 0x8B, 
-    0x90, 0x8A, 0x8A, 0x8D, 0x82, 0x91, 0x86, 0x8A, 0x7D, 0x8B, 0x64, 0x4D, 
-    0x74, 0x8B, 0x87, 0x79, 0x8B, 0x84, 0x86, 0x8D, 0x4E, 0x65, 0x71, 0x6C, 
-    0x75, 0x74, 0x88, 0x83, 0x83, 0x82, 0x7C, 0xA6, 0xA5, 0x98, 0x99, 0x8C, 
-    0x9E, 0x8F, 0x93, 0x63, 0x6C, 0x7E, 0x9B, 0x8E, 0x81, 0x9C, 0x72, 0x54, 
-    0x73, 0x72, 0x75, 0x7B, 0xA9, 0x7E, 0x89, 0x90, 0x8B, 0x87, 0x7C, 0x7F, 
-    0x7F, 0x4D, 0x64, 0x74, 0x6F, 0x69, 0x92, 0x98, 0x77, 0x95, 0x80, 0x86, 
-    0x84, 0x87, 0x72, 0x4C, 0x7E, 0x71, 0x80, 0x73, 0x88, 0xB2, 0x74, 0x62, 
-    0x79, 0x73, 0x91, 0xA1, 0x8E, 0x8C, 0x93, 0x94, 0x80, 0x89, 0x85, 0x7E, 
-    0x7C, 0x80, 0x67, 0x5A, 0x76, 0x6E, 0x74, 0x66, 0x7D, 0x79, 0x87, 0xAB, 
-    0x89, 0x92, 0x89, 0x8D, 0x8E, 0x83, 0x8F, 0x89, 0x88, 0x81, 0x86, 0x7D, 
-    0x47, 0x78, 0x92, 0x78, 0x80, 0x83, 0x84, 0x88, 0x78, 0x47, 0x6E, 0x6F, 
-    0x6D, 0x74, 0x7A, 0x80, 0x86, 0x83, 0x80, 0x83, 0xAC, 0x9E, 0x9C, 0x97, 
-    0x90, 0xA0, 0x8E, 0x92, 0x65, 0x66, 0x95, 0x96, 0x87, 0x85, 0x9A, 0x64, 
-    0x55, 0x77, 0x6E, 0x73, 0x7E, 0xA6, 0x80, 0x89, 0x91, 0x8B, 0x85, 0x79, 
-    0x86, 0x72, 0x47, 0x75, 0x6D, 0x71, 0x6D, 0xA0, 0x8B, 0x7C, 0x95, 0x7C, 
-    0x89, 0x7F, 0x8B, 0x61, 0x53, 0x82, 0x6E, 0x83, 0x6E, 0x9C, 0xA6, 0x69, 
-    0x67, 0x77, 0x75, 0x97, 0x9D, 0x8A, 0x8C, 0x95, 0x8D, 0x80, 0x89, 0x83, 
-    0x7B, 0x61, 0x60, 0x6B, 0x76, 0x76, 0x79, 0x78, 0x71, 0x8A, 0x88, 0x79, 
-    0xAE, 0x94, 0x8E, 0x8C, 0x90, 0x97, 0x8D, 0x7A, 0x8D, 0x8D, 0x7F, 0x86, 
-    0x7F, 0x4D, 0x61, 0x84, 0x90, 0x79, 0x8E, 0x82, 0x87, 0x81, 0x43, 0x72, 
-    0x6F, 0x6F, 0x75, 0x73, 0x83, 0x84, 0x86, 0x89, 0xAE, 0x96, 0x8A, 0x97, 
-    0x8F, 0x8B, 0x8E, 0x90, 0x89, 0x58, 0x6E, 0x68, 0x92, 0x97, 0x84, 0x8F, 
-    0x82, 0x67, 0x59, 0x78, 0x70, 0x80, 0x9C, 0x83, 0x8C, 0x8D, 0x8C, 0x88, 
-    0x7F, 0x81, 0x57, 0x61, 0x6B, 0x73, 0x7A, 0x6D, 0x81, 0x9E, 0x8A, 0x8F, 
-    0x8E, 0x89, 0x86, 0x8A, 0x53, 0x6F, 0x83, 0x80, 0x76, 0x92, 0xAC, 0x82, 
-    0x95, 0x84, 0x88, 0x82, 0x64, 0x7A, 0x6C, 0x78, 0x85, 0x83, 0x8F, 0x85, 
-    0x89, 0x7C, 0x6D, 0x6B, 0x6D, 0x7A, 0x8A, 0x7B, 0x6D, 0x7B, 0x84, 0xA1, 
-    0x8D, 0x8C, 0x8A, 0x80, 0x89, 0x61, 0x6B, 0x7D, 0x96, 0x9A, 0x80, 0x90, 
-    0x89, 0x65, 0x61, 0x66, 0x87, 0x92, 0x82, 0x8F, 0x85, 0x9C, 0x70, 0x59, 
-    0x78, 0x68, 0x78, 0x6D, 0xAA, 0x99, 0x91, 0x9A, 0x89, 0x90, 0x82, 0x7B, 
-    0x61, 0x61, 0x76, 0x74, 0x86, 0x9B, 0xA0, 0x8C, 0x87, 0x89, 0x86, 0x83, 
-    0x8B, 0x58, 0x5D, 0x76, 0x77, 0x74, 0x81, 0xB1, 0x82, 0x88, 0x81, 0x8F, 
-    0x6B, 0x58, 0x83, 0x6A, 0x87, 0xA7, 0x97, 0x89, 0x83, 0x94, 0x75, 0x7F, 
-    0x84, 0x7D, 0x86, 0x77, 0x55, 0x6D, 0x72, 0x78, 0x6A, 0x73, 0xA4, 0x83, 
-    0x87, 0x82, 0x93, 0x7B, 0x4C, 0x7E, 0x6C, 0x7C, 0x78, 0x9A, 0xA0, 0x81, 
-    0x97, 0x82, 0x8E, 0x86, 0x86, 0x88, 0x86, 0x72, 0x52, 0x7A, 0x6E, 0x73, 
-    0x71, 0x72, 0x7D, 0x76, 0xAE, 0x97, 0x9B, 0x94, 0x8B, 0x98, 0x80, 0x90, 
-    0x87, 0x84, 0x80, 0x49, 0x6E, 0x74, 0x6E, 0x91, 0x93, 0x88, 0x8E, 0x64, 
-    0x68, 0x75, 0x75, 0x6B, 0x87, 0xA7, 0x88, 0x9A, 0x9C, 0x6B, 0x6B, 0x74, 
-    0x72, 0x7C, 0x9E, 0xA1, 0x94, 0x90, 0x89, 0x89, 0x88, 0x61, 0x53, 0x71, 
-    0x63, 0x7C, 0x78, 0x81, 0x99, 0x72, 0x7D, 0x75, 0x8A, 0x74, 0x9A, 0xAD, 
-    0x82, 0xA2, 0x91, 0x9C, 0x6D, 0x75, 0xA2, 0x71, 0x89, 0x71, 0x87, 0x7D, 
-    0x78, 0x88, 0x6A, 0x5A, 0x65, 0x61, 0x5D, 0x67, 0x6F, 0x7C, 0x9A, 0x8C, 
-    0x8B, 0x88, 0x8D, 0x89, 0x74, 0x4E, 0x72, 0x75, 0x75, 0x75, 0xAF, 0x93, 
-    0x89, 0x90, 0x83, 0x87, 0x4F, 0x7A, 0x74, 0x7F, 0x76, 0x9D, 0xB0, 0x53, 
-    0x95, 0x77, 0x81, 0x7C, 0x95, 0xB4, 0x83, 0xA6, 0x8B, 0x96, 0x94, 0x82, 
-    0x92, 0x70, 0x54, 0x6A, 0x6D, 0x76, 0x78, 0x7B, 0x76, 0x7D, 0x81, 0xA5, 
-    0x99, 0x92, 0x93, 0x67, 0x84, 0x9C, 0x87, 0x91, 0x7D, 0x98, 0x50, 0x5F, 
-    0x78, 0x69, 0x71, 0x7B, 0x9B, 0x7A, 0x87, 0x8F, 0x86, 0x7E, 0x77, 0x61, 
-    0x50, 0x73, 0x74, 0x75, 0x79, 0x79, 0x81, 0x73, 0x84, 0x80, 0x88, 0xAC, 
-    0x8D, 0x93, 0x87, 0x9A, 0x94, 0x84, 0x8B, 0x82, 0x83, 0x7D, 0x84, 0x77, 
-    0x7E, 0x62, 0x59, 0x64, 0x80, 0x9D, 0x81, 0x78, 0x50, 0x79, 0x9F, 0x83, 
-    0x8C, 0x87, 0x89, 0x4A, 0x6E, 0x7A, 0x7B, 0x82, 0x74, 0x79, 0xA0, 0xA0, 
-    0x9B, 0x9A, 0x8F, 0x93, 0x62, 0x64, 0x88, 0x7E, 0x8F, 0xA5, 0x67, 0x76, 
-    0x7F, 0x89, 0x78, 0x71, 0x96, 0xA0, 0x8D, 0x92, 0x91, 0x9C, 0x7E, 0x88, 
-    0x7D, 0x73, 0x8C, 0x48, 0x6E, 0x68, 0x99, 0x6B, 0x5B, 0x85, 0x67, 0x7F, 
-    0x96, 0x90, 0x91, 0x7B, 0x9E, 0x69, 0x7F, 0x9E, 0x85, 0x7A, 0x41, 0x7F, 
-    0x6E, 0x74, 0x78, 0xA1, 0x8B, 0x7C, 0x8F, 0x80, 0x88, 0x88, 0x80, 0x4D, 
-    0x5B, 0x81, 0x79, 0x77, 0x78, 0x7F, 0x79, 0x73, 0x85, 0x82, 0x83, 0xA7, 
-    0xA1, 0x89, 0x97, 0x9B, 0x98, 0x85, 0x8D, 0x87, 0x7E, 0x87, 0x84, 0x84, 
-    0x82, 0x75, 0x54, 0x5C, 0x63, 0x7A, 0x9D, 0x6C, 0x5E, 0x6A, 0x90, 0x9B, 
-    0x81, 0x95, 0x87, 0x58, 0x69, 0x75, 0x85, 0x7E, 0x7E, 0x81, 0x6D, 0xAE, 
-    0xA0, 0x99, 0x96, 0x91, 0x82, 0x4F, 0x86, 0x81, 0x81, 0x85, 0x7A, 0x81, 
-    0x78, 0x8C, 0x86, 0x75, 0x8D, 0xA3, 0x8E, 0x8C, 0x97, 0x95, 0x85, 0x80, 
-    0x85, 0x75, 0x86, 0x73, 0x48, 0x6A, 0x77, 0x9D, 0x45, 0x71, 0x76, 0x6F, 
-    0x74, 0x9C, 0x92, 0x88, 0x80, 0x7E, 0x8F, 0x89, 0x8D, 0x7F, 0x77, 0x52, 
-    0x74, 0x71, 0x9B, 0x93, 0x80, 0x7C, 0x81, 0x85, 0x78, 0x8F, 0x59, 0x4E, 
-    0x78, 0x91, 0x9E, 0x64, 0x6F, 0x80, 0x6D, 0x76, 0x72, 0x91, 0x7A, 0x8C, 
-    0xAC, 0x90, 0xA7, 0x9A, 0x96, 0x8B, 0x82, 0x8C, 0x84, 0x8D, 0x87, 0x86, 
-    0x84, 0x87, 0x59, 0x59, 0x6F, 0x68, 0x69, 0x98, 0x96, 0x5A, 0x6D, 0xA4, 
-    0x97, 0x89, 0x8B, 0x8C, 0x52, 0x6E, 0x79, 0x81, 0x96, 0x68, 0x87, 0x66, 
-    0x9D, 0xAD, 0x88, 0x9B, 0x83, 0x63, 0x66, 0x86, 0x87, 0x90, 0xA0, 0x59, 
-    0x79, 0x78, 0x86, 0x83, 0x76, 0xA2, 0x89, 0x8E, 0x87, 0x97, 0x92, 0x76, 
-    0x89, 0x71, 0x72, 0x90, 0x61, 0x4B, 0x75, 0x88, 0x50, 0x6A, 0x74, 0x78, 
-    0x6D, 0x8E, 0xA1, 0x80, 0x92, 0x88, 0x8B, 0x84, 0x85, 0x97, 0x4B, 0x6C, 
-    0x72, 0x8B, 0x9D, 0x7F, 0x95, 0x74, 0x88, 0x84, 0x75, 0x96, 0x54, 0x5B, 
-    0x5E, 0x96, 0xA0, 0x88, 0x8B, 0x4D, 0x7F, 0x66, 0x7C, 0x80, 0x7F, 0x86, 
-    0x83, 0xB7, 0x95, 0xA6, 0x9C, 0x89, 0x8E, 0x78, 0x90, 0x8E, 0x90, 0x86, 
-    0x87, 0x87, 0x7E, 0x7D, 0x44, 0x6C, 0x64, 0xA3, 0x67, 0x59, 0x7D, 0x8B, 
-    0xA7, 0x7C, 0x91, 0x94, 0x5C, 0x65, 0x66, 0x8A, 0xAA, 0x90, 0x6C, 0x5C, 
-    0x83, 0x9D, 0xA0, 0x83, 0x96, 0x70, 0x55, 0x7C, 0x78, 0xA2, 0xA6, 0x66, 
-    0x5D, 0x74, 0x86, 0x83, 0x7A, 0x8F, 0x9A, 0x89, 0x87, 0x91, 0x9C, 0x82, 
-    0x82, 0x79, 0x70, 0x84, 0x8E, 0x62, 0x4B, 0x76, 0x98, 0x55, 0x59, 0x78, 
-    0x71, 0x6E, 0x72, 0xA9, 0x89, 0x94, 0x8F, 0x83, 0x90, 0x63, 0x73, 0x6D, 
-    0x75, 0xB0, 0x83, 0x92, 0x89, 0x90, 0x7F, 0x7E, 0x89, 0x7C, 0x70, 0x49, 
-    0x6B, 0x70, 0xAC, 0x8C, 0x96, 0x59, 0x60, 0x83, 0x67, 0x83, 0x7A, 0x85, 
-    0x7C, 0x93, 0xB8, 0x92, 0xAB, 0x8C, 0x8A, 0x84, 0x82, 0x98, 0x86, 0x8D, 
-    0x83, 0x83, 0x89, 0x54, 0x66, 0x6A, 0x64, 0x6A, 0x6F, 0x93, 0x71, 0x7A, 
-    0xA3, 0x97, 0x90, 0x89, 0x8D, 0x5C, 0x65, 0x94, 0x9D, 0x90, 0x78, 0x60, 
-    0x78, 0x7D, 0xAA, 0x85, 0x8A, 0x8C, 0x5D, 0x60, 0x7C, 0xAE, 0x99, 0x5C, 
-    0x64, 0x70, 0x77, 0x7D, 0x84, 0x7C, 0x93, 0x96, 0x82, 0x90, 0x96, 0x94, 
-    0x7B, 0x7B, 0x77, 0x80, 0x86, 0x83, 0x55, 0x8C, 0x68, 0x4F, 0x6D, 0x68, 
-    0x7D, 0x6B, 0x71, 0x8A, 0xA6, 0x90, 0x90, 0x8F, 0x92, 0x67, 0x6A, 0x6F, 
-    0x90, 0xAF, 0x80, 0x8F, 0x8F, 0x82, 0x8A, 0x82, 0x84, 0x76, 0x89, 0x46, 
-    0x5E, 0x74, 0x98, 0x9F, 0x82, 0x7B, 0x4B, 0x84, 0x6D, 0x7B, 0x81, 0x76, 
-    0x8E, 0x6D, 0xAB, 0xB0, 0x99, 0x9D, 0x80, 0x93, 0x7B, 0x92, 0x92, 0x86, 
-    0x8C, 0x7D, 0x89, 0x5E, 0x81, 0x63, 0x5C, 0x6C, 0x61, 0x8D, 0xA2, 0x6C, 
-    0x71, 0xA2, 0x93, 0x80, 0x8D, 0x82, 0x4D, 0x95, 0x95, 0x7C, 0x98, 0x4F, 
-    0x74, 0x69, 0x78, 0xAD, 0x7F, 0x96, 0x61, 0x60, 0x86, 0x9D, 0xA7, 0x65, 
-    0x5B, 0x7B, 0x65, 0x80, 0x84, 0x83, 0x8C, 0x9B, 0x87, 0x8F, 0x94, 0x9A, 
-    0x83, 0x79, 0x7E, 0x7D, 0x89, 0x82, 0x87, 0x68, 0x40, 0x83, 0x94, 0x49, 
-    0x70, 0x71, 0x77, 0x67, 0x9D, 0xA5, 0x8B, 0x97, 0x8A, 0x65, 0x66, 0x76, 
-    0xA4, 0x9B, 0x82, 0x99, 0x87, 0x8A, 0x8D, 0x87, 0x80, 0x78, 0x8B, 0x4C, 
-    0x55, 0x7A, 0x85, 0xA3, 0x76, 0x95, 0x4B, 0x72, 0x7A, 0x70, 0x82, 0x70, 
-    0x8A, 0x79, 0x7D, 0xBA, 0xA1, 0x9B, 0x89, 0x8D, 0x8A, 0x85, 0x9A, 0x86, 
-    0x8A, 0x84, 0x83, 0x7F, 0x8C, 0x67, 0x4C, 0x69, 0x59, 0x7A, 0x9E, 0x8A, 
-    0x6B, 0x7B, 0x9E, 0x7D, 0x88, 0x86, 0x84, 0x85, 0x71, 0x86, 0x7E, 0x90, 
-    0x5B, 0x53, 0x62, 0x78, 0xAB, 0x72, 0x8D, 0x57, 0x98, 0x8F, 0x86, 0x8A, 
-    0x42, 0x87, 0x62, 0x77, 0x81, 0x86, 0x8F, 0x82, 0xB2, 0x83, 0x9C, 0x9F, 
-    0x8A, 0x90, 0x7C, 0x8F, 0x84, 0x90, 0x84, 0x86, 0x55, 0x56, 0xAE, 0x73, 
-    0x48, 0x77, 0x71, 0x77, 0x6F, 0xAA, 0x9C, 0x89, 0x9E, 0x5D, 0x6C, 0x71, 
-    0x9E, 0xA9, 0x73, 0x9D, 0x88, 0x8D, 0x89, 0x88, 0x89, 0x6C, 0x89, 0x65, 
-    0x3F, 0x77, 0x73, 0xA7, 0x6E, 0x93, 0x6B, 0x4F, 0x84, 0x67, 0x80, 0x6B, 
-    0x7F, 0x7D, 0x76, 0x8C, 0xA6, 0xAB, 0x89, 0x8E, 0x8D, 0x86, 0x93, 0x8D, 
-    0x8B, 0x80, 0x8A, 0x7A, 0x88, 0x82, 0x46, 0x69, 0x62, 0x5F, 0x91, 0x97, 
-    0x90, 0x78, 0x59, 0x72, 0x9B, 0x95, 0x7E, 0x8D, 0x84, 0x7C, 0x8C, 0x82, 
-    0x91, 0x73, 0x43, 0x6A, 0x62, 0x86, 0x87, 0x9B, 0x93, 0x82, 0x92, 0x89, 
-    0x68, 0x66, 0x74, 0x77, 0x72, 0x81, 0x88, 0x93, 0xB6, 0x8F, 0x8E, 0x8F, 
-    0x90, 0x87, 0x84, 0x86, 0x87, 0x88, 0x82, 0x85, 0x89, 0x56, 0x85, 0x8E, 
-    0x4B, 0x51, 0x73, 0x6F, 0x74, 0x79, 0xAE, 0x89, 0x9A, 0x67, 0x64, 0x81, 
-    0x90, 0xA8, 0x7C, 0x92, 0x94, 0x8D, 0x8C, 0x88, 0x8F, 0x77, 0x79, 0x81, 
-    0x3F, 0x6C, 0x70, 0x9E, 0x83, 0x7C, 0x91, 0x47, 0x7B, 0x70, 0x77, 0x7A, 
-    0x71, 0x88, 0x71, 0x8B, 0x88, 0xB0, 0xA2, 0x84, 0x99, 0x84, 0x95, 0x8F, 
-    0x8C, 0x86, 0x83, 0x8A, 0x75, 0x95, 0x5E, 0x50, 0x71, 0x58, 0x72, 0x9B, 
-    0x90, 0x8B, 0x55, 0x6D, 0x72, 0xA7, 0x87, 0x82, 0x8E, 0x7A, 0x87, 0x87, 
-    0x82, 0x97, 0x57, 0x4E, 0x65, 0x6F, 0x6D, 0xA1, 0xA1, 0x7F, 0x8A, 0x91, 
-    0x72, 0x5C, 0x81, 0x6D, 0x7B, 0x73, 0x86, 0x8B, 0x99, 0xB3, 0x8E, 0x8E, 
-    0x8A, 0x92, 0x82, 0x7D, 0x98, 0x81, 0x84, 0x85, 0x86, 0x80, 0x70, 0x87, 
-    0x77, 0x42, 0x5F, 0x6E, 0x73, 0x6C, 0x94, 0xA2, 0x89, 0x72, 0x61, 0x81, 
-    0x97, 0x9A, 0x86, 0x8E, 0x8E, 0x93, 0x8E, 0x8B, 0x8C, 0x84, 0x74, 0x7E, 
-    0x75, 0x50, 0x68, 0x86, 0x9B, 0x70, 0x93, 0x62, 0x5F, 0x7C, 0x6C, 0x7E, 
-    0x73, 0x80, 0x7E, 0x7E, 0x8B, 0x85, 0xC0, 0x90, 0x93, 0x94, 0x88, 0x9C, 
-    0x8B, 0x8D, 0x83, 0x8B, 0x81, 0x7E, 0x8F, 0x4B, 0x62, 0x6E, 0x57, 0x96, 
-    0x90, 0x91, 0x59, 0x6A, 0x71, 0x80, 0xAC, 0x76, 0x94, 0x7E, 0x81, 0x8A, 
-    0x81, 0x8D, 0x88, 0x4F, 0x4D, 0x6E, 0x72, 0x6D, 0xA9, 0x92, 0x7D, 0x8D, 
-    0x88, 0x56, 0x77, 0x79, 0x71, 0x79, 0x76, 0x8E, 0x84, 0xA3, 0xA9, 0x8E, 
-    0x8E, 0x88, 0x94, 0x7E, 0x88, 0x93, 0x7C, 0x85, 0x83, 0x83, 0x7B, 0x77, 
-    0x82, 0x70, 0x3F, 0x65, 0x6D, 0x72, 0x70, 0x93, 0xA4, 0x5B, 0x79, 0x75, 
-    0xA0, 0xA0, 0x81, 0x9A, 0x82, 0x96, 0x8E, 0x8E, 0x90, 0x80, 0x88, 0x6D, 
-    0x85, 0x62, 0x59, 0x9E, 0x85, 0x7A, 0x7B, 0x89, 0x4F, 0x6A, 0x76, 0x6D, 
-    0x7B, 0x72, 0x7F, 0x80, 0x7E, 0x8B, 0x82, 0xAD, 0x98, 0x98, 0x91, 0x90, 
-    0xA5, 0x83, 0x8F, 0x8B, 0x86, 0x82, 0x86, 0x83, 0x41, 0x76, 0x63, 0x84, 
-    0x98, 0x85, 0x76, 0x4C, 0x86, 0x5F, 0x9F, 0x96, 0x7D, 0x92, 0x75, 0x8F, 
-    0x83, 0x86, 0x8E, 0x6F, 0x46, 0x58, 0x7B, 0x67, 0x8B, 0xA9, 0x7E, 0x83, 
-    0x91, 0x72, 0x56, 0x86, 0x6C, 0x78, 0x76, 0x84, 0x8A, 0x94, 0xB1, 0x92, 
-    0x91, 0x84, 0x91, 0x89, 0x7B, 0x92, 0x85, 0x7E, 0x84, 0x82, 0x7E, 0x7B, 
-    0x7C, 0x7A, 0x4B, 0x4F, 0x72, 0x68, 0x77, 0x72, 0x7B, 0x77, 0x80, 0x7F, 
-    0xA4, 0xA6, 0x8C, 0x94, 0x90, 0x92, 0x95, 0x96, 0x8E, 0x87, 0x89, 0x6E, 
-    0x7B, 0x91, 0x7D, 0x85, 0x74, 0x7C, 0x75, 0x84, 0x55, 0x56, 0x74, 0x63, 
-    0x75, 0x70, 0x78, 0xB4, 0x6D, 0x69, 0x81, 0x7C, 0xAC, 0x94, 0x9B, 0x8C, 
-    0x98, 0x99, 0x80, 0x99, 0x84, 0x86, 0x84, 0x78, 0x54, 0x6D, 0x76, 0x73, 
-    0xA4, 0x80, 0x8E, 0x51, 0x72, 0x74, 0x7B, 0xAC, 0x77, 0x97, 0x7E, 0x8C, 
-    0x90, 0x80, 0x8E, 0x7F, 0x68, 0x3B, 0x6F, 0x75, 0x67, 0xA4, 0x91, 0x81, 
-    0x8B, 0x8D, 0x54, 0x73, 0x7C, 0x6C, 0x7B, 0x7B, 0x86, 0x94, 0xB1, 0x96, 
-    0x95, 0x8A, 0x86, 0x92, 0x7C, 0x86, 0x8E, 0x7E, 0x7C, 0x81, 0x83, 0x76, 
-    0x80, 0x71, 0x41, 0x5A, 0x68, 0x6C, 0x75, 0x76, 0x7D, 0x75, 0x81, 0x7D, 
-    0xA7, 0xA6, 0x8C, 0x95, 0x8B, 0x95, 0x93, 0x94, 0x90, 0x86, 0x8C, 0x57, 
-    0x64, 0x9F, 0x82, 0x88, 0x76, 0x82, 0x7B, 0x83, 0x6A, 0x4B, 0x78, 0x63, 
-    0x72, 0x72, 0x73, 0xAC, 0xA5, 0x68, 0x64, 0x88, 0x78, 0xA8, 0x9B, 0x89, 
-    0x98, 0x95, 0x8D, 0x88, 0x95, 0x84, 0x81, 0x83, 0x44, 0x6E, 0x7C, 0x6A, 
-    0xA0, 0x8E, 0x88, 0x5C, 0x69, 0x7D, 0x6A, 0xA6, 0x87, 0x8C, 0x8B, 0x82, 
-    0x9D, 0x7F, 0x8F, 0x7C, 0x81, 0x4F, 0x4C, 0x82, 0x61, 0x81, 0xA1, 0x87, 
-    0x84, 0x95, 0x67, 0x5E, 0x83, 0x6F, 0x75, 0x7C, 0x83, 0x8A, 0xB4, 0x99, 
-    0x91, 0x96, 0x7F, 0x8D, 0x86, 0x7E, 0x8C, 0x86, 0x7B, 0x7C, 0x89, 0x74, 
-    0x85, 0x5A, 0x42, 0x75, 0x67, 0x65, 0x72, 0x7D, 0x7A, 0x75, 0x84, 0x78, 
-    0x97, 0xAF, 0x8C, 0x98, 0x8A, 0x9B, 0x96, 0x8B, 0x94, 0x88, 0x8B, 0x70, 
-    0x4F, 0x86, 0x95, 0x88, 0x7C, 0x7D, 0x83, 0x82, 0x67, 0x51, 0x73, 0x6D, 
-    0x6B, 0x75, 0x72, 0x92, 0xB2, 0x91, 0x62, 0x71, 0x86, 0x6B, 0xA9, 0x96, 
-    0x90, 0x9D, 0x89, 0x94, 0x88, 0x90, 0x82, 0x85, 0x64, 0x49, 0x86, 0x67, 
-    0x98, 0x9E, 0x83, 0x66, 0x58, 0x85, 0x60, 0x90, 0x9D, 0x7E, 0x93, 0x7D, 
-    0x98, 0x8C, 0x88, 0x89, 0x71, 0x7F, 0x43, 0x67, 0x78, 0x63, 0x92, 0x96, 
-    0x80, 0x91, 0x82, 0x56, 0x76, 0x79, 0x70, 0x78, 0x85, 0x7E, 0xA9, 0xAA, 
-    0x8B, 0x9A, 0x8C, 0x82, 0x8B, 0x83, 0x83, 0x8B, 0x83, 0x77, 0x88, 0x7C, 
-    0x7E, 0x79, 0x3B, 0x5D, 0x88, 0x97, 0x66, 0x5C, 0x7C, 0x6E, 0x79, 0x74, 
-    0x7E, 0xB0, 0x93, 0x8F, 0x8C, 0x94, 0x9D, 0x8B, 0x8C, 0x82, 0x89, 0x8B, 
-    0x5D, 0x5C, 0x90, 0x95, 0x80, 0x80, 0x7F, 0x89, 0x55, 0x5F, 0x73, 0x70, 
-    0x7B, 0x71, 0x85, 0x71, 0xB0, 0xA8, 0x8D, 0x7A, 0x62, 0x87, 0x6A, 0xAE, 
-    0x9B, 0x93, 0x9B, 0x86, 0x96, 0x7F, 0x8E, 0x8B, 0x56, 0x56, 0x6C, 0x91, 
-    0x93, 0x84, 0x87, 0x54, 0x68, 0x6E, 0x75, 0x72, 0x9D, 0x94, 0x7C, 0x8D, 
-    0x8E, 0x95, 0x89, 0x7E, 0x7C, 0x72, 0x81, 0x4B, 0x6B, 0x71, 0x65, 0x9C, 
-    0x86, 0x88, 0x93, 0x5E, 0x67, 0x75, 0x76, 0x75, 0x7C, 0x87, 0x77, 0xB2, 
-    0x9F, 0x8D, 0x9E, 0x83, 0x8C, 0x81, 0x8D, 0x71, 0x7E, 0x99, 0x74, 0x8F, 
-    0x74, 0x8D, 0x56, 0x47, 0x87, 0x8F, 0x8A, 0x75, 0x59, 0x7D, 0x67, 0x85, 
-    0x70, 0x8C, 0xB0, 0x84, 0x92, 0x88, 0x9C, 0x93, 0x83, 0x8D, 0x7D, 0x88, 
-    0x87, 0x51, 0x6B, 0x9C, 0x8A, 0x7C, 0x7D, 0x8F, 0x5C, 0x58, 0x78, 0x6C, 
-    0x7C, 0x75, 0x7F, 0x7F, 0x77, 0xBE, 0x98, 0x98, 0x75, 0x65, 0x85, 0x69, 
-    0xAB, 0xA0, 0x93, 0x9D, 0x83, 0x96, 0x7F, 0x96, 0x6B, 0x43, 0x82, 0x8F, 
-    0x8B, 0x8F, 0x6C, 0x62, 0x6A, 0x65, 0x74, 0x70, 0x84, 0xA1, 0x81, 0x88, 
-    0x8B, 0x9B, 0x86, 0x7C, 0x82, 0x70, 0x7F, 0x84, 0x49, 0x69, 0x70, 0x66, 
-    0x97, 0x87, 0x8D, 0x81, 0x51, 0x7A, 0x6F, 0x80, 0x72, 0x84, 0x7A, 0x8D, 
-    0xB9, 0x8A, 0x9A, 0x96, 0x84, 0x85, 0x80, 0x94, 0x60, 0x91, 0x8E, 0x7A, 
-    0x86, 0x7A, 0x86, 0x3F, 0x62, 0x96, 0x87, 0x89, 0x77, 0x5A, 0x79, 0x6D, 
-    0x87, 0x6B, 0x9E, 0xA5, 0x82, 0x93, 0x8C, 0x9F, 0x8A, 0x84, 0x8E, 0x7A, 
-    0x8E, 0x79, 0x4D, 0x8D, 0x95, 0x83, 0x79, 0x87, 0x88, 0x47, 0x6E, 0x71, 
-    0x72, 0x7A, 0x73, 0x88, 0x73, 0x92, 0xBE, 0x88, 0x9E, 0x7D, 0x63, 0x76, 
-    0x7A, 0x8A, 0x9F, 0xA2, 0x92, 0x8A, 0x90, 0x8C, 0x88, 0x50, 0x63, 0xA3, 
-    0x7C, 0x8A, 0x82, 0x5C, 0x73, 0x6B, 0x6F, 0x66, 0x82, 0x9D, 0x82, 0x8E, 
-    0x81, 0x95, 0x8E, 0x78, 0x87, 0x74, 0x7A, 0x82, 0x7C, 0x4A, 0x66, 0x6E, 
-    0x63, 0x8E, 0x95, 0x6A, 0x5E, 0x7C, 0x7A, 0x78, 0x80, 0x7F, 0x82, 0x7A, 
-    0xAA, 0xA3, 0x97, 0x9A, 0x91, 0x8C, 0x7A, 0x95, 0x8D, 0x77, 0x92, 0x7A, 
-    0x7E, 0x79, 0x8A, 0x61, 0x40, 0x83, 0x94, 0x78, 0x8D, 0x5F, 0x64, 0x70, 
-    0x70, 0x7E, 0x6C, 0xA2, 0x9E, 0x88, 0x94, 0x8F, 0xA2, 0x82, 0x87, 0x8D, 
-    0x78, 0x98, 0x68, 0x5F, 0xA5, 0x81, 0x88, 0x75, 0x93, 0x56, 0x58, 0x7B, 
-    0x68, 0x80, 0x6F, 0x81, 0x80, 0x7B, 0x8C, 0xAC, 0xA1, 0x8D, 0x98, 0x8B, 
-    0x5F, 0x81, 0x79, 0x8B, 0xAD, 0x89, 0x8E, 0x8A, 0x95, 0x6C, 0x53, 0x9A, 
-    0x89, 0x80, 0x8A, 0x5D, 0x70, 0x6D, 0x74, 0x71, 0x71, 0xA0, 0x84, 0x88, 
-    0x82, 0x8A, 0x8F, 0x77, 0x81, 0x7C, 0x74, 0x83, 0x7A, 0x80, 0x61, 0x5E, 
-    0x7D, 0x6E, 0x5D, 0x5D, 0x72, 0x71, 0x77, 0x7C, 0x80, 0x84, 0x7F, 0x7F, 
-    0x84, 0x86, 0x89, 0x8F, 0xB2, 0x9A, 0x9E, 0x98, 0x97, 0x99, 0x89, 0x8B, 
-    0x88, 0x81, 0x85, 0x6A, 0x51, 0x8E, 0x99, 0x7D, 0x84, 0x78, 0x4E, 0x6D, 
-    0x6D, 0x77, 0x6B, 0x87, 0xA6, 0x84, 0x92, 0x8D, 0x99, 0x82, 0x78, 0x8A, 
-    0x76, 0x84, 0x5F, 0x8C, 0x93, 0x7E, 0x86, 0x75, 0x87, 0x7E, 0x5A, 0x5D, 
-    0x6B, 0x73, 0x6B, 0x78, 0x7E, 0x7A, 0x87, 0x7E, 0x83, 0x96, 0x7D, 0x7C, 
-    0x8C, 0xAE, 0x9E, 0x9C, 0x9C, 0x93, 0x97, 0x7F, 0x89, 0x8C, 0x80, 0x86, 
-    0x83, 0x76, 0x4A, 0x7C, 0x6B, 0x6D, 0x6C, 0x9C, 0x92, 0x81, 0x8D, 0x80, 
-    0x8A, 0x81, 0x7A, 0x84, 0x57, 0x89, 0x81, 0x7B, 0x7B, 0x85, 0x65, 0x3A, 
-    0x73, 0x60, 0x6C, 0x72, 0x7B, 0x7D, 0x7A, 0x8D, 0x86, 0x88, 0x85, 0x87, 
-    0x8B, 0x82, 0x98, 0x94, 0xB5, 0xA2, 0x9A, 0x96, 0x91, 0x9A, 0x7E, 0x8F, 
-    0x65, 0x61, 0x9D, 0x7F, 0x8B, 0x4B, 0x73, 0x6C, 0x62, 0x70, 0x90, 0x9F, 
-    0x7D, 0x91, 0x7A, 0x88, 0x93, 0x7E, 0x80, 0x75, 0x82, 0x77, 0x81, 0x83, 
-    0x7D, 0x7E, 0x77, 0x4F, 0x60, 0x98, 0x72, 0x88, 0x5D, 0x4F, 0x75, 0x67, 
-    0x7C, 0x6E, 0x81, 0x7C, 0x78, 0x8F, 0x7C, 0xB3, 0xB7, 0x8D, 0xA1, 0x8D, 
-    0x98, 0x8B, 0x97, 0x56, 0x8B, 0xA5, 0x7D, 0x93, 0x53, 0x80, 0x74, 0x71, 
-    0x73, 0xA0, 0xA8, 0x81, 0x9B, 0x8A, 0x85, 0x98, 0x77, 0x88, 0x4F, 0x77, 
-    0x98, 0x7F, 0x89, 0x7A, 0x8C, 0x71, 0x55, 0x52, 0x5F, 0x6E, 0x68, 0x6D, 
-    0x7B, 0x7E, 0x88, 0xAE, 0x87, 0x63, 0x83, 0x77, 0x8A, 0x82, 0x8B, 0xBE, 
-    0x9A, 0x9C, 0x8F, 0x99, 0x8A, 0x8D, 0x57, 0x60, 0xA7, 0x77, 0x8E, 0x5D, 
-    0x68, 0x6F, 0x64, 0x6F, 0x81, 0xA2, 0x77, 0x8B, 0x80, 0x65, 0xA1, 0x89, 
-    0x7F, 0x7E, 0x80, 0x7F, 0x80, 0x88, 0x76, 0x88, 0x75, 0x6E, 0x54, 0x76, 
-    0x96, 0x78, 0x87, 0x54, 0x5D, 0x6E, 0x67, 0x7C, 0x6A, 0x82, 0x79, 0x7E, 
-    0x91, 0x7F, 0xBF, 0xAA, 0x91, 0xA1, 0x8C, 0xA5, 0x70, 0x6A, 0x98, 0xA4, 
-    0x8A, 0x8F, 0x92, 0x5D, 0x78, 0x7B, 0x67, 0x8F, 0xA5, 0x8B, 0x8E, 0x90, 
-    0x8D, 0x8B, 0x80, 0x7B, 0x53, 0x69, 0x94, 0x82, 0x85, 0x7A, 0x93, 0x72, 
-    0x73, 0x5F, 0x4A, 0x68, 0x60, 0x6D, 0x6F, 0x7B, 0x88, 0x81, 0xB1, 0x76, 
-    0x67, 0x81, 0x7B, 0x91, 0x6D, 0xB5, 0xAE, 0x90, 0x9F, 0x8C, 0x9C, 0x80, 
-    0x89, 0x80, 0x73, 0x87, 0x80, 0x81, 0x4B, 0x6C, 0x6B, 0x59, 0x7E, 0x95, 
-    0x83, 0x82, 0x86, 0x76, 0x7E, 0x70, 0x5E, 0x89, 0x92, 0x7F, 0x8A, 0x8B, 
-    0x88, 0x8A, 0x80, 0x7D, 0x64, 0x68, 0x92, 0x84, 0x86, 0x85, 0x66, 0x5C, 
-    0x74, 0x77, 0x64, 0x75, 0x7F, 0x75, 0x86, 0x81, 0xAF, 0xB7, 0x8F, 0x9D, 
-    0x8E, 0x92, 0x64, 0x74, 0x8A, 0xA3, 0x99, 0x85, 0xA3, 0x6B, 0x68, 0x7E, 
-    0x6E, 0x71, 0x8E, 0xA9, 0x84, 0x99, 0x94, 0x8D, 0x8C, 0x6F, 0x5E, 0x76, 
-    0x87, 0x81, 0x82, 0x80, 0x86, 0x80, 0x71, 0x69, 0x5C, 0x51, 0x58, 0x6A, 
-    0x6B, 0x76, 0x7F, 0x87, 0x9C, 0x65, 0x79, 0x7E, 0x81, 0x86, 0x7B, 0x9D, 
-    0xB4, 0x9C, 0x9E, 0x94, 0x9C, 0x86, 0x88, 0x84, 0x7A, 0x89, 0x7F, 0x82, 
-    0x51, 0x64, 0x6F, 0x65, 0x6C, 0x96, 0x8A, 0x81, 0x86, 0x8A, 0x61, 0x60, 
-    0x92, 0x8A, 0x7E, 0x82, 0x88, 0x8D, 0x7F, 0x8A, 0x81, 0x78, 0x7E, 0x77, 
-    0x79, 0x7B, 0x5D, 0x66, 0x68, 0x8A, 0x91, 0x54, 0x78, 0x77, 0x7A, 0x7A, 
-    0x83, 0x95, 0x7C, 0xBA, 0xA5, 0x95, 0xA5, 0x93, 0x9C, 0x81, 0x8A, 0x8B, 
-    0x8B, 0x8C, 0x51, 0x77, 0x72, 0x75, 0xA1, 0x8A, 0x8E, 0x8A, 0x87, 0x8B, 
-    0x86, 0x8C, 0x77, 0x81, 0x76, 0x75, 0x86, 0x7C, 0x7B, 0x80, 0x51, 0x42, 
-    0x66, 0x60, 0x65, 0x70, 0x71, 0x84, 0xAB, 0x90, 0x9A, 0x6A, 0x6B, 0x79, 
-    0x74, 0x7D, 0x87, 0x90, 0x9A, 0xB5, 0x9C, 0x98, 0x9E, 0x92, 0x7F, 0x86, 
-    0x7D, 0x8C, 0x6A, 0x55, 0x76, 0x6F, 0x6D, 0x74, 0xA4, 0x7B, 0x8A, 0x75, 
-    0x50, 0x8A, 0x9C, 0x8B, 0x84, 0x83, 0x8A, 0x7F, 0x86, 0x7C, 0x86, 0x7C, 
-    0x73, 0x7E, 0x76, 0x7D, 0x88, 0x6B, 0x66, 0x6D, 0x53, 0x61, 0x6D, 0x73, 
-    0x6C, 0x75, 0x7F, 0x7C, 0x8C, 0x84, 0x9B, 0xB5, 0x92, 0xA4, 0x96, 0x9A, 
-    0x92, 0x95, 0x5D, 0x66, 0x7E, 0x73, 0x7C, 0xA6, 0xA0, 0x90, 0x91, 0x89, 
-    0x8B, 0x91, 0x72, 0x6A, 0x78, 0x75, 0x98, 0x8C, 0x86, 0x87, 0x84, 0x76, 
-    0x76, 0x60, 0x54, 0x64, 0x6D, 0x61, 0x78, 0x77, 0x97, 0xA4, 0x87, 0x8C, 
-    0x91, 0x62, 0x65, 0x7F, 0x7B, 0x7C, 0xA1, 0xAB, 0x8D, 0x9B, 0x8B, 0x90, 
-    0x87, 0x79, 0x8B, 0x50, 0x5D, 0x75, 0x74, 0x6E, 0x89, 0xA9, 0x72, 0x8A, 
-    0x83, 0x7F, 0x83, 0x7F, 0x81, 0x7F, 0x67, 0x55, 0x79, 0x6B, 0x79, 0xA6, 
-    0x7F, 0x88, 0x85, 0x8B, 0x66, 0x68, 0x77, 0x65, 0x84, 0x8D, 0xA2, 0x96, 
-    0x89, 0x5E, 0x74, 0x70, 0x7C, 0x7C, 0x9B, 0xAB, 0x94, 0x9D, 0x96, 0x9B, 
-    0x90, 0x7E, 0x81, 0x46, 0x63, 0x6F, 0x78, 0x75, 0x9B, 0xA7, 0x7E, 0x93, 
-    0x87, 0x8B, 0x84, 0x82, 0x81, 0x68, 0x6C, 0x6C, 0x6E, 0x7F, 0xA4, 0x89, 
-    0x7C, 0x82, 0x89, 0x61, 0x5D, 0x73, 0x70, 0x8C, 0x8F, 0x88, 0x91, 0x82, 
-    0x97, 0x5D, 0x55, 0x76, 0x72, 0x74, 0x81, 0xB7, 0x8C, 0x96, 0x97, 0x88, 
-    0x8F, 0x80, 0x8B, 0x56, 0x57, 0x75, 0x72, 0x78, 0x90, 0xB2, 0x82, 0x8A, 
-    0x8C, 0x84, 0x86, 0x83, 0x81, 0x7C, 0x61, 0x62, 0x76, 0x75, 0x9D, 0x91, 
-    0x7D, 0x80, 0x8B, 0x83, 0x6F, 0x8C, 0x81, 0x66, 0x61, 0x70, 0xA8, 0x86, 
-    0x8F, 0x62, 0x5C, 0x74, 0x73, 0x80, 0x80, 0xB8, 0x8F, 0x8D, 0x98, 0x92, 
-    0xA0, 0x83, 0x8D, 0x59, 0x4E, 0x76, 0x70, 0x7B, 0x7B, 0xB7, 0x86, 0x87, 
-    0x90, 0x89, 0x89, 0x80, 0x72, 0x4E, 0x6B, 0x7A, 0x74, 0x81, 0xA6, 0x92, 
-    0x83, 0x82, 0x8F, 0x88, 0x81, 0x88, 0x80, 0x7F, 0x51, 0x6A, 0x73, 0x6A, 
-    0x70, 0x79, 0xA3, 0x84, 0x97, 0x90, 0x91, 0x92, 0x79, 0x89, 0x7E, 0x81, 
-    0x87, 0x7E, 0x89, 0x5F, 0x50, 0x69, 0x64, 0x74, 0x69, 0xA4, 0x98, 0x88, 
-    0x94, 0x87, 0x9E, 0x66, 0x4F, 0x7C, 0x5E, 0xA9, 0x96, 0x97, 0x97, 0x8F, 
-    0x98, 0x40, 0x7F, 0x72, 0x73, 0x79, 0x79, 0xC2, 0x6A, 0x78, 0x8A, 0x73, 
-    0x84, 0x68, 0xB3, 0x8F, 0x97, 0xA6, 0x8C, 0xA5, 0x83, 0x95, 0x76, 0x48, 
-    0x72, 0x8A, 0x93, 0x78, 0x59, 0x70, 0x90, 0x6C, 0x56, 0x8F, 0x98, 0x7D, 
-    0x7C, 0x84, 0x90, 0x8C, 0x67, 0x66, 0x63, 0x6C, 0x66, 0x95, 0x99, 0x80, 
-    0x9F, 0x69, 0x5C, 0x7D, 0x6E, 0x76, 0x8D, 0xA2, 0x5D, 0x75, 0x88, 0x79, 
-    0x85, 0x77, 0xAB, 0x89, 0x8B, 0x98, 0x99, 0x9A, 0x82, 0x9F, 0x4A, 0x63, 
-    0x73, 0x8E, 0x8D, 0x48, 0x84, 0x6C, 0x78, 0x90, 0xA2, 0x92, 0x81, 0x8E, 
-    0x7A, 0x86, 0x97, 0x8D, 0x5C, 0x63, 0x72, 0x9F, 0x8D, 0x86, 0x8F, 0x82, 
-    0x6E, 0x4F, 0x71, 0x82, 0x80, 0x62, 0x87, 0x73, 0x72, 0x87, 0x7C, 0x82, 
-    0x7D, 0x82, 0x8A, 0xB1, 0x9F, 0x9A, 0xA0, 0x8E, 0x93, 0x8D, 0x89, 0x8C, 
-    0x81, 0x7E, 0x4D, 0x64, 0x75, 0xA3, 0x5E, 0x56, 0x98, 0x90, 0x7D, 0x82, 
-    0x84, 0x86, 0x6D, 0x4C, 0x72, 0x6D, 0x8F, 0xA7, 0x56, 0x66, 0x91, 0xAC, 
-    0x77, 0x96, 0x7C, 0x4F, 0x82, 0x74, 0xAB, 0x99, 0x67, 0x76, 0x72, 0x76, 
-    0x7E, 0x8F, 0xA4, 0x8D, 0x97, 0x80, 0x99, 0xA0, 0x88, 0x8C, 0x81, 0x42, 
-    0x6E, 0x67, 0x85, 0x7D, 0x57, 0x7C, 0x6C, 0x79, 0x99, 0xA0, 0x8C, 0x85, 
-    0x87, 0x85, 0x84, 0x9E, 0x6B, 0x5F, 0x6D, 0x85, 0x9C, 0x7F, 0x90, 0x8A, 
-    0x7A, 0x42, 0x71, 0x6F, 0x73, 0xA6, 0x88, 0x6C, 0x5B, 0x86, 0x76, 0x72, 
-    0x7E, 0x76, 0x7F, 0x7F, 0xB3, 0xA0, 0x9D, 0x9E, 0x91, 0x8C, 0x81, 0x97, 
-    0x83, 0x84, 0x56, 0x63, 0x75, 0x6C, 0x81, 0x95, 0x9C, 0x5B, 0x7D, 0xA0, 
-    0x80, 0x93, 0x7F, 0x86, 0x47, 0x75, 0x73, 0xA2, 0x93, 0x83, 0x79, 0x43, 
-    0x84, 0xA6, 0x88, 0x5B, 0x6D, 0x8D, 0x90, 0x94, 0x92, 0x58, 0x81, 0x68, 
-    0x72, 0x70, 0x9B, 0xB7, 0x86, 0x8D, 0x8A, 0x99, 0x8F, 0x8A, 0x87, 0x79, 
-    0x6D, 0x4F, 0x62, 0x9D, 0x7C, 0x50, 0x6E, 0x6F, 0x70, 0x8E, 0x9F, 0x8A, 
-    0x8D, 0x87, 0x8D, 0x8B, 0x8B, 0x5E, 0x79, 0x5E, 0x8F, 0x9D, 0x81, 0x96, 
-    0x8B, 0x81, 0x43, 0x7C, 0x6D, 0x9C, 0x97, 0x81, 0x74, 0x57, 0x87, 0x71, 
-    0x7B, 0x74, 0x74, 0x84, 0x6D, 0xBA, 0x9C, 0x9C, 0x9E, 0x89, 0x94, 0x7D, 
-    0x98, 0x7F, 0x89, 0x6A, 0x47, 0x7F, 0x5E, 0x9F, 0x91, 0x83, 0x61, 0x71, 
-    0xA4, 0x78, 0x94, 0x86, 0x6E, 0x54, 0x67, 0x79, 0xA5, 0x90, 0x7F, 0x4D, 
-    0x6C, 0x73, 0x7F, 0x80, 0x75, 0x9C, 0xA0, 0x7E, 0xA9, 0x7F, 0x6C, 0x7F, 
-    0x73, 0x75, 0x79, 0xC0, 0x93, 0x95, 0x94, 0x89, 0x99, 0x86, 0x8B, 0x82, 
-    0x83, 0x60, 0x4B, 0x74, 0x6E, 0x74, 0x66, 0x69, 0x79, 0x67, 0x95, 0x9A, 
-    0x8F, 0x8D, 0x8B, 0x92, 0x88, 0x83, 0x5D, 0x74, 0x9C, 0x85, 0x82, 0x87, 
-    0x8B, 0x89, 0x45, 0x6F, 0x6B, 0x89, 0x9D, 0x79, 0x99, 0x53, 0x6E, 0x78, 
-    0x66, 0x81, 0x67, 0x81, 0x73, 0x7D, 0xB7, 0x97, 0xA5, 0x8D, 0x8E, 0x90, 
-    0x85, 0x8F, 0x82, 0x8B, 0x4E, 0x68, 0x75, 0x72, 0xA8, 0x8D, 0x76, 0x50, 
-    0xA8, 0x86, 0x8B, 0x92, 0x89, 0x6C, 0x52, 0x72, 0x96, 0xA0, 0x7D, 0x8B, 
-    0x51, 0x57, 0x81, 0x77, 0x79, 0x92, 0xA3, 0x7D, 0x8F, 0x9B, 0x59, 0x84, 
-    0x6D, 0x77, 0x6F, 0x86, 0xBE, 0x92, 0x99, 0x8F, 0x99, 0x8A, 0x81, 0x98, 
-    0x76, 0x84, 0x74, 0x3F, 0x71, 0x6B, 0x77, 0x64, 0x6E, 0x78, 0x65, 0x8C, 
-    0xA4, 0x8E, 0x95, 0x87, 0x9D, 0x67, 0x5B, 0xAB, 0x91, 0x87, 0x81, 0x89, 
-    0x84, 0x8A, 0x67, 0x51, 0x79, 0x65, 0x96, 0x8C, 0x85, 0x98, 0x53, 0x6C, 
-    0x6A, 0x78, 0x70, 0x71, 0x86, 0x6A, 0x83, 0xAE, 0xA3, 0x9D, 0x91, 0x90, 
-    0x8C, 0x83, 0x8A, 0x8C, 0x80, 0x4D, 0x71, 0x6C, 0xA2, 0x90, 0x7C, 0x87, 
-    0x77, 0x87, 0x7B, 0x8B, 0x8B, 0x7D, 0x4C, 0x63, 0x6A, 0x99, 0x97, 0x83, 
-    0x80, 0x42, 0x74, 0x73, 0x75, 0x8A, 0xA0, 0x97, 0x7E, 0x9B, 0x73, 0x6E, 
-    0x89, 0x68, 0x7F, 0x6A, 0xA5, 0xAD, 0x96, 0x9D, 0x92, 0x9C, 0x80, 0x93, 
-    0x8F, 0x77, 0x8B, 0x76, 0x42, 0x6D, 0x6D, 0xA0, 0x50, 0x65, 0x74, 0x63, 
-    0x82, 0x9C, 0x9B, 0x88, 0x97, 0x76, 0x66, 0xB1, 0x87, 0x91, 0x7D, 0x83, 
-    0x83, 0x82, 0x84, 0x46, 0x7F, 0x55, 0x84, 0xA3, 0x6C, 0xAA, 0x63, 0x55, 
-    0x73, 0x6E, 0x7F, 0x68, 0x8C, 0x66, 0x7F, 0x87, 0x9B, 0xB7, 0x8D, 0x96, 
-    0x8C, 0x8D, 0x8B, 0x8B, 0x93, 0x53, 0x6B, 0x70, 0x6C, 0x8E, 0x98, 0x90, 
-    0x55, 0x95, 0x90, 0x84, 0x94, 0x84, 0x94, 0x55, 0x56, 0x83, 0xA0, 0x84, 
-    0x83, 0x72, 0x3E, 0x76, 0x79, 0x6B, 0x8D, 0xA9, 0x7B, 0x8E, 0x74, 0x66, 
-    0x8B, 0x75, 0x76, 0x75, 0x7C, 0xAE, 0xA3, 0x9A, 0x8E, 0xA3, 0x8B, 0x81, 
-    0x98, 0x85, 0x81, 0x90, 0x5C, 0x4E, 0x6F, 0x80, 0x9A, 0x41, 0x6C, 0x6C, 
-    0x67, 0x7E, 0xA5, 0x94, 0x8C, 0x8F, 0x8E, 0x58, 0x94, 0xA0, 0x82, 0x84, 
-    0x7B, 0x8B, 0x88, 0x56, 0x6C, 0x72, 0x64, 0xA0, 0x86, 0x88, 0x8D, 0x60, 
-    0x6D, 0x6A, 0x85, 0x73, 0x7C, 0xAD, 0x50, 0x8F, 0x7B, 0x97, 0xBB, 0x82, 
-    0xA2, 0x86, 0x93, 0x8C, 0x88, 0x96, 0x6E, 0x5F, 0x63, 0x77, 0xAE, 0x57, 
-    0x65, 0x9F, 0x84, 0x84, 0x88, 0x94, 0x87, 0x82, 0x54, 0x5F, 0xA5, 0x87, 
-    0x80, 0x87, 0x57, 0x54, 0x70, 0x6F, 0x6B, 0x9F, 0x8C, 0x84, 0x8F, 0x4E, 
-    0x86, 0x81, 0x71, 0x76, 0x7B, 0x7F, 0xAB, 0xA7, 0x8E, 0x9D, 0xA0, 0x82, 
-    0x8F, 0x92, 0x87, 0x87, 0x87, 0x71, 0x4E, 0x67, 0x80, 0xA7, 0x4B, 0x52, 
-    0x76, 0x5F, 0x7E, 0xA4, 0x91, 0x8F, 0x8D, 0x57, 0x7B, 0xAD, 0x89, 0x8D, 
-    0x81, 0x80, 0x87, 0x82, 0x50, 0x7C, 0x6F, 0x82, 0x99, 0x7D, 0x90, 0x83, 
-    0x5C, 0x69, 0x70, 0x84, 0x66, 0x9E, 0xA5, 0x53, 0x89, 0x7A, 0x8D, 0xAF, 
-    0x8B, 0x9D, 0x86, 0x90, 0x91, 0x82, 0x99, 0x5B, 0x6E, 0x82, 0x59, 0x73, 
-    0x7B, 0xA5, 0x80, 0x82, 0x88, 0x8C, 0x8F, 0x7F, 0x87, 0x80, 0x7B, 0x81, 
-    0x81, 0x79, 0x86, 0x55, 0x41, 0x6C, 0x65, 0x6E, 0xA2, 0x87, 0x90, 0x67, 
-    0x5F, 0x7E, 0x75, 0x7F, 0x76, 0x80, 0x7E, 0xB0, 0xA7, 0x96, 0xA6, 0x9A, 
-    0x8A, 0x90, 0x8F, 0x8D, 0x8B, 0x91, 0x65, 0x50, 0x78, 0x9F, 0x8A, 0x3D, 
-    0x67, 0x6C, 0x64, 0x71, 0xAB, 0x96, 0x95, 0x78, 0x53, 0xA4, 0x98, 0x8E, 
-    0x8A, 0x7E, 0x89, 0x85, 0x59, 0x6E, 0x7A, 0x7D, 0x92, 0x86, 0x86, 0x8D, 
-    0x6A, 0x66, 0x6A, 0x7A, 0x75, 0x75, 0xA1, 0x98, 0x76, 0x6C, 0x83, 0x7D, 
-    0xA0, 0x98, 0x91, 0x87, 0x8D, 0x91, 0x82, 0x8A, 0x89, 0x79, 0x4B, 0x5A, 
-    0x78, 0x97, 0x7D, 0x89, 0x82, 0x7B, 0x8C, 0x80, 0x7C, 0x8A, 0x7B, 0x7B, 
-    0x74, 0x83, 0x7F, 0x88, 0x44, 0x4E, 0x6C, 0x5E, 0x76, 0xA1, 0x8B, 0x8D, 
-    0x59, 0x72, 0x7E, 0x81, 0x82, 0x7D, 0x82, 0x81, 0xBD, 0xA3, 0x9E, 0xAA, 
-    0x99, 0x90, 0x8E, 0x96, 0x8D, 0x93, 0x87, 0x83, 0x68, 0x52, 0xA1, 0x92, 
-    0x4F, 0x4E, 0x6C, 0x67, 0x68, 0x9C, 0xA2, 0x81, 0x5B, 0x85, 0xA9, 0x85, 
-    0x92, 0x92, 0x7F, 0x87, 0x62, 0x61, 0x7E, 0x74, 0x95, 0x89, 0x83, 0x90, 
-    0x85, 0x59, 0x6E, 0x77, 0x6C, 0x75, 0x7E, 0x98, 0x9F, 0x80, 0x5F, 0x84, 
-    0x76, 0x90, 0xA5, 0x86, 0x8A, 0x92, 0x8B, 0x82, 0x88, 0x90, 0x67, 0x52, 
-    0x57, 0x7B, 0x9D, 0x72, 0x91, 0x7B, 0x85, 0x62, 0x5A, 0xA7, 0x83, 0x87, 
-    0x78, 0x82, 0x89, 0x81, 0x90, 0x3B, 0x66, 0x69, 0x5D, 0x82, 0x99, 0x9E, 
-    0x83, 0x54, 0x7D, 0x7A, 0x83, 0x7B, 0x89, 0x75, 0x9F, 0xB3, 0x98, 0xA3, 
-    0xA6, 0x99, 0x86, 0x8B, 0x90, 0x8C, 0x92, 0x7E, 0x8C, 0x6A, 0x4E, 0xA2, 
-    0x84, 0x65, 0x42, 0x6A, 0x65, 0x6C, 0x7C, 0x77, 0x86, 0x7B, 0xA3, 0x9A, 
-    0x8C, 0x9B, 0x8F, 0x8E, 0x7A, 0x5A, 0x7E, 0x6F, 0x90, 0x9B, 0x86, 0x8F, 
-    0x8D, 0x60, 0x62, 0x7A, 0x76, 0x6F, 0x78, 0x84, 0xA2, 0x9A, 0x85, 0x5D, 
-    0x87, 0x69, 0x8C, 0xA5, 0x7C, 0x9C, 0x88, 0x87, 0x88, 0x83, 0x8E, 0x6A, 
-    0x4E, 0x57, 0x83, 0x91, 0x74, 0x8B, 0x85, 0x5F, 0x53, 0x84, 0x99, 0x86, 
-    0x83, 0x7E, 0x84, 0x81, 0x91, 0x80, 0x43, 0x6B, 0x62, 0x67, 0x75, 0xA6, 
-    0xA1, 0x5A, 0x6E, 0x7F, 0x7A, 0x87, 0x7F, 0x8A, 0x6F, 0x9D, 0xB6, 0x98, 
-    0xAB, 0x9F, 0x9D, 0x81, 0x8B, 0x97, 0x88, 0x90, 0x82, 0x86, 0x78, 0x4E, 
-    0xA0, 0x7D, 0x71, 0x40, 0x5C, 0x6A, 0x66, 0x7E, 0x6F, 0x85, 0x78, 0x9D, 
-    0xA0, 0x87, 0x9F, 0x8B, 0x97, 0x60, 0x64, 0x8A, 0x6A, 0xA1, 0x94, 0x88, 
-    0x94, 0x7A, 0x63, 0x6E, 0x7B, 0x78, 0x6F, 0x7F, 0x7A, 0xAC, 0x99, 0x8C, 
-    0x65, 0x7C, 0x6C, 0x89, 0xA4, 0x7E, 0x9E, 0x83, 0x85, 0x8B, 0x80, 0x8B, 
-    0x7B, 0x4D, 0x49, 0x88, 0x8E, 0x72, 0x8E, 0x78, 0x53, 0x63, 0x72, 0x9F, 
-    0x8A, 0x86, 0x80, 0x84, 0x85, 0x8C, 0x8D, 0x44, 0x6B, 0x68, 0x65, 0x6F, 
-    0xA6, 0x8B, 0x5B, 0x8A, 0x73, 0x86, 0x86, 0x87, 0x89, 0x76, 0xB6, 0x9F, 
-    0xA4, 0xA1, 0x9E, 0x9E, 0x79, 0x97, 0x8C, 0x89, 0x8B, 0x83, 0x83, 0x7D, 
-    0x79, 0x85, 0x6C, 0x7D, 0x55, 0x39, 0x67, 0x62, 0x70, 0x6A, 0x78, 0x7D, 
-    0xA2, 0x94, 0x89, 0x93, 0x8C, 0x90, 0x56, 0x6E, 0x7C, 0x83, 0xAD, 0x83, 
-    0x98, 0x88, 0x85, 0x5D, 0x6B, 0x7F, 0x72, 0x7E, 0x73, 0x8C, 0xB2, 0x93, 
-    0x93, 0x5A, 0x7F, 0x6E, 0x7F, 0xA5, 0x87, 0xA1, 0x83, 0x8D, 0x91, 0x7F, 
-    0x91, 0x71, 0x3D, 0x76, 0x8A, 0x81, 0x7B, 0x8C, 0x61, 0x51, 0x6D, 0x77, 
-    0xA2, 0x85, 0x89, 0x82, 0x84, 0x89, 0x91, 0x84, 0x41, 0x71, 0x63, 0x62, 
-    0x7F, 0x7A, 0x84, 0x75, 0x82, 0x77, 0x88, 0x8F, 0x81, 0x89, 0x88, 0xB0, 
-    0xA3, 0x9E, 0xA0, 0x9C, 0x93, 0x85, 0x91, 0x86, 0x89, 0x86, 0x82, 0x7E, 
-    0x88, 0x5C, 0x74, 0x87, 0x6B, 0x71, 0x32, 0x69, 0x61, 0x68, 0x74, 0x6B, 
-    0x88, 0x9C, 0x8E, 0x8F, 0x86, 0x9D, 0x86, 0x53, 0x75, 0x74, 0xAC, 0x91, 
-    0x88, 0x8F, 0x8E, 0x71, 0x5A, 0x7A, 0x75, 0x78, 0x7A, 0x70, 0x93, 0xB0, 
-    0x96, 0x98, 0x63, 0x70, 0x7C, 0x72, 0x95, 0xA2, 0x96, 0x8E, 0x8A, 0x97, 
-    0x7D, 0x99, 0x6F, 0x4D, 0x93, 0x71, 0x82, 0x85, 0x6C, 0x57, 0x6B, 0x63, 
-    0x7E, 0xA4, 0x84, 0x89, 0x89, 0x81, 0x8F, 0x8E, 0x82, 0x68, 0x5B, 0x61, 
-    0x69, 0x7F, 0x6D, 0x81, 0x7E, 0x74, 0x82, 0x85, 0x88, 0x87, 0x8B, 0x83, 
-    0x97, 0xB5, 0x9D, 0xA3, 0x98, 0x95, 0x8D, 0x87, 0x90, 0x85, 0x88, 0x80, 
-    0x81, 0x83, 0x4F, 0x93, 0x7A, 0x6A, 0x76, 0x37, 0x5F, 0x5F, 0x6C, 0x6F, 
-    0x65, 0x99, 0x92, 0x89, 0x90, 0x81, 0xA4, 0x5F, 0x5E, 0x78, 0x85, 0xAC, 
-    0x83, 0x92, 0x85, 0x91, 0x58, 0x64, 0x7E, 0x6E, 0x7B, 0x71, 0x7B, 0x8D, 
-    0xB5, 0x98, 0x95, 0x80, 0x57, 0x88, 0x6B, 0x95, 0xA9, 0x8F, 0x98, 0x84, 
-    0x9A, 0x7F, 0x94, 0x7D, 0x68, 0x86, 0x6D, 0x7E, 0x85, 0x52, 0x62, 0x6B, 
-    0x5F, 0x96, 0x95, 0x85, 0x8B, 0x85, 0x8B, 0x77, 0x8B, 0x8F, 0x88, 0x5D, 
-    0x48, 0x7E, 0x6A, 0x74, 0x7A, 0x77, 0x78, 0x7E, 0x83, 0x7F, 0x91, 0x8C, 
-    0x7E, 0x9C, 0xAD, 0xA3, 0xA3, 0x97, 0x9A, 0x8D, 0x89, 0x91, 0x89, 0x88, 
-    0x82, 0x87, 0x78, 0x56, 0x9A, 0x73, 0x6F, 0x75, 0x3E, 0x55, 0x63, 0x69, 
-    0x6D, 0x66, 0x9C, 0x8F, 0x88, 0x8E, 0x83, 0xA1, 0x57, 0x61, 0x7A, 0x94, 
-    0x9D, 0x86, 0x8D, 0x89, 0x88, 0x4F, 0x6F, 0x79, 0x70, 0x78, 0x6F, 0x85, 
-    0x7E, 0xB8, 0x9C, 0x94, 0x83, 0x56, 0x8A, 0x6F, 0x80, 0xA8, 0x9F, 0x95, 
-    0x8A, 0x97, 0x8A, 0x8D, 0x86, 0x6F, 0x81, 0x73, 0x7C, 0x7A, 0x49, 0x71, 
-    0x67, 0x69, 0x98, 0x8E, 0x88, 0x84, 0x8A, 0x89, 0x69, 0x8D, 0x93, 0x82, 
-    0x83, 0x40, 0x73, 0x67, 0x6F, 0x7A, 0x68, 0x81, 0x77, 0x7F, 0x81, 0x86, 
-    0x91, 0x7E, 0xB3, 0x9E, 0x99, 0xA3, 0x97, 0x99, 0x88, 0x92, 0x8A, 0x8B, 
-    0x8A, 0x7E, 0x8B, 0x75, 0x79, 0x83, 0x70, 0x71, 0x74, 0x44, 0x48, 0x6C, 
-    0x5F, 0x6E, 0x68, 0x9F, 0x90, 0x85, 0x8F, 0x83, 0x9A, 0x56, 0x62, 0x96, 
-    0x93, 0x91, 0x8A, 0x89, 0x93, 0x68, 0x5B, 0x74, 0x74, 0x76, 0x70, 0x80, 
-    0x7E, 0x8A, 0xBF, 0x8F, 0x9E, 0x85, 0x59, 0x82, 0x75, 0x7F, 0xA1, 0xA8, 
-    0x92, 0x8F, 0x95, 0x8E, 0x8B, 0x81, 0x72, 0x81, 0x73, 0x7E, 0x5E, 0x5A, 
-    0x72, 0x65, 0x78, 0x95, 0x8D, 0x87, 0x82, 0x8E, 0x81, 0x53, 0x99, 0x99, 
-    0x7F, 0x88, 0x50, 0x6B, 0x65, 0x73, 0x77, 0x65, 0x87, 0x70, 0x7F, 0x7F, 
-    0x84, 0x94, 0x88, 0xB0, 0x99, 0x95, 0x9A, 0x9B, 0x92, 0x85, 0x94, 0x86, 
-    0x89, 0x89, 0x81, 0x86, 0x7A, 0x7D, 0x75, 0x73, 0x6F, 0x76, 0x3C, 0x50, 
-    0x69, 0x60, 0x6C, 0x70, 0xA9, 0x84, 0x8B, 0x8B, 0x86, 0x95, 0x4C, 0x80, 
-    0xA3, 0x82, 0x96, 0x80, 0x96, 0x7E, 0x53, 0x72, 0x6B, 0x7E, 0x6E, 0x78, 
-    0x87, 0x79, 0x99, 0xB6, 0x94, 0xA0, 0x89, 0x5F, 0x7C, 0x7D, 0x7D, 0xAA, 
-    0xA3, 0x94, 0x90, 0x94, 0x91, 0x85, 0x84, 0x75, 0x7F, 0x77, 0x76, 0x56, 
-    0x64, 0x6D, 0x65, 0x8C, 0x8D, 0x88, 0x89, 0x7D, 0x95, 0x64, 0x5A, 0xA7, 
-    0x8D, 0x83, 0x82, 0x64, 0x59, 0x69, 0x75, 0x6D, 0x6E, 0x81, 0x71, 0x7E, 
-    0x7D, 0x89, 0x8F, 0x8B, 0xAE, 0x99, 0x8F, 0x99, 0x9E, 0x8B, 0x89, 0x95, 
-    0x84, 0x88, 0x8A, 0x80, 0x82, 0x79, 0x7C, 0x74, 0x72, 0x6F, 0x77, 0x38, 
-    0x54, 0x67, 0x61, 0x68, 0x79, 0xA9, 0x7F, 0x90, 0x88, 0x8A, 0x90, 0x56, 
-    0xA1, 0x8A, 0x83, 0x91, 0x80, 0x94, 0x47, 0x75, 0x6D, 0x6F, 0x7F, 0x6A, 
-    0x89, 0x7C, 0x85, 0x96, 0xB5, 0x9F, 0x99, 0x92, 0x5C, 0x83, 0x81, 0x7E, 
-    0xAB, 0xA0, 0x96, 0x8D, 0x9A, 0x8C, 0x85, 0x88, 0x77, 0x7C, 0x7E, 0x65, 
-    0x53, 0x71, 0x62, 0x72, 0x95, 0x84, 0x8C, 0x87, 0x81, 0x93, 0x50, 0x75, 
-    0xA6, 0x84, 0x82, 0x81, 0x7C, 0x40, 0x71, 0x6F, 0x66, 0x75, 0x74, 0x77, 
-    0x78, 0x7F, 0x8C, 0x86, 0x9C, 0xA6, 0x97, 0x8C, 0x96, 0x8F, 0x8F, 0x90, 
-    0x93, 0x85, 0x88, 0x8C, 0x7F, 0x80, 0x7A, 0x7B, 0x75, 0x6D, 0x77, 0x6F, 
-    0x35, 0x63, 0x5D, 0x67, 0x64, 0x87, 0xA4, 0x7F, 0x94, 0x84, 0x91, 0x8E, 
-    0x81, 0x92, 0x7C, 0x8B, 0x82, 0x89, 0x5C, 0x59, 0x7C, 0x63, 0x79, 0x70, 
-    0x7E, 0x7D, 0x85, 0x84, 0x93, 0xC4, 0x92, 0xA4, 0x87, 0x63, 0x8C, 0x7E, 
-    0x83, 0xA1, 0xAC, 0x90, 0x94, 0x9A, 0x87, 0x8F, 0x85, 0x79, 0x7C, 0x81, 
-    0x50, 0x5F, 0x74, 0x5B, 0x86, 0x94, 0x7F, 0x8E, 0x83, 0x86, 0x8A, 0x57, 
-    0x85, 0x99, 0x80, 0x7B, 0x86, 0x71, 0x3C, 0x76, 0x63, 0x66, 0x76, 0x6F, 
-    0x78, 0x76, 0x82, 0x82, 0x8E, 0xAD, 0x96, 0x99, 0x87, 0x98, 0x93, 0x89, 
-    0x94, 0x8D, 0x86, 0x86, 0x89, 0x81, 0x7A, 0x80, 0x77, 0x73, 0x6E, 0x7A, 
-    0x66, 0x35, 0x69, 0x58, 0x6D, 0x63, 0x91, 0xA2, 0x81, 0x97, 0x83, 0x96, 
-    0x8B, 0x86, 0x91, 0x7E, 0x8C, 0x87, 0x7E, 0x4E, 0x6D, 0x75, 0x68, 0x77, 
-    0x74, 0x81, 0x7C, 0x8B, 0x81, 0xAB, 0xB8, 0x92, 0xA3, 0x88, 0x67, 0x86, 
-    0x7E, 0x84, 0x90, 0xA3, 0x99, 0x97, 0x95, 0x8B, 0x91, 0x83, 0x77, 0x85, 
-    0x75, 0x47, 0x6F, 0x6C, 0x62, 0x93, 0x94, 0x7F, 0x8B, 0x85, 0x82, 0x88, 
-    0x59, 0x7F, 0x9A, 0x7C, 0x7D, 0x87, 0x69, 0x40, 0x74, 0x5E, 0x65, 0x76, 
-    0x6D, 0x76, 0x7A, 0x7D, 0x88, 0xB4, 0x95, 0x95, 0x93, 0x87, 0x8D, 0x86, 
-    0x95, 0x8B, 0x92, 0x82, 0x85, 0x8D, 0x7A, 0x81, 0x79, 0x72, 0x76, 0x6D, 
-    0x80, 0x58, 0x41, 0x67, 0x5A, 0x72, 0x61, 0x9B, 0x9F, 0x85, 0x95, 0x86, 
-    0x9B, 0x89, 0x8D, 0x8D, 0x81, 0x8C, 0x8A, 0x6E, 0x52, 0x78, 0x6F, 0x6F, 
-    0x75, 0x7A, 0x80, 0x80, 0x8B, 0x87, 0xBA, 0xA8, 0x98, 0x9F, 0x88, 0x69, 
-    0x82, 0x7F, 0x81, 0x87, 0x84, 0x9C, 0xA9, 0x8F, 0x95, 0x8F, 0x89, 0x78, 
-    0x8D, 0x67, 0x4D, 0x7D, 0x61, 0x73, 0x9F, 0x8A, 0x89, 0x86, 0x83, 0x7F, 
-    0x7E, 0x54, 0x94, 0x8B, 0x78, 0x7E, 0x88, 0x5E, 0x43, 0x74, 0x53, 0x69, 
-    0x70, 0x68, 0x7A, 0x76, 0x7B, 0xA5, 0xA4, 0x8D, 0x95, 0x8D, 0x86, 0x8A, 
-    0x90, 0x88, 0x8E, 0x8C, 0x7E, 0x8A, 0x86, 0x7E, 0x7D, 0x75, 0x74, 0x76, 
-    0x71, 0x7F, 0x56, 0x41, 0x67, 0x60, 0x6F, 0x6A, 0x7F, 0xA1, 0x97, 0x94, 
-    0x91, 0x9C, 0x94, 0x8D, 0x90, 0x87, 0x8C, 0x95, 0x67, 0x59, 0x7C, 0x6E, 
-    0x7B, 0x74, 0x7C, 0x80, 0x83, 0x87, 0x91, 0xBE, 0x9E, 0x9F, 0x97, 0x91, 
-    0x69, 0x79, 0x81, 0x7A, 0x84, 0x78, 0x89, 0xB0, 0x90, 0x97, 0x8A, 0x8B, 
-    0x7D, 0x8A, 0x5E, 0x54, 0x80, 0x5F, 0x83, 0x9E, 0x85, 0x8B, 0x88, 0x81, 
-    0x7C, 0x7A, 0x5F, 0x97, 0x7F, 0x77, 0x7B, 0x87, 0x58, 0x42, 0x6E, 0x50, 
-    0x6B, 0x68, 0x67, 0x7D, 0x6F, 0x82, 0xAA, 0x98, 0x91, 0x90, 0x8D, 0x84, 
-    0x90, 0x8D, 0x88, 0x8F, 0x87, 0x80, 0x89, 0x85, 0x81, 0x7C, 0x77, 0x76, 
-    0x78, 0x71, 0x80, 0x4B, 0x4A, 0x69, 0x62, 0x70, 0x6C, 0x82, 0x7F, 0x9D, 
-    0xA6, 0x92, 0xA5, 0x93, 0x99, 0x8E, 0x8C, 0x93, 0x95, 0x5E, 0x64, 0x7E, 
-    0x70, 0x7F, 0x7D, 0x7E, 0x7E, 0x87, 0x84, 0xA1, 0xBB, 0x96, 0x9F, 0x8F, 
-    0x98, 0x6D, 0x6D, 0x81, 0x73, 0x80, 0x6E, 0x88, 0xAB, 0x8E, 0x95, 0x84, 
-    0x86, 0x84, 0x7B, 0x52, 0x65, 0x75, 0x66, 0x8C, 0x99, 0x86, 0x8A, 0x89, 
-    0x82, 0x7A, 0x80, 0x7A, 0x85, 0x7A, 0x78, 0x7C, 0x82, 0x4C, 0x49, 0x64, 
-    0x54, 0x6B, 0x62, 0x6E, 0x7B, 0x6F, 0x8C, 0xA9, 0x94, 0x94, 0x8C, 0x8F, 
-    0x83, 0x8F, 0x8F, 0x89, 0x90, 0x85, 0x84, 0x89, 0x85, 0x84, 0x7B, 0x79, 
-    0x79, 0x78, 0x75, 0x80, 0x47, 0x52, 0x6A, 0x65, 0x6F, 0x70, 0x81, 0x7D, 
-    0x7E, 0xA1, 0xAE, 0xA1, 0x9C, 0x9B, 0x99, 0x8D, 0x99, 0x96, 0x59, 0x75, 
-    0x78, 0x74, 0x82, 0x7D, 0x89, 0x7C, 0x89, 0x8C, 0xA3, 0xAF, 0x95, 0x9E, 
-    0x86, 0x98, 0x7D, 0x5C, 0x7E, 0x70, 0x7A, 0x66, 0x85, 0xA9, 0x84, 0x92, 
-    0x7F, 0x81, 0x88, 0x61, 0x58, 0x68, 0x6C, 0x70, 0x92, 0x93, 0x85, 0x8B, 
-    0x85, 0x83, 0x7E, 0x84, 0x7E, 0x81, 0x79, 0x7A, 0x7F, 0x7F, 0x50, 0x47, 
-    0x5F, 0x58, 0x68, 0x62, 0x71, 0x7C, 0x6D, 0x98, 0xA5, 0x94, 0x96, 0x8A, 
-    0x91, 0x80, 0x90, 0x91, 0x8A, 0x90, 0x86, 0x87, 0x87, 0x87, 0x85, 0x7A, 
-    0x7C, 0x79, 0x7A, 0x76, 0x84, 0x50, 0x4D, 0x6D, 0x65, 0x70, 0x70, 0x80, 
-    0x7F, 0x7B, 0x9A, 0xB4, 0xA0, 0x9E, 0x9A, 0x9B, 0x8D, 0x98, 0x99, 0x59, 
-    0x77, 0x79, 0x72, 0x81, 0x7C, 0x8A, 0x7F, 0x98, 0x8D, 0x94, 0xB1, 0x95, 
-    0x9B, 0x85, 0x90, 0x91, 0x55, 0x73, 0x70, 0x76, 0x66, 0x7F, 0xAB, 0x7A, 
-    0x91, 0x80, 0x7D, 0x88, 0x4E, 0x62, 0x67, 0x67, 0x7B, 0x97, 0x8E, 0x84, 
-    0x8D, 0x83, 0x82, 0x85, 0x7F, 0x7F, 0x82, 0x78, 0x7D, 0x7F, 0x80, 0x55, 
-    0x43, 0x5E, 0x5B, 0x68, 0x61, 0x75, 0x7B, 0x6D, 0xA0, 0xA2, 0x94, 0x96, 
-    0x8A, 0x91, 0x80, 0x90, 0x91, 0x8B, 0x8F, 0x85, 0x89, 0x85, 0x89, 0x85, 
-    0x7A, 0x7D, 0x79, 0x7B, 0x77, 0x85, 0x63, 0x42, 0x6C, 0x64, 0x6F, 0x6F, 
-    0x7C, 0x80, 0x7B, 0x8E, 0xB4, 0xA4, 0x9F, 0x99, 0x9B, 0x8F, 0x94, 0x9B, 
-    0x5B, 0x77, 0x7B, 0x73, 0x7E, 0x7F, 0x85, 0x91, 0xA5, 0x7C, 0x85, 0xAF, 
-    0x9B, 0x97, 0x88, 0x8C, 0x96, 0x57, 0x6A, 0x73, 0x76, 0x65, 0x84, 0xA4, 
-    0x74, 0x94, 0x82, 0x7E, 0x81, 0x4A, 0x65, 0x66, 0x69, 0x91, 0x8E, 0x8A, 
-    0x83, 0x8C, 0x82, 0x81, 0x89, 0x79, 0x80, 0x81, 0x75, 0x82, 0x7B, 0x83, 
-    0x59, 0x3A, 0x60, 0x5D, 0x67, 0x62, 0x78, 0x77, 0x6F, 0x9B, 0xA5, 0x91, 
-    0x97, 0x8E, 0x91, 0x82, 0x91, 0x94, 0x90, 0x7C, 0x75, 0x9D, 0x86, 0x8E, 
-    0x86, 0x83, 0x7F, 0x7C, 0x81, 0x7A, 0x87, 0x78, 0x45, 0x61, 0x66, 0x6F, 
-    0x74, 0x73, 0x80, 0x7B, 0x86, 0xB5, 0xA1, 0x9C, 0x98, 0x98, 0x90, 0x8B, 
-    0x9F, 0x5E, 0x70, 0x79, 0x71, 0x7C, 0x7C, 0x85, 0xA1, 0x9F, 0x75, 0x77, 
-    0xA1, 0xAB, 0x91, 0x8E, 0x87, 0x9B, 0x5C, 0x63, 0x7B, 0x73, 0x69, 0x8D, 
-    0x99, 0x77, 0x92, 0x88, 0x81, 0x77, 0x48, 0x6A, 0x61, 0x81, 0x94, 0x81, 
-    0x8D, 0x7F, 0x8F, 0x79, 0x86, 0x87, 0x73, 0x81, 0x7A, 0x79, 0x82, 0x7A, 
-    0x85, 0x56, 0x38, 0x62, 0x5E, 0x67, 0x66, 0x77, 0x75, 0x75, 0x92, 0x8C, 
-    0x86, 0xA6, 0x98, 0x94, 0x8C, 0x96, 0x9E, 0x8C, 0x66, 0x84, 0xA7, 0x8D, 
-    0x91, 0x8B, 0x8C, 0x86, 0x87, 0x80, 0x80, 0x89, 0x7C, 0x6F, 0x4A, 0x5F, 
-    0x71, 0x6F, 0x6C, 0x76, 0x7C, 0x7D, 0xB5, 0x93, 0x92, 0x9A, 0x8F, 0x8F, 
-    0x84, 0x96, 0x5D, 0x6C, 0x74, 0x6E, 0x7E, 0x70, 0x8B, 0xAB, 0x8B, 0x6D, 
-    0x79, 0x9D, 0xAC, 0x8F, 0x92, 0x88, 0x9C, 0x5E, 0x63, 0x81, 0x71, 0x70, 
-    0x96, 0x8E, 0x7E, 0x92, 0x89, 0x85, 0x66, 0x52, 0x6E, 0x70, 0x8F, 0x82, 
-    0x8A, 0x80, 0x73, 0x95, 0x79, 0x8E, 0x82, 0x78, 0x81, 0x7A, 0x82, 0x80, 
-    0x7F, 0x83, 0x56, 0x3C, 0x63, 0x62, 0x6B, 0x68, 0x76, 0x78, 0x78, 0x84, 
-    0x84, 0x8D, 0xAC, 0x98, 0x96, 0x92, 0x98, 0xA4, 0x77, 0x66, 0x95, 0xA5, 
-    0x8E, 0x90, 0x90, 0x8D, 0x89, 0x86, 0x7E, 0x86, 0x87, 0x78, 0x7E, 0x5A, 
-    0x4E, 0x72, 0x66, 0x69, 0x72, 0x73, 0x83, 0xAC, 0x8B, 0x8E, 0x96, 0x8F, 
-    0x88, 0x89, 0x89, 0x53, 0x71, 0x6E, 0x6F, 0x7E, 0x6D, 0x96, 0xAF, 0x70, 
-    0x70, 0x7F, 0x9E, 0xA9, 0x8E, 0x96, 0x89, 0x9E, 0x59, 0x6A, 0x85, 0x6B, 
-    0x7B, 0x99, 0x87, 0x89, 0x8F, 0x8C, 0x83, 0x63, 0x60, 0x76, 0x87, 0x7E, 
-    0x7E, 0x86, 0x5A, 0x69, 0x90, 0x8D, 0x8B, 0x83, 0x80, 0x81, 0x84, 0x81, 
-    0x87, 0x80, 0x82, 0x59, 0x3E, 0x6B, 0x68, 0x74, 0x67, 0x76, 0x7B, 0x76, 
-    0x88, 0x83, 0x8E, 0xAD, 0x96, 0x99, 0x8E, 0x9F, 0x99, 0x61, 0x75, 0x9D, 
-    0xA1, 0x89, 0x92, 0x91, 0x87, 0x8D, 0x7C, 0x7B, 0x8E, 0x7F, 0x7C, 0x76, 
-    0x75, 0x47, 0x67, 0x66, 0x66, 0x75, 0x67, 0x8E, 0xA5, 0x84, 0x94, 0x8E, 
-    0x92, 0x82, 0x90, 0x7D, 0x49, 0x79, 0x6A, 0x74, 0x7B, 0x71, 0xA0, 0xA5, 
-    0x63, 0x7A, 0x7E, 0xA3, 0xA3, 0x90, 0x95, 0x90, 0x9C, 0x53, 0x76, 0x83, 
-    0x6A, 0x85, 0x9A, 0x86, 0x90, 0x8D, 0x8E, 0x80, 0x68, 0x70, 0x8B, 0x7F, 
-    0x71, 0x88, 0x66, 0x50, 0x6E, 0x84, 0x99, 0x85, 0x87, 0x7E, 0x87, 0x88, 
-    0x7E, 0x8F, 0x79, 0x88, 0x59, 0x3E, 0x76, 0x68, 0x75, 0x6A, 0x78, 0x78, 
-    0x79, 0x8C, 0x7D, 0x94, 0xAE, 0x93, 0x9D, 0x8A, 0xA6, 0x83, 0x61, 0x82, 
-    0xA2, 0x99, 0x87, 0x95, 0x8D, 0x86, 0x90, 0x6D, 0x83, 0x8D, 0x7C, 0x7C, 
-    0x71, 0x83, 0x46, 0x5F, 0x67, 0x65, 0x77, 0x62, 0x96, 0x9E, 0x82, 0x9A, 
-    0x88, 0x95, 0x80, 0x93, 0x73, 0x47, 0x7C, 0x68, 0x77, 0x79, 0x75, 0xA6, 
-    0x92, 0x64, 0x82, 0x7C, 0xAB, 0x9C, 0x94, 0x91, 0x96, 0x98, 0x51, 0x7E, 
-    0x7E, 0x6A, 0x91, 0x95, 0x89, 0x92, 0x8B, 0x90, 0x77, 0x72, 0x84, 0x83, 
-    0x76, 0x72, 0x84, 0x4B, 0x5C, 0x6F, 0x7E, 0x9D, 0x81, 0x89, 0x7D, 0x8A, 
-    0x87, 0x7E, 0x8F, 0x77, 0x8E, 0x4F, 0x47, 0x7B, 0x63, 0x78, 0x6C, 0x77, 
-    0x78, 0x7E, 0x8B, 0x79, 0xA0, 0xAC, 0x93, 0x9D, 0x8B, 0xA7, 0x74, 0x68, 
-    0x8C, 0xA5, 0x90, 0x8A, 0x96, 0x8A, 0x88, 0x8D, 0x60, 0x8E, 0x8A, 0x7C, 
-    0x7A, 0x74, 0x86, 0x43, 0x60, 0x66, 0x67, 0x76, 0x62, 0x96, 0x9A, 0x85, 
-    0x9C, 0x86, 0x96, 0x81, 0x95, 0x64, 0x4E, 0x7E, 0x67, 0x7A, 0x77, 0x7A, 
-    0xA0, 0x85, 0x6E, 0x80, 0x83, 0xB3, 0x93, 0x99, 0x8C, 0x9C, 0x93, 0x51, 
-    0x81, 0x78, 0x6E, 0x9B, 0x8C, 0x8D, 0x8D, 0x8E, 0x89, 0x6C, 0x89, 0x7C, 
-    0x81, 0x71, 0x76, 0x78, 0x3E, 0x6F, 0x65, 0x8A, 0x96, 0x7F, 0x8C, 0x79, 
-    0x92, 0x82, 0x83, 0x8D, 0x78, 0x90, 0x43, 0x58, 0x75, 0x63, 0x7A, 0x6A, 
-    0x7A, 0x78, 0x84, 0x87, 0x7B, 0xB3, 0xA0, 0x97, 0x99, 0x90, 0xA0, 0x67, 
-    0x73, 0x9A, 0xA1, 0x8A, 0x8D, 0x96, 0x85, 0x8D, 0x80, 0x59, 0x9B, 0x81, 
-    0x7F, 0x77, 0x7A, 0x82, 0x40, 0x64, 0x64, 0x6D, 0x73, 0x65, 0x95, 0x96, 
-    0x8D, 0x9C, 0x86, 0x96, 0x84, 0x91, 0x54, 0x5C, 0x7C, 0x6B, 0x7B, 0x76, 
-    0x81, 0x96, 0x79, 0x7E, 0x7A, 0x96, 0xAF, 0x8F, 0x9C, 0x8A, 0xA3, 0x8C, 
-    0x56, 0x7F, 0x71, 0x78, 0x9C, 0x86, 0x92, 0x86, 0x93, 0x72, 0x77, 0x90, 
-    0x74, 0x83, 0x6B, 0x7F, 0x5C, 0x4A, 0x76, 0x5F, 0x94, 0x8B, 0x85, 0x87, 
-    0x7C, 0x97, 0x7B, 0x8A, 0x86, 0x7E, 0x89, 0x3F, 0x64, 0x6D, 0x68, 0x78, 
-    0x6A, 0x7B, 0x79, 0x87, 0x7F, 0x86, 0xBC, 0x93, 0x9E, 0x93, 0x98, 0x92, 
-    0x64, 0x87, 0xA1, 0x94, 0x89, 0x8D, 0x95, 0x7E, 0x94, 0x6C, 0x61, 0xA1, 
-    0x77, 0x83, 0x73, 0x83, 0x78, 0x3E, 0x68, 0x63, 0x73, 0x6E, 0x6C, 0x90, 
-    0x96, 0x99, 0x97, 0x8A, 0x95, 0x8A, 0x86, 0x4C, 0x6D, 0x77, 0x73, 0x79, 
-    0x7A, 0x84, 0x83, 0x84, 0x81, 0x79, 0xAA, 0xA3, 0x94, 0x98, 0x91, 0xA1, 
-    0x8D, 0x69, 0x72, 0x72, 0x7F, 0x97, 0x84, 0x89, 0x8A, 0x7D, 0x64, 0x89, 
-    0x87, 0x78, 0x79, 0x73, 0x76, 0x49, 0x5E, 0x6F, 0x65, 0x95, 0x88, 0x88, 
-    0x83, 0x88, 0x93, 0x7B, 0x8D, 0x82, 0x80, 0x83, 0x44, 0x66, 0x6B, 0x6B, 
-    0x77, 0x6A, 0x7D, 0x7C, 0x87, 0x79, 0x94, 0xBA, 0x8C, 0xA2, 0x91, 0x9A, 
-    0x84, 0x70, 0x9D, 0x94, 0x8F, 0x87, 0x8C, 0x90, 0x7A, 0x97, 0x56, 0x74, 
-    0x9C, 0x73, 0x87, 0x6F, 0x8A, 0x6B, 0x3F, 0x6C, 0x63, 0x76, 0x6B, 0x74, 
-    0x87, 0x9C, 0xA0, 0x91, 0x90, 0x94, 0x8E, 0x79, 0x4F, 0x76, 0x75, 0x7A, 
-    0x75, 0x80, 0x81, 0x80, 0x8C, 0x7A, 0x84, 0xB4, 0x98, 0x99, 0x95, 0x98, 
-    0x9E, 0x8C, 0x8C, 0x74, 0x6E, 0x7B, 0x8C, 0x7F, 0x80, 0x78, 0x5B, 0x73, 
-    0x8E, 0x7D, 0x7C, 0x76, 0x7C, 0x66, 0x42, 0x67, 0x6D, 0x6C, 0x93, 0x90, 
-    0x85, 0x89, 0x95, 0x8D, 0x7F, 0x8F, 0x7F, 0x81, 0x82, 0x46, 0x6C, 0x6D, 
-    0x6D, 0x76, 0x6B, 0x7E, 0x7C, 0x84, 0x77, 0xA3, 0xB3, 0x8A, 0xA5, 0x92, 
-    0x99, 0x81, 0x89, 0x9A, 0x87, 0x8F, 0x7F, 0x8F, 0x85, 0x80, 0x8B, 0x4A, 
-    0x8D, 0x89, 0x79, 0x83, 0x71, 0x8A, 0x5C, 0x46, 0x69, 0x65, 0x75, 0x69, 
-    0x78, 0x7E, 0xA8, 0xA1, 0x8E, 0x97, 0x92, 0x91, 0x69, 0x5A, 0x79, 0x76, 
-    0x7E, 0x72, 0x85, 0x7F, 0x83, 0x8F, 0x73, 0x99, 0xB1, 0x91, 0x9C, 0x94, 
-    0x9E, 0x97, 0x8E, 0x88, 0x86, 0x78, 0x69, 0x82, 0x7F, 0x67, 0x63, 0x64, 
-    0x84, 0x8C, 0x7A, 0x80, 0x78, 0x81, 0x5C, 0x48, 0x6B, 0x69, 0x74, 0x96, 
-    0x90, 0x8D, 0x8E, 0x93, 0x8A, 0x83, 0x8A, 0x7F, 0x86, 0x78, 0x48, 0x71, 
-    0x6C, 0x6F, 0x75, 0x6C, 0x7D, 0x79, 0x80, 0x7A, 0xB1, 0xA5, 0x8E, 0xA2, 
-    0x92, 0x94, 0x8A, 0x97, 0x8A, 0x87, 0x88, 0x7D, 0x8E, 0x7D, 0x89, 0x77, 
-    0x59, 0x94, 0x79, 0x80, 0x79, 0x78, 0x7E, 0x57, 0x4B, 0x66, 0x6A, 0x72, 
-    0x6D, 0x75, 0x84, 0xB0, 0x9A, 0x93, 0x98, 0x94, 0x8D, 0x5C, 0x69, 0x77, 
-    0x7D, 0x7D, 0x76, 0x8A, 0x7D, 0x89, 0x8B, 0x79, 0xB0, 0xA3, 0x96, 0x9B, 
-    0x97, 0x9F, 0x93, 0x90, 0x84, 0x86, 0x7E, 0x66, 0x73, 0x63, 0x66, 0x6A, 
-    0x6A, 0x95, 0x85, 0x81, 0x80, 0x7B, 0x82, 0x54, 0x56, 0x6A, 0x6A, 0x75, 
-    0x99, 0x99, 0x8A, 0x92, 0x8E, 0x86, 0x86, 0x86, 0x81, 0x80, 0x7D, 0x51, 
-    0x66, 0x6D, 0x6C, 0x73, 0x66, 0x78, 0x78, 0x79, 0x82, 0xB3, 0x9C, 0x90, 
-    0x9D, 0x91, 0x91, 0x92, 0x8F, 0x86, 0x84, 0x85, 0x7C, 0x8A, 0x7F, 0x88, 
-    0x70, 0x6F, 0x89, 0x77, 0x7E, 0x78, 0x78, 0x77, 0x5A, 0x4B, 0x68, 0x6B, 
-    0x6F, 0x71, 0x73, 0x8E, 0xB0, 0x96, 0x99, 0x97, 0x99, 0x82, 0x5C, 0x71, 
-    0x75, 0x84, 0x7B, 0x7D, 0x8B, 0x7D, 0x8F, 0x86, 0x8D, 0xB5, 0x99, 0x9D, 
-    0x98, 0x9D, 0x9A, 0x94, 0x8E, 0x84, 0x85, 0x7E, 0x63, 0x61, 0x60, 0x6F, 
-    0x67, 0x79, 0x99, 0x81, 0x85, 0x7E, 0x7E, 0x7D, 0x51, 0x5C, 0x69, 0x6C, 
-    0x74, 0xA0, 0x98, 0x88, 0x94, 0x88, 0x85, 0x88, 0x83, 0x81, 0x7D, 0x81, 
-    0x67, 0x55, 0x6A, 0x6A, 0x6E, 0x61, 0x71, 0x7A, 0x71, 0x88, 0xB0, 0x94, 
-    0x95, 0x95, 0x93, 0x8C, 0x8B, 0x91, 0x84, 0x84, 0x83, 0x7F, 0x86, 0x83, 
-    0x86, 0x74, 0x79, 0x7E, 0x78, 0x79, 0x7B, 0x77, 0x77, 0x5E, 0x48, 0x6B, 
-    0x69, 0x70, 0x73, 0x71, 0x97, 0xAC, 0x96, 0x9C, 0x97, 0x9D, 0x78, 0x67, 
-    0x70, 0x75, 0x87, 0x78, 0x82, 0x88, 0x81, 0x8F, 0x87, 0x9F, 0xAE, 0x9A, 
-    0x9D, 0x98, 0x9F, 0x96, 0x97, 0x8C, 0x85, 0x83, 0x7C, 0x57, 0x5D, 0x69, 
-    0x6F, 0x66, 0x87, 0x95, 0x7F, 0x85, 0x7E, 0x7F, 0x7B, 0x4F, 0x5C, 0x6A, 
-    0x6B, 0x78, 0xA4, 0x91, 0x8A, 0x92, 0x84, 0x86, 0x88, 0x82, 0x7F, 0x80, 
-    0x7B, 0x78, 0x52, 0x61, 0x6C, 0x67, 0x62, 0x6C, 0x7A, 0x6F, 0x88, 0xAE, 
-    0x8E, 0x99, 0x90, 0x94, 0x8C, 0x86, 0x93, 0x83, 0x84, 0x83, 0x82, 0x84, 
-    0x84, 0x87, 0x78, 0x7A, 0x7A, 0x79, 0x78, 0x7C, 0x77, 0x79, 0x5C, 0x49, 
-    0x6D, 0x67, 0x72, 0x74, 0x72, 0xA2, 0xA5, 0x97, 0x9C, 0x99, 0x9A, 0x72, 
-    0x74, 0x6C, 0x75, 0x86, 0x77, 0x86, 0x83, 0x85, 0x8C, 0x8E, 0xA8, 0xA4, 
-    0x9E, 0x9A, 0x9B, 0x9C, 0x94, 0x97, 0x8B, 0x83, 0x85, 0x74, 0x4D, 0x65, 
-    0x6B, 0x6D, 0x6A, 0x95, 0x8E, 0x80, 0x87, 0x7E, 0x81, 0x79, 0x4C, 0x5F, 
-    0x6A, 0x6B, 0x7E, 0xA5, 0x8C, 0x8E, 0x8D, 0x83, 0x88, 0x87, 0x81, 0x80, 
-    0x80, 0x76, 0x81, 0x51, 0x5D, 0x6D, 0x63, 0x62, 0x6B, 0x79, 0x71, 0x85, 
-    0xA4, 0x93, 0x90, 0x92, 0x99, 0x8D, 0x87, 0x92, 0x88, 0x83, 0x86, 0x85, 
-    0x82, 0x88, 0x85, 0x7D, 0x7A, 0x7A, 0x7B, 0x77, 0x7B, 0x76, 0x7C, 0x52, 
-    0x4E, 0x6E, 0x64, 0x74, 0x71, 0x78, 0xAA, 0x9C, 0x99, 0x98, 0x9B, 0x91, 
-    0x79, 0x87, 0x63, 0x71, 0x80, 0x75, 0x84, 0x7D, 0x86, 0x88, 0x95, 0xA1, 
-    0xA2, 0xA0, 0x98, 0x9D, 0x96, 0x93, 0x95, 0x8D, 0x82, 0x88, 0x67, 0x4C, 
-    0x6E, 0x6C, 0x6B, 0x78, 0x9D, 0x85, 0x84, 0x87, 0x7F, 0x86, 0x71, 0x4A, 
-    0x65, 0x69, 0x6C, 0x85, 0xA6, 0x89, 0x92, 0x88, 0x85, 0x8C, 0x85, 0x81, 
-    0x83, 0x7D, 0x79, 0x83, 0x4C, 0x61, 0x6C, 0x63, 0x62, 0x6D, 0x78, 0x72, 
-    0x85, 0x8F, 0x88, 0x93, 0x9B, 0x9D, 0x8E, 0x8E, 0x94, 0x8B, 0x85, 0x8B, 
-    0x88, 0x83, 0x8A, 0x83, 0x7F, 0x7E, 0x7C, 0x7B, 0x75, 0x7A, 0x75, 0x7A, 
-    0x4A, 0x52, 0x6C, 0x62, 0x74, 0x6C, 0x81, 0xAB, 0x93, 0x98, 0x92, 0x9A, 
-    0x8B, 0x85, 0x8D, 0x5A, 0x6D, 0x7B, 0x72, 0x80, 0x78, 0x84, 0x87, 0x92, 
-    0x94, 0xA3, 0xA4, 0x98, 0x9E, 0x93, 0x95, 0x95, 0x8E, 0x83, 0x8B, 0x5A, 
-    0x53, 0x73, 0x6D, 0x6C, 0x8C, 0x99, 0x81, 0x88, 0x88, 0x81, 0x8A, 0x67, 
-    0x4C, 0x6A, 0x69, 0x6E, 0x92, 0xA3, 0x89, 0x93, 0x84, 0x8A, 0x8C, 0x86, 
-    0x82, 0x86, 0x79, 0x7E, 0x7F, 0x48, 0x69, 0x6A, 0x62, 0x62, 0x70, 0x77, 
-    0x74, 0x85, 0x83, 0x83, 0x94, 0xA3, 0x9D, 0x8E, 0x93, 0x96, 0x8C, 0x87, 
-    0x8F, 0x88, 0x85, 0x8B, 0x80, 0x80, 0x7E, 0x7E, 0x79, 0x75, 0x78, 0x75, 
-    0x76, 0x43, 0x58, 0x67, 0x62, 0x74, 0x68, 0x8B, 0xA7, 0x8D, 0x95, 0x8E, 
-    0x99, 0x88, 0x86, 0x8C, 0x54, 0x6D, 0x77, 0x71, 0x7F, 0x75, 0x85, 0x87, 
-    0x8A, 0x90, 0x9E, 0xA8, 0x9A, 0x9D, 0x95, 0x95, 0x98, 0x8D, 0x88, 0x87, 
-    0x51, 0x60, 0x72, 0x70, 0x73, 0x9A, 0x92, 0x81, 0x89, 0x88, 0x83, 0x8B, 
-    0x5E, 0x4F, 0x6C, 0x68, 0x72, 0x9F, 0x9A, 0x8C, 0x8E, 0x82, 0x8D, 0x89, 
-    0x87, 0x82, 0x87, 0x75, 0x86, 0x73, 0x47, 0x71, 0x65, 0x63, 0x63, 0x74, 
-    0x76, 0x77, 0x85, 0x7C, 0x83, 0x99, 0xA8, 0x99, 0x90, 0x96, 0x96, 0x8B, 
-    0x8A, 0x91, 0x87, 0x88, 0x8A, 0x7F, 0x81, 0x7E, 0x7F, 0x76, 0x76, 0x77, 
-    0x77, 0x6C, 0x3D, 0x60, 0x62, 0x66, 0x72, 0x69, 0x97, 0xA0, 0x8C, 0x93, 
-    0x8E, 0x98, 0x83, 0x8B, 0x84, 0x4F, 0x75, 0x72, 0x75, 0x7C, 0x76, 0x87, 
-    0x84, 0x88, 0x8E, 0x95, 0xA4, 0xA3, 0x9D, 0x97, 0x97, 0x9C, 0x8A, 0x8F, 
-    0x7C, 0x4E, 0x6D, 0x71, 0x72, 0x7D, 0x9F, 0x8D, 0x83, 0x88, 0x85, 0x85, 
-    0x86, 0x52, 0x58, 0x6B, 0x67, 0x7D, 0xA4, 0x90, 0x8F, 0x87, 0x83, 0x8B, 
-    0x88, 0x86, 0x83, 0x86, 0x72, 0x8C, 0x60, 0x50, 0x73, 0x61, 0x63, 0x65, 
-    0x78, 0x73, 0x7C, 0x84, 0x7B, 0x87, 0xA2, 0xA6, 0x94, 0x91, 0x97, 0x95, 
-    0x89, 0x8F, 0x91, 0x85, 0x8A, 0x86, 0x7F, 0x81, 0x7E, 0x7E, 0x73, 0x79, 
-    0x74, 0x7A, 0x5D, 0x40, 0x67, 0x5E, 0x6D, 0x6E, 0x72, 0x9D, 0x9B, 0x8F, 
-    0x90, 0x91, 0x96, 0x81, 0x90, 0x75, 0x52, 0x7D, 0x6E, 0x7B, 0x79, 0x7A, 
-    0x88, 0x84, 0x85, 0x87, 0x90, 0xA4, 0xA9, 0x9E, 0x99, 0x9B, 0x9D, 0x89, 
-    0x93, 0x6E, 0x56, 0x74, 0x71, 0x73, 0x8B, 0xA0, 0x88, 0x85, 0x86, 0x82, 
-    0x87, 0x79, 0x49, 0x62, 0x68, 0x68, 0x8D, 0xA0, 0x8A, 0x90, 0x80, 0x85, 
-    0x87, 0x87, 0x82, 0x84, 0x7F, 0x75, 0x8B, 0x4D, 0x5D, 0x6F, 0x60, 0x63, 
-    0x69, 0x78, 0x72, 0x81, 0x80, 0x7C, 0x8C, 0xA7, 0xA3, 0x92, 0x93, 0x98, 
-    0x93, 0x89, 0x92, 0x8E, 0x85, 0x8D, 0x83, 0x81, 0x80, 0x7F, 0x7D, 0x73, 
-    0x7A, 0x74, 0x7B, 0x4D, 0x4B, 0x68, 0x5E, 0x71, 0x6B, 0x7C, 0x99, 0x9A, 
-    0x8C, 0x8E, 0x9B, 0x90, 0x85, 0x92, 0x66, 0x5E, 0x80, 0x6F, 0x7E, 0x78, 
-    0x80, 0x8B, 0x83, 0x81, 0x88, 0x90, 0xA0, 0xAD, 0x9C, 0x99, 0x9E, 0x9B, 
-    0x89, 0x93, 0x64, 0x5E, 0x77, 0x70, 0x77, 0x96, 0x96, 0x87, 0x84, 0x84, 
-    0x7F, 0x89, 0x66, 0x49, 0x6A, 0x61, 0x6E, 0x9C, 0x94, 0x8C, 0x8B, 0x7F, 
-    0x85, 0x85, 0x86, 0x7F, 0x86, 0x76, 0x7E, 0x7F, 0x44, 0x6C, 0x67, 0x61, 
-    0x63, 0x6F, 0x77, 0x74, 0x85, 0x7C, 0x80, 0x91, 0xAB, 0x9D, 0x91, 0x95, 
-    0x99, 0x91, 0x8B, 0x94, 0x8B, 0x88, 0x8D, 0x80, 0x83, 0x7F, 0x81, 0x7B, 
-    0x75, 0x79, 0x76, 0x76, 0x40, 0x5A, 0x63, 0x63, 0x72, 0x6D, 0x83, 0x8E, 
-    0x8F, 0x8C, 0x9B, 0x9D, 0x8E, 0x8E, 0x90, 0x5C, 0x70, 0x7F, 0x74, 0x80, 
-    0x78, 0x87, 0x8A, 0x83, 0x83, 0x89, 0x8C, 0xA1, 0xAF, 0x98, 0x9C, 0x9E, 
-    0x95, 0x8B, 0x8E, 0x5C, 0x66, 0x78, 0x6E, 0x7D, 0x99, 0x8E, 0x87, 0x81, 
-    0x81, 0x7D, 0x86, 0x51, 0x53, 0x6C, 0x5B, 0x7E, 0x9F, 0x89, 0x8D, 0x85, 
-    0x80, 0x82, 0x86, 0x83, 0x7F, 0x85, 0x6F, 0x89, 0x6B, 0x47, 0x73, 0x5F, 
-    0x62, 0x64, 0x74, 0x73, 0x7A, 0x84, 0x7B, 0x84, 0x9A, 0xAC, 0x96, 0x92, 
-    0x96, 0x99, 0x8E, 0x8E, 0x95, 0x88, 0x8C, 0x8A, 0x80, 0x84, 0x7F, 0x83, 
-    0x77, 0x79, 0x78, 0x7C, 0x68, 0x3E, 0x66, 0x5E, 0x6C, 0x6F, 0x73, 0x84, 
-    0x85, 0x89, 0x95, 0xA3, 0x9A, 0x8F, 0x96, 0x87, 0x5A, 0x80, 0x7C, 0x7C, 
-    0x7F, 0x7B, 0x8B, 0x87, 0x84, 0x83, 0x8A, 0x8B, 0xA8, 0xAA, 0x95, 0x9E, 
-    0x9B, 0x90, 0x8D, 0x84, 0x57, 0x6D, 0x76, 0x6B, 0x85, 0x96, 0x89, 0x85, 
-    0x80, 0x7E, 0x80, 0x79, 0x42, 0x61, 0x65, 0x5D, 0x91, 0x97, 0x86, 0x8D, 
-    0x81, 0x81, 0x81, 0x87, 0x7E, 0x82, 0x80, 0x71, 0x8F, 0x53, 0x56, 0x71, 
-    0x5B, 0x64, 0x67, 0x76, 0x72, 0x81, 0x80, 0x7D, 0x8A, 0xA5, 0xA8, 0x93, 
-    0x94, 0x98, 0x98, 0x8B, 0x93, 0x93, 0x87, 0x90, 0x87, 0x83, 0x84, 0x81, 
-    0x82, 0x75, 0x7C, 0x76, 0x80, 0x54, 0x49, 0x6A, 0x5E, 0x71, 0x6C, 0x79, 
-    0x80, 0x81, 0x8A, 0xA0, 0xA3, 0x98, 0x90, 0x9A, 0x74, 0x63, 0x88, 0x77, 
-    0x81, 0x7B, 0x81, 0x8D, 0x85, 0x83, 0x85, 0x8A, 0x8D, 0xB0, 0x9F, 0x98, 
-    0x9E, 0x98, 0x8C, 0x8F, 0x77, 0x56, 0x74, 0x70, 0x6F, 0x8E, 0x8F, 0x87, 
-    0x81, 0x7F, 0x7A, 0x84, 0x62, 0x43, 0x6D, 0x5A, 0x6D, 0x9D, 0x8B, 0x89, 
-    0x88, 0x82, 0x7F, 0x84, 0x85, 0x7C, 0x86, 0x76, 0x7D, 0x86, 0x43, 0x69, 
-    0x66, 0x5D, 0x65, 0x6C, 0x75, 0x75, 0x85, 0x7D, 0x82, 0x92, 0xAD, 0x9F, 
-    0x93, 0x94, 0x9A, 0x93, 0x8C, 0x97, 0x8E, 0x89, 0x8F, 0x82, 0x86, 0x83, 
-    0x84, 0x7E, 0x78, 0x7D, 0x79, 0x7A, 0x43, 0x5B, 0x65, 0x64, 0x71, 0x6E, 
-    0x7D, 0x7C, 0x82, 0x8F, 0xA7, 0xA0, 0x95, 0x95, 0x96, 0x61, 0x76, 0x85, 
-    0x79, 0x83, 0x7B, 0x89, 0x8A, 0x82, 0x83, 0x88, 0x87, 0x97, 0xB2, 0x97, 
-    0x9D, 0x9C, 0x94, 0x89, 0x8F, 0x67, 0x5C, 0x77, 0x6B, 0x78, 0x91, 0x8A, 
-    0x86, 0x7E, 0x7D, 0x7A, 0x80, 0x48, 0x56, 0x6C, 0x55, 0x87, 0x9A, 0x84, 
-    0x8B, 0x84, 0x82, 0x7D, 0x88, 0x80, 0x7F, 0x85, 0x70, 0x8C, 0x6C, 0x47, 
-    0x73, 0x5C, 0x63, 0x66, 0x72, 0x73, 0x7C, 0x83, 0x7E, 0x86, 0x9F, 0xAC, 
-    0x97, 0x94, 0x95, 0x9A, 0x8E, 0x90, 0x95, 0x88, 0x8D, 0x8A, 0x81, 0x86, 
-    0x81, 0x85, 0x79, 0x7C, 0x79, 0x80, 0x64, 0x41, 0x69, 0x5E, 0x6E, 0x6E, 
-    0x75, 0x7D, 0x7D, 0x83, 0x99, 0xAB, 0x9A, 0x93, 0x9B, 0x81, 0x60, 0x88, 
-    0x7C, 0x80, 0x7F, 0x81, 0x8E, 0x83, 0x81, 0x84, 0x8A, 0x84, 0xA6, 0xAB, 
-    0x93, 0xA0, 0x98, 0x8F, 0x8B, 0x88, 0x5B, 0x66, 0x76, 0x69, 0x85, 0x90, 
-    0x87, 0x83, 0x7D, 0x7B, 0x80, 0x6A, 0x3F, 0x6A, 0x5F, 0x63, 0x9A, 0x8E, 
-    0x87, 0x88, 0x85, 0x7D, 0x81, 0x88, 0x7C, 0x84, 0x7D, 0x76, 0x90, 0x51, 
-    0x59, 0x6F, 0x59, 0x67, 0x68, 0x75, 0x73, 0x82, 0x7F, 0x80, 0x8C, 0xA9, 
-    0xA5, 0x94, 0x94, 0x98, 0x98, 0x8D, 0x94, 0x91, 0x88, 0x8F, 0x85, 0x84, 
-    0x84, 0x82, 0x82, 0x77, 0x7E, 0x79, 0x80, 0x4C, 0x52, 0x69, 0x60, 0x72, 
-    0x6D, 0x7B, 0x7B, 0x7F, 0x85, 0xA6, 0xA7, 0x96, 0x95, 0x9B, 0x6D, 0x6E, 
-    0x8A, 0x7A, 0x83, 0x7D, 0x8A, 0x8B, 0x7D, 0x83, 0x87, 0x87, 0x8A, 0xB2, 
-    0x9C, 0x97, 0x9F, 0x93, 0x8B, 0x8C, 0x7F, 0x55, 0x6E, 0x6F, 0x6E, 0x8E, 
-    0x88, 0x87, 0x7E, 0x7B, 0x7A, 0x7E, 0x4F, 0x4D, 0x6F, 0x56, 0x79, 0x9D, 
-    0x86, 0x89, 0x86, 0x84, 0x7B, 0x88, 0x83, 0x7D, 0x86, 0x75, 0x84, 0x80, 
-    0x44, 0x6D, 0x63, 0x5F, 0x68, 0x6D, 0x74, 0x78, 0x84, 0x7E, 0x84, 0x99, 
-    0xAE, 0x9B, 0x95, 0x94, 0x9B, 0x92, 0x8E, 0x97, 0x8C, 0x8B, 0x8D, 0x82, 
-    0x86, 0x82, 0x85, 0x7C, 0x7A, 0x7C, 0x7D, 0x71, 0x42, 0x63, 0x61, 0x69, 
-    0x6F, 0x71, 0x7D, 0x7C, 0x7E, 0x91, 0xAD, 0x9D, 0x95, 0x98, 0x8D, 0x5E, 
-    0x82, 0x81, 0x7E, 0x82, 0x81, 0x8D, 0x7E, 0x81, 0x85, 0x88, 0x83, 0xA0, 
-    0xAE, 0x91, 0x9F, 0x99, 0x8F, 0x8A, 0x89, 0x69, 0x68, 0x80, 0x7F, 0x79, 
-    0x5E, 0x7D, 0x91, 0x74, 0x7A, 0x7B, 0x78, 0x3B, 0x62, 0x63, 0x5F, 0x9B, 
-    0x89, 0x84, 0x83, 0x85, 0x8C, 0x7F, 0x89, 0x7F, 0x82, 0x7E, 0x78, 0x93, 
-    0x51, 0x5C, 0x72, 0x5A, 0x69, 0x6D, 0x79, 0x71, 0x80, 0x82, 0x7E, 0x91, 
-    0x85, 0xB5, 0xA0, 0x92, 0xA0, 0x98, 0x9A, 0x90, 0x98, 0x88, 0x8D, 0x8D, 
-    0x7D, 0x8B, 0x82, 0x83, 0x80, 0x79, 0x7B, 0x7A, 0x44, 0x58, 0x6D, 0x5F, 
-    0x7A, 0x8F, 0x76, 0x72, 0x7A, 0x82, 0x88, 0x8B, 0x85, 0x94, 0x95, 0x97, 
-    0x8A, 0x68, 0x7F, 0x7E, 0x7A, 0x72, 0xB4, 0x80, 0x61, 0x8F, 0x7B, 0x90, 
-    0xAE, 0x9C, 0x98, 0x8B, 0x94, 0x89, 0x8D, 0x88, 0x85, 0x84, 0x6E, 0x7E, 
-    0x7E, 0x70, 0x7B, 0x71, 0x6A, 0x51, 0x4A, 0x5D, 0x5A, 0x76, 0x8A, 0x56, 
-    0x68, 0x74, 0x7B, 0xA5, 0x90, 0x96, 0x8D, 0x94, 0x92, 0x8E, 0x9C, 0x88, 
-    0x5B, 0x65, 0x69, 0x7C, 0x7B, 0x78, 0x83, 0x74, 0x77, 0x83, 0x85, 0x8D, 
-    0x87, 0x94, 0xAA, 0x96, 0xA2, 0x98, 0x9B, 0x8C, 0x8E, 0x7E, 0x59, 0x75, 
-    0x8E, 0x99, 0x80, 0x85, 0x86, 0x83, 0x7D, 0x7E, 0x51, 0x5B, 0x66, 0x7E, 
-    0x84, 0x82, 0x88, 0x74, 0x77, 0x7F, 0x88, 0x84, 0x81, 0x88, 0x79, 0x55, 
-    0x6C, 0x75, 0x71, 0x72, 0x6E, 0x7C, 0x74, 0x79, 0x81, 0x81, 0x84, 0x8B, 
-    0xB7, 0x97, 0x9F, 0xA1, 0x97, 0x95, 0x8E, 0x91, 0x87, 0x8D, 0x85, 0x7E, 
-    0x84, 0x7B, 0x7F, 0x78, 0x71, 0x7B, 0x59, 0x45, 0x5E, 0x61, 0x63, 0x67, 
-    0x74, 0x74, 0x85, 0xA6, 0x91, 0x67, 0x7F, 0x7F, 0x8F, 0xAD, 0x97, 0xA7, 
-    0x93, 0x9E, 0x73, 0x71, 0x89, 0x6D, 0x78, 0x6A, 0x7C, 0x89, 0x7F, 0x93, 
-    0x83, 0x9D, 0xA0, 0x91, 0x91, 0x87, 0x99, 0x85, 0x85, 0x8C, 0x79, 0x7F, 
-    0x81, 0x7A, 0x70, 0x7B, 0x4F, 0x4E, 0x61, 0x77, 0x9A, 0x74, 0x8A, 0x7C, 
-    0x82, 0x7C, 0x7C, 0x73, 0x56, 0x7D, 0x86, 0x80, 0x8F, 0x8B, 0x8C, 0x5A, 
-    0x55, 0x67, 0x6B, 0x73, 0x6E, 0x7B, 0x75, 0x80, 0x87, 0x81, 0x8B, 0x86, 
-    0x8D, 0x8C, 0x8D, 0x94, 0xA4, 0xBF, 0x9D, 0xA4, 0x9A, 0x9D, 0x98, 0x8A, 
-    0x8F, 0x85, 0x84, 0x80, 0x7D, 0x86, 0x6F, 0x56, 0x5F, 0x64, 0x6E, 0x76, 
-    0x7A, 0x78, 0x74, 0x68, 0x6E, 0x77, 0x7A, 0x80, 0x9D, 0x87, 0x93, 0x71, 
-    0x6A, 0x82, 0x76, 0x78, 0x9C, 0x99, 0x8B, 0x88, 0x62, 0x7A, 0x79, 0x7D, 
-    0x71, 0x8D, 0xA6, 0x8A, 0xA0, 0x8F, 0x93, 0x94, 0x7B, 0x87, 0x7B, 0x7D, 
-    0x7C, 0x7B, 0x76, 0x75, 0x79, 0x44, 0x5A, 0x69, 0x6F, 0x60, 0x64, 0x77, 
-    0x6F, 0x85, 0xAB, 0x92, 0x98, 0x8F, 0x94, 0x88, 0x8A, 0x93, 0x8D, 0x6A, 
-    0x60, 0x78, 0x78, 0x7D, 0x80, 0x7A, 0x71, 0x78, 0x7D, 0x7C, 0x8A, 0x8A, 
-    0x83, 0x8A, 0x93, 0xAD, 0xA2, 0x9D, 0x96, 0x98, 0x84, 0x61, 0x7E, 0x8D, 
-    0xA2, 0x81, 0x89, 0x87, 0x87, 0x84, 0x7F, 0x74, 0x4E, 0x60, 0x6B, 0x78, 
-    0x87, 0x86, 0x84, 0x6A, 0x70, 0x7E, 0x7C, 0x84, 0x76, 0x81, 0x65, 0x4F, 
-    0x75, 0x6E, 0x7A, 0x6D, 0x81, 0x95, 0x5E, 0x7E, 0x7B, 0x81, 0x83, 0x7A, 
-    0x97, 0xAC, 0xA5, 0xA0, 0x98, 0x9C, 0x90, 0x92, 0x8D, 0x8A, 0x8F, 0x86, 
-    0x80, 0x86, 0x7C, 0x7C, 0x7A, 0x76, 0x5E, 0x46, 0x5C, 0x5F, 0x67, 0x66, 
-    0x73, 0x80, 0x9B, 0x84, 0x6A, 0x7F, 0x84, 0x7A, 0x9B, 0xAA, 0x96, 0xA0, 
-    0x99, 0x95, 0x96, 0x82, 0x63, 0x71, 0x78, 0x96, 0x8C, 0x80, 0x72, 0x72, 
-    0x74, 0x6E, 0x7B, 0x78, 0x71, 0xA2, 0x95, 0x8C, 0x9D, 0x93, 0x91, 0x7A, 
-    0x83, 0x76, 0x86, 0x65, 0x4E, 0x71, 0x8D, 0x94, 0x7D, 0x86, 0x7F, 0x7E, 
-    0x7A, 0x77, 0x84, 0x7A, 0x7A, 0x6E, 0x6F, 0x84, 0x78, 0x6B, 0x64, 0x71, 
-    0x72, 0x7B, 0x85, 0x77, 0x6B, 0x6C, 0x75, 0x76, 0x78, 0x83, 0xA3, 0xA1, 
-    0x6B, 0x7D, 0x91, 0x88, 0x8E, 0x80, 0x9E, 0xB8, 0xA0, 0xA6, 0xA0, 0xA5, 
-    0x8F, 0x8B, 0x85, 0x7A, 0x8A, 0x7F, 0x7F, 0x84, 0x7C, 0x7C, 0x56, 0x50, 
-    0x5A, 0x60, 0x62, 0x68, 0x74, 0x71, 0x7C, 0x89, 0x9F, 0x9D, 0x80, 0x5F, 
-    0x7F, 0x75, 0x89, 0xB2, 0x95, 0x9B, 0x91, 0x8F, 0x8C, 0x87, 0x7D, 0x6D, 
-    0x75, 0x72, 0x73, 0x77, 0x6E, 0x75, 0x6F, 0x69, 0x70, 0x7A, 0x6F, 0x9A, 
-    0xA0, 0x83, 0x92, 0x8B, 0x8E, 0x7E, 0x84, 0x7B, 0x82, 0x6D, 0x4A, 0x76, 
-    0x75, 0xA4, 0x87, 0x84, 0x87, 0x83, 0x8A, 0x7C, 0x8D, 0x81, 0x74, 0x77, 
-    0x6C, 0x81, 0x78, 0x75, 0x71, 0x6A, 0x78, 0x7A, 0x75, 0x6F, 0x79, 0x77, 
-    0x7E, 0x83, 0x7C, 0x83, 0x8D, 0x87, 0xAD, 0x8B, 0x79, 0x95, 0x8C, 0x8D, 
-    0x92, 0xC3, 0x9B, 0xA1, 0x9D, 0x91, 0x99, 0x86, 0x89, 0x82, 0x79, 0x80, 
-    0x7F, 0x82, 0x77, 0x6D, 0x57, 0x60, 0x65, 0x58, 0x60, 0x6B, 0x7A, 0x82, 
-    0x91, 0x84, 0x6C, 0x6E, 0x76, 0x79, 0xA0, 0x78, 0x65, 0x88, 0x74, 0xA8, 
-    0x9D, 0x94, 0x93, 0x84, 0x8C, 0x80, 0x7A, 0x67, 0x7D, 0x8F, 0x60, 0x6A, 
-    0x7E, 0x77, 0x78, 0x73, 0x6E, 0xA0, 0x97, 0x86, 0x90, 0x89, 0x88, 0x82, 
-    0x83, 0x7C, 0x86, 0x80, 0x79, 0x7F, 0x84, 0x5D, 0x57, 0x73, 0x5E, 0x8A, 
-    0x9C, 0x86, 0x90, 0x85, 0x8E, 0x87, 0x71, 0x5C, 0x6D, 0x7C, 0x89, 0x8F, 
-    0x87, 0x83, 0x81, 0x74, 0x73, 0x80, 0x7E, 0x72, 0x76, 0x78, 0x84, 0xA2, 
-    0x96, 0x72, 0x7D, 0x7D, 0x81, 0x81, 0x87, 0x8F, 0x8E, 0x89, 0x9B, 0xB9, 
-    0x9C, 0x9F, 0x94, 0x8A, 0x88, 0x88, 0x89, 0x81, 0x88, 0x78, 0x6D, 0x74, 
-    0x5A, 0x68, 0x64, 0x78, 0x8C, 0x7B, 0x87, 0x7D, 0x73, 0x64, 0x69, 0x76, 
-    0x79, 0x77, 0x6C, 0x76, 0x79, 0x87, 0xAA, 0x73, 0x5C, 0x7A, 0x74, 0x7D, 
-    0xA7, 0x9B, 0x90, 0x92, 0x89, 0x53, 0x77, 0x77, 0x75, 0x75, 0x72, 0xAF, 
-    0x96, 0x92, 0x94, 0x8F, 0x7E, 0x75, 0x87, 0x72, 0x7F, 0x88, 0x75, 0x7F, 
-    0x7B, 0x64, 0x56, 0x64, 0x67, 0x67, 0x9C, 0x90, 0x5E, 0x7A, 0x80, 0x82, 
-    0xA4, 0x92, 0x92, 0x8A, 0x8E, 0x8F, 0x92, 0x93, 0x7B, 0x78, 0x76, 0x87, 
-    0x8A, 0x6C, 0x75, 0x88, 0x8E, 0x85, 0x91, 0x5D, 0x6B, 0x7A, 0x6B, 0x76, 
-    0x7C, 0x87, 0xA7, 0xA1, 0x94, 0x97, 0x98, 0x8D, 0x89, 0x5A, 0x5D, 0x8F, 
-    0xA0, 0x81, 0x8E, 0x8F, 0x81, 0x89, 0x64, 0x59, 0x73, 0x76, 0x8E, 0x86, 
-    0x8D, 0x81, 0x6F, 0x6F, 0x6F, 0x7E, 0x74, 0x7B, 0x77, 0x72, 0x83, 0x7F, 
-    0x87, 0x7B, 0x70, 0x6D, 0x70, 0x77, 0x9A, 0xAB, 0x72, 0x69, 0x83, 0x79, 
-    0x83, 0x7F, 0x8D, 0xA2, 0x9C, 0x93, 0x99, 0x9C, 0x91, 0x8A, 0x7F, 0x76, 
-    0x83, 0x80, 0x7B, 0x80, 0x7B, 0x73, 0x7B, 0x61, 0x47, 0x5F, 0x60, 0x66, 
-    0x7A, 0x88, 0x8A, 0x74, 0x70, 0x75, 0x97, 0xA1, 0x5A, 0x73, 0x81, 0x7B, 
-    0xA1, 0xAC, 0x9D, 0x9A, 0x90, 0x8A, 0x89, 0x7D, 0x64, 0x92, 0x91, 0x81, 
-    0x81, 0x60, 0x79, 0x74, 0x6D, 0x67, 0x78, 0x85, 0xA0, 0x9C, 0x90, 0x8E, 
-    0x93, 0x82, 0x80, 0x81, 0x7D, 0x85, 0x82, 0x7C, 0x83, 0x4C, 0x6D, 0x6D, 
-    0x69, 0x9E, 0x84, 0x8D, 0x83, 0x92, 0x89, 0x82, 0x75, 0x57, 0x83, 0x83, 
-    0x72, 0x84, 0x7F, 0x86, 0x7E, 0x7F, 0x7B, 0x80, 0x75, 0x68, 0x76, 0x70, 
-    0x9E, 0xA0, 0x91, 0x6B, 0x6C, 0x80, 0x73, 0x83, 0x7F, 0x85, 0x8E, 0x7E, 
-    0xA6, 0xB3, 0x9F, 0x9C, 0x86, 0x8C, 0x81, 0x8C, 0x8A, 0x85, 0x89, 0x7D, 
-    0x84, 0x62, 0x5C, 0x6D, 0x60, 0x70, 0x85, 0x82, 0x76, 0x80, 0x77, 0x6C, 
-    0x79, 0x70, 0x7A, 0x75, 0x6D, 0x74, 0x9A, 0x9F, 0x93, 0x6E, 0x60, 0x82, 
-    0x6C, 0x94, 0xA0, 0x90, 0x90, 0x89, 0x91, 0x88, 0x7C, 0x57, 0x6A, 0x6B, 
-    0x69, 0x7D, 0x7E, 0xAB, 0x98, 0x85, 0x84, 0x86, 0x8A, 0x76, 0x89, 0x78, 
-    0x7E, 0x88, 0x82, 0x72, 0x64, 0x6B, 0x61, 0x66, 0x6F, 0x9F, 0x9B, 0x63, 
-    0x73, 0x82, 0x76, 0x9E, 0xA1, 0x8E, 0x91, 0x8F, 0x91, 0x89, 0x89, 0x95, 
-    0x88, 0x80, 0x78, 0x86, 0x6E, 0x5C, 0x7D, 0x78, 0x66, 0x6E, 0x82, 0x9D, 
-    0x8A, 0x8C, 0x5D, 0x6E, 0x7E, 0x78, 0x80, 0x7F, 0x84, 0xA2, 0xA2, 0x92, 
-    0x98, 0x98, 0x89, 0x56, 0x6B, 0x96, 0xA1, 0x8C, 0x8A, 0x8A, 0x8B, 0x72, 
-    0x65, 0x7E, 0x8B, 0x81, 0x79, 0x75, 0x7F, 0x77, 0x66, 0x63, 0x62, 0x6A, 
-    0x65, 0x92, 0x93, 0x82, 0x8D, 0x88, 0x7B, 0x75, 0x96, 0x77, 0x56, 0x70, 
-    0x70, 0x9C, 0x8E, 0x66, 0x73, 0x7A, 0x75, 0x83, 0xAB, 0x99, 0x8B, 0x61, 
-    0x7B, 0x7F, 0x87, 0xAA, 0x93, 0x8E, 0x7E, 0x8B, 0x90, 0x81, 0x95, 0x7D, 
-    0x71, 0x6B, 0x7F, 0x93, 0x83, 0x7C, 0x5C, 0x66, 0x6C, 0x76, 0x84, 0x87, 
-    0x74, 0x62, 0x6F, 0x83, 0x97, 0x78, 0x70, 0x7C, 0x76, 0x7F, 0xB1, 0xA2, 
-    0x95, 0x94, 0x8E, 0x89, 0x6D, 0x89, 0xA0, 0x8A, 0x7D, 0x6B, 0x79, 0x8F, 
-    0x90, 0x7C, 0x48, 0x74, 0x6B, 0x69, 0x76, 0x79, 0x82, 0xA0, 0x8E, 0x8C, 
-    0x90, 0x92, 0x8D, 0x83, 0x7A, 0x84, 0x89, 0x89, 0x63, 0x5B, 0x75, 0x62, 
-    0x88, 0x94, 0x82, 0x8E, 0x7C, 0x8E, 0x72, 0x6F, 0x8A, 0x72, 0x74, 0x6B, 
-    0x86, 0x83, 0x84, 0x94, 0x77, 0x6F, 0x81, 0x8E, 0x7D, 0x78, 0x87, 0x78, 
-    0x6E, 0x7C, 0x84, 0x79, 0x78, 0x93, 0x79, 0x6D, 0x89, 0x7D, 0x7B, 0x7E, 
-    0x85, 0x85, 0x7E, 0xB4, 0x9D, 0x92, 0x93, 0x8F, 0x92, 0x81, 0x95, 0x8B, 
-    0x81, 0x88, 0x7C, 0x81, 0x6E, 0x67, 0x6D, 0x5C, 0x63, 0x69, 0x83, 0x8D, 
-    0x8A, 0x7D, 0x65, 0x6E, 0x76, 0x80, 0x79, 0x73, 0x7E, 0x81, 0xA1, 0x96, 
-    0x98, 0x6A, 0x6A, 0x82, 0x67, 0x9F, 0xA2, 0x94, 0x91, 0x88, 0x95, 0x85, 
-    0x91, 0x87, 0x68, 0x52, 0x62, 0x77, 0x76, 0x7D, 0x79, 0x8D, 0x97, 0x85, 
-    0x8E, 0x82, 0x8F, 0x7C, 0x7F, 0x7E, 0x80, 0x95, 0x82, 0x73, 0x5B, 0x6D, 
-    0x73, 0x86, 0x89, 0x57, 0x6D, 0x77, 0x74, 0x86, 0xA9, 0x97, 0x8A, 0x8A, 
-    0x84, 0x81, 0x91, 0x7F, 0x90, 0x85, 0x7C, 0x86, 0x78, 0x79, 0x6C, 0x7A, 
-    0x64, 0x62, 0x72, 0x8B, 0x9A, 0x86, 0x88, 0x8B, 0x65, 0x6C, 0x79, 0x7B, 
-    0x77, 0x7E, 0x78, 0xA0, 0xAB, 0x91, 0xA1, 0x83, 0x69, 0x9D, 0x8A, 0x8B, 
-    0x8E, 0x8E, 0x84, 0x84, 0x83, 0x70, 0x7D, 0x75, 0x75, 0x71, 0x6B, 0x7B, 
-    0x80, 0x66, 0x64, 0x72, 0x6A, 0x73, 0x8B, 0x91, 0x84, 0x86, 0x95, 0x93, 
-    0x8D, 0x8A, 0x6E, 0x66, 0x72, 0x98, 0x9C, 0x72, 0x67, 0x7B, 0x79, 0x72, 
-    0xA8, 0x9A, 0x92, 0x7E, 0x5A, 0x81, 0x7C, 0x8C, 0x78, 0xA4, 0x8E, 0x80, 
-    0x97, 0x85, 0x94, 0x84, 0x78, 0x80, 0x7B, 0x82, 0x7E, 0x86, 0x71, 0x58, 
-    0x5F, 0x64, 0x6C, 0x79, 0x95, 0x8B, 0x6D, 0x5B, 0x77, 0x79, 0x8D, 0x86, 
-    0x62, 0x79, 0x79, 0x82, 0xB0, 0x9C, 0x98, 0x8B, 0x88, 0x7E, 0x8D, 0x88, 
-    0x7C, 0x9C, 0x66, 0x55, 0x7B, 0x9B, 0x98, 0x86, 0x86, 0x80, 0x7D, 0x55, 
-    0x6D, 0x80, 0x6C, 0x7A, 0x70, 0x99, 0xA4, 0x95, 0x91, 0x81, 0x8A, 0x7B, 
-    0x77, 0x83, 0x8C, 0x8D, 0x72, 0x4D, 0x75, 0x6A, 0x75, 0x9E, 0x89, 0x88, 
-    0x87, 0x8B, 0x8D, 0x85, 0x8D, 0x82, 0x64, 0x52, 0x6C, 0x78, 0x8C, 0x97, 
-    0x88, 0x80, 0x7C, 0x89, 0x72, 0x8B, 0x94, 0x63, 0x5E, 0x72, 0x7E, 0x7F, 
-    0x7A, 0x99, 0x99, 0x89, 0x8F, 0x91, 0x94, 0x92, 0x84, 0x4F, 0x73, 0x77, 
-    0x7B, 0x73, 0xA8, 0x96, 0x82, 0x8E, 0x87, 0x8F, 0x86, 0x87, 0x85, 0x7B, 
-    0x71, 0x6A, 0x85, 0x80, 0x7F, 0x62, 0x54, 0x6F, 0x70, 0x87, 0x9E, 0x97, 
-    0x8A, 0x78, 0x73, 0x70, 0x79, 0x7F, 0x88, 0x87, 0x6A, 0x78, 0xA0, 0xA8, 
-    0x95, 0x91, 0x5A, 0x6E, 0x79, 0x6F, 0xA6, 0x9C, 0x89, 0x8B, 0x81, 0x85, 
-    0x8F, 0x8C, 0x7B, 0x73, 0x82, 0x59, 0x56, 0x7A, 0x63, 0x78, 0x5C, 0x79, 
-    0xA5, 0x7E, 0x92, 0x86, 0x8B, 0x81, 0x86, 0x89, 0x68, 0x91, 0x87, 0x7C, 
-    0x77, 0x55, 0x71, 0x69, 0x7E, 0xA2, 0x64, 0x66, 0x7E, 0x77, 0x8B, 0xAB, 
-    0x9A, 0x88, 0x8C, 0x86, 0x71, 0x88, 0x9D, 0x8B, 0x8C, 0x66, 0x70, 0xA1, 
-    0x88, 0x83, 0x6D, 0x65, 0x76, 0x70, 0x71, 0x7C, 0xAC, 0x9F, 0x79, 0x80, 
-    0x9E, 0x98, 0x82, 0x4B, 0x74, 0x6F, 0x79, 0x78, 0x89, 0xB6, 0x8A, 0x94, 
-    0x7F, 0x53, 0x90, 0xA0, 0x8B, 0x81, 0x8B, 0x92, 0x84, 0x85, 0x69, 0x88, 
-    0x76, 0x4F, 0x61, 0x6B, 0x9B, 0x9A, 0x86, 0x7D, 0x72, 0x76, 0x5B, 0x78, 
-    0x7D, 0x7C, 0x80, 0x73, 0x81, 0x89, 0x9B, 0x91, 0x85, 0x75, 0x66, 0x6F, 
-    0x66, 0x95, 0xA6, 0x6A, 0x64, 0x79, 0x7B, 0x82, 0xA9, 0x96, 0x83, 0x92, 
-    0x67, 0x63, 0x82, 0x7D, 0x79, 0x73, 0xA1, 0x8A, 0x98, 0x8D, 0x90, 0x91, 
-    0x76, 0x8A, 0x86, 0x7E, 0x8C, 0x87, 0x7E, 0x68, 0x63, 0x63, 0x67, 0x6E, 
-    0x7E, 0x92, 0x82, 0x80, 0x67, 0x88, 0x9F, 0x8C, 0x5E, 0x5A, 0x7F, 0x67, 
-    0x8E, 0xAD, 0x90, 0x9A, 0x85, 0x8D, 0x88, 0x87, 0x89, 0x82, 0x7A, 0x50, 
-    0x6C, 0x87, 0xA6, 0x81, 0x70, 0x99, 0x86, 0x86, 0x83, 0x62, 0x65, 0x6C, 
-    0x71, 0x76, 0x75, 0xA2, 0xA4, 0x89, 0x89, 0x89, 0x96, 0x84, 0x91, 0x88, 
-    0x84, 0x67, 0x5F, 0x79, 0x6A, 0x96, 0x9A, 0x81, 0x89, 0x83, 0x8E, 0x7D, 
-    0x8D, 0x82, 0x78, 0x70, 0x5D, 0x6E, 0x6F, 0x79, 0x98, 0x82, 0x6B, 0x7A, 
-    0x91, 0x8B, 0x8D, 0x84, 0x5C, 0x6D, 0x75, 0x70, 0x74, 0x8B, 0xA6, 0x76, 
-    0x62, 0x79, 0xB1, 0x9E, 0x87, 0x97, 0x50, 0x77, 0x7A, 0x7F, 0x77, 0x8E, 
-    0xAD, 0x74, 0x8F, 0x8A, 0x96, 0x8F, 0x7C, 0x89, 0x79, 0x82, 0x87, 0x88, 
-    0x7C, 0x6D, 0x62, 0x54, 0x64, 0x6F, 0x70, 0x8A, 0x94, 0x8B, 0x73, 0x6B, 
-    0x7E, 0x8A, 0x80, 0x6F, 0x77, 0x74, 0x76, 0xAA, 0xA1, 0x98, 0x80, 0x59, 
-    0x82, 0x6A, 0x9C, 0xA7, 0x8D, 0x93, 0x7F, 0x9D, 0x69, 0x7E, 0xA9, 0x75, 
-    0x8A, 0x71, 0x8F, 0x63, 0x59, 0x7E, 0x5A, 0x76, 0x60, 0x95, 0xA1, 0x83, 
-    0x9E, 0x80, 0x93, 0x86, 0x8A, 0x87, 0x7C, 0x8D, 0x76, 0x76, 0x60, 0x67, 
-    0x70, 0x71, 0x94, 0x8F, 0x62, 0x60, 0x82, 0x6D, 0x95, 0xA5, 0x87, 0x92, 
-    0x73, 0x83, 0x95, 0x91, 0x8C, 0x77, 0x82, 0x7E, 0x86, 0x81, 0x86, 0x92, 
-    0x53, 0x56, 0x72, 0x78, 0x7D, 0x78, 0x90, 0x9A, 0x90, 0x95, 0x8C, 0x9B, 
-    0x61, 0x58, 0x74, 0x69, 0x85, 0x75, 0x88, 0xAC, 0x88, 0x91, 0x87, 0x99, 
-    0x5F, 0x63, 0x84, 0x9C, 0x96, 0x8A, 0x92, 0x8F, 0x7C, 0x76, 0x71, 0x66, 
-    0x69, 0x81, 0x88, 0x8A, 0x8F, 0x8F, 0x7D, 0x5B, 0x64, 0x64, 0x6E, 0x7A, 
-    0x8F, 0x90, 0x8E, 0x93, 0x8B, 0x64, 0x6E, 0x8B, 0x84, 0x66, 0x6D, 0x85, 
-    0x7B, 0x76, 0x7B, 0x85, 0xA4, 0x9A, 0x78, 0x60, 0x80, 0x86, 0xA5, 0x90, 
-    0x76, 0x68, 0x7D, 0x7A, 0x75, 0x93, 0xA7, 0x8C, 0x90, 0x86, 0x9B, 0x93, 
-    0x8C, 0x84, 0x7A, 0x79, 0x62, 0x70, 0x75, 0x75, 0x78, 0x7A, 0x8A, 0x7B, 
-    0x6E, 0x77, 0x82, 0x83, 0x77, 0x6F, 0x6E, 0x73, 0x7D, 0x73, 0x8D, 0x9D, 
-    0x91, 0x6C, 0x68, 0x8A, 0x72, 0xA3, 0x98, 0x89, 0x90, 0x89, 0x96, 0x81, 
-    0x8A, 0x75, 0x68, 0x6B, 0x83, 0xA1, 0x85, 0x89, 0x8A, 0x7B, 0x83, 0x71, 
-    0x4D, 0x69, 0x67, 0x6B, 0x61, 0x8E, 0xB1, 0x8D, 0x96, 0x84, 0x8F, 0x86, 
-    0x82, 0x90, 0x72, 0x7C, 0x75, 0x87, 0x92, 0x81, 0x59, 0x5E, 0x72, 0x5E, 
-    0x90, 0x9D, 0x8E, 0x93, 0x8B, 0x8C, 0x6D, 0x85, 0x7A, 0x6F, 0x75, 0x87, 
-    0x95, 0x83, 0x97, 0x99, 0x71, 0x66, 0x84, 0x8D, 0x77, 0x84, 0x8E, 0x86, 
-    0x91, 0x72, 0x65, 0x70, 0x76, 0x8E, 0x8E, 0x87, 0x82, 0x9A, 0x90, 0x83, 
-    0x63, 0x63, 0x70, 0x6C, 0x6E, 0x73, 0x8A, 0xB0, 0x8F, 0x95, 0x8B, 0x92, 
-    0x8B, 0x7F, 0x87, 0x7F, 0x88, 0x85, 0x7A, 0x71, 0x67, 0x70, 0x75, 0x6A, 
-    0x65, 0x71, 0x81, 0x8E, 0x92, 0x7A, 0x76, 0x85, 0x74, 0x65, 0x70, 0x7E, 
-    0x91, 0x97, 0x90, 0x80, 0x77, 0x7D, 0x79, 0x9B, 0x8B, 0x92, 0x7A, 0x5B, 
-    0x88, 0x74, 0x8A, 0xA5, 0x8A, 0x89, 0x7E, 0x91, 0x83, 0x8B, 0x8F, 0x77, 
-    0x89, 0x4E, 0x5C, 0x78, 0x67, 0x75, 0x69, 0xA3, 0x8F, 0x91, 0x8F, 0x85, 
-    0x93, 0x76, 0x87, 0x82, 0x7E, 0x7C, 0x72, 0x81, 0x74, 0x69, 0x67, 0x6E, 
-    0x77, 0x68, 0x96, 0x9C, 0x95, 0x81, 0x59, 0x87, 0x6E, 0x7D, 0xA5, 0x8D, 
-    0x95, 0x8C, 0x9A, 0x90, 0x8D, 0x81, 0x73, 0x8A, 0x7E, 0x7D, 0x82, 0x8B, 
-    0x87, 0x6E, 0x5E, 0x62, 0x72, 0x71, 0x8F, 0x76, 0x82, 0x9F, 0x8F, 0x8D, 
-    0x8B, 0x7D, 0x4B, 0x6D, 0x6D, 0x75, 0x81, 0x85, 0xB9, 0x8F, 0x97, 0x90, 
-    0x9B, 0x64, 0x5C, 0x7C, 0x76, 0xAC, 0x8B, 0x94, 0x95, 0x89, 0x77, 0x74, 
-    0x83, 0x6A, 0x7B, 0x89, 0x83, 0x8D, 0x7A, 0x7C, 0x64, 0x5D, 0x63, 0x6C, 
-    0x6F, 0x73, 0x9C, 0x93, 0x8E, 0x7B, 0x6E, 0x88, 0x86, 0x83, 0x87, 0x82, 
-    0x8A, 0x87, 0x6A, 0x6D, 0x7F, 0xA0, 0x8B, 0x76, 0x56, 0x80, 0x75, 0x9B, 
-    0x9D, 0x88, 0x93, 0x52, 0x72, 0x71, 0x7A, 0x86, 0xA0, 0x9A, 0x84, 0x99, 
-    0x97, 0x8F, 0x8F, 0x7B, 0x7E, 0x7C, 0x7F, 0x6E, 0x75, 0x74, 0x79, 0x7C, 
-    0x5A, 0x68, 0x75, 0x8A, 0x8D, 0x7E, 0x79, 0x7E, 0x77, 0x67, 0x6F, 0x78, 
-    0x9C, 0x95, 0x80, 0x5F, 0x85, 0x81, 0x81, 0xAA, 0x89, 0x94, 0x8F, 0x8F, 
-    0x94, 0x8C, 0x90, 0x66, 0x71, 0x77, 0x73, 0x83, 0x85, 0x8A, 0x81, 0x8A, 
-    0x84, 0x90, 0x74, 0x4B, 0x72, 0x5E, 0x71, 0x6F, 0x88, 0xAE, 0x86, 0x96, 
-    0x81, 0x93, 0x8D, 0x81, 0x85, 0x59, 0x99, 0x8B, 0x8A, 0x84, 0x4F, 0x79, 
-    0x62, 0x6B, 0x91, 0x94, 0x90, 0x88, 0x95, 0x89, 0x81, 0x82, 0x68, 0x6B, 
-    0x6F, 0x75, 0x97, 0x92, 0x81, 0x7E, 0x7A, 0x78, 0x7D, 0x7C, 0x78, 0x98, 
-    0x8F, 0x8B, 0x80, 0x67, 0x7E, 0x78, 0x78, 0x6F, 0x7E, 0x84, 0x83, 0xA7, 
-    0x95, 0x92, 0x98, 0x5A, 0x69, 0x71, 0x76, 0x7A, 0x7A, 0x7E, 0xA3, 0xA3, 
-    0x8E, 0x97, 0x90, 0x83, 0x7E, 0x82, 0x7D, 0x8B, 0x85, 0x70, 0x7E, 0x61, 
-    0x5C, 0x71, 0x89, 0x83, 0x78, 0x6C, 0x6D, 0x7C, 0x74, 0x77, 0x8D, 0x86, 
-    0x67, 0x64, 0x78, 0x88, 0x90, 0x80, 0x76, 0x82, 0x9B, 0x94, 0x8C, 0x6E, 
-    0x7D, 0x9D, 0x85, 0x8F, 0x7A, 0x61, 0x7D, 0x66, 0x7C, 0xA0, 0x97, 0x92, 
-    0x85, 0x8F, 0x86, 0x8A, 0x8A, 0x77, 0x51, 0x62, 0x6C, 0x7C, 0x75, 0x83, 
-    0xB4, 0x83, 0x8D, 0x8E, 0x88, 0x8D, 0x7F, 0x87, 0x7A, 0x8D, 0x73, 0x59, 
-    0x74, 0x71, 0x84, 0x70, 0x7C, 0x91, 0x89, 0x7A, 0x6C, 0x7F, 0x74, 0x8F, 
-    0x9F, 0x8C, 0x77, 0x63, 0x89, 0x6D, 0xA3, 0x9F, 0x8D, 0x95, 0x83, 0x95, 
-    0x8B, 0x80, 0x7A, 0x89, 0x85, 0x69, 0x66, 0x73, 0x77, 0x80, 0x7C, 0x77, 
-    0x6C, 0x6C, 0x77, 0x7F, 0x82, 0x96, 0x8F, 0x83, 0x89, 0x7F, 0x52, 0x76, 
-    0x71, 0x76, 0x71, 0x83, 0xB4, 0x8F, 0x99, 0x90, 0x8E, 0x89, 0x7A, 0x94, 
-    0x4C, 0x62, 0x7A, 0x6A, 0xAE, 0x8B, 0x97, 0x86, 0x83, 0x87, 0x6C, 0x6B, 
-    0x69, 0x81, 0x76, 0x72, 0x8F, 0x7F, 0x80, 0x88, 0x7F, 0x73, 0x72, 0x6B, 
-    0x72, 0x83, 0x94, 0x9D, 0x95, 0x7C, 0x6E, 0x86, 0x7F, 0x82, 0x78, 0x70, 
-    0x75, 0x8A, 0xA4, 0x6E, 0x76, 0x7A, 0x8C, 0x9C, 0x8A, 0x7D, 0x5F, 0x81, 
-    0x75, 0xA3, 0x95, 0x67, 0x81, 0x7A, 0x74, 0x8E, 0xB1, 0x94, 0x90, 0x8B, 
-    0x7E, 0x8E, 0x8C, 0x87, 0x85, 0x7B, 0x77, 0x5F, 0x64, 0x69, 0x7A, 0x79, 
-    0x7E, 0x8C, 0x75, 0x60, 0x6E, 0x6E, 0x73, 0x84, 0x80, 0x79, 0x84, 0x99, 
-    0x8B, 0x77, 0x78, 0x6E, 0x97, 0x92, 0x91, 0x72, 0x63, 0x86, 0x6E, 0xAB, 
-    0x90, 0x93, 0x8C, 0x7C, 0x8B, 0x80, 0x7D, 0x69, 0x85, 0x84, 0x68, 0x7A, 
-    0x6E, 0x7F, 0x9E, 0x80, 0x81, 0x83, 0x55, 0x67, 0x74, 0x76, 0x75, 0x8A, 
-    0xAF, 0x86, 0x9B, 0x8A, 0x91, 0x92, 0x79, 0x8B, 0x81, 0x87, 0x84, 0x62, 
-    0x6B, 0x72, 0xA4, 0x85, 0x7F, 0x57, 0x66, 0x76, 0x6B, 0xA9, 0x94, 0x95, 
-    0x91, 0x84, 0x90, 0x79, 0x79, 0x79, 0x7B, 0x6B, 0x65, 0x83, 0x88, 0x89, 
-    0x91, 0x8E, 0x83, 0x72, 0x75, 0x80, 0x73, 0x7F, 0x94, 0x84, 0x6E, 0x74, 
-    0x76, 0x7A, 0x94, 0x77, 0x67, 0x88, 0xAA, 0x8E, 0x92, 0x89, 0x5E, 0x77, 
-    0x6C, 0x7D, 0x7A, 0x7E, 0x80, 0x8E, 0xA9, 0x8C, 0xA2, 0x8E, 0x84, 0x8A, 
-    0x79, 0x8B, 0x7F, 0x7A, 0x76, 0x75, 0x74, 0x62, 0x8C, 0x88, 0x76, 0x6B, 
-    0x67, 0x68, 0x6D, 0x73, 0x87, 0x95, 0x86, 0x6E, 0x66, 0x82, 0x78, 0x6D, 
-    0x76, 0x80, 0x8F, 0x87, 0x8B, 0x9F, 0x92, 0x75, 0x6B, 0x9A, 0x8A, 0x8D, 
-    0x66, 0x5E, 0x81, 0x6A, 0xA1, 0x9D, 0x91, 0x91, 0x83, 0x91, 0x7A, 0x94, 
-    0x84, 0x84, 0x64, 0x43, 0x7B, 0x6F, 0x7A, 0x74, 0xA5, 0x8C, 0x84, 0x90, 
-    0x81, 0x96, 0x82, 0x82, 0x8A, 0x80, 0x91, 0x6F, 0x62, 0x6D, 0x72, 0x7F, 
-    0x7F, 0x7C, 0x74, 0x7A, 0x8E, 0x88, 0x76, 0x7D, 0x87, 0xA8, 0x87, 0x96, 
-    0x7A, 0x5F, 0x86, 0x6D, 0x96, 0xA5, 0x93, 0x95, 0x87, 0x97, 0x84, 0x8E, 
-    0x86, 0x78, 0x76, 0x5A, 0x7D, 0x77, 0x65, 0x72, 0x8D, 0x8B, 0x5B, 0x65, 
-    0x71, 0x74, 0x97, 0x8B, 0x89, 0x8D, 0x82, 0x57, 0x71, 0x73, 0x79, 0x6F, 
-    0x93, 0xA1, 0x8C, 0x9C, 0x8F, 0x96, 0x83, 0x7F, 0x8B, 0x7E, 0x7F, 0x8A, 
-    0x6B, 0x4B, 0x73, 0x6C, 0x73, 0xA0, 0x86, 0x84, 0x82, 0x8A, 0x75, 0x7C, 
-    0x8D, 0x73, 0x70, 0x72, 0x7F, 0x75, 0x66, 0x82, 0x83, 0x7B, 0x83, 0x78, 
-    0x73, 0x7F, 0x8E, 0x8B, 0x96, 0x9B, 0x92, 0x91, 0x6B, 0x6C, 0x77, 0x84, 
-    0x8D, 0x71, 0x7B, 0x8A, 0xAE, 0x99, 0x89, 0x6F, 0x6A, 0x8E, 0x9E, 0x82, 
-    0x96, 0x87, 0x58, 0x76, 0x76, 0x81, 0x79, 0x86, 0xA0, 0x7D, 0x92, 0x8F, 
-    0x98, 0x8D, 0x7C, 0x88, 0x70, 0x80, 0x7B, 0x5D, 0x72, 0x84, 0x7F, 0x5E, 
-    0x64, 0x74, 0x6A, 0x67, 0x69, 0x85, 0x99, 0x8B, 0x7E, 0x6C, 0x7B, 0x83, 
-    0x7E, 0x7C, 0x7B, 0x7D, 0x82, 0x9A, 0x95, 0x78, 0x7A, 0x80, 0xA0, 0x86, 
-    0x92, 0x7C, 0x59, 0x7A, 0x72, 0x7D, 0x9B, 0xA5, 0x8E, 0x83, 0x82, 0x94, 
-    0x8C, 0x92, 0x71, 0x6D, 0x74, 0x73, 0x92, 0x87, 0x7F, 0x90, 0x59, 0x4C, 
-    0x74, 0x6D, 0x76, 0x6E, 0x81, 0xA1, 0x95, 0x9A, 0x91, 0x96, 0x88, 0x7F, 
-    0x88, 0x7D, 0x88, 0x6B, 0x67, 0x85, 0x97, 0x78, 0x67, 0x70, 0x8A, 0x93, 
-    0x83, 0x6E, 0x5C, 0x74, 0x74, 0x72, 0x94, 0xA9, 0x90, 0x8B, 0x84, 0x8F, 
-    0x87, 0x79, 0x81, 0x83, 0x7B, 0x7B, 0x8E, 0x85, 0x79, 0x8D, 0x86, 0x71, 
-    0x5B, 0x69, 0x79, 0x7D, 0x70, 0x70, 0x95, 0xA4, 0x91, 0x92, 0x72, 0x75, 
-    0x71, 0x77, 0x9D, 0x91, 0x92, 0x92, 0x80, 0x58, 0x75, 0x78, 0x76, 0x6A, 
-    0x99, 0x92, 0x8D, 0x7D, 0x68, 0x96, 0x9D, 0x84, 0x89, 0x82, 0x8E, 0x83, 
-    0x86, 0x75, 0x75, 0x8E, 0x77, 0x75, 0x5E, 0x62, 0x6E, 0x6D, 0x76, 0x7D, 
-    0x80, 0x68, 0x6F, 0x78, 0x73, 0x7F, 0x8E, 0x93, 0x90, 0x8E, 0x7B, 0x7D, 
-    0x8E, 0x90, 0x8A, 0x7C, 0x82, 0x97, 0x95, 0x80, 0x65, 0x79, 0x74, 0x92, 
-    0x94, 0x8A, 0x7A, 0x5D, 0x7A, 0x71, 0x7F, 0x8E, 0x93, 0x98, 0x83, 0x8F, 
-    0x8F, 0x91, 0x90, 0x50, 0x6D, 0x6B, 0x71, 0x7B, 0x71, 0x9A, 0x9C, 0x89, 
-    0x8D, 0x8D, 0x93, 0x7F, 0x87, 0x7D, 0x7B, 0x8A, 0x7A, 0x82, 0x7C, 0x67, 
-    0x65, 0x71, 0x78, 0x6A, 0x62, 0x69, 0x80, 0x9E, 0x76, 0x68, 0x73, 0x84, 
-    0xA0, 0x7F, 0x8F, 0x5E, 0x70, 0x7B, 0x76, 0x8A, 0xA8, 0xAC, 0x8E, 0x8C, 
-    0x94, 0x90, 0x97, 0x76, 0x66, 0x8C, 0x7F, 0x6F, 0x73, 0x75, 0x76, 0x91, 
-    0x8B, 0x7D, 0x85, 0x63, 0x6C, 0x70, 0x8F, 0x9E, 0x8E, 0x91, 0x88, 0x64, 
-    0x69, 0x77, 0x7D, 0x6E, 0x7A, 0x7F, 0xA2, 0xA3, 0x98, 0x99, 0x8F, 0x89, 
-    0x84, 0x84, 0x81, 0x81, 0x4F, 0x63, 0x76, 0x71, 0x94, 0x9C, 0x83, 0x7C, 
-    0x7F, 0x82, 0x76, 0x79, 0x70, 0x7F, 0x7E, 0x67, 0x71, 0x70, 0x7A, 0x87, 
-    0x7C, 0x6E, 0x70, 0x78, 0x77, 0x80, 0x7E, 0x90, 0xA5, 0x89, 0x92, 0x75, 
-    0x6E, 0x86, 0x80, 0x7C, 0x6D, 0x7F, 0x7D, 0x9E, 0xA2, 0x92, 0x7F, 0x63, 
-    0x75, 0x8F, 0x9E, 0x83, 0x99, 0x6F, 0x5B, 0x82, 0x76, 0x84, 0x7D, 0x79, 
-    0x77, 0x72, 0x9B, 0xB0, 0xA0, 0x95, 0x89, 0x8E, 0x7F, 0x8C, 0x8D, 0x7E, 
-    0x82, 0x70, 0x67, 0x74, 0x74, 0x78, 0x6B, 0x66, 0x72, 0x83, 0x83, 0x78, 
-    0x72, 0x6E, 0x74, 0x7E, 0x83, 0x7D, 0x7A, 0x7A, 0x7C, 0x7F, 0x84, 0x8B, 
-    0x7D, 0x72, 0x7B, 0xA1, 0x90, 0x8C, 0x8A, 0x59, 0x75, 0x76, 0x78, 0x9A, 
-    0x9D, 0x8F, 0x89, 0x8D, 0x94, 0x8D, 0x94, 0x73, 0x55, 0x60, 0x77, 0xA1, 
-    0x85, 0x83, 0x91, 0x69, 0x4C, 0x7D, 0x84, 0x64, 0x74, 0x72, 0x78, 0x7D, 
-    0xA0, 0xB8, 0x91, 0x97, 0x87, 0x8E, 0x88, 0x8F, 0x97, 0x6C, 0x74, 0x80, 
-    0x8E, 0x95, 0x7A, 0x62, 0x5E, 0x7D, 0x8F, 0x7F, 0x83, 0x5C, 0x70, 0x6B, 
-    0x6E, 0x87, 0xA4, 0x8E, 0x86, 0x89, 0x86, 0x8D, 0x90, 0x6E, 0x67, 0x7A, 
-    0x94, 0x89, 0x8B, 0x71, 0x71, 0x7A, 0x6E, 0x77, 0x72, 0x6F, 0x73, 0x74, 
-    0x8F, 0xA5, 0x9F, 0x8B, 0x5E, 0x76, 0x78, 0x94, 0x99, 0x87, 0x97, 0x78, 
-    0x63, 0x76, 0x8F, 0xA9, 0x74, 0x52, 0x6E, 0x71, 0x83, 0x74, 0xA7, 0x9E, 
-    0x87, 0x8B, 0x6B, 0xA8, 0x8D, 0x8B, 0x82, 0x7A, 0x8A, 0x80, 0x81, 0x65, 
-    0x74, 0x71, 0x5E, 0x72, 0x64, 0x75, 0x7C, 0x7C, 0x76, 0x7A, 0x8C, 0x88, 
-    0x78, 0x69, 0x7F, 0x9A, 0x8F, 0x82, 0x84, 0x90, 0x98, 0x8D, 0x7E, 0x79, 
-    0x84, 0x7A, 0x6E, 0x7D, 0x8B, 0x7E, 0x69, 0x72, 0x79, 0x82, 0xA9, 0x8F, 
-    0x93, 0x68, 0x69, 0x83, 0x73, 0x89, 0xA6, 0x96, 0x89, 0x8E, 0x91, 0x5B, 
-    0x96, 0x94, 0x7C, 0x5A, 0x5F, 0x7F, 0x77, 0x7C, 0x84, 0xAB, 0x82, 0x88, 
-    0x8E, 0x82, 0x89, 0x7A, 0x81, 0x80, 0x89, 0x83, 0x71, 0x7E, 0x6D, 0x6B, 
-    0x66, 0x6D, 0x80, 0x75, 0x72, 0x75, 0x85, 0x8A, 0x7B, 0x72, 0x74, 0x82, 
-    0x94, 0x8B, 0x89, 0x87, 0x76, 0x70, 0x7A, 0x7B, 0xA4, 0x9A, 0x8B, 0x8D, 
-    0x8B, 0x90, 0x70, 0x6B, 0x73, 0x75, 0x71, 0x75, 0x9F, 0x97, 0x7E, 0x71, 
-    0x72, 0x78, 0x79, 0x8B, 0x8A, 0x8F, 0x8C, 0x8D, 0x81, 0x6E, 0x9D, 0x8B, 
-    0x84, 0x5B, 0x5A, 0x7D, 0x70, 0x7F, 0x7A, 0xAC, 0x8C, 0x89, 0x8F, 0x87, 
-    0x91, 0x7E, 0x83, 0x7B, 0x7F, 0x79, 0x62, 0x72, 0x6E, 0x6F, 0x86, 0x94, 
-    0x87, 0x87, 0x88, 0x82, 0x75, 0x70, 0x7A, 0x7D, 0x76, 0x6B, 0x79, 0x88, 
-    0x93, 0x93, 0x87, 0x86, 0x85, 0x70, 0x6B, 0x7C, 0x88, 0x87, 0x7E, 0x7F, 
-    0x7E, 0x7A, 0x7A, 0x80, 0x92, 0x8D, 0x83, 0x78, 0x77, 0x86, 0x88, 0x91, 
-    0x8D, 0x8B, 0x8C, 0x82, 0x7B, 0x7A, 0x92, 0x8E, 0x7C, 0x53, 0x71, 0x76, 
-    0x76, 0x70, 0x8C, 0xA4, 0x81, 0x8D, 0x85, 0x8B, 0x89, 0x7D, 0x83, 0x74, 
-    0x78, 0x7D, 0x77, 0x6B, 0x68, 0x72, 0x6D, 0x76, 0x7C, 0x7A, 0x7C, 0x85, 
-    0x84, 0x81, 0x85, 0x83, 0x7C, 0x75, 0x77, 0x85, 0x8D, 0x8E, 0x94, 0x86, 
-    0x87, 0x82, 0x7B, 0x83, 0x82, 0x88, 0x78, 0x7D, 0x7C, 0x76, 0x80, 0x7D, 
-    0x8B, 0x8E, 0x87, 0x88, 0x90, 0x81, 0x73, 0x80, 0x8C, 0x8E, 0x92, 0x8D, 
-    0x8C, 0x89, 0x8A, 0x83, 0x8A, 0x64, 0x54, 0x72, 0x63, 0x74, 0x70, 0x96, 
-    0x9A, 0x83, 0x8C, 0x81, 0x8F, 0x7E, 0x80, 0x83, 0x6D, 0x7B, 0x70, 0x74, 
-    0x73, 0x75, 0x79, 0x77, 0x7D, 0x75, 0x77, 0x83, 0x82, 0x7B, 0x77, 0x7F, 
-    0x7D, 0x7D, 0x87, 0x8C, 0x8A, 0x8A, 0x8B, 0x8A, 0x8E, 0x8C, 0x86, 0x84, 
-    0x83, 0x83, 0x83, 0x7E, 0x7C, 0x75, 0x79, 0x7E, 0x7E, 0x82, 0x81, 0x80, 
-    0x81, 0x86, 0x8A, 0x83, 0x88, 0x86, 0x86, 0x81, 0x85, 0x89, 0x8D, 0x86, 
-    0x6F, 0x6D, 0x71, 0x78, 0x77, 0x77, 0x82, 0x85, 0x9A, 0x9E, 0x94, 0x97, 
-    0x93, 0x94, 0x84, 0x88, 0x89, 0x78, 0x7D, 0x68, 0x77, 0x5F, 0x6E, 0x60, 
-    0x68, 0x62, 0x66, 0x6B, 0x6F, 0x7B, 0x63, 0x70, 0x6C, 0x86, 0x6F, 0x84, 
-    0x76, 0x84, 0x7C, 0x85, 0x84, 0x87, 0x91, 0x7C, 0x92, 0x7B, 0x8D, 0x78, 
-    0x8A, 0x73, 0x76, 0x7B, 0x7E, 0x7B, 0x76, 0x83, 0x80, 0x84, 0x78, 0x7D, 
-    0x79, 0x7D, 0x86, 0x88, 0x95, 0x91, 0x8F, 0x8C, 0x92, 0x92, 0x8C, 0x8F, 
-    0x8F, 0x95, 0x9F, 0xA0, 0xA6, 0xA5, 0xA1, 0x9E, 0x95, 0x93, 0x92, 0x8F, 
-    0x8D, 0x87, 0x83, 0x79, 0x81, 0x81, 0x81, 0x7D, 0x76, 0x76, 0x76, 0x7B, 
-    0x76, 0x76, 0x78, 0x7E, 0x84, 0x7C, 0x7C, 0x7D, 0x76, 0x78, 0x75, 0x7A, 
-    0x76, 0x77, 0x76, 0x73, 0x73, 0x6E, 0x69, 0x6A, 0x6A, 0x6C, 0x64, 0x64, 
-    0x6D, 0x70, 0x71, 0x69, 0x6B, 0x65, 0x6A, 0x6C, 0x75, 0x77, 0x74, 0x75, 
-    0x75, 0x76, 0x7A, 0x7A, 0x7E, 0x81, 0x89, 0x8B, 0x8E, 0x92, 0x96, 0x97, 
-    0x93, 0x8F, 0x8C, 0x90, 0x90, 0x8B, 0x86, 0x81, 0x81, 0x79, 0x79, 0x74, 
-    0x76, 0x70, 0x71, 0x74, 0x73, 0x75, 0x72, 0x7B, 0x80, 0x87, 0x87, 0x8B, 
-    0x87, 0x88, 0x90, 0x90, 0x8E, 0x8D, 0x95, 0x92, 0x96, 0x95, 0x95, 0x8E, 
-    0x8B, 0x8D, 0x90, 0x8C, 0x88, 0x86, 0x8B, 0x84, 0x7D, 0x77, 0x7D, 0x7E, 
-    0x7A, 0x83, 0x88, 0x81, 0x86, 0x88, 0x83, 0x7F, 0x85, 0x83, 0x81, 0x80, 
-    0x86, 0x85, 0x84, 0x8A, 0x8E, 0x92, 0x85, 0x85, 0x85, 0x7E, 0x73, 0x76, 
-    0x87, 0x8B, 0x7E, 0x7B, 0x77, 0x78, 0x78, 0x75, 0x74, 0x73, 0x77, 0x6F, 
-    0x79, 0x7A, 0x80, 0x77, 0x6F, 0x6E, 0x70, 0x6B, 0x69, 0x7B, 0x85, 0x7D, 
-    0x77, 0x75, 0x76, 0x79, 0x79, 0x78, 0x78, 0x78, 0x7B, 0x7D, 0x84, 0x85, 
-    0x84, 0x81, 0x82, 0x82, 0x7A, 0x7F, 0x87, 0x8E, 0x84, 0x83, 0x87, 0x85, 
-    0x83, 0x86, 0x84, 0x81, 0x82, 0x80, 0x7F, 0x84, 0x84, 0x7D, 0x7B, 0x7A, 
-    0x79, 0x72, 0x71, 0x7A, 0x80, 0x7C, 0x7C, 0x7F, 0x7A, 0x7B, 0x84, 0x7E, 
-    0x77, 0x78, 0x7A, 0x7C, 0x84, 0x87, 0x8B, 0x8A, 0x8E, 0x8B, 0x8A, 0x8F, 
-    0x97, 0x93, 0x8E, 0x8F, 0x92, 0x8E, 0x90, 0x90, 0x8A, 0x89, 0x88, 0x85, 
-    0x88, 0x89, 0x82, 0x7F, 0x84, 0x81, 0x77, 0x77, 0x7F, 0x80, 0x81, 0x80, 
-    0x80, 0x7D, 0x87, 0x8A, 0x86, 0x85, 0x8C, 0x8B, 0x8A, 0x8E, 0x8E, 0x88, 
-    0x87, 0x8E, 0x86, 0x7A, 0x82, 0x88, 0x81, 0x77, 0x80, 0x79, 0x6B, 0x6F, 
-    0x71, 0x68, 0x65, 0x69, 0x64, 0x66, 0x6D, 0x6A, 0x62, 0x65, 0x69, 0x60, 
-    0x5C, 0x68, 0x6F, 0x64, 0x69, 0x76, 0x70, 0x6F, 0x7A, 0x73, 0x70, 0x76, 
-    0x7B, 0x79, 0x81, 0x84, 0x7E, 0x82, 0x88, 0x7F, 0x7D, 0x87, 0x91, 0x88, 
-    0x8D, 0x98, 0x91, 0x8D, 0x95, 0x92, 0x8E, 0x8D, 0x8E, 0x8D, 0x92, 0x95, 
-    0x91, 0x94, 0x96, 0x92, 0x8C, 0x94, 0x97, 0x94, 0x8F, 0x98, 0x90, 0x8F, 
-    0x90, 0x8F, 0x88, 0x85, 0x82, 0x88, 0x83, 0x85, 0x81, 0x82, 0x79, 0x7B, 
-    0x79, 0x7D, 0x7B, 0x7A, 0x7A, 0x7D, 0x73, 0x73, 0x79, 0x7C, 0x79, 0x79, 
-    0x7C, 0x82, 0x82, 0x85, 0x85, 0x81, 0x80, 0x80, 0x80, 0x7E, 0x84, 0x7E, 
-    0x7E, 0x80, 0x80, 0x7F, 0x7D, 0x7B, 0x7A, 0x7A, 0x7D, 0x7A, 0x7C, 0x7F, 
-    0x7D, 0x79, 0x78, 0x7A, 0x76, 0x78, 0x7A, 0x78, 0x78, 0x7A, 0x7A, 0x76, 
-    0x79, 0x7A, 0x78, 0x7A, 0x7A, 0x7A, 0x7B, 0x7A, 0x7C, 0x7C, 0x7B, 0x76, 
-    0x7B, 0x80, 0x7E, 0x7C, 0x7E, 0x7F, 0x7E, 0x7D, 0x80, 0x80, 0x82, 0x81, 
-    0x82, 0x7E, 0x83, 0x85, 0x87, 0x87, 0x89, 0x89, 0x8F, 0x88, 0x89, 0x89, 
-    0x89, 0x85, 0x87, 0x87, 0x86, 0x84, 0x83, 0x7E, 0x83, 0x7D, 0x7D, 0x80, 
-    0x82, 0x7C, 0x7E, 0x80, 0x7C, 0x7E, 0x81, 0x7C, 0x76, 0x78, 0x7C, 0x77, 
-    0x78, 0x7B, 0x7B, 0x7D, 0x83, 0x7C, 0x7C, 0x85, 0x81, 0x7C, 0x7D, 0x7F, 
-    0x7D, 0x83, 0x87, 0x83, 0x83, 0x87, 0x89, 0x85, 0x88, 0x88, 0x8A, 0x87, 
-    0x85, 0x86, 0x84, 0x82, 0x83, 0x85, 0x85, 0x80, 0x7E, 0x82, 0x7F, 0x81, 
-    0x7B, 0x92, 0x91, 0x8B, 0x76, 0x5F, 0x7C, 0x79, 0x80, 0x78, 0x87, 0x98, 
-    0x80, 0x79, 0x74, 0x81, 0x80, 0x79, 0x80, 0x85, 0x8B, 0x87, 0x83, 0x80, 
-    0x7B, 0x80, 0x7A, 0x79, 0x7A, 0x86, 0x81, 0x7C, 0x7E, 0x86, 0x81, 0x7D, 
-    0x7E, 0x83, 0x7C, 0x7C, 0x81, 0x86, 0x84, 0x7D, 0x78, 0x7C, 0x81, 0x7C, 
-    0x80, 0x84, 0x7F, 0x7E, 0x7F, 0x80, 0x80, 0x84, 0x81, 0x7E, 0x7B, 0x7B, 
-    0x81, 0x78, 0x78, 0x7D, 0x83, 0x7C, 0x7D, 0x80, 0x83, 0x7F, 0x7E, 0x7E, 
-    0x80, 0x7D, 0x7C, 0x7B, 0x7C, 0x79, 0x7A, 0x7C, 0x7B, 0x7E, 0x82, 0x83, 
-    0x82, 0x84, 0x87, 0x84, 0x7D, 0x7F, 0x84, 0x82, 0x81, 0x82, 0x85, 0x87, 
-    0x84, 0x80, 0x81, 0x81, 0x80, 0x7D, 0x81, 0x82, 0x85, 0x80, 0x80, 0x80, 
-    0x81, 0x7F, 0x80, 0x7F, 0x7E, 0x7E, 0x83, 0x83, 0x84, 0x83, 0x81, 0x7D, 
-    0x7C, 0x7E, 0x7E, 0x7D, 0x7F, 0x84, 0x85, 0x82, 0x83, 0x86, 0x87, 0x87, 
-    0x87, 0x8A, 0x87, 0x86, 0x86, 0x83, 0x82, 0x85, 0x81, 0x7D, 0x7F, 0x80, 
-    0x7F, 0x80, 0x82, 0x7F, 0x7E, 0x80, 0x81, 0x80, 0x7C, 0x81, 0x7F, 0x79, 
-    0x7B, 0x7E, 0x77, 0x78, 0x7A, 0x77, 0x77, 0x7A, 0x79, 0x7D, 0x7D, 0x80, 
-    0x7E, 0x7F, 0x7B, 0x7F, 0x7C, 0x7A, 0x79, 0x7C, 0x7B, 0x7E, 0x7C, 0x7B, 
-    0x7B, 0x7D, 0x7A, 0x7C, 0x7D, 0x84, 0x82, 0x81, 0x84, 0x84, 0x80, 0x7E, 
-    0x81, 0x7F, 0x7E, 0x82, 0x83, 0x7E, 0x81, 0x81, 0x81, 0x82, 0x85, 0x84, 
-    0x83, 0x85, 0x86, 0x86, 0x82, 0x7F, 0x82, 0x83, 0x84, 0x85, 0x83, 0x81, 
-    0x81, 0x85, 0x80, 0x7E, 0x81, 0x83, 0x82, 0x86, 0x89, 0x88, 0x88, 0x89, 
-    0x89, 0x88, 0x83, 0x83, 0x87, 0x85, 0x7F, 0x82, 0x8D, 0x8A, 0x82, 0x7D, 
-    0x7C, 0x7F, 0x7C, 0x7E, 0x82, 0x84, 0x82, 0x84, 0x82, 0x81, 0x7F, 0x7B, 
-    0x7C, 0x82, 0x80, 0x7D, 0x7D, 0x7B, 0x7F, 0x80, 0x7D, 0x78, 0x82, 0x82, 
-    0x7C, 0x75, 0x7A, 0x7B, 0x7B, 0x7B, 0x7D, 0x7C, 0x73, 0x78, 0x7C, 0x82, 
-    0x7B, 0x7C, 0x7C, 0x7B, 0x7D, 0x82, 0x7F, 0x7A, 0x7F, 0x7C, 0x7B, 0x7A, 
-    0x81, 0x7F, 0x7A, 0x7C, 0x83, 0x7C, 0x6E, 0x74, 0x7D, 0x88, 0x83, 0x7B, 
-    0x78, 0x7D, 0x83, 0x84, 0x83, 0x86, 0x83, 0x7B, 0x75, 0x7C, 0x84, 0x80, 
-    0x82, 0x82, 0x84, 0x88, 0x7F, 0x80, 0x80, 0x83, 0x82, 0x84, 0x89, 0x86, 
-    0x8B, 0x88, 0x87, 0x82, 0x82, 0x83, 0x7F, 0x85, 0x88, 0x89, 0x80, 0x7F, 
-    0x81, 0x7E, 0x83, 0x88, 0x85, 0x86, 0x86, 0x8C, 0x80, 0x75, 0x7A, 0x87, 
-    0x8F, 0x84, 0x85, 0x85, 0x7E, 0x7F, 0x7F, 0x7E, 0x7A, 0x83, 0x86, 0x84, 
-    0x86, 0x83, 0x81, 0x7A, 0x7D, 0x80, 0x80, 0x7F, 0x7D, 0x80, 0x7F, 0x84, 
-    0x81, 0x7D, 0x7A, 0x79, 0x7A, 0x75, 0x78, 0x82, 0x7E, 0x7A, 0x7C, 0x7C, 
-    0x82, 0x78, 0x79, 0x78, 0x7C, 0x7F, 0x73, 0x7C, 0x83, 0x8A, 0x88, 0x84, 
-    0x86, 0x81, 0x7F, 0x7F, 0x7E, 0x7F, 0x83, 0x88, 0x84, 0x84, 0x7D, 0x7E, 
-    0x7C, 0x7D, 0x80, 0x7F, 0x82, 0x82, 0x7E, 0x7D, 0x7A, 0x81, 0x7C, 0x80, 
-    0x7F, 0x7D, 0x83, 0x85, 0x7C, 0x75, 0x7C, 0x7C, 0x70, 0x73, 0x72, 0x7D, 
-    0x7D, 0x7C, 0x7A, 0x97, 0xA7, 0x8F, 0x95, 0x91, 0x90, 0x5E, 0x7A, 0x7D, 
-    0x82, 0x90, 0x98, 0x98, 0x8A, 0x90, 0x69, 0x6C, 0x78, 0x83, 0x84, 0x82, 
-    0x97, 0x8C, 0x88, 0x71, 0x7C, 0x77, 0x64, 0x81, 0x84, 0x7E, 0x6F, 0x72, 
-    0x8A, 0x6C, 0x60, 0x7E, 0x9B, 0x84, 0x70, 0x77, 0x83, 0x7A, 0x74, 0x70, 
-    0x81, 0x93, 0x86, 0x80, 0x79, 0x82, 0x8C, 0x7A, 0x71, 0x85, 0x92, 0x85, 
-    0x7F, 0x81, 0x81, 0x86, 0x7B, 0x72, 0x7E, 0x86, 0x87, 0x84, 0x7E, 0x82, 
-    0x8B, 0x86, 0x7D, 0x80, 0x87, 0x83, 0x81, 0x80, 0x82, 0x84, 0x82, 0x7D, 
-    0x81, 0x88, 0x86, 0x82, 0x80, 0x82, 0x81, 0x7D, 0x7D, 0x7F, 0x7E, 0x82, 
-    0x80, 0x81, 0x80, 0x83, 0x87, 0x82, 0x7C, 0x7E, 0x7E, 0x7E, 0x7B, 0x7D, 
-    0x7E, 0x7E, 0x7D, 0x7C, 0x81, 0x7F, 0x80, 0x7F, 0x7D, 0x82, 0x82, 0x81, 
-    0x82, 0x83, 0x83, 0x82, 0x7F, 0x7D, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7E, 
-    0x81, 0x80, 0x80, 0x82, 0x7F, 0x80, 0x7F, 0x7D, 0x80, 0x7F, 0x7E, 0x7E, 
-    0x80, 0x7F, 0x7D, 0x7F, 0x7C, 0x7E, 0x80, 0x7D, 0x7D, 0x80, 0x81, 0x7C, 
-    0x7F, 0x83, 0x7E, 0x7F, 0x84, 0x81, 0x81, 0x84, 0x85, 0x7F, 0x80, 0x84, 
-    0x81, 0x7F, 0x82, 0x84, 0x80, 0x7E, 0x85, 0x84, 0x7F, 0x82, 0x82, 0x7F, 
-    0x7F, 0x83, 0x81, 0x7C, 0x7D, 0x84, 0x83, 0x7C, 0x7F, 0x88, 0x85, 0x80, 
-    0x85, 0x85, 0x7F, 0x80, 0x80, 0x7F, 0x7E, 0x7D, 0x7F, 0x82, 0x80, 0x7D, 
-    0x80, 0x82, 0x7F, 0x7C, 0x7D, 0x7F, 0x7E, 0x7D, 0x7D, 0x80, 0x7F, 0x7F, 
-    0x81, 0x80, 0x80, 0x82, 0x82, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7E, 
-    0x7F, 0x7D, 0x7D, 0x7E, 0x7E, 0x7C, 0x7D, 0x7F, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7C, 0x7C, 0x7A, 0x7B, 0x7D, 0x7D, 0x7C, 0x7E, 0x80, 0x80, 0x81, 
-    0x81, 0x80, 0x81, 0x82, 0x81, 0x80, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 
-    0x82, 0x81, 0x81, 0x82, 0x83, 0x83, 0x82, 0x82, 0x83, 0x81, 0x82, 0x83, 
-    0x82, 0x81, 0x83, 0x84, 0x85, 0x85, 0x85, 0x86, 0x84, 0x84, 0x84, 0x84, 
-    0x84, 0x83, 0x82, 0x82, 0x82, 0x81, 0x82, 0x82, 0x80, 0x80, 0x80, 0x7E, 
-    0x80, 0x81, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 
-    0x80, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 
-    0x7D, 0x7D, 0x7E, 0x7F, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7E, 0x7D, 0x7D, 0x7C, 0x7D, 
-    0x7D, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x82, 0x83, 0x82, 0x82, 0x83, 0x83, 0x82, 0x81, 0x80, 0x81, 0x82, 0x81, 
-    0x80, 0x81, 0x83, 0x82, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x82, 0x82, 
-    0x80, 0x7D, 0x7D, 0x7F, 0x7F, 0x7D, 0x79, 0x77, 0x7C, 0x84, 0x88, 0x87, 
-    0x85, 0x84, 0x82, 0x81, 0x80, 0x80, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x80, 
-    0x7C, 0x7B, 0x7F, 0x83, 0x82, 0x7E, 0x7E, 0x80, 0x7F, 0x7E, 0x7E, 0x81, 
-    0x83, 0x82, 0x80, 0x7F, 0x80, 0x82, 0x82, 0x7D, 0x7D, 0x83, 0x80, 0x7A, 
-    0x7C, 0x81, 0x82, 0x7C, 0x77, 0x7B, 0x7F, 0x79, 0x76, 0x79, 0x7C, 0x85, 
-    0x8B, 0x99, 0x95, 0x91, 0x8A, 0x91, 0x68, 0x60, 0x7C, 0x78, 0x82, 0x8C, 
-    0x99, 0x8B, 0x8B, 0x6D, 0x6F, 0x7B, 0x78, 0x80, 0x88, 0x8A, 0x8B, 0x82, 
-    0x7C, 0x89, 0x86, 0x70, 0x6F, 0x6E, 0x65, 0x72, 0x82, 0x6D, 0x70, 0x79, 
-    0x88, 0x9C, 0x85, 0x86, 0x83, 0x82, 0x80, 0x82, 0x86, 0x83, 0x87, 0x7C, 
-    0x7D, 0x8C, 0x8A, 0x88, 0x82, 0x81, 0x82, 0x7E, 0x7C, 0x7E, 0x83, 0x7F, 
-    0x7C, 0x81, 0x81, 0x79, 0x7A, 0x80, 0x8B, 0x8D, 0x89, 0x88, 0x8B, 0x87, 
-    0x7D, 0x7E, 0x85, 0x87, 0x84, 0x81, 0x81, 0x83, 0x81, 0x7F, 0x80, 0x81, 
-    0x80, 0x7C, 0x79, 0x7A, 0x7A, 0x7B, 0x7F, 0x7D, 0x75, 0x76, 0x7D, 0x82, 
-    0x86, 0x87, 0x82, 0x80, 0x80, 0x7A, 0x74, 0x75, 0x78, 0x7B, 0x7C, 0x7E, 
-    0x81, 0x80, 0x7D, 0x7C, 0x7E, 0x80, 0x81, 0x82, 0x81, 0x81, 0x83, 0x84, 
-    0x81, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x7D, 0x7D, 0x7E, 0x80, 0x7F, 0x7D, 
-    0x7D, 0x80, 0x82, 0x83, 0x85, 0x85, 0x86, 0x85, 0x83, 0x81, 0x80, 0x80, 
-    0x7E, 0x7D, 0x7E, 0x81, 0x83, 0x81, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x85, 0x85, 0x85, 0x85, 
-    0x85, 0x84, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x82, 0x83, 0x82, 0x81, 
-    0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x80, 0x83, 0x84, 0x83, 0x82, 0x81, 
-    0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7D, 0x7C, 0x7C, 0x7B, 
-    0x7C, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 
-    0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x7F, 0x7E, 
-    0x7E, 0x7E, 0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 
-    0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 
-    0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 
-    0x81, 0x80, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 
-    0x81, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x81, 0x81, 0x80, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x80, 0x80, 0x7F, 0x80, 0x7F, 
-    0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 
-    0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 
-    0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 
-    0x80, 0x80, 0x7F, 0x7E, 0x7E, 0x80, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x81, 0x81, 0x81, 
-    0x80, 0x81, 0x80, 0x7F, 0x7F, 0x81, 0x81, 0x7F, 0x7E, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x83, 0x83, 
-    0x80, 0x80, 0x82, 0x81, 0x81, 0x83, 0x82, 0x7F, 0x7F, 0x81, 0x83, 0x82, 
-    0x81, 0x7F, 0x7C, 0x7C, 0x80, 0x83, 0x80, 0x80, 0x87, 0x82, 0x7F, 0x82, 
-    0x80, 0x77, 0x76, 0x84, 0x82, 0x79, 0x81, 0x83, 0x81, 0x82, 0x86, 0x87, 
-    0x82, 0x80, 0x7A, 0x75, 0x76, 0x77, 0x83, 0x8A, 0x7D, 0x81, 0x80, 0x7D, 
-    0x83, 0x87, 0x81, 0x7B, 0x82, 0x7B, 0x75, 0x7F, 0x84, 0x87, 0x88, 0x82, 
-    0x7E, 0x81, 0x7E, 0x7A, 0x79, 0x77, 0x7B, 0x7E, 0x82, 0x88, 0x87, 0x7D, 
-    0x7A, 0x89, 0x83, 0x77, 0x85, 0x83, 0x75, 0x79, 0x84, 0x88, 0x84, 0x83, 
-    0x85, 0x86, 0x7B, 0x6F, 0x74, 0x7C, 0x7A, 0x76, 0x7F, 0x8E, 0x87, 0x7B, 
-    0x80, 0x91, 0x88, 0x79, 0x8C, 0x88, 0x71, 0x75, 0x84, 0x8A, 0x7F, 0x7E, 
-    0x85, 0x88, 0x83, 0x78, 0x7D, 0x7D, 0x7B, 0x7A, 0x7F, 0x93, 0x8D, 0x7E, 
-    0x7C, 0x82, 0x83, 0x78, 0x88, 0x8F, 0x77, 0x6E, 0x79, 0x84, 0x84, 0x84, 
-    0x8B, 0x86, 0x7C, 0x76, 0x7A, 0x7D, 0x7A, 0x7A, 0x7B, 0x86, 0x8C, 0x82, 
-    0x7D, 0x81, 0x82, 0x76, 0x82, 0x97, 0x87, 0x74, 0x74, 0x7D, 0x81, 0x85, 
-    0x90, 0x8B, 0x7C, 0x75, 0x7A, 0x7F, 0x7C, 0x80, 0x7C, 0x7F, 0x8C, 0x82, 
-    0x78, 0x7B, 0x85, 0x7C, 0x77, 0x93, 0x8F, 0x76, 0x71, 0x7A, 0x83, 0x80, 
-    0x89, 0x8E, 0x7F, 0x74, 0x76, 0x7F, 0x7F, 0x7E, 0x7B, 0x7B, 0x89, 0x87, 
-    0x79, 0x78, 0x82, 0x80, 0x77, 0x8F, 0x97, 0x7C, 0x70, 0x77, 0x81, 0x80, 
-    0x84, 0x8F, 0x84, 0x76, 0x76, 0x7F, 0x83, 0x81, 0x7F, 0x7B, 0x87, 0x8B, 
-    0x7C, 0x76, 0x7F, 0x82, 0x75, 0x84, 0x99, 0x84, 0x71, 0x73, 0x7F, 0x82, 
-    0x82, 0x8F, 0x8A, 0x79, 0x74, 0x7B, 0x81, 0x7F, 0x7E, 0x79, 0x80, 0x8B, 
-    0x7F, 0x76, 0x7C, 0x85, 0x7A, 0x7E, 0x98, 0x8D, 0x75, 0x72, 0x7D, 0x83, 
-    0x80, 0x8B, 0x8E, 0x7F, 0x75, 0x79, 0x82, 0x81, 0x80, 0x7C, 0x7E, 0x8D, 
-    0x86, 0x78, 0x79, 0x83, 0x7E, 0x78, 0x92, 0x95, 0x7A, 0x71, 0x79, 0x84, 
-    0x81, 0x87, 0x91, 0x83, 0x76, 0x76, 0x7F, 0x81, 0x7F, 0x7C, 0x79, 0x87, 
-    0x89, 0x7A, 0x77, 0x81, 0x82, 0x77, 0x89, 0x98, 0x81, 0x6F, 0x74, 0x80, 
-    0x81, 0x81, 0x8E, 0x86, 0x77, 0x74, 0x7C, 0x81, 0x80, 0x7F, 0x7A, 0x84, 
-    0x8C, 0x7E, 0x75, 0x7C, 0x83, 0x78, 0x7F, 0x98, 0x88, 0x71, 0x72, 0x7E, 
-    0x84, 0x81, 0x8D, 0x8D, 0x7C, 0x74, 0x79, 0x80, 0x7F, 0x7E, 0x7A, 0x7E, 
-    0x8C, 0x83, 0x76, 0x79, 0x84, 0x7D, 0x7A, 0x95, 0x92, 0x78, 0x70, 0x7B, 
-    0x84, 0x80, 0x87, 0x8E, 0x80, 0x75, 0x78, 0x81, 0x81, 0x80, 0x7D, 0x7D, 
-    0x8C, 0x89, 0x7A, 0x77, 0x82, 0x81, 0x77, 0x8D, 0x98, 0x7E, 0x70, 0x77, 
-    0x84, 0x83, 0x85, 0x90, 0x86, 0x78, 0x76, 0x7E, 0x81, 0x7E, 0x7D, 0x78, 
-    0x84, 0x8A, 0x7B, 0x76, 0x7F, 0x85, 0x7B, 0x86, 0x9A, 0x87, 0x71, 0x72, 
-    0x80, 0x84, 0x80, 0x8D, 0x8A, 0x7A, 0x73, 0x7A, 0x81, 0x7E, 0x7E, 0x7A, 
-    0x81, 0x8D, 0x82, 0x75, 0x77, 0x83, 0x7C, 0x7B, 0x94, 0x8C, 0x72, 0x6D, 
-    0x7C, 0x85, 0x7F, 0x87, 0x8D, 0x7E, 0x74, 0x77, 0x80, 0x7F, 0x7F, 0x7D, 
-    0x7D, 0x8D, 0x88, 0x77, 0x77, 0x7F, 0x7F, 0x7F, 0x94, 0x93, 0x79, 0x71, 
-    0x7C, 0x83, 0x7E, 0x7F, 0x88, 0x84, 0x7A, 0x77, 0x7C, 0x83, 0x87, 0x83, 
-    0x7F, 0x85, 0x82, 0x76, 0x79, 0x82, 0x81, 0x7E, 0x8B, 0x90, 0x7C, 0x73, 
-    0x7C, 0x82, 0x82, 0x83, 0x8A, 0x8B, 0x82, 0x78, 0x7A, 0x82, 0x82, 0x7E, 
-    0x80, 0x82, 0x7F, 0x78, 0x7A, 0x83, 0x82, 0x80, 0x87, 0x87, 0x7C, 0x78, 
-    0x7C, 0x7F, 0x80, 0x81, 0x85, 0x86, 0x7F, 0x77, 0x7B, 0x81, 0x82, 0x83, 
-    0x86, 0x83, 0x7D, 0x7B, 0x7E, 0x82, 0x82, 0x81, 0x85, 0x85, 0x7E, 0x7A, 
-    0x7E, 0x7F, 0x81, 0x83, 0x85, 0x85, 0x7F, 0x7A, 0x7C, 0x80, 0x80, 0x81, 
-    0x84, 0x80, 0x7A, 0x7A, 0x7E, 0x81, 0x83, 0x83, 0x84, 0x82, 0x7D, 0x7B, 
-    0x7D, 0x7F, 0x80, 0x83, 0x84, 0x82, 0x7F, 0x7C, 0x7D, 0x7F, 0x80, 0x82, 
-    0x83, 0x80, 0x7C, 0x7C, 0x7D, 0x7E, 0x80, 0x82, 0x81, 0x7F, 0x7D, 0x7D, 
-    0x7F, 0x81, 0x83, 0x85, 0x85, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 
-    0x82, 0x80, 0x7F, 0x7F, 0x80, 0x81, 0x83, 0x83, 0x82, 0x80, 0x7F, 0x7E, 
-    0x80, 0x81, 0x81, 0x81, 0x80, 0x7F, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 
-};
-int sound_sz = sizeof(sound_8k);
@@ -0,0 +1,54 @@
+/*****************************************************************************
+ *   stackmon.c:  Stack high-water mark from the painted reservation
+ *
+ ******************************************************************************/
+
+/*
+ * ResetISR paints the STACK_SIZE bytes below its own frame with
+ * STACK_PAINT before main runs. The deepest word no longer holding the
+ * pattern is the high-water mark of main and the interrupt handlers
+ * together. A frame that allocates a word without writing it can be
+ * missed, so keep a margin over the reported value.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "stackmon.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+/* Top of the stack from the linker script */
+extern void _vStackTop(void);
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Measures the deepest stack use since reset.
+ *  @returns  		Bytes below _vStackTop written so far, STACK_SIZE if
+ *             		the whole reservation was used (possible overflow).
+ *  @side effects:	Reads up to STACK_SIZE bytes, about 50 us at 100 MHz.
+ */
+uint32_t stackmon_used(void) {
+    const uint32_t *top = (const uint32_t *)&_vStackTop;
+    const uint32_t *p = top - (STACK_SIZE / sizeof(uint32_t));
+
+    while ((p < top) && (*p == STACK_PAINT)) {
+        p++;
+    }
+    return (uint32_t)(top - p) * sizeof(uint32_t);
+}
+
+/*!
+ *  @brief    		Returns the stack reservation.
+ *  @returns  		STACK_SIZE in bytes.
+ *  @side effects:	None.
+ */
+uint32_t stackmon_size(void) {
+    return STACK_SIZE;
+}
@@ -0,0 +1,31 @@
+/*****************************************************************************
+ *   stackmon.h:  Header file for the stack high-water mark monitor
+ *
+******************************************************************************/
+#ifndef __STACKMON_H
+#define __STACKMON_H
+
+#include "lpc_types.h"
+
+/*
+ * Bytes reserved for the main stack below _vStackTop (top of RamLoc32).
+ * Interrupt handlers run on the same stack. The startup code paints the
+ * reservation with STACK_PAINT. The link fails if .data/.bss/.noinit reach
+ * into it: makefile.defs reads the value below for the ASSERT of the
+ * linker script. tools/stackreport.py (make stack-report) gives the static
+ * worst case to size it against.
+ */
+#ifndef STACK_SIZE
+#define STACK_SIZE          4096U
+#endif
+
+#define STACK_PAINT         0xA5A5A5A5UL
+
+uint32_t stackmon_used(void);
+uint32_t stackmon_size(void);
+
+
+#endif /* end __STACKMON_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
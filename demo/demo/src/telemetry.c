@@ -0,0 +1,295 @@
+/*****************************************************************************
+ *   telemetry.c:  Lux/temperature/motor logger on the SD card
+ *
+ ******************************************************************************/
+
+/*
+ * Producers push fixed size records into RAM rings and never wait: when a
+ * ring is full the record is dropped and counted. Each ring has exactly one
+ * producer context and one consumer (telemetry_service), so head and tail
+ * are each written by one side only and no locking is needed. Task code
+ * pushes into taskRing, interrupt handlers into isrRing; the latter is only
+ * single producer as long as all handlers that push run at the same NVIC
+ * priority (they cannot preempt each other then).
+ *
+ * telemetry_service runs from the main loop. It merges both rings by time
+ * into a 512 byte block and writes full blocks with f_stream_write into
+ * space reserved ahead with f_stream_begin, so the card sees one pre-erased
+ * multiple block write instead of a FAT update per block. f_sync runs every
+ * SYNC_BLOCKS blocks or SYNC_MS, whichever comes first. On a disk error the
+ * file is dropped and reopened after RETRY_MS; the pending block is kept.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "LPC17xx.h"
+#include "datetime.h"
+#include "telemetry.h"
+#include "ff.h"             /* after lpc_types.h, integer.h only defines FALSE/TRUE when missing */
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define RING_SIZE           64U     /* records, power of 2 */
+#define RING_MASK           (RING_SIZE - 1U)
+
+#define BLOCK_SIZE          512U
+#define BLOCK_RECORDS       (BLOCK_SIZE / sizeof(telemetry_record_t))
+
+#define RESERVE_SIZE        (1024UL * 1024UL)   /* bytes reserved per f_stream_begin */
+#define SYNC_BLOCKS         8U
+#define SYNC_MS             10000UL
+#define RETRY_MS            5000UL
+
+typedef struct
+{
+    volatile uint32_t head;     /* written by the producer only */
+    volatile uint32_t tail;     /* written by the consumer only */
+    volatile uint32_t dropped;  /* written by the producer only */
+    uint16_t seq;
+    telemetry_record_t rec[RING_SIZE];
+} ring_t;
+
+typedef union
+{
+    telemetry_record_t rec[BLOCK_RECORDS];
+    uint32_t word[BLOCK_SIZE / 4U];
+} block_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static ring_t taskRing;
+static ring_t isrRing;
+
+static uint32_t (*getMs)(void) = NULL;
+
+static FATFS fs;
+static FIL file;
+static Bool fileOpen = FALSE;
+static uint32_t retryTime = 0U;
+static uint32_t syncTime = 0U;
+static uint8_t unsynced = 0U;
+
+static block_t block;
+static uint8_t fill = 0U;       /* records in block including the header, 0 - empty */
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Returns the ring with the older front record.
+ *  @returns  		Ring to pop from, NULL if both are empty.
+ *  @side effects:	None.
+ */
+static ring_t *oldestRing(void) {
+    Bool task = (Bool)(taskRing.tail != taskRing.head);
+    Bool isr = (Bool)(isrRing.tail != isrRing.head);
+    ring_t *output = NULL;
+
+    if (task && isr) {
+        uint32_t t1 = taskRing.rec[taskRing.tail & RING_MASK].time;
+        uint32_t t2 = isrRing.rec[isrRing.tail & RING_MASK].time;
+        output = ((int32_t)(t2 - t1) < 0) ? &isrRing : &taskRing;
+    } else if (task) {
+        output = &taskRing;
+    } else if (isr) {
+        output = &isrRing;
+    } else {}
+    return output;
+}
+
+/*!
+ *  @brief    		Moves records from the rings to the block until it is full.
+ *  @returns
+ *  @side effects:	Starts a new block with a header when the block is empty.
+ */
+static void fillBlock(void) {
+    ring_t *r = oldestRing();
+
+    if ((fill == 0U) && (r != NULL)) {
+        datetime_t now;
+        datetime_readRtc(&now);
+        block.word[0] = TELEMETRY_MAGIC;
+        block.word[1] = getMs();
+        block.word[2] = datetime_toEpoch(&now);
+        block.word[3] = telemetry_getDropped();
+        fill = 1U;
+    }
+    while ((fill < BLOCK_RECORDS) && (r != NULL)) {
+        uint32_t tail = r->tail;
+        block.rec[fill] = r->rec[tail & RING_MASK];
+        __DMB();                    /* record copied before the slot is released */
+        r->tail = tail + 1U;
+        fill++;
+        r = oldestRing();
+    }
+}
+
+/*!
+ *  @brief    		Mounts the card, opens the log for appending and reserves space.
+ *  @returns  		FR_OK on success, FatFs error code otherwise.
+ *  @side effects:	A partial block at the end of the file is padded, the decoder
+ *             		skips it as it has no header.
+ */
+static FRESULT openLog(void) {
+    FRESULT res = f_mount(0, &fs);
+    if (res == FR_OK) {
+        res = f_open(&file, TELEMETRY_FILE, FA_WRITE | FA_OPEN_ALWAYS);
+    }
+    if (res == FR_OK) {
+        res = f_lseek(&file, (file.fsize + BLOCK_SIZE - 1U) & ~(BLOCK_SIZE - 1U));
+        if (res == FR_OK) {
+            res = f_stream_begin(&file, RESERVE_SIZE);
+        }
+        if (res != FR_OK) {
+            (void)f_close(&file);
+        }
+    }
+    return res;
+}
+
+/*!
+ *  @brief    		Writes the full block, reserving more space when needed.
+ *  @returns  		FR_OK on success, FatFs error code otherwise.
+ *  @side effects:	None.
+ */
+static FRESULT writeBlock(void) {
+    FRESULT res = f_stream_write(&file, &block);
+    if (res == FR_DENIED) {         /* Reservation used up */
+        res = f_stream_end(&file);
+        if (res == FR_OK) {
+            res = f_sync(&file);
+        }
+        if (res == FR_OK) {
+            res = f_stream_begin(&file, RESERVE_SIZE);
+        }
+        if (res == FR_OK) {
+            res = f_stream_write(&file, &block);
+        }
+    }
+    return res;
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Initializes the logger. The card is opened later by telemetry_service.
+ *  @param getMsTick	uint32_t (*)(void),
+ *             		millisecond tick source used to time stamp records.
+ *  @returns
+ *  @side effects:	disk_timerproc has to be called every 10 ms.
+ */
+void telemetry_init(uint32_t (*getMsTick)(void)) {
+    getMs = getMsTick;
+    retryTime = getMs();
+    syncTime = retryTime;
+}
+
+/*!
+ *  @brief    		Queues a record, never waits.
+ *  @param type		uint8_t,
+ *             		TELEMETRY_* record type.
+ *  @param value	int32_t,
+ *             		record value, see TELEMETRY_*.
+ *  @param aux		uint32_t,
+ *             		additional value, see TELEMETRY_*.
+ *  @returns  		TRUE if queued, FALSE if the ring was full and the record was dropped.
+ *  @side effects:	Callable from task code and from interrupt handlers of one
+ *             		NVIC priority, see the notes at the top of the file.
+ */
+Bool telemetry_push(uint8_t type, int32_t value, uint32_t aux) {
+    Bool isr = (Bool)((SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) != 0U);
+    ring_t *r = isr ? &isrRing : &taskRing;
+    uint32_t head = r->head;
+    Bool output = FALSE;
+
+    if ((head - r->tail) < RING_SIZE) {
+        telemetry_record_t *rec = &r->rec[head & RING_MASK];
+        rec->time = (getMs != NULL) ? getMs() : 0U;
+        rec->type = type;
+        rec->source = isr ? 1U : 0U;
+        rec->seq = r->seq;
+        rec->value = value;
+        rec->aux = aux;
+        __DMB();                    /* record complete before it is published */
+        r->head = head + 1U;
+        output = TRUE;
+    } else {
+        r->dropped++;
+    }
+    r->seq++;                       /* also on drop, so the decoder sees a gap */
+    return output;
+}
+
+/*!
+ *  @brief    		Background part of the logger, call from the main loop.
+ *             		Writes at most one block per call.
+ *  @returns
+ *  @side effects:	Uses SSP1, must not run while another SSP1 transfer is in progress.
+ */
+void telemetry_service(void) {
+    uint32_t now;
+    FRESULT res = FR_OK;
+
+    if (getMs != NULL) {
+        now = getMs();
+        fillBlock();
+        if (!fileOpen) {
+            if ((int32_t)(now - retryTime) >= 0) {
+                res = openLog();
+                fileOpen = (Bool)(res == FR_OK);
+                syncTime = now;
+                unsynced = 0U;
+                retryTime = now + RETRY_MS;
+            }
+        } else {
+            if (fill == BLOCK_RECORDS) {
+                res = writeBlock();
+                if (res == FR_OK) {
+                    fill = 0U;
+                    unsynced++;
+                }
+            }
+            if ((res == FR_OK) && (unsynced != 0U)
+                    && ((unsynced >= SYNC_BLOCKS) || ((now - syncTime) >= SYNC_MS))) {
+                res = f_sync(&file);
+                syncTime = now;
+                unsynced = 0U;
+            }
+            if (res != FR_OK) {
+                (void)f_close(&file);
+                fileOpen = FALSE;
+                retryTime = now + RETRY_MS;
+            }
+        }
+    }
+}
+
+/*!
+ *  @brief    		Returns the number of records dropped because a ring was full.
+ *  @returns  		Dropped records since start.
+ *  @side effects:	None.
+ */
+uint32_t telemetry_getDropped(void) {
+    return taskRing.dropped + isrRing.dropped;
+}
+
+/*!
+ *  @brief    		Current time for FatFs time stamps, taken from the RTC.
+ *  @returns  		Packed date/time, see get_fattime in ff.h.
+ *  @side effects:	LPC_RTC has to be initialised prior to running this function.
+ */
+DWORD get_fattime(void) {
+    datetime_t now;
+    datetime_readRtc(&now);
+    return ((DWORD)(now.year - 1980U) << 25) | ((DWORD)now.month << 21) | ((DWORD)now.dom << 16)
+            | ((DWORD)now.hour << 11) | ((DWORD)now.min << 5) | ((DWORD)now.sec >> 1);
+}
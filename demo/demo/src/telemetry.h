@@ -0,0 +1,50 @@
+/*****************************************************************************
+ *   telemetry.h:  Header file for the lux/temperature/motor logger on SD
+ *
+******************************************************************************/
+#ifndef __TELEMETRY_H
+#define __TELEMETRY_H
+
+#include "lpc_types.h"
+
+/* Record types */
+#define TELEMETRY_LUX       1U  /* value - lux, aux - lumen activation level */
+#define TELEMETRY_TEMP      2U  /* value - 0.1 C */
+#define TELEMETRY_MOTOR     3U  /* value - TELEMETRY_MOTOR_*, aux - roller state (-1, 0, 1) */
+
+#define TELEMETRY_MOTOR_STOP    0
+#define TELEMETRY_MOTOR_RIGHT   1
+#define TELEMETRY_MOTOR_LEFT    2
+
+/* Log file in the root directory of the card */
+#define TELEMETRY_FILE      "TLM.BIN"
+
+/*
+ * Fixed size record, 32 of them make up one 512 byte block of the file.
+ * Record 0 of every block is a header of four words instead: magic
+ * TELEMETRY_MAGIC, ms ticks and RTC seconds since 2000-01-01 read at the
+ * same moment, and the number of records dropped so far. All fields are
+ * little endian.
+ */
+typedef struct
+{
+    uint32_t time;      /* ms ticks at push */
+    uint8_t type;       /* TELEMETRY_* */
+    uint8_t source;     /* 0 - task, 1 - interrupt */
+    uint16_t seq;       /* per source sequence number, a gap shows dropped records */
+    int32_t value;
+    uint32_t aux;
+} telemetry_record_t;
+
+#define TELEMETRY_MAGIC     0x314D4C54UL    /* "TLM1" */
+
+void telemetry_init(uint32_t (*getMsTick)(void));
+Bool telemetry_push(uint8_t type, int32_t value, uint32_t aux);
+void telemetry_service(void);
+uint32_t telemetry_getDropped(void);
+
+
+#endif /* end __TELEMETRY_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
@@ -0,0 +1,165 @@
+/*****************************************************************************
+ *   trace.c:  Event trace on the ITM stimulus port with a RAM fallback
+ *
+ ******************************************************************************/
+
+/*
+ * An event is an id, a time stamp in CPU cycles (DWT CYCCNT) and a 32 bit
+ * argument. It costs a few dozen cycles, against milliseconds for a line
+ * on the OLED, so it can be left in interrupt handlers.
+ *
+ * When the debugger has enabled the ITM and TRACE_ITM_PORT (SWO capture
+ * running) an event is written to the port as three writes: the id as a
+ * byte, then the time and the argument as words. The byte write starts an
+ * event, which lets the decoder resynchronize after an overflow. The ITM
+ * FIFO is polled before each write, so a slow SWO clock slows the events
+ * down instead of losing them.
+ *
+ * Otherwise the event goes to trace_ring, which keeps the last
+ * TRACE_RING_SIZE events and can be read with the debugger at any time,
+ * e.g. after a halt or a fault.
+ *
+ * Both paths run with interrupts masked so an event from an interrupt
+ * handler cannot split another one. tools/trace2json.py turns an SWO
+ * capture or a ring dump into a Chrome trace / Perfetto timeline.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "LPC17xx.h"
+#include "lpc17xx_i2c.h"
+#include "dwt.h"
+#include "trace.h"
+
+#ifdef TRACE_ENABLE
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint32_t traceMask = TRACE_ALL;
+
+/******************************************************************************
+ * Public variables
+ *****************************************************************************/
+
+trace_ring_t trace_ring;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Reports whether the debugger is capturing the trace port.
+ *  @returns  		TRUE if the ITM and TRACE_ITM_PORT are enabled.
+ *  @side effects:	None.
+ */
+static Bool itmEnabled(void) {
+    return (Bool)(((ITM->TCR & ITM_TCR_ITMENA_Msk) != 0U) &&
+                  ((ITM->TER & ((uint32_t)1U << TRACE_ITM_PORT)) != 0U));
+}
+
+/*!
+ *  @brief    		Traces the polling I2C transfers, installed as the hook of lpc17xx_i2c.
+ *  @param I2Cx		LPC_I2C_TypeDef*,
+ *             		bus of the transfer.
+ *  @param cfg		I2C_M_SETUP_Type*,
+ *             		transfer.
+ *  @param event	I2C_HOOK_EVENT_Type,
+ *             		start, done or error.
+ *  @returns
+ *  @side effects:	None.
+ */
+static void i2cHook(LPC_I2C_TypeDef *I2Cx, I2C_M_SETUP_Type *cfg, I2C_HOOK_EVENT_Type event) {
+    uint32_t bus = 2U;
+    uint32_t arg;
+
+    if (I2Cx == LPC_I2C0) {
+        bus = 0U;
+    } else if (I2Cx == LPC_I2C1) {
+        bus = 1U;
+    } else {}
+    arg = (cfg->sl_addr7bit & 0xFFU) | (bus << 24U);
+
+    if (event == I2C_HOOK_START) {
+        arg |= ((cfg->tx_length & 0xFFU) << 8U) | ((cfg->rx_length & 0xFFU) << 16U);
+        trace_event(TRACE_I2C_START, arg);
+    } else if (event == I2C_HOOK_DONE) {
+        arg |= ((cfg->tx_count & 0xFFU) << 8U) | ((cfg->rx_count & 0xFFU) << 16U);
+        trace_event(TRACE_I2C_DONE, arg);
+    } else {
+        arg |= (cfg->status & 0xFFU) << 8U;
+        trace_event(TRACE_I2C_ERROR, arg);
+    }
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/*!
+ *  @brief    		Starts the cycle counter, clears the ring and hooks the I2C driver.
+ *  @returns
+ *  @side effects:	Installs the I2C transfer hook.
+ */
+void trace_init(void) {
+    DWT_START();
+
+    trace_ring.magic = TRACE_RING_MAGIC;
+    trace_ring.cpuHz = SystemCoreClock;
+    trace_ring.size = TRACE_RING_SIZE;
+    trace_ring.written = 0U;
+
+    I2C_SetTransferHook(&i2cHook);
+}
+
+/*!
+ *  @brief    		Selects the events traced, all are on after trace_init.
+ *  @param mask		uint32_t,
+ *             		TRACE_BIT of each event to trace, TRACE_ALL for all.
+ *  @returns
+ *  @side effects:	None.
+ */
+void trace_setMask(uint32_t mask) {
+    traceMask = mask;
+}
+
+/*!
+ *  @brief    		Records an event, use TRACE instead.
+ *  @param id		trace_event_t,
+ *             		event.
+ *  @param arg		uint32_t,
+ *             		argument, see trace_event_t.
+ *  @returns
+ *  @side effects:	Masks interrupts while writing, waits for the ITM FIFO.
+ */
+void trace_event(trace_event_t id, uint32_t arg) {
+    uint32_t primask;
+    uint32_t time;
+    trace_record_t *rec;
+
+    if ((traceMask & TRACE_BIT(id)) != 0U) {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        time = DWT_CYCCNT;
+        if (itmEnabled()) {
+            while (ITM->PORT[TRACE_ITM_PORT].u32 == 0U) {}
+            ITM->PORT[TRACE_ITM_PORT].u8 = (uint8_t)id;
+            while (ITM->PORT[TRACE_ITM_PORT].u32 == 0U) {}
+            ITM->PORT[TRACE_ITM_PORT].u32 = time;
+            while (ITM->PORT[TRACE_ITM_PORT].u32 == 0U) {}
+            ITM->PORT[TRACE_ITM_PORT].u32 = arg;
+        } else {
+            rec = &trace_ring.rec[trace_ring.written & (TRACE_RING_SIZE - 1U)];
+            rec->time = time;
+            rec->arg = arg;
+            rec->id = (uint8_t)id;
+            trace_ring.written++;
+        }
+        __set_PRIMASK(primask);
+    }
+}
+
+#endif /* TRACE_ENABLE */
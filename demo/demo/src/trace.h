@@ -0,0 +1,88 @@
+/*****************************************************************************
+ *   trace.h:  Header file for the ITM event trace
+ *
+******************************************************************************/
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#include "lpc_types.h"
+
+/*
+ * Events of the application, ids are part of the capture format and are
+ * decoded by tools/trace2json.py, only append.
+ */
+typedef enum
+{
+    TRACE_TIMER0_ENTER = 1,     /* arg: TIM0->IR */
+    TRACE_TIMER0_EXIT,          /* arg: 0 */
+    TRACE_RTC_ENTER,            /* arg: RTC->ILR */
+    TRACE_RTC_EXIT,             /* arg: 0 */
+    TRACE_I2C_START,            /* arg: address | tx length << 8 | rx length << 16 | bus << 24 */
+    TRACE_I2C_DONE,             /* arg: address | tx count << 8 | rx count << 16 | bus << 24 */
+    TRACE_I2C_ERROR,            /* arg: address | I2C status code << 8 | bus << 24 */
+    TRACE_MOTOR,                /* arg: 0 stop, 1 right, 2 left (as TELEMETRY_MOTOR_xxx) */
+    TRACE_MARK,                 /* arg: free, for ad hoc markers */
+    TRACE_BOOT,                 /* arg: boot step done (boot_step_t) */
+    TRACE_EVENTS
+} trace_event_t;
+
+/* Bit of an event in the mask of trace_setMask */
+#define TRACE_BIT(id)           ((uint32_t)1U << (uint32_t)(id))
+#define TRACE_ALL               0xFFFFFFFFUL
+
+/* Stimulus port carrying the events */
+#define TRACE_ITM_PORT          1U
+
+/* Events kept in RAM when the ITM is off, power of 2 */
+#ifndef TRACE_RING_SIZE
+#define TRACE_RING_SIZE         128U
+#endif
+
+#define TRACE_RING_MAGIC        0x31435254UL    /* "TRC1" */
+
+/* One event in the RAM ring */
+typedef struct
+{
+    uint32_t time;              /* CPU cycles (DWT CYCCNT), wrapping */
+    uint32_t arg;
+    uint8_t id;                 /* trace_event_t */
+    uint8_t reserved[3];
+} trace_record_t;
+
+/* RAM ring, read with the debugger, e.g. dump binary value trace.bin trace_ring */
+typedef struct
+{
+    uint32_t magic;             /* TRACE_RING_MAGIC */
+    uint32_t cpuHz;
+    uint32_t size;              /* TRACE_RING_SIZE */
+    uint32_t written;           /* events since trace_init, next one goes to written % size */
+    trace_record_t rec[TRACE_RING_SIZE];
+} trace_ring_t;
+
+/*
+ * Tracing is only built with TRACE_ENABLE defined (compiler symbol of the
+ * project). Without it TRACE_INIT and TRACE compile to nothing.
+ */
+#ifdef TRACE_ENABLE
+
+#define TRACE_INIT()            trace_init()
+#define TRACE(id, arg)          trace_event((id), (uint32_t)(arg))
+
+void trace_init(void);
+void trace_setMask(uint32_t mask);
+void trace_event(trace_event_t id, uint32_t arg);
+
+extern trace_ring_t trace_ring;
+
+#else
+
+#define TRACE_INIT()
+#define TRACE(id, arg)
+
+#endif
+
+
+#endif /* end __TRACE_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
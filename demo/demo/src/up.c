@@ -1,1787 +0,0 @@
-const unsigned char sound_up[] = {
-    0x52, 0x49, 0x46, 0x46, 0x8A, 0x53, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45, 
-    0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 
-    0x40, 0x1F, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x64, 0x61, 0x74, 0x61, 0x65, 0x53, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7C, 0x7C, 0x7B, 0x7B, 0x7C, 0x7D, 0x7F, 0x82, 0x85, 0x87, 
-    0x88, 0x89, 0x89, 0x87, 0x86, 0x84, 0x81, 0x7E, 0x7C, 0x7B, 0x7B, 0x7B, 
-    0x7D, 0x7E, 0x81, 0x84, 0x87, 0x88, 0x8A, 0x8A, 0x89, 0x87, 0x85, 0x82, 
-    0x80, 0x7D, 0x7B, 0x79, 0x78, 0x78, 0x78, 0x77, 0x78, 0x79, 0x7A, 0x7D, 
-    0x7D, 0x7D, 0x7C, 0x7D, 0x7D, 0x7C, 0x7C, 0x7B, 0x7A, 0x7B, 0x80, 0x84, 
-    0x87, 0x92, 0x9E, 0x9B, 0x97, 0x99, 0x8E, 0x7E, 0x7A, 0x6E, 0x56, 0x4C, 
-    0x47, 0x39, 0x39, 0x46, 0x4A, 0x53, 0x6B, 0x7D, 0x8D, 0xA8, 0xBD, 0xC6, 
-    0xD5, 0xDB, 0xD4, 0xCF, 0xC6, 0xB1, 0x9E, 0x8D, 0x76, 0x66, 0x5F, 0x56, 
-    0x54, 0x5B, 0x61, 0x6B, 0x7C, 0x88, 0x92, 0x9F, 0x9F, 0xA0, 0x9B, 0x97, 
-    0x8D, 0x86, 0x7B, 0x6F, 0x68, 0x61, 0x5F, 0x5C, 0x61, 0x5E, 0x65, 0x68, 
-    0x70, 0x6F, 0x79, 0x75, 0x77, 0x78, 0x77, 0x76, 0x81, 0x89, 0x9A, 0xAB, 
-    0xAD, 0xAA, 0xAC, 0xA4, 0x95, 0x8B, 0x78, 0x59, 0x41, 0x33, 0x1E, 0x17, 
-    0x1B, 0x1D, 0x26, 0x41, 0x5B, 0x77, 0x9A, 0xB9, 0xCC, 0xE3, 0xF8, 0xFD, 
-    0xFD, 0xF8, 0xE5, 0xCC, 0xB5, 0x9C, 0x80, 0x6B, 0x58, 0x4A, 0x46, 0x4A, 
-    0x52, 0x5F, 0x6D, 0x78, 0x88, 0x8F, 0x96, 0x9A, 0x91, 0x94, 0x83, 0x85, 
-    0x74, 0x6F, 0x69, 0x5A, 0x60, 0x54, 0x5F, 0x58, 0x63, 0x64, 0x68, 0x6F, 
-    0x77, 0x77, 0x78, 0x7B, 0x7F, 0x75, 0x7F, 0x77, 0x77, 0x75, 0x79, 0x83, 
-    0x94, 0xAE, 0xBB, 0xBB, 0xC1, 0xBE, 0xB4, 0xAE, 0x9F, 0x85, 0x65, 0x4F, 
-    0x38, 0x24, 0x1D, 0x19, 0x13, 0x1F, 0x34, 0x4C, 0x6D, 0x90, 0xAA, 0xC3, 
-    0xDE, 0xEF, 0xF8, 0xFD, 0xF4, 0xE1, 0xCB, 0xB5, 0x9D, 0x87, 0x76, 0x64, 
-    0x51, 0x55, 0x53, 0x5C, 0x65, 0x6C, 0x71, 0x7A, 0x82, 0x87, 0x85, 0x87, 
-    0x7B, 0x79, 0x72, 0x70, 0x69, 0x62, 0x63, 0x5A, 0x66, 0x5E, 0x6C, 0x65, 
-    0x6E, 0x70, 0x76, 0x79, 0x7A, 0x80, 0x7A, 0x7B, 0x7A, 0x7F, 0x7C, 0x7F, 
-    0x82, 0x82, 0x84, 0x8C, 0x9B, 0xAC, 0xB9, 0xB7, 0xB7, 0xB1, 0xA9, 0xA3, 
-    0x9B, 0x89, 0x73, 0x5D, 0x4A, 0x3B, 0x34, 0x31, 0x30, 0x36, 0x43, 0x58, 
-    0x6A, 0x8B, 0x96, 0xA8, 0xB7, 0xBF, 0xCB, 0xC8, 0xCB, 0xBC, 0xB7, 0xA7, 
-    0xA2, 0x96, 0x8A, 0x83, 0x79, 0x76, 0x71, 0x72, 0x6F, 0x73, 0x72, 0x73, 
-    0x76, 0x75, 0x7E, 0x72, 0x7A, 0x71, 0x76, 0x6B, 0x78, 0x68, 0x6A, 0x6D, 
-    0x66, 0x73, 0x65, 0x72, 0x65, 0x73, 0x68, 0x7B, 0x6F, 0x76, 0x79, 0x7B, 
-    0x80, 0x81, 0x86, 0x89, 0x90, 0x87, 0x96, 0x8D, 0x96, 0x92, 0x94, 0x8F, 
-    0x94, 0x96, 0x9B, 0x9E, 0x9B, 0x97, 0x8E, 0x8A, 0x86, 0x80, 0x76, 0x6A, 
-    0x5F, 0x5D, 0x56, 0x5C, 0x5A, 0x5D, 0x5F, 0x66, 0x72, 0x7E, 0x86, 0x95, 
-    0x8C, 0x99, 0x9E, 0xA1, 0xA9, 0x9C, 0xA4, 0x93, 0xA0, 0x92, 0x96, 0x89, 
-    0x87, 0x83, 0x83, 0x80, 0x7E, 0x77, 0x7E, 0x72, 0x81, 0x78, 0x79, 0x77, 
-    0x7E, 0x73, 0x79, 0x75, 0x72, 0x70, 0x6D, 0x6D, 0x6D, 0x69, 0x63, 0x6F, 
-    0x6B, 0x6F, 0x6E, 0x6F, 0x79, 0x7E, 0x7B, 0x80, 0x85, 0x89, 0x8C, 0x87, 
-    0x96, 0x84, 0x92, 0x8F, 0x88, 0x91, 0x87, 0x88, 0x8B, 0x86, 0x90, 0x8C, 
-    0x92, 0x94, 0x8B, 0x90, 0x89, 0x86, 0x81, 0x80, 0x75, 0x71, 0x70, 0x6D, 
-    0x6D, 0x68, 0x6D, 0x6C, 0x73, 0x72, 0x7C, 0x79, 0x84, 0x84, 0x8A, 0x8A, 
-    0x90, 0x8D, 0x94, 0x8E, 0x92, 0x91, 0x90, 0x8C, 0x8E, 0x8A, 0x85, 0x89, 
-    0x84, 0x81, 0x87, 0x83, 0x7A, 0x83, 0x78, 0x7E, 0x74, 0x7B, 0x74, 0x72, 
-    0x6F, 0x72, 0x6E, 0x70, 0x6C, 0x6F, 0x6F, 0x6D, 0x78, 0x72, 0x79, 0x76, 
-    0x80, 0x7A, 0x86, 0x81, 0x85, 0x83, 0x87, 0x86, 0x85, 0x8C, 0x84, 0x88, 
-    0x83, 0x8A, 0x89, 0x8B, 0x87, 0x88, 0x84, 0x8C, 0x86, 0x8A, 0x86, 0x8D, 
-    0x89, 0x8A, 0x89, 0x85, 0x83, 0x7D, 0x81, 0x78, 0x7D, 0x73, 0x78, 0x6F, 
-    0x74, 0x6F, 0x75, 0x6D, 0x7A, 0x6F, 0x7D, 0x81, 0x7A, 0x86, 0x81, 0x8C, 
-    0x8E, 0x91, 0x8A, 0x96, 0x8F, 0x95, 0x8E, 0x94, 0x89, 0x8D, 0x85, 0x80, 
-    0x83, 0x77, 0x80, 0x72, 0x78, 0x74, 0x75, 0x72, 0x75, 0x69, 0x7A, 0x6F, 
-    0x7E, 0x6E, 0x7D, 0x70, 0x7F, 0x7A, 0x7D, 0x79, 0x7A, 0x7A, 0x83, 0x80, 
-    0x7D, 0x80, 0x7E, 0x88, 0x81, 0x88, 0x7E, 0x8D, 0x82, 0x89, 0x87, 0x87, 
-    0x88, 0x86, 0x86, 0x88, 0x8C, 0x85, 0x8B, 0x8C, 0x85, 0x92, 0x7F, 0x8C, 
-    0x80, 0x83, 0x7B, 0x7E, 0x71, 0x76, 0x6F, 0x70, 0x72, 0x6A, 0x71, 0x71, 
-    0x75, 0x78, 0x7E, 0x7B, 0x8A, 0x83, 0x94, 0x8E, 0x8C, 0x91, 0x91, 0x94, 
-    0x93, 0x8D, 0x8E, 0x8D, 0x8C, 0x86, 0x83, 0x7E, 0x7C, 0x7F, 0x6E, 0x86, 
-    0x65, 0x7F, 0x71, 0x71, 0x78, 0x69, 0x84, 0x68, 0x79, 0x77, 0x75, 0x7D, 
-    0x74, 0x78, 0x7B, 0x7D, 0x7B, 0x81, 0x7C, 0x7D, 0x81, 0x85, 0x85, 0x7E, 
-    0x8C, 0x7D, 0x8C, 0x7F, 0x86, 0x85, 0x85, 0x8C, 0x88, 0x92, 0x8E, 0x94, 
-    0x89, 0x94, 0x89, 0x87, 0x84, 0x85, 0x78, 0x76, 0x70, 0x73, 0x6C, 0x68, 
-    0x77, 0x6A, 0x70, 0x75, 0x74, 0x7B, 0x7C, 0x85, 0x87, 0x84, 0x88, 0x96, 
-    0x87, 0x90, 0x8D, 0x8F, 0x92, 0x8C, 0x8C, 0x8F, 0x89, 0x8A, 0x83, 0x81, 
-    0x89, 0x7E, 0x7F, 0x83, 0x7C, 0x77, 0x7C, 0x71, 0x73, 0x78, 0x71, 0x77, 
-    0x68, 0x75, 0x70, 0x7A, 0x6F, 0x70, 0x81, 0x79, 0x7E, 0x7C, 0x7E, 0x80, 
-    0x7E, 0x84, 0x86, 0x7F, 0x7F, 0x82, 0x85, 0x86, 0x8C, 0x98, 0x91, 0x93, 
-    0x91, 0x8E, 0x8C, 0x8F, 0x7A, 0x85, 0x65, 0x7F, 0x5D, 0x7A, 0x5B, 0x70, 
-    0x5E, 0x74, 0x6E, 0x7A, 0x7F, 0x7C, 0x92, 0x87, 0xA1, 0x90, 0xA4, 0x93, 
-    0x9B, 0x9C, 0x92, 0x97, 0x87, 0x88, 0x84, 0x7F, 0x7D, 0x74, 0x7D, 0x67, 
-    0x7F, 0x72, 0x7D, 0x73, 0x7F, 0x7B, 0x7A, 0x7D, 0x87, 0x79, 0x84, 0x7A, 
-    0x84, 0x73, 0x85, 0x69, 0x8A, 0x65, 0x84, 0x72, 0x7A, 0x73, 0x7A, 0x75, 
-    0x83, 0x77, 0x7B, 0x7F, 0x76, 0x86, 0x6E, 0xAD, 0x91, 0xA5, 0x99, 0x9F, 
-    0x94, 0x9D, 0x93, 0x87, 0x71, 0x68, 0x59, 0x5A, 0x55, 0x4C, 0x45, 0x4E, 
-    0x55, 0x67, 0x71, 0x7D, 0x80, 0x94, 0x9E, 0xB0, 0xAE, 0xB7, 0xAD, 0xBB, 
-    0xB3, 0xB0, 0xA8, 0x98, 0x98, 0x84, 0x90, 0x70, 0x7D, 0x6B, 0x6E, 0x67, 
-    0x72, 0x68, 0x71, 0x5F, 0x7D, 0x6B, 0x79, 0x79, 0x73, 0x73, 0x7F, 0x75, 
-    0x84, 0x74, 0x78, 0x75, 0x7D, 0x7A, 0x78, 0x79, 0x79, 0x83, 0x78, 0x87, 
-    0x72, 0x83, 0x76, 0x7C, 0x6E, 0x7A, 0x6A, 0xA8, 0xCC, 0xAA, 0xB2, 0xBE, 
-    0xA3, 0xB9, 0xBF, 0x8B, 0x64, 0x5B, 0x43, 0x2C, 0x31, 0x1C, 0x07, 0x13, 
-    0x3B, 0x46, 0x65, 0x7A, 0x7E, 0x9B, 0xC7, 0xCA, 0xDB, 0xD3, 0xCE, 0xC9, 
-    0xD7, 0xC5, 0xB4, 0xAD, 0x96, 0x8C, 0x88, 0x84, 0x69, 0x67, 0x67, 0x62, 
-    0x6A, 0x6B, 0x5F, 0x68, 0x6D, 0x6A, 0x71, 0x71, 0x6C, 0x74, 0x73, 0x7A, 
-    0x71, 0x79, 0x73, 0x77, 0x76, 0x7C, 0x72, 0x7A, 0x7F, 0x83, 0x7C, 0x7E, 
-    0x8E, 0x82, 0x7F, 0x82, 0x7D, 0x80, 0x71, 0x6A, 0x66, 0xBE, 0xF4, 0xAB, 
-    0xC3, 0xD9, 0xA5, 0xC8, 0xD1, 0x7D, 0x53, 0x4E, 0x3C, 0x27, 0x2C, 0x15, 
-    0x03, 0x21, 0x46, 0x4F, 0x6E, 0x7E, 0x88, 0xA3, 0xD0, 0xD5, 0xCB, 0xD1, 
-    0xCD, 0xC8, 0xCD, 0xBD, 0x96, 0x88, 0x8E, 0x84, 0x85, 0x74, 0x62, 0x5F, 
-    0x70, 0x79, 0x6E, 0x76, 0x61, 0x6D, 0x7C, 0x81, 0x65, 0x66, 0x66, 0x6C, 
-    0x77, 0x74, 0x5F, 0x69, 0x77, 0x7B, 0x85, 0x72, 0x73, 0x80, 0x8B, 0x94, 
-    0x7D, 0x89, 0x79, 0x90, 0x80, 0x89, 0x73, 0x6C, 0x72, 0x67, 0x7E, 0xFD, 
-    0xCA, 0x9C, 0xDC, 0xC2, 0xA5, 0xCF, 0x96, 0x49, 0x40, 0x47, 0x21, 0x1A, 
-    0x1B, 0x03, 0x0B, 0x43, 0x54, 0x5D, 0x83, 0x98, 0xA9, 0xCC, 0xEB, 0xD5, 
-    0xD5, 0xD8, 0xCD, 0xC0, 0xC1, 0x99, 0x7C, 0x7A, 0x79, 0x67, 0x72, 0x6B, 
-    0x61, 0x72, 0x88, 0x85, 0x95, 0x8D, 0x7E, 0x7F, 0x83, 0x6C, 0x5D, 0x52, 
-    0x49, 0x4A, 0x5B, 0x56, 0x4C, 0x64, 0x72, 0x74, 0x86, 0x8A, 0x81, 0x96, 
-    0x9F, 0x93, 0x8C, 0x97, 0x90, 0x89, 0x7D, 0x6E, 0x7A, 0x70, 0x6C, 0x55, 
-    0x97, 0xFD, 0xBC, 0xA3, 0xD8, 0xB1, 0xB1, 0xC9, 0x7C, 0x37, 0x45, 0x3F, 
-    0x20, 0x1C, 0x15, 0x03, 0x26, 0x5A, 0x5D, 0x69, 0x8F, 0xA2, 0xBD, 0xE0, 
-    0xDD, 0xC7, 0xCC, 0xCE, 0xBA, 0xAF, 0x9B, 0x78, 0x70, 0x79, 0x6D, 0x62, 
-    0x68, 0x69, 0x7C, 0xA7, 0xAB, 0x91, 0x92, 0x93, 0x88, 0x85, 0x6B, 0x47, 
-    0x42, 0x54, 0x48, 0x40, 0x40, 0x4C, 0x60, 0x7C, 0x7D, 0x80, 0x8C, 0x97, 
-    0x95, 0xA4, 0x8E, 0x75, 0x8B, 0x92, 0x80, 0x75, 0x81, 0x7C, 0x80, 0x79, 
-    0x74, 0x5F, 0x9B, 0xFD, 0xBE, 0x9F, 0xD4, 0xA8, 0xA3, 0xBA, 0x72, 0x2C, 
-    0x3A, 0x3A, 0x1A, 0x1F, 0x1C, 0x03, 0x2B, 0x66, 0x6E, 0x79, 0xA0, 0xAD, 
-    0xC1, 0xE7, 0xE2, 0xC1, 0xBE, 0xBE, 0xAB, 0xA0, 0x90, 0x6A, 0x66, 0x78, 
-    0x75, 0x70, 0x77, 0x7D, 0x81, 0xB9, 0xC1, 0x9F, 0x9D, 0x90, 0x78, 0x79, 
-    0x68, 0x35, 0x34, 0x47, 0x42, 0x4B, 0x58, 0x4B, 0x59, 0x87, 0x8D, 0x80, 
-    0x97, 0x8D, 0x8E, 0x9D, 0x9B, 0x77, 0x7B, 0x7F, 0x87, 0x7F, 0x86, 0x79, 
-    0x7C, 0x84, 0x7D, 0x70, 0x68, 0xD3, 0xFD, 0xAC, 0xCA, 0xC9, 0x95, 0xB0, 
-    0xA5, 0x4B, 0x21, 0x2F, 0x19, 0x0C, 0x1F, 0x06, 0x03, 0x3E, 0x6A, 0x74, 
-    0x97, 0xB1, 0xB5, 0xD7, 0xF5, 0xE0, 0xCA, 0xC5, 0xB3, 0xA1, 0xA3, 0x84, 
-    0x62, 0x6A, 0x73, 0x72, 0x7E, 0x86, 0x82, 0x94, 0xB2, 0xAF, 0xA2, 0x96, 
-    0x78, 0x6E, 0x6B, 0x5D, 0x3F, 0x40, 0x44, 0x4A, 0x64, 0x5D, 0x5D, 0x6F, 
-    0x83, 0x86, 0x88, 0x8D, 0x80, 0x84, 0x8A, 0x88, 0x76, 0x7C, 0x76, 0x85, 
-    0x88, 0x85, 0x7F, 0x85, 0x84, 0x81, 0x84, 0x7A, 0x65, 0xCF, 0xFD, 0xBA, 
-    0xCA, 0xC0, 0x91, 0x9E, 0x9C, 0x4A, 0x15, 0x21, 0x08, 0x03, 0x1E, 0x11, 
-    0x0A, 0x3E, 0x70, 0x87, 0xAC, 0xBE, 0xBC, 0xD3, 0xED, 0xE4, 0xCC, 0xBD, 
-    0xA7, 0x94, 0x99, 0x8E, 0x77, 0x75, 0x79, 0x83, 0x8D, 0x96, 0x8B, 0x93, 
-    0xAC, 0x9D, 0x8A, 0x80, 0x6B, 0x5F, 0x65, 0x62, 0x49, 0x51, 0x5B, 0x5E, 
-    0x6F, 0x6F, 0x61, 0x70, 0x84, 0x80, 0x76, 0x85, 0x81, 0x78, 0x84, 0x86, 
-    0x6D, 0x84, 0x84, 0x79, 0x8B, 0x8C, 0x81, 0x8B, 0x8B, 0x7B, 0x81, 0x83, 
-    0x7F, 0x6D, 0x79, 0xD6, 0xCF, 0xBB, 0xC5, 0xA4, 0x8D, 0x96, 0x85, 0x3F, 
-    0x25, 0x1F, 0x03, 0x15, 0x26, 0x1E, 0x24, 0x53, 0x72, 0x8F, 0xB5, 0xC4, 
-    0xB6, 0xD5, 0xDA, 0xD6, 0xC7, 0xC0, 0xA3, 0x9B, 0xA5, 0x93, 0x86, 0x8E, 
-    0x88, 0x8C, 0x97, 0x97, 0x89, 0x87, 0x73, 0x70, 0x73, 0x75, 0x5F, 0x62, 
-    0x65, 0x66, 0x71, 0x6F, 0x6D, 0x67, 0x74, 0x7A, 0x71, 0x6D, 0x77, 0x69, 
-    0x77, 0x68, 0x81, 0x69, 0x7B, 0x7C, 0x88, 0x81, 0x92, 0x7E, 0x8D, 0x8C, 
-    0x9A, 0x81, 0x7E, 0x85, 0x8B, 0x7D, 0x7D, 0x76, 0x82, 0x7E, 0x75, 0x78, 
-    0x8E, 0x9E, 0x99, 0x9D, 0x9B, 0x89, 0x84, 0x81, 0x73, 0x67, 0x5C, 0x53, 
-    0x52, 0x55, 0x5B, 0x5B, 0x6C, 0x6F, 0x7A, 0x8A, 0x99, 0x9F, 0x9A, 0xA4, 
-    0x9F, 0x9F, 0xA7, 0xB2, 0x95, 0x94, 0xA0, 0x9A, 0x91, 0x95, 0x8B, 0x83, 
-    0x92, 0x7E, 0x71, 0x84, 0x75, 0x73, 0x76, 0x7F, 0x70, 0x7C, 0x74, 0x6E, 
-    0x78, 0x75, 0x6A, 0x6F, 0x71, 0x67, 0x74, 0x6D, 0x75, 0x67, 0x7E, 0x6D, 
-    0x76, 0x79, 0x79, 0x7C, 0x80, 0x87, 0x7D, 0x83, 0x88, 0x81, 0x81, 0x7B, 
-    0x85, 0x7D, 0x89, 0x81, 0x7B, 0x85, 0x87, 0x80, 0x8A, 0x88, 0x86, 0x83, 
-    0x8B, 0x85, 0x8E, 0x85, 0x87, 0x82, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 
-    0x8C, 0x78, 0x88, 0x80, 0x7B, 0x85, 0x75, 0x78, 0x83, 0x75, 0x86, 0x6C, 
-    0x86, 0x7D, 0x83, 0x7D, 0x87, 0x80, 0x81, 0x80, 0x83, 0x88, 0x88, 0x86, 
-    0x86, 0x81, 0x8F, 0x75, 0x8E, 0x79, 0x79, 0x7D, 0x83, 0x76, 0x80, 0x77, 
-    0x80, 0x75, 0x7F, 0x75, 0x80, 0x73, 0x7A, 0x70, 0x78, 0x77, 0x7A, 0x78, 
-    0x85, 0x6F, 0x89, 0x84, 0x75, 0x88, 0x7A, 0x85, 0x7E, 0x85, 0x85, 0x83, 
-    0x80, 0x85, 0x77, 0x91, 0x7D, 0x8E, 0x7D, 0x82, 0x89, 0x86, 0x7E, 0x8F, 
-    0x81, 0x8E, 0x70, 0x94, 0x7E, 0x7D, 0x88, 0x7E, 0x86, 0x77, 0x86, 0x77, 
-    0x7A, 0x83, 0x70, 0x8C, 0x7F, 0x7F, 0x85, 0x7D, 0x8B, 0x7E, 0x8A, 0x75, 
-    0x80, 0x7F, 0x8A, 0x77, 0x83, 0x79, 0x82, 0x7D, 0x83, 0x7B, 0x80, 0x7D, 
-    0x7F, 0x79, 0x83, 0x77, 0x81, 0x77, 0x85, 0x77, 0x7A, 0x82, 0x79, 0x84, 
-    0x78, 0x7A, 0x8A, 0x7B, 0x88, 0x79, 0x88, 0x82, 0x87, 0x87, 0x82, 0x82, 
-    0x88, 0x80, 0x7E, 0x82, 0x86, 0x7D, 0x83, 0x7D, 0x87, 0x70, 0x8C, 0x7C, 
-    0x81, 0x7C, 0x7F, 0x85, 0x80, 0x81, 0x7B, 0x83, 0x7B, 0x87, 0x78, 0x82, 
-    0x80, 0x80, 0x80, 0x7B, 0x83, 0x81, 0x83, 0x78, 0x8C, 0x76, 0x87, 0x7B, 
-    0x86, 0x7E, 0x82, 0x81, 0x75, 0x87, 0x7C, 0x82, 0x7F, 0x8A, 0x76, 0x8C, 
-    0x79, 0x86, 0x82, 0x7E, 0x8A, 0x77, 0x84, 0x79, 0x88, 0x79, 0x7D, 0x7A, 
-    0x7F, 0x81, 0x7F, 0x83, 0x7D, 0x7D, 0x85, 0x7D, 0x7F, 0x82, 0x7D, 0x7E, 
-    0x81, 0x7C, 0x7F, 0x82, 0x79, 0x84, 0x79, 0x89, 0x7B, 0x8B, 0x7A, 0x83, 
-    0x85, 0x81, 0x82, 0x83, 0x82, 0x84, 0x85, 0x7F, 0x86, 0x80, 0x7F, 0x7D, 
-    0x81, 0x7C, 0x83, 0x79, 0x87, 0x7F, 0x7F, 0x82, 0x7A, 0x85, 0x7C, 0x82, 
-    0x79, 0x81, 0x7D, 0x80, 0x7D, 0x78, 0x84, 0x7E, 0x7A, 0x84, 0x7F, 0x7D, 
-    0x85, 0x80, 0x82, 0x80, 0x84, 0x7F, 0x84, 0x7E, 0x82, 0x7E, 0x89, 0x75, 
-    0x86, 0x7A, 0x8B, 0x76, 0x8B, 0x73, 0x8B, 0x74, 0x8C, 0x6F, 0x90, 0x73, 
-    0x86, 0x83, 0x83, 0x7D, 0x85, 0x7F, 0x81, 0x81, 0x7F, 0x82, 0x82, 0x80, 
-    0x7B, 0x85, 0x7F, 0x7D, 0x82, 0x7E, 0x7F, 0x7E, 0x83, 0x78, 0x83, 0x81, 
-    0x7C, 0x81, 0x7F, 0x78, 0x88, 0x7B, 0x87, 0x75, 0x89, 0x7E, 0x83, 0x7E, 
-    0x82, 0x80, 0x80, 0x7D, 0x83, 0x80, 0x82, 0x81, 0x7F, 0x82, 0x85, 0x77, 
-    0x89, 0x7A, 0x85, 0x7F, 0x82, 0x7C, 0x83, 0x7B, 0x83, 0x7B, 0x81, 0x7E, 
-    0x81, 0x83, 0x7F, 0x7F, 0x83, 0x79, 0x85, 0x81, 0x82, 0x81, 0x81, 0x80, 
-    0x7B, 0x86, 0x7E, 0x7A, 0x88, 0x7D, 0x79, 0x85, 0x7D, 0x81, 0x80, 0x7D, 
-    0x82, 0x82, 0x7B, 0x89, 0x78, 0x89, 0x75, 0x8A, 0x76, 0x8C, 0x73, 0x8A, 
-    0x78, 0x82, 0x7C, 0x82, 0x7E, 0x88, 0x74, 0x8B, 0x7B, 0x86, 0x7C, 0x86, 
-    0x7C, 0x88, 0x77, 0x86, 0x7D, 0x83, 0x7A, 0x82, 0x7B, 0x83, 0x7E, 0x82, 
-    0x7F, 0x86, 0x7D, 0x85, 0x7C, 0x84, 0x84, 0x7E, 0x87, 0x75, 0x88, 0x7D, 
-    0x82, 0x7D, 0x83, 0x7A, 0x82, 0x7E, 0x83, 0x7D, 0x7D, 0x7F, 0x7F, 0x7C, 
-    0x80, 0x83, 0x7C, 0x84, 0x7E, 0x82, 0x83, 0x7F, 0x7F, 0x82, 0x84, 0x80, 
-    0x80, 0x86, 0x79, 0x86, 0x80, 0x7E, 0x80, 0x82, 0x78, 0x8B, 0x75, 0x83, 
-    0x7D, 0x7E, 0x7D, 0x81, 0x7D, 0x87, 0x7A, 0x82, 0x82, 0x7D, 0x85, 0x80, 
-    0x83, 0x80, 0x7F, 0x87, 0x7D, 0x81, 0x82, 0x7E, 0x86, 0x7C, 0x7E, 0x81, 
-    0x82, 0x7C, 0x82, 0x79, 0x7D, 0x82, 0x7F, 0x7F, 0x7E, 0x7C, 0x7B, 0x7F, 
-    0x82, 0x7C, 0x88, 0x7F, 0x84, 0x80, 0x80, 0x83, 0x7E, 0x89, 0x7B, 0x89, 
-    0x7D, 0x83, 0x7B, 0x87, 0x7D, 0x82, 0x7B, 0x80, 0x7C, 0x84, 0x7E, 0x84, 
-    0x7C, 0x85, 0x7B, 0x7E, 0x7E, 0x81, 0x82, 0x7B, 0x82, 0x7F, 0x81, 0x7C, 
-    0x81, 0x75, 0x89, 0x7B, 0x87, 0x78, 0x81, 0x83, 0x7D, 0x89, 0x7C, 0x81, 
-    0x7F, 0x89, 0x79, 0x8B, 0x7E, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7D, 0x83, 
-    0x7A, 0x87, 0x78, 0x87, 0x7F, 0x85, 0x76, 0x87, 0x79, 0x83, 0x7D, 0x82, 
-    0x77, 0x89, 0x78, 0x86, 0x7D, 0x82, 0x7A, 0x86, 0x7B, 0x84, 0x7B, 0x81, 
-    0x80, 0x87, 0x81, 0x7D, 0x7A, 0x86, 0x79, 0x83, 0x86, 0x81, 0x7E, 0x80, 
-    0x84, 0x7C, 0x81, 0x85, 0x7C, 0x84, 0x78, 0x83, 0x84, 0x7E, 0x7E, 0x80, 
-    0x84, 0x7A, 0x84, 0x7C, 0x82, 0x7A, 0x83, 0x7F, 0x7C, 0x8B, 0x76, 0x7F, 
-    0x83, 0x82, 0x82, 0x81, 0x82, 0x7D, 0x86, 0x81, 0x7D, 0x85, 0x81, 0x79, 
-    0x86, 0x7A, 0x82, 0x80, 0x80, 0x7F, 0x7F, 0x7C, 0x81, 0x7F, 0x84, 0x81, 
-    0x80, 0x81, 0x7A, 0x81, 0x7B, 0x80, 0x7D, 0x81, 0x7F, 0x87, 0x79, 0x8A, 
-    0x7A, 0x81, 0x7E, 0x82, 0x7F, 0x88, 0x7A, 0x88, 0x7E, 0x80, 0x7C, 0x80, 
-    0x7C, 0x81, 0x7B, 0x87, 0x7C, 0x82, 0x83, 0x7E, 0x80, 0x82, 0x7E, 0x81, 
-    0x86, 0x7D, 0x81, 0x82, 0x7E, 0x80, 0x81, 0x83, 0x82, 0x85, 0x7F, 0x7F, 
-    0x7D, 0x7F, 0x7C, 0x81, 0x7F, 0x7D, 0x84, 0x80, 0x79, 0x7F, 0x7C, 0x7E, 
-    0x81, 0x84, 0x7E, 0x85, 0x7D, 0x80, 0x7C, 0x8A, 0x7C, 0x83, 0x81, 0x84, 
-    0x7E, 0x84, 0x7F, 0x82, 0x81, 0x84, 0x81, 0x82, 0x84, 0x7C, 0x84, 0x7B, 
-    0x81, 0x7B, 0x86, 0x7A, 0x80, 0x7A, 0x7E, 0x77, 0x7C, 0x79, 0x7B, 0x7B, 
-    0x80, 0x7C, 0x80, 0x7E, 0x84, 0x82, 0x84, 0x80, 0x82, 0x82, 0x81, 0x84, 
-    0x87, 0x82, 0x82, 0x83, 0x81, 0x81, 0x81, 0x81, 0x7F, 0x82, 0x7F, 0x80, 
-    0x7D, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7D, 0x7C, 0x85, 0x94, 0xAA, 0xBF, 
-    0xC7, 0xB6, 0x99, 0x73, 0x50, 0x3C, 0x39, 0x3B, 0x44, 0x4F, 0x57, 0x63, 
-    0x6E, 0x73, 0x75, 0x77, 0x75, 0x77, 0x7D, 0x86, 0x8E, 0x97, 0x99, 0x97, 
-    0x98, 0x97, 0x96, 0x9C, 0x9F, 0x9E, 0x9C, 0x96, 0x8F, 0x84, 0x84, 0x7E, 
-    0x7D, 0x77, 0x7A, 0x5A, 0x89, 0xD5, 0xFD, 0xFD, 0xFD, 0xB0, 0x5F, 0x33, 
-    0x17, 0x09, 0x2C, 0x3A, 0x34, 0x36, 0x46, 0x4A, 0x79, 0xA8, 0xB7, 0xAC, 
-    0x9C, 0x67, 0x4E, 0x5D, 0x72, 0x84, 0xA5, 0xA4, 0x97, 0x9E, 0xAE, 0xB3, 
-    0xCA, 0xCA, 0xA8, 0x83, 0x74, 0x61, 0x6E, 0x87, 0x8D, 0x86, 0x8C, 0x81, 
-    0x7E, 0x89, 0x8C, 0x7C, 0x79, 0x6F, 0x68, 0x6F, 0x7C, 0x76, 0x77, 0x78, 
-    0x75, 0x74, 0x7C, 0x76, 0x67, 0x5D, 0xA7, 0xE2, 0xFD, 0xF8, 0xD3, 0x68, 
-    0x2E, 0x18, 0x13, 0x2A, 0x51, 0x4D, 0x46, 0x4D, 0x5E, 0x77, 0xAE, 0xBE, 
-    0xAB, 0x8B, 0x68, 0x48, 0x5D, 0x81, 0x96, 0xA6, 0xAA, 0x94, 0x90, 0xA7, 
-    0xB3, 0xB6, 0xAC, 0x8A, 0x67, 0x6A, 0x7A, 0x8F, 0xA1, 0xA0, 0x85, 0x77, 
-    0x76, 0x7D, 0x8B, 0x95, 0x86, 0x73, 0x69, 0x66, 0x6B, 0x77, 0x76, 0x73, 
-    0x6B, 0x68, 0x56, 0x6C, 0xD0, 0xFD, 0xFD, 0xE6, 0xAA, 0x45, 0x21, 0x20, 
-    0x25, 0x44, 0x5D, 0x52, 0x4B, 0x5E, 0x79, 0x9B, 0xBF, 0xB4, 0x86, 0x5E, 
-    0x41, 0x41, 0x6A, 0x94, 0xA3, 0xA8, 0x9F, 0x90, 0x98, 0xB2, 0xBE, 0xBB, 
-    0x9E, 0x71, 0x56, 0x60, 0x79, 0x96, 0xA5, 0x9A, 0x81, 0x76, 0x77, 0x81, 
-    0x8B, 0x8F, 0x80, 0x75, 0x6C, 0x6E, 0x74, 0x7C, 0x7B, 0x75, 0x71, 0x6C, 
-    0x7E, 0xD2, 0xFD, 0xF8, 0xCE, 0x91, 0x33, 0x11, 0x1C, 0x2F, 0x46, 0x5E, 
-    0x57, 0x52, 0x67, 0x8B, 0xA5, 0xB5, 0xA1, 0x6F, 0x46, 0x3F, 0x50, 0x7A, 
-    0xA1, 0xAD, 0xA5, 0x9C, 0x98, 0x9E, 0xB1, 0xB4, 0xA2, 0x7F, 0x6A, 0x60, 
-    0x74, 0x8D, 0xA0, 0x9B, 0x8E, 0x7B, 0x77, 0x7B, 0x86, 0x88, 0x86, 0x7B, 
-    0x76, 0x74, 0x78, 0x7B, 0x7A, 0x79, 0x6F, 0x6D, 0x68, 0x7B, 0xCB, 0xFD, 
-    0xF8, 0xD2, 0x99, 0x3E, 0x12, 0x1D, 0x2E, 0x44, 0x5D, 0x5E, 0x58, 0x6C, 
-    0x8E, 0xA4, 0xAD, 0x9C, 0x6B, 0x44, 0x3F, 0x52, 0x76, 0x9E, 0xAC, 0xA5, 
-    0x9C, 0x9B, 0x9B, 0xAB, 0xB0, 0xA2, 0x80, 0x6B, 0x5F, 0x6F, 0x86, 0x9D, 
-    0x99, 0x8E, 0x7B, 0x75, 0x77, 0x85, 0x8A, 0x8A, 0x80, 0x79, 0x77, 0x7B, 
-    0x7F, 0x85, 0x81, 0x81, 0x7D, 0x87, 0xB5, 0xEF, 0xF9, 0xD7, 0x9C, 0x4E, 
-    0x0E, 0x05, 0x18, 0x34, 0x4E, 0x5C, 0x5A, 0x62, 0x7A, 0x92, 0x9C, 0x96, 
-    0x76, 0x55, 0x49, 0x57, 0x75, 0x99, 0xAF, 0xB1, 0xA5, 0x9B, 0x9A, 0xA0, 
-    0x9E, 0x8E, 0x7C, 0x6E, 0x71, 0x81, 0x93, 0x98, 0x93, 0x85, 0x78, 0x75, 
-    0x7F, 0x88, 0x8E, 0x8D, 0x85, 0x7A, 0x73, 0x74, 0x79, 0x7C, 0x82, 0x84, 
-    0x8D, 0xBD, 0xF1, 0xF9, 0xDA, 0xA3, 0x51, 0x10, 0x03, 0x11, 0x2D, 0x4E, 
-    0x61, 0x61, 0x6A, 0x7D, 0x8D, 0x95, 0x91, 0x75, 0x59, 0x4F, 0x59, 0x72, 
-    0x96, 0xAD, 0xB2, 0xA8, 0xA0, 0x9A, 0x9D, 0x97, 0x8C, 0x7B, 0x70, 0x6E, 
-    0x7C, 0x8C, 0x97, 0x95, 0x8C, 0x80, 0x7B, 0x7F, 0x88, 0x8D, 0x8B, 0x84, 
-    0x78, 0x72, 0x73, 0x7B, 0x7D, 0x81, 0x82, 0x89, 0xBA, 0xF2, 0xFC, 0xDE, 
-    0xA8, 0x56, 0x11, 0x03, 0x10, 0x2A, 0x4B, 0x5F, 0x5E, 0x65, 0x79, 0x89, 
-    0x93, 0x94, 0x7D, 0x61, 0x56, 0x5D, 0x71, 0x91, 0xA9, 0xAE, 0xA7, 0xA2, 
-    0x9C, 0x97, 0x90, 0x86, 0x78, 0x74, 0x79, 0x87, 0x92, 0x98, 0x92, 0x87, 
-    0x7E, 0x7E, 0x83, 0x8B, 0x90, 0x8D, 0x85, 0x79, 0x73, 0x71, 0x79, 0x79, 
-    0x7A, 0x78, 0x7B, 0xA7, 0xE9, 0xFD, 0xE9, 0xBD, 0x6E, 0x21, 0x09, 0x13, 
-    0x25, 0x43, 0x5A, 0x5A, 0x5A, 0x6E, 0x84, 0x92, 0x9B, 0x8E, 0x70, 0x5D, 
-    0x5D, 0x6C, 0x89, 0xA5, 0xAC, 0xA6, 0xA1, 0x9C, 0x94, 0x92, 0x8A, 0x7F, 
-    0x78, 0x7B, 0x83, 0x90, 0x98, 0x97, 0x8D, 0x86, 0x81, 0x85, 0x89, 0x8D, 
-    0x89, 0x81, 0x7C, 0x79, 0x79, 0x7A, 0x7F, 0x78, 0x71, 0x70, 0x75, 0xA4, 
-    0xE9, 0xFD, 0xE7, 0xBA, 0x6F, 0x24, 0x0C, 0x16, 0x28, 0x3F, 0x52, 0x52, 
-    0x50, 0x62, 0x7C, 0x90, 0x9D, 0x97, 0x7F, 0x6C, 0x69, 0x76, 0x8F, 0xA0, 
-    0xA8, 0xA7, 0xA0, 0x94, 0x8E, 0x89, 0x85, 0x80, 0x82, 0x84, 0x8B, 0x92, 
-    0x97, 0x93, 0x8F, 0x8A, 0x88, 0x8A, 0x8E, 0x8C, 0x86, 0x7D, 0x76, 0x71, 
-    0x73, 0x77, 0x79, 0x79, 0x70, 0x69, 0x64, 0x96, 0xE0, 0xFD, 0xF1, 0xD3, 
-    0x88, 0x37, 0x12, 0x15, 0x21, 0x37, 0x4B, 0x4D, 0x48, 0x53, 0x6A, 0x85, 
-    0x9E, 0xA5, 0x97, 0x83, 0x76, 0x76, 0x87, 0x97, 0xA3, 0xA6, 0xA3, 0x95, 
-    0x8C, 0x87, 0x85, 0x83, 0x85, 0x85, 0x88, 0x8E, 0x94, 0x96, 0x97, 0x94, 
-    0x8E, 0x8B, 0x8B, 0x89, 0x84, 0x7F, 0x78, 0x72, 0x70, 0x71, 0x75, 0x79, 
-    0x7C, 0x79, 0x71, 0x63, 0x5B, 0x90, 0xDE, 0xFD, 0xFB, 0xE7, 0xA0, 0x4B, 
-    0x21, 0x16, 0x11, 0x1D, 0x34, 0x31, 0x2B, 0x3A, 0x4E, 0x6A, 0x93, 0xAC, 
-    0xAE, 0xA9, 0xA1, 0x94, 0x91, 0x9A, 0x9F, 0xA1, 0xA0, 0x96, 0x89, 0x85, 
-    0x82, 0x80, 0x84, 0x86, 0x85, 0x8B, 0x93, 0x97, 0x9B, 0x9E, 0x98, 0x94, 
-    0x91, 0x8A, 0x86, 0x84, 0x7A, 0x71, 0x70, 0x6F, 0x6D, 0x74, 0x79, 0x75, 
-    0x75, 0x74, 0x6C, 0x65, 0x60, 0x72, 0x9E, 0xBA, 0xBA, 0xBE, 0xB6, 0x86, 
-    0x66, 0x65, 0x4F, 0x3E, 0x4A, 0x44, 0x2E, 0x33, 0x40, 0x3E, 0x55, 0x7A, 
-    0x86, 0x93, 0xAB, 0xAB, 0xA7, 0xB3, 0xB7, 0xB1, 0xB5, 0xB2, 0x9E, 0x91, 
-    0x8C, 0x7D, 0x77, 0x7E, 0x79, 0x78, 0x83, 0x85, 0x87, 0x92, 0x93, 0x90, 
-    0x94, 0x91, 0x88, 0x87, 0x84, 0x7A, 0x76, 0x75, 0x6F, 0x6D, 0x70, 0x6E, 
-    0x6D, 0x71, 0x6E, 0x6F, 0x71, 0x77, 0x78, 0x72, 0x6E, 0x67, 0x71, 0x8F, 
-    0x91, 0x8B, 0xA9, 0xA3, 0x84, 0x97, 0x93, 0x75, 0x80, 0x7E, 0x5D, 0x55, 
-    0x56, 0x43, 0x43, 0x5D, 0x5E, 0x64, 0x83, 0x86, 0x8C, 0xA6, 0xAA, 0xAF, 
-    0xBE, 0xB6, 0xAF, 0xAD, 0x9F, 0x94, 0x91, 0x85, 0x77, 0x73, 0x6D, 0x66, 
-    0x6F, 0x77, 0x77, 0x82, 0x89, 0x87, 0x8E, 0x92, 0x8E, 0x90, 0x8E, 0x85, 
-    0x7F, 0x7A, 0x73, 0x6F, 0x6D, 0x6A, 0x68, 0x6A, 0x6A, 0x69, 0x6D, 0x6D, 
-    0x6E, 0x6F, 0x6F, 0x88, 0xAA, 0x9B, 0xA3, 0xC9, 0xA5, 0x93, 0xAF, 0x8A, 
-    0x6C, 0x7A, 0x5E, 0x3A, 0x3D, 0x38, 0x24, 0x37, 0x4F, 0x48, 0x62, 0x80, 
-    0x7D, 0x98, 0xB2, 0xAF, 0xC2, 0xCD, 0xC2, 0xC0, 0xB9, 0xA9, 0xA0, 0x97, 
-    0x88, 0x7E, 0x79, 0x70, 0x6C, 0x76, 0x77, 0x78, 0x85, 0x85, 0x84, 0x8E, 
-    0x8E, 0x8C, 0x92, 0x8C, 0x86, 0x82, 0x78, 0x6F, 0x6B, 0x66, 0x62, 0x5F, 
-    0x60, 0x5F, 0x60, 0x66, 0x69, 0x6C, 0x72, 0x6E, 0x7F, 0xA5, 0x9C, 0x98, 
-    0xC7, 0xB5, 0x97, 0xBA, 0xA3, 0x79, 0x84, 0x71, 0x45, 0x3F, 0x3F, 0x26, 
-    0x2B, 0x47, 0x3D, 0x4A, 0x70, 0x6E, 0x82, 0xA7, 0xA6, 0xB7, 0xCB, 0xC3, 
-    0xC8, 0xC9, 0xB8, 0xAF, 0xA8, 0x98, 0x88, 0x83, 0x79, 0x6C, 0x74, 0x76, 
-    0x70, 0x7D, 0x80, 0x7B, 0x85, 0x87, 0x84, 0x8C, 0x8C, 0x87, 0x87, 0x80, 
-    0x78, 0x74, 0x6E, 0x69, 0x64, 0x63, 0x5F, 0x5F, 0x67, 0x63, 0x69, 0x71, 
-    0x6E, 0x75, 0x78, 0x6F, 0x92, 0xB2, 0x94, 0xAE, 0xD5, 0xA2, 0xA7, 0xC5, 
-    0x8B, 0x7C, 0x88, 0x58, 0x3C, 0x43, 0x2F, 0x1D, 0x38, 0x3E, 0x36, 0x5D, 
-    0x6A, 0x6C, 0x98, 0xA1, 0xA7, 0xC6, 0xC1, 0xC2, 0xCD, 0xBC, 0xB6, 0xB5, 
-    0xA1, 0x92, 0x8D, 0x82, 0x73, 0x77, 0x79, 0x6F, 0x7A, 0x7F, 0x77, 0x83, 
-    0x85, 0x80, 0x8A, 0x86, 0x81, 0x84, 0x7D, 0x77, 0x75, 0x6F, 0x6B, 0x69, 
-    0x66, 0x63, 0x62, 0x64, 0x65, 0x6A, 0x71, 0x72, 0x78, 0x7C, 0x7C, 0x7C, 
-    0x7C, 0x9E, 0xB6, 0x9B, 0xBA, 0xD6, 0x9F, 0xAD, 0xBD, 0x82, 0x7C, 0x7D, 
-    0x4C, 0x37, 0x3A, 0x25, 0x19, 0x38, 0x39, 0x38, 0x63, 0x68, 0x72, 0x9E, 
-    0xA1, 0xAD, 0xC6, 0xBE, 0xC1, 0xC5, 0xB8, 0xB0, 0xAD, 0xA1, 0x90, 0x8C, 
-    0x84, 0x75, 0x7E, 0x7F, 0x78, 0x83, 0x85, 0x7D, 0x8E, 0x86, 0x80, 0x8A, 
-    0x80, 0x80, 0x7D, 0x76, 0x70, 0x6E, 0x6B, 0x66, 0x67, 0x66, 0x60, 0x65, 
-    0x67, 0x66, 0x6F, 0x73, 0x74, 0x7C, 0x7F, 0x7F, 0x82, 0x80, 0x98, 0xB3, 
-    0x9F, 0xAF, 0xD0, 0xA8, 0xA4, 0xBA, 0x8B, 0x75, 0x7D, 0x58, 0x37, 0x3E, 
-    0x2F, 0x1A, 0x35, 0x3D, 0x36, 0x5D, 0x6B, 0x70, 0x94, 0xA1, 0xA7, 0xBB, 
-    0xBF, 0xBC, 0xBF, 0xBC, 0xAE, 0xA7, 0xA2, 0x8F, 0x8D, 0x89, 0x7A, 0x81, 
-    0x84, 0x7D, 0x87, 0x89, 0x84, 0x88, 0x89, 0x85, 0x84, 0x84, 0x7D, 0x78, 
-    0x76, 0x6D, 0x68, 0x6A, 0x64, 0x65, 0x68, 0x63, 0x65, 0x69, 0x6B, 0x71, 
-    0x77, 0x79, 0x7C, 0x7F, 0x81, 0x82, 0x86, 0x82, 0x8D, 0xAC, 0xA4, 0x9D, 
-    0xC3, 0xB2, 0x99, 0xB2, 0x9B, 0x76, 0x7A, 0x6B, 0x43, 0x3F, 0x42, 0x26, 
-    0x2F, 0x46, 0x3B, 0x4E, 0x6C, 0x6E, 0x82, 0x9B, 0xA2, 0xAB, 0xB9, 0xBC, 
-    0xB8, 0xBC, 0xB3, 0xA4, 0xA3, 0x94, 0x89, 0x8E, 0x85, 0x80, 0x88, 0x86, 
-    0x84, 0x8A, 0x8A, 0x85, 0x88, 0x89, 0x80, 0x7F, 0x7E, 0x74, 0x70, 0x6E, 
-    0x67, 0x66, 0x65, 0x63, 0x64, 0x67, 0x69, 0x6A, 0x71, 0x75, 0x77, 0x7D, 
-    0x7E, 0x7F, 0x84, 0x84, 0x85, 0x87, 0x86, 0x83, 0x86, 0x97, 0x9F, 0x93, 
-    0xA7, 0xAE, 0x94, 0x9A, 0x9D, 0x81, 0x77, 0x79, 0x61, 0x4C, 0x53, 0x46, 
-    0x3A, 0x4F, 0x51, 0x50, 0x68, 0x73, 0x79, 0x8C, 0x99, 0xA0, 0xA4, 0xB3, 
-    0xA8, 0xB3, 0xC0, 0x9E, 0xA0, 0x94, 0x89, 0x82, 0x86, 0x7F, 0x80, 0x85, 
-    0x88, 0x85, 0x94, 0x88, 0x9C, 0xA2, 0x81, 0x83, 0x74, 0x67, 0x5C, 0x5E, 
-    0x56, 0x54, 0x5D, 0x62, 0x67, 0x71, 0x76, 0x79, 0x7C, 0x86, 0x88, 0x87, 
-    0x8A, 0x84, 0x83, 0x7D, 0x7B, 0x7A, 0x7C, 0x7A, 0x7B, 0x78, 0x7D, 0x99, 
-    0xB5, 0xC0, 0xC5, 0xC9, 0xB0, 0x91, 0x8A, 0x76, 0x5C, 0x57, 0x48, 0x30, 
-    0x27, 0x2F, 0x2F, 0x43, 0x60, 0x68, 0x78, 0x8C, 0x99, 0x9F, 0xB2, 0xB2, 
-    0xB3, 0xAE, 0xAF, 0xA6, 0xA6, 0x9C, 0x8D, 0x89, 0x7D, 0x7C, 0x7E, 0x85, 
-    0x84, 0x89, 0x8A, 0x83, 0x8E, 0x89, 0x8D, 0x84, 0x84, 0x7C, 0x71, 0x78, 
-    0x6C, 0x71, 0x6E, 0x6B, 0x6A, 0x6E, 0x71, 0x74, 0x79, 0x7A, 0x7B, 0x79, 
-    0x7D, 0x7B, 0x79, 0x7D, 0x79, 0x78, 0x73, 0x6F, 0x7B, 0x8E, 0xA6, 0xA9, 
-    0xB0, 0xA8, 0x95, 0x84, 0x7E, 0x73, 0x64, 0x61, 0x50, 0x4B, 0x42, 0x4F, 
-    0x50, 0x61, 0x6C, 0x79, 0x80, 0x92, 0x99, 0xA5, 0xA6, 0xB3, 0xAB, 0xB4, 
-    0xAB, 0xAB, 0x98, 0x94, 0x83, 0x88, 0x7F, 0x80, 0x82, 0x79, 0x84, 0x7B, 
-    0x87, 0x80, 0x8F, 0x85, 0x90, 0x81, 0x84, 0x7D, 0x77, 0x74, 0x72, 0x6C, 
-    0x6D, 0x6F, 0x6E, 0x70, 0x6D, 0x74, 0x6C, 0x79, 0x6F, 0x7D, 0x73, 0x81, 
-    0x7A, 0x7B, 0x7A, 0x78, 0x7C, 0x72, 0x85, 0x6E, 0x86, 0x73, 0x87, 0x86, 
-    0x80, 0x91, 0x85, 0x96, 0x8B, 0x9D, 0x88, 0x9B, 0x7F, 0x90, 0x7A, 0x8B, 
-    0x6F, 0x8A, 0x69, 0x7E, 0x69, 0x78, 0x75, 0x74, 0x79, 0x7C, 0x80, 0x7F, 
-    0x91, 0x7D, 0x9A, 0x77, 0xA4, 0x7B, 0x9B, 0x8B, 0x89, 0x92, 0x85, 0x9C, 
-    0x79, 0x9A, 0x75, 0x90, 0x74, 0x8F, 0x71, 0x84, 0x73, 0x82, 0x71, 0x7D, 
-    0x73, 0x77, 0x6F, 0x79, 0x6D, 0x7B, 0x6F, 0x74, 0x77, 0x6E, 0x7B, 0x73, 
-    0x84, 0x71, 0x84, 0x7A, 0x80, 0x7D, 0x80, 0x7E, 0x7E, 0x7E, 0x83, 0x84, 
-    0x83, 0x88, 0x7C, 0x8F, 0x81, 0x8A, 0x89, 0x81, 0x96, 0x79, 0x92, 0x79, 
-    0x96, 0x70, 0x99, 0x68, 0x9F, 0x69, 0x9C, 0x71, 0x90, 0x73, 0x8D, 0x77, 
-    0x87, 0x7A, 0x80, 0x7D, 0x7E, 0x83, 0x76, 0x89, 0x73, 0x8A, 0x73, 0x8A, 
-    0x74, 0x91, 0x6B, 0x8E, 0x73, 0x8E, 0x74, 0x89, 0x79, 0x7B, 0x8E, 0x69, 
-    0x9D, 0x61, 0x96, 0x69, 0x8E, 0x72, 0x84, 0x81, 0x7C, 0x7D, 0x81, 0x82, 
-    0x81, 0x83, 0x78, 0x84, 0x7F, 0x7C, 0x8E, 0x6B, 0x8F, 0x71, 0x85, 0x81, 
-    0x7B, 0x81, 0x77, 0x8A, 0x7E, 0x82, 0x87, 0x7C, 0x8E, 0x76, 0x8F, 0x7A, 
-    0x88, 0x82, 0x81, 0x7B, 0x8E, 0x77, 0x8B, 0x72, 0x8B, 0x79, 0x82, 0x80, 
-    0x7D, 0x7A, 0x89, 0x70, 0x93, 0x6C, 0x8F, 0x78, 0x7B, 0x85, 0x7B, 0x82, 
-    0x7F, 0x83, 0x7E, 0x7D, 0x85, 0x82, 0x79, 0x90, 0x6B, 0x98, 0x66, 0x9F, 
-    0x5C, 0xA4, 0x5B, 0x9D, 0x69, 0x92, 0x74, 0x7F, 0x86, 0x78, 0x90, 0x6B, 
-    0x9A, 0x60, 0xA7, 0x55, 0xA9, 0x5E, 0x9F, 0x6A, 0x92, 0x73, 0x8C, 0x6E, 
-    0x93, 0x71, 0x86, 0x89, 0x6F, 0x9A, 0x62, 0xA2, 0x5F, 0x9F, 0x66, 0x98, 
-    0x6B, 0x90, 0x77, 0x7E, 0x86, 0x7D, 0x72, 0x9A, 0x60, 0x95, 0x78, 0x79, 
-    0x94, 0x66, 0x93, 0x81, 0x67, 0xA1, 0x60, 0x8D, 0x7D, 0x78, 0x86, 0x7F, 
-    0x7E, 0x7F, 0x8E, 0x5F, 0xB7, 0x42, 0xBE, 0x4E, 0xB2, 0x54, 0xAB, 0x64, 
-    0x97, 0x78, 0x7D, 0x93, 0x63, 0xA9, 0x60, 0x8F, 0x7D, 0x87, 0x6B, 0xA4, 
-    0x47, 0xBA, 0x4A, 0xA5, 0x67, 0x87, 0x83, 0x72, 0x83, 0x8B, 0x69, 0x95, 
-    0x75, 0x89, 0x71, 0x9E, 0x57, 0xAA, 0x57, 0xA5, 0x64, 0x8B, 0x89, 0x71, 
-    0x91, 0x61, 0xA4, 0x56, 0xB1, 0x51, 0xA8, 0x5D, 0x9B, 0x73, 0x7F, 0x8E, 
-    0x6E, 0x8C, 0x78, 0x8D, 0x76, 0x91, 0x71, 0x90, 0x81, 0x6B, 0xB4, 0x36, 
-    0xD9, 0x26, 0xD8, 0x2E, 0xD0, 0x37, 0xB8, 0x57, 0x98, 0x71, 0x80, 0x8C, 
-    0x60, 0xA0, 0x6A, 0x84, 0x81, 0x79, 0x89, 0x7D, 0x82, 0x78, 0x8A, 0x6C, 
-    0x9E, 0x5A, 0xAC, 0x4C, 0xB6, 0x55, 0xA1, 0x72, 0x7C, 0x89, 0x70, 0x94, 
-    0x6D, 0x99, 0x64, 0xA3, 0x57, 0xB3, 0x4E, 0xB3, 0x4A, 0xB4, 0x57, 0xA7, 
-    0x5A, 0xA3, 0x6A, 0x7F, 0x9C, 0x54, 0xAB, 0x5C, 0x97, 0x79, 0x74, 0xA1, 
-    0x4C, 0xBF, 0x3C, 0xC4, 0x41, 0xB8, 0x4A, 0xA8, 0x62, 0x96, 0x70, 0x86, 
-    0x8C, 0x54, 0xC5, 0x33, 0xCF, 0x37, 0xBB, 0x59, 0x96, 0x7A, 0x7C, 0x95, 
-    0x54, 0xC7, 0x29, 0xE2, 0x25, 0xCA, 0x3C, 0xB7, 0x5D, 0x83, 0x94, 0x4D, 
-    0xCD, 0x12, 0xFD, 0x0B, 0xD9, 0x43, 0xB6, 0x53, 0xB8, 0x40, 0xD1, 0x2B, 
-    0xC7, 0x60, 0x76, 0xAD, 0x3E, 0xD3, 0x2B, 0xC8, 0x4C, 0x97, 0x89, 0x64, 
-    0x97, 0x76, 0x77, 0x91, 0x69, 0x8F, 0x6F, 0x80, 0x8B, 0x68, 0xA5, 0x5F, 
-    0x93, 0x78, 0x88, 0x87, 0x88, 0x66, 0xAB, 0x4E, 0xA3, 0x85, 0x59, 0xB4, 
-    0x47, 0x9D, 0x8D, 0x45, 0xDE, 0x08, 0xF9, 0x1E, 0xB7, 0x85, 0x4C, 0xCC, 
-    0x3E, 0xAF, 0x66, 0x8F, 0x72, 0x8C, 0x77, 0x89, 0x6E, 0x95, 0x6E, 0x82, 
-    0x9F, 0x38, 0xEE, 0x03, 0xFB, 0x1A, 0xD1, 0x46, 0xAD, 0x57, 0xAA, 0x59, 
-    0x9B, 0x75, 0x78, 0x96, 0x5A, 0xB7, 0x38, 0xC4, 0x4B, 0x9B, 0x82, 0x64, 
-    0xAB, 0x4E, 0xA7, 0x75, 0x69, 0xA1, 0x5D, 0x9C, 0x76, 0x6F, 0xBA, 0x1D, 
-    0xE9, 0x37, 0x9A, 0xAA, 0x24, 0xFC, 0x04, 0xE5, 0x55, 0x74, 0xB8, 0x38, 
-    0xC5, 0x40, 0xC0, 0x59, 0x90, 0x7B, 0x64, 0x9F, 0x65, 0x80, 0x88, 0x6F, 
-    0x82, 0x8F, 0x73, 0x81, 0x89, 0x73, 0x9F, 0x51, 0xD5, 0x1F, 0xEE, 0x1A, 
-    0xD2, 0x49, 0x95, 0x8F, 0x47, 0xC4, 0x30, 0xD1, 0x2C, 0xC7, 0x52, 0x86, 
-    0xA3, 0x34, 0xEC, 0x05, 0xFD, 0x17, 0xC5, 0x6B, 0x75, 0xB4, 0x2E, 0xDD, 
-    0x33, 0xC2, 0x4F, 0x9F, 0x73, 0x76, 0x9D, 0x54, 0xA1, 0x74, 0x6D, 0xA0, 
-    0x58, 0xA8, 0x5E, 0x82, 0x99, 0x59, 0x9E, 0x75, 0x79, 0x81, 0x85, 0x7D, 
-    0x7D, 0x87, 0x85, 0x68, 0xAF, 0x3F, 0xE0, 0x2F, 0xA4, 0x9A, 0x47, 0xC6, 
-    0x5A, 0x86, 0x89, 0x6B, 0x91, 0x7E, 0x70, 0xAC, 0x2E, 0xF1, 0x03, 0xE8, 
-    0x42, 0x99, 0x74, 0x94, 0x4E, 0xC5, 0x31, 0xD1, 0x34, 0xC1, 0x49, 0xA0, 
-    0x74, 0x7E, 0x83, 0x7A, 0x7A, 0x8F, 0x62, 0x99, 0x77, 0x77, 0x8A, 0x80, 
-    0x77, 0x96, 0x77, 0x84, 0x82, 0x88, 0x7F, 0x78, 0x95, 0x6F, 0x99, 0x6A, 
-    0x9C, 0x74, 0x62, 0xBC, 0x43, 0xB3, 0x4E, 0xAB, 0x55, 0xA3, 0x63, 0x9B, 
-    0x56, 0xAD, 0x59, 0x9A, 0x68, 0x9E, 0x61, 0x94, 0x7B, 0x77, 0x90, 0x63, 
-    0x9F, 0x59, 0xA7, 0x56, 0xC0, 0x30, 0xD4, 0x2A, 0xD1, 0x3A, 0xC5, 0x4D, 
-    0xA2, 0x6C, 0x7D, 0x96, 0x6B, 0x8D, 0x77, 0x89, 0x6D, 0xA4, 0x41, 0xD8, 
-    0x32, 0xA9, 0x7A, 0x6E, 0x9D, 0x5E, 0xB6, 0x52, 0xA3, 0x57, 0xA9, 0x6F, 
-    0x75, 0xB4, 0x34, 0xCC, 0x36, 0xC6, 0x48, 0xAE, 0x5A, 0x99, 0x69, 0x8D, 
-    0x88, 0x61, 0xA1, 0x58, 0xAC, 0x3E, 0xC6, 0x48, 0xAA, 0x5E, 0x9B, 0x6D, 
-    0x7D, 0x90, 0x73, 0x87, 0x77, 0x93, 0x69, 0x9E, 0x61, 0xB0, 0x3B, 0xC7, 
-    0x4C, 0x9F, 0x7F, 0x6B, 0xA4, 0x45, 0xC0, 0x4A, 0xA8, 0x72, 0x86, 0x79, 
-    0x79, 0x8D, 0x7C, 0x86, 0x75, 0x91, 0x64, 0x9E, 0x74, 0x86, 0x7F, 0x6D, 
-    0x98, 0x6A, 0x95, 0x74, 0x7E, 0x81, 0x77, 0x88, 0x81, 0x7C, 0x90, 0x63, 
-    0xA3, 0x5C, 0xA4, 0x60, 0x9D, 0x73, 0x7B, 0x8F, 0x70, 0x8D, 0x77, 0x88, 
-    0x74, 0x8E, 0x6B, 0x9B, 0x62, 0xA0, 0x65, 0x92, 0x78, 0x7F, 0x87, 0x78, 
-    0x90, 0x6C, 0x9C, 0x63, 0x97, 0x6A, 0x87, 0x7D, 0x7B, 0x89, 0x73, 0x86, 
-    0x7C, 0x81, 0x80, 0x86, 0x7D, 0x81, 0x7E, 0x81, 0x7A, 0x89, 0x6D, 0x8C, 
-    0x70, 0x82, 0x84, 0x73, 0x88, 0x72, 0x85, 0x79, 0x81, 0x8C, 0x7B, 0x94, 
-    0x79, 0x94, 0x7B, 0x8A, 0x81, 0x76, 0x7C, 0x63, 0x90, 0xE2, 0xF6, 0xE5, 
-    0xF1, 0xAF, 0x74, 0x68, 0x5A, 0x3F, 0x1D, 0x27, 0x03, 0x03, 0x26, 0x40, 
-    0x5D, 0x7E, 0x9E, 0x9E, 0xAC, 0xC3, 0xC5, 0xBB, 0xBE, 0xAD, 0x8C, 0x83, 
-    0x81, 0x74, 0x74, 0x7F, 0x7C, 0x77, 0x86, 0x90, 0x8B, 0x90, 0x92, 0x84, 
-    0x7E, 0x89, 0x83, 0x82, 0x81, 0x82, 0x75, 0x77, 0x80, 0x80, 0x7F, 0x7C, 
-    0x78, 0x69, 0x6E, 0x63, 0x68, 0xD6, 0xFD, 0xDB, 0xE9, 0xC3, 0x6E, 0x64, 
-    0x61, 0x49, 0x25, 0x29, 0x1D, 0x03, 0x2D, 0x52, 0x64, 0x86, 0x9E, 0xA1, 
-    0x9B, 0xB1, 0xB9, 0xA6, 0xA0, 0x96, 0x76, 0x6A, 0x7B, 0x80, 0x84, 0x94, 
-    0x9A, 0x97, 0xA5, 0xB9, 0xB0, 0xA2, 0x99, 0x80, 0x6A, 0x6F, 0x74, 0x6D, 
-    0x71, 0x72, 0x6C, 0x6D, 0x7D, 0x83, 0x7B, 0x7B, 0x79, 0x6D, 0x71, 0x7A, 
-    0x72, 0x6B, 0x6E, 0x75, 0x76, 0x7F, 0x85, 0x81, 0x7A, 0x78, 0x70, 0x9D, 
-    0xFD, 0xFC, 0xDE, 0xD5, 0x8B, 0x53, 0x52, 0x4B, 0x30, 0x13, 0x18, 0x03, 
-    0x09, 0x4F, 0x79, 0x8A, 0xAA, 0xAB, 0xA0, 0x9C, 0xAB, 0xAA, 0x89, 0x83, 
-    0x72, 0x64, 0x75, 0x96, 0x9F, 0xA3, 0xB3, 0xB4, 0xAF, 0xB0, 0xB7, 0x96, 
-    0x7C, 0x74, 0x69, 0x65, 0x75, 0x7C, 0x7A, 0x70, 0x70, 0xA3, 0x61, 0x86, 
-    0x75, 0x7A, 0x7D, 0x56, 0x7E, 0x6D, 0x85, 0x66, 0x6A, 0x7B, 0x7C, 0x8C, 
-    0x78, 0x7F, 0x78, 0x77, 0x72, 0x67, 0x77, 0xCD, 0xFD, 0xDD, 0xCF, 0xAD, 
-    0x65, 0x50, 0x4F, 0x40, 0x23, 0x1D, 0x1D, 0x12, 0x3E, 0x79, 0x8F, 0xA4, 
-    0xAF, 0xA4, 0x96, 0x9D, 0xA3, 0x8C, 0x7B, 0x75, 0x68, 0x6F, 0x94, 0xAB, 
-    0xAE, 0xB6, 0xB9, 0xB3, 0xB2, 0xB2, 0x9D, 0x80, 0x70, 0x68, 0x67, 0x73, 
-    0x82, 0x7F, 0x79, 0x7B, 0x79, 0x79, 0x7D, 0x7B, 0x71, 0x6A, 0x6D, 0x6F, 
-    0x72, 0x7A, 0x7B, 0x75, 0x77, 0x7B, 0x81, 0x84, 0x83, 0x7C, 0x78, 0x76, 
-    0x72, 0x70, 0x6F, 0x5F, 0x90, 0xF9, 0xFD, 0xDB, 0xC0, 0x89, 0x4F, 0x43, 
-    0x46, 0x35, 0x25, 0x21, 0x1F, 0x2A, 0x63, 0x91, 0xA2, 0xAD, 0xA4, 0x96, 
-    0x8F, 0x95, 0x94, 0x85, 0x7A, 0x71, 0x74, 0x8D, 0xA7, 0xB5, 0xB6, 0xB2, 
-    0xA7, 0xA3, 0xA8, 0xA0, 0x8A, 0x76, 0x6B, 0x6B, 0x75, 0x84, 0x88, 0x81, 
-    0x7C, 0x77, 0x76, 0x78, 0x79, 0x74, 0x6D, 0x6B, 0x6C, 0x70, 0x77, 0x78, 
-    0x79, 0x78, 0x78, 0x7C, 0x81, 0x81, 0x7C, 0x77, 0x76, 0x75, 0x79, 0x7E, 
-    0x7A, 0x75, 0x62, 0x6C, 0xD4, 0xFD, 0xE3, 0xBA, 0x91, 0x59, 0x3F, 0x4B, 
-    0x4A, 0x41, 0x35, 0x31, 0x36, 0x5D, 0x8D, 0x9E, 0xA4, 0x97, 0x8A, 0x83, 
-    0x89, 0x94, 0x8F, 0x82, 0x75, 0x7C, 0x92, 0xA8, 0xB6, 0xB2, 0xA5, 0x99, 
-    0x9B, 0x9F, 0x98, 0x89, 0x7A, 0x70, 0x73, 0x7F, 0x89, 0x88, 0x80, 0x76, 
-    0x73, 0x76, 0x7C, 0x7A, 0x73, 0x6B, 0x69, 0x6D, 0x76, 0x7D, 0x7C, 0x7A, 
-    0x77, 0x78, 0x7A, 0x81, 0x82, 0x7C, 0x72, 0x70, 0x76, 0x79, 0x7F, 0x7D, 
-    0x7F, 0x73, 0x72, 0x5A, 0x8B, 0xF2, 0xFD, 0xD1, 0xA1, 0x77, 0x4A, 0x44, 
-    0x4C, 0x4B, 0x40, 0x35, 0x3B, 0x4F, 0x7D, 0x96, 0x99, 0x94, 0x88, 0x84, 
-    0x86, 0x96, 0x96, 0x88, 0x7A, 0x7F, 0x94, 0xA6, 0xB2, 0xAA, 0x9E, 0x96, 
-    0x98, 0x9A, 0x93, 0x87, 0x78, 0x72, 0x77, 0x83, 0x88, 0x85, 0x7D, 0x75, 
-    0x76, 0x7C, 0x7F, 0x7B, 0x74, 0x6F, 0x6F, 0x73, 0x77, 0x77, 0x76, 0x75, 
-    0x76, 0x7A, 0x7E, 0x7F, 0x79, 0x76, 0x74, 0x76, 0x7A, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x72, 0x72, 0x5E, 0x94, 0xFD, 0xFD, 0xC3, 0x97, 0x72, 0x53, 0x48, 
-    0x4A, 0x45, 0x32, 0x33, 0x42, 0x63, 0x8C, 0x93, 0x92, 0x90, 0x8B, 0x8B, 
-    0x8F, 0x91, 0x82, 0x73, 0x76, 0x8D, 0x9C, 0xA6, 0xA9, 0xA5, 0xA2, 0xAC, 
-    0xB8, 0xA7, 0x80, 0x6A, 0x6C, 0x77, 0x81, 0x83, 0x7B, 0x78, 0x79, 0x7F, 
-    0x84, 0x7C, 0x6F, 0x6B, 0x72, 0x7A, 0x7B, 0x75, 0x71, 0x6F, 0x75, 0x7F, 
-    0x83, 0x7F, 0x79, 0x7B, 0x7F, 0x7C, 0x78, 0x77, 0x74, 0x72, 0x76, 0x7E, 
-    0x80, 0x77, 0x6F, 0x66, 0xB9, 0xFD, 0xCE, 0x97, 0x7F, 0x6D, 0x67, 0x57, 
-    0x53, 0x3C, 0x2E, 0x47, 0x61, 0x85, 0x8D, 0x81, 0x8B, 0x92, 0x97, 0x98, 
-    0x88, 0x78, 0x6A, 0x71, 0x8B, 0x95, 0x95, 0x98, 0x9D, 0xA9, 0xB1, 0xAC, 
-    0xA4, 0x90, 0x7F, 0x7E, 0x7B, 0x7D, 0x7B, 0x73, 0x76, 0x79, 0x7F, 0x85, 
-    0x7C, 0x75, 0x73, 0x73, 0x76, 0x72, 0x6D, 0x70, 0x73, 0x7B, 0x80, 0x7D, 
-    0x7E, 0x7F, 0x7F, 0x7F, 0x7B, 0x79, 0x7A, 0x76, 0x78, 0x77, 0x78, 0x7C, 
-    0x81, 0x83, 0x7B, 0x79, 0x71, 0x95, 0xFD, 0xEA, 0x95, 0x87, 0x7F, 0x80, 
-    0x63, 0x42, 0x32, 0x18, 0x38, 0x59, 0x70, 0x80, 0x70, 0x86, 0xA6, 0xA7, 
-    0xA3, 0x86, 0x73, 0x77, 0x77, 0x86, 0x84, 0x79, 0x87, 0x97, 0xAD, 0xB6, 
-    0xA7, 0x9F, 0x96, 0x91, 0x98, 0x82, 0x72, 0x6E, 0x72, 0x7C, 0x78, 0x75, 
-    0x7A, 0x7C, 0x81, 0x82, 0x77, 0x73, 0x71, 0x70, 0x76, 0x6E, 0x71, 0x77, 
-    0x7A, 0x81, 0x81, 0x7F, 0x84, 0x80, 0x80, 0x7D, 0x76, 0x79, 0x76, 0x77, 
-    0x7B, 0x7A, 0x7C, 0x80, 0x84, 0x84, 0x7F, 0x7A, 0x83, 0xD9, 0xFD, 0xA5, 
-    0x87, 0x8A, 0x87, 0x77, 0x42, 0x2F, 0x1B, 0x2A, 0x51, 0x5A, 0x6A, 0x68, 
-    0x7C, 0xAD, 0xB4, 0xAA, 0x95, 0x7F, 0x8B, 0x86, 0x7E, 0x7A, 0x6A, 0x7E, 
-    0x96, 0xA6, 0xAF, 0xA0, 0xA4, 0xAD, 0xA7, 0xA2, 0x8A, 0x76, 0x75, 0x72, 
-    0x73, 0x6F, 0x68, 0x74, 0x7D, 0x80, 0x82, 0x78, 0x77, 0x78, 0x75, 0x75, 
-    0x6D, 0x6F, 0x78, 0x79, 0x7D, 0x7E, 0x7F, 0x85, 0x83, 0x80, 0x7D, 0x79, 
-    0x7C, 0x7C, 0x77, 0x76, 0x76, 0x7E, 0x85, 0x84, 0x83, 0x81, 0x81, 0x76, 
-    0xA3, 0xFD, 0xC5, 0x84, 0x93, 0x8E, 0x8F, 0x5D, 0x34, 0x26, 0x22, 0x4A, 
-    0x4E, 0x4F, 0x5E, 0x66, 0x9A, 0xB3, 0xA8, 0xA5, 0x8D, 0x9A, 0xA1, 0x87, 
-    0x7C, 0x6D, 0x74, 0x8D, 0x92, 0x97, 0x96, 0x98, 0xAE, 0xAE, 0xAD, 0xA2, 
-    0x7F, 0x7C, 0x7A, 0x73, 0x6C, 0x60, 0x6A, 0x79, 0x7C, 0x7E, 0x79, 0x7A, 
-    0x83, 0x7C, 0x78, 0x71, 0x71, 0x7A, 0x77, 0x74, 0x76, 0x79, 0x81, 0x83, 
-    0x7E, 0x7F, 0x7D, 0x83, 0x82, 0x7A, 0x77, 0x78, 0x7E, 0x81, 0x7F, 0x80, 
-    0x84, 0x82, 0x82, 0x75, 0xAF, 0xFD, 0xB7, 0x8D, 0x9F, 0x91, 0x8F, 0x5E, 
-    0x32, 0x1D, 0x25, 0x48, 0x3A, 0x3F, 0x51, 0x64, 0x9C, 0xA8, 0xA6, 0xAA, 
-    0x9D, 0xB2, 0xAC, 0x8F, 0x84, 0x73, 0x80, 0x88, 0x82, 0x89, 0x87, 0x99, 
-    0xAA, 0xA3, 0xA6, 0xA2, 0x9B, 0x92, 0x7D, 0x72, 0x6D, 0x66, 0x6C, 0x6C, 
-    0x6C, 0x76, 0x77, 0x7F, 0x7E, 0x79, 0x7C, 0x78, 0x78, 0x77, 0x71, 0x76, 
-    0x76, 0x77, 0x7C, 0x79, 0x7F, 0x80, 0x81, 0x83, 0x80, 0x80, 0x7D, 0x7D, 
-    0x7F, 0x7F, 0x7E, 0x81, 0x7F, 0x81, 0x76, 0xA1, 0xFD, 0xC4, 0x92, 0xAF, 
-    0x9A, 0x96, 0x75, 0x33, 0x1A, 0x24, 0x3B, 0x28, 0x28, 0x3D, 0x50, 0x8E, 
-    0x9E, 0x9B, 0xAF, 0xAE, 0xC3, 0xBF, 0x9F, 0x8E, 0x80, 0x88, 0x84, 0x74, 
-    0x78, 0x77, 0x8C, 0xA0, 0x9A, 0x9E, 0xA0, 0xA6, 0xAC, 0x94, 0x83, 0x7A, 
-    0x72, 0x6F, 0x61, 0x5F, 0x65, 0x6E, 0x77, 0x73, 0x74, 0x7D, 0x7D, 0x7E, 
-    0x78, 0x73, 0x7A, 0x79, 0x7A, 0x77, 0x76, 0x7D, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x85, 0x84, 0x81, 0x82, 0x81, 0x82, 0x83, 0x80, 0x80, 0x77, 0x98, 0xEC, 
-    0xC8, 0x93, 0xB2, 0xA5, 0x9A, 0x8A, 0x44, 0x1F, 0x2F, 0x3A, 0x20, 0x1E, 
-    0x2B, 0x39, 0x79, 0x90, 0x88, 0xA4, 0xB6, 0xC5, 0xC9, 0xB5, 0x9E, 0x91, 
-    0x98, 0x89, 0x72, 0x73, 0x6E, 0x7B, 0x8E, 0x89, 0x8E, 0x9E, 0xA8, 0xAA, 
-    0xA4, 0x97, 0x89, 0x84, 0x7F, 0x69, 0x62, 0x63, 0x63, 0x6B, 0x6C, 0x6B, 
-    0x74, 0x7C, 0x7F, 0x7C, 0x7C, 0x7C, 0x7C, 0x7E, 0x79, 0x75, 0x7A, 0x7A, 
-    0x7B, 0x7C, 0x7D, 0x80, 0x83, 0x85, 0x83, 0x82, 0x85, 0x84, 0x85, 0x86, 
-    0x80, 0x7B, 0x86, 0xC2, 0xD0, 0x98, 0xA1, 0xAE, 0x99, 0x94, 0x6D, 0x3B, 
-    0x36, 0x45, 0x31, 0x1E, 0x2C, 0x33, 0x4E, 0x79, 0x7C, 0x85, 0xA3, 0xBE, 
-    0xC1, 0xBD, 0xB8, 0xA7, 0xA7, 0xA6, 0x89, 0x79, 0x78, 0x76, 0x77, 0x7A, 
-    0x7A, 0x7D, 0x8E, 0x9E, 0x9C, 0x9A, 0x98, 0x95, 0x93, 0x86, 0x74, 0x6D, 
-    0x6D, 0x69, 0x63, 0x63, 0x68, 0x6C, 0x72, 0x73, 0x74, 0x7B, 0x81, 0x81, 
-    0x80, 0x80, 0x81, 0x81, 0x80, 0x7C, 0x7A, 0x7E, 0x81, 0x80, 0x80, 0x83, 
-    0x85, 0x86, 0x89, 0x88, 0x86, 0x85, 0x85, 0x9B, 0xBB, 0xA6, 0x8E, 0x9B, 
-    0x9D, 0x8C, 0x7E, 0x67, 0x4E, 0x4A, 0x50, 0x42, 0x34, 0x3C, 0x4A, 0x57, 
-    0x66, 0x76, 0x7F, 0x8E, 0xA5, 0xAF, 0xAD, 0xB0, 0xB2, 0xB0, 0xAA, 0xA3, 
-    0x97, 0x8B, 0x89, 0x85, 0x7D, 0x77, 0x78, 0x7C, 0x7C, 0x7F, 0x81, 0x82, 
-    0x83, 0x86, 0x85, 0x81, 0x7F, 0x7D, 0x7A, 0x78, 0x76, 0x74, 0x73, 0x74, 
-    0x75, 0x76, 0x76, 0x79, 0x79, 0x7A, 0x7B, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 
-    0x7F, 0x7F, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 
-    0x81, 0x81, 0x82, 0x81, 0x7F, 0x80, 0x82, 0x84, 0x85, 0x83, 0x82, 0x83, 
-    0x83, 0x82, 0x80, 0x7F, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 
-    0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x83, 0x85, 0x87, 0x88, 0x88, 
-    0x88, 0x89, 0x8A, 0x88, 0x87, 0x86, 0x85, 0x83, 0x82, 0x80, 0x7F, 0x7E, 
-    0x7E, 0x7C, 0x7C, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7A, 
-    0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x83, 0x83, 
-    0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 
-    0x83, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7E, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 
-    0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 
-    0x80, 0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x7E, 0x81, 0x7D, 0x86, 0x8A, 0x78, 0x7D, 0x7B, 0x7F, 0x7E, 0x80, 
-    0x7F, 0x80, 0x80, 0x81, 0x80, 0x82, 0x81, 0x83, 0x89, 0x7C, 0x7D, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 
-    0x81, 0x81, 0x7E, 0x7F, 0x7E, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 
-    0x7F, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x7F, 0x81, 0x7F, 0x81, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 
-    0x80, 0x81, 0x7F, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x81, 
-    0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x7F, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x81, 0x80, 0x7F, 
-    0x82, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x81, 
-    0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x82, 
-    0x7F, 0x7F, 0x81, 0x80, 0x81, 0x7F, 0x80, 0x81, 0x7F, 0x80, 0x81, 0x80, 
-    0x7F, 0x81, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x81, 0x80, 0x7F, 0x81, 
-    0x80, 0x7F, 0x81, 0x80, 0x7F, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 
-    0x80, 0x80, 0x81, 0x7F, 0x81, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 
-    0x81, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x81, 
-    0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7D, 0x7D, 
-    0x7C, 0x7C, 0x7C, 0x7B, 0x7B, 0x7C, 0x7C, 0x7C, 0x7E, 0x7F, 0x7F, 0x80, 
-    0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84, 0x84, 0x83, 
-    0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 
-    0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7E, 0x7D, 0x7C, 
-    0x7A, 0x78, 0x78, 0x76, 0x76, 0x75, 0x76, 0x77, 0x77, 0x79, 0x7B, 0x7D, 
-    0x7E, 0x81, 0x83, 0x85, 0x87, 0x88, 0x8A, 0x8B, 0x8B, 0x8C, 0x8B, 0x8B, 
-    0x8A, 0x89, 0x88, 0x87, 0x85, 0x83, 0x81, 0x80, 0x7E, 0x7C, 0x7C, 0x7A, 
-    0x7A, 0x79, 0x79, 0x78, 0x79, 0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 
-    0x7F, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x84, 0x84, 
-    0x84, 0x86, 0x86, 0x85, 0x86, 0x85, 0x83, 0x83, 0x81, 0x7F, 0x7D, 0x7B, 
-    0x7A, 0x78, 0x77, 0x77, 0x77, 0x76, 0x77, 0x79, 0x7A, 0x7B, 0x7E, 0x7F, 
-    0x81, 0x83, 0x85, 0x85, 0x87, 0x88, 0x88, 0x88, 0x89, 0x88, 0x88, 0x87, 
-    0x87, 0x85, 0x84, 0x84, 0x83, 0x81, 0x80, 0x7F, 0x7E, 0x7D, 0x7C, 0x7D, 
-    0x7C, 0x7C, 0x7D, 0x7F, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 
-    0x7F, 0x7E, 0x7C, 0x7A, 0x78, 0x77, 0x75, 0x74, 0x73, 0x74, 0x74, 0x75, 
-    0x77, 0x79, 0x7B, 0x7F, 0x81, 0x84, 0x87, 0x89, 0x8B, 0x8D, 0x8E, 0x8F, 
-    0x8F, 0x8E, 0x8E, 0x8D, 0x8C, 0x8B, 0x89, 0x87, 0x85, 0x83, 0x81, 0x7E, 
-    0x7C, 0x7A, 0x78, 0x77, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x77, 0x78, 
-    0x7A, 0x7C, 0x7E, 0x7F, 0x81, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 
-    0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x86, 0x86, 0x84, 
-    0x82, 0x80, 0x7E, 0x7C, 0x7A, 0x78, 0x76, 0x74, 0x73, 0x73, 0x73, 0x74, 
-    0x75, 0x77, 0x79, 0x7C, 0x7E, 0x81, 0x84, 0x86, 0x88, 0x8A, 0x8B, 0x8C, 
-    0x8C, 0x8C, 0x8B, 0x8A, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x81, 0x80, 
-    0x7F, 0x7E, 0x7D, 0x7C, 0x7C, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7F, 0x80, 0x81, 0x82, 0x84, 0x84, 0x84, 
-    0x84, 0x84, 0x83, 0x81, 0x81, 0x7F, 0x7E, 0x7C, 0x7C, 0x7A, 0x7A, 0x7A, 
-    0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x80, 0x82, 0x83, 0x85, 0x87, 0x88, 
-    0x88, 0x89, 0x89, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 
-    0x7F, 0x7D, 0x7C, 0x7B, 0x7B, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7C, 
-    0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x83, 
-    0x83, 0x84, 0x84, 0x85, 0x85, 0x84, 0x84, 0x83, 0x82, 0x80, 0x7F, 0x7D, 
-    0x7B, 0x7A, 0x79, 0x78, 0x77, 0x77, 0x77, 0x77, 0x79, 0x7A, 0x7C, 0x7D, 
-    0x80, 0x82, 0x83, 0x86, 0x87, 0x89, 0x8A, 0x8B, 0x8B, 0x8B, 0x8A, 0x8A, 
-    0x88, 0x87, 0x86, 0x84, 0x82, 0x81, 0x7F, 0x7E, 0x7C, 0x7B, 0x7B, 0x7A, 
-    0x79, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 0x7D, 0x7E, 0x7E, 0x7E, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x82, 0x83, 0x83, 0x84, 0x85, 0x85, 
-    0x85, 0x84, 0x84, 0x83, 0x81, 0x80, 0x7F, 0x7D, 0x7C, 0x7B, 0x79, 0x78, 
-    0x78, 0x78, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7E, 0x81, 0x82, 0x84, 0x86, 
-    0x87, 0x88, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x86, 0x85, 0x84, 0x83, 
-    0x81, 0x80, 0x7F, 0x7E, 0x7D, 0x7D, 0x7C, 0x7B, 0x7C, 0x7C, 0x7B, 0x7C, 
-    0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 
-    0x80, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x81, 0x80, 
-    0x7F, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x79, 0x79, 0x79, 0x7A, 0x7B, 0x7D, 
-    0x7E, 0x80, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88, 0x88, 0x89, 0x88, 0x88, 
-    0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7F, 0x7F, 0x7E, 0x7D, 0x7D, 
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7D, 
-    0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x82, 0x83, 0x83, 0x84, 0x84, 
-    0x84, 0x83, 0x83, 0x81, 0x80, 0x7F, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x79, 
-    0x79, 0x79, 0x79, 0x7B, 0x7C, 0x7D, 0x7F, 0x81, 0x83, 0x84, 0x86, 0x87, 
-    0x88, 0x89, 0x8A, 0x8A, 0x8A, 0x89, 0x88, 0x87, 0x86, 0x84, 0x83, 0x81, 
-    0x80, 0x7E, 0x7D, 0x7C, 0x7B, 0x7B, 0x7B, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C, 
-    0x7C, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 
-    0x81, 0x80, 0x7E, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x79, 0x79, 0x7A, 0x7B, 
-    0x7C, 0x7D, 0x7E, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x87, 0x88, 0x88, 
-    0x88, 0x87, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7F, 0x7E, 
-    0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x82, 
-    0x82, 0x83, 0x83, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7E, 
-    0x7D, 0x7D, 0x7C, 0x7B, 0x7B, 0x7B, 0x7B, 0x7C, 0x7C, 0x7D, 0x7E, 0x7F, 
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x85, 0x85, 
-    0x85, 0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7E, 0x7D, 
-    0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 
-    0x7E, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x85, 
-    0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
-    0x7D, 0x7D, 0x7D, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x7F, 0x8E, 0x7E, 0x82, 0x78, 0x77, 0x7D, 0x8A, 0x8A, 0x95, 
-    0x78, 0x70, 0x5B, 0x68, 0x6F, 0x8D, 0x90, 0x99, 0x89, 0x83, 0x76, 0x7E, 
-    0x85, 0x94, 0x9A, 0x9D, 0x88, 0x7C, 0x6D, 0x73, 0x72, 0x8E, 0x98, 0x92, 
-    0x84, 0x73, 0x66, 0x6F, 0x7F, 0x8B, 0x87, 0x7D, 0x6F, 0x67, 0x6B, 0x78, 
-    0x85, 0x88, 0x8B, 0x83, 0x7A, 0x84, 0x84, 0x8A, 0x83, 0x85, 0x7B, 0x7D, 
-    0x7A, 0x81, 0x80, 0x85, 0x80, 0x7F, 0x7A, 0x7B, 0x7D, 0x7F, 0x81, 0x82, 
-    0x80, 0x81, 0x7E, 0x85, 0x92, 0x92, 0x8B, 0x78, 0x65, 0x5B, 0x63, 0x72, 
-    0x87, 0x91, 0x96, 0x8A, 0x85, 0x80, 0x87, 0x8D, 0x94, 0x96, 0x8E, 0x85, 
-    0x7A, 0x79, 0x7E, 0x80, 0x89, 0x90, 0x8D, 0x80, 0x71, 0x61, 0x56, 0x5E, 
-    0x6C, 0x78, 0x80, 0x87, 0x80, 0x7E, 0x7E, 0x88, 0x8E, 0x94, 0x95, 0x8F, 
-    0x85, 0x80, 0x80, 0x81, 0x84, 0x86, 0x86, 0x81, 0x7C, 0x7D, 0x7A, 0x7E, 
-    0x81, 0x84, 0x7E, 0x7D, 0x78, 0x77, 0x77, 0x7A, 0x7C, 0x7D, 0x7D, 0x79, 
-    0x79, 0x79, 0x7D, 0x80, 0x83, 0x85, 0x81, 0x8B, 0x80, 0x84, 0x7E, 0x7E, 
-    0x7B, 0x84, 0x81, 0x82, 0x7F, 0x82, 0x81, 0x7F, 0x88, 0x87, 0x85, 0x88, 
-    0x86, 0x86, 0x85, 0x8B, 0x81, 0x82, 0x7C, 0x77, 0x6F, 0x74, 0x74, 0x76, 
-    0x77, 0x7D, 0x7D, 0x83, 0x8D, 0x95, 0x9C, 0xAC, 0xB1, 0xAE, 0xAE, 0x98, 
-    0x88, 0x75, 0x62, 0x58, 0x4A, 0x41, 0x3C, 0x36, 0x37, 0x42, 0x4F, 0x6A, 
-    0x7D, 0x92, 0x9F, 0xA3, 0xAB, 0xB3, 0xB5, 0xBA, 0xB4, 0xAC, 0x9A, 0x89, 
-    0x79, 0x6C, 0x6B, 0x69, 0x6E, 0x6E, 0x70, 0x74, 0x7C, 0x85, 0x8C, 0x91, 
-    0x92, 0x8E, 0x85, 0x80, 0x7C, 0x79, 0x78, 0x72, 0x72, 0x74, 0x75, 0x79, 
-    0x7F, 0x81, 0x83, 0x85, 0x8D, 0x98, 0xAE, 0xDA, 0xDA, 0xD9, 0xD2, 0xA2, 
-    0x7E, 0x5D, 0x44, 0x30, 0x1D, 0x17, 0x10, 0x03, 0x13, 0x29, 0x3E, 0x6B, 
-    0x90, 0xAF, 0xC3, 0xCE, 0xD7, 0xCE, 0xC9, 0xC8, 0xB6, 0xA2, 0x92, 0x7F, 
-    0x6F, 0x67, 0x69, 0x6C, 0x75, 0x82, 0x85, 0x8F, 0x9A, 0xA4, 0x9F, 0x9C, 
-    0x92, 0x7B, 0x6C, 0x60, 0x5A, 0x59, 0x5F, 0x65, 0x66, 0x6A, 0x6E, 0x72, 
-    0x77, 0x86, 0x8D, 0x90, 0x94, 0x90, 0x87, 0x7F, 0x88, 0x92, 0xC6, 0xED, 
-    0xE4, 0xF8, 0xCC, 0x94, 0x6B, 0x3C, 0x2E, 0x16, 0x13, 0x16, 0x03, 0x03, 
-    0x16, 0x24, 0x49, 0x7C, 0xA2, 0xC7, 0xD3, 0xE0, 0xD8, 0xC3, 0xC3, 0xB3, 
-    0xA5, 0x9B, 0x8A, 0x75, 0x61, 0x5F, 0x66, 0x6E, 0x86, 0x9D, 0xA6, 0xAE, 
-    0xA9, 0xA7, 0x99, 0x94, 0x8F, 0x7E, 0x77, 0x61, 0x54, 0x48, 0x45, 0x53, 
-    0x5B, 0x6C, 0x77, 0x7B, 0x7D, 0x7C, 0x7D, 0x82, 0x89, 0x8D, 0x90, 0x8C, 
-    0x86, 0x82, 0x82, 0x98, 0xCC, 0xDC, 0xE9, 0xF9, 0xC5, 0x98, 0x69, 0x3B, 
-    0x21, 0x08, 0x10, 0x0C, 0x03, 0x14, 0x1F, 0x2B, 0x54, 0x80, 0xA7, 0xCD, 
-    0xE2, 0xEE, 0xDA, 0xC6, 0xBA, 0x99, 0x8E, 0x87, 0x7A, 0x70, 0x67, 0x67, 
-    0x66, 0x70, 0x8B, 0xA1, 0xB0, 0xC3, 0xC2, 0xB3, 0x9E, 0x8A, 0x74, 0x63, 
-    0x67, 0x5C, 0x5C, 0x59, 0x55, 0x55, 0x54, 0x66, 0x6D, 0x7A, 0x87, 0x89, 
-    0x84, 0x82, 0x7F, 0x7B, 0x7F, 0x83, 0x8A, 0x8D, 0x97, 0xAE, 0xD4, 0xDD, 
-    0xE7, 0xF0, 0xC0, 0x9C, 0x6E, 0x3C, 0x1D, 0x03, 0x06, 0x04, 0x08, 0x1F, 
-    0x2F, 0x40, 0x64, 0x87, 0xA6, 0xC7, 0xDA, 0xE5, 0xD6, 0xC4, 0xB3, 0x8F, 
-    0x80, 0x74, 0x6C, 0x6B, 0x6B, 0x73, 0x74, 0x80, 0x93, 0xA2, 0xB2, 0xBE, 
-    0xC3, 0xB5, 0xA1, 0x8B, 0x6E, 0x5B, 0x54, 0x53, 0x54, 0x5E, 0x63, 0x64, 
-    0x67, 0x6A, 0x71, 0x73, 0x7F, 0x85, 0x84, 0x86, 0x81, 0x7D, 0x79, 0x78, 
-    0x7E, 0x86, 0x95, 0xB2, 0xDC, 0xE6, 0xEB, 0xED, 0xC2, 0x99, 0x6C, 0x3E, 
-    0x1D, 0x03, 0x04, 0x04, 0x07, 0x1C, 0x2F, 0x41, 0x62, 0x86, 0xA6, 0xC2, 
-    0xD6, 0xE3, 0xD7, 0xC5, 0xB4, 0x94, 0x7F, 0x73, 0x6B, 0x69, 0x6A, 0x74, 
-    0x7B, 0x83, 0x94, 0xA0, 0xA9, 0xB5, 0xB5, 0xAD, 0xA0, 0x8C, 0x7A, 0x63, 
-    0x5B, 0x56, 0x51, 0x5A, 0x5E, 0x67, 0x6C, 0x72, 0x78, 0x7A, 0x81, 0x83, 
-    0x84, 0x83, 0x84, 0x82, 0x80, 0x80, 0x82, 0x8B, 0x94, 0xB7, 0xD2, 0xD5, 
-    0xE6, 0xD7, 0xB3, 0x8E, 0x5D, 0x39, 0x14, 0x03, 0x08, 0x07, 0x16, 0x2E, 
-    0x3F, 0x54, 0x6E, 0x88, 0xA2, 0xB7, 0xCE, 0xDC, 0xD4, 0xCE, 0xBC, 0x9F, 
-    0x89, 0x74, 0x6A, 0x63, 0x66, 0x75, 0x7C, 0x88, 0x95, 0x9C, 0x9F, 0xA1, 
-    0xA2, 0x9D, 0x95, 0x8C, 0x7E, 0x6C, 0x61, 0x57, 0x53, 0x56, 0x5D, 0x68, 
-    0x71, 0x7A, 0x82, 0x83, 0x85, 0x87, 0x85, 0x85, 0x83, 0x85, 0x8C, 0x92, 
-    0xAB, 0xC8, 0xCE, 0xDC, 0xDA, 0xBB, 0x9B, 0x6D, 0x45, 0x20, 0x03, 0x04, 
-    0x04, 0x0D, 0x25, 0x38, 0x4A, 0x60, 0x78, 0x91, 0xA6, 0xBE, 0xD4, 0xD8, 
-    0xD6, 0xCF, 0xB6, 0x9D, 0x85, 0x74, 0x69, 0x64, 0x6E, 0x78, 0x7F, 0x8B, 
-    0x93, 0x95, 0x96, 0x97, 0x98, 0x92, 0x8E, 0x8B, 0x7C, 0x73, 0x69, 0x61, 
-    0x5D, 0x5E, 0x65, 0x6C, 0x73, 0x7D, 0x82, 0x82, 0x86, 0x86, 0x83, 0x83, 
-    0x82, 0x82, 0x83, 0x89, 0x90, 0xA1, 0xBB, 0xC3, 0xCF, 0xCF, 0xB6, 0x9C, 
-    0x73, 0x4E, 0x2D, 0x11, 0x0F, 0x0F, 0x16, 0x29, 0x3B, 0x4A, 0x5D, 0x72, 
-    0x89, 0xA1, 0xB5, 0xCE, 0xD7, 0xD5, 0xD1, 0xBC, 0xA5, 0x8E, 0x7C, 0x72, 
-    0x6B, 0x74, 0x79, 0x7E, 0x88, 0x8A, 0x8B, 0x8B, 0x8B, 0x8B, 0x85, 0x84, 
-    0x7F, 0x75, 0x70, 0x6B, 0x68, 0x67, 0x6D, 0x73, 0x78, 0x7D, 0x83, 0x86, 
-    0x83, 0x85, 0x84, 0x7F, 0x81, 0x88, 0x91, 0xA0, 0xBF, 0xCB, 0xCF, 0xD4, 
-    0xBB, 0x9C, 0x72, 0x4C, 0x30, 0x12, 0x0E, 0x14, 0x16, 0x22, 0x33, 0x41, 
-    0x51, 0x68, 0x84, 0xA0, 0xB7, 0xCF, 0xDE, 0xD7, 0xCE, 0xBC, 0xA3, 0x8D, 
-    0x7D, 0x79, 0x75, 0x77, 0x7C, 0x7C, 0x7B, 0x7F, 0x84, 0x86, 0x8B, 0x92, 
-    0x91, 0x8A, 0x84, 0x7C, 0x71, 0x6C, 0x6C, 0x6F, 0x71, 0x77, 0x7C, 0x7B, 
-    0x7D, 0x7F, 0x7F, 0x80, 0x82, 0x83, 0x82, 0x81, 0x7E, 0x82, 0x87, 0x91, 
-    0xB6, 0xC8, 0xCC, 0xD8, 0xC2, 0xA1, 0x78, 0x51, 0x38, 0x19, 0x12, 0x1B, 
-    0x1A, 0x1E, 0x2D, 0x39, 0x45, 0x5E, 0x7E, 0xA2, 0xBB, 0xD2, 0xE3, 0xD8, 
-    0xCA, 0xBB, 0xA5, 0x93, 0x86, 0x88, 0x84, 0x7C, 0x7F, 0x7A, 0x75, 0x74, 
-    0x7B, 0x84, 0x83, 0x8C, 0x8C, 0x81, 0x7A, 0x72, 0x71, 0x6D, 0x73, 0x7D, 
-    0x7D, 0x7F, 0x81, 0x81, 0x7E, 0x7F, 0x82, 0x81, 0x81, 0x81, 0x7F, 0x7E, 
-    0x87, 0x99, 0xBB, 0xCD, 0xD0, 0xD8, 0xBB, 0x94, 0x6E, 0x46, 0x31, 0x19, 
-    0x14, 0x1B, 0x14, 0x16, 0x22, 0x31, 0x45, 0x67, 0x8E, 0xB3, 0xCA, 0xD7, 
-    0xE0, 0xCF, 0xC0, 0xB6, 0xA6, 0x9D, 0x92, 0x8F, 0x84, 0x72, 0x6E, 0x68, 
-    0x6B, 0x74, 0x86, 0x94, 0x92, 0x93, 0x8A, 0x7C, 0x74, 0x72, 0x79, 0x78, 
-    0x7D, 0x7F, 0x79, 0x76, 0x77, 0x7D, 0x7D, 0x82, 0x87, 0x84, 0x82, 0x7E, 
-    0x7A, 0x74, 0x72, 0x80, 0x91, 0xB8, 0xD4, 0xD2, 0xD5, 0xBD, 0x95, 0x73, 
-    0x50, 0x44, 0x32, 0x1E, 0x1B, 0x10, 0x04, 0x0D, 0x26, 0x43, 0x6A, 0x90, 
-    0xB3, 0xC5, 0xC6, 0xD1, 0xCE, 0xC4, 0xC5, 0xBE, 0xB1, 0xA0, 0x8D, 0x7D, 
-    0x6B, 0x65, 0x6D, 0x73, 0x7A, 0x83, 0x88, 0x83, 0x80, 0x82, 0x82, 0x80, 
-    0x81, 0x82, 0x7C, 0x76, 0x79, 0x78, 0x78, 0x7D, 0x80, 0x80, 0x7C, 0x7B, 
-    0x7E, 0x7C, 0x7A, 0x7B, 0x7A, 0x7D, 0x8E, 0xBF, 0xDC, 0xCF, 0xD5, 0xC0, 
-    0x8E, 0x6E, 0x53, 0x4C, 0x38, 0x1F, 0x22, 0x13, 0x03, 0x14, 0x34, 0x53, 
-    0x72, 0x91, 0xAE, 0xB5, 0xB2, 0xC5, 0xCF, 0xC7, 0xC8, 0xBD, 0xAC, 0x94, 
-    0x82, 0x83, 0x76, 0x71, 0x72, 0x6E, 0x6D, 0x6D, 0x7A, 0x80, 0x83, 0x89, 
-    0x89, 0x84, 0x80, 0x85, 0x87, 0x86, 0x87, 0x84, 0x7E, 0x78, 0x7A, 0x7B, 
-    0x7B, 0x7D, 0x7C, 0x7C, 0x77, 0x73, 0x82, 0xA3, 0xD3, 0xD5, 0xC4, 0xBF, 
-    0x99, 0x77, 0x67, 0x5C, 0x51, 0x2A, 0x14, 0x13, 0x03, 0x0C, 0x33, 0x4F, 
-    0x63, 0x76, 0x8A, 0xA1, 0xAE, 0xC4, 0xDE, 0xD5, 0xC6, 0xBB, 0xB0, 0xA7, 
-    0x9A, 0x96, 0x88, 0x70, 0x68, 0x68, 0x6B, 0x70, 0x7B, 0x81, 0x7C, 0x7D, 
-    0x85, 0x8B, 0x8B, 0x8E, 0x8C, 0x82, 0x7C, 0x7C, 0x7E, 0x7A, 0x7B, 0x79, 
-    0x75, 0x73, 0x74, 0x7C, 0x7A, 0x7A, 0x8C, 0xB8, 0xE2, 0xCC, 0xBD, 0xBD, 
-    0x97, 0x7E, 0x6D, 0x61, 0x45, 0x0F, 0x03, 0x0E, 0x07, 0x17, 0x3E, 0x4C, 
-    0x55, 0x6C, 0x90, 0xB0, 0xB6, 0xC9, 0xD6, 0xBF, 0xBA, 0xC3, 0xC4, 0xB1, 
-    0x99, 0x8F, 0x78, 0x6A, 0x72, 0x7A, 0x73, 0x6D, 0x77, 0x7C, 0x81, 0x8D, 
-    0x94, 0x8D, 0x86, 0x8E, 0x8D, 0x87, 0x84, 0x7D, 0x72, 0x6B, 0x6F, 0x73, 
-    0x71, 0x6E, 0x73, 0x72, 0x6D, 0x7A, 0xA6, 0xE8, 0xDC, 0xB4, 0xC5, 0xB7, 
-    0x98, 0x89, 0x6E, 0x50, 0x15, 0x03, 0x1C, 0x10, 0x07, 0x21, 0x36, 0x43, 
-    0x67, 0x90, 0xAF, 0xAE, 0xB3, 0xCD, 0xC7, 0xC3, 0xCE, 0xC0, 0xA6, 0x93, 
-    0x90, 0x81, 0x6C, 0x6E, 0x6D, 0x67, 0x6C, 0x80, 0x86, 0x84, 0x90, 0x99, 
-    0x99, 0x99, 0x9E, 0x98, 0x8A, 0x87, 0x81, 0x76, 0x6C, 0x69, 0x68, 0x60, 
-    0x63, 0x6C, 0x6A, 0x6D, 0x90, 0xD7, 0xDB, 0xAC, 0xC3, 0xCE, 0xAB, 0x8A, 
-    0x6E, 0x5B, 0x24, 0x10, 0x2D, 0x1A, 0x03, 0x1D, 0x3E, 0x4D, 0x65, 0x85, 
-    0x9D, 0xA0, 0xAD, 0xC9, 0xC3, 0xB6, 0xBC, 0xB8, 0xA7, 0x94, 0x8F, 0x82, 
-    0x72, 0x71, 0x72, 0x6F, 0x71, 0x81, 0x89, 0x8C, 0x96, 0x9E, 0x9E, 0x9C, 
-    0x9E, 0x98, 0x8D, 0x87, 0x80, 0x75, 0x6A, 0x6A, 0x65, 0x62, 0x63, 0x68, 
-    0x67, 0x6B, 0x85, 0xC1, 0xCE, 0xA0, 0xB9, 0xD5, 0xB5, 0x8C, 0x6B, 0x69, 
-    0x41, 0x20, 0x30, 0x1C, 0x03, 0x1C, 0x3F, 0x47, 0x53, 0x72, 0x94, 0x9D, 
-    0xA6, 0xC1, 0xBF, 0xBC, 0xC9, 0xC2, 0xAD, 0x9C, 0x9C, 0x8B, 0x76, 0x73, 
-    0x71, 0x6C, 0x6D, 0x7C, 0x7F, 0x82, 0x91, 0x9A, 0x9B, 0x9A, 0xA0, 0x99, 
-    0x91, 0x8D, 0x83, 0x78, 0x70, 0x6E, 0x69, 0x61, 0x63, 0x66, 0x64, 0x6D, 
-    0x92, 0xC0, 0xA7, 0xA0, 0xCE, 0xCE, 0xA2, 0x7C, 0x82, 0x74, 0x39, 0x2B, 
-    0x2E, 0x0D, 0x03, 0x23, 0x2F, 0x31, 0x4C, 0x78, 0x8B, 0x8D, 0xAA, 0xC3, 
-    0xC2, 0xC6, 0xCF, 0xCC, 0xBC, 0xAD, 0xA2, 0x8F, 0x7E, 0x72, 0x6C, 0x69, 
-    0x6C, 0x72, 0x77, 0x80, 0x8A, 0x95, 0x99, 0x9E, 0xA3, 0xA1, 0x9C, 0x92, 
-    0x8C, 0x7F, 0x7A, 0x74, 0x6B, 0x67, 0x64, 0x64, 0x62, 0x6F, 0x8F, 0x97, 
-    0x8E, 0xA2, 0xB8, 0xA8, 0x88, 0x86, 0x8B, 0x62, 0x42, 0x45, 0x37, 0x1C, 
-    0x22, 0x33, 0x35, 0x3D, 0x5B, 0x73, 0x79, 0x8C, 0xA9, 0xB4, 0xB6, 0xC0, 
-    0xC8, 0xC5, 0xBD, 0xB4, 0xA8, 0x99, 0x8C, 0x7F, 0x76, 0x72, 0x72, 0x73, 
-    0x76, 0x7C, 0x81, 0x86, 0x8B, 0x91, 0x93, 0x94, 0x93, 0x8E, 0x89, 0x85, 
-    0x80, 0x7A, 0x75, 0x70, 0x6C, 0x68, 0x69, 0x75, 0x84, 0x89, 0x8A, 0x9B, 
-    0xA4, 0x92, 0x8B, 0x93, 0x82, 0x67, 0x5F, 0x59, 0x44, 0x35, 0x3E, 0x42, 
-    0x3E, 0x4B, 0x5D, 0x64, 0x6E, 0x83, 0x95, 0x9C, 0xA5, 0xB2, 0xB6, 0xB6, 
-    0xB9, 0xB4, 0xAB, 0xA3, 0x99, 0x8D, 0x84, 0x7F, 0x7A, 0x77, 0x78, 0x78, 
-    0x78, 0x7C, 0x80, 0x83, 0x88, 0x8B, 0x8C, 0x8B, 0x8A, 0x88, 0x85, 0x80, 
-    0x7C, 0x78, 0x72, 0x6C, 0x6C, 0x76, 0x85, 0x88, 0x89, 0x99, 0x9F, 0x8F, 
-    0x8E, 0x91, 0x7E, 0x6A, 0x64, 0x5A, 0x44, 0x3B, 0x44, 0x44, 0x42, 0x51, 
-    0x5F, 0x65, 0x72, 0x86, 0x94, 0x9B, 0xA5, 0xB1, 0xB1, 0xB1, 0xB5, 0xB1, 
-    0xA6, 0x9F, 0x98, 0x8C, 0x82, 0x7F, 0x7B, 0x77, 0x78, 0x79, 0x78, 0x7A, 
-    0x7F, 0x82, 0x85, 0x89, 0x8B, 0x8A, 0x89, 0x88, 0x84, 0x81, 0x7E, 0x79, 
-    0x73, 0x71, 0x71, 0x79, 0x87, 0x89, 0x89, 0x9A, 0x9A, 0x8D, 0x8F, 0x8D, 
-    0x7B, 0x6B, 0x66, 0x5B, 0x46, 0x43, 0x4B, 0x46, 0x48, 0x57, 0x61, 0x67, 
-    0x76, 0x88, 0x92, 0x98, 0xA5, 0xAD, 0xAB, 0xAB, 0xAE, 0xAA, 0xA1, 0x9B, 
-    0x97, 0x8B, 0x82, 0x81, 0x7E, 0x79, 0x79, 0x7D, 0x7B, 0x79, 0x7F, 0x82, 
-    0x80, 0x84, 0x88, 0x86, 0x84, 0x85, 0x82, 0x7D, 0x7B, 0x7A, 0x74, 0x72, 
-    0x76, 0x77, 0x7F, 0x8C, 0x8C, 0x90, 0x9B, 0x95, 0x8F, 0x8F, 0x87, 0x79, 
-    0x6C, 0x66, 0x5A, 0x4C, 0x4E, 0x51, 0x4E, 0x55, 0x5F, 0x66, 0x6F, 0x7C, 
-    0x8A, 0x91, 0x98, 0xA2, 0xA4, 0xA4, 0xA5, 0xA2, 0x9D, 0x99, 0x96, 0x8F, 
-    0x88, 0x86, 0x84, 0x7F, 0x7E, 0x7F, 0x7E, 0x7C, 0x7E, 0x7F, 0x7E, 0x7F, 
-    0x81, 0x81, 0x80, 0x80, 0x80, 0x7D, 0x7C, 0x7C, 0x7A, 0x78, 0x7A, 0x7D, 
-    0x7C, 0x7E, 0x86, 0x8C, 0x8A, 0x8F, 0x95, 0x8C, 0x88, 0x89, 0x80, 0x75, 
-    0x70, 0x6C, 0x62, 0x5A, 0x5D, 0x5C, 0x5A, 0x62, 0x6A, 0x6F, 0x76, 0x81, 
-    0x89, 0x8D, 0x93, 0x9A, 0x99, 0x98, 0x99, 0x95, 0x90, 0x8D, 0x8C, 0x88, 
-    0x84, 0x86, 0x85, 0x82, 0x84, 0x86, 0x84, 0x84, 0x87, 0x86, 0x85, 0x87, 
-    0x86, 0x83, 0x82, 0x81, 0x7D, 0x7A, 0x79, 0x76, 0x74, 0x74, 0x73, 0x71, 
-    0x72, 0x74, 0x75, 0x76, 0x79, 0x7C, 0x7D, 0x80, 0x84, 0x85, 0x87, 0x89, 
-    0x8B, 0x8B, 0x8B, 0x8B, 0x88, 0x86, 0x85, 0x83, 0x80, 0x7F, 0x7E, 0x7B, 
-    0x7A, 0x7A, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x79, 0x7B, 
-    0x7B, 0x7B, 0x7C, 0x7E, 0x7F, 0x80, 0x81, 0x84, 0x86, 0x88, 0x8A, 0x8C, 
-    0x8E, 0x8F, 0x91, 0x92, 0x92, 0x92, 0x91, 0x8F, 0x8F, 0x8D, 0x8A, 0x87, 
-    0x83, 0x80, 0x7C, 0x78, 0x75, 0x72, 0x70, 0x6D, 0x6B, 0x6A, 0x6B, 0x6B, 
-    0x6B, 0x6D, 0x6F, 0x72, 0x74, 0x77, 0x7A, 0x7C, 0x7F, 0x84, 0x84, 0x86, 
-    0x89, 0x8A, 0x8C, 0x8D, 0x8F, 0x8D, 0x90, 0x90, 0x8F, 0x90, 0x8F, 0x8D, 
-    0x8C, 0x8A, 0x89, 0x86, 0x83, 0x82, 0x7F, 0x7D, 0x7B, 0x7A, 0x77, 0x76, 
-    0x75, 0x74, 0x74, 0x75, 0x74, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7C, 
-    0x7C, 0x7E, 0x80, 0x82, 0x83, 0x84, 0x87, 0x84, 0x88, 0x89, 0x88, 0x88, 
-    0x88, 0x88, 0x87, 0x87, 0x87, 0x85, 0x84, 0x84, 0x83, 0x80, 0x80, 0x7F, 
-    0x7E, 0x7D, 0x7E, 0x7B, 0x7D, 0x7B, 0x7C, 0x7B, 0x7C, 0x7B, 0x7B, 0x7C, 
-    0x7C, 0x7D, 0x7D, 0x7E, 0x7D, 0x7F, 0x80, 0x7F, 0x82, 0x7E, 0x85, 0x7C, 
-    0x90, 0x99, 0x86, 0x6D, 0x6F, 0x82, 0x8D, 0x9A, 0x7B, 0x6C, 0x77, 0x85, 
-    0x80, 0x7C, 0x70, 0x76, 0x7E, 0x88, 0x81, 0x7F, 0x83, 0x84, 0x93, 0x94, 
-    0x8A, 0x7B, 0x7F, 0x81, 0x81, 0x7F, 0x7D, 0x7A, 0x8D, 0x8C, 0x7D, 0x64, 
-    0x66, 0x72, 0x7F, 0x7B, 0x7B, 0x75, 0x86, 0x93, 0x97, 0x8D, 0x89, 0x88, 
-    0x8D, 0x8C, 0x85, 0x78, 0x76, 0x79, 0x7D, 0x7B, 0x73, 0x73, 0x74, 0x78, 
-    0x7C, 0x7D, 0x79, 0x80, 0x84, 0x83, 0x7E, 0x7E, 0x7C, 0x7E, 0x81, 0x82, 
-    0x81, 0x81, 0x84, 0x81, 0x85, 0x86, 0x86, 0x87, 0x8C, 0x8A, 0x84, 0x86, 
-    0x84, 0x82, 0x83, 0x83, 0x7F, 0x7F, 0x7D, 0x7E, 0x7C, 0x7C, 0x7E, 0x7B, 
-    0x7B, 0x7C, 0x7F, 0x7C, 0x7D, 0x7D, 0x7E, 0x7C, 0x7D, 0x7E, 0x7C, 0x7F, 
-    0x7F, 0x80, 0x80, 0x81, 0x81, 0x83, 0x84, 0x84, 0x83, 0x84, 0x82, 0x83, 
-    0x84, 0x81, 0x82, 0x81, 0x82, 0x80, 0x80, 0x80, 0x7D, 0x7E, 0x7E, 0x7E, 
-    0x81, 0x7E, 0x7B, 0x7F, 0x81, 0x7E, 0x80, 0x7C, 0x7D, 0x7E, 0x83, 0x81, 
-    0x7E, 0x80, 0x7F, 0x80, 0x80, 0x83, 0x80, 0x7F, 0x80, 0x82, 0x81, 0x82, 
-    0x82, 0x80, 0x81, 0x82, 0x83, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 
-    0x7E, 0x86, 0x83, 0x7B, 0x7B, 0x7B, 0x7B, 0x77, 0x7B, 0x7B, 0x7B, 0x82, 
-    0x8A, 0x8E, 0x8D, 0x8E, 0x8C, 0x87, 0x84, 0x7F, 0x77, 0x71, 0x6E, 0x6E, 
-    0x6E, 0x72, 0x75, 0x78, 0x7B, 0x80, 0x84, 0x84, 0x86, 0x86, 0x86, 0x85, 
-    0x87, 0x9C, 0x9A, 0x94, 0x96, 0x8F, 0x8B, 0x82, 0x81, 0x77, 0x68, 0x69, 
-    0x67, 0x6A, 0x6D, 0x74, 0x77, 0x76, 0x82, 0x86, 0x88, 0x88, 0x87, 0x84, 
-    0x80, 0x84, 0x84, 0x82, 0x81, 0x81, 0x7F, 0x7F, 0x83, 0x82, 0x81, 0x80, 
-    0x81, 0x7F, 0x80, 0x83, 0x85, 0x85, 0x85, 0x85, 0x83, 0x83, 0x82, 0x81, 
-    0x7E, 0x7D, 0x7C, 0x7C, 0x7C, 0x7E, 0x7D, 0x7D, 0x7C, 0x87, 0x8D, 0x8C, 
-    0x8B, 0x86, 0x81, 0x7A, 0x7A, 0x76, 0x6F, 0x6B, 0x6B, 0x6C, 0x70, 0x78, 
-    0x7D, 0x7F, 0x82, 0x85, 0x86, 0x86, 0x88, 0x86, 0x82, 0x82, 0x82, 0x82, 
-    0x7E, 0x95, 0xAC, 0xA3, 0xA6, 0x9D, 0x8E, 0x80, 0x77, 0x7B, 0x64, 0x5E, 
-    0x63, 0x5E, 0x6A, 0x74, 0x83, 0x82, 0x7E, 0x88, 0x7F, 0x7E, 0x82, 0x7D, 
-    0x79, 0x75, 0x80, 0x81, 0x82, 0x89, 0x85, 0x82, 0x7C, 0x7E, 0x7C, 0x7A, 
-    0x7E, 0x7D, 0x7E, 0x83, 0x8A, 0x8F, 0x90, 0x95, 0x91, 0x92, 0x95, 0x8C, 
-    0x85, 0x7C, 0x76, 0x6A, 0x68, 0x6D, 0x6C, 0x70, 0x72, 0x76, 0x70, 0x7B, 
-    0xA8, 0xB0, 0xAB, 0xAD, 0x95, 0x80, 0x6D, 0x73, 0x6D, 0x56, 0x61, 0x5A, 
-    0x5E, 0x70, 0x84, 0x93, 0x89, 0x8E, 0x85, 0x78, 0x7C, 0x7D, 0x7D, 0x71, 
-    0x74, 0x76, 0x79, 0x8C, 0x96, 0x95, 0x89, 0x82, 0x7A, 0x72, 0x79, 0x7B, 
-    0x7D, 0x96, 0xBC, 0xC0, 0xBD, 0xBD, 0xA4, 0x89, 0x71, 0x6D, 0x57, 0x43, 
-    0x4D, 0x49, 0x53, 0x65, 0x7D, 0x8B, 0x86, 0x92, 0x8A, 0x7E, 0x7E, 0x79, 
-    0x75, 0x6B, 0x73, 0x79, 0x79, 0x8A, 0x91, 0x92, 0x8E, 0x8E, 0x8C, 0x80, 
-    0x88, 0x86, 0x7C, 0x79, 0x7A, 0x80, 0x7F, 0x8A, 0x8E, 0x87, 0x85, 0x83, 
-    0x82, 0x7C, 0x7F, 0x7D, 0x76, 0x75, 0x79, 0x7E, 0x7F, 0x85, 0x85, 0x7E, 
-    0x79, 0x74, 0x6F, 0x75, 0xAB, 0xC0, 0xAE, 0xB4, 0x97, 0x7C, 0x68, 0x68, 
-    0x70, 0x4D, 0x57, 0x58, 0x52, 0x6B, 0x7B, 0x94, 0x87, 0x82, 0x87, 0x6F, 
-    0x78, 0x85, 0x8B, 0x83, 0x7D, 0x82, 0x7A, 0x81, 0x8E, 0x91, 0x86, 0x80, 
-    0x80, 0x78, 0x7F, 0x88, 0x86, 0x7D, 0x78, 0x77, 0x72, 0x77, 0x7D, 0x6F, 
-    0x82, 0xD7, 0xEB, 0xDD, 0xE2, 0xB1, 0x7F, 0x52, 0x56, 0x57, 0x2C, 0x45, 
-    0x46, 0x43, 0x62, 0x81, 0xA1, 0x8D, 0x88, 0x84, 0x5C, 0x5B, 0x67, 0x6A, 
-    0x6C, 0x72, 0x86, 0x89, 0x94, 0xB1, 0xAC, 0x9D, 0x91, 0x7F, 0x71, 0x68, 
-    0x77, 0x7D, 0x79, 0x94, 0xA0, 0xA4, 0xA3, 0x9C, 0x93, 0x77, 0x70, 0x6A, 
-    0x64, 0x6A, 0x6F, 0x7B, 0x7B, 0x85, 0x88, 0x86, 0x85, 0x7F, 0x7C, 0x72, 
-    0x71, 0x69, 0x65, 0x68, 0x69, 0x6F, 0x71, 0x8E, 0xE4, 0xFD, 0xDE, 0xE2, 
-    0xA2, 0x68, 0x4D, 0x41, 0x54, 0x2B, 0x3F, 0x53, 0x43, 0x73, 0x8E, 0xA4, 
-    0x9C, 0x83, 0x81, 0x5B, 0x54, 0x70, 0x6F, 0x76, 0x85, 0xA0, 0xAB, 0xA6, 
-    0xB3, 0xA1, 0x80, 0x6D, 0x67, 0x63, 0x65, 0x82, 0x8A, 0x8D, 0x95, 0x97, 
-    0x95, 0x8C, 0x90, 0x88, 0x76, 0x6A, 0x61, 0x61, 0x5F, 0x66, 0x74, 0xA7, 
-    0xFD, 0xFA, 0xE4, 0xDE, 0x8A, 0x5C, 0x3E, 0x3A, 0x40, 0x1D, 0x40, 0x47, 
-    0x42, 0x7A, 0x94, 0xA2, 0x9A, 0x82, 0x77, 0x53, 0x50, 0x73, 0x6A, 0x7B, 
-    0x92, 0x8F, 0xA4, 0xA6, 0xBF, 0xC8, 0x9F, 0x90, 0x6A, 0x54, 0x57, 0x69, 
-    0x84, 0x88, 0x96, 0x92, 0xA2, 0x9D, 0x9A, 0x9E, 0x80, 0x6F, 0x53, 0x55, 
-    0x5C, 0x66, 0x85, 0x86, 0x7B, 0x71, 0x78, 0x76, 0x87, 0xA1, 0xDF, 0xFD, 
-    0xC4, 0xC3, 0x96, 0x50, 0x4E, 0x39, 0x49, 0x38, 0x33, 0x58, 0x4B, 0x66, 
-    0x94, 0x95, 0x94, 0x88, 0x70, 0x67, 0x53, 0x6C, 0x84, 0x74, 0x98, 0x99, 
-    0x96, 0xAB, 0xB2, 0xC3, 0xA1, 0x89, 0x77, 0x57, 0x59, 0x6D, 0x8B, 0x8E, 
-    0xA4, 0xA7, 0x96, 0x90, 0x85, 0x83, 0x6A, 0x68, 0x69, 0x61, 0x6B, 0x75, 
-    0x79, 0x73, 0x7A, 0x75, 0x7A, 0x81, 0x93, 0xA5, 0xC8, 0xFD, 0xD7, 0xBB, 
-    0xA5, 0x59, 0x40, 0x2B, 0x36, 0x3E, 0x31, 0x55, 0x5C, 0x5E, 0x87, 0x98, 
-    0x94, 0x8F, 0x75, 0x6A, 0x55, 0x55, 0x80, 0x7B, 0x91, 0xAA, 0x9E, 0xAB, 
-    0xA8, 0xB0, 0xB2, 0x96, 0x88, 0x71, 0x60, 0x67, 0x7E, 0x96, 0xA1, 0xA5, 
-    0x99, 0x8A, 0x77, 0x74, 0x76, 0x6B, 0x71, 0x6D, 0x68, 0x6F, 0x75, 0x7C, 
-    0x79, 0x7B, 0x7E, 0x7E, 0x78, 0x7C, 0x7E, 0x81, 0x93, 0xC0, 0xFD, 0xE6, 
-    0xC7, 0xB5, 0x59, 0x31, 0x24, 0x2A, 0x3B, 0x33, 0x55, 0x5D, 0x59, 0x82, 
-    0x99, 0x95, 0x96, 0x7F, 0x69, 0x55, 0x50, 0x7A, 0x7E, 0x93, 0xB4, 0xA5, 
-    0xAB, 0xAB, 0xAC, 0xAB, 0x97, 0x90, 0x76, 0x63, 0x6B, 0x85, 0x99, 0xA2, 
-    0xA5, 0x8C, 0x80, 0x73, 0x75, 0x7B, 0x75, 0x7A, 0x6D, 0x64, 0x66, 0x6F, 
-    0x76, 0x7C, 0x7E, 0x79, 0x7D, 0x7A, 0x80, 0x7F, 0x7C, 0x77, 0x76, 0x80, 
-    0xB0, 0xFD, 0xE7, 0xCE, 0xC2, 0x5D, 0x35, 0x22, 0x2C, 0x44, 0x39, 0x5B, 
-    0x61, 0x55, 0x7E, 0x97, 0x96, 0x9D, 0x84, 0x70, 0x59, 0x4B, 0x7D, 0x7F, 
-    0x91, 0xB7, 0xA0, 0xA6, 0xA5, 0xA4, 0xAB, 0x92, 0x8F, 0x87, 0x6A, 0x70, 
-    0x83, 0x89, 0x92, 0x98, 0x91, 0x84, 0x7A, 0x7E, 0x7F, 0x72, 0x79, 0x74, 
-    0x64, 0x6C, 0x73, 0x7A, 0x81, 0x84, 0x81, 0x7B, 0x76, 0x7D, 0x7F, 0x7A, 
-    0x7F, 0x77, 0x6F, 0x72, 0x77, 0xA5, 0xFD, 0xEE, 0xCE, 0xC8, 0x60, 0x34, 
-    0x23, 0x28, 0x46, 0x34, 0x56, 0x62, 0x50, 0x7D, 0x9E, 0x9E, 0xA3, 0x88, 
-    0x6F, 0x57, 0x42, 0x79, 0x82, 0x8E, 0xBA, 0xA5, 0xA8, 0xA7, 0xA9, 0xB4, 
-    0x94, 0x8D, 0x83, 0x64, 0x6E, 0x8A, 0x8E, 0x93, 0x98, 0x8D, 0x7F, 0x76, 
-    0x81, 0x81, 0x72, 0x78, 0x70, 0x60, 0x6A, 0x78, 0x7C, 0x82, 0x83, 0x82, 
-    0x7C, 0x78, 0x85, 0x81, 0x78, 0x7C, 0x76, 0x71, 0x75, 0x79, 0x77, 0x77, 
-    0x88, 0xDF, 0xFD, 0xC7, 0xD5, 0x8F, 0x38, 0x2A, 0x1F, 0x40, 0x38, 0x43, 
-    0x6D, 0x56, 0x68, 0x9D, 0xA3, 0xA6, 0x99, 0x7B, 0x67, 0x3F, 0x60, 0x83, 
-    0x7D, 0xAB, 0xAE, 0xA8, 0xA6, 0xA5, 0xB9, 0xA1, 0x91, 0x8A, 0x6E, 0x63, 
-    0x7B, 0x8C, 0x90, 0x9D, 0x95, 0x88, 0x78, 0x78, 0x82, 0x74, 0x75, 0x76, 
-    0x69, 0x66, 0x72, 0x79, 0x7C, 0x7E, 0x7F, 0x7F, 0x77, 0x80, 0x86, 0x7B, 
-    0x7A, 0x77, 0x72, 0x74, 0x78, 0x80, 0x81, 0x7D, 0x7C, 0x79, 0x75, 0xB9, 
-    0xFD, 0xD1, 0xC8, 0xAC, 0x4D, 0x31, 0x1E, 0x41, 0x47, 0x38, 0x67, 0x5A, 
-    0x5A, 0x8A, 0xA9, 0xB4, 0xA3, 0x8A, 0x76, 0x45, 0x4A, 0x7B, 0x7D, 0x98, 
-    0xA5, 0xA9, 0xA6, 0x99, 0xBB, 0xB5, 0x9D, 0x91, 0x7C, 0x60, 0x5E, 0x77, 
-    0x90, 0xA5, 0xA1, 0xA4, 0x83, 0x69, 0x72, 0x6C, 0x6E, 0x6F, 0x74, 0x6C, 
-    0x6A, 0x74, 0x7E, 0x7B, 0x76, 0x80, 0x74, 0x77, 0x82, 0x86, 0x86, 0x7C, 
-    0x7A, 0x74, 0x72, 0x7D, 0x84, 0x84, 0x7F, 0x7C, 0x76, 0x74, 0x75, 0xC4, 
-    0xFD, 0xC9, 0xCB, 0xA4, 0x4C, 0x33, 0x22, 0x4B, 0x3F, 0x3A, 0x67, 0x54, 
-    0x62, 0x8B, 0xAF, 0xBB, 0x9F, 0x90, 0x75, 0x42, 0x4E, 0x75, 0x7D, 0x94, 
-    0x9B, 0xAB, 0xA4, 0x9C, 0xC4, 0xBA, 0xA4, 0x92, 0x78, 0x5E, 0x54, 0x71, 
-    0x89, 0x92, 0x9C, 0xA8, 0x93, 0x81, 0x7F, 0x6E, 0x63, 0x5F, 0x68, 0x6E, 
-    0x70, 0x7E, 0x84, 0x78, 0x76, 0x7A, 0x76, 0x79, 0x82, 0x87, 0x84, 0x7B, 
-    0x7E, 0x78, 0x71, 0x7C, 0x83, 0x82, 0x82, 0x84, 0x80, 0x7A, 0x79, 0x7A, 
-    0x78, 0xAC, 0xFD, 0xDE, 0xCA, 0xB6, 0x5E, 0x34, 0x15, 0x36, 0x3C, 0x2A, 
-    0x5A, 0x55, 0x5D, 0x7D, 0xA6, 0xC1, 0xA7, 0x9A, 0x83, 0x53, 0x49, 0x69, 
-    0x7C, 0x8D, 0x9B, 0xAC, 0xAA, 0x9C, 0xBA, 0xBD, 0xAA, 0x9A, 0x83, 0x6B, 
-    0x55, 0x66, 0x7F, 0x89, 0x93, 0x9D, 0x96, 0x8B, 0x89, 0x79, 0x6B, 0x5E, 
-    0x60, 0x65, 0x6A, 0x7B, 0x83, 0x7E, 0x77, 0x75, 0x74, 0x77, 0x80, 0x88, 
-    0x87, 0x7E, 0x7D, 0x78, 0x75, 0x7C, 0x80, 0x85, 0x83, 0x83, 0x83, 0x7F, 
-    0x82, 0x84, 0x7E, 0x77, 0x6F, 0x8E, 0xF7, 0xFC, 0xDC, 0xDC, 0x74, 0x32, 
-    0x03, 0x10, 0x35, 0x19, 0x4F, 0x53, 0x4D, 0x6C, 0x8F, 0xC5, 0xBA, 0xAF, 
-    0x9D, 0x65, 0x45, 0x56, 0x71, 0x89, 0x9B, 0xB1, 0xBF, 0x9A, 0xA0, 0xAE, 
-    0xA2, 0x9E, 0x90, 0x8C, 0x6A, 0x5F, 0x7C, 0x85, 0x8A, 0x9A, 0xA5, 0x8A, 
-    0x74, 0x72, 0x6F, 0x62, 0x64, 0x79, 0x6C, 0x6C, 0x78, 0x7D, 0x79, 0x75, 
-    0x81, 0x7B, 0x74, 0x7F, 0x86, 0x7F, 0x7C, 0x80, 0x79, 0x72, 0x77, 0x85, 
-    0x85, 0x84, 0x8D, 0x84, 0x7C, 0x7F, 0x80, 0x81, 0x7E, 0x7F, 0x73, 0xB0, 
-    0xFD, 0xD0, 0xCF, 0xAE, 0x5A, 0x28, 0x07, 0x3E, 0x2D, 0x3E, 0x64, 0x59, 
-    0x64, 0x69, 0xB7, 0xAB, 0xA0, 0xA1, 0x77, 0x5F, 0x44, 0x81, 0x85, 0x97, 
-    0xAC, 0xAC, 0xA7, 0x89, 0xB6, 0xA9, 0xA6, 0x9C, 0x8B, 0x7C, 0x58, 0x7B, 
-    0x7E, 0x8C, 0x8F, 0x99, 0x9C, 0x7E, 0x8B, 0x75, 0x69, 0x55, 0x5D, 0x66, 
-    0x5D, 0x7C, 0x7A, 0x80, 0x72, 0x76, 0x7A, 0x6E, 0x80, 0x81, 0x85, 0x7B, 
-    0x80, 0x80, 0x78, 0x80, 0x7F, 0x88, 0x80, 0x8A, 0x8B, 0x84, 0x86, 0x80, 
-    0x84, 0x7C, 0x7D, 0x7E, 0x7A, 0x6C, 0xB5, 0xFD, 0xD2, 0xDC, 0xAE, 0x67, 
-    0x20, 0x03, 0x3B, 0x1C, 0x47, 0x5F, 0x5D, 0x63, 0x5D, 0xA6, 0xA1, 0xAD, 
-    0xB3, 0x95, 0x75, 0x4F, 0x70, 0x74, 0x87, 0xA0, 0xAD, 0xA3, 0x8D, 0xA6, 
-    0xA1, 0xA7, 0xA2, 0xA0, 0x8B, 0x64, 0x72, 0x6E, 0x7B, 0x88, 0x9B, 0x9E, 
-    0x8B, 0x8A, 0x79, 0x6C, 0x5F, 0x63, 0x60, 0x5D, 0x68, 0x6F, 0x78, 0x74, 
-    0x7F, 0x7D, 0x76, 0x7C, 0x7C, 0x83, 0x7F, 0x86, 0x85, 0x7B, 0x7C, 0x7D, 
-    0x82, 0x83, 0x8B, 0x8E, 0x88, 0x83, 0x7E, 0x7E, 0x7D, 0x82, 0x84, 0x80, 
-    0x7E, 0x72, 0x77, 0xD3, 0xF6, 0xE1, 0xE9, 0x9F, 0x57, 0x03, 0x03, 0x1F, 
-    0x0F, 0x4B, 0x50, 0x60, 0x52, 0x65, 0xA1, 0x9C, 0xC3, 0xBD, 0xAD, 0x7D, 
-    0x5D, 0x6E, 0x65, 0x84, 0x99, 0xAE, 0xA3, 0x97, 0xA5, 0x9D, 0xA8, 0xA7, 
-    0xB0, 0x95, 0x7A, 0x75, 0x65, 0x6F, 0x72, 0x98, 0x9F, 0x8D, 0x89, 0x6E, 
-    0x66, 0x55, 0x66, 0x6C, 0x65, 0x6C, 0x68, 0x6E, 0x6A, 0x7B, 0x84, 0x80, 
-    0x82, 0x7D, 0x80, 0x7A, 0x85, 0x89, 0x84, 0x82, 0x7C, 0x7E, 0x79, 0x83, 
-    0x8A, 0x88, 0x88, 0x84, 0x85, 0x7D, 0x7A, 0x78, 0x6F, 0xBF, 0xF5, 0xE1, 
-    0xF6, 0xC3, 0x84, 0x31, 0x0B, 0x21, 0x03, 0x2D, 0x3F, 0x4E, 0x52, 0x4E, 
-    0x88, 0x8A, 0xAF, 0xC5, 0xC6, 0xB4, 0x81, 0x82, 0x65, 0x64, 0x76, 0x8B, 
-    0x9C, 0x91, 0xA2, 0x9D, 0x9D, 0xA3, 0xAF, 0xB4, 0x9C, 0x96, 0x7E, 0x6C, 
-    0x5F, 0x64, 0x74, 0x73, 0x89, 0x8D, 0x8E, 0x88, 0x7D, 0x7B, 0x63, 0x61, 
-    0x5B, 0x59, 0x5D, 0x61, 0x71, 0x73, 0x7C, 0x82, 0x85, 0x86, 0x83, 0x8A, 
-    0x85, 0x84, 0x83, 0x83, 0x82, 0x7E, 0x84, 0x81, 0x84, 0x85, 0x86, 0x89, 
-    0x82, 0x82, 0x76, 0x9F, 0xDB, 0xD3, 0xEE, 0xE0, 0xAF, 0x73, 0x30, 0x2C, 
-    0x03, 0x09, 0x24, 0x2D, 0x42, 0x37, 0x5F, 0x6B, 0x7E, 0xAB, 0xC0, 0xD8, 
-    0xC2, 0xBF, 0xA7, 0x81, 0x78, 0x70, 0x7B, 0x75, 0x81, 0x8B, 0x85, 0x8A, 
-    0x8E, 0x9F, 0xA2, 0xAB, 0xB2, 0xA7, 0x9A, 0x85, 0x7C, 0x6A, 0x64, 0x69, 
-    0x70, 0x77, 0x71, 0x76, 0x6F, 0x69, 0x6B, 0x6D, 0x72, 0x6E, 0x73, 0x72, 
-    0x6E, 0x71, 0x75, 0x7E, 0x80, 0x86, 0x89, 0x85, 0x85, 0x85, 0x89, 0x88, 
-    0x8A, 0x8B, 0x88, 0x86, 0x84, 0x84, 0x82, 0x82, 0x82, 0x7E, 0x80, 0x93, 
-    0xA3, 0xA5, 0xB1, 0xAB, 0x9C, 0x84, 0x6B, 0x5F, 0x48, 0x47, 0x49, 0x4D, 
-    0x50, 0x4E, 0x5B, 0x5C, 0x66, 0x76, 0x85, 0x95, 0x9B, 0xA6, 0xA5, 0xA0, 
-    0x9C, 0x98, 0x99, 0x94, 0x97, 0x96, 0x90, 0x8C, 0x87, 0x86, 0x81, 0x81, 
-    0x83, 0x82, 0x82, 0x81, 0x81, 0x7F, 0x7D, 0x7E, 0x7D, 0x7D, 0x7B, 0x7C, 
-    0x7B, 0x79, 0x79, 0x78, 0x77, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x79, 
-    0x7A, 0x7B, 0x7D, 0x7E, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83, 
-    0x81, 0x81, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 
-    0x7F, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7B, 0x7C, 
-    0x7C, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x86, 
-    0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x84, 0x82, 0x82, 0x82, 0x81, 0x80, 
-    0x80, 0x7E, 0x7E, 0x7D, 0x7C, 0x7D, 0x7D, 0x7D, 0x7C, 0x7B, 0x7C, 0x7B, 
-    0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x7F, 0x80, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x81, 
-    0x81, 0x81, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 
-    0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7F, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x7F, 0x81, 0x7F, 0x81, 0x7E, 0x83, 0x8A, 0x77, 0x84, 
-    0x7E, 0x7F, 0x7E, 0x82, 0x82, 0x74, 0x7D, 0x7C, 0x7D, 0x7D, 0x7F, 0x7F, 
-    0x81, 0x82, 0x82, 0x85, 0x84, 0x85, 0x84, 0x83, 0x94, 0x7B, 0x7F, 0x81, 
-    0x7E, 0x7C, 0x7E, 0x7C, 0x7C, 0x7E, 0x7D, 0x80, 0x7C, 0x7F, 0x82, 0x7F, 
-    0x7F, 0x80, 0x81, 0x80, 0x7F, 0x7F, 0x7E, 0x7F, 0x7E, 0x81, 0x7F, 0x83, 
-    0x80, 0x8C, 0x89, 0x74, 0x86, 0x89, 0x79, 0x71, 0x7D, 0x7A, 0x7C, 0x80, 
-    0x7F, 0x82, 0x82, 0x85, 0x84, 0x86, 0x86, 0x85, 0x83, 0x84, 0x83, 0x81, 
-    0x7F, 0x7F, 0x7F, 0x7B, 0x82, 0x84, 0x7D, 0x7A, 0x86, 0x82, 0x7E, 0x78, 
-    0x78, 0x7C, 0x7D, 0x7B, 0x89, 0x80, 0x7E, 0x70, 0x73, 0x79, 0x80, 0x7F, 
-    0x83, 0x83, 0x8A, 0x95, 0x87, 0x85, 0x7D, 0x81, 0x7C, 0x80, 0x7E, 0x7F, 
-    0x81, 0x81, 0x81, 0x84, 0x85, 0x7F, 0x85, 0x8B, 0x85, 0x83, 0x87, 0x83, 
-    0x79, 0x7C, 0x81, 0x7A, 0x83, 0x7F, 0x79, 0x7E, 0x84, 0x7D, 0x7A, 0x7D, 
-    0x7E, 0x79, 0x7D, 0x80, 0x7A, 0x7A, 0x7D, 0x7E, 0x79, 0x7C, 0x7A, 0x7D, 
-    0x7E, 0x7E, 0x7B, 0x7F, 0x80, 0x7F, 0x7F, 0x81, 0x85, 0x85, 0x81, 0x81, 
-    0x88, 0x7F, 0x85, 0x89, 0x86, 0x87, 0x84, 0x89, 0x82, 0x85, 0x87, 0x85, 
-    0x88, 0x82, 0x89, 0x84, 0x86, 0x84, 0x81, 0x84, 0x81, 0x7D, 0x7A, 0x7B, 
-    0x79, 0x7D, 0x7E, 0x80, 0x7D, 0x77, 0x76, 0x78, 0x78, 0x79, 0x75, 0x72, 
-    0x76, 0x77, 0x79, 0x7B, 0x7C, 0x7E, 0x80, 0x7F, 0x83, 0x85, 0x89, 0x86, 
-    0x84, 0x83, 0x84, 0x8A, 0x8B, 0x8A, 0x84, 0x85, 0x85, 0x85, 0x85, 0x83, 
-    0x84, 0x84, 0x7F, 0x81, 0x7E, 0x7E, 0x7F, 0x7E, 0x7B, 0x7D, 0x82, 0x7F, 
-    0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7B, 0x7D, 0x82, 0x83, 0x7E, 0x7C, 0x7D, 
-    0x7C, 0x7E, 0x7F, 0x7E, 0x7D, 0x7D, 0x7E, 0x7B, 0x7A, 0x7C, 0x7E, 0x7E, 
-    0x82, 0x82, 0x80, 0x81, 0x81, 0x81, 0x81, 0x86, 0x89, 0x88, 0x85, 0x83, 
-    0x84, 0x84, 0x82, 0x83, 0x81, 0x81, 0x81, 0x7D, 0x7C, 0x7A, 0x7B, 0x7D, 
-    0x7E, 0x7F, 0x7A, 0x79, 0x76, 0x78, 0x7B, 0x7B, 0x82, 0x82, 0x83, 0x84, 
-    0x84, 0x87, 0x86, 0x89, 0x8A, 0x8A, 0x8D, 0x8B, 0x87, 0x87, 0x89, 0x88, 
-    0x88, 0x87, 0x84, 0x7F, 0x7F, 0x7A, 0x7A, 0x79, 0x76, 0x76, 0x77, 0x78, 
-    0x7A, 0x7B, 0x7B, 0x7A, 0x7C, 0x79, 0x7A, 0x80, 0x7D, 0x80, 0x7C, 0x78, 
-    0x73, 0x73, 0x78, 0x77, 0x80, 0x7B, 0x79, 0x7B, 0x7B, 0x80, 0x81, 0x89, 
-    0x86, 0x84, 0x85, 0x83, 0x87, 0x86, 0x89, 0x87, 0x88, 0x8A, 0x8B, 0x8A, 
-    0x87, 0x85, 0x82, 0x83, 0x87, 0x87, 0x84, 0x84, 0x81, 0x7F, 0x7E, 0x80, 
-    0x7F, 0x7E, 0x80, 0x7E, 0x7F, 0x7D, 0x7E, 0x7E, 0x7D, 0x7C, 0x7D, 0x7D, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x80, 0x7E, 0x81, 0x7F, 0x7D, 0x7E, 0x7F, 
-    0x81, 0x81, 0x81, 0x7F, 0x7D, 0x7D, 0x7C, 0x7F, 0x82, 0x82, 0x81, 0x80, 
-    0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7E, 0x80, 0x7F, 0x80, 0x7F, 
-    0x7C, 0x7E, 0x7E, 0x7F, 0x80, 0x81, 0x81, 0x7E, 0x7F, 0x7E, 0x81, 0x83, 
-    0x82, 0x83, 0x81, 0x82, 0x81, 0x80, 0x80, 0x7D, 0x7D, 0x7E, 0x7F, 0x7E, 
-    0x7D, 0x7D, 0x7E, 0x81, 0x83, 0x84, 0x84, 0x81, 0x82, 0x83, 0x84, 0x86, 
-    0x86, 0x84, 0x82, 0x85, 0x84, 0x84, 0x83, 0x80, 0x80, 0x7F, 0x81, 0x80, 
-    0x80, 0x80, 0x7D, 0x7E, 0x7E, 0x7E, 0x7E, 0x7D, 0x7C, 0x79, 0x7A, 0x7C, 
-    0x7E, 0x7F, 0x7F, 0x7F, 0x7D, 0x7C, 0x7F, 0x81, 0x83, 0x83, 0x82, 0x7F, 
-    0x7E, 0x80, 0x81, 0x83, 0x82, 0x82, 0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 
-    0x81, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7E, 0x7E, 0x7D, 0x7E, 0x80, 0x81, 
-    0x81, 0x7F, 0x7F, 0x7E, 0x7E, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 0x81, 
-    0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x7F, 0x7E, 0x7E, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 
-    0x7F, 0x7E, 0x7F, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 
-    0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 
-    0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7E, 
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 
-    0x7F, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 
-    0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x81, 0x7F, 0x80, 0x81, 0x7E, 0x82, 0x7F, 0x80, 0x80, 0x7F, 
-    0x80, 0x7F, 0x81, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x80, 0x80, 0x81, 
-    0x80, 0x80, 0x81, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x81, 0x7F, 0x80, 0x80, 0x7F, 
-    0x81, 0x7F, 0x80, 0x81, 0x7F, 0x80, 0x80, 0x80, 0x81, 0x7F, 0x80, 0x81, 
-    0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x7F, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x81, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 
-};
-int sound_sz_up= sizeof(sound_up);
-
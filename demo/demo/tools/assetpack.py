@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Pack the files of an asset directory into one bundle (see src/assets.h).
+
+The bundle starts with a 16 byte header: magic "ASB1", version, number of
+entries, total size in bytes and a CRC of the entry table. The table has
+one 32 byte entry per file: name (file name without extension, up to 15
+characters, null terminated), offset from the start of the bundle, length,
+type, CRC of the data and a type specific info word. The data of each file
+follows the table, aligned to 4 bytes. All fields are little endian, the
+CRCs are CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF).
+
+Types are taken from the file extension:
+  .wav  WAV_ASSET   PCM RIFF/WAVE file, info - sample rate
+  .bmp  BMP_ASSET   Windows bitmap, info - width | height << 16
+  .fnt  FONT_ASSET  raw glyphs of 8 bytes each, info - number of glyphs
+  other RAW_ASSET   info - 0
+
+usage: assetpack.py DIR [-c out.c] [-b out.bin] [-r]
+  -c  write the bundle as a C array (assets_bundle) linked into the flash
+  -b  write the bundle as a binary image, e.g. for the SPI DataFlash
+  -r  print the entries and the total size
+"""
+
+import argparse
+import binascii
+import os
+import struct
+import sys
+
+MAGIC = 0x31425341          # "ASB1"
+VERSION = 1
+HEADER = struct.Struct("<IHHIHH")
+ENTRY = struct.Struct("<16sIIHHI")
+NAME_MAX = 15
+
+RAW_ASSET, WAV_ASSET, BMP_ASSET, FONT_ASSET = range(4)
+TYPE_NAMES = {RAW_ASSET: "raw", WAV_ASSET: "wav", BMP_ASSET: "bmp", FONT_ASSET: "font"}
+
+
+def crc16(data):
+    return binascii.crc_hqx(data, 0xFFFF)
+
+
+def wav_info(path, data):
+    """Returns the sample rate of a PCM WAV file."""
+    if len(data) < 12 or data[0:4] != b"RIFF" or data[8:12] != b"WAVE":
+        raise ValueError("%s: not a RIFF/WAVE file" % path)
+    ofs = 12
+    while ofs + 8 <= len(data):
+        chunk, size = struct.unpack_from("<4sI", data, ofs)
+        if chunk == b"fmt ":
+            fmt, channels, rate = struct.unpack_from("<HHI", data, ofs + 8)
+            if fmt != 1:
+                raise ValueError("%s: not PCM" % path)
+            return rate
+        ofs += 8 + size + (size & 1)
+    raise ValueError("%s: no fmt chunk" % path)
+
+
+def bmp_info(path, data):
+    """Returns width | height << 16 of a Windows bitmap."""
+    if len(data) < 26 or data[0:2] != b"BM":
+        raise ValueError("%s: not a BMP file" % path)
+    width, height = struct.unpack_from("<ii", data, 18)
+    return (width & 0xFFFF) | ((abs(height) & 0xFFFF) << 16)
+
+
+def font_info(path, data):
+    """Returns the number of 8 byte glyphs."""
+    if len(data) % 8 != 0:
+        raise ValueError("%s: size is not a multiple of 8" % path)
+    return len(data) // 8
+
+
+def load(directory):
+    """Returns (name, type, info, data) for every file, sorted by name."""
+    assets = []
+    for fname in sorted(os.listdir(directory)):
+        path = os.path.join(directory, fname)
+        if not os.path.isfile(path) or fname.startswith("."):
+            continue
+        name, ext = os.path.splitext(fname)
+        if len(name.encode("ascii")) > NAME_MAX:
+            raise ValueError("%s: name longer than %d characters" % (path, NAME_MAX))
+        if any(a[0] == name for a in assets):
+            raise ValueError("%s: duplicate name" % path)
+        with open(path, "rb") as f:
+            data = f.read()
+        ext = ext.lower()
+        if ext == ".wav":
+            assets.append((name, WAV_ASSET, wav_info(path, data), data))
+        elif ext == ".bmp":
+            assets.append((name, BMP_ASSET, bmp_info(path, data), data))
+        elif ext == ".fnt":
+            assets.append((name, FONT_ASSET, font_info(path, data), data))
+        else:
+            assets.append((name, RAW_ASSET, 0, data))
+    return assets
+
+
+def pack(assets):
+    """Returns the bundle and the offset of every asset."""
+    offset = HEADER.size + ENTRY.size * len(assets)
+    table = b""
+    body = b""
+    offsets = []
+    for name, typ, info, data in assets:
+        pad = -offset % 4
+        body += b"\0" * pad
+        offset += pad
+        offsets.append(offset)
+        table += ENTRY.pack(name.encode("ascii"), offset, len(data), typ, crc16(data), info)
+        body += data
+        offset += len(data)
+    header = HEADER.pack(MAGIC, VERSION, len(assets), offset, crc16(table), 0)
+    return header + table + body, offsets
+
+
+def write_c(path, directory, bundle):
+    with open(path, "w") as f:
+        f.write("/*****************************************************************************\n")
+        f.write(" *   %s:  Asset bundle, generated by tools/assetpack.py\n" % os.path.basename(path))
+        f.write(" *   from %s/, do not edit\n" % os.path.basename(os.path.normpath(directory)))
+        f.write(" *\n")
+        f.write(" ******************************************************************************/\n\n")
+        f.write("#include \"assets.h\"\n\n")
+        f.write("const uint8_t assets_bundle[%d] __attribute__ ((aligned(4))) = {\n" % len(bundle))
+        for ofs in range(0, len(bundle), 12):
+            f.write("    " + " ".join("0x%02X," % b for b in bundle[ofs:ofs + 12]) + "\n")
+        f.write("};\n")
+
+
+def report(assets, offsets, size):
+    print("%-16s %-5s %10s %8s %8s" % ("name", "type", "info", "offset", "length"))
+    for (name, typ, info, data), ofs in zip(assets, offsets):
+        print("%-16s %-5s %10d %8d %8d" % (name, TYPE_NAMES[typ], info, ofs, len(data)))
+    data = sum(len(a[3]) for a in assets)
+    print("%d assets, %d bytes of data, %d bytes total (%d table and padding)"
+          % (len(assets), data, size, size - data))
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(usage=__doc__)
+    parser.add_argument("directory")
+    parser.add_argument("-c", dest="c_file")
+    parser.add_argument("-b", dest="bin_file")
+    parser.add_argument("-r", dest="report", action="store_true")
+    args = parser.parse_args(argv[1:])
+    try:
+        assets = load(args.directory)
+    except (OSError, ValueError) as e:
+        sys.stderr.write("assetpack: %s\n" % e)
+        return 1
+    bundle, offsets = pack(assets)
+    if args.c_file:
+        write_c(args.c_file, args.directory, bundle)
+    if args.bin_file:
+        with open(args.bin_file, "wb") as f:
+            f.write(bundle)
+    if args.report or not (args.c_file or args.bin_file):
+        report(assets, offsets, len(bundle))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
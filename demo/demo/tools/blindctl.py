@@ -0,0 +1,300 @@
+#!/usr/bin/env python3
+"""Remote control of the blind over the framed protocol of proto.c.
+
+A message is type, seq, payload and a CRC-16/CCITT (poly 0x1021, init
+0xFFFF, little endian), COBS encoded and ended by a 0 byte; see proto.h
+for the types and payloads. Works with the board on UART3 at 921600 baud
+and with the simulator started with -u (pass the printed terminal).
+With -n the same messages go as UDP datagrams to the Ethernet port of
+net.c, without CRC and COBS.
+
+usage: blindctl.py -p PORT | -n HOST[:UDPPORT] COMMAND [ARGS]
+  ping                      protocol version
+  move up|down|stop         drive the motor
+  schedule                  show both alarms
+  schedule MODE HH:MM MODE HH:MM
+                            set both alarms, MODE up or down
+  config mode|lux|group [VALUE]
+                            read or write a setting
+  sensors                   one sensor record
+  stream PERIOD_MS [COUNT]  print sensor records, 0 stops the stream
+  group N move up|down|stop the move to every controller of CAN group N
+  group N config mode|lux VALUE
+                            the setting to every controller of CAN group N
+"""
+
+import argparse
+import os
+import select
+import socket
+import struct
+import sys
+import termios
+import time
+
+BAUD = termios.B921600
+TIMEOUT = 1.0
+RETRIES = 3
+UDP_PORT = 4950                         # NET_UDP_PORT
+
+PING, MOVE, GET_SCHEDULE, SET_SCHEDULE = 0x01, 0x02, 0x03, 0x04
+GET_CONFIG, SET_CONFIG, STREAM, GET_SENSORS = 0x05, 0x06, 0x07, 0x08
+GROUP = 0x09
+RESPONSE = 0x80
+SENSORS = 0x40
+
+MOVES = {"stop": 0, "up": 1, "down": 2}
+CONFIG_KEYS = {"mode": 0, "lux": 1, "group": 2}
+MODES = ("none", "alarms", "light", "both")
+MOTOR = ("stop", "down", "up")          # TELEMETRY_MOTOR_* (right, left)
+STATUS = ("ok", "bad length", "bad value", "unknown type", "CAN busy or off")
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out, block = bytearray(), bytearray()
+    for byte in data:
+        if byte == 0:
+            out += bytes([len(block) + 1]) + block
+            block = bytearray()
+        else:
+            block.append(byte)
+            if len(block) == 254:
+                out += b"\xff" + block
+                block = bytearray()
+    out += bytes([len(block) + 1]) + block
+    return bytes(out)
+
+
+def cobs_decode(data):
+    """Returns the decoded frame, None if the encoding is broken."""
+    out, i = bytearray(), 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def open_port(path):
+    """Opens a serial port raw, 921600 8N1, non-blocking reads."""
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+    attr = termios.tcgetattr(fd)
+    attr[0] = 0                                         # iflag
+    attr[1] = 0                                         # oflag
+    attr[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+    attr[3] = 0                                         # lflag
+    attr[4] = BAUD
+    attr[5] = BAUD
+    termios.tcsetattr(fd, termios.TCSANOW, attr)
+    termios.tcflush(fd, termios.TCIOFLUSH)
+    return fd
+
+
+class Link:
+    """Frames to and from the board."""
+
+    def __init__(self, path):
+        self.fd = open_port(path)
+        self.rx = b""
+        self.seq = 0
+        self.stream_seq = None
+        self.lost = 0
+
+    def send(self, mtype, seq, payload):
+        frame = bytes([mtype, seq]) + payload
+        frame += struct.pack("<H", crc16(frame))
+        os.write(self.fd, cobs_encode(frame) + b"\0")
+
+    def receive(self, deadline):
+        """Returns the next good (type, seq, payload), None at the deadline."""
+        while True:
+            end = self.rx.find(b"\0")
+            if end >= 0:
+                raw, self.rx = self.rx[:end], self.rx[end + 1:]
+                frame = cobs_decode(raw)
+                if frame is None or len(frame) < 4:
+                    continue
+                if crc16(frame[:-2]) != struct.unpack("<H", frame[-2:])[0]:
+                    continue
+                return frame[0], frame[1], frame[2:-2]
+            if time.monotonic() > deadline:
+                return None
+            try:
+                chunk = os.read(self.fd, 256)
+            except BlockingIOError:
+                chunk = b""
+            if chunk:
+                self.rx += chunk
+            else:
+                time.sleep(0.002)
+
+    def request(self, mtype, payload=b""):
+        """Sends a request, returns the response payload after the status byte."""
+        for _ in range(RETRIES):
+            self.seq = (self.seq + 1) & 0xFF
+            self.send(mtype, self.seq, payload)
+            deadline = time.monotonic() + TIMEOUT
+            while True:
+                msg = self.receive(deadline)
+                if msg is None:
+                    break
+                if msg[0] == SENSORS:
+                    self.sensors(msg)
+                elif msg[0] == (mtype | RESPONSE) and msg[1] == self.seq:
+                    status = msg[2][0] if msg[2] else 3
+                    if status != 0:
+                        sys.exit("blindctl: %s" % STATUS[min(status, len(STATUS) - 1)])
+                    return msg[2][1:]
+        sys.exit("blindctl: no response")
+
+    def sensors(self, msg):
+        """Counts stream messages lost by their seq."""
+        if self.stream_seq is not None:
+            self.lost += (msg[1] - self.stream_seq - 1) & 0xFF
+        self.stream_seq = msg[1]
+
+    def close(self):
+        os.close(self.fd)
+
+
+class UdpLink(Link):
+    """Messages to and from the board as UDP datagrams."""
+
+    def __init__(self, address):
+        host, _, port = address.partition(":")
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.connect((host, int(port) if port else UDP_PORT))
+        self.seq = 0
+        self.stream_seq = None
+        self.lost = 0
+
+    def send(self, mtype, seq, payload):
+        self.sock.send(bytes([mtype, seq]) + payload)
+
+    def receive(self, deadline):
+        """Returns the next (type, seq, payload), None at the deadline."""
+        while True:
+            wait = deadline - time.monotonic()
+            if wait <= 0 or not select.select([self.sock], [], [], wait)[0]:
+                return None
+            try:
+                frame = self.sock.recv(2048)
+            except ConnectionRefusedError:
+                continue
+            if len(frame) >= 2:
+                return frame[0], frame[1], frame[2:]
+
+    def close(self):
+        self.sock.close()
+
+
+def sensor_line(payload):
+    ms, lux, temp, motor, blind = struct.unpack("<IIiBb", payload[:14])
+    return "%10.3f s  %5u lux  %5.1f C  motor %-4s  blind %s" % (
+        ms / 1000.0, lux, temp / 10.0, MOTOR[motor] if motor < 3 else motor,
+        {-1: "down", 0: "?", 1: "up"}.get(blind, blind))
+
+
+def parse_alarm(mode, hhmm):
+    hour, minute = (int(x) for x in hhmm.split(":"))
+    return bytes([1 if mode == "up" else 0, hour, minute])
+
+
+def config_value(key, text):
+    return MODES.index(text) if key == 0 and text in MODES else int(text, 0)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Remote control of the blind.",
+                                 formatter_class=argparse.RawDescriptionHelpFormatter,
+                                 epilog=__doc__.split("usage:")[1])
+    where = ap.add_mutually_exclusive_group(required=True)
+    where.add_argument("-p", "--port", help="serial port or simulator terminal")
+    where.add_argument("-n", "--net", metavar="HOST[:UDPPORT]", help="board address on Ethernet")
+    ap.add_argument("command", choices=("ping", "move", "schedule", "config", "sensors", "stream",
+                                        "group"))
+    ap.add_argument("args", nargs="*")
+    args = ap.parse_args()
+
+    link = UdpLink(args.net) if args.net else Link(args.port)
+    if args.command == "ping":
+        print("protocol version %u" % link.request(PING)[0])
+    elif args.command == "move":
+        if len(args.args) != 1 or args.args[0] not in MOVES:
+            ap.error("move up|down|stop")
+        link.request(MOVE, bytes([MOVES[args.args[0]]]))
+    elif args.command == "schedule":
+        if args.args:
+            if len(args.args) != 4:
+                ap.error("schedule MODE HH:MM MODE HH:MM")
+            link.request(SET_SCHEDULE, parse_alarm(*args.args[0:2]) + parse_alarm(*args.args[2:4]))
+        data = link.request(GET_SCHEDULE)
+        for i in range(2):
+            mode, hour, minute = data[i * 3:i * 3 + 3]
+            print("alarm %u: %-4s %02u:%02u" % (i, "up" if mode else "down", hour, minute))
+    elif args.command == "config":
+        if not args.args or args.args[0] not in CONFIG_KEYS or len(args.args) > 2:
+            ap.error("config mode|lux|group [VALUE]")
+        key = CONFIG_KEYS[args.args[0]]
+        if len(args.args) == 2:
+            data = link.request(SET_CONFIG, struct.pack("<Bi", key, config_value(key, args.args[1])))
+        else:
+            data = link.request(GET_CONFIG, bytes([key]))
+        value = struct.unpack("<i", data[1:5])[0]
+        print("%s %s" % (args.args[0], MODES[value] if key == 0 and value < 4 else value))
+    elif args.command == "group":
+        # The board sends the request as one CAN frame, members do not answer
+        if len(args.args) == 3 and args.args[1] == "move" and args.args[2] in MOVES:
+            request = bytes([MOVE, MOVES[args.args[2]]])
+        elif (len(args.args) == 4 and args.args[1] == "config" and args.args[2] in CONFIG_KEYS
+              and args.args[2] != "group"):
+            key = CONFIG_KEYS[args.args[2]]
+            request = bytes([SET_CONFIG]) + struct.pack("<Bi", key, config_value(key, args.args[3]))
+        else:
+            ap.error("group N move up|down|stop, group N config mode|lux VALUE")
+        link.request(GROUP, bytes([int(args.args[0], 0)]) + request)
+    elif args.command == "sensors":
+        print(sensor_line(link.request(GET_SENSORS)))
+    elif args.command == "stream":
+        if args.net:
+            ap.error("stream needs -p, sensor records go out on the serial port only")
+        if not args.args:
+            ap.error("stream PERIOD_MS [COUNT]")
+        period = int(args.args[0])
+        count = int(args.args[1]) if len(args.args) > 1 else 0
+        link.request(STREAM, struct.pack("<H", period))
+        shown = 0
+        try:
+            while period and (count == 0 or shown < count):
+                msg = link.receive(time.monotonic() + TIMEOUT + period / 1000.0)
+                if msg is None:
+                    sys.exit("blindctl: stream stopped")
+                if msg[0] == SENSORS:
+                    link.sensors(msg)
+                    print(sensor_line(msg[2]))
+                    shown += 1
+        except KeyboardInterrupt:
+            pass
+        if period:
+            link.request(STREAM, struct.pack("<H", 0))
+            if link.lost:
+                print("%u messages lost" % link.lost)
+    link.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Render the profiling zones dumped by profile.c as a table.
+
+The dump is text from UART3, one zone per line:
+  profile begin <cpu clock Hz> <overhead cycles>
+  zone <name> <count> <min> <max> <total>
+  stack <high-water mark bytes> <reservation bytes>
+  boot <oled power ms> <light sensor ms> <first frame ms>
+  profile end
+Cycle counts already have the overhead of a begin/end pair subtracted.
+Zones are sorted by total time; the last column is the share of the
+main_loop zone (interrupt zones are counted in whatever they interrupted,
+so shares do not add up to 100).
+
+With -b the dump is compared with a baseline dump zone by zone, e.g. a
+build with RAMFUNC_DISABLE against one with the functions in SRAM.
+
+The SD card sector benchmark ('s', -s) is rendered as throughput per
+pass and the share of the time SCK was running:
+  sdbench begin <cpu clock Hz> <SCK Hz>
+  sd <read|write> <sectors per call> <sectors> <cycles>
+  sdbench end
+With -b it is compared pass by pass, e.g. with a build before a change of
+mmc.c as baseline.
+
+usage: profreport.py [FILE] [-p /dev/ttyUSB0] [-r] [-s] [-b BASE]
+  FILE  saved dump, - or nothing for stdin
+  -p    send 'p' to the board on this serial port and read the dump
+  -r    with -p, also reset the zones after reading them ('r')
+  -s    with -p, run the SD sector benchmark instead ('s')
+  -b    saved baseline dump to compare with
+"""
+
+import argparse
+import os
+import sys
+import termios
+import time
+
+BAUD = termios.B115200
+TIMEOUT = 2.0
+SD_TIMEOUT = 30.0
+SECTOR = 512
+LOOP_ZONE = "main_loop"
+BOOT_STEPS = ("oled power", "light sensor", "first frame")
+BOOT_NOT_DONE = 0xFFFFFFFF
+
+
+def open_port(path):
+    """Opens a serial port raw, 115200 8N1, non-blocking reads."""
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+    attr = termios.tcgetattr(fd)
+    attr[0] = 0                                         # iflag
+    attr[1] = 0                                         # oflag
+    attr[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+    attr[3] = 0                                         # lflag
+    attr[4] = BAUD
+    attr[5] = BAUD
+    termios.tcsetattr(fd, termios.TCSANOW, attr)
+    termios.tcflush(fd, termios.TCIOFLUSH)
+    return fd
+
+
+def read_board(path, reset, cmd=b"p", end=b"profile end", timeout=TIMEOUT):
+    """Sends a command to the board and returns the lines of its answer."""
+    fd = open_port(path)
+    try:
+        os.write(fd, cmd)
+        data = b""
+        deadline = time.monotonic() + timeout
+        while end not in data:
+            if time.monotonic() > deadline:
+                sys.exit("profreport: no complete dump from %s" % path)
+            try:
+                chunk = os.read(fd, 256)
+            except BlockingIOError:
+                chunk = b""
+            if chunk:
+                data += chunk
+            else:
+                time.sleep(0.01)
+        if reset:
+            os.write(fd, b"r")
+    finally:
+        os.close(fd)
+    return data.decode("ascii", "replace").splitlines()
+
+
+def parse(lines):
+    """Returns (cpu clock, overhead, list of zone dicts, stack, boot) of the last dump."""
+    hz, overhead, zones, stack, boot = None, 0, [], None, None
+    for line in lines:
+        words = line.split()
+        if words[:2] == ["profile", "begin"] and len(words) == 4:
+            hz, overhead, zones, stack, boot = int(words[2]), int(words[3]), [], None, None
+        elif words[:1] == ["zone"] and len(words) == 6 and hz is not None:
+            count, lo, hi, total = (int(w) for w in words[2:])
+            zones.append({"name": words[1], "count": count, "min": lo,
+                          "max": hi, "total": total})
+        elif words[:1] == ["stack"] and len(words) == 3:
+            stack = (int(words[1]), int(words[2]))
+        elif words[:1] == ["boot"] and len(words) == 1 + len(BOOT_STEPS):
+            boot = [int(w) for w in words[1:]]
+    if hz is None:
+        sys.exit("profreport: no dump found")
+    return hz, overhead, zones, stack, boot
+
+
+def parse_sd(lines):
+    """Returns (cpu clock, SCK, list of pass dicts, errors) of the last sector benchmark."""
+    hz, sclk, passes, errors = None, 0, [], []
+    for line in lines:
+        words = line.split()
+        if words[:2] == ["sdbench", "begin"] and len(words) == 4:
+            hz, sclk, passes, errors = int(words[2]), int(words[3]), [], []
+        elif words[:2] == ["sd", "error"] and hz is not None:
+            errors.append(" ".join(words[2:]))
+        elif words[:1] == ["sd"] and len(words) == 5 and hz is not None:
+            per_call, sectors, cycles = (int(w) for w in words[2:])
+            passes.append({"op": words[1], "per_call": per_call,
+                           "sectors": sectors, "cycles": cycles})
+    if hz is None:
+        return None
+    return hz, sclk, passes, errors
+
+
+def sd_rate(hz, p):
+    """KB/s of a benchmark pass."""
+    return p["sectors"] * SECTOR / 1024.0 * hz / p["cycles"] if p["cycles"] else 0.0
+
+
+def report_sd(hz, sclk, passes, errors, out):
+    out.write("sd card sector benchmark, cpu %d MHz, SCK %.2f MHz (%.0f KB/s on the wire)\n\n"
+              % (hz // 1000000, sclk / 1e6, sclk / 8.0 / 1024.0))
+    out.write("%-6s %9s %8s %10s %10s %6s\n"
+              % ("op", "per call", "sectors", "us/sector", "KB/s", "bus%"))
+    for p in passes:
+        us = p["cycles"] * 1e6 / hz / p["sectors"]
+        wire = SECTOR * 8 * 1e6 / sclk if sclk else 0.0
+        out.write("%-6s %9d %8d %10.1f %10.1f %6.1f\n"
+                  % (p["op"], p["per_call"], p["sectors"], us, sd_rate(hz, p),
+                     100.0 * wire / us if us else 0.0))
+    for e in errors:
+        out.write("error %s\n" % e)
+
+
+def compare_sd(base, dump, out):
+    """Prints the throughput of the passes of two sector benchmarks."""
+    old = {(p["op"], p["per_call"]): p for p in base[2]}
+    out.write("%-6s %9s %10s %10s %8s\n" % ("op", "per call", "base KB/s", "KB/s", "change"))
+    for p in dump[2]:
+        b = old.get((p["op"], p["per_call"]))
+        if b is None:
+            continue
+        brate, rate = sd_rate(base[0], b), sd_rate(dump[0], p)
+        out.write("%-6s %9d %10.1f %10.1f %7.1fx\n"
+                  % (p["op"], p["per_call"], brate, rate, rate / brate if brate else 0.0))
+
+
+def report(hz, overhead, zones, stack, boot, out):
+    us = 1e6 / hz
+    loop = next((z["total"] for z in zones if z["name"] == LOOP_ZONE), 0)
+    out.write("cpu %d MHz, begin/end overhead %d cycles subtracted\n\n"
+              % (hz // 1000000, overhead))
+    out.write("%-14s %9s %10s %10s %10s %9s %9s %9s %10s %6s\n"
+              % ("zone", "count", "min cyc", "mean cyc", "max cyc",
+                 "min us", "mean us", "max us", "total ms", "loop%"))
+    for z in sorted(zones, key=lambda z: z["total"], reverse=True):
+        if z["count"] == 0:
+            out.write("%-14s %9d %10s\n" % (z["name"], 0, "-"))
+            continue
+        mean = z["total"] / z["count"]
+        share = "%6.1f" % (100.0 * z["total"] / loop) if loop else "%6s" % "-"
+        out.write("%-14s %9d %10d %10.0f %10d %9.1f %9.1f %9.1f %10.1f %s\n"
+                  % (z["name"], z["count"], z["min"], mean, z["max"],
+                     z["min"] * us, mean * us, z["max"] * us,
+                     z["total"] * us / 1000.0, share))
+    if stack is not None:
+        out.write("\nstack high-water mark %d of %d bytes (%d free)\n"
+                  % (stack[0], stack[1], stack[1] - stack[0]))
+    if boot is not None:
+        out.write("boot %s\n" % ", ".join(
+            "%s %s" % (name, "-" if ms == BOOT_NOT_DONE else "%d ms" % ms)
+            for name, ms in zip(BOOT_STEPS, boot)))
+
+
+def read_file(path):
+    if path == "-":
+        return sys.stdin.read().splitlines()
+    with open(path) as f:
+        return f.read().splitlines()
+
+
+def compare(base, dump, out):
+    """Prints mean and max cycles of the zones of two dumps."""
+    old = {z["name"]: z for z in base[2]}
+    out.write("%-14s %10s %10s %8s %10s %10s %8s\n"
+              % ("zone", "base mean", "mean", "change", "base max", "max", "change"))
+    for z in dump[2]:
+        b = old.get(z["name"])
+        if b is None or b["count"] == 0 or z["count"] == 0:
+            continue
+        bmean, mean = b["total"] / b["count"], z["total"] / z["count"]
+        out.write("%-14s %10.0f %10.0f %7.1f%% %10d %10d %7.1f%%\n"
+                  % (z["name"], bmean, mean, 100.0 * (mean - bmean) / bmean if bmean else 0.0,
+                     b["max"], z["max"], 100.0 * (z["max"] - b["max"]) / b["max"] if b["max"] else 0.0))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Render a profile.c zone dump.")
+    ap.add_argument("file", nargs="?", default="-")
+    ap.add_argument("-p", "--port", help="read the dump from the board on this serial port")
+    ap.add_argument("-r", "--reset", action="store_true", help="reset the zones after reading")
+    ap.add_argument("-s", "--sd", action="store_true", help="with -p, run the SD sector benchmark")
+    ap.add_argument("-b", "--base", help="baseline dump to compare with")
+    args = ap.parse_args()
+
+    if args.port and args.sd:
+        lines = read_board(args.port, False, b"s", b"sdbench end", SD_TIMEOUT)
+    elif args.port:
+        lines = read_board(args.port, args.reset)
+    else:
+        lines = read_file(args.file)
+    sd = parse_sd(lines)
+    if sd is not None:
+        if args.base:
+            base = parse_sd(read_file(args.base))
+            if base is None:
+                sys.exit("profreport: no sector benchmark in %s" % args.base)
+            compare_sd(base, sd, sys.stdout)
+        else:
+            report_sd(*sd, out=sys.stdout)
+    elif args.base:
+        compare(parse(read_file(args.base)), parse(lines), sys.stdout)
+    else:
+        report(*parse(lines), out=sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,293 @@
+#!/usr/bin/env python3
+"""Worst case stack depth of main and the interrupt handlers.
+
+Reads the objects of the Debug builds together with the .su files GCC
+writes next to them (-fstack-usage). The call graph comes from the call
+relocations of each object (R_ARM_THM_CALL and the tail call branches),
+which -ffunction-sections keeps per function, so no disassembler is
+needed. The depth of a function is its own frame plus the deepest of its
+callees.
+
+Not seen in the relocations:
+  calls through function pointers - functions with a blx rN are listed,
+      add their targets to the edges file (tools/stack_edges.txt)
+  library functions without objects (newlib, libgcc) - listed as unknown,
+      counted as 0 bytes
+  recursion - reported, the cycle is counted once
+  dynamic frames (alloca, VLAs) - marked in the .su file, reported
+
+Handlers of one NVIC priority cannot preempt each other, so the total is
+main plus the deepest handler plus the 32 byte exception frame; with -n
+every handler is assumed to nest (one priority level each).
+
+usage: stackreport.py DIR... [-e EDGES] [-s BYTES] [-n] [-v]
+  DIR  directories with .o and .su files, e.g. src ../../Lib_MCU/Debug/src
+  -e   extra call edges, lines "caller: callee callee ..."
+  -s   stack reservation (STACK_SIZE of stackmon.h) to check against
+  -n   assume all handlers nest
+  -v   print the deepest call path of every entry point
+"""
+
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+
+EXC_FRAME = 32
+ENTRY_RE = re.compile(r"^(main|\w+_IRQHandler|\w+_Handler)$")
+DEFAULT_HANDLER = "IntDefaultHandler"
+
+SHT_SYMTAB, SHT_REL = 2, 9
+STT_FUNC, STT_SECTION = 2, 3
+STB_LOCAL, STB_GLOBAL, STB_WEAK = 0, 1, 2
+SHN_UNDEF = 0
+R_ARM_ABS32 = 2
+CALL_RELOCS = {10, 28, 29, 30, 51}  # THM_CALL, CALL, JUMP24, THM_JUMP24, THM_JUMP19
+
+
+class Obj:
+    """Functions, symbols and call relocations of one ELF32 ARM object."""
+
+    def __init__(self, path):
+        self.path = path
+        self.name = os.path.basename(path)
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError("%s: not a little endian ELF32 object" % path)
+        shoff, = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x2E)
+        self.sections = [struct.unpack_from("<IIIIIIIIII", self.data, shoff + n * shentsize)
+                         for n in range(shnum)]
+        names = self.sections[shstrndx]
+        self.secnames = [self.cstr(names[4] + s[0]) for s in self.sections]
+        self.symbols = []
+        for s in self.sections:
+            if s[1] == SHT_SYMTAB:
+                strtab = self.sections[s[6]][4]
+                for ofs in range(s[4], s[4] + s[5], 16):
+                    name, value, size, info, _, shndx = struct.unpack_from("<IIIBBH", self.data, ofs)
+                    self.symbols.append((self.cstr(strtab + name), value, size,
+                                         info & 0xF, info >> 4, shndx))
+
+    def cstr(self, ofs):
+        return self.data[ofs:self.data.index(b"\0", ofs)].decode("ascii", "replace")
+
+    def functions(self):
+        """Yields (name, binding, section, start, end) of the defined functions."""
+        for name, value, size, typ, bind, shndx in self.symbols:
+            if typ == STT_FUNC and shndx != SHN_UNDEF:
+                start = value & ~1
+                yield name, bind, shndx, start, start + size
+
+    def relocations(self):
+        """Yields (section, offset, type, symbol index) of the REL sections."""
+        for s in self.sections:
+            if s[1] == SHT_REL:
+                for ofs in range(s[4], s[4] + s[5], 8):
+                    offset, info = struct.unpack_from("<II", self.data, ofs)
+                    yield s[7], offset, info & 0xFF, info >> 8
+
+    def code_ranges(self, shndx, start, end):
+        """Yields the Thumb code ranges of [start, end) using the $t/$d mapping symbols."""
+        marks = sorted((v, n) for n, v, _, _, _, sh in self.symbols
+                       if sh == shndx and n in ("$t", "$d", "$a"))
+        state, pos = "$t", start
+        for value, mark in marks + [(end, "$d")]:
+            if value <= start:
+                state = mark
+                continue
+            if value > end:
+                value = end
+            if state == "$t" and value > pos:
+                yield pos, value
+            pos, state = value, mark
+            if value >= end:
+                break
+
+    def indirect_calls(self, shndx, start, end):
+        """Counts the blx/bx-with-link register calls of a Thumb function."""
+        base = self.sections[shndx][4]
+        count = 0
+        for lo, hi in self.code_ranges(shndx, start, end):
+            pc = lo
+            while pc + 2 <= hi:
+                hw, = struct.unpack_from("<H", self.data, base + pc)
+                if (hw & 0xFF87) == 0x4780:         # blx rM
+                    count += 1
+                pc += 4 if (hw >> 11) in (0x1D, 0x1E, 0x1F) else 2
+        return count
+
+
+def read_su(path):
+    """Returns {function: (bytes, qualifier)} of a .su file."""
+    out = {}
+    if os.path.exists(path):
+        with open(path) as f:
+            for line in f:
+                parts = line.rstrip("\n").split("\t")
+                if len(parts) == 3:
+                    out[parts[0].rsplit(":", 1)[-1]] = (int(parts[1]), parts[2])
+    return out
+
+
+class Graph:
+    def __init__(self):
+        self.frame = {}         # node -> bytes
+        self.qual = {}          # node -> .su qualifier
+        self.calls = {}         # node -> set of callee nodes or names
+        self.indirect = {}      # node -> number of register calls
+        self.globals = {}       # name -> node, strong over weak
+        self.locals = {}        # name -> [nodes]
+        self.weak = set()
+
+    def add_object(self, obj):
+        su = read_su(os.path.splitext(obj.path)[0] + ".su")
+        funcs = list(obj.functions())
+        by_section = {}
+        for name, bind, shndx, start, end in funcs:
+            node = name if bind != STB_LOCAL else "%s:%s" % (obj.name, name)
+            if bind == STB_LOCAL:
+                self.locals.setdefault(name, []).append(node)
+            elif bind == STB_GLOBAL or name not in self.globals:
+                if name in self.globals and bind == STB_GLOBAL and name not in self.weak:
+                    sys.stderr.write("stackreport: %s defined twice\n" % name)
+                self.globals[name] = node
+                if bind == STB_WEAK:
+                    self.weak.add(name)
+                else:
+                    self.weak.discard(name)
+            size, qual = su.get(name, (0, "unknown"))
+            self.frame[node], self.qual[node] = size, qual
+            self.calls.setdefault(node, set())
+            self.indirect[node] = obj.indirect_calls(shndx, start, end)
+            by_section.setdefault(shndx, []).append((start, end, node))
+
+        for shndx, offset, rtype, symidx in obj.relocations():
+            if rtype not in CALL_RELOCS:
+                continue
+            caller = next((n for s, e, n in by_section.get(shndx, []) if s <= offset < e), None)
+            if caller is None:
+                continue
+            name, value, _, typ, bind, sh = obj.symbols[symidx]
+            if typ == STT_SECTION:
+                callee = next((n for s, e, n in by_section.get(sh, []) if s == 0), None)
+            elif bind == STB_LOCAL and sh != SHN_UNDEF:
+                callee = "%s:%s" % (obj.name, name)
+            else:
+                callee = name           # resolved against the globals later
+            if callee is not None:
+                self.calls[caller].add(callee)
+
+    def resolve(self, name):
+        if name in self.frame:
+            return name
+        if name in self.globals:
+            return self.globals[name]
+        nodes = self.locals.get(name, [])
+        return nodes[0] if len(nodes) == 1 else None
+
+    def add_edges(self, path):
+        with open(path) as f:
+            for line in f:
+                line = line.split("#", 1)[0].strip()
+                if not line:
+                    continue
+                caller, _, callees = line.partition(":")
+                node = self.resolve(caller.strip())
+                if node is None:
+                    continue            # not linked in this build
+                for callee in callees.split():
+                    target = self.resolve(callee)
+                    if target is not None:
+                        self.calls[node].add(target)
+                        self.indirect[node] = 0
+
+    def depth(self, node, memo, stack, unknown, recursive):
+        """Returns (bytes, path) of the deepest chain starting at node."""
+        node = self.resolve(node) or node
+        if node in memo:
+            return memo[node]
+        if node not in self.frame:
+            unknown.add(node)
+            return 0, [node + "?"]
+        if node in stack:
+            recursive.add(node)
+            return 0, [node + " (recursion)"]
+        stack.add(node)
+        best, path = 0, []
+        for callee in sorted(self.calls[node]):
+            d, p = self.depth(callee, memo, stack, unknown, recursive)
+            if d > best or not path:
+                best, path = d, p
+        stack.discard(node)
+        memo[node] = (self.frame[node] + best, [node] + path)
+        return memo[node]
+
+    def entries(self):
+        default = self.globals.get(DEFAULT_HANDLER)
+        out = []
+        for name, node in sorted(self.globals.items()):
+            if not ENTRY_RE.match(name) or name == DEFAULT_HANDLER:
+                continue
+            if name in self.weak and (node == default or self.frame.get(node, 0) == 0):
+                continue
+            out.append(name)
+        return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Worst case stack depth from .su files and objects.")
+    ap.add_argument("dirs", nargs="+")
+    ap.add_argument("-e", "--edges", help="extra call edges for calls through pointers")
+    ap.add_argument("-s", "--stack-size", type=int, help="stack reservation to check against")
+    ap.add_argument("-n", "--nested", action="store_true", help="assume all handlers nest")
+    ap.add_argument("-v", "--verbose", action="store_true", help="print the deepest paths")
+    args = ap.parse_args()
+
+    g = Graph()
+    for d in args.dirs:
+        for path in sorted(glob.glob(os.path.join(d, "*.o"))):
+            g.add_object(Obj(path))
+    if args.edges:
+        g.add_edges(args.edges)
+
+    memo, unknown, recursive = {}, set(), set()
+    results = {}
+    for entry in g.entries():
+        results[entry] = g.depth(entry, memo, set(), unknown, recursive)
+    if "main" not in results:
+        sys.exit("stackreport: main not found")
+
+    print("%-28s %7s  %s" % ("entry", "bytes", "deepest call"))
+    for entry, (d, path) in sorted(results.items(), key=lambda r: -r[1][0]):
+        shown = " > ".join(p.split(":")[-1] for p in path) if args.verbose else \
+            (path[1].split(":")[-1] if len(path) > 1 else "")
+        print("%-28s %7d  %s" % (entry, d, shown))
+
+    handlers = sorted((d + EXC_FRAME for e, (d, _) in results.items() if e != "main"), reverse=True)
+    isr = sum(handlers) if args.nested else (handlers[0] if handlers else 0)
+    total = results["main"][0] + isr
+    print("\nworst case: main %d + handlers %d (%s, %d byte exception frame each) = %d bytes"
+          % (results["main"][0], isr, "all nested" if args.nested else "deepest", EXC_FRAME, total))
+    if args.stack_size:
+        print("reservation %d bytes, margin %d bytes" % (args.stack_size, args.stack_size - total))
+
+    reached = set(memo)
+    for title, items in (
+            ("calls through pointers, add their targets to the edges file",
+             sorted(n for n in reached if g.indirect.get(n))),
+            ("dynamic stack frames", sorted(n for n in reached if g.qual.get(n, "").startswith("dynamic")
+                                            and g.qual[n] != "dynamic,bounded")),
+            ("recursion, counted once", sorted(recursive)),
+            ("no object, counted as 0", sorted(unknown))):
+        if items:
+            print("\n%s:\n  %s" % (title, " ".join(n.split(":")[-1] for n in items)))
+    if args.stack_size and total > args.stack_size:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
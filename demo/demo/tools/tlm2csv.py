@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Decode the telemetry log written by telemetry.c (TLM.BIN) into CSV.
+
+The file is a sequence of 512 byte blocks of 32 little endian records of
+16 bytes: time (ms ticks), type, source, seq, value, aux. Record 0 of each
+block is a header: magic "TLM1", ms ticks and RTC seconds since 2000-01-01
+read at the same moment, and the number of records dropped so far.
+Blocks without the magic (padding after a restart) are skipped.
+
+usage: tlm2csv.py TLM.BIN [out.csv]
+"""
+
+import csv
+import datetime
+import struct
+import sys
+
+BLOCK_SIZE = 512
+RECORD = struct.Struct("<IBBHiI")
+HEADER = struct.Struct("<IIII")
+MAGIC = 0x314D4C54
+EPOCH = datetime.datetime(2000, 1, 1)
+
+TYPES = {1: "lux", 2: "temp", 3: "motor"}
+MOTOR = {0: "stop", 1: "right", 2: "left"}
+
+
+def records(data):
+    """Yields (wall clock, record tuple, dropped so far) for every record."""
+    for ofs in range(0, len(data) - BLOCK_SIZE + 1, BLOCK_SIZE):
+        magic, ms, epoch, dropped = HEADER.unpack_from(data, ofs)
+        if magic != MAGIC:
+            continue
+        for n in range(1, BLOCK_SIZE // RECORD.size):
+            rec = RECORD.unpack_from(data, ofs + n * RECORD.size)
+            if rec[1] == 0:         # unused slot
+                continue
+            delta = ((rec[0] - ms + 0x80000000) & 0xFFFFFFFF) - 0x80000000
+            when = EPOCH + datetime.timedelta(seconds=epoch, milliseconds=delta)
+            yield when, rec, dropped
+
+
+def row(when, rec, dropped):
+    time, typ, source, seq, value, aux = rec
+    if typ == 2:
+        shown = "%.1f" % (value / 10.0)
+    elif typ == 3:
+        shown = MOTOR.get(value, str(value))
+        aux = struct.unpack("<i", struct.pack("<I", aux))[0]    # roller state is signed
+    else:
+        shown = str(value)
+    return [when.isoformat(sep=" ", timespec="milliseconds"), time,
+            TYPES.get(typ, str(typ)), "isr" if source else "task", seq,
+            shown, aux, dropped]
+
+
+def main(argv):
+    if len(argv) not in (2, 3):
+        sys.stderr.write(__doc__)
+        return 2
+    with open(argv[1], "rb") as f:
+        data = f.read()
+    out = open(argv[2], "w", newline="") if len(argv) == 3 else sys.stdout
+    writer = csv.writer(out)
+    writer.writerow(["time", "ms", "type", "source", "seq", "value", "aux", "dropped"])
+    last = {}
+    gaps = 0
+    for when, rec, dropped in records(data):
+        source, seq = rec[2], rec[3]
+        if source in last and seq != ((last[source] + 1) & 0xFFFF):
+            gaps += 1
+        last[source] = seq
+        writer.writerow(row(when, rec, dropped))
+    if out is not sys.stdout:
+        out.close()
+    if gaps:
+        sys.stderr.write("tlm2csv: %d sequence gap(s), records were dropped\n" % gaps)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
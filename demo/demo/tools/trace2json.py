@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""Convert a trace of trace.c into a Chrome trace / Perfetto JSON timeline.
+
+Two inputs are understood, told apart by the first word:
+  ring dump    the trace_ring variable read with the debugger, e.g.
+                 (gdb) dump binary value trace.bin trace_ring
+               header magic "TRC1", CPU clock, size, events written, then
+               size records of 12 bytes: time, arg, id, 3 bytes padding
+  SWO capture  the raw ITM packet stream from the SWO pin, e.g. OpenOCD
+                 tpiu config internal swo.bin uart off 100000000 2000000
+               events on stimulus port 1: id as a 1 byte packet, time and
+               arg as 4 byte packets
+All values are little endian, times are CPU cycles (DWT CYCCNT) and are
+unwrapped assuming events are less than 2^32 cycles apart (the RTC
+interrupt traces every second).
+
+Open the output in https://ui.perfetto.dev or chrome://tracing.
+
+usage: trace2json.py CAPTURE [out.json] [-c HZ] [-p PORT] [-r]
+  -c  CPU clock of an SWO capture in Hz (default 100000000)
+  -p  stimulus port of the events (default 1)
+  -r  print the decoded events instead of writing JSON
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+RING_MAGIC = 0x31435254         # "TRC1"
+RING_HEADER = struct.Struct("<IIII")
+RING_RECORD = struct.Struct("<IIB3x")
+DEFAULT_HZ = 100000000
+
+(TIMER0_ENTER, TIMER0_EXIT, RTC_ENTER, RTC_EXIT, I2C_START, I2C_DONE,
+ I2C_ERROR, MOTOR, MARK, BOOT) = range(1, 11)
+
+NAMES = {TIMER0_ENTER: "timer0_enter", TIMER0_EXIT: "timer0_exit",
+         RTC_ENTER: "rtc_enter", RTC_EXIT: "rtc_exit",
+         I2C_START: "i2c_start", I2C_DONE: "i2c_done", I2C_ERROR: "i2c_error",
+         MOTOR: "motor", MARK: "mark", BOOT: "boot"}
+MOTOR_STATES = {0: "stop", 1: "right", 2: "left"}
+BOOT_STEPS = {0: "oled power", 1: "light sensor", 2: "first frame"}
+THREADS = {1: "TIMER0 ISR", 2: "RTC ISR", 3: "I2C", 4: "motor", 5: "marks"}
+
+
+def read_ring(data):
+    """Returns (cpu clock, [(time, id, arg)]) of a trace_ring dump, oldest first."""
+    magic, hz, size, written = RING_HEADER.unpack_from(data, 0)
+    if len(data) < RING_HEADER.size + size * RING_RECORD.size:
+        sys.exit("trace2json: ring dump is truncated")
+    first = written - size if written > size else 0
+    events = []
+    for n in range(first, written):
+        time, arg, eid = RING_RECORD.unpack_from(
+            data, RING_HEADER.size + (n % size) * RING_RECORD.size)
+        events.append((time, eid, arg))
+    return hz, events
+
+
+def itm_packets(data):
+    """Yields (port, payload bytes) of the software source packets of an ITM stream."""
+    i, n = 0, len(data)
+    while i < n:
+        h = data[i]
+        i += 1
+        if h == 0x00 or h == 0x80:                  # synchronization
+            continue
+        if h == 0x70:                               # overflow
+            yield None, b""
+            continue
+        if h & 0x03:                                # source packet
+            size = {1: 1, 2: 2, 3: 4}[h & 0x03]
+            payload = data[i:i + size]
+            i += size
+            if not h & 0x04:
+                yield h >> 3, payload
+            continue
+        # timestamps and extensions: continuation bytes until bit 7 clear
+        if h & 0x80:
+            while i < n and data[i] & 0x80:
+                i += 1
+            i += 1
+
+
+def read_swo(data, port):
+    """Returns the [(time, id, arg)] events of port in an ITM stream."""
+    events, eid, words = [], None, []
+    for p, payload in itm_packets(data):
+        if p is None:                               # lost data, resync on next id
+            eid, words = None, []
+        elif p != port:
+            continue
+        elif len(payload) == 1:
+            eid, words = payload[0], []
+        elif len(payload) == 4 and eid is not None:
+            words.append(struct.unpack("<I", payload)[0])
+            if len(words) == 2:
+                events.append((words[0], eid, words[1]))
+                eid, words = None, []
+    return events
+
+
+def unwrap(events):
+    """Replaces the 32 bit times by cycles since the first event."""
+    out, base, prev = [], 0, None
+    for time, eid, arg in events:
+        if prev is not None and time < prev:
+            base += 1 << 32
+        prev = time
+        out.append((base + time, eid, arg))
+    if out:
+        t0 = out[0][0]
+        out = [(t - t0, eid, arg) for t, eid, arg in out]
+    return out
+
+
+def i2c_fields(arg):
+    return arg & 0xFF, (arg >> 8) & 0xFF, (arg >> 16) & 0xFF, (arg >> 24) & 0xFF
+
+
+def describe(eid, arg):
+    if eid in (I2C_START, I2C_DONE):
+        addr, tx, rx, bus = i2c_fields(arg)
+        return "bus %d addr 0x%02x tx %d rx %d" % (bus, addr, tx, rx)
+    if eid == I2C_ERROR:
+        addr, status, _, bus = i2c_fields(arg)
+        return "bus %d addr 0x%02x status 0x%02x" % (bus, addr, status)
+    if eid == MOTOR:
+        return MOTOR_STATES.get(arg, str(arg))
+    if eid == BOOT:
+        return BOOT_STEPS.get(arg, str(arg))
+    return "0x%08x" % arg
+
+
+def chrome_events(events, hz):
+    us = 1e6 / hz
+    out = [{"name": "thread_name", "ph": "M", "pid": 1, "tid": tid,
+            "args": {"name": name}} for tid, name in THREADS.items()]
+    for cycles, eid, arg in events:
+        e = {"pid": 1, "ts": round(cycles * us, 3)}
+        if eid == TIMER0_ENTER:
+            e.update(name="TIMER0_IRQHandler", ph="B", tid=1, args={"IR": arg})
+        elif eid == TIMER0_EXIT:
+            e.update(ph="E", tid=1)
+        elif eid == RTC_ENTER:
+            e.update(name="RTC_IRQHandler", ph="B", tid=2, args={"ILR": arg})
+        elif eid == RTC_EXIT:
+            e.update(ph="E", tid=2)
+        elif eid == I2C_START:
+            addr, tx, rx, bus = i2c_fields(arg)
+            e.update(name="i2c%d 0x%02x" % (bus, addr), ph="B", tid=3,
+                     args={"tx": tx, "rx": rx})
+        elif eid in (I2C_DONE, I2C_ERROR):
+            e.update(ph="E", tid=3, args={"result": describe(eid, arg)})
+        elif eid == MOTOR:
+            out.append({"name": "motor", "ph": "C", "pid": 1, "ts": e["ts"],
+                        "args": {"state": arg}})
+            e.update(name="motor " + describe(eid, arg), ph="i", s="t", tid=4)
+        elif eid == BOOT:
+            e.update(name="boot " + describe(eid, arg), ph="i", s="t", tid=5)
+        else:
+            e.update(name=NAMES.get(eid, "event %d" % eid), ph="i", s="t", tid=5,
+                     args={"arg": arg})
+        out.append(e)
+    return {"traceEvents": out, "displayTimeUnit": "ns"}
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Convert a trace.c capture to a Perfetto timeline.")
+    ap.add_argument("capture")
+    ap.add_argument("out", nargs="?")
+    ap.add_argument("-c", "--clock", type=int, default=DEFAULT_HZ, help="CPU clock of an SWO capture")
+    ap.add_argument("-p", "--port", type=int, default=1, help="stimulus port of the events")
+    ap.add_argument("-r", "--print", action="store_true", help="print the events")
+    args = ap.parse_args()
+
+    with open(args.capture, "rb") as f:
+        data = f.read()
+    if len(data) >= RING_HEADER.size and RING_HEADER.unpack_from(data, 0)[0] == RING_MAGIC:
+        hz, events = read_ring(data)
+    else:
+        hz, events = args.clock, read_swo(data, args.port)
+    events = unwrap(events)
+
+    if args.print:
+        for cycles, eid, arg in events:
+            print("%14.3f us  %-13s %s" % (cycles * 1e6 / hz, NAMES.get(eid, "event %d" % eid),
+                                          describe(eid, arg)))
+        return
+    out = open(args.out, "w") if args.out else sys.stdout
+    json.dump(chrome_events(events, hz), out, indent=0)
+    out.write("\n")
+    if args.out:
+        out.close()
+    sys.stderr.write("%d events, %.3f ms\n" % (len(events), events[-1][0] * 1e3 / hz if events else 0.0))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,330 @@
+/*****************************************************************************
+ *   LPC17xx.h:  Host simulator replacement of the device header
+ *
+ *   Found before Lib_CMSISv1p30_LPC17xx/inc on the include path of the
+ *   simulator build. The register types and bit definitions come from the
+ *   real header (#include_next). The Cortex-M3 core header is kept out, as
+ *   its intrinsics are ARM assembly, and replaced by the core definitions
+ *   below. All peripheral pointers are redirected from the fixed addresses
+ *   to register blocks in host memory (sim/src/sim.c).
+ *
+ ******************************************************************************/
+#ifndef __SIM_LPC17XX_H
+#define __SIM_LPC17XX_H
+
+#include <stdint.h>
+
+/* core_cm3.h is replaced by the definitions at the end of this file */
+#define __CM3_CORE_H__
+
+/* The simulator writes read only registers, so they are not const here */
+#define     __I     volatile
+#define     __O     volatile
+#define     __IO    volatile
+
+#define __ASM            __asm
+#define __INLINE         inline
+
+#include_next "LPC17xx.h"
+
+/******************************************************************************
+ * Core peripherals
+ *****************************************************************************/
+
+typedef struct
+{
+  __IO uint32_t ISER[8];
+  __IO uint32_t ICER[8];
+  __IO uint32_t ISPR[8];
+  __IO uint32_t ICPR[8];
+  __IO uint32_t IABR[8];
+  __IO uint8_t  IP[240];
+  __O  uint32_t STIR;
+} NVIC_Type;
+
+typedef struct
+{
+  __I  uint32_t CPUID;
+  __IO uint32_t ICSR;
+  __IO uint32_t VTOR;
+  __IO uint32_t AIRCR;
+  __IO uint32_t SCR;
+  __IO uint32_t CCR;
+  __IO uint8_t  SHP[12];
+  __IO uint32_t SHCSR;
+  __IO uint32_t CFSR;
+  __IO uint32_t HFSR;
+  __IO uint32_t DFSR;
+  __IO uint32_t MMFAR;
+  __IO uint32_t BFAR;
+  __IO uint32_t AFSR;
+} SCB_Type;
+
+typedef struct
+{
+  __IO uint32_t CTRL;
+  __IO uint32_t LOAD;
+  __IO uint32_t VAL;
+  __I  uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct
+{
+  __O  union
+  {
+    __O  uint8_t    u8;
+    __O  uint16_t   u16;
+    __O  uint32_t   u32;
+  }  PORT [32];
+  __IO uint32_t TER;
+  __IO uint32_t TPR;
+  __IO uint32_t TCR;
+} ITM_Type;
+
+typedef struct
+{
+  __IO uint32_t DHCSR;
+  __O  uint32_t DCRSR;
+  __IO uint32_t DCRDR;
+  __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+/* The two DWT registers of dwt.h, CYCCNT follows the virtual time once enabled */
+typedef struct
+{
+  __IO uint32_t CTRL;
+  __IO uint32_t CYCCNT;
+} sim_DWT_Type;
+
+#define SCB_ICSR_VECTACTIVE_Pos             0
+#define SCB_ICSR_VECTACTIVE_Msk            (0x1FFul << SCB_ICSR_VECTACTIVE_Pos)
+#define SCB_SCR_SLEEPDEEP_Pos               2
+#define SCB_SCR_SLEEPDEEP_Msk              (1ul << SCB_SCR_SLEEPDEEP_Pos)
+
+#define SysTick_CTRL_COUNTFLAG_Pos         16
+#define SysTick_CTRL_COUNTFLAG_Msk         (1ul << SysTick_CTRL_COUNTFLAG_Pos)
+#define SysTick_CTRL_CLKSOURCE_Pos          2
+#define SysTick_CTRL_CLKSOURCE_Msk         (1ul << SysTick_CTRL_CLKSOURCE_Pos)
+#define SysTick_CTRL_TICKINT_Pos            1
+#define SysTick_CTRL_TICKINT_Msk           (1ul << SysTick_CTRL_TICKINT_Pos)
+#define SysTick_CTRL_ENABLE_Pos             0
+#define SysTick_CTRL_ENABLE_Msk            (1ul << SysTick_CTRL_ENABLE_Pos)
+#define SysTick_LOAD_RELOAD_Pos             0
+#define SysTick_LOAD_RELOAD_Msk            (0xFFFFFFul << SysTick_LOAD_RELOAD_Pos)
+
+#define ITM_TCR_ITMENA_Pos                  0
+#define ITM_TCR_ITMENA_Msk                 (1ul << ITM_TCR_ITMENA_Pos)
+#define CoreDebug_DEMCR_TRCENA_Pos         24
+#define CoreDebug_DEMCR_TRCENA_Msk         (1ul << CoreDebug_DEMCR_TRCENA_Pos)
+
+extern NVIC_Type sim_NVIC;
+extern SCB_Type sim_SCB;
+extern SysTick_Type sim_SysTick;
+extern ITM_Type sim_ITM;
+extern CoreDebug_Type sim_CoreDebug;
+extern sim_DWT_Type sim_DWT;
+
+#define NVIC                (&sim_NVIC)
+#define SCB                 (&sim_SCB)
+#define SysTick             (&sim_SysTick)
+#define ITM                 (&sim_ITM)
+#define CoreDebug           (&sim_CoreDebug)
+#define DWT_CTRL            (sim_DWT.CTRL)
+#define DWT_CYCCNT          (sim_DWT.CYCCNT)
+
+/******************************************************************************
+ * Core functions, same behaviour as in core_cm3.h. The set/clear enable
+ * registers are plain memory here, so both hold the enabled interrupts.
+ *****************************************************************************/
+
+static __INLINE void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  NVIC->ISER[((uint32_t)(IRQn) >> 5)] |= (1 << ((uint32_t)(IRQn) & 0x1F));
+  NVIC->ICER[((uint32_t)(IRQn) >> 5)] = NVIC->ISER[((uint32_t)(IRQn) >> 5)];
+}
+
+static __INLINE void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  NVIC->ISER[((uint32_t)(IRQn) >> 5)] &= ~(1 << ((uint32_t)(IRQn) & 0x1F));
+  NVIC->ICER[((uint32_t)(IRQn) >> 5)] = NVIC->ISER[((uint32_t)(IRQn) >> 5)];
+}
+
+static __INLINE void NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+  NVIC->ISPR[((uint32_t)(IRQn) >> 5)] |= (1 << ((uint32_t)(IRQn) & 0x1F));
+}
+
+static __INLINE void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+  NVIC->ISPR[((uint32_t)(IRQn) >> 5)] &= ~(1 << ((uint32_t)(IRQn) & 0x1F));
+}
+
+static __INLINE void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+  if(IRQn < 0) {
+    SCB->SHP[((uint32_t)(IRQn) & 0xF)-4] = ((priority << (8 - __NVIC_PRIO_BITS)) & 0xff); }
+  else {
+    NVIC->IP[(uint32_t)(IRQn)] = ((priority << (8 - __NVIC_PRIO_BITS)) & 0xff);    }
+}
+
+static __INLINE uint32_t SysTick_Config(uint32_t ticks)
+{
+  if (ticks > SysTick_LOAD_RELOAD_Msk)  return (1);
+
+  SysTick->LOAD  = (ticks & SysTick_LOAD_RELOAD_Msk) - 1;
+  NVIC_SetPriority (SysTick_IRQn, (1<<__NVIC_PRIO_BITS) - 1);
+  SysTick->VAL   = 0;
+  SysTick->CTRL  = SysTick_CTRL_CLKSOURCE_Msk |
+                   SysTick_CTRL_TICKINT_Msk   |
+                   SysTick_CTRL_ENABLE_Msk;
+  return (0);
+}
+
+/* Interrupts are delivered between driver calls, so masking is a no-op */
+void sim_wfi(void);
+
+static __INLINE void __enable_irq(void)  {}
+static __INLINE void __disable_irq(void) {}
+static __INLINE uint32_t __get_PRIMASK(void) { return 0; }
+static __INLINE void __set_PRIMASK(uint32_t priMask) { (void)priMask; }
+static __INLINE void __NOP(void)         {}
+static __INLINE void __WFI(void)         { sim_wfi(); }
+static __INLINE void __WFE(void)         {}
+static __INLINE void __DSB(void)         { __sync_synchronize(); }
+static __INLINE void __DMB(void)         { __sync_synchronize(); }
+static __INLINE void __ISB(void)         { __sync_synchronize(); }
+
+/******************************************************************************
+ * Peripherals
+ *****************************************************************************/
+
+extern LPC_SC_TypeDef       sim_SC;
+extern LPC_GPIO_TypeDef     sim_GPIO[5];
+extern LPC_WDT_TypeDef      sim_WDT;
+extern LPC_TIM_TypeDef      sim_TIM[4];
+extern LPC_RIT_TypeDef      sim_RIT;
+extern LPC_UART0_TypeDef    sim_UART0;
+extern LPC_UART1_TypeDef    sim_UART1;
+extern LPC_UART_TypeDef     sim_UART2;
+extern LPC_UART_TypeDef     sim_UART3;
+extern LPC_PWM_TypeDef      sim_PWM1;
+extern LPC_I2C_TypeDef      sim_I2C[3];
+extern LPC_I2S_TypeDef      sim_I2S;
+extern LPC_SPI_TypeDef      sim_SPI;
+extern LPC_RTC_TypeDef      sim_RTC;
+extern LPC_GPIOINT_TypeDef  sim_GPIOINT;
+extern LPC_PINCON_TypeDef   sim_PINCON;
+extern LPC_SSP_TypeDef      sim_SSP[2];
+extern LPC_ADC_TypeDef      sim_ADC;
+extern LPC_DAC_TypeDef      sim_DAC;
+extern LPC_CANAF_RAM_TypeDef sim_CANAF_RAM;
+extern LPC_CANAF_TypeDef    sim_CANAF;
+extern LPC_CANCR_TypeDef    sim_CANCR;
+extern LPC_CAN_TypeDef      sim_CAN[2];
+extern LPC_MCPWM_TypeDef    sim_MCPWM;
+extern LPC_QEI_TypeDef      sim_QEI;
+extern LPC_EMAC_TypeDef     sim_EMAC;
+extern LPC_GPDMA_TypeDef    sim_GPDMA;
+extern LPC_GPDMACH_TypeDef  sim_GPDMACH[8];
+extern LPC_USB_TypeDef      sim_USB;
+
+#undef LPC_SC
+#undef LPC_GPIO0
+#undef LPC_GPIO1
+#undef LPC_GPIO2
+#undef LPC_GPIO3
+#undef LPC_GPIO4
+#undef LPC_WDT
+#undef LPC_TIM0
+#undef LPC_TIM1
+#undef LPC_TIM2
+#undef LPC_TIM3
+#undef LPC_RIT
+#undef LPC_UART0
+#undef LPC_UART1
+#undef LPC_UART2
+#undef LPC_UART3
+#undef LPC_PWM1
+#undef LPC_I2C0
+#undef LPC_I2C1
+#undef LPC_I2C2
+#undef LPC_I2S
+#undef LPC_SPI
+#undef LPC_RTC
+#undef LPC_GPIOINT
+#undef LPC_PINCON
+#undef LPC_SSP0
+#undef LPC_SSP1
+#undef LPC_ADC
+#undef LPC_DAC
+#undef LPC_CANAF_RAM
+#undef LPC_CANAF
+#undef LPC_CANCR
+#undef LPC_CAN1
+#undef LPC_CAN2
+#undef LPC_MCPWM
+#undef LPC_QEI
+#undef LPC_EMAC
+#undef LPC_GPDMA
+#undef LPC_GPDMACH0
+#undef LPC_GPDMACH1
+#undef LPC_GPDMACH2
+#undef LPC_GPDMACH3
+#undef LPC_GPDMACH4
+#undef LPC_GPDMACH5
+#undef LPC_GPDMACH6
+#undef LPC_GPDMACH7
+#undef LPC_USB
+
+#define LPC_SC              (&sim_SC)
+#define LPC_GPIO0           (&sim_GPIO[0])
+#define LPC_GPIO1           (&sim_GPIO[1])
+#define LPC_GPIO2           (&sim_GPIO[2])
+#define LPC_GPIO3           (&sim_GPIO[3])
+#define LPC_GPIO4           (&sim_GPIO[4])
+#define LPC_WDT             (&sim_WDT)
+#define LPC_TIM0            (&sim_TIM[0])
+#define LPC_TIM1            (&sim_TIM[1])
+#define LPC_TIM2            (&sim_TIM[2])
+#define LPC_TIM3            (&sim_TIM[3])
+#define LPC_RIT             (&sim_RIT)
+#define LPC_UART0           (&sim_UART0)
+#define LPC_UART1           (&sim_UART1)
+#define LPC_UART2           (&sim_UART2)
+#define LPC_UART3           (&sim_UART3)
+#define LPC_PWM1            (&sim_PWM1)
+#define LPC_I2C0            (&sim_I2C[0])
+#define LPC_I2C1            (&sim_I2C[1])
+#define LPC_I2C2            (&sim_I2C[2])
+#define LPC_I2S             (&sim_I2S)
+#define LPC_SPI             (&sim_SPI)
+#define LPC_RTC             (&sim_RTC)
+#define LPC_GPIOINT         (&sim_GPIOINT)
+#define LPC_PINCON          (&sim_PINCON)
+#define LPC_SSP0            (&sim_SSP[0])
+#define LPC_SSP1            (&sim_SSP[1])
+#define LPC_ADC             (&sim_ADC)
+#define LPC_DAC             (&sim_DAC)
+#define LPC_CANAF_RAM       (&sim_CANAF_RAM)
+#define LPC_CANAF           (&sim_CANAF)
+#define LPC_CANCR           (&sim_CANCR)
+#define LPC_CAN1            (&sim_CAN[0])
+#define LPC_CAN2            (&sim_CAN[1])
+#define LPC_MCPWM           (&sim_MCPWM)
+#define LPC_QEI             (&sim_QEI)
+#define LPC_EMAC            (&sim_EMAC)
+#define LPC_GPDMA           (&sim_GPDMA)
+#define LPC_GPDMACH0        (&sim_GPDMACH[0])
+#define LPC_GPDMACH1        (&sim_GPDMACH[1])
+#define LPC_GPDMACH2        (&sim_GPDMACH[2])
+#define LPC_GPDMACH3        (&sim_GPDMACH[3])
+#define LPC_GPDMACH4        (&sim_GPDMACH[4])
+#define LPC_GPDMACH5        (&sim_GPDMACH[5])
+#define LPC_GPDMACH6        (&sim_GPDMACH[6])
+#define LPC_GPDMACH7        (&sim_GPDMACH[7])
+#define LPC_USB             (&sim_USB)
+
+#endif /* end __SIM_LPC17XX_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
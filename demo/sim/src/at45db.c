@@ -0,0 +1,331 @@
+/*****************************************************************************
+ *   at45db.c:  Model of the AT45DB081D SPI DataFlash
+ *
+ ******************************************************************************/
+
+/*
+ * 4096 pages of 264 bytes (the factory default page size) and the two
+ * SRAM buffers, selected by P2.2. Each byte on the bus goes through
+ * at45db_transfer; opcode and address are collected while the part is
+ * selected and program/erase commands start when it is deselected, as on
+ * the real part. Supported are the commands flash.c uses: device ID,
+ * status, fast read, buffer write, buffer to page with and without erase,
+ * page to buffer and block erase; deep power down is accepted and ignored.
+ *
+ * Programming without erase can only clear bits. The part is busy for the
+ * typical times of the data sheet below; a read, program or erase started
+ * while busy, or a write into the buffer being programmed, is a protocol
+ * error of the driver and counted.
+ *
+ * at45db_powerFail lets a number of program/erase operations complete and
+ * cuts the supply during the next one: it only reaches the first half of
+ * its bytes (pages of a block erase), all later ones are lost and the
+ * buffers forget their contents until at45db_powerOn.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define PAGE_SIZE           264U
+#define PAGES               4096U
+#define BLOCK_PAGES         8U
+#define PAGE_BITS           9U      /* byte address bits of a 264 byte page */
+
+#define STATUS_RDY          0x80U
+#define STATUS_DENSITY      0x24U   /* 8 Mbit */
+
+#define T_XFR_NS            (200ULL * SIM_NS_PER_US)
+#define T_EP_NS             (17ULL * SIM_NS_PER_MS)
+#define T_P_NS              (3ULL * SIM_NS_PER_MS)
+#define T_BE_NS             (45ULL * SIM_NS_PER_MS)
+
+#define NO_BUFFER           2U
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint8_t mem[PAGES * PAGE_SIZE];
+static uint8_t sram[2][PAGE_SIZE];
+static Bool initialized = FALSE;
+
+static Bool selected = FALSE;
+static uint32_t count = 0;          /* bytes since select */
+static uint8_t opcode = 0;
+static uint32_t addr = 0;           /* address bytes as sent */
+static uint32_t readPos = 0;        /* next byte of a fast read */
+static uint32_t bufPos = 0;         /* next byte of a buffer write */
+
+static sim_time_t busyUntil = 0;
+static uint32_t busyBuffer = NO_BUFFER;
+
+static Bool powered = TRUE;
+static Bool failArmed = FALSE;
+static uint32_t failAfter = 0;
+
+static at45db_stat_t stat;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static void init(void)
+{
+    if (!initialized) {
+        memset(mem, 0xFF, sizeof(mem));
+        memset(sram, 0xFF, sizeof(sram));
+        initialized = TRUE;
+    }
+}
+
+static Bool busy(void)
+{
+    return (sim_now < busyUntil) ? TRUE : FALSE;
+}
+
+static void protocolError(void)
+{
+    stat.errors++;
+    sim_trace("at45db: command %02x while busy\n", opcode);
+}
+
+static uint32_t page(void)
+{
+    return (addr >> PAGE_BITS) & (PAGES - 1U);
+}
+
+static uint32_t byteAddr(void)
+{
+    return (addr & ((1U << PAGE_BITS) - 1U)) % PAGE_SIZE;
+}
+
+/* Bytes an operation on len bytes gets done before the supply is cut */
+static uint32_t powerLeft(uint32_t len)
+{
+    uint32_t output = len;
+
+    if (!powered) {
+        output = 0;
+    } else if (failArmed) {
+        if (failAfter == 0) {
+            powered = FALSE;
+            failArmed = FALSE;
+            memset(sram, 0xFF, sizeof(sram));
+            output = len / 2U;
+        } else {
+            failAfter--;
+        }
+    }
+    return output;
+}
+
+static void program(uint32_t p, const uint8_t *src, Bool erase, sim_time_t t, uint32_t b)
+{
+    uint8_t *dst = &mem[p * PAGE_SIZE];
+    uint32_t n = powerLeft(PAGE_SIZE);
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        dst[i] = erase ? src[i] : (uint8_t)(dst[i] & src[i]);
+    }
+    stat.programs++;
+    busyUntil = sim_now + t;
+    busyBuffer = b;
+}
+
+static void erase(uint32_t first, uint32_t pages, sim_time_t t)
+{
+    uint32_t n = powerLeft(pages);
+
+    memset(&mem[first * PAGE_SIZE], 0xFF, (size_t)n * PAGE_SIZE);
+    stat.erases++;
+    busyUntil = sim_now + t;
+    busyBuffer = NO_BUFFER;
+}
+
+/* Array commands, started on the rising edge of CS */
+static void execute(void)
+{
+    uint32_t b = ((opcode == 0x55) || (opcode == 0x86) || (opcode == 0x89)) ? 1U : 0U;
+
+    if ((count < 4U) || ((opcode != 0x53) && (opcode != 0x55) && (opcode != 0x83)
+            && (opcode != 0x86) && (opcode != 0x88) && (opcode != 0x89) && (opcode != 0x50))) {
+        return;
+    }
+    if (busy()) {
+        protocolError();
+    }
+    switch (opcode) {
+    case 0x53: case 0x55:                       /* page to buffer */
+        if (powered) {
+            memcpy(sram[b], &mem[page() * PAGE_SIZE], PAGE_SIZE);
+        }
+        busyUntil = sim_now + T_XFR_NS;
+        busyBuffer = b;
+        break;
+    case 0x83: case 0x86:                       /* buffer to page with erase */
+        program(page(), sram[b], TRUE, T_EP_NS, b);
+        break;
+    case 0x88: case 0x89:                       /* buffer to page without erase */
+        program(page(), sram[b], FALSE, T_P_NS, b);
+        break;
+    default:                                    /* block erase */
+        erase(page() & ~(BLOCK_PAGES - 1U), BLOCK_PAGES, T_BE_NS);
+        break;
+    }
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Chip select changed
+ *
+ * Params:
+ *   [in] active - TRUE when CS went low
+ *
+ *****************************************************************************/
+void at45db_select(Bool active)
+{
+    init();
+    if (active && !selected) {
+        count = 0;
+        addr = 0;
+    } else if (!active && selected) {
+        execute();
+    }
+    selected = active;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    One byte on the bus while the part is selected
+ *
+ * Params:
+ *   [in] out - byte sent by the master
+ *
+ * Returns:
+ *    byte sent by the part, 0xFF where it does not drive the bus
+ *
+ *****************************************************************************/
+uint8_t at45db_transfer(uint8_t out)
+{
+    static const uint8_t id[4] = {0x1F, 0x25, 0x00, 0x01};
+    uint32_t n = count++;
+    uint8_t output = 0xFF;
+
+    init();
+    if (n == 0U) {
+        opcode = out;
+        return output;
+    }
+    if (n <= 3U) {
+        addr = (addr << 8) | out;
+    }
+
+    switch (opcode) {
+    case 0x9F:                                  /* manufacturer and device ID */
+        output = (n <= 4U) ? id[n - 1U] : 0x00;
+        break;
+    case 0xD7:                                  /* status register */
+        output = STATUS_DENSITY | (busy() ? 0U : STATUS_RDY);
+        break;
+    case 0x0B:                                  /* fast read, one dummy byte */
+        if (n == 4U) {
+            if (busy()) {
+                protocolError();
+            }
+            readPos = page() * PAGE_SIZE + byteAddr();
+        } else if (n > 4U) {
+            output = mem[readPos];
+            readPos = (readPos + 1U) % (PAGES * PAGE_SIZE);
+        } else {}
+        break;
+    case 0x84: case 0x87:                       /* buffer write */
+        if (n == 3U) {
+            bufPos = byteAddr();
+            if (busy() && (busyBuffer == ((opcode == 0x84) ? 0U : 1U))) {
+                protocolError();
+            }
+        } else if (n > 3U) {
+            if (powered) {
+                sram[(opcode == 0x84) ? 0 : 1][bufPos] = out;
+            }
+            bufPos = (bufPos + 1U) % PAGE_SIZE;
+        } else {}
+        break;
+    default:
+        break;
+    }
+    return output;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Cut the supply during a later program or erase operation
+ *
+ * Params:
+ *   [in] ops - operations that still complete before the one cut off
+ *
+ *****************************************************************************/
+void at45db_powerFail(uint32_t ops)
+{
+    failArmed = TRUE;
+    failAfter = ops;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Restore the supply and cancel a pending at45db_powerFail
+ *
+ * Returns:
+ *    TRUE if the supply had been cut
+ *
+ *****************************************************************************/
+Bool at45db_powerOn(void)
+{
+    Bool output = powered ? FALSE : TRUE;
+
+    powered = TRUE;
+    failArmed = FALSE;
+    busyUntil = 0;
+    return output;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Memory array, PAGES * 264 bytes, for tests to inspect or snapshot
+ *
+ *****************************************************************************/
+uint8_t *at45db_memory(uint32_t *size)
+{
+    init();
+    *size = (uint32_t)sizeof(mem);
+    return mem;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Operation counters since the start
+ *
+ *****************************************************************************/
+void at45db_getStat(at45db_stat_t *out)
+{
+    *out = stat;
+}
@@ -0,0 +1,210 @@
+/*****************************************************************************
+ *   boottest.c:  Host test of demo/src/boot.c and demo/src/stackmon.c
+ *
+ ******************************************************************************/
+
+/*
+ * Run with ./sim -x boot instead of the firmware. SysTick runs at 1 ms as
+ * in the firmware, so boot_wait sleeps in __WFI from tick to tick; the ms
+ * counter of boot.c is the virtual time plus an offset, which lets the
+ * sequence run again across the wrap of the counter.
+ *
+ *   sequence    two steps with settle times: not done a tick early (the
+ *               first tick may be partial), done on time, each action run
+ *               once, boot_wait running the other step due meanwhile,
+ *               boot_mark, boot_wait on a step never scheduled
+ *   wrap        the same with the ms counter wrapping during the boot
+ *   stackmon    the reservation below _vStackTop (here sim_stack) painted
+ *               as ResetISR does, then written to several depths: untouched,
+ *               a deep word with paint above it, the bottom word
+ *
+ * The output is deterministic, make check compares it.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "LPC17xx.h"
+#include "boot.h"
+#include "stackmon.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define OLED_DELAY_MS       100U
+#define LIGHT_DELAY_MS      30U
+#define LOG_MAX             8U
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+/* _vStackTop comes from the linker script on target, here it is the end of sim_stack */
+uint32_t sim_stack[1024];
+_Static_assert(sizeof(sim_stack) == STACK_SIZE, "sim_stack and the .set below hold STACK_SIZE");
+__asm__(".globl _vStackTop\n\t.set _vStackTop, sim_stack + 4096");
+
+static uint32_t failures = 0;
+static uint32_t msBase = 0;
+static char actionLog[LOG_MAX];
+static uint32_t actions = 0;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static void fail(const char *what, uint32_t a, uint32_t b)
+{
+    if (failures < 10U) {
+        printf("FAIL %s: %u %u\n", what, (unsigned)a, (unsigned)b);
+    }
+    failures++;
+}
+
+static uint32_t getMs(void)
+{
+    return msBase + (uint32_t)(sim_now / SIM_NS_PER_MS);
+}
+
+static void logAction(char c)
+{
+    if (actions < LOG_MAX) {
+        actionLog[actions] = c;
+    }
+    actions++;
+}
+
+static void oledAction(void)
+{
+    logAction('o');
+}
+
+static void lightAction(void)
+{
+    logAction('l');
+}
+
+/* Virtual time to the next whole ms, then ms more */
+static void waitMs(uint32_t ms)
+{
+    if ((sim_now % SIM_NS_PER_MS) != 0U) {
+        sim_spend(SIM_NS_PER_MS - (sim_now % SIM_NS_PER_MS));
+    }
+    if (ms != 0U) {
+        sim_spend((sim_time_t)ms * SIM_NS_PER_MS);
+    }
+}
+
+static void testSequence(const char *name, uint32_t startMs)
+{
+    uint32_t i;
+    uint32_t before = failures;
+    sim_time_t t;
+
+    waitMs(0U);
+    msBase = startMs - (uint32_t)(sim_now / SIM_NS_PER_MS);
+    actions = 0;
+    boot_init(getMs);
+    for (i = 0U; i < (uint32_t)BOOT_STEPS; i++) {
+        if (boot_done((boot_step_t)i) || (boot_time((boot_step_t)i) != BOOT_NOT_DONE)) {
+            fail("init", i, boot_time((boot_step_t)i));
+        }
+    }
+
+    /* never scheduled: returns at once */
+    t = sim_now;
+    boot_wait(BOOT_LIGHT);
+    if ((sim_now != t) || boot_done(BOOT_LIGHT)) {
+        fail("wait unscheduled", (uint32_t)(sim_now - t), 0U);
+    }
+
+    boot_after(BOOT_OLED_POWER, OLED_DELAY_MS, oledAction);
+    boot_after(BOOT_LIGHT, LIGHT_DELAY_MS, lightAction);
+    waitMs(LIGHT_DELAY_MS);
+    boot_poll();
+    if (boot_done(BOOT_LIGHT) || (actions != 0U)) {
+        fail("light early", boot_time(BOOT_LIGHT), actions);
+    }
+    waitMs(1U);
+    boot_poll();
+    boot_poll();
+    if (!boot_done(BOOT_LIGHT) || (boot_time(BOOT_LIGHT) != LIGHT_DELAY_MS + 1U) || (actions != 1U)) {
+        fail("light", boot_time(BOOT_LIGHT), actions);
+    }
+
+    boot_wait(BOOT_OLED_POWER);
+    if (!boot_done(BOOT_OLED_POWER) || (boot_time(BOOT_OLED_POWER) != OLED_DELAY_MS + 1U)
+        || (actions != 2U) || (memcmp(actionLog, "lo", 2U) != 0)) {
+        fail("oled", boot_time(BOOT_OLED_POWER), actions);
+    }
+
+    if (boot_time(BOOT_FIRST_FRAME) != BOOT_NOT_DONE) {
+        fail("frame early", boot_time(BOOT_FIRST_FRAME), 0U);
+    }
+    waitMs(5U);
+    boot_mark(BOOT_FIRST_FRAME);
+    boot_wait(BOOT_FIRST_FRAME);
+    if (!boot_done(BOOT_FIRST_FRAME) || (boot_time(BOOT_FIRST_FRAME) != OLED_DELAY_MS + 6U)
+        || (actions != 2U)) {
+        fail("frame", boot_time(BOOT_FIRST_FRAME), actions);
+    }
+
+    /* waiting for the later step runs the earlier one on the way */
+    actions = 0;
+    boot_after(BOOT_LIGHT, 50U, lightAction);
+    boot_after(BOOT_OLED_POWER, 20U, oledAction);
+    boot_wait(BOOT_LIGHT);
+    if ((actions != 2U) || (memcmp(actionLog, "ol", 2U) != 0)
+        || ((boot_time(BOOT_LIGHT) - boot_time(BOOT_OLED_POWER)) != 30U)) {
+        fail("wait runs others", boot_time(BOOT_OLED_POWER), boot_time(BOOT_LIGHT));
+    }
+
+    printf("boot %s: %s, light %u ms, oled %u ms\n", name, (failures == before) ? "ok" : "FAILED",
+            (unsigned)(LIGHT_DELAY_MS + 1U), (unsigned)(OLED_DELAY_MS + 1U));
+}
+
+static void testStackmon(void)
+{
+    uint32_t words = STACK_SIZE / 4U;
+    uint32_t i;
+    uint32_t before = failures;
+
+    for (i = 0U; i < words; i++) {
+        sim_stack[i] = STACK_PAINT;
+    }
+    if ((stackmon_used() != 0U) || (stackmon_size() != STACK_SIZE)) {
+        fail("stackmon untouched", stackmon_used(), stackmon_size());
+    }
+    sim_stack[words - 1U] = 0U;
+    if (stackmon_used() != 4U) {
+        fail("stackmon top word", stackmon_used(), 4U);
+    }
+    /* a frame that wrote one deep word only, paint above it */
+    sim_stack[words - 200U] = 0x12345678U;
+    if (stackmon_used() != 800U) {
+        fail("stackmon deep word", stackmon_used(), 800U);
+    }
+    sim_stack[0] = 0U;
+    if (stackmon_used() != STACK_SIZE) {
+        fail("stackmon bottom", stackmon_used(), STACK_SIZE);
+    }
+    printf("boot stackmon: %s\n", (failures == before) ? "ok" : "FAILED");
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+int boottest_run(void)
+{
+    (void)SysTick_Config(SystemCoreClock / 1000U);
+    testSequence("sequence", 0U);
+    testSequence("wrap", 0xFFFFFFFFU - 60U);
+    testStackmon();
+    printf("boot: %s\n", (failures == 0) ? "all tests pass" : "FAILED");
+    return (failures == 0) ? 0 : 1;
+}
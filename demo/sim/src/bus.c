@@ -0,0 +1,424 @@
+/*****************************************************************************
+ *   bus.c:  GPIO, SSP and I2C of the simulator, routed to the device models
+ *
+ ******************************************************************************/
+
+/*
+ * The register blocks of the simulator are plain memory, so status bits
+ * never change by themselves and the polling loops of the driver library
+ * would spin forever. The data path functions of the library are replaced
+ * here instead: the Makefile renames the library versions of the functions
+ * below to lib_*, the drivers and the application call these.
+ *
+ * GPIO: the library functions still write FIOSET/FIOCLR, the output latch
+ * is kept here and FIOPIN is recomputed from the latch (outputs) and the
+ * levels driven by the board (inputs) on every call.
+ *
+ * SSP: the device is selected by the chip select GPIO that is low, the
+ * OLED (P0.6) gets the D/C line (P2.7) with every byte, the DataFlash
+ * (P2.2) sees the edges of its chip select as well. The SD card shares
+ * P2.2 on the board but is the RAM disk of the FatFs host build here. A
+ * transfer takes 8 * CPSR * (SCR + 1) / PCLK per byte.
+ *
+ * I2C: one transfer addresses one device with an optional write and an
+ * optional read part (repeated start). A missing or busy device does not
+ * acknowledge its address. A byte takes 9 bit times of
+ * (SCLH + SCLL) / PCLK. The devices are the light sensor, the EEPROM and
+ * the SC16IS752 UART bridge (sc16is752.c).
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdlib.h>
+#include "lpc17xx_gpio.h"
+#include "lpc17xx_ssp.h"
+#include "lpc17xx_i2c.h"
+#include "lpc17xx_dac.h"
+#include "lpc17xx_clkpwr.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define GPIO_PORTS      5
+
+#define OLED_CS_PORT    0
+#define OLED_CS_PIN     (1UL << 6)
+#define OLED_DC_PORT    2
+#define OLED_DC_PIN     (1UL << 7)
+#define SPI_CS_PORT     2
+#define SPI_CS_PIN      (1UL << 2)
+#define TEMP_PORT       0
+#define TEMP_PIN        (1UL << 2)
+
+#define SSP_OVERHEAD_NS 1000U   /* chip select, FIFO handling per transfer */
+#define TRACE_BYTES     16U     /* bytes shown per trace line */
+
+typedef enum
+{
+    DEV_OLED = 0,
+    DEV_FLASH,
+    DEV_SPI_NONE,
+    DEV_LIGHT,
+    DEV_EEPROM,
+    DEV_UART2,
+    DEV_I2C_NONE,
+    DEV_COUNT
+} bus_dev_t;
+
+typedef struct
+{
+    const char *name;
+    uint32_t transfers;
+    uint32_t errors;
+    unsigned long long bytes;
+    sim_time_t busTime;
+} dev_stat_t;
+
+typedef struct
+{
+    uint8_t addrLo;
+    uint8_t addrHi;
+    bus_dev_t dev;
+    Bool (*write)(uint8_t addr, const uint8_t *buf, uint32_t len);
+    Bool (*read)(uint8_t addr, uint8_t *buf, uint32_t len);
+} i2c_dev_t;
+
+typedef struct
+{
+    char key;
+    uint8_t port;
+    uint32_t pin;
+} bus_key_t;
+
+/******************************************************************************
+ * External functions
+ *****************************************************************************/
+
+/* Library versions, renamed by the Makefile */
+void lib_GPIO_SetValue(uint8_t portNum, uint32_t bitValue);
+void lib_GPIO_ClearValue(uint8_t portNum, uint32_t bitValue);
+uint32_t lib_GPIO_ReadValue(uint8_t portNum);
+void lib_DAC_UpdateValue(LPC_DAC_TypeDef *DACx, uint32_t dac_value);
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static dev_stat_t stat[DEV_COUNT] = {
+    {"spi1 oled"}, {"spi1 flash"}, {"spi1 -"}, {"i2c2 light"}, {"i2c2 eeprom"}, {"i2c2 uart2"},
+    {"i2c2 -"}
+};
+
+static const i2c_dev_t i2cDevs[] = {
+    {0x44, 0x44, DEV_LIGHT, isl29003_write, isl29003_read},
+    {0x48, 0x48, DEV_UART2, sc16is752_write, sc16is752_read},
+    {0x50, 0x53, DEV_EEPROM, eeprom24_write, eeprom24_read},
+};
+
+/* Joystick (center, up, down, left, right) and the two buttons */
+static const bus_key_t keys[] = {
+    {'c', 0, 1UL << 17}, {'u', 2, 1UL << 3}, {'d', 0, 1UL << 15},
+    {'l', 2, 1UL << 4}, {'r', 0, 1UL << 16}, {'1', 0, 1UL << 4},
+    {'2', 1, 1UL << 31},
+};
+
+static uint32_t latch[GPIO_PORTS];
+static uint32_t pressed[GPIO_PORTS];
+
+static unsigned long long gpioCalls = 0;
+static unsigned long long dacSamples = 0;
+static uint32_t dacSum = 0;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/* Levels seen on the pins of a port, inputs are pulled up unless driven */
+static void updatePins(uint8_t port)
+{
+    uint32_t dir = sim_GPIO[port].FIODIR;
+    uint32_t in = ~pressed[port];
+
+    if (port == TEMP_PORT) {
+        in = (in & ~TEMP_PIN) | (max6576_level(sim_now) ? TEMP_PIN : 0);
+    }
+    sim_GPIO[port].FIOPIN = (latch[port] & dir) | (in & ~dir);
+}
+
+/* Output level of a pin, pins configured as inputs read high */
+static Bool outputHigh(uint8_t port, uint32_t pin)
+{
+    return ((latch[port] | ~sim_GPIO[port].FIODIR) & pin) ? TRUE : FALSE;
+}
+
+/* Passes a change of the DataFlash chip select on */
+static void chipSelect(uint8_t port)
+{
+    if (port == SPI_CS_PORT) {
+        at45db_select(outputHigh(SPI_CS_PORT, SPI_CS_PIN) ? FALSE : TRUE);
+    }
+}
+
+static void traceBytes(char *line, uint32_t size, const uint8_t *buf, uint32_t len)
+{
+    uint32_t n = 0;
+    uint32_t i;
+
+    for (i = 0; (i < len) && (i < TRACE_BYTES) && (n + 4 < size); i++) {
+        n += (uint32_t)snprintf(&line[n], size - n, " %02x", buf[i]);
+    }
+    if ((i < len) && (n + 8 < size)) {
+        snprintf(&line[n], size - n, " ... (%u)", (unsigned)len);
+    }
+}
+
+static void account(bus_dev_t dev, uint32_t bytes, sim_time_t busTime, Bool ok)
+{
+    stat[dev].transfers++;
+    stat[dev].bytes += bytes;
+    stat[dev].busTime += busTime;
+    if (!ok) {
+        stat[dev].errors++;
+    }
+}
+
+static void unsupported(const char *what)
+{
+    fprintf(stderr, "sim: %s not modeled\n", what);
+    exit(2);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Output latch of a port as far as the pins are outputs
+ *
+ *****************************************************************************/
+uint32_t bus_outputs(uint8_t port)
+{
+    return latch[port] & sim_GPIO[port].FIODIR;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Press or release a joystick direction or a button
+ *
+ * Params:
+ *   [in] key - 'c', 'u', 'd', 'l', 'r' (joystick), '1', '2' (buttons)
+ *   [in] down - TRUE to press
+ *
+ *****************************************************************************/
+void bus_press(char key, Bool down)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(keys) / sizeof(keys[0]); i++) {
+        if (keys[i].key == key) {
+            if (down) {
+                pressed[keys[i].port] |= keys[i].pin;
+            } else {
+                pressed[keys[i].port] &= ~keys[i].pin;
+            }
+            sim_trace("key %c %s\n", key, down ? "down" : "up");
+        }
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Print the transfer statistics of all devices
+ *
+ *****************************************************************************/
+void bus_report(FILE *out)
+{
+    uint32_t i;
+
+    fprintf(out, "%-12s %10s %8s %12s %12s\n", "device", "transfers", "errors", "bytes", "bus ms");
+    for (i = 0; i < DEV_COUNT; i++) {
+        if (stat[i].transfers != 0) {
+            fprintf(out, "%-12s %10u %8u %12llu %12.3f\n", stat[i].name, stat[i].transfers,
+                    stat[i].errors, stat[i].bytes, (double)stat[i].busTime / SIM_NS_PER_MS);
+        }
+    }
+    fprintf(out, "gpio calls %llu, dac samples %llu (sum %u)\n", gpioCalls, dacSamples, dacSum);
+}
+
+/******************************************************************************
+ * Hooked library functions
+ *****************************************************************************/
+
+void GPIO_SetValue(uint8_t portNum, uint32_t bitValue)
+{
+    lib_GPIO_SetValue(portNum, bitValue);
+    if (portNum < GPIO_PORTS) {
+        if (sim_traceGpio() && ((~latch[portNum] & bitValue) != 0)) {
+            sim_trace("gpio p%u set %08x\n", portNum, (unsigned)bitValue);
+        }
+        latch[portNum] |= bitValue;
+        updatePins(portNum);
+        chipSelect(portNum);
+    }
+    gpioCalls++;
+    sim_spend(SIM_HOOK_NS);
+}
+
+void GPIO_ClearValue(uint8_t portNum, uint32_t bitValue)
+{
+    lib_GPIO_ClearValue(portNum, bitValue);
+    if (portNum < GPIO_PORTS) {
+        if (sim_traceGpio() && ((latch[portNum] & bitValue) != 0)) {
+            sim_trace("gpio p%u clr %08x\n", portNum, (unsigned)bitValue);
+        }
+        latch[portNum] &= ~bitValue;
+        updatePins(portNum);
+        chipSelect(portNum);
+    }
+    gpioCalls++;
+    sim_spend(SIM_HOOK_NS);
+}
+
+uint32_t GPIO_ReadValue(uint8_t portNum)
+{
+    gpioCalls++;
+    sim_spend(SIM_HOOK_NS);
+    if (portNum < GPIO_PORTS) {
+        updatePins(portNum);
+    }
+    return lib_GPIO_ReadValue(portNum);
+}
+
+void DAC_UpdateValue(LPC_DAC_TypeDef *DACx, uint32_t dac_value)
+{
+    lib_DAC_UpdateValue(DACx, dac_value);
+    dacSamples++;
+    dacSum += dac_value & 0x3FF;
+    sim_spend(SIM_HOOK_NS);
+}
+
+int32_t SSP_ReadWrite(LPC_SSP_TypeDef *SSPx, SSP_DATA_SETUP_Type *dataCfg,
+        SSP_TRANSFER_Type xfType)
+{
+    const uint8_t *tx = (const uint8_t *)dataCfg->tx_data;
+    uint8_t *rx = (uint8_t *)dataCfg->rx_data;
+    uint32_t pclk;
+    sim_time_t busTime;
+    uint32_t i;
+    bus_dev_t dev;
+    Bool data = FALSE;
+    char line[96];
+    int32_t output = 0;
+
+    if ((xfType != SSP_TRANSFER_POLLING) || ((SSPx->CR0 & 0xF) > 7)) {
+        unsupported("SSP interrupt mode or frames over 8 bits");
+    }
+    if ((SSPx == LPC_SSP1) && !outputHigh(OLED_CS_PORT, OLED_CS_PIN)) {
+        dev = DEV_OLED;
+        data = outputHigh(OLED_DC_PORT, OLED_DC_PIN);
+    } else if ((SSPx == LPC_SSP1) && !outputHigh(SPI_CS_PORT, SPI_CS_PIN)) {
+        dev = DEV_FLASH;
+    } else {
+        dev = DEV_SPI_NONE;
+    }
+
+    for (i = 0; i < dataCfg->length; i++) {
+        uint8_t byte = (tx != NULL) ? tx[i] : 0xFF;
+        uint8_t in = 0xFF;
+        if (dev == DEV_OLED) {
+            ssd1305_write(byte, data);
+        } else if (dev == DEV_FLASH) {
+            in = at45db_transfer(byte);
+        } else {}
+        if (rx != NULL) {
+            rx[i] = in;
+        }
+    }
+    dataCfg->tx_cnt = dataCfg->length;
+    dataCfg->rx_cnt = dataCfg->length;
+    dataCfg->status = SSP_STAT_DONE;
+    if (tx != NULL) {
+        output = (int32_t)dataCfg->tx_cnt;
+    } else if (rx != NULL) {
+        output = (int32_t)dataCfg->rx_cnt;
+    }
+
+    pclk = CLKPWR_GetPCLK((SSPx == LPC_SSP0) ? CLKPWR_PCLKSEL_SSP0 : CLKPWR_PCLKSEL_SSP1);
+    busTime = ((sim_time_t)dataCfg->length * 8U * (SSPx->CPSR & 0xFF)
+            * (((SSPx->CR0 >> 8) & 0xFF) + 1U) * SIM_NS_PER_S) / pclk;
+    account(dev, dataCfg->length, busTime, TRUE);
+    if (tx != NULL) {
+        traceBytes(line, sizeof(line), tx, dataCfg->length);
+        sim_trace("%s%s%s\n", stat[dev].name, (dev == DEV_OLED) ? (data ? " data" : " cmd") : "", line);
+    } else {
+        sim_trace("%s read %u\n", stat[dev].name, (unsigned)dataCfg->length);
+    }
+    sim_spend(SSP_OVERHEAD_NS + busTime);
+    return output;
+}
+
+Status I2C_MasterTransferData(LPC_I2C_TypeDef *I2Cx, I2C_M_SETUP_Type *TransferCfg,
+        I2C_TRANSFER_OPT_Type Opt)
+{
+    uint8_t addr = (uint8_t)(TransferCfg->sl_addr7bit & 0x7F);
+    const i2c_dev_t *target = NULL;
+    uint32_t bits = 1;      /* stop */
+    uint32_t pclk;
+    sim_time_t busTime;
+    uint32_t i;
+    Bool ack = TRUE;
+    char wline[96] = "";
+    char rline[96] = "";
+    bus_dev_t dev = DEV_I2C_NONE;
+
+    if (Opt != I2C_TRANSFER_POLLING) {
+        unsupported("I2C interrupt mode");
+    }
+    for (i = 0; (I2Cx == LPC_I2C2) && (i < sizeof(i2cDevs) / sizeof(i2cDevs[0])); i++) {
+        if ((addr >= i2cDevs[i].addrLo) && (addr <= i2cDevs[i].addrHi)) {
+            target = &i2cDevs[i];
+            dev = target->dev;
+        }
+    }
+
+    TransferCfg->tx_count = 0;
+    TransferCfg->rx_count = 0;
+    TransferCfg->retransmissions_count = 0;
+    if ((TransferCfg->tx_length > 0) && (TransferCfg->tx_data != NULL)) {
+        ack = (target != NULL) && target->write(addr, TransferCfg->tx_data, TransferCfg->tx_length);
+        bits += 1 + 9;
+        if (ack) {
+            TransferCfg->tx_count = TransferCfg->tx_length;
+            bits += 9 * TransferCfg->tx_length;
+        }
+        traceBytes(wline, sizeof(wline), TransferCfg->tx_data, TransferCfg->tx_length);
+    }
+    if (ack && (TransferCfg->rx_length > 0) && (TransferCfg->rx_data != NULL)) {
+        ack = (target != NULL) && target->read(addr, TransferCfg->rx_data, TransferCfg->rx_length);
+        bits += 1 + 9;
+        if (ack) {
+            TransferCfg->rx_count = TransferCfg->rx_length;
+            bits += 9 * TransferCfg->rx_length;
+            traceBytes(rline, sizeof(rline), TransferCfg->rx_data, TransferCfg->rx_length);
+        }
+    }
+    TransferCfg->status = ack ? I2C_SETUP_STATUS_DONE : (I2C_SETUP_STATUS_NOACKF | I2C_I2STAT_M_TX_SLAW_NACK);
+
+    pclk = CLKPWR_GetPCLK((I2Cx == LPC_I2C0) ? CLKPWR_PCLKSEL_I2C0
+            : ((I2Cx == LPC_I2C1) ? CLKPWR_PCLKSEL_I2C1 : CLKPWR_PCLKSEL_I2C2));
+    busTime = ((sim_time_t)bits * (I2Cx->I2SCLH + I2Cx->I2SCLL) * SIM_NS_PER_S) / pclk;
+    account(dev, TransferCfg->tx_count + TransferCfg->rx_count, busTime, ack);
+    sim_trace("%s %02x%s%s%s%s%s\n", stat[dev].name, addr,
+            (wline[0] != '\0') ? " w" : "", wline,
+            (rline[0] != '\0') ? " r" : "", rline, ack ? "" : " nack");
+    sim_spend(busTime);
+    return ack ? SUCCESS : ERROR;
+}
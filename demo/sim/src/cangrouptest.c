@@ -0,0 +1,273 @@
+/*****************************************************************************
+ *   cangrouptest.c:  Host test of the group ranges of demo/src/cangroup.c
+ *
+ ******************************************************************************/
+
+/*
+ * Run with ./sim -x cangroup instead of the firmware. cangroup.c and the
+ * CAN driver of Lib_MCU run unmodified; the acceptance filter RAM is host
+ * memory. A bitmap of 256 groups is the reference: a join sets its groups
+ * there and must succeed exactly when the set then has at most
+ * CANGROUP_MAX_RANGES runs. After every call cangroup_isMember is compared
+ * with the bitmap for each group, and the group section the driver wrote
+ * to the filter (LPC_CANAF->SFF_GRP_sa up to EFF_sa) is decoded and must
+ * hold the runs of the bitmap, in order, merged when they overlap or
+ * touch. A rejected join must leave both as they were.
+ *
+ *   fixed     named cases: apart, inside, overlapping, touching from
+ *             either side, bridging two or three ranges, the groups 0 and
+ *             255, first > last and a fifth range apart
+ *   random    joins of random ranges, mostly short, from an empty set
+ *             again after each rejection
+ *
+ * The output is deterministic, make check compares it.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "LPC17xx.h"
+#include "cangroup.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define GROUPS              256U
+#define RANDOM_JOINS        3000U
+
+typedef struct
+{
+    uint8_t first;
+    uint8_t last;
+} range_t;
+
+typedef struct
+{
+    const char *name;
+    uint8_t first;
+    uint8_t last;
+} join_case_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint32_t failures = 0;
+static uint32_t seed = 1769U;
+static uint8_t member[GROUPS];
+
+/* Applied in order from no group joined, the expected result follows
+   from the bitmap */
+static const join_case_t fixedCases[] = {
+    {"first", 40, 49},
+    {"apart after", 100, 109},
+    {"apart before", 10, 12},
+    {"inside", 42, 45},
+    {"same", 40, 49},
+    {"overlap start", 35, 41},
+    {"overlap end", 105, 120},
+    {"touch end", 121, 121},
+    {"touch start", 34, 34},
+    {"fourth", 200, 210},
+    {"fifth apart", 60, 60},
+    {"first > last", 70, 69},
+    {"bridge two", 13, 33},
+    {"group 255", 255, 255},
+    {"fifth apart again", 150, 150},
+    {"bridge three", 50, 254},
+    {"group 0", 0, 0},
+    {"touch 0 and 10", 1, 9},
+    {"everything", 0, 255},
+};
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static uint32_t nextRandom(void)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) & 0xFFFFFFU;
+}
+
+static uint32_t getMs(void)
+{
+    return (uint32_t)(sim_now / SIM_NS_PER_MS);
+}
+
+/* Runs of set groups in the bitmap, up to max of them into list */
+static uint32_t runs(const uint8_t *map, range_t *list, uint32_t max)
+{
+    uint32_t count = 0;
+    uint32_t g;
+
+    for (g = 0; g < GROUPS; g++) {
+        if (map[g] && ((g == 0) || !map[g - 1])) {
+            if (count < max) {
+                list[count].first = (uint8_t)g;
+            }
+            count++;
+        }
+        if (map[g] && ((g == GROUPS - 1U) || !map[g + 1])) {
+            if (count <= max) {
+                list[count - 1U].last = (uint8_t)g;
+            }
+        }
+    }
+    return count;
+}
+
+/* Compares cangroup_isMember and the filter table with the bitmap */
+static void checkState(const char *what)
+{
+    range_t want[CANGROUP_MAX_RANGES];
+    uint32_t wantCount = runs(member, want, CANGROUP_MAX_RANGES);
+    uint32_t start = LPC_CANAF->SFF_GRP_sa / 4U;
+    uint32_t count = (LPC_CANAF->EFF_sa - LPC_CANAF->SFF_GRP_sa) / 4U;
+    uint32_t entry;
+    uint32_t i;
+
+    for (i = 0; i < GROUPS; i++) {
+        if (cangroup_isMember((uint8_t)i) != (member[i] ? TRUE : FALSE)) {
+            if (failures < 10U) {
+                printf("FAIL %s: group %u member %d\n", what, (unsigned)i, (int)member[i]);
+            }
+            failures++;
+            return;
+        }
+    }
+    if (count != wantCount) {
+        if (failures < 10U) {
+            printf("FAIL %s: %u ranges in the filter, %u expected\n", what,
+                    (unsigned)count, (unsigned)wantCount);
+        }
+        failures++;
+        return;
+    }
+    for (i = 0; i < count; i++) {
+        entry = LPC_CANAF_RAM->mask[start + i];
+        if ((((entry >> 16) & 0x7FFU) != (CANGROUP_ID_BASE + want[i].first))
+                || ((entry & 0x7FFU) != (CANGROUP_ID_BASE + want[i].last))) {
+            if (failures < 10U) {
+                printf("FAIL %s: filter range %u is %03x..%03x, %03x..%03x expected\n", what,
+                        (unsigned)i, (unsigned)((entry >> 16) & 0x7FFU), (unsigned)(entry & 0x7FFU),
+                        (unsigned)(CANGROUP_ID_BASE + want[i].first),
+                        (unsigned)(CANGROUP_ID_BASE + want[i].last));
+            }
+            failures++;
+            return;
+        }
+    }
+}
+
+/* Joins first..last, checks the result against the bitmap */
+static Bool join(const char *what, uint8_t first, uint8_t last)
+{
+    uint8_t next[GROUPS];
+    range_t unused[1];
+    Bool expect = FALSE;
+    Bool got;
+    uint32_t g;
+
+    memcpy(next, member, sizeof(next));
+    if (first <= last) {
+        for (g = first; g <= last; g++) {
+            next[g] = 1U;
+        }
+        expect = (runs(next, unused, 0U) <= CANGROUP_MAX_RANGES) ? TRUE : FALSE;
+    }
+    got = cangroup_join(first, last);
+    if (got != expect) {
+        if (failures < 10U) {
+            printf("FAIL %s: join %u..%u gave %d\n", what, (unsigned)first, (unsigned)last, (int)got);
+        }
+        failures++;
+    }
+    if (got) {
+        memcpy(member, next, sizeof(member));
+    }
+    checkState(what);
+    return got;
+}
+
+static void leaveAll(void)
+{
+    cangroup_leaveAll();
+    memset(member, 0, sizeof(member));
+    checkState("leave all");
+}
+
+static void testFixed(void)
+{
+    uint32_t start = failures;
+    uint32_t joined = 0;
+    uint32_t i;
+
+    leaveAll();
+    for (i = 0; i < sizeof(fixedCases) / sizeof(fixedCases[0]); i++) {
+        if (join(fixedCases[i].name, fixedCases[i].first, fixedCases[i].last)) {
+            joined++;
+        }
+    }
+    printf("cangroup fixed: %s, %u cases, %u joined\n", (failures == start) ? "ok" : "FAILED",
+            (unsigned)(sizeof(fixedCases) / sizeof(fixedCases[0])), (unsigned)joined);
+}
+
+static void testRandom(void)
+{
+    uint32_t start = failures;
+    uint32_t rejected = 0;
+    uint32_t merged = 0;
+    uint32_t before;
+    uint32_t first;
+    uint32_t len;
+    uint32_t i;
+    range_t unused[1];
+
+    leaveAll();
+    for (i = 0; i < RANDOM_JOINS; i++) {
+        first = nextRandom() % GROUPS;
+        len = ((nextRandom() & 7U) == 0U) ? (nextRandom() % 64U) : (nextRandom() % 4U);
+        if (first + len >= GROUPS) {
+            len = GROUPS - 1U - first;
+        }
+        before = runs(member, unused, 0U);
+        if (join("random", (uint8_t)first, (uint8_t)(first + len))) {
+            if (runs(member, unused, 0U) <= before) {
+                merged++;
+            }
+        } else {
+            rejected++;
+            leaveAll();
+        }
+    }
+    printf("cangroup random: %s, %u joins, %u merged into a range, %u rejected\n",
+            (failures == start) ? "ok" : "FAILED", (unsigned)RANDOM_JOINS, (unsigned)merged,
+            (unsigned)rejected);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Run all cangroup tests
+ *
+ * Returns:
+ *    0 if all pass
+ *
+ *****************************************************************************/
+int cangrouptest_run(void)
+{
+    cangroup_init(getMs);
+    testFixed();
+    testRandom();
+    printf("cangroup: %s\n", (failures == 0) ? "all tests pass" : "FAILED");
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,283 @@
+/*****************************************************************************
+ *   crcbench.c:  Test vectors and throughput of the CRC engine on the host
+ *
+ ******************************************************************************/
+
+/*
+ * Not part of the simulator: make crcbench builds Lib_MCU/src/lpc17xx_crc.c
+ * twice, with the byte table (crcbench1) and with CRC_SLICE_BY_4
+ * (crcbench4), and runs both. Each checks the library against the bitwise
+ * code it replaced:
+ *
+ *   - the check values of "123456789"
+ *   - random data of every length up to VECTOR_LEN at every alignment,
+ *     in one piece and split in two at every position
+ *   - the EMAC hash filter index of random MAC addresses against the
+ *     nibble wise emac_CRCCalc of the NXP driver
+ *
+ * and then prints ns per byte of both over a BENCH_LEN buffer. The host
+ * numbers only compare the methods; on the Cortex-M3 the table lookups
+ * cost a flash access each.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "lpc17xx_crc.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define VECTOR_LEN          64U
+#define MAC_COUNT           100000U
+#define BENCH_LEN           65536U
+#define BENCH_NS            200000000LL     /* per method */
+
+#ifdef CRC_SLICE_BY_4
+#define MODE                "slice-by-4"
+#else
+#define MODE                "byte table"
+#endif
+
+typedef uint32_t (*bench_fn_t)(const uint8_t *data, uint32_t len);
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint8_t buf[BENCH_LEN + 4U];
+static unsigned failures = 0;
+static volatile uint32_t sink;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/* emac_CRCCalc of lpc17xx_emac.c before the CRC engine */
+static int32_t refEmacCrc(uint8_t frame_no_fcs[], int32_t frame_len)
+{
+    int i;
+    int j;
+    char byte;
+    int crc;
+    int q0, q1, q2, q3;
+    crc = 0xFFFFFFFF;
+    for (i = 0; i < frame_len; i++) {
+        byte = *frame_no_fcs++;
+        for (j = 0; j < 2; j++) {
+            q3 = (((crc >> 28) ^ (byte >> 3)) & 0x00000001) ? 0x04C11DB7 : 0;
+            q2 = (((crc >> 29) ^ (byte >> 2)) & 0x00000001) ? 0x09823B6E : 0;
+            q1 = (((crc >> 30) ^ (byte >> 1)) & 0x00000001) ? 0x130476DC : 0;
+            q0 = (((crc >> 31) ^ (byte >> 0)) & 0x00000001) ? 0x2608EDB8 : 0;
+            crc = (crc << 4) ^ q3 ^ q2 ^ q1 ^ q0;
+            byte >>= 4;
+        }
+    }
+    return crc;
+}
+
+/* crc16 of kvstore.c, assets.c and proto.c before the CRC engine */
+static uint16_t refCrc16(uint16_t crc, const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+    uint8_t bit;
+    for (i = 0U; i < len; i++) {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);
+        for (bit = 0U; bit < 8U; bit++) {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint32_t refCrc32(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+    uint8_t bit;
+    for (i = 0U; i < len; i++) {
+        crc ^= data[i];
+        for (bit = 0U; bit < 8U; bit++) {
+            crc = (crc & 1U) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+static uint8_t refCrc8(uint8_t crc, const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+    uint8_t bit;
+    for (i = 0U; i < len; i++) {
+        crc ^= data[i];
+        for (bit = 0U; bit < 8U; bit++) {
+            crc = (crc & 0x80U) ? (uint8_t)((crc << 1) ^ 0x07U) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint32_t bitrev32(uint32_t x)
+{
+    uint32_t r = 0;
+    int i;
+    for (i = 0; i < 32; i++) {
+        r = (r << 1) | ((x >> i) & 1U);
+    }
+    return r;
+}
+
+static void expect(const char *what, unsigned long got, unsigned long want)
+{
+    if (got != want) {
+        if (failures < 10U) {
+            printf("FAIL %s: %#lx, expected %#lx\n", what, got, want);
+        }
+        failures++;
+    }
+}
+
+static void checkValues(void)
+{
+    const uint8_t *check = (const uint8_t *)"123456789";
+
+    expect("CRC-32 check", CRC32_Final(CRC32_Update(CRC32_Init(), check, 9)), CRC32_CHECK);
+    expect("CRC-16 check", CRC16_Final(CRC16_Update(CRC16_Init(), check, 9)), CRC16_CHECK);
+    expect("CRC-8 check", CRC8_Final(CRC8_Update(CRC8_Init(), check, 9)), CRC8_CHECK);
+    expect("CRC-16 reference check", refCrc16(0xFFFFU, check, 9), CRC16_CHECK);
+}
+
+/* Every length and alignment, in one piece and in two */
+static void checkRandom(void)
+{
+    uint32_t ofs, len, cut;
+    const uint8_t *p;
+    uint32_t crc32;
+    uint16_t crc16;
+    uint8_t crc8;
+
+    for (ofs = 0U; ofs < 4U; ofs++) {
+        for (len = 0U; len <= VECTOR_LEN; len++) {
+            p = &buf[ofs];
+            crc32 = refCrc32(CRC32_INIT, p, len);
+            crc16 = refCrc16(CRC16_INIT, p, len);
+            crc8 = refCrc8(CRC8_INIT, p, len);
+            expect("CRC-32", CRC32_Update(CRC32_Init(), p, len), crc32);
+            expect("CRC-16", CRC16_Update(CRC16_Init(), p, len), crc16);
+            expect("CRC-8", CRC8_Update(CRC8_Init(), p, len), crc8);
+            for (cut = 0U; cut <= len; cut++) {
+                expect("CRC-32 split", CRC32_Update(CRC32_Update(CRC32_Init(), p, cut), &p[cut], len - cut), crc32);
+                expect("CRC-16 split", CRC16_Update(CRC16_Update(CRC16_Init(), p, cut), &p[cut], len - cut), crc16);
+                expect("CRC-8 split", CRC8_Update(CRC8_Update(CRC8_Init(), p, cut), &p[cut], len - cut), crc8);
+            }
+        }
+    }
+}
+
+/* The register of EMAC_SetHashFilter and the hash index taken from it */
+static void checkEmacHash(void)
+{
+    uint8_t mac[6];
+    uint32_t i, j;
+    uint32_t want;
+    uint32_t got;
+
+    for (i = 0U; i < MAC_COUNT; i++) {
+        for (j = 0U; j < 6U; j++) {
+            mac[j] = (uint8_t)rand();
+        }
+        want = (uint32_t)refEmacCrc(mac, 6);
+        got = bitrev32(CRC32_Update(CRC32_Init(), mac, 6));
+        expect("EMAC CRC", got, want);
+        expect("EMAC hash", (got >> 23) & 0x3FU, (uint32_t)((int32_t)want >> 23) & 0x3FU);
+    }
+}
+
+static uint32_t benchEmac(const uint8_t *data, uint32_t len)
+{
+    return (uint32_t)refEmacCrc((uint8_t *)data, (int32_t)len);
+}
+
+static uint32_t benchCrc32(const uint8_t *data, uint32_t len)
+{
+    return CRC32_Final(CRC32_Update(CRC32_Init(), data, len));
+}
+
+static uint32_t benchRef16(const uint8_t *data, uint32_t len)
+{
+    return refCrc16(0xFFFFU, data, len);
+}
+
+static uint32_t benchCrc16(const uint8_t *data, uint32_t len)
+{
+    return CRC16_Final(CRC16_Update(CRC16_Init(), data, len));
+}
+
+static uint32_t benchCrc8(const uint8_t *data, uint32_t len)
+{
+    return CRC8_Final(CRC8_Update(CRC8_Init(), data, len));
+}
+
+static long long nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/* Returns ns per byte */
+static double bench(const char *name, bench_fn_t fn)
+{
+    long long start = nowNs();
+    long long elapsed;
+    unsigned long long bytes = 0;
+    double ns;
+
+    do {
+        sink = fn(buf, BENCH_LEN);
+        bytes += BENCH_LEN;
+        elapsed = nowNs() - start;
+    } while (elapsed < BENCH_NS);
+    ns = (double)elapsed / (double)bytes;
+    printf("  %-28s %7.3f ns/byte %8.1f MB/s\n", name, ns, 1000.0 / ns);
+    return ns;
+}
+
+/******************************************************************************
+ * Main
+ *****************************************************************************/
+
+int main(void)
+{
+    uint32_t i;
+    double bitwise;
+    double table;
+
+    srand(1769);
+    for (i = 0U; i < sizeof(buf); i++) {
+        buf[i] = (uint8_t)rand();
+    }
+    checkValues();
+    checkRandom();
+    checkEmacHash();
+    printf("crcbench, %s: %s\n", MODE, (failures == 0U) ? "all vectors pass" : "FAILED");
+    if (failures != 0U) {
+        printf("%u failures\n", failures);
+        return 1;
+    }
+
+    bitwise = bench("CRC-32 emac_CRCCalc (nibble)", benchEmac);
+    table = bench("CRC-32 CRC32_Update", benchCrc32);
+    printf("  %-28s %7.1fx\n", "CRC-32 speedup", bitwise / table);
+    bitwise = bench("CRC-16 crc16 (bitwise)", benchRef16);
+    table = bench("CRC-16 CRC16_Update", benchCrc16);
+    printf("  %-28s %7.1fx\n", "CRC-16 speedup", bitwise / table);
+    bench("CRC-8 CRC8_Update", benchCrc8);
+    return 0;
+}
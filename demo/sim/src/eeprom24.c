@@ -0,0 +1,183 @@
+/*****************************************************************************
+ *   eeprom24.c:  Model of the 24LC08 I2C EEPROM
+ *
+ ******************************************************************************/
+
+/*
+ * 1 kB in four 256 byte blocks answering at 0x50 - 0x53. A write transfer
+ * starts with the word address, the following bytes are written with the
+ * address wrapping inside the 16 byte page, as on the real part. A read
+ * continues from the current address through all blocks.
+ *
+ * After a write the part is busy for the write cycle time and does not
+ * acknowledge its address. The time is 0 by default because eeprom.c
+ * waits with a delay loop, which takes no virtual time; set it (-w) to
+ * check code that polls for the acknowledge instead.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define EEPROM_SIZE         1024
+#define EEPROM_BLOCK_SIZE   256
+#define EEPROM_PAGE_SIZE    16
+#define EEPROM_BASE_ADDR    0x50
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint8_t mem[EEPROM_SIZE];
+static uint32_t addr = 0;
+static sim_time_t writeTime = 0;
+static sim_time_t busyUntil = 0;
+static Bool initialized = FALSE;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static void init(void)
+{
+    if (!initialized) {
+        memset(mem, 0xFF, sizeof(mem));
+        initialized = TRUE;
+    }
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Set the write cycle time (tWC, max 5 ms for the 24LC08)
+ *
+ *****************************************************************************/
+void eeprom24_setWriteTime(sim_time_t ns)
+{
+    writeTime = ns;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Load the contents from a file, erased (0xFF) where the file is short
+ *
+ * Returns:
+ *    TRUE on success, FALSE if the file cannot be read
+ *
+ *****************************************************************************/
+Bool eeprom24_load(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+
+    init();
+    if (f == NULL) {
+        return FALSE;
+    }
+    (void)fread(mem, 1, sizeof(mem), f);
+    fclose(f);
+    return TRUE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Save the contents to a file
+ *
+ * Returns:
+ *    TRUE on success
+ *
+ *****************************************************************************/
+Bool eeprom24_save(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    Bool ok;
+
+    init();
+    if (f == NULL) {
+        return FALSE;
+    }
+    ok = (fwrite(mem, 1, sizeof(mem), f) == sizeof(mem)) ? TRUE : FALSE;
+    if (fclose(f) != 0) {
+        ok = FALSE;
+    }
+    return ok;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Write transfer addressed to one of the blocks
+ *
+ * Params:
+ *   [in] i2cAddr - 7 bit address, 0x50 - 0x53
+ *   [in] buf - word address followed by data
+ *   [in] len - number of bytes
+ *
+ * Returns:
+ *    FALSE if the address is not acknowledged (write cycle in progress)
+ *
+ *****************************************************************************/
+Bool eeprom24_write(uint8_t i2cAddr, const uint8_t *buf, uint32_t len)
+{
+    uint32_t page;
+    uint32_t i;
+
+    init();
+    if (sim_now < busyUntil) {
+        return FALSE;
+    }
+    if (len > 0) {
+        addr = (i2cAddr - EEPROM_BASE_ADDR) * EEPROM_BLOCK_SIZE + buf[0];
+    }
+    page = addr & ~(uint32_t)(EEPROM_PAGE_SIZE - 1);
+    for (i = 1; i < len; i++) {
+        mem[addr] = buf[i];
+        addr = page + ((addr + 1) & (EEPROM_PAGE_SIZE - 1));
+    }
+    if (len > 1) {
+        busyUntil = sim_now + writeTime;
+    }
+    return TRUE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Read transfer addressed to one of the blocks
+ *
+ * Params:
+ *   [in] i2cAddr - 7 bit address, 0x50 - 0x53
+ *   [out] buf - data from the current address on
+ *   [in] len - number of bytes
+ *
+ * Returns:
+ *    FALSE if the address is not acknowledged (write cycle in progress)
+ *
+ *****************************************************************************/
+Bool eeprom24_read(uint8_t i2cAddr, uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+
+    (void)i2cAddr;
+    init();
+    if (sim_now < busyUntil) {
+        return FALSE;
+    }
+    for (i = 0; i < len; i++) {
+        buf[i] = mem[addr];
+        addr = (addr + 1) % EEPROM_SIZE;
+    }
+    return TRUE;
+}
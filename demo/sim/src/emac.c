@@ -0,0 +1,318 @@
+/*****************************************************************************
+ *   emac.c:  EMAC of the simulator
+ *
+ ******************************************************************************/
+
+/*
+ * Replaces lpc17xx_emac.c, whose descriptors hold 32 bit buffer addresses
+ * and whose PHY sits behind MII registers the simulator cannot answer.
+ * The descriptor rings are modeled with the index registers of LPC_EMAC
+ * and buffers of the same size as on the board. With -i the wire is a TAP
+ * interface of the host: every millisecond of virtual time the DMA model
+ * sends the frames between TxConsumeIndex and TxProduceIndex to it and
+ * moves frames from it into free RX descriptors, raising RX done and TX
+ * done like the hardware. Without -i EMAC_Init fails as with no PHY.
+ *
+ * A host test is the wire instead (emac_setSink): frames given to
+ * emac_inject are received before anything of the TAP interface, with the
+ * RX status bits of the call, and transmitted frames go to the sink.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+
+#include "lpc17xx_emac.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define POLL_NS             SIM_NS_PER_MS
+#define MIN_FRAME           60U         /* without FCS, MAC2 PAD_EN */
+#define FCS_LEN             4U          /* counted in the RX size like on the board */
+#define INJECT_FRAMES       8U
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static int tap = -1;
+static Bool up = FALSE;
+static sim_time_t lastPoll = 0;
+
+static uint32_t rxBuf[EMAC_NUM_RX_FRAG][EMAC_ETH_MAX_FLEN >> 2];
+static uint32_t rxInfo[EMAC_NUM_RX_FRAG];
+static uint32_t txBuf[EMAC_NUM_TX_FRAG][EMAC_ETH_MAX_FLEN >> 2];
+static uint32_t txCtrl[EMAC_NUM_TX_FRAG];
+
+static emac_sink_t sink = NULL;
+static uint8_t injected[INJECT_FRAMES][EMAC_ETH_MAX_FLEN];
+static uint32_t injectedLen[INJECT_FRAMES];
+static uint32_t injectedFlags[INJECT_FRAMES];
+static uint32_t injectHead = 0;
+static uint32_t injectTail = 0;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static uint32_t next(uint32_t idx, uint32_t count)
+{
+    return (idx + 1 == count) ? 0 : idx + 1;
+}
+
+/* Sends what the firmware queued */
+static void transmit(void)
+{
+    uint8_t frame[EMAC_ETH_MAX_FLEN];
+    uint32_t idx;
+    uint32_t len;
+
+    while ((LPC_EMAC->Command & EMAC_CR_TX_EN) && (LPC_EMAC->TxConsumeIndex != LPC_EMAC->TxProduceIndex)) {
+        idx = LPC_EMAC->TxConsumeIndex;
+        len = (txCtrl[idx] & EMAC_TCTRL_SIZE) + 1;
+        memcpy(frame, txBuf[idx], len);
+        if (len < MIN_FRAME) {
+            memset(&frame[len], 0, MIN_FRAME - len);
+            len = MIN_FRAME;
+        }
+        sim_trace("emac tx %u\n", (unsigned)len);
+        if (sink != NULL) {
+            sink(frame, len);
+        } else if (write(tap, frame, len) < 0) {
+            sim_trace("emac tx lost\n");
+        } else {}
+        LPC_EMAC->TxConsumeIndex = next(idx, EMAC_NUM_TX_FRAG);
+        if (txCtrl[idx] & EMAC_TCTRL_INT) {
+            LPC_EMAC->IntStatus |= EMAC_INT_TX_DONE;
+        }
+    }
+}
+
+/* Fills free RX descriptors from the injected frames and the TAP
+   interface, the rest waits */
+static void receive(void)
+{
+    uint32_t idx;
+    uint32_t flags;
+    ssize_t n;
+
+    while ((LPC_EMAC->Command & EMAC_CR_RX_EN)
+            && (next(LPC_EMAC->RxProduceIndex, EMAC_NUM_RX_FRAG) != LPC_EMAC->RxConsumeIndex)) {
+        idx = LPC_EMAC->RxProduceIndex;
+        flags = EMAC_RINFO_LAST_FLAG;
+        if (injectTail != injectHead) {
+            n = (ssize_t)injectedLen[injectTail % INJECT_FRAMES];
+            memcpy(rxBuf[idx], injected[injectTail % INJECT_FRAMES], (size_t)n);
+            flags = injectedFlags[injectTail % INJECT_FRAMES];
+            injectTail++;
+        } else if (tap >= 0) {
+            n = read(tap, rxBuf[idx], EMAC_ETH_MAX_FLEN - FCS_LEN);
+        } else {
+            n = 0;
+        }
+        if (n <= 0) {
+            break;
+        }
+        sim_trace("emac rx %u\n", (unsigned)n);
+        rxInfo[idx] = ((uint32_t)n + FCS_LEN - 1) | flags;
+        LPC_EMAC->RxProduceIndex = next(idx, EMAC_NUM_RX_FRAG);
+        LPC_EMAC->IntStatus |= EMAC_INT_RX_DONE;
+    }
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Attaches the EMAC to the TAP interface name, created if missing (-i)
+ *
+ * Returns:
+ *    TRUE on success
+ *
+ *****************************************************************************/
+Bool emac_openTap(const char *name)
+{
+    struct ifreq ifr;
+    int fd;
+
+    fd = open("/dev/net/tun", O_RDWR | O_NONBLOCK);
+    if (fd < 0) {
+        return FALSE;
+    }
+    memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+    strncpy(ifr.ifr_name, name, IFNAMSIZ - 1);
+    if (ioctl(fd, TUNSETIFF, &ifr) < 0) {
+        close(fd);
+        return FALSE;
+    }
+    tap = fd;
+    fprintf(stderr, "sim: emac on %s\n", ifr.ifr_name);
+    return TRUE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Queues a frame (without FCS) for reception at the next DMA run.
+ *    flags are the RX status bits of its descriptor, EMAC_RINFO_LAST_FLAG
+ *    for a good frame.
+ *
+ * Returns:
+ *    FALSE if INJECT_FRAMES frames wait already or the frame is too long
+ *
+ *****************************************************************************/
+Bool emac_inject(const uint8_t *frame, uint32_t len, uint32_t flags)
+{
+    if (((injectHead - injectTail) >= INJECT_FRAMES) || (len > EMAC_ETH_MAX_FLEN - FCS_LEN)) {
+        return FALSE;
+    }
+    memcpy(injected[injectHead % INJECT_FRAMES], frame, len);
+    injectedLen[injectHead % INJECT_FRAMES] = len;
+    injectedFlags[injectHead % INJECT_FRAMES] = flags;
+    injectHead++;
+    return TRUE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Sends the transmitted frames to sink instead of the TAP interface and
+ *    lets EMAC_Init succeed without one, NULL to stop
+ *
+ *****************************************************************************/
+void emac_setSink(emac_sink_t newSink)
+{
+    sink = newSink;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Runs the DMA model when due
+ *
+ * Returns:
+ *    TRUE if an enabled EMAC interrupt is pending
+ *
+ *****************************************************************************/
+Bool emac_service(void)
+{
+    if (!up) {
+        return FALSE;
+    }
+    if ((sim_now - lastPoll) >= POLL_NS) {
+        lastPoll = sim_now;
+        transmit();
+        receive();
+    }
+    return (LPC_EMAC->IntStatus & LPC_EMAC->IntEnable) ? TRUE : FALSE;
+}
+
+Status EMAC_Init(EMAC_CFG_Type *EMAC_ConfigStruct)
+{
+    uint32_t i;
+
+    if ((tap < 0) && (sink == NULL)) {
+        sim_trace("emac init, no phy\n");
+        sim_spend(SIM_HOOK_NS);
+        return ERROR;
+    }
+    for (i = 0; i < EMAC_NUM_RX_FRAG; i++) {
+        rxInfo[i] = 0;
+    }
+    for (i = 0; i < EMAC_NUM_TX_FRAG; i++) {
+        txCtrl[i] = 0;
+    }
+    LPC_EMAC->SA0 = ((uint32_t)EMAC_ConfigStruct->pbEMAC_Addr[5] << 8) | EMAC_ConfigStruct->pbEMAC_Addr[4];
+    LPC_EMAC->SA1 = ((uint32_t)EMAC_ConfigStruct->pbEMAC_Addr[3] << 8) | EMAC_ConfigStruct->pbEMAC_Addr[2];
+    LPC_EMAC->SA2 = ((uint32_t)EMAC_ConfigStruct->pbEMAC_Addr[1] << 8) | EMAC_ConfigStruct->pbEMAC_Addr[0];
+    LPC_EMAC->RxDescriptorNumber = EMAC_NUM_RX_FRAG - 1;
+    LPC_EMAC->TxDescriptorNumber = EMAC_NUM_TX_FRAG - 1;
+    LPC_EMAC->RxConsumeIndex = 0;
+    LPC_EMAC->RxProduceIndex = 0;
+    LPC_EMAC->TxProduceIndex = 0;
+    LPC_EMAC->TxConsumeIndex = 0;
+    LPC_EMAC->IntEnable = EMAC_INT_RX_DONE | EMAC_INT_TX_DONE;
+    LPC_EMAC->IntStatus = 0;
+    LPC_EMAC->Command = EMAC_CR_RMII | EMAC_CR_RX_EN | EMAC_CR_TX_EN;
+    sim_trace("emac init\n");
+    up = TRUE;
+    sim_spend(SIM_HOOK_NS);
+    return SUCCESS;
+}
+
+void EMAC_IntCmd(uint32_t ulIntType, FunctionalState NewState)
+{
+    if (NewState == ENABLE) {
+        LPC_EMAC->IntEnable |= ulIntType;
+    } else {
+        LPC_EMAC->IntEnable &= ~ulIntType;
+    }
+}
+
+IntStatus EMAC_IntGetStatus(uint32_t ulIntType)
+{
+    if (LPC_EMAC->IntStatus & ulIntType) {
+        LPC_EMAC->IntStatus &= ~ulIntType;
+        return SET;
+    }
+    return RESET;
+}
+
+Bool EMAC_CheckReceiveIndex(void)
+{
+    return (LPC_EMAC->RxConsumeIndex != LPC_EMAC->RxProduceIndex) ? TRUE : FALSE;
+}
+
+Bool EMAC_CheckTransmitIndex(void)
+{
+    return (next(LPC_EMAC->TxProduceIndex, EMAC_NUM_TX_FRAG) != LPC_EMAC->TxConsumeIndex) ? TRUE : FALSE;
+}
+
+FlagStatus EMAC_CheckReceiveDataStatus(uint32_t ulRxStatType)
+{
+    return (rxInfo[LPC_EMAC->RxConsumeIndex] & ulRxStatType) ? SET : RESET;
+}
+
+uint32_t EMAC_GetReceiveDataSize(void)
+{
+    return rxInfo[LPC_EMAC->RxConsumeIndex] & EMAC_RINFO_SIZE;
+}
+
+uint8_t *EMAC_GetRxPacketPtr(void)
+{
+    return (uint8_t *)rxBuf[LPC_EMAC->RxConsumeIndex];
+}
+
+uint8_t *EMAC_GetTxPacketPtr(void)
+{
+    return (uint8_t *)txBuf[LPC_EMAC->TxProduceIndex];
+}
+
+void EMAC_SetTxPacketSize(uint32_t ulDataLen)
+{
+    txCtrl[LPC_EMAC->TxProduceIndex] = (ulDataLen - 1) | EMAC_TCTRL_INT | EMAC_TCTRL_LAST;
+}
+
+void EMAC_UpdateRxConsumeIndex(void)
+{
+    LPC_EMAC->RxConsumeIndex = next(LPC_EMAC->RxConsumeIndex, EMAC_NUM_RX_FRAG);
+}
+
+void EMAC_UpdateTxProduceIndex(void)
+{
+    LPC_EMAC->TxProduceIndex = next(LPC_EMAC->TxProduceIndex, EMAC_NUM_TX_FRAG);
+}
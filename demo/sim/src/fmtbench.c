@@ -0,0 +1,422 @@
+/*****************************************************************************
+ *   fmtbench.c:  Test vectors and speed of format.c on the host
+ *
+ ******************************************************************************/
+
+/*
+ * Not part of the simulator: make fmtbench builds demo/src/format.c with
+ * this file and runs it. It checks every format function against snprintf
+ * over the edge cases and a sweep of values, then times the routines of
+ * main.c that format.c replaced (uint32_t_to_str with len, valToString,
+ * the digit loops of write_temp_on_screen and showPresentTime) against
+ * their format.c counterparts on the same inputs.
+ *
+ * The host has a fast divider, so the ratio understates the gain on the
+ * Cortex-M3, where every UDIV costs 2..12 cycles and the old loops divide
+ * by 10 once per digit (twice in uint32_t_to_str). The old routines are
+ * built with noipa: otherwise gcc clones them for the constant arguments
+ * of this file (len 2, the out buffer), which the calls of main.c never
+ * had. For the 2 and 4 character fields the host then spends most of the
+ * time in the calls and both sides come out about even.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "format.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define BENCH_NS            200000000LL     /* per routine */
+#define BENCH_ROUNDS        8U              /* timer noise: keep the best */
+#define NOINLINE            __attribute__ ((noipa))     /* no clone for the constant args */
+
+typedef void (*bench_fn_t)(uint32_t i);
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static unsigned failures = 0;
+static volatile unsigned char sink;
+static unsigned char out[32];
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static void expect(const char *what, const unsigned char *got, const char *want)
+{
+    if (strcmp((const char *)got, want) != 0) {
+        if (failures < 10U) {
+            printf("FAIL %s: \"%s\", expected \"%s\"\n", what, got, want);
+        }
+        failures++;
+    }
+}
+
+static void checkUint(uint32_t value)
+{
+    static const uint8_t widths[] = {0U, 1U, 2U, 5U, 10U, 12U};
+    char want[32];
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(widths); i++) {
+        snprintf(want, sizeof(want), "%*u", widths[i], (unsigned)value);
+        (void)format_uint(out, value, widths[i], 0U);
+        expect("format_uint", out, want);
+        snprintf(want, sizeof(want), "%0*u", widths[i], (unsigned)value);
+        (void)format_uint(out, value, widths[i], FORMAT_ZEROPAD);
+        expect("format_uint zero pad", out, want);
+        snprintf(want, sizeof(want), "%-*u", widths[i], (unsigned)value);
+        (void)format_uint(out, value, widths[i], FORMAT_LEFT);
+        expect("format_uint left", out, want);
+    }
+}
+
+/* snprintf has no zero padding for strings: sign, zeros, then the rest */
+static void zeroPad(char *want, size_t size, const char *digits, unsigned width)
+{
+    size_t len = strlen(digits);
+    size_t neg = (digits[0] == '-') ? 1U : 0U;
+    size_t pad = (width > len) ? width - len : 0U;
+
+    snprintf(want, size, "%.*s%0*u%s", (int)neg, digits, (int)pad, 0U, &digits[neg]);
+    if (pad == 0U) {
+        snprintf(want, size, "%s", digits);
+    }
+}
+
+static void checkFixed(int32_t value)
+{
+    static const uint8_t widths[] = {2U, 3U, 4U, 5U, 8U};
+    static const uint32_t powers[10] = {
+        1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+    };
+    char digits[32];
+    char want[32];
+    uint32_t magnitude = (value < 0) ? (uint32_t)(-(value + 1)) + 1U : (uint32_t)value;
+    uint8_t decimals;
+    uint32_t w;
+
+    for (decimals = 0U; decimals < 10U; decimals++) {
+        if (decimals == 0U) {
+            snprintf(digits, sizeof(digits), "%s%u", (value < 0) ? "-" : "", (unsigned)magnitude);
+        } else {
+            snprintf(digits, sizeof(digits), "%s%u.%0*u", (value < 0) ? "-" : "",
+                    (unsigned)(magnitude / powers[decimals]), decimals,
+                    (unsigned)(magnitude % powers[decimals]));
+        }
+        for (w = 0U; w < sizeof(widths); w++) {
+            snprintf(want, sizeof(want), "%*s", widths[w], digits);
+            (void)format_fixed(out, value, decimals, widths[w], 0U);
+            expect("format_fixed", out, want);
+            zeroPad(want, sizeof(want), digits, widths[w]);
+            (void)format_fixed(out, value, decimals, widths[w], FORMAT_ZEROPAD);
+            expect("format_fixed zero pad", out, want);
+            snprintf(want, sizeof(want), "%-*s", widths[w], digits);
+            (void)format_fixed(out, value, decimals, widths[w], FORMAT_LEFT);
+            expect("format_fixed left", out, want);
+        }
+    }
+}
+
+static void checkValues(void)
+{
+    static const uint32_t edges[] = {
+        0U, 1U, 9U, 10U, 99U, 100U, 999U, 1000U, 65535U, 99999U, 100000U,
+        999999999U, 1000000000U, 4294967295U
+    };
+    static const int32_t fixed[] = {
+        0, 1, -1, 9, -9, 53, -53, 100, -100, 2147483647, -2147483647 - 1
+    };
+    char want[32];
+    datetime_t dt;
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(edges) / sizeof(edges[0]); i++) {
+        checkUint(edges[i]);
+    }
+    for (i = 0U; i < 100000U; i += 7U) {
+        checkUint(i);
+    }
+    for (i = 0U; i < sizeof(fixed) / sizeof(fixed[0]); i++) {
+        checkFixed(fixed[i]);
+    }
+    for (i = 0U; i < 2000U; i++) {
+        checkFixed((int32_t)i - 1000);
+    }
+    (void)format_fixed(out, -5, 1U, 4U, FORMAT_ZEROPAD);
+    expect("format_fixed zero pad", out, "-0.5");
+    (void)format_fixed(out, -5, 1U, 6U, FORMAT_ZEROPAD);
+    expect("format_fixed zero pad", out, "-000.5");
+    for (i = FORMAT_MAX_DECIMALS + 1U; i < 256U; i++) {
+        out[0] = 'x';
+        if (format_fixed(out, -2147483647 - 1, (uint8_t)i, 4U, 0U) != 0U) {
+            out[0] = 'x';
+        }
+        expect("format_fixed decimals over the limit", out, "");
+    }
+
+    memset(&dt, 0, sizeof(dt));
+    dt.year = 2026U;
+    dt.month = 10U;
+    dt.dom = 9U;
+    dt.hour = 7U;
+    dt.min = 5U;
+    dt.sec = 59U;
+    (void)format_date(out, &dt);
+    expect("format_date", out, "2026-10-09");
+    (void)format_time(out, &dt);
+    expect("format_time", out, "07:05:59");
+    for (i = 0U; i < 24U * 60U; i++) {
+        snprintf(want, sizeof(want), "%02u:%02u", (unsigned)(i / 60U), (unsigned)(i % 60U));
+        (void)format_hhmm(out, (uint8_t)(i / 60U), (uint8_t)(i % 60U));
+        expect("format_hhmm", out, want);
+    }
+}
+
+/* main.c before format.c ---------------------------------------------------*/
+
+static NOINLINE uint32_t len(uint32_t val)
+{
+    uint32_t i = 0;
+    uint32_t param_val = val;
+    while (param_val > 0U) {
+        i++;
+        param_val /= 10;
+    }
+    return i;
+}
+
+static NOINLINE void uint32_t_to_str(uint32_t val, unsigned char *str)
+{
+    uint32_t val_len = len(val);
+    uint32_t param_val = val;
+    for (int32_t i = (int32_t)val_len - 1; i >= 0; i--) {
+        str[i] = (char)((param_val % 10U) + '0');
+        param_val /= 10;
+    }
+    for (int32_t i = val_len; i < 6; i++) {
+        str[i] = ' ';
+    }
+    str[5] = '\0';
+}
+
+static NOINLINE void valToString(uint32_t value, unsigned char *str, uint8_t len)
+{
+    int i = len;
+    uint32_t param_val = value;
+    str[i] = '\0';
+    for (int j = i - 1; j >= 0; j--) {
+        str[j] = (char)((uint8_t)(param_val % 10U) + '0');
+        param_val = param_val / 10U;
+    }
+}
+
+/* write_temp_on_screen with the reading passed in */
+static NOINLINE void writeTemp(int32_t temp, unsigned char *temp_str)
+{
+    for (int32_t i = 3; i >= 0; i--) {
+        temp_str[i] = (char) ((temp % 10) + '0');
+        if (temp <= 0) {
+            break;
+        }
+        if (i == 2) {
+            temp_str[i] = '.';
+        } else {
+            temp = temp / 10;
+        }
+    }
+    temp_str[4] = ' ';
+    temp_str[5] = 'C';
+    temp_str[6] = '\0';
+}
+
+/* The date and time loops of showPresentTime */
+static NOINLINE void presentTime(const datetime_t *now, unsigned char *date_str, unsigned char *time_str)
+{
+    uint16_t year = now->year;
+    uint8_t month = now->month;
+    uint8_t day = now->dom;
+    uint8_t hour = now->hour;
+    uint8_t minute = now->min;
+    uint8_t sec = now->sec;
+
+    for (int8_t i = 3; i >= 0; i--) {
+        date_str[i] = (unsigned char)((uint8_t)(year % 10U) + '0');
+        if (year == 0U) {
+            break;
+        }
+        year = year / 10U;
+    }
+    date_str[4] = '-';
+    for (uint8_t i = 6U; i >= 5U; i--) {
+        date_str[i] = (unsigned char)((uint8_t)(month % 10U) + '0');
+        if (month == 0U) {
+            break;
+        }
+        month = month / 10U;
+    }
+    date_str[7] = '-';
+    for (uint8_t i = 9U; i >= 8U; i--) {
+        date_str[i] = (unsigned char)((uint8_t)(day % 10U) + '0');
+        if (day == 0U) {
+            break;
+        }
+        day = day / 10U;
+    }
+    for (int8_t i = 1; i >= 0; i--) {
+        time_str[i] = (unsigned char)((uint8_t)(hour % 10U) + '0');
+        hour = hour / 10U;
+    }
+    time_str[2] = ':';
+    for (uint8_t i = 4U; i >= 3U; i--) {
+        time_str[i] = (unsigned char)((uint8_t)(minute % 10U) + '0');
+        minute = minute / 10U;
+    }
+    time_str[5] = ':';
+    for (uint8_t i = 7U; i >= 6U; i--) {
+        time_str[i] = (unsigned char)((uint8_t)(sec % 10U) + '0');
+        sec = sec / 10U;
+    }
+}
+
+/* Benchmarked calls, i sweeps the inputs -----------------------------------*/
+
+static void timeDatetime(datetime_t *dt, uint32_t i)
+{
+    dt->year = (uint16_t)(2000U + (i & 63U));
+    dt->month = (uint8_t)(1U + (i % 12U));
+    dt->dom = (uint8_t)(1U + (i & 15U));
+    dt->hour = (uint8_t)(i % 24U);
+    dt->min = (uint8_t)(i & 31U);
+    dt->sec = (uint8_t)((i >> 5) & 31U);
+}
+
+static void oldLight(uint32_t i)
+{
+    uint32_t_to_str(i % 100000U, out);
+    sink = out[0];
+}
+
+static void newLight(uint32_t i)
+{
+    (void)format_uint(out, i % 100000U, 5U, FORMAT_LEFT);
+    sink = out[0];
+}
+
+static void oldField(uint32_t i)
+{
+    valToString(i & 63U, out, 2U);
+    sink = out[0];
+}
+
+static void newField(uint32_t i)
+{
+    (void)format_uint(out, i & 63U, 2U, FORMAT_ZEROPAD);
+    sink = out[0];
+}
+
+static void oldTemp(uint32_t i)
+{
+    writeTemp((int32_t)(i & 511U), out);
+    sink = out[0];
+}
+
+static void newTemp(uint32_t i)
+{
+    (void)format_fixed(out, (int32_t)(i & 511U), 1U, 4U, 0U);
+    sink = out[0];
+}
+
+static void oldDatetime(uint32_t i)
+{
+    datetime_t dt;
+
+    timeDatetime(&dt, i);
+    presentTime(&dt, out, &out[16]);
+    sink = out[0];
+}
+
+static void newDatetime(uint32_t i)
+{
+    datetime_t dt;
+
+    timeDatetime(&dt, i);
+    (void)format_date(out, &dt);
+    (void)format_time(&out[16], &dt);
+    sink = out[0];
+}
+
+static long long nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/* Returns ns per call, the best of BENCH_ROUNDS rounds */
+static double bench(const char *name, bench_fn_t fn)
+{
+    long long start;
+    long long elapsed;
+    unsigned long long calls;
+    uint32_t i;
+    uint32_t round;
+    double ns;
+    double best = 0.0;
+
+    for (round = 0U; round < BENCH_ROUNDS; round++) {
+        start = nowNs();
+        calls = 0;
+        do {
+            for (i = 0U; i < 4096U; i++) {
+                fn((uint32_t)calls + i);
+            }
+            calls += 4096U;
+            elapsed = nowNs() - start;
+        } while (elapsed < (BENCH_NS / BENCH_ROUNDS));
+        ns = (double)elapsed / (double)calls;
+        if ((round == 0U) || (ns < best)) {
+            best = ns;
+        }
+    }
+    printf("  %-34s %7.2f ns/call\n", name, best);
+    return best;
+}
+
+static void compare(const char *oldName, bench_fn_t oldFn, const char *newName, bench_fn_t newFn)
+{
+    double before = bench(oldName, oldFn);
+    double after = bench(newName, newFn);
+
+    printf("  %-34s %7.1fx\n", "speedup", before / after);
+}
+
+/******************************************************************************
+ * Main
+ *****************************************************************************/
+
+int main(void)
+{
+    checkValues();
+    printf("fmtbench: %s\n", (failures == 0U) ? "all vectors pass" : "FAILED");
+    if (failures != 0U) {
+        printf("%u failures\n", failures);
+        return 1;
+    }
+
+    compare("light uint32_t_to_str", oldLight, "light format_uint", newLight);
+    compare("field valToString", oldField, "field format_uint", newField);
+    compare("temperature write_temp_on_screen", oldTemp, "temperature format_fixed", newTemp);
+    compare("date/time showPresentTime", oldDatetime, "date/time format_date/_time", newDatetime);
+    return 0;
+}
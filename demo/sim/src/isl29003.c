@@ -0,0 +1,158 @@
+/*****************************************************************************
+ *   isl29003.c:  Model of the ISL29003 light sensor
+ *
+ ******************************************************************************/
+
+/*
+ * Register file of eight bytes behind a register pointer. A write sets the
+ * pointer with its first byte and stores the rest with auto increment, a
+ * read returns registers from the pointer on. Pointer values with bit 6
+ * set are the clear interrupt command.
+ *
+ * The sensor data (registers 4 and 5) follows the simulated illuminance
+ * immediately, the integration time is not modeled:
+ *
+ *   DATA = lux * 2^n / k, limited to 2^n - 1
+ *
+ * with n from the width bits of COMMAND and k from the gain bits of
+ * CONTROL (Rext = 100k, as light.c assumes). Mode 1 (infrared only) reads
+ * a quarter of the value, the other modes the full value.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define REG_CMD         0x00
+#define REG_CTRL        0x01
+#define REG_LSB_SENSOR  0x04
+#define REG_MSB_SENSOR  0x05
+#define REG_COUNT       8
+
+#define PTR_CLEAR_INT   0x40
+
+#define CMD_ENABLE      (1 << 7)
+#define CMD_MODE(c)     (((c) >> 2) & 3)
+#define CMD_WIDTH(c)    ((c) & 3)
+#define CTRL_GAIN(c)    (((c) >> 2) & 3)
+#define CTRL_INT_FLAG   (1 << 5)
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static const uint32_t rangeK[4] = {973, 3892, 15568, 62272};
+static const uint8_t widthBits[4] = {16, 12, 8, 4};
+
+static uint8_t reg[REG_COUNT];
+static uint8_t ptr = 0;
+static uint32_t lux = 300;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static void updateData(void)
+{
+    uint32_t n = widthBits[CMD_WIDTH(reg[REG_CMD])];
+    uint32_t max = (1UL << n) - 1U;
+    unsigned long long data = 0;
+
+    if ((reg[REG_CMD] & CMD_ENABLE) != 0) {
+        data = ((unsigned long long)lux << n) / rangeK[CTRL_GAIN(reg[REG_CTRL])];
+        if (CMD_MODE(reg[REG_CMD]) == 1) {
+            data /= 4U;
+        }
+        if (data > max) {
+            data = max;
+        }
+    }
+    reg[REG_LSB_SENSOR] = (uint8_t)data;
+    reg[REG_MSB_SENSOR] = (uint8_t)(data >> 8);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Set the illuminance at the sensor
+ *
+ * Params:
+ *   [in] newLux - illuminance in lux
+ *
+ *****************************************************************************/
+void isl29003_setLux(uint32_t newLux)
+{
+    lux = newLux;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Write transfer addressed to the sensor
+ *
+ * Params:
+ *   [in] i2cAddr - 7 bit address, 0x44
+ *   [in] buf - register pointer followed by register values
+ *   [in] len - number of bytes
+ *
+ * Returns:
+ *    TRUE, every byte is acknowledged
+ *
+ *****************************************************************************/
+Bool isl29003_write(uint8_t i2cAddr, const uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+
+    (void)i2cAddr;
+    if (len > 0) {
+        ptr = buf[0];
+        if ((ptr & PTR_CLEAR_INT) != 0) {
+            reg[REG_CTRL] &= ~CTRL_INT_FLAG;
+        }
+        ptr &= REG_COUNT - 1;
+    }
+    for (i = 1; i < len; i++) {
+        if ((ptr != REG_LSB_SENSOR) && (ptr != REG_MSB_SENSOR)) {
+            reg[ptr] = buf[i];
+        }
+        ptr = (ptr + 1) & (REG_COUNT - 1);
+    }
+    return TRUE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Read transfer addressed to the sensor
+ *
+ * Params:
+ *   [in] i2cAddr - 7 bit address, 0x44
+ *   [out] buf - register values from the register pointer on
+ *   [in] len - number of bytes
+ *
+ * Returns:
+ *    TRUE
+ *
+ *****************************************************************************/
+Bool isl29003_read(uint8_t i2cAddr, uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+
+    (void)i2cAddr;
+    updateData();
+    for (i = 0; i < len; i++) {
+        buf[i] = reg[ptr];
+        ptr = (ptr + 1) & (REG_COUNT - 1);
+    }
+    return TRUE;
+}
@@ -0,0 +1,425 @@
+/*****************************************************************************
+ *   kvtest.c:  Host test of demo/src/kvstore.c on the DataFlash model
+ *
+ ******************************************************************************/
+
+/*
+ * Run with ./sim -x kvstore instead of the firmware. kvstore.c and flash.c
+ * run unmodified against the AT45DB081D model (at45db.c) behind the SSP
+ * hook; every kv_init is a reboot, the RAM index is rebuilt from the flash.
+ * SysTick runs at 1 ms as in the firmware, flash.c polls the status of a
+ * write or erase from it.
+ * A reference table of the expected contents is kept here and compared
+ * with kv_get for every key after each step:
+ *
+ *   basic       put, overwrite, get with short buffers, delete, parameter
+ *               errors, remount
+ *   wrap        many puts of changing length over a few dozen keys with
+ *               deletes in between, until the log has wrapped around the
+ *               store several times, while some keys written first are
+ *               never touched again and have to be carried along by the
+ *               collection; remounts on the way, so the index is rebuilt
+ *               from sequence numbers with the tail block anywhere
+ *   tombstone   a deleted key whose tombstone is collected stays deleted
+ *               across remounts, on a log that has wrapped already
+ *   powerfail   ten puts and deletes of different keys on a full log, so
+ *               a block is collected on the way, with the supply cut
+ *               during each program/erase operation in turn (including
+ *               those between a page and its commit byte); after the
+ *               reboot each key must hold its old or its new value, no
+ *               step may be visible without the earlier ones, and the
+ *               store must keep working
+ *
+ * The output has no timing and is deterministic, make check compares it.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "lpc17xx_ssp.h"
+#include "flash.h"
+#include "kvstore.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define KEYS                40U
+#define CHURN_KEYS          32U     /* the others are written once */
+#define VALUE_MAX           248U    /* 264 byte page less the header */
+#define WRAP_OPS            3000U
+#define REMOUNT_EVERY       250U
+#define FAIL_STEPS          10U
+#define FLASH_BYTES         (4096U * 264U)
+
+typedef struct
+{
+    char key[KV_MAX_KEY + 1U];
+    Bool present;
+    uint16_t len;
+    uint8_t value[VALUE_MAX];
+} ref_entry_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static ref_entry_t ref[KEYS];
+static uint32_t seed = 1769U;
+static uint32_t failures = 0;
+static uint8_t buf[VALUE_MAX + 16U];
+static uint8_t image[FLASH_BYTES];
+static uint8_t saved[FLASH_BYTES];
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static uint32_t nextRandom(void)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) & 0xFFFFFFU;
+}
+
+static void fail(const char *what, const char *key, int32_t got)
+{
+    if (failures < 10U) {
+        printf("FAIL %s %s: %d\n", what, key, (int)got);
+    }
+    failures++;
+}
+
+static void makeValue(ref_entry_t *e, uint16_t len)
+{
+    uint16_t i;
+
+    e->len = len;
+    for (i = 0; i < len; i++) {
+        e->value[i] = (uint8_t)nextRandom();
+    }
+}
+
+/* Compares one key with the reference, TRUE if it matches */
+static Bool matches(const ref_entry_t *e)
+{
+    int32_t got = kv_get(e->key, buf, sizeof(buf));
+
+    if (!e->present) {
+        return (got == KV_ERR_NOTFOUND) ? TRUE : FALSE;
+    }
+    return ((got == (int32_t)e->len) && (memcmp(buf, e->value, e->len) == 0)) ? TRUE : FALSE;
+}
+
+static void checkAll(const char *step)
+{
+    uint32_t i;
+
+    for (i = 0; i < KEYS; i++) {
+        if (!matches(&ref[i])) {
+            fail(step, ref[i].key, kv_get(ref[i].key, buf, sizeof(buf)));
+        }
+    }
+}
+
+static void put(uint32_t k, uint16_t len)
+{
+    int32_t res;
+
+    makeValue(&ref[k], len);
+    res = kv_put(ref[k].key, ref[k].value, len);
+    if (res != KV_OK) {
+        fail("put", ref[k].key, res);
+    }
+    ref[k].present = TRUE;
+}
+
+static void del(uint32_t k)
+{
+    int32_t res = kv_delete(ref[k].key);
+
+    if (res != (ref[k].present ? KV_OK : KV_ERR_NOTFOUND)) {
+        fail("delete", ref[k].key, res);
+    }
+    ref[k].present = FALSE;
+}
+
+/* Cold boot: mounting a blank flash first clears what kvstore kept in RAM */
+static void reboot(const char *step)
+{
+    uint32_t size;
+    uint8_t *mem = at45db_memory(&size);
+    int32_t res;
+
+    memcpy(image, mem, size);
+    memset(mem, 0xFF, size);
+    (void)kv_init();
+    memcpy(mem, image, size);
+    res = kv_init();
+    if (res < 0) {
+        fail("kv_init", step, res);
+    }
+}
+
+static void remount(const char *step)
+{
+    reboot(step);
+    checkAll(step);
+}
+
+/* Blank flash and an empty reference */
+static void format(void)
+{
+    uint32_t size;
+    uint8_t *mem = at45db_memory(&size);
+    uint32_t i;
+
+    memset(mem, 0xFF, size);
+    for (i = 0; i < KEYS; i++) {
+        snprintf(ref[i].key, sizeof(ref[i].key), (i & 1U) ? "key%u" : "k-%u-long", (unsigned)i);
+        ref[i].present = FALSE;
+    }
+    if (kv_init() != 0) {
+        fail("format", "", -1);
+    }
+}
+
+static void testBasic(void)
+{
+    static const char big[] = "the value of a key can use the rest of the page";
+    int32_t res;
+
+    format();
+    put(0, 1);
+    put(1, 0);
+    put(2, kv_maxValue(ref[2].key));
+    checkAll("basic put");
+    put(0, 100);
+    checkAll("basic overwrite");
+
+    res = kv_get(ref[0].key, buf, 10U);
+    if ((res != 100) || (memcmp(buf, ref[0].value, 10U) != 0)) {
+        fail("short buffer", ref[0].key, res);
+    }
+    del(1);
+    del(1);
+    checkAll("basic delete");
+    if (kv_put("", big, 1U) != KV_ERR_PARAM) {
+        fail("empty key", "", 0);
+    }
+    if (kv_put("seventeen chars!!", big, 1U) != KV_ERR_PARAM) {
+        fail("long key", "", 0);
+    }
+    if (kv_put(ref[3].key, big, (uint16_t)(kv_maxValue(ref[3].key) + 1U)) != KV_ERR_PARAM) {
+        fail("long value", ref[3].key, 0);
+    }
+    remount("basic remount");
+    put(1, sizeof(big));
+    remount("basic put after remount");
+    printf("kvstore basic: %s, %u keys after remount\n", (failures == 0) ? "ok" : "FAILED",
+            (unsigned)kv_init());
+}
+
+/* Random puts of random length and some deletes on the churn keys */
+static void churn(uint32_t ops)
+{
+    uint32_t n;
+
+    for (n = 1; n <= ops; n++) {
+        uint32_t k = nextRandom() % CHURN_KEYS;
+        if ((nextRandom() % 8U) == 0U) {
+            del(k);
+        } else {
+            put(k, (uint16_t)(nextRandom() % (kv_maxValue(ref[k].key) + 1U)));
+        }
+        if ((n % REMOUNT_EVERY) == 0U) {
+            remount("wrap remount");
+        }
+    }
+}
+
+static void testWrap(void)
+{
+    at45db_stat_t before;
+    at45db_stat_t after;
+    uint32_t start = failures;
+    uint32_t i;
+
+    format();
+    for (i = CHURN_KEYS; i < KEYS; i++) {
+        put(i, (uint16_t)(5U * i));
+    }
+    at45db_getStat(&before);
+    churn(WRAP_OPS);
+    remount("wrap end");
+    at45db_getStat(&after);
+    printf("kvstore wrap: %s, %u operations, %u page programs, %u block erases\n",
+            (failures == start) ? "ok" : "FAILED", (unsigned)WRAP_OPS,
+            (unsigned)(after.programs - before.programs), (unsigned)(after.erases - before.erases));
+}
+
+static void testTombstone(void)
+{
+    uint32_t start = failures;
+    uint32_t i;
+
+    /* start on a wrapped log, the tail block is only known from the scan */
+    format();
+    churn(WRAP_OPS);
+    for (i = 0; i < 4U; i++) {
+        put(i, 50);
+    }
+    put(0, 60);
+    remount("tombstone start");
+    del(0);
+    /* enough traffic on the other keys to collect every block once */
+    for (i = 0; i < 2U * 1024U; i++) {
+        put(1U + (i % 3U), 200);
+    }
+    remount("tombstone remount");
+    printf("kvstore tombstone: %s\n", (failures == start) ? "ok" : "FAILED");
+}
+
+/* Key of a step of the power fail test, each step changes another key */
+static uint32_t stepKey(uint32_t step)
+{
+    return (step == 0U) ? (KEYS - 1U) : (step - 1U);
+}
+
+/* New key, overwrites and a delete, more pages than a block */
+static void failStep(uint32_t step)
+{
+    if (step == 2U) {
+        del(stepKey(step));
+    } else {
+        put(stepKey(step), (uint16_t)(20U + step * 10U));
+    }
+}
+
+/* The same step again, unchecked: after the cut the results are void */
+static void replayStep(const ref_entry_t *e)
+{
+    if (e->present) {
+        (void)kv_put(e->key, e->value, e->len);
+    } else {
+        (void)kv_delete(e->key);
+    }
+}
+
+static void testPowerFail(void)
+{
+    static ref_entry_t before[KEYS];
+    static ref_entry_t after[KEYS];
+    at45db_stat_t s0;
+    at45db_stat_t s1;
+    uint32_t size;
+    uint8_t *mem = at45db_memory(&size);
+    uint32_t start = failures;
+    uint32_t ops;
+    uint32_t cut;
+    uint32_t i;
+
+    /* a full log, so the steps below have to collect the oldest block */
+    format();
+    for (i = 0; i < KEYS - 1U; i++) {
+        put(i, 100);
+    }
+    for (i = 0; i < 1100U; i++) {
+        put(20U + (i % 4U), 200);
+    }
+    remount("powerfail setup");
+    memcpy(saved, mem, size);
+    memcpy(before, ref, sizeof(ref));
+
+    /* all steps without a cut, for the operation count and the result */
+    at45db_getStat(&s0);
+    for (i = 0; i < FAIL_STEPS; i++) {
+        failStep(i);
+    }
+    at45db_getStat(&s1);
+    memcpy(after, ref, sizeof(ref));
+    ops = (s1.programs + s1.erases) - (s0.programs + s0.erases);
+
+    for (cut = 0; cut < ops; cut++) {
+        Bool done[FAIL_STEPS];
+        uint32_t k;
+
+        memcpy(mem, saved, size);
+        memcpy(ref, before, sizeof(ref));
+        reboot("power fail start");
+        at45db_powerFail(cut);
+        for (i = 0; i < FAIL_STEPS; i++) {
+            replayStep(&after[stepKey(i)]);
+        }
+        if (!at45db_powerOn()) {
+            fail("power fail", "no cut", (int32_t)cut);
+        }
+        reboot("power fail reboot");
+        /* each step fully done or not at all, and never after a lost one */
+        for (i = 0; i < FAIL_STEPS; i++) {
+            k = stepKey(i);
+            done[i] = matches(&after[k]);
+            if (!done[i] && !matches(&before[k])) {
+                fail("power fail torn key", before[k].key, (int32_t)cut);
+            }
+            if ((i > 0U) && done[i] && !done[i - 1U]) {
+                fail("power fail order", before[k].key, (int32_t)cut);
+            }
+            ref[k] = done[i] ? after[k] : before[k];
+        }
+        checkAll("power fail result");
+        /* and the store still takes writes */
+        put(KEYS - 2U, 77);
+        remount("power fail put after reboot");
+    }
+    printf("kvstore powerfail: %s, cut at each of %u operations\n",
+            (failures == start) ? "ok" : "FAILED", (unsigned)ops);
+}
+
+static void initSsp(void)
+{
+    SSP_CFG_Type cfg;
+
+    SSP_ConfigStructInit(&cfg);
+    SSP_Init(LPC_SSP1, &cfg);
+    SSP_Cmd(LPC_SSP1, ENABLE);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Run all kvstore tests
+ *
+ * Returns:
+ *    0 if all pass
+ *
+ *****************************************************************************/
+int kvtest_run(void)
+{
+    at45db_stat_t s;
+
+    initSsp();
+    /* SysTick_Handler of main.c runs flash_tick, waits for the device sleep */
+    (void)SysTick_Config(SystemCoreClock / 1000U);
+    if (!flash_init()) {
+        printf("kvstore: flash_init failed\n");
+        return 1;
+    }
+    testBasic();
+    testWrap();
+    testTombstone();
+    testPowerFail();
+    at45db_getStat(&s);
+    if (s.errors != 0) {
+        printf("FAIL %u DataFlash commands while busy\n", (unsigned)s.errors);
+        failures++;
+    }
+    printf("kvstore: %s\n", (failures == 0) ? "all tests pass" : "FAILED");
+    return (failures == 0) ? 0 : 1;
+}
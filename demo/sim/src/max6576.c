@@ -0,0 +1,82 @@
+/*****************************************************************************
+ *   max6576.c:  Model of the MAX6576 temperature sensor
+ *
+ ******************************************************************************/
+
+/*
+ * The sensor drives P0.2 (J25 in its default position, the firmware keeps
+ * UART0 off that pin) with a square wave whose period is proportional
+ * to the absolute temperature. TS1 = TS0 = 0 on the base board, which
+ * gives 10 us per Kelvin. The level is a pure function of the virtual
+ * time, so temp_read sees the edges at exactly the same calls every run.
+ * Disconnected (-t none), the pin stays high as with J25 open.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define NS_PER_TENTH_K   1000U      /* 10 us per K */
+#define ZERO_C_TENTHS_K  2731       /* 273.15 K, rounded like temp.c */
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static sim_time_t halfPeriod = ((ZERO_C_TENTHS_K + 220) * NS_PER_TENTH_K) / 2U;
+static Bool connected = TRUE;
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Set the temperature the sensor reports
+ *
+ * Params:
+ *   [in] tenthsC - temperature in tenths of a degree Celsius
+ *
+ *****************************************************************************/
+void max6576_setTemp(int32_t tenthsC)
+{
+    if (tenthsC < -ZERO_C_TENTHS_K + 10) {
+        tenthsC = -ZERO_C_TENTHS_K + 10;
+    }
+    halfPeriod = ((sim_time_t)(tenthsC + ZERO_C_TENTHS_K) * NS_PER_TENTH_K) / 2U;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Remove the sensor, its output stays high
+ *
+ *****************************************************************************/
+void max6576_disconnect(void)
+{
+    connected = FALSE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Level of the sensor output
+ *
+ * Params:
+ *   [in] now - virtual time
+ *
+ * Returns:
+ *    0 or 1
+ *
+ *****************************************************************************/
+uint32_t max6576_level(sim_time_t now)
+{
+    return connected ? (uint32_t)((now / halfPeriod) & 1U) : 1U;
+}
@@ -0,0 +1,462 @@
+/*****************************************************************************
+ *   nettest.c:  Host test of demo/src/net.c on the EMAC model
+ *
+ ******************************************************************************/
+
+/*
+ * Run with ./sim -x net instead of the firmware. net.c runs unmodified on
+ * the EMAC of the simulator (emac.c) with the test as the wire: frames are
+ * built here with a checksum routine of their own, given to emac_inject
+ * and received through the DMA model and ENET_IRQHandler of main.c; the
+ * replies come back through emac_setSink and are checked field by field,
+ * checksums included. The request handler answers with the payload
+ * reversed.
+ *
+ *   arp       a request for the station gets a reply padded to 60 bytes,
+ *             one for another address none
+ *   udp       requests with and without UDP checksum, of odd and even
+ *             length, with IP options and of the longest payload are
+ *             answered
+ *   ignored   a bad IP or UDP checksum, another port or address, a
+ *             fragment, a response type, a payload too long, a truncated
+ *             datagram and a frame of another EtherType get no reply; a
+ *             frame with a CRC error counts as an RX error
+ *   burst     8 requests for 4 RX descriptors at once: each one waits in
+ *             its descriptor until net_poll, all are answered in order
+ *
+ * The statistics of net.c are printed at the end. The output is
+ * deterministic, make check compares it.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "lpc17xx_emac.h"
+#include "net.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define REPLY_MAX           8U
+#define FRAME_MAX           128U
+#define PEER_PORT           50123U
+#define BURST               8U          /* frames emac_inject holds */
+#define MIN_FRAME           60U
+
+typedef struct
+{
+    uint8_t data[FRAME_MAX];
+    uint32_t len;
+} frame_t;
+
+/* Variations of a request, zero for a good one */
+typedef struct
+{
+    uint8_t optWords;           /* IP options, 32 bit words */
+    Bool noUdpSum;
+    Bool badIpSum;
+    Bool badUdpSum;
+    uint16_t port;              /* 0 for NET_UDP_PORT */
+    Bool otherIp;
+    uint16_t frag;
+    uint32_t truncate;          /* bytes cut from the end of the frame */
+} variant_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint32_t failures = 0;
+
+static const uint8_t ownMac[6] = NET_MAC;
+static const uint8_t ownIp[4] = NET_IP;
+static const uint8_t peerMac[6] = {0x02, 0x00, 0x00, 0x00, 0x17, 0x69};
+static const uint8_t peerIp[4] = {192, 168, 0, 7};
+static const uint8_t otherIp[4] = {192, 168, 0, 51};
+
+static frame_t replies[REPLY_MAX];
+static uint32_t replyCount = 0;
+static uint32_t replyLost = 0;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static void fail(const char *what, uint32_t a, uint32_t b)
+{
+    if (failures < 10U) {
+        printf("FAIL %s: %u %u\n", what, (unsigned)a, (unsigned)b);
+    }
+    failures++;
+}
+
+static void sink(const uint8_t *frame, uint32_t len)
+{
+    if ((replyCount < REPLY_MAX) && (len <= FRAME_MAX)) {
+        memcpy(replies[replyCount].data, frame, len);
+        replies[replyCount].len = len;
+        replyCount++;
+    } else {
+        replyLost++;
+    }
+}
+
+static uint32_t handler(uint8_t type, const uint8_t *data, uint32_t len, uint8_t *resp)
+{
+    uint32_t i;
+
+    (void)type;
+    for (i = 0; i < len; i++) {
+        resp[i] = data[len - 1U - i];
+    }
+    return len;
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static void put16(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)(value >> 8);
+    p[1] = (uint8_t)value;
+}
+
+/* Internet checksum (RFC 1071) over a pseudo header sum and data */
+static uint16_t checksum(uint32_t sum, const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        sum += (i & 1U) ? data[i] : ((uint32_t)data[i] << 8);
+    }
+    while ((sum >> 16) != 0) {
+        sum = (sum & 0xFFFFU) + (sum >> 16);
+    }
+    return (uint16_t)~sum;
+}
+
+static uint32_t pseudo(const uint8_t *src, const uint8_t *dst, uint32_t udpLen)
+{
+    return get16(src) + get16(&src[2]) + get16(dst) + get16(&dst[2]) + 17U + udpLen;
+}
+
+/* Runs the DMA model, the interrupt and net_poll until all is answered */
+static void run(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < 30U; i++) {
+        sim_spend(SIM_NS_PER_MS);
+        net_poll();
+    }
+}
+
+/* Pads like the sender's MAC, so the lengths of IP and UDP count */
+static void sendFrame(uint8_t *frame, uint32_t len, uint32_t flags)
+{
+    if (len < MIN_FRAME) {
+        memset(&frame[len], 0, MIN_FRAME - len);
+        len = MIN_FRAME;
+    }
+    if (!emac_inject(frame, len, flags)) {
+        fail("inject", len, 0);
+    }
+}
+
+static uint32_t buildArp(uint8_t *f, const uint8_t *target)
+{
+    memset(f, 0xFF, 6);
+    memcpy(&f[6], peerMac, 6);
+    put16(&f[12], 0x0806);
+    put16(&f[14], 1);
+    put16(&f[16], 0x0800);
+    f[18] = 6;
+    f[19] = 4;
+    put16(&f[20], 1);
+    memcpy(&f[22], peerMac, 6);
+    memcpy(&f[28], peerIp, 4);
+    memset(&f[32], 0, 6);
+    memcpy(&f[38], target, 4);
+    return 42U;
+}
+
+static uint32_t buildUdp(uint8_t *f, uint8_t type, uint8_t seq, const uint8_t *payload,
+        uint32_t len, const variant_t *v)
+{
+    uint8_t *ip = &f[14];
+    uint32_t ipHlen = 20U + 4U * v->optWords;
+    uint8_t *udp = &ip[ipHlen];
+    uint32_t udpLen = 8U + 2U + len;
+    uint16_t sum;
+
+    memcpy(f, ownMac, 6);
+    memcpy(&f[6], peerMac, 6);
+    put16(&f[12], 0x0800);
+    ip[0] = (uint8_t)(0x40U | (ipHlen / 4U));
+    ip[1] = 0;
+    put16(&ip[2], ipHlen + udpLen);
+    put16(&ip[4], 0x1234);
+    put16(&ip[6], v->frag);
+    ip[8] = 64;
+    ip[9] = 17;
+    put16(&ip[10], 0);
+    memcpy(&ip[12], peerIp, 4);
+    memcpy(&ip[16], v->otherIp ? otherIp : ownIp, 4);
+    memset(&ip[20], 0x01, ipHlen - 20U);        /* NOP options */
+    put16(&ip[10], checksum(0, ip, ipHlen) ^ (v->badIpSum ? 0x0100U : 0U));
+
+    put16(&udp[0], PEER_PORT);
+    put16(&udp[2], (v->port != 0) ? v->port : NET_UDP_PORT);
+    put16(&udp[4], udpLen);
+    put16(&udp[6], 0);
+    udp[8] = type;
+    udp[9] = seq;
+    memcpy(&udp[10], payload, len);
+    if (!v->noUdpSum) {
+        sum = checksum(pseudo(&ip[12], &ip[16], udpLen), udp, udpLen);
+        put16(&udp[6], ((sum == 0) ? 0xFFFFU : sum) ^ (v->badUdpSum ? 0x0001U : 0U));
+    }
+    return 14U + ipHlen + udpLen - v->truncate;
+}
+
+static void checkArpReply(const frame_t *r)
+{
+    const uint8_t *f = r->data;
+
+    if ((r->len != 60U) || (memcmp(f, peerMac, 6) != 0) || (memcmp(&f[6], ownMac, 6) != 0)
+            || (get16(&f[12]) != 0x0806) || (get16(&f[14]) != 1) || (get16(&f[16]) != 0x0800)
+            || (f[18] != 6) || (f[19] != 4) || (get16(&f[20]) != 2)
+            || (memcmp(&f[22], ownMac, 6) != 0) || (memcmp(&f[28], ownIp, 4) != 0)
+            || (memcmp(&f[32], peerMac, 6) != 0) || (memcmp(&f[38], peerIp, 4) != 0)) {
+        fail("arp reply", r->len, get16(&f[20]));
+    }
+}
+
+/* Checks a reply to buildUdp(type, seq, payload, len) */
+static void checkUdpReply(const char *what, const frame_t *r, uint8_t type, uint8_t seq,
+        const uint8_t *payload, uint32_t len)
+{
+    const uint8_t *f = r->data;
+    const uint8_t *ip = &f[14];
+    const uint8_t *udp = &ip[20];
+    uint32_t udpLen = 8U + 2U + len;
+    uint32_t frameLen = 14U + 20U + udpLen;
+    uint32_t i;
+
+    if ((r->len != ((frameLen < 60U) ? 60U : frameLen)) || (memcmp(f, peerMac, 6) != 0)
+            || (memcmp(&f[6], ownMac, 6) != 0) || (get16(&f[12]) != 0x0800)) {
+        fail(what, r->len, frameLen);
+        return;
+    }
+    if ((ip[0] != 0x45) || (get16(&ip[2]) != 20U + udpLen) || (get16(&ip[6]) != 0x4000)
+            || (ip[8] == 0) || (ip[9] != 17) || (checksum(0, ip, 20) != 0)
+            || (memcmp(&ip[12], ownIp, 4) != 0) || (memcmp(&ip[16], peerIp, 4) != 0)) {
+        fail(what, get16(&ip[2]), checksum(0, ip, 20));
+        return;
+    }
+    if ((get16(&udp[0]) != NET_UDP_PORT) || (get16(&udp[2]) != PEER_PORT)
+            || (get16(&udp[4]) != udpLen) || (get16(&udp[6]) == 0)
+            || (checksum(pseudo(&ip[12], &ip[16], udpLen), udp, udpLen) != 0)) {
+        fail(what, get16(&udp[4]), get16(&udp[6]));
+        return;
+    }
+    if ((udp[8] != (type | PROTO_RESPONSE)) || (udp[9] != seq)) {
+        fail(what, udp[8], udp[9]);
+        return;
+    }
+    for (i = 0; i < len; i++) {
+        if (udp[10U + i] != payload[len - 1U - i]) {
+            fail(what, i, udp[10U + i]);
+            return;
+        }
+    }
+}
+
+/* Sends one request and expects one reply, or none */
+static void request(const char *what, uint8_t seq, uint32_t len, const variant_t *v, Bool answered)
+{
+    uint8_t frame[FRAME_MAX];
+    uint8_t payload[PROTO_MAX_PAYLOAD + 1U];
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        payload[i] = (uint8_t)(seq * 7U + i);
+    }
+    replyCount = 0;
+    sendFrame(frame, buildUdp(frame, 1U, seq, payload, len, v), EMAC_RINFO_LAST_FLAG);
+    run();
+    if (replyCount != (answered ? 1U : 0U)) {
+        fail(what, replyCount, answered);
+    } else if (answered) {
+        checkUdpReply(what, &replies[0], 1U, seq, payload, len);
+    } else {}
+}
+
+static void testArp(void)
+{
+    uint32_t start = failures;
+    uint8_t frame[FRAME_MAX];
+
+    replyCount = 0;
+    sendFrame(frame, buildArp(frame, ownIp), EMAC_RINFO_LAST_FLAG);
+    run();
+    if (replyCount != 1U) {
+        fail("arp count", replyCount, 1);
+    } else {
+        checkArpReply(&replies[0]);
+    }
+    replyCount = 0;
+    sendFrame(frame, buildArp(frame, otherIp), EMAC_RINFO_LAST_FLAG);
+    run();
+    if (replyCount != 0U) {
+        fail("arp other", replyCount, 0);
+    }
+    printf("net arp: %s\n", (failures == start) ? "ok" : "FAILED");
+}
+
+static void testUdp(void)
+{
+    static const variant_t good = {0};
+    variant_t v;
+    uint32_t start = failures;
+    uint32_t len;
+
+    for (len = 0; len <= PROTO_MAX_PAYLOAD; len++) {
+        request("udp", (uint8_t)len, len, &good, TRUE);
+    }
+    v = good;
+    v.noUdpSum = TRUE;
+    request("udp no checksum", 40, 5, &v, TRUE);
+    v = good;
+    v.optWords = 3;
+    request("udp ip options", 41, 6, &v, TRUE);
+    printf("net udp: %s, %u requests\n", (failures == start) ? "ok" : "FAILED",
+            (unsigned)(PROTO_MAX_PAYLOAD + 3U));
+}
+
+static void testIgnored(void)
+{
+    static const variant_t good = {0};
+    variant_t v;
+    uint8_t frame[FRAME_MAX];
+    uint32_t start = failures;
+    uint32_t len;
+
+    v = good;
+    v.badIpSum = TRUE;
+    request("bad ip checksum", 50, 4, &v, FALSE);
+    v = good;
+    v.badUdpSum = TRUE;
+    request("bad udp checksum", 51, 4, &v, FALSE);
+    v = good;
+    v.port = NET_UDP_PORT + 1U;
+    request("other port", 52, 4, &v, FALSE);
+    v = good;
+    v.otherIp = TRUE;
+    request("other address", 53, 4, &v, FALSE);
+    v = good;
+    v.frag = 0x2000;
+    request("fragment", 54, 4, &v, FALSE);
+    v = good;
+    v.truncate = 3;
+    request("truncated", 55, 30, &v, FALSE);
+    v = good;
+    request("too long", 56, PROTO_MAX_PAYLOAD + 1U, &v, FALSE);
+
+    /* a response type, the station never answers those */
+    replyCount = 0;
+    len = buildUdp(frame, PROTO_RESPONSE | 1U, 57, frame, 0, &good);
+    sendFrame(frame, len, EMAC_RINFO_LAST_FLAG);
+    run();
+    if (replyCount != 0U) {
+        fail("response type", replyCount, 0);
+    }
+    /* another EtherType */
+    len = buildUdp(frame, 1U, 58, frame, 0, &good);
+    put16(&frame[12], 0x86DD);
+    sendFrame(frame, len, EMAC_RINFO_LAST_FLAG);
+    /* a good request, but with a CRC error */
+    len = buildUdp(frame, 1U, 59, frame, 0, &good);
+    sendFrame(frame, len, EMAC_RINFO_LAST_FLAG | EMAC_RINFO_CRC_ERR);
+    run();
+    if (replyCount != 0U) {
+        fail("ethertype, crc", replyCount, 0);
+    }
+    printf("net ignored: %s\n", (failures == start) ? "ok" : "FAILED");
+}
+
+static void testBurst(void)
+{
+    static const variant_t good = {0};
+    uint8_t frame[FRAME_MAX];
+    uint8_t payload[8];
+    uint32_t start = failures;
+    uint32_t got = 0;
+    uint32_t i;
+    uint32_t j;
+
+    replyCount = 0;
+    for (i = 0; i < BURST; i++) {
+        for (j = 0; j < sizeof(payload); j++) {
+            payload[j] = (uint8_t)(i + j);
+        }
+        sendFrame(frame, buildUdp(frame, 2U, (uint8_t)(100U + i), payload, sizeof(payload), &good),
+                EMAC_RINFO_LAST_FLAG);
+    }
+    run();
+    if (replyCount != BURST) {
+        fail("burst count", replyCount, BURST);
+    }
+    for (i = 0; i < replyCount; i++) {
+        for (j = 0; j < sizeof(payload); j++) {
+            payload[j] = (uint8_t)(i + j);
+        }
+        checkUdpReply("burst", &replies[i], 2U, (uint8_t)(100U + i), payload, sizeof(payload));
+        got++;
+    }
+    printf("net burst: %s, %u requests for %u RX descriptors\n", (failures == start) ? "ok" : "FAILED",
+            (unsigned)got, (unsigned)EMAC_NUM_RX_FRAG);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Run all net tests
+ *
+ * Returns:
+ *    0 if all pass
+ *
+ *****************************************************************************/
+int nettest_run(void)
+{
+    net_stats_t s;
+
+    emac_setSink(sink);
+    if (!net_init(ownMac, ownIp, handler)) {
+        printf("net: net_init failed\n");
+        return 1;
+    }
+    testArp();
+    testUdp();
+    testIgnored();
+    testBurst();
+    net_getStats(&s);
+    printf("net stats: %u frames, %u rx errors, %u arp replies, %u requests, %u ignored, %u tx busy\n",
+            (unsigned)s.rxFrames, (unsigned)s.rxErrors, (unsigned)s.arpReplies,
+            (unsigned)s.requests, (unsigned)s.ignored, (unsigned)s.txBusy);
+    if ((replyLost != 0) || (s.txBusy != 0)) {
+        fail("replies lost", replyLost, s.txBusy);
+    }
+    printf("net: %s\n", (failures == 0) ? "all tests pass" : "FAILED");
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+/*****************************************************************************
+ *   proftest.c:  Host test of demo/src/profile.c and demo/src/trace.c
+ *
+ ******************************************************************************/
+
+/*
+ * Run with ./sim -x profile instead of the firmware. Both modules are
+ * built here with PROFILE_ENABLE and TRACE_ENABLE (the firmware of the
+ * simulator has neither). The DWT cycle counter of the simulator counts
+ * the virtual time at SystemCoreClock once DWT_START has enabled it, so a
+ * zone around sim_spend(ns) measures ns at 100 MHz exactly and two reads
+ * in a row cost nothing: the calibrated overhead is 0.
+ *
+ *   zones       count, min, max and total of a zone, nested zones, a zone
+ *               across the wrap of CYCCNT, profile_reset
+ *   ring        trace_event into the RAM ring with the ITM off: magic,
+ *               order, time stamps and the wrap of the ring
+ *   mask        trace_setMask drops the events not selected
+ *   itm         with the ITM port enabled events go to the port instead
+ *
+ * The table dump and the SD benchmark send over UART3 and are not
+ * covered; tools/profreport.py parses them.
+ *
+ * The output is deterministic, make check compares it.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#define PROFILE_ENABLE
+#define TRACE_ENABLE
+
+#include "LPC17xx.h"
+#include "lpc17xx_uart.h"
+#include "profile.h"
+#include "trace.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define NS_PER_CYCLE        (SIM_NS_PER_S / SystemCoreClock)
+#define RING_EVENTS         200U
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint32_t failures = 0;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static void fail(const char *what, uint32_t a, uint32_t b)
+{
+    if (failures < 10U) {
+        printf("FAIL %s: %u %u\n", what, (unsigned)a, (unsigned)b);
+    }
+    failures++;
+}
+
+static void spendCycles(uint32_t cycles)
+{
+    sim_spend((sim_time_t)cycles * NS_PER_CYCLE);
+}
+
+static void timedZone(uint32_t cycles)
+{
+    PROFILE_BEGIN(PROFILE_LUX);
+    spendCycles(cycles);
+    PROFILE_END(PROFILE_LUX);
+}
+
+static void testZones(void)
+{
+    profile_stat_t s;
+    uint32_t before = failures;
+    uint32_t left;
+
+    /* UART_Init waits for THRE, the register is plain memory here */
+    LPC_UART3->LSR = UART_LSR_THRE | UART_LSR_TEMT;
+    profile_init();
+
+    timedZone(1000U);
+    timedZone(500U);
+    timedZone(2000U);
+    profile_get(PROFILE_LUX, &s);
+    if ((s.count != 3U) || (s.min != 500U) || (s.max != 2000U) || (s.total != 3500U)) {
+        fail("zone stats", s.count, (uint32_t)s.total);
+    }
+
+    {
+        PROFILE_BEGIN(PROFILE_MAIN_LOOP);
+        {
+            PROFILE_BEGIN(PROFILE_TEMP);
+            spendCycles(300U);
+            PROFILE_END(PROFILE_TEMP);
+        }
+        spendCycles(200U);
+        PROFILE_END(PROFILE_MAIN_LOOP);
+    }
+    profile_get(PROFILE_TEMP, &s);
+    if ((s.count != 1U) || (s.total != 300U)) {
+        fail("nested inner", s.count, (uint32_t)s.total);
+    }
+    profile_get(PROFILE_MAIN_LOOP, &s);
+    if ((s.count != 1U) || (s.total != 500U)) {
+        fail("nested outer", s.count, (uint32_t)s.total);
+    }
+
+    /* CYCCNT wraps after 2^32 cycles, 42.9 s */
+    left = 0U - profile_cycles();
+    spendCycles(left - 400U);
+    profile_reset();
+    timedZone(1000U);
+    profile_get(PROFILE_LUX, &s);
+    if ((profile_cycles() >= 1000U) || (s.count != 1U) || (s.min != 1000U) || (s.total != 1000U)) {
+        fail("zone across wrap", profile_cycles(), (uint32_t)s.total);
+    }
+
+    profile_reset();
+    profile_get(PROFILE_LUX, &s);
+    if ((s.count != 0U) || (s.min != 0xFFFFFFFFUL) || (s.max != 0U) || (s.total != 0U)) {
+        fail("reset", s.count, s.min);
+    }
+    printf("profile zones: %s\n", (failures == before) ? "ok" : "FAILED");
+}
+
+static void testRing(void)
+{
+    const trace_record_t *rec;
+    uint32_t i;
+    uint32_t first = RING_EVENTS - TRACE_RING_SIZE;
+    uint32_t t0;
+    uint32_t before = failures;
+
+    trace_init();
+    if ((trace_ring.magic != TRACE_RING_MAGIC) || (trace_ring.cpuHz != SystemCoreClock)
+        || (trace_ring.size != TRACE_RING_SIZE) || (trace_ring.written != 0U)) {
+        fail("ring header", trace_ring.magic, trace_ring.written);
+    }
+    t0 = profile_cycles();
+    for (i = 0U; i < RING_EVENTS; i++) {
+        TRACE(TRACE_MARK, i);
+        spendCycles(100U);
+    }
+    if (trace_ring.written != RING_EVENTS) {
+        fail("ring written", trace_ring.written, RING_EVENTS);
+    }
+    for (i = first; i < RING_EVENTS; i++) {
+        rec = &trace_ring.rec[i % TRACE_RING_SIZE];
+        if ((rec->id != (uint8_t)TRACE_MARK) || (rec->arg != i) || (rec->time != (t0 + (i * 100U)))) {
+            fail("ring record", i, rec->arg);
+            break;
+        }
+    }
+    printf("trace ring: %s, %u events, last %u kept\n", (failures == before) ? "ok" : "FAILED",
+            (unsigned)trace_ring.written, (unsigned)TRACE_RING_SIZE);
+}
+
+static void testMask(void)
+{
+    uint32_t written;
+    uint32_t before = failures;
+
+    trace_setMask(TRACE_BIT(TRACE_MOTOR));
+    written = trace_ring.written;
+    TRACE(TRACE_MARK, 1U);
+    TRACE(TRACE_MOTOR, 2U);
+    TRACE(TRACE_BOOT, 3U);
+    if ((trace_ring.written != (written + 1U))
+        || (trace_ring.rec[written % TRACE_RING_SIZE].id != (uint8_t)TRACE_MOTOR)) {
+        fail("mask", trace_ring.written - written, 1U);
+    }
+    trace_setMask(TRACE_ALL);
+    printf("trace mask: %s\n", (failures == before) ? "ok" : "FAILED");
+}
+
+static void testItm(void)
+{
+    uint32_t written = trace_ring.written;
+    uint32_t before = failures;
+
+    ITM->TCR = ITM_TCR_ITMENA_Msk;
+    ITM->TER = 1U << TRACE_ITM_PORT;
+    ITM->PORT[TRACE_ITM_PORT].u32 = 1U;     /* FIFO ready */
+    TRACE(TRACE_MARK, 0x1769U);
+    if ((trace_ring.written != written) || (ITM->PORT[TRACE_ITM_PORT].u32 != 0x1769U)) {
+        fail("itm", trace_ring.written - written, ITM->PORT[TRACE_ITM_PORT].u32);
+    }
+    ITM->TCR = 0U;
+    printf("trace itm: %s\n", (failures == before) ? "ok" : "FAILED");
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+int proftest_run(void)
+{
+    testZones();
+    testRing();
+    testMask();
+    testItm();
+    printf("profile: %s\n", (failures == 0) ? "all tests pass" : "FAILED");
+    return (failures == 0) ? 0 : 1;
+}
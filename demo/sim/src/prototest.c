@@ -0,0 +1,362 @@
+/*****************************************************************************
+ *   prototest.c:  Host test of demo/src/proto.c on the serial service
+ *
+ ******************************************************************************/
+
+/*
+ * Run with ./sim -x proto instead of the firmware. proto.c runs unmodified
+ * on the serial service of the simulator: requests are encoded here with
+ * a bitwise CRC-16 and a COBS encoder of their own, put into the RX ring
+ * with serial_inject and the responses are taken from serial_setSink and
+ * decoded again. The request handler echoes the payload.
+ *
+ *   roundtrip   every payload length up to PROTO_MAX_PAYLOAD, with data
+ *               of zeros, of no zeros and mixed, fed in pieces of 1..7
+ *               bytes with a proto_poll after each, so frames arrive in
+ *               parts and wrap around the end of the RX ring
+ *   errors      CRC error, a response type, a frame too short, broken
+ *               COBS, an overlong run without delimiter and empty frames;
+ *               each is counted and not answered, the next good frame is
+ *   send        proto_send counts its seq up from 0
+ *
+ * The output is deterministic, make check compares it.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "serial.h"
+#include "proto.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define FRAME_MAX           (2U + PROTO_MAX_PAYLOAD + 2U)
+#define WIRE_MAX            512U
+#define OVERLONG            300U
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint32_t failures = 0;
+static uint32_t seed = 1769U;
+
+static uint8_t wire[WIRE_MAX];          /* what proto.c wrote, not taken yet */
+static uint32_t wireLen = 0;
+
+static uint8_t gotType;                 /* last request seen by the handler */
+static uint8_t gotData[PROTO_MAX_PAYLOAD];
+static uint32_t gotLen;
+static uint32_t handled = 0;
+
+static uint32_t injected = 0;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static uint32_t nextRandom(void)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) & 0xFFFFFFU;
+}
+
+static void fail(const char *what, uint32_t a, uint32_t b)
+{
+    if (failures < 10U) {
+        printf("FAIL %s: %u %u\n", what, (unsigned)a, (unsigned)b);
+    }
+    failures++;
+}
+
+static uint16_t refCrc16(const uint8_t *data, uint32_t len)
+{
+    uint16_t crc = 0xFFFFU;
+    uint32_t i;
+    uint8_t bit;
+
+    for (i = 0; i < len; i++) {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);
+        for (bit = 0; bit < 8U; bit++) {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/* COBS with the final 0, as in the protocol description */
+static uint32_t refEncode(const uint8_t *in, uint32_t len, uint8_t *out)
+{
+    uint32_t code = 0;
+    uint32_t o = 1;
+    uint32_t i;
+
+    out[0] = 1U;
+    for (i = 0; i < len; i++) {
+        if (in[i] == 0U) {
+            code = o++;
+            out[code] = 1U;
+        } else {
+            out[o++] = in[i];
+            out[code]++;
+            if (out[code] == 0xFFU) {
+                code = o++;
+                out[code] = 1U;
+            }
+        }
+    }
+    out[o++] = 0U;
+    return o;
+}
+
+/* Message with CRC, encoded; returns the wire length */
+static uint32_t makeFrame(uint8_t type, uint8_t seq, const uint8_t *data, uint32_t len, uint8_t *out)
+{
+    uint8_t frame[FRAME_MAX];
+    uint16_t crc;
+
+    frame[0] = type;
+    frame[1] = seq;
+    memcpy(&frame[2], data, len);
+    crc = refCrc16(frame, len + 2U);
+    frame[len + 2U] = (uint8_t)crc;
+    frame[len + 3U] = (uint8_t)(crc >> 8);
+    return refEncode(frame, len + 4U, out);
+}
+
+static uint32_t echo(uint8_t type, const uint8_t *data, uint32_t len, uint8_t *resp)
+{
+    uint32_t n = (len < (PROTO_MAX_PAYLOAD - 1U)) ? len : (PROTO_MAX_PAYLOAD - 1U);
+
+    gotType = type;
+    gotLen = len;
+    memcpy(gotData, data, len);
+    handled++;
+    resp[0] = PROTO_OK;
+    memcpy(&resp[1], data, n);
+    return n + 1U;
+}
+
+static void sink(const uint8_t *data, uint32_t len)
+{
+    if ((wireLen + len) <= WIRE_MAX) {
+        memcpy(&wire[wireLen], data, len);
+        wireLen += len;
+    } else {
+        fail("sink overflow", wireLen, len);
+    }
+}
+
+/* Feeds bytes in pieces of 1..7, polling after each */
+static void feed(const uint8_t *data, uint32_t len)
+{
+    uint32_t i = 0;
+    uint32_t n;
+
+    while (i < len) {
+        n = 1U + (nextRandom() % 7U);
+        if (n > (len - i)) {
+            n = len - i;
+        }
+        if (serial_inject(&data[i], n) != n) {
+            fail("rx ring full", i, n);
+        }
+        injected += n;
+        i += n;
+        proto_poll();
+    }
+}
+
+/*
+ * Takes the one message on the wire and checks it; data of len bytes is
+ * the expected payload. Returns FALSE if the wire is empty.
+ */
+static Bool takeMessage(uint8_t type, uint8_t seq, const uint8_t *data, uint32_t len)
+{
+    uint8_t frame[WIRE_MAX];
+    uint32_t n = 0;
+    uint32_t i = 0;
+    uint32_t j;
+    uint8_t code;
+
+    if (wireLen == 0U) {
+        return FALSE;
+    }
+    if (wire[wireLen - 1U] != 0U) {
+        fail("no delimiter", wireLen, 0);
+    }
+    /* COBS decode, up to the first 0 */
+    while ((i < wireLen) && (wire[i] != 0U)) {
+        code = wire[i++];
+        for (j = 1; (j < code) && (i < wireLen); j++) {
+            frame[n++] = wire[i++];
+        }
+        if ((code != 0xFFU) && (wire[i] != 0U)) {
+            frame[n++] = 0U;
+        }
+    }
+    if ((i + 1U) != wireLen) {
+        fail("more than one message", i + 1U, wireLen);
+    }
+    wireLen = 0;
+
+    if ((n < 4U) || (refCrc16(frame, n - 2U) != (uint16_t)(frame[n - 2U] | (frame[n - 1U] << 8)))) {
+        fail("response crc", n, 0);
+    } else if ((frame[0] != type) || (frame[1] != seq)) {
+        fail("response type/seq", frame[0], frame[1]);
+    } else if (((n - 4U) != len) || (memcmp(&frame[2], data, len) != 0)) {
+        fail("response payload", n - 4U, len);
+    } else {}
+    return TRUE;
+}
+
+/* One request through proto.c and its echo back */
+static void roundtrip(uint8_t type, uint8_t seq, const uint8_t *data, uint32_t len)
+{
+    uint8_t out[WIRE_MAX];
+    uint8_t resp[PROTO_MAX_PAYLOAD];
+    uint32_t before = handled;
+    uint32_t n = (len < (PROTO_MAX_PAYLOAD - 1U)) ? len : (PROTO_MAX_PAYLOAD - 1U);
+
+    feed(out, makeFrame(type, seq, data, len, out));
+    if ((handled != (before + 1U)) || (gotType != type) || (gotLen != len)
+            || (memcmp(gotData, data, len) != 0)) {
+        fail("request", type, len);
+    }
+    resp[0] = PROTO_OK;
+    memcpy(&resp[1], data, n);
+    if (!takeMessage((uint8_t)(type | PROTO_RESPONSE), seq, resp, n + 1U)) {
+        fail("no response", type, len);
+    }
+}
+
+static void testRoundtrip(void)
+{
+    uint8_t data[PROTO_MAX_PAYLOAD];
+    uint32_t start = failures;
+    uint32_t frames = 0;
+    uint32_t len;
+    uint32_t kind;
+    uint32_t i;
+
+    for (len = 0; len <= PROTO_MAX_PAYLOAD; len++) {
+        for (kind = 0; kind < 3U; kind++) {
+            for (i = 0; i < len; i++) {
+                data[i] = (kind == 0U) ? 0U : (kind == 1U) ? (uint8_t)(1U + (nextRandom() % 255U))
+                        : (uint8_t)(nextRandom() & 3U);
+            }
+            roundtrip((uint8_t)(1U + (frames % 0x3FU)), (uint8_t)frames, data, len);
+            frames++;
+        }
+    }
+    printf("proto roundtrip: %s, %u frames, %u bytes through a %u byte ring\n",
+            (failures == start) ? "ok" : "FAILED", (unsigned)frames, (unsigned)injected,
+            (unsigned)SERIAL_RX_SIZE);
+}
+
+/* A frame that must be counted in the stats and not answered */
+static void rejected(const char *what, const uint8_t *data, uint32_t len,
+        uint32_t crcErrors, uint32_t badFrames)
+{
+    proto_stats_t before;
+    proto_stats_t after;
+
+    proto_getStats(&before);
+    feed(data, len);
+    proto_getStats(&after);
+    if ((after.crcErrors - before.crcErrors) != crcErrors) {
+        fail(what, after.crcErrors - before.crcErrors, crcErrors);
+    }
+    if ((after.badFrames - before.badFrames) != badFrames) {
+        fail(what, after.badFrames - before.badFrames, badFrames);
+    }
+    if (after.frames != before.frames) {
+        fail(what, after.frames, before.frames);
+    }
+    if (wireLen != 0U) {
+        fail(what, wireLen, 0);
+        wireLen = 0;
+    }
+}
+
+static void testErrors(void)
+{
+    static const uint8_t payload[4] = {1U, 0U, 2U, 3U};
+    static const uint8_t shortFrame[] = {3U, 1U, 2U, 0U};           /* type and seq only */
+    static const uint8_t brokenCobs[] = {9U, 1U, 2U, 3U, 4U, 0U};   /* code past the end */
+    static const uint8_t empty[] = {0U, 0U, 0U};
+    uint8_t out[WIRE_MAX];
+    uint32_t start = failures;
+    uint32_t n;
+    uint32_t i;
+
+    n = makeFrame(PROTO_PING, 1U, payload, sizeof(payload), out);
+    out[2] ^= 0x10U;
+    rejected("crc error", out, n, 1U, 0U);
+    roundtrip(PROTO_PING, 2U, payload, sizeof(payload));
+
+    n = makeFrame(PROTO_PING | PROTO_RESPONSE, 3U, payload, sizeof(payload), out);
+    rejected("response type", out, n, 0U, 1U);
+    rejected("short frame", shortFrame, sizeof(shortFrame), 0U, 1U);
+    rejected("broken cobs", brokenCobs, sizeof(brokenCobs), 0U, 1U);
+    rejected("empty frames", empty, sizeof(empty), 0U, 0U);
+
+    for (i = 0; i < OVERLONG; i++) {
+        out[i] = (uint8_t)(1U + (i % 200U));
+    }
+    out[OVERLONG] = 0U;
+    rejected("overlong", out, OVERLONG + 1U, 0U, 1U);
+    roundtrip(PROTO_MOVE, 4U, payload, 1U);
+    printf("proto errors: %s\n", (failures == start) ? "ok" : "FAILED");
+}
+
+static void testSend(void)
+{
+    static const uint8_t record[PROTO_SENSORS_LEN] = {0U, 1U, 2U, 0U, 0U, 0U, 7U};
+    uint32_t start = failures;
+    uint32_t i;
+
+    for (i = 0; i < 3U; i++) {
+        if (!proto_send(PROTO_SENSORS, record, sizeof(record))) {
+            fail("proto_send", i, 0);
+        }
+        if (!takeMessage(PROTO_SENSORS, (uint8_t)i, record, sizeof(record))) {
+            fail("no message", i, 0);
+        }
+    }
+    printf("proto send: %s\n", (failures == start) ? "ok" : "FAILED");
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Run all protocol tests
+ *
+ * Returns:
+ *    0 if all pass
+ *
+ *****************************************************************************/
+int prototest_run(void)
+{
+    proto_stats_t s;
+
+    serial_setSink(sink);
+    proto_init(PROTO_BAUD, echo);
+    testRoundtrip();
+    testErrors();
+    testSend();
+    proto_getStats(&s);
+    printf("proto stats: %u frames, %u crc errors, %u bad frames, %u dropped\n",
+            (unsigned)s.frames, (unsigned)s.crcErrors, (unsigned)s.badFrames, (unsigned)s.txDropped);
+    printf("proto: %s\n", (failures == 0) ? "all tests pass" : "FAILED");
+    return (failures == 0) ? 0 : 1;
+}
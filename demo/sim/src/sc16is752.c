@@ -0,0 +1,463 @@
+/*****************************************************************************
+ *   sc16is752.c:  Model of the SC16IS752 I2C to dual UART bridge
+ *
+ ******************************************************************************/
+
+/*
+ * I2C address 0x48 (A1 = A0 = VDD as uart2.c assumes). The first byte of a
+ * write is the sub-address, register in bits 6..3 and channel in bits
+ * 2..1; the following bytes of the write and all bytes of a read access
+ * that one register, there is no auto increment, so a burst of THR/RHR
+ * moves many characters in one transaction. Both channels are modeled:
+ * LCR, DLL/DLH, IER, FCR, MCR, LSR, TXLVL, RXLVL and IIR, and of the
+ * enhanced registers EFR (with LCR = 0xBF) and TLR (register 7 while
+ * EFR[4] and MCR[2] are set; MCR[2] is only writable with EFR[4]). The
+ * other enhanced registers are accepted and ignored.
+ *
+ * The line side runs in virtual time at the baud rate of 3.6864 MHz / 16 /
+ * divisor with 10 bits per character. The transmitter takes a character
+ * from the TX FIFO whenever the previous one is out; what leaves the line
+ * is kept for the test (sc16is752_sent). Characters given to
+ * sc16is752_feed arrive back to back from the time of the call; when the
+ * RX FIFO is full an arriving character is lost and sets the overrun bit.
+ * Without FCR bit 0 both FIFOs hold one character, as after reset.
+ *
+ * IIR reports, in the priority of the data sheet: line status, RX time-out
+ * (characters waiting and none arrived for 4 character times), RX trigger
+ * level and THR (free places at the TX trigger level), each only if
+ * enabled in IER. The trigger levels are those of TLR when its nibble is
+ * not 0, else FCR[7:6] for RX and 8 places for TX as after reset. The IRQ# output is not connected to a GPIO in
+ * the simulator, see uart2.h; the IIR reads that found nothing pending are
+ * counted instead, a driver watching IRQ# would not have made them.
+ *
+ * A transaction takes effect at its start, the bus hook advances the time
+ * after it.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define CHANNELS        2
+#define FIFO_SIZE       64U
+#define XTAL_HZ         3686400ULL
+#define FEED_SIZE       4096U
+#define SENT_SIZE       4096U
+
+#define REG_RHR         0x00
+#define REG_IER         0x01
+#define REG_FCR         0x02
+#define REG_LCR         0x03
+#define REG_MCR         0x04
+#define REG_LSR         0x05
+#define REG_MSR         0x06
+#define REG_SPR         0x07
+#define REG_TLR         0x07    /* EFR[4] and MCR[2] */
+#define REG_EFR         0x02    /* LCR = 0xBF */
+#define REG_TXLVL       0x08
+#define REG_RXLVL       0x09
+
+#define LCR_DLAB        0x80U
+#define LCR_ENHANCED    0xBFU
+#define EFR_ENHANCED    0x10U
+#define MCR_TLR         0x04U
+#define FCR_ENABLE      0x01U
+#define FCR_RX_RESET    0x02U
+#define FCR_TX_RESET    0x04U
+#define LSR_RDR         0x01U
+#define LSR_OE          0x02U
+#define LSR_THRE        0x20U
+#define LSR_TEMT        0x40U
+#define IER_RHR         0x01U
+#define IER_THR         0x02U
+#define IER_RLS         0x04U
+#define TX_TRIGGER      8U
+
+typedef struct
+{
+    uint8_t ier;
+    uint8_t fcr;
+    uint8_t lcr;
+    uint8_t mcr;
+    uint8_t spr;
+    uint8_t efr;
+    uint8_t tlr;
+    uint8_t dll;
+    uint8_t dlh;
+    uint8_t lsrErrors;
+
+    uint8_t tx[FIFO_SIZE];
+    uint32_t txHead;
+    uint32_t txTail;
+    Bool shifting;              /* a character is on the line */
+    sim_time_t shiftDone;
+
+    uint8_t rx[FIFO_SIZE];
+    uint32_t rxHead;
+    uint32_t rxTail;
+    sim_time_t lastRx;
+
+    uint8_t feed[FEED_SIZE];    /* characters still to arrive */
+    uint32_t feedHead;
+    uint32_t feedTail;
+    sim_time_t nextArrival;
+
+    uint8_t sent[SENT_SIZE];    /* characters that left the line */
+    uint32_t sentLen;
+} channel_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static channel_t ch[CHANNELS];
+static uint8_t pointer = 0;
+static sc16is752_stat_t stat;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static channel_t *selected(void)
+{
+    return &ch[(pointer >> 1) & 1U];
+}
+
+static uint32_t fifoDepth(const channel_t *c)
+{
+    return ((c->fcr & FCR_ENABLE) != 0) ? FIFO_SIZE : 1U;
+}
+
+static sim_time_t charNs(const channel_t *c)
+{
+    uint32_t div = ((uint32_t)c->dlh << 8) | c->dll;
+
+    if (div == 0) {
+        div = 1;
+    }
+    return (sim_time_t)((10ULL * SIM_NS_PER_S * 16ULL * div) / XTAL_HZ);
+}
+
+/* Runs the line side of a channel up to the current time */
+static void advance(channel_t *c)
+{
+    sim_time_t t = charNs(c);
+
+    for (;;) {
+        if (c->shifting && (c->shiftDone <= sim_now)) {
+            c->shifting = FALSE;
+        }
+        if (!c->shifting && (c->txHead != c->txTail)) {
+            if (c->sentLen < SENT_SIZE) {
+                c->sent[c->sentLen] = c->tx[c->txTail % FIFO_SIZE];
+            }
+            c->sentLen++;
+            c->txTail++;
+            c->shifting = TRUE;
+            c->shiftDone += t;      /* back to back, see REG_RHR in writeReg */
+            continue;
+        }
+        if ((c->feedHead != c->feedTail) && (c->nextArrival <= sim_now)) {
+            if ((c->rxHead - c->rxTail) < fifoDepth(c)) {
+                c->rx[c->rxHead % FIFO_SIZE] = c->feed[c->feedTail % FEED_SIZE];
+                c->rxHead++;
+            } else {
+                c->lsrErrors |= LSR_OE;
+                stat.overruns++;
+            }
+            c->feedTail++;
+            c->lastRx = c->nextArrival;
+            c->nextArrival += t;
+            continue;
+        }
+        break;
+    }
+}
+
+static Bool tlrSelected(const channel_t *c)
+{
+    return (((c->efr & EFR_ENHANCED) != 0) && ((c->mcr & MCR_TLR) != 0)) ? TRUE : FALSE;
+}
+
+static uint8_t iir(channel_t *c)
+{
+    uint32_t level = c->rxHead - c->rxTail;
+    uint32_t trigger = ((c->fcr & FCR_ENABLE) != 0) ? (uint32_t[4]){8, 16, 56, 60}[c->fcr >> 6] : 1U;
+    uint32_t txTrigger = TX_TRIGGER;
+    uint8_t output = 0x01;
+
+    if (((c->fcr & FCR_ENABLE) != 0) && ((c->tlr >> 4) != 0)) {
+        trigger = 4U * (c->tlr >> 4);
+    }
+    if ((c->tlr & 0x0FU) != 0) {
+        txTrigger = 4U * (c->tlr & 0x0FU);
+    }
+
+    if (((c->ier & IER_RLS) != 0) && (c->lsrErrors != 0)) {
+        output = 0x06;
+    } else if (((c->ier & IER_RHR) != 0) && (level != 0) && (sim_now >= c->lastRx + 4U * charNs(c))) {
+        output = 0x0C;
+    } else if (((c->ier & IER_RHR) != 0) && (level >= trigger)) {
+        output = 0x04;
+    } else if (((c->ier & IER_THR) != 0)
+            && ((fifoDepth(c) - (c->txHead - c->txTail)) >= ((fifoDepth(c) == 1U) ? 1U : txTrigger))) {
+        output = 0x02;
+    } else {}
+    return output;
+}
+
+static uint8_t readReg(channel_t *c, uint8_t reg)
+{
+    uint8_t output = 0;
+
+    if ((c->lcr == LCR_ENHANCED) && (reg >= REG_MCR) && (reg <= REG_SPR)) {
+        return 0;               /* XON1/2 and XOFF1/2, not modeled */
+    }
+    switch (reg) {
+    case REG_RHR:
+        if ((c->lcr & LCR_DLAB) != 0) {
+            output = c->dll;
+        } else if (c->rxHead != c->rxTail) {
+            output = c->rx[c->rxTail % FIFO_SIZE];
+            c->rxTail++;
+        } else {}
+        break;
+    case REG_IER:
+        output = ((c->lcr & LCR_DLAB) != 0) ? c->dlh : c->ier;
+        break;
+    case REG_FCR:
+        if (c->lcr == LCR_ENHANCED) {
+            output = c->efr;
+            break;
+        }
+        output = iir(c);
+        if (output == 0x01) {
+            stat.iirNone++;
+        }
+        output |= ((c->fcr & FCR_ENABLE) != 0) ? 0xC0U : 0U;
+        break;
+    case REG_LCR:
+        output = c->lcr;
+        break;
+    case REG_MCR:
+        output = c->mcr;
+        break;
+    case REG_LSR:
+        output = c->lsrErrors | ((c->rxHead != c->rxTail) ? LSR_RDR : 0U)
+                | ((c->txHead == c->txTail) ? LSR_THRE : 0U)
+                | (((c->txHead == c->txTail) && !c->shifting) ? LSR_TEMT : 0U);
+        c->lsrErrors = 0;
+        break;
+    case REG_SPR:
+        output = tlrSelected(c) ? c->tlr : c->spr;
+        break;
+    case REG_TXLVL:
+        output = (uint8_t)(fifoDepth(c) - (c->txHead - c->txTail));
+        break;
+    case REG_RXLVL:
+        output = (uint8_t)(c->rxHead - c->rxTail);
+        break;
+    default:                    /* MSR and the rest: nothing connected */
+        break;
+    }
+    return output;
+}
+
+static void writeReg(channel_t *c, uint8_t reg, uint8_t value)
+{
+    if ((c->lcr == LCR_ENHANCED) && (reg >= REG_MCR) && (reg <= REG_SPR)) {
+        return;                 /* XON1/2 and XOFF1/2, not modeled */
+    }
+    switch (reg) {
+    case REG_RHR:
+        if ((c->lcr & LCR_DLAB) != 0) {
+            c->dll = value;
+        } else if ((c->txHead - c->txTail) < fifoDepth(c)) {
+            if (!c->shifting && (c->txHead == c->txTail)) {
+                c->shiftDone = sim_now;     /* the line was idle until now */
+            }
+            c->tx[c->txHead % FIFO_SIZE] = value;
+            c->txHead++;
+        } else {
+            stat.txLost++;
+        }
+        break;
+    case REG_IER:
+        if ((c->lcr & LCR_DLAB) != 0) {
+            c->dlh = value;
+        } else {
+            c->ier = value;
+        }
+        break;
+    case REG_FCR:
+        if (c->lcr == LCR_ENHANCED) {
+            c->efr = value;
+            break;
+        }
+        c->fcr = value & ~(FCR_RX_RESET | FCR_TX_RESET);
+        if ((value & FCR_RX_RESET) != 0) {
+            c->rxTail = c->rxHead;
+        }
+        if ((value & FCR_TX_RESET) != 0) {
+            c->txTail = c->txHead;
+        }
+        break;
+    case REG_LCR:
+        c->lcr = value;
+        break;
+    case REG_MCR:
+        if ((c->efr & EFR_ENHANCED) == 0) {
+            value = (uint8_t)((value & ~MCR_TLR) | (c->mcr & MCR_TLR));
+        }
+        c->mcr = value;
+        break;
+    case REG_SPR:
+        if (tlrSelected(c)) {
+            c->tlr = value;
+        } else {
+            c->spr = value;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    I2C write: sub-address, then data for that register
+ *
+ *****************************************************************************/
+Bool sc16is752_write(uint8_t addr, const uint8_t *buf, uint32_t len)
+{
+    channel_t *c;
+    uint32_t i;
+
+    (void)addr;
+    stat.transfers++;
+    stat.bytes += len;
+    pointer = buf[0];
+    c = selected();
+    advance(c);
+    for (i = 1; i < len; i++) {
+        writeReg(c, (pointer >> 3) & 0x0FU, buf[i]);
+    }
+    advance(c);
+    return TRUE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    I2C read of the register the last write pointed at
+ *
+ *****************************************************************************/
+Bool sc16is752_read(uint8_t addr, uint8_t *buf, uint32_t len)
+{
+    channel_t *c = selected();
+    uint32_t i;
+
+    (void)addr;
+    stat.bytes += len;
+    advance(c);
+    for (i = 0; i < len; i++) {
+        buf[i] = readReg(c, (pointer >> 3) & 0x0FU);
+    }
+    return TRUE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Characters sent to a channel by the other end of its line, they
+ *    arrive back to back from now on
+ *
+ * Returns:
+ *    characters taken, less than len if the feed buffer is full
+ *
+ *****************************************************************************/
+uint32_t sc16is752_feed(uint32_t chan, const uint8_t *data, uint32_t len)
+{
+    channel_t *c = &ch[chan & 1U];
+    uint32_t n;
+
+    advance(c);
+    if (c->feedHead == c->feedTail) {
+        c->nextArrival = sim_now + charNs(c);
+    }
+    for (n = 0; (n < len) && ((c->feedHead - c->feedTail) < FEED_SIZE); n++) {
+        c->feed[c->feedHead % FEED_SIZE] = data[n];
+        c->feedHead++;
+    }
+    return n;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Characters that left the line of a channel, and clears the record
+ *
+ * Returns:
+ *    number of characters, *data points to the first SENT_SIZE of them
+ *
+ *****************************************************************************/
+uint32_t sc16is752_sent(uint32_t chan, const uint8_t **data)
+{
+    channel_t *c = &ch[chan & 1U];
+    uint32_t n;
+
+    advance(c);
+    n = c->sentLen;
+    *data = c->sent;
+    c->sentLen = 0;
+    return n;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    TRUE while a channel still has characters to send or to receive
+ *
+ *****************************************************************************/
+Bool sc16is752_lineBusy(uint32_t chan)
+{
+    channel_t *c = &ch[chan & 1U];
+
+    advance(c);
+    return (c->shifting || (c->txHead != c->txTail) || (c->feedHead != c->feedTail)) ? TRUE : FALSE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Reset of the chip: registers, FIFOs and line
+ *
+ *****************************************************************************/
+void sc16is752_reset(void)
+{
+    memset(ch, 0, sizeof(ch));
+    pointer = 0;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Counters since the start
+ *
+ *****************************************************************************/
+void sc16is752_getStat(sc16is752_stat_t *out)
+{
+    *out = stat;
+}
@@ -0,0 +1,255 @@
+/*****************************************************************************
+ *   serial.c:  Serial service of the simulator
+ *
+ ******************************************************************************/
+
+/*
+ * Replaces demo/src/serial.c, UART3 and the GPDMA are not modeled. With -u
+ * the port is a pseudo terminal whose path is printed at the start, so
+ * host tools (tools/blindctl.py) talk to the firmware as to the board.
+ * Bytes from the terminal are moved into the RX ring whenever the
+ * firmware looks at it; writes go to the terminal at once. Without -u
+ * nothing arrives and writes are dropped. Host tests feed the RX ring
+ * with serial_inject and take the writes with serial_setSink.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "serial.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define RX_MASK             (SERIAL_RX_SIZE - 1U)
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static int pty = -1;
+static serial_sink_t sink = NULL;
+static uint8_t rxRing[SERIAL_RX_SIZE];
+static uint32_t rxHead = 0;
+static uint32_t rxTail = 0;
+static serial_stats_t stats;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/* Moves what the terminal has into the RX ring */
+static void pump(void)
+{
+    uint32_t free;
+    uint32_t run;
+    ssize_t n;
+
+    if (pty < 0) {
+        return;
+    }
+    do {
+        free = SERIAL_RX_SIZE - (rxHead - rxTail);
+        run = SERIAL_RX_SIZE - (rxHead & RX_MASK);
+        if (run > free) {
+            run = free;
+        }
+        n = (run != 0) ? read(pty, &rxRing[rxHead & RX_MASK], run) : 0;
+        if (n > 0) {
+            sim_trace("uart3 rx %u\n", (unsigned)n);
+            rxHead += (uint32_t)n;
+            stats.rxBytes += (uint32_t)n;
+            if ((rxHead - rxTail) > stats.rxPeak) {
+                stats.rxPeak = rxHead - rxTail;
+            }
+        }
+    } while (n > 0);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Opens a pseudo terminal as UART3 and prints its path (-u)
+ *
+ * Returns:
+ *    TRUE on success
+ *
+ *****************************************************************************/
+Bool serial_openPty(void)
+{
+    struct termios tio;
+    int fd;
+
+    fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((fd < 0) || (grantpt(fd) != 0) || (unlockpt(fd) != 0)) {
+        return FALSE;
+    }
+    /* Raw bytes both ways, the protocol is binary */
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        (void)tcsetattr(fd, TCSANOW, &tio);
+    }
+    (void)fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    pty = fd;
+    fprintf(stderr, "sim: uart3 on %s\n", ptsname(fd));
+    return TRUE;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Puts bytes into the RX ring as if they had been received
+ *
+ * Returns:
+ *    bytes taken, less than len when the ring is full
+ *
+ *****************************************************************************/
+uint32_t serial_inject(const uint8_t *data, uint32_t len)
+{
+    uint32_t n;
+
+    for (n = 0; (n < len) && ((rxHead - rxTail) < SERIAL_RX_SIZE); n++) {
+        rxRing[rxHead & RX_MASK] = data[n];
+        rxHead++;
+    }
+    stats.rxBytes += n;
+    return n;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Sends the writes to sink instead of the terminal, NULL to stop
+ *
+ *****************************************************************************/
+void serial_setSink(serial_sink_t newSink)
+{
+    sink = newSink;
+}
+
+void serial_init(uint32_t baud)
+{
+    sim_trace("uart3 init %u baud\n", (unsigned)baud);
+    rxHead = 0;
+    rxTail = 0;
+    memset(&stats, 0, sizeof(stats));
+    sim_spend(SIM_HOOK_NS);
+}
+
+void serial_setFlow(const serial_flow_t *flow)
+{
+    (void)flow;
+}
+
+uint32_t serial_write(const uint8_t *buf, uint32_t len)
+{
+    ssize_t n = 0;
+
+    if (sink != NULL) {
+        sink(buf, len);
+        n = (ssize_t)len;
+    } else if (pty >= 0) {
+        n = write(pty, buf, len);
+        if (n < 0) {
+            n = 0;      /* nobody reads the terminal, EAGAIN */
+        }
+    }
+    sim_trace("uart3 tx %u of %u\n", (unsigned)n, (unsigned)len);
+    stats.txBytes += (uint32_t)n;
+    stats.txDropped += len - (uint32_t)n;
+    sim_spend(SIM_HOOK_NS);
+    return len;
+}
+
+uint32_t serial_read(uint8_t *buf, uint32_t len)
+{
+    uint8_t *data;
+    uint32_t run;
+    uint32_t n = 0;
+
+    while (n < len) {
+        run = serial_peek(0, &data);
+        if (run == 0) {
+            break;
+        }
+        if (run > (len - n)) {
+            run = len - n;
+        }
+        memcpy(&buf[n], data, run);
+        serial_consume(run);
+        n += run;
+    }
+    return n;
+}
+
+uint32_t serial_peek(uint32_t offset, uint8_t **data)
+{
+    uint32_t count;
+    uint32_t run = 0;
+
+    pump();
+    count = rxHead - rxTail;
+    if (offset < count) {
+        run = SERIAL_RX_SIZE - ((rxTail + offset) & RX_MASK);
+        if (run > (count - offset)) {
+            run = count - offset;
+        }
+        *data = &rxRing[(rxTail + offset) & RX_MASK];
+    }
+    return run;
+}
+
+void serial_consume(uint32_t len)
+{
+    if (len > (rxHead - rxTail)) {
+        len = rxHead - rxTail;
+    }
+    rxTail += len;
+}
+
+uint32_t serial_rxCount(void)
+{
+    pump();
+    return rxHead - rxTail;
+}
+
+uint32_t serial_txFree(void)
+{
+    return SERIAL_TX_SIZE;
+}
+
+Bool serial_txIdle(void)
+{
+    return TRUE;
+}
+
+void serial_kick(void)
+{
+}
+
+void serial_getStats(serial_stats_t *out)
+{
+    *out = stats;
+}
+
+void serial_intHandler(void)
+{
+}
+
+void serial_dmaIntHandler(void)
+{
+}
@@ -0,0 +1,689 @@
+/*****************************************************************************
+ *   serialtest.c:  Host test of demo/src/serial.c on a UART3 register model
+ *
+ ******************************************************************************/
+
+/*
+ * Built as its own program (make serialtest), since the simulator links
+ * src/serial.c in place of the driver. Here the real demo/src/serial.c and
+ * the UART library run against a model of UART3 and of the GPDMA channel
+ * that feeds it.
+ *
+ * serial.c reads and writes the UART registers directly, and a register
+ * in host memory has no side effects: reading RBR would not take a byte
+ * out of the FIFO. So the page that holds sim_UART3 is kept inaccessible.
+ * Each access faults, the handler opens the page and single-steps the
+ * instruction, and after the step the model applies what the access does
+ * on the chip: RBR pops the RX FIFO, THR pushes the TX FIFO, LSR clears
+ * the error bits, IIR clears a THRE interrupt, FCR resets the FIFOs. Then
+ * it rewrites the read-only registers and closes the page again. This
+ * needs Linux on x86-64 (the write flag of the page fault and the trap
+ * flag).
+ *
+ * The line advances one character per lineTick: the GPDMA refills the TX
+ * FIFO in DMA mode, one character leaves, one character of the queued
+ * input arrives. After each tick the UART and GPDMA interrupts are taken
+ * as the NVIC would, by calling serial_intHandler and serial_dmaIntHandler.
+ * The GPDMA model reads the TX ring through SrcMemAddr, which holds only
+ * 32 bits of the pointer, so the program is linked with -no-pie.
+ *
+ *   rx          300 bytes into the 256 byte ring without reading: drops,
+ *               rxPeak, the rxThrottle hook at SERIAL_RX_STOP; peek and
+ *               consume across the ring wrap, the hook at SERIAL_RX_GO
+ *   errors      a framing error and a FIFO overrun while the interrupt is
+ *               off, both counted
+ *   tx dma      long writes go out by GPDMA blocks, a run at the end of
+ *               the ring through the FIFO
+ *   tx fifo     GPDMA refused: everything through the THRE interrupt
+ *   tx flow     txAllowed holds the TX until serial_kick
+ *
+ * The output is deterministic, make check compares it.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "LPC17xx.h"
+#include "lpc17xx_uart.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_gpdma.h"
+#include "serial.h"
+
+#if !defined(__linux__) || !defined(__x86_64__)
+#error "serialtest traps the register accesses, Linux on x86-64 only"
+#endif
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define PAGE_SIZE           4096U
+#define FIFO_SIZE           16U
+#define CTI_CHARS           4U          /* character times of silence before CTI */
+#define LINE_MAX            2048U
+#define TEST_BAUD           115200U
+#define MAX_TICKS           20000U
+
+#define EFLAGS_TF           0x100U
+#define PF_WRITE            0x2U        /* page fault error code: write access */
+
+#define OFS_RBR             0x00U
+#define OFS_IER             0x04U
+#define OFS_IIR             0x08U
+#define OFS_LCR             0x0CU
+#define OFS_LSR             0x14U
+
+typedef struct
+{
+    const uint8_t *src;
+    uint32_t left;
+    Bool setUp;
+    Bool enabled;
+    Bool done;                          /* terminal count, until cleared */
+    Bool refuse;                        /* GPDMA_Setup fails */
+    uint32_t blocks;
+} dma_model_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+/* alone on its page, every access of the driver traps */
+LPC_UART_TypeDef sim_UART3 __attribute__ ((aligned (PAGE_SIZE)));
+
+LPC_SC_TypeDef sim_SC;
+LPC_PINCON_TypeDef sim_PINCON;
+LPC_UART0_TypeDef sim_UART0;
+LPC_UART1_TypeDef sim_UART1;
+LPC_UART_TypeDef sim_UART2;
+NVIC_Type sim_NVIC;
+SCB_Type sim_SCB;
+uint32_t SystemCoreClock = 100000000U;
+
+static uint32_t trapOffset;             /* offset of the trapped access */
+static Bool accessWrite;
+
+static uint8_t rxFifo[FIFO_SIZE];
+static uint32_t rxCount = 0;
+static uint8_t txFifo[FIFO_SIZE];
+static uint32_t txCount = 0;
+static uint32_t ier = 0;
+static uint8_t dll = 0;
+static uint8_t dlm = 0;
+static uint8_t lsrErrors = 0;
+static uint32_t rxTrigger = 1;
+static Bool dmaMode = FALSE;
+static Bool threPending = FALSE;
+static uint32_t idle = 0;
+
+static uint8_t lineIn[LINE_MAX];        /* queued to arrive, one per tick */
+static uint32_t lineInLen = 0;
+static uint32_t lineInPos = 0;
+static uint32_t lineInBad = LINE_MAX;   /* index that arrives with a framing error */
+static uint8_t lineOut[LINE_MAX];       /* what left the transmitter */
+static uint32_t lineOutLen = 0;
+static uint32_t txLost = 0;             /* THR writes into a full FIFO */
+
+static dma_model_t dma;
+static uint32_t uartIrqs = 0;
+static uint32_t dmaIrqs = 0;
+static uint32_t stuck = 0;              /* handler returned with the interrupt pending */
+
+static uint32_t stops = 0;
+static uint32_t gos = 0;
+static Bool txOpen = TRUE;
+
+static uint32_t failures = 0;
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static void fail(const char *what, uint32_t a, uint32_t b)
+{
+    if (failures < 10U) {
+        printf("FAIL %s: %u %u\n", what, (unsigned)a, (unsigned)b);
+    }
+    failures++;
+}
+
+static void openPage(void)
+{
+    (void)mprotect(&sim_UART3, PAGE_SIZE, PROT_READ | PROT_WRITE);
+}
+
+static Bool dlab(void)
+{
+    return (Bool)((sim_UART3.LCR & UART_LCR_DLAB_EN) != 0U);
+}
+
+/* Interrupt the UART would signal now, as IIR bits */
+static uint32_t pendingId(void)
+{
+    uint32_t id = UART_IIR_INTSTAT_PEND;
+
+    if (((ier & UART_IER_RLSINT_EN) != 0U) && (lsrErrors != 0U)) {
+        id = UART_IIR_INTID_RLS;
+    } else if (((ier & UART_IER_RBRINT_EN) != 0U) && (rxCount >= rxTrigger)) {
+        id = UART_IIR_INTID_RDA;
+    } else if (((ier & UART_IER_RBRINT_EN) != 0U) && (rxCount != 0U) && (idle >= CTI_CHARS)) {
+        id = UART_IIR_INTID_CTI;
+    } else if (((ier & UART_IER_THREINT_EN) != 0U) && threPending) {
+        id = UART_IIR_INTID_THRE;
+    } else {}
+    return id;
+}
+
+/* Rewrites what the driver reads, then closes the page */
+static void closePage(void)
+{
+    uint8_t lsr = lsrErrors;
+
+    if (dlab()) {
+        *(volatile uint8_t *)&sim_UART3.DLL = dll;
+        sim_UART3.DLM = dlm;
+    } else {
+        *(volatile uint8_t *)&sim_UART3.RBR = (rxCount != 0U) ? rxFifo[0] : 0U;
+        sim_UART3.IER = ier;
+    }
+    sim_UART3.IIR = pendingId() | UART_IIR_FIFO_EN;
+    if (rxCount != 0U) {
+        lsr |= UART_LSR_RDR;
+    }
+    if (txCount == 0U) {
+        lsr |= UART_LSR_THRE | UART_LSR_TEMT;
+    }
+    sim_UART3.LSR = lsr;
+    (void)mprotect(&sim_UART3, PAGE_SIZE, PROT_NONE);
+}
+
+static void writeAccess(void)
+{
+    uint8_t value;
+
+    if (trapOffset == OFS_RBR) {
+        value = *(volatile uint8_t *)&sim_UART3.THR;
+        if (dlab()) {
+            dll = value;
+        } else if ((sim_UART3.TER & UART_TER_TXEN) == 0U) {
+            txLost++;
+        } else if (txCount < FIFO_SIZE) {
+            txFifo[txCount++] = value;
+            threPending = FALSE;
+        } else {
+            txLost++;
+        }
+    } else if (trapOffset == OFS_IER) {
+        if (dlab()) {
+            dlm = sim_UART3.DLM;
+        } else {
+            value = (uint8_t)sim_UART3.IER;
+            if (((ier & UART_IER_THREINT_EN) == 0U) && ((value & UART_IER_THREINT_EN) != 0U)
+                && (txCount == 0U)) {
+                threPending = TRUE;
+            }
+            ier = sim_UART3.IER & UART_IER_BITMASK;
+        }
+    } else if (trapOffset == OFS_IIR) {
+        value = sim_UART3.FCR;
+        if ((value & UART_FCR_RX_RS) != 0U) {
+            rxCount = 0;
+        }
+        if ((value & UART_FCR_TX_RS) != 0U) {
+            txCount = 0;
+        }
+        dmaMode = (Bool)((value & UART_FCR_DMAMODE_SEL) != 0U);
+        rxTrigger = (uint32_t[]){1U, 4U, 8U, 14U}[value >> 6];
+    } else {}
+}
+
+static void readAccess(void)
+{
+    if ((trapOffset == OFS_RBR) && !dlab()) {
+        if (rxCount != 0U) {
+            rxCount--;
+            memmove(rxFifo, &rxFifo[1], rxCount);
+        }
+        idle = 0;
+    } else if (trapOffset == OFS_IIR) {
+        if (pendingId() == UART_IIR_INTID_THRE) {
+            threPending = FALSE;
+        }
+    } else if (trapOffset == OFS_LSR) {
+        lsrErrors = 0;
+    } else {}
+}
+
+/* SIGSEGV: open the page and step the instruction */
+static void onFault(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+    uintptr_t addr = (uintptr_t)info->si_addr;
+
+    (void)sig;
+    if ((addr < (uintptr_t)&sim_UART3) || (addr >= ((uintptr_t)&sim_UART3 + PAGE_SIZE))) {
+        signal(SIGSEGV, SIG_DFL);       /* a real crash */
+        return;
+    }
+    openPage();
+    trapOffset = (uint32_t)(addr - (uintptr_t)&sim_UART3);
+    accessWrite = (Bool)((uc->uc_mcontext.gregs[REG_ERR] & PF_WRITE) != 0);
+    uc->uc_mcontext.gregs[REG_EFL] |= EFLAGS_TF;
+}
+
+/* SIGTRAP after the step: side effects of the access */
+static void onStep(int sig, siginfo_t *info, void *context)
+{
+    ucontext_t *uc = (ucontext_t *)context;
+
+    (void)sig;
+    (void)info;
+    uc->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)EFLAGS_TF;
+    if (accessWrite || (trapOffset == OFS_IER)) {   /* IER &= may fault as a read */
+        writeAccess();
+    } else {
+        readAccess();
+    }
+    closePage();
+}
+
+static void takeInterrupts(void)
+{
+    openPage();
+    if (((NVIC->ISER[0] & (1U << UART3_IRQn)) != 0U) && (pendingId() != UART_IIR_INTSTAT_PEND)) {
+        closePage();
+        uartIrqs++;
+        serial_intHandler();
+        openPage();
+        if (pendingId() != UART_IIR_INTSTAT_PEND) {
+            stuck++;
+        }
+    }
+    closePage();
+    if (dma.done) {
+        dmaIrqs++;
+        serial_dmaIntHandler();
+    }
+}
+
+/* One character time on the line */
+static void lineTick(void)
+{
+    openPage();
+    if (dma.enabled && dmaMode) {
+        while ((txCount < FIFO_SIZE) && (dma.left != 0U)) {
+            txFifo[txCount++] = *dma.src++;
+            dma.left--;
+            threPending = FALSE;
+        }
+        if (dma.left == 0U) {
+            dma.done = TRUE;
+        }
+    }
+    if (((sim_UART3.TER & UART_TER_TXEN) != 0U) && (txCount != 0U)) {
+        if (lineOutLen < LINE_MAX) {
+            lineOut[lineOutLen++] = txFifo[0];
+        }
+        txCount--;
+        memmove(txFifo, &txFifo[1], txCount);
+        if (txCount == 0U) {
+            threPending = TRUE;
+        }
+    }
+    if (lineInPos < lineInLen) {
+        if (rxCount < FIFO_SIZE) {
+            rxFifo[rxCount++] = lineIn[lineInPos];
+        } else {
+            lsrErrors |= UART_LSR_OE;
+        }
+        if (lineInPos == lineInBad) {
+            lsrErrors |= UART_LSR_FE;
+        }
+        lineInPos++;
+        idle = 0;
+    } else if (rxCount != 0U) {
+        idle++;
+    } else {}
+    closePage();
+    takeInterrupts();
+}
+
+static void runTicks(uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        lineTick();
+    }
+}
+
+static void runUntilTxIdle(void)
+{
+    uint32_t i;
+
+    for (i = 0; (i < MAX_TICKS) && !serial_txIdle(); i++) {
+        lineTick();
+    }
+    runTicks(2U);
+}
+
+static void queueInput(uint32_t len, uint8_t mul)
+{
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        lineIn[lineInLen + i] = (uint8_t)((lineInLen + i) * mul + 3U);
+    }
+    lineInLen += len;
+}
+
+static void resetModel(void)
+{
+    lineInLen = 0;
+    lineInPos = 0;
+    lineInBad = LINE_MAX;
+    lineOutLen = 0;
+    txLost = 0;
+    uartIrqs = 0;
+    dmaIrqs = 0;
+    stuck = 0;
+    memset(&dma, 0, sizeof(dma));
+    stops = 0;
+    gos = 0;
+    txOpen = TRUE;
+}
+
+static void throttle(Bool stop)
+{
+    if (stop) {
+        stops++;
+    } else {
+        gos++;
+    }
+}
+
+static Bool allowed(void)
+{
+    return txOpen;
+}
+
+static void testRx(void)
+{
+    static const serial_flow_t hooks = {throttle, NULL};
+    serial_stats_t s;
+    uint8_t buf[SERIAL_RX_SIZE];
+    uint8_t *data;
+    uint32_t run;
+    uint32_t n;
+    uint32_t i;
+    uint32_t before = failures;
+
+    resetModel();
+    serial_init(TEST_BAUD);
+    serial_setFlow(&hooks);
+    queueInput(300U, 7U);
+    runTicks(300U + 8U);
+    serial_getStats(&s);
+    if ((serial_rxCount() != SERIAL_RX_SIZE) || (s.rxDropped != 300U - SERIAL_RX_SIZE)) {
+        fail("rx fill", serial_rxCount(), s.rxDropped);
+    }
+    if ((s.rxPeak != SERIAL_RX_SIZE) || (stops != 1U) || (gos != 0U)) {
+        fail("rx throttle", s.rxPeak, stops);
+    }
+
+    run = serial_peek(0U, &data);
+    for (i = 0; (i < run) && (data[i] == lineIn[i]); i++) {}
+    if ((run != SERIAL_RX_SIZE) || (i != run)) {
+        fail("rx peek", run, i);
+    }
+    serial_consume(100U);
+    if ((serial_peek(0U, &data) != 156U) || (data[0] != lineIn[100])
+        || (serial_peek(150U, &data) != 6U) || (serial_peek(156U, &data) != 0U)) {
+        fail("rx consume", serial_rxCount(), 0U);
+    }
+    serial_consume(SERIAL_RX_SIZE - 100U - SERIAL_RX_GO - 1U);
+    if (gos != 0U) {
+        fail("rx go early", serial_rxCount(), gos);
+    }
+    serial_consume(1U);
+    if ((gos != 1U) || (serial_rxCount() != SERIAL_RX_GO)) {
+        fail("rx go", serial_rxCount(), gos);
+    }
+
+    /* the next bytes wrap around the end of the ring */
+    lineInPos = lineInLen;
+    queueInput(100U, 13U);
+    runTicks(100U + 8U);
+    run = serial_peek(0U, &data);
+    n = serial_peek(run, &data);
+    if ((run != SERIAL_RX_GO) || (n != 100U) || (data[0] != lineIn[300])) {
+        fail("rx wrap", run, n);
+    }
+    serial_consume(run);
+    n = serial_read(buf, sizeof(buf));
+    if ((n != 100U) || (memcmp(buf, &lineIn[300], n) != 0) || (serial_rxCount() != 0U)) {
+        fail("rx read", n, serial_rxCount());
+    }
+    serial_getStats(&s);
+    if (stuck != 0U) {
+        fail("rx interrupt stuck", stuck, 0U);
+    }
+    printf("serial rx: %s, %u bytes in, %u dropped, %u timeouts, %u interrupts\n",
+            (failures == before) ? "ok" : "FAILED", (unsigned)s.rxBytes,
+            (unsigned)s.rxDropped, (unsigned)s.timeouts, (unsigned)uartIrqs);
+    serial_setFlow(NULL);
+}
+
+static void testErrors(void)
+{
+    serial_stats_t s;
+    uint8_t buf[64];
+    uint32_t n;
+    uint32_t before = failures;
+
+    resetModel();
+    serial_init(TEST_BAUD);
+    queueInput(10U, 5U);
+    lineInBad = 4U;
+    runTicks(10U + 8U);
+    n = serial_read(buf, sizeof(buf));
+
+    /* interrupt off: the FIFO fills and the rest overruns */
+    NVIC_DisableIRQ(UART3_IRQn);
+    queueInput(FIFO_SIZE + 4U, 5U);
+    runTicks(FIFO_SIZE + 4U);
+    NVIC_EnableIRQ(UART3_IRQn);
+    runTicks(8U);
+    n += serial_read(buf, sizeof(buf));
+    serial_getStats(&s);
+    if ((s.framingErrors != 1U) || (s.overruns != 1U) || (n != 10U + FIFO_SIZE)) {
+        fail("errors", s.framingErrors, s.overruns);
+    }
+    printf("serial errors: %s, %u framing, %u overruns, %u of %u bytes kept\n",
+            (failures == before) ? "ok" : "FAILED", (unsigned)s.framingErrors,
+            (unsigned)s.overruns, (unsigned)n, (unsigned)lineInLen);
+}
+
+static Bool sendAndCheck(uint32_t len, uint8_t mul)
+{
+    uint8_t buf[LINE_MAX];
+    uint32_t start = lineOutLen;
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        buf[i] = (uint8_t)(i * mul + 1U);
+    }
+    if (serial_write(buf, len) != len) {
+        return FALSE;
+    }
+    runUntilTxIdle();
+    return (Bool)(((lineOutLen - start) == len) && (memcmp(&lineOut[start], buf, len) == 0));
+}
+
+static void testTxDma(void)
+{
+    serial_stats_t s;
+    uint32_t before = failures;
+
+    resetModel();
+    GPDMA_Init();
+    serial_init(TEST_BAUD);
+    if (!sendAndCheck(1000U, 3U)) {
+        fail("tx dma 1000", lineOutLen, 0U);
+    }
+    if (!sendAndCheck(20U, 5U)) {
+        fail("tx dma short", lineOutLen, 0U);
+    }
+    /* 4 bytes to the end of the ring through the FIFO, the rest by GPDMA */
+    if (!sendAndCheck(900U, 11U)) {
+        fail("tx dma wrap", lineOutLen, 0U);
+    }
+    serial_getStats(&s);
+    if ((s.txBytes != 1920U) || (s.dmaBlocks != 2U) || (dma.blocks != 2U) || (txLost != 0U)
+        || (serial_txFree() != SERIAL_TX_SIZE) || (stuck != 0U)) {
+        fail("tx dma stats", s.dmaBlocks, txLost);
+    }
+    printf("serial tx dma: %s, %u bytes, %u dma blocks, %u uart and %u dma interrupts\n",
+            (failures == before) ? "ok" : "FAILED", (unsigned)s.txBytes,
+            (unsigned)s.dmaBlocks, (unsigned)uartIrqs, (unsigned)dmaIrqs);
+}
+
+static void testTxFifo(void)
+{
+    serial_stats_t s;
+    uint32_t before = failures;
+
+    resetModel();
+    dma.refuse = TRUE;
+    GPDMA_Init();
+    serial_init(TEST_BAUD);
+    if (!sendAndCheck(500U, 7U)) {
+        fail("tx fifo", lineOutLen, 0U);
+    }
+    serial_getStats(&s);
+    if ((s.txBytes != 500U) || (s.dmaBlocks != 0U) || (txLost != 0U) || (stuck != 0U)) {
+        fail("tx fifo stats", s.txBytes, txLost);
+    }
+    printf("serial tx fifo: %s, %u bytes, %u uart interrupts\n",
+            (failures == before) ? "ok" : "FAILED", (unsigned)s.txBytes, (unsigned)uartIrqs);
+}
+
+static void testTxFlow(void)
+{
+    static const serial_flow_t hooks = {NULL, allowed};
+    uint8_t buf[50];
+    uint32_t before = failures;
+
+    resetModel();
+    dma.refuse = TRUE;
+    serial_init(TEST_BAUD);
+    serial_setFlow(&hooks);
+    txOpen = FALSE;
+    memset(buf, 'x', sizeof(buf));
+    (void)serial_write(buf, sizeof(buf));
+    runTicks(100U);
+    if ((lineOutLen != 0U) || serial_txIdle()) {
+        fail("tx flow held", lineOutLen, 0U);
+    }
+    txOpen = TRUE;
+    serial_kick();
+    runUntilTxIdle();
+    if (lineOutLen != sizeof(buf)) {
+        fail("tx flow kick", lineOutLen, 0U);
+    }
+    printf("serial tx flow: %s\n", (failures == before) ? "ok" : "FAILED");
+    serial_setFlow(NULL);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+void GPDMA_Init(void)
+{
+    LPC_SC->PCONP |= CLKPWR_PCONP_PCGPDMA;
+}
+
+Status GPDMA_Setup(GPDMA_Channel_CFG_Type *GPDMAChannelConfig)
+{
+    Status output = ERROR;
+
+    if ((!dma.refuse) && (!dma.setUp) && (GPDMAChannelConfig->ChannelNum == SERIAL_DMA_CH)
+        && (GPDMAChannelConfig->DstConn == GPDMA_CONN_UART3_Tx)) {
+        dma.src = (const uint8_t *)(uintptr_t)GPDMAChannelConfig->SrcMemAddr;
+        dma.left = GPDMAChannelConfig->TransferSize;
+        dma.setUp = TRUE;
+        dma.done = FALSE;
+        dma.blocks++;
+        output = SUCCESS;
+    }
+    return output;
+}
+
+IntStatus GPDMA_IntGetStatus(GPDMA_Status_Type type, uint8_t channel)
+{
+    return ((type == GPDMA_STAT_INTTC) && (channel == SERIAL_DMA_CH) && dma.done) ? SET : RESET;
+}
+
+void GPDMA_ClearIntPending(GPDMA_StateClear_Type type, uint8_t channel)
+{
+    if ((type == GPDMA_STATCLR_INTTC) && (channel == SERIAL_DMA_CH)) {
+        dma.done = FALSE;
+    }
+}
+
+void GPDMA_ChannelCmd(uint8_t channelNum, FunctionalState NewState)
+{
+    if (channelNum == SERIAL_DMA_CH) {
+        dma.enabled = (Bool)(NewState == ENABLE);
+        if (!dma.enabled) {
+            dma.setUp = FALSE;
+        }
+    }
+}
+
+void sim_wfi(void)
+{
+}
+
+void check_failed(uint8_t *file, uint32_t line)
+{
+    fprintf(stderr, "serialtest: parameter check failed at %s:%u\n", (const char *)file, (unsigned)line);
+    abort();
+}
+
+int main(void)
+{
+    struct sigaction sa;
+
+    if ((uintptr_t)&sim_UART3 > 0xFFFFFFFFU) {
+        printf("serialtest: data above 4 GB, link with -no-pie\n");
+        return 1;
+    }
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO;
+    sa.sa_sigaction = onFault;
+    (void)sigaction(SIGSEGV, &sa, NULL);
+    sa.sa_sigaction = onStep;
+    (void)sigaction(SIGTRAP, &sa, NULL);
+    openPage();
+    closePage();
+
+    testRx();
+    testErrors();
+    testTxDma();
+    testTxFifo();
+    testTxFlow();
+    printf("serial: %s\n", (failures == 0) ? "all tests pass" : "FAILED");
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,713 @@
+/*****************************************************************************
+ *   sim.c:  Host simulator of the LPCXpresso base board, main and scheduler
+ *
+ ******************************************************************************/
+
+/*
+ * Runs the unmodified application (demo/src/main.c, compiled as
+ * firmware_main) with the real Lib_MCU and Lib_EaBaseBoard drivers on the
+ * host. The peripheral registers are structures in host memory (see
+ * inc/LPC17xx.h), the data path of GPIO, SSP, I2C and DAC is hooked in
+ * bus.c and routed to the device models.
+ *
+ * Every hooked call advances the virtual time (sim_spend) and delivers the
+ * interrupts that became due meanwhile by calling the handlers directly,
+ * in time order and one at a time (no nesting, no priorities):
+ *
+ *   SysTick     CTRL.ENABLE and TICKINT, (LOAD + 1) core clocks
+ *   TIMER0..3   TCR.enable, MCR.MR0I, (PR + 1) * (MR0 + 1) PCLKs
+ *   RTC         CCR.CLKEN, every second; counter increment per CIIR and
+ *               alarm per AMR, each delivered with its own ILR bit
+ *
+ * Write-one-to-clear flags (TIMx->IR, RTC->ILR) cannot be modeled in plain
+ * memory, so the flag is set before the handler is called and cleared when
+ * it returns. An interrupt disabled in the NVIC is dropped.
+ *
+ * The RTC CTIMEx registers are recomputed from the counters on every hooked
+ * call. TIMER2 counts the pulses of the motor encoder (CAP2.0): 100 per
+ * second while P2.10 (up) or P2.11 (down) drives the motor, until the blind
+ * reaches the end of its travel.
+ *
+ * The SD card is the RAM disk backend of the FatFs host build; the time it
+ * accounts is added to the virtual time at the next hooked call.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "LPC17xx.h"
+#include "lpc17xx_clkpwr.h"
+#include "sim.h"
+#include "ff.h"
+#include "ramdisk.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define CORE_CLOCK          100000000UL
+
+#define SYSTICK_VECTOR      15U
+#define IRQ_VECTOR(irq)     ((uint32_t)(irq) + 16U)
+
+#define MOTOR_UP_PIN        (1UL << 10)
+#define MOTOR_DOWN_PIN      (1UL << 11)
+#define MOTOR_PULSE_NS      (10ULL * SIM_NS_PER_MS)
+#define MOTOR_TRAVEL        400     /* pulses from bottom to top */
+
+#define SD_SECTORS          16384U  /* 8 MB image when created */
+
+#define MAX_KEYS            32
+
+typedef struct
+{
+    Bool active;
+    sim_time_t period;
+    sim_time_t next;
+} event_t;
+
+typedef struct
+{
+    sim_time_t time;
+    char key;
+    Bool down;
+} key_event_t;
+
+typedef struct
+{
+    const char *name;
+    int (*run)(void);
+} host_test_t;
+
+/******************************************************************************
+ * Simulated peripherals
+ *****************************************************************************/
+
+NVIC_Type sim_NVIC;
+SCB_Type sim_SCB;
+SysTick_Type sim_SysTick;
+ITM_Type sim_ITM;
+CoreDebug_Type sim_CoreDebug;
+sim_DWT_Type sim_DWT;
+
+LPC_SC_TypeDef       sim_SC;
+LPC_GPIO_TypeDef     sim_GPIO[5];
+LPC_WDT_TypeDef      sim_WDT;
+LPC_TIM_TypeDef      sim_TIM[4];
+LPC_RIT_TypeDef      sim_RIT;
+LPC_UART0_TypeDef    sim_UART0;
+LPC_UART1_TypeDef    sim_UART1;
+LPC_UART_TypeDef     sim_UART2;
+LPC_UART_TypeDef     sim_UART3;
+LPC_PWM_TypeDef      sim_PWM1;
+LPC_I2C_TypeDef      sim_I2C[3];
+LPC_I2S_TypeDef      sim_I2S;
+LPC_SPI_TypeDef      sim_SPI;
+LPC_RTC_TypeDef      sim_RTC;
+LPC_GPIOINT_TypeDef  sim_GPIOINT;
+LPC_PINCON_TypeDef   sim_PINCON;
+LPC_SSP_TypeDef      sim_SSP[2];
+LPC_ADC_TypeDef      sim_ADC;
+LPC_DAC_TypeDef      sim_DAC;
+LPC_CANAF_RAM_TypeDef sim_CANAF_RAM;
+LPC_CANAF_TypeDef    sim_CANAF;
+LPC_CANCR_TypeDef    sim_CANCR;
+LPC_CAN_TypeDef      sim_CAN[2];
+LPC_MCPWM_TypeDef    sim_MCPWM;
+LPC_QEI_TypeDef      sim_QEI;
+LPC_EMAC_TypeDef     sim_EMAC;
+LPC_GPDMA_TypeDef    sim_GPDMA;
+LPC_GPDMACH_TypeDef  sim_GPDMACH[8];
+LPC_USB_TypeDef      sim_USB;
+
+uint32_t SystemCoreClock = CORE_CLOCK;
+
+/******************************************************************************
+ * External functions
+ *****************************************************************************/
+
+int firmware_main(void);
+
+/* Interrupt handlers of the firmware, those not defined are never called */
+extern void SysTick_Handler(void) __attribute__ ((weak));
+extern void TIMER0_IRQHandler(void) __attribute__ ((weak));
+extern void TIMER1_IRQHandler(void) __attribute__ ((weak));
+extern void TIMER2_IRQHandler(void) __attribute__ ((weak));
+extern void TIMER3_IRQHandler(void) __attribute__ ((weak));
+extern void RTC_IRQHandler(void) __attribute__ ((weak));
+extern void ENET_IRQHandler(void) __attribute__ ((weak));
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+sim_time_t sim_now = 0;
+
+static sim_time_t endTime = 10ULL * SIM_NS_PER_S;
+static Bool inHandler = FALSE;
+
+static FILE *trace = NULL;
+static Bool traceTime = TRUE;
+static Bool traceGpio = FALSE;
+
+static event_t sysTick;
+static event_t timer[4];
+static event_t rtc;
+static event_t motor;
+static int32_t motorPos = MOTOR_TRAVEL / 2;
+
+static key_event_t keyEvents[MAX_KEYS * 2];
+static uint32_t keyCount = 0;
+static uint32_t keyNext = 0;
+
+static unsigned long long sdTime = 0;
+static Bool sdOpen = FALSE;
+
+static const char *eepromFile = NULL;
+static const char *pbmFile = NULL;
+static Bool quiet = FALSE;
+
+static unsigned long long irqCount[6];
+
+/* Host tests run by -x instead of the firmware */
+static const host_test_t tests[] = {
+    {"kvstore", kvtest_run},
+    {"proto", prototest_run},
+    {"uart2", uart2test_run},
+    {"cangroup", cangrouptest_run},
+    {"net", nettest_run},
+    {"boot", boottest_run},
+    {"profile", proftest_run},
+};
+
+static void (*const timerHandler[4])(void) = {
+    TIMER0_IRQHandler, TIMER1_IRQHandler, TIMER2_IRQHandler, TIMER3_IRQHandler
+};
+static const IRQn_Type timerIrq[4] = {TIMER0_IRQn, TIMER1_IRQn, TIMER2_IRQn, TIMER3_IRQn};
+static const uint32_t timerPclk[4] = {
+    CLKPWR_PCLKSEL_TIMER0, CLKPWR_PCLKSEL_TIMER1, CLKPWR_PCLKSEL_TIMER2, CLKPWR_PCLKSEL_TIMER3
+};
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static Bool irqEnabled(IRQn_Type irq)
+{
+    return (NVIC->ISER[(uint32_t)irq >> 5] & (1UL << ((uint32_t)irq & 0x1F))) ? TRUE : FALSE;
+}
+
+static void callHandler(void (*handler)(void), uint32_t vector)
+{
+    if (handler != NULL) {
+        SCB->ICSR = (SCB->ICSR & ~SCB_ICSR_VECTACTIVE_Msk) | vector;
+        handler();
+        SCB->ICSR &= ~SCB_ICSR_VECTACTIVE_Msk;
+    }
+}
+
+/* (Re)arms an event when its period changes, stops it when inactive */
+static void schedule(event_t *ev, Bool active, sim_time_t period)
+{
+    if (!active || (period == 0)) {
+        ev->active = FALSE;
+    } else if (!ev->active || (ev->period != period)) {
+        ev->active = TRUE;
+        ev->period = period;
+        ev->next = sim_now + period;
+    }
+}
+
+static uint8_t daysInMonth(uint8_t month, uint16_t year)
+{
+    static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    uint8_t output = 31;
+
+    if ((month >= 1) && (month <= 12)) {
+        output = days[month - 1];
+        if ((month == 2) && ((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0))) {
+            output = 29;
+        }
+    }
+    return output;
+}
+
+static void updateCtime(void)
+{
+    LPC_RTC->CTIME0 = (LPC_RTC->SEC & 0x3F) | ((uint32_t)(LPC_RTC->MIN & 0x3F) << 8)
+            | ((uint32_t)(LPC_RTC->HOUR & 0x1F) << 16) | ((uint32_t)(LPC_RTC->DOW & 7) << 24);
+    LPC_RTC->CTIME1 = (LPC_RTC->DOM & 0x1F) | ((uint32_t)(LPC_RTC->MONTH & 0xF) << 8)
+            | ((uint32_t)(LPC_RTC->YEAR & 0xFFF) << 16);
+    LPC_RTC->CTIME2 = LPC_RTC->DOY & 0xFFF;
+}
+
+/* One second of the RTC counters, returns the CIIR bits of the changed fields */
+static uint8_t rtcIncrement(void)
+{
+    uint8_t changed = 0x01;
+
+    if (++LPC_RTC->SEC >= 60) {
+        LPC_RTC->SEC = 0;
+        changed |= 0x02;
+        if (++LPC_RTC->MIN >= 60) {
+            LPC_RTC->MIN = 0;
+            changed |= 0x04;
+            if (++LPC_RTC->HOUR >= 24) {
+                LPC_RTC->HOUR = 0;
+                changed |= 0x38;
+                LPC_RTC->DOW = (LPC_RTC->DOW + 1) % 7;
+                LPC_RTC->DOY++;
+                if (++LPC_RTC->DOM > daysInMonth(LPC_RTC->MONTH, LPC_RTC->YEAR)) {
+                    LPC_RTC->DOM = 1;
+                    changed |= 0x40;
+                    if (++LPC_RTC->MONTH > 12) {
+                        LPC_RTC->MONTH = 1;
+                        LPC_RTC->DOY = 1;
+                        LPC_RTC->YEAR++;
+                        changed |= 0x80;
+                    }
+                }
+            }
+        }
+    }
+    return changed;
+}
+
+static Bool rtcAlarm(void)
+{
+    uint8_t mask = LPC_RTC->AMR;
+
+    return (((mask & 0x01) || (LPC_RTC->SEC == LPC_RTC->ALSEC))
+            && ((mask & 0x02) || (LPC_RTC->MIN == LPC_RTC->ALMIN))
+            && ((mask & 0x04) || (LPC_RTC->HOUR == LPC_RTC->ALHOUR))
+            && ((mask & 0x08) || (LPC_RTC->DOM == LPC_RTC->ALDOM))
+            && ((mask & 0x10) || (LPC_RTC->DOW == LPC_RTC->ALDOW))
+            && ((mask & 0x20) || (LPC_RTC->DOY == LPC_RTC->ALDOY))
+            && ((mask & 0x40) || (LPC_RTC->MONTH == LPC_RTC->ALMON))
+            && ((mask & 0x80) || (LPC_RTC->YEAR == LPC_RTC->ALYEAR))
+            && (mask != 0xFF)) ? TRUE : FALSE;
+}
+
+static void rtcInterrupt(uint8_t flag)
+{
+    if (irqEnabled(RTC_IRQn)) {
+        LPC_RTC->ILR = flag;
+        irqCount[5]++;
+        callHandler(RTC_IRQHandler, IRQ_VECTOR(RTC_IRQn));
+        LPC_RTC->ILR = 0;
+    }
+}
+
+static void rtcTick(void)
+{
+    uint8_t changed = rtcIncrement();
+
+    updateCtime();
+    if ((changed & LPC_RTC->CIIR) != 0) {
+        rtcInterrupt(0x01);
+    }
+    if (rtcAlarm()) {
+        sim_trace("rtc alarm %02u:%02u:%02u\n", LPC_RTC->HOUR, LPC_RTC->MIN, LPC_RTC->SEC);
+        rtcInterrupt(0x02);
+    }
+}
+
+static void timerMatch(uint32_t n)
+{
+    if (irqEnabled(timerIrq[n])) {
+        sim_TIM[n].IR = 0x01;
+        irqCount[1 + n]++;
+        callHandler(timerHandler[n], IRQ_VECTOR(timerIrq[n]));
+        sim_TIM[n].IR = 0;
+    }
+    if (sim_TIM[n].MCR & 0x04) {
+        sim_TIM[n].TCR &= ~0x01UL;      /* stop on MR0 */
+    }
+}
+
+static void motorPulse(void)
+{
+    uint32_t out = bus_outputs(2);
+    int32_t step = 0;
+
+    if ((out & MOTOR_UP_PIN) && !(out & MOTOR_DOWN_PIN) && (motorPos < MOTOR_TRAVEL)) {
+        step = 1;
+    } else if ((out & MOTOR_DOWN_PIN) && !(out & MOTOR_UP_PIN) && (motorPos > 0)) {
+        step = -1;
+    }
+    if (step != 0) {
+        motorPos += step;
+        if ((LPC_TIM2->TCR & 0x03) == 0x01) {
+            LPC_TIM2->TC++;
+        }
+        if ((motorPos == 0) || (motorPos == MOTOR_TRAVEL)) {
+            sim_trace("motor end stop %s\n", (motorPos == 0) ? "bottom" : "top");
+        }
+    }
+}
+
+static void updateSchedule(void)
+{
+    uint32_t n;
+    Bool on;
+    sim_time_t period;
+
+    on = ((SysTick->CTRL & (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk))
+            == (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk)) ? TRUE : FALSE;
+    schedule(&sysTick, on, ((sim_time_t)(SysTick->LOAD + 1) * SIM_NS_PER_S) / SystemCoreClock);
+
+    for (n = 0; n < 4; n++) {
+        on = (((sim_TIM[n].TCR & 0x03) == 0x01) && ((sim_TIM[n].CTCR & 0x03) == 0)
+                && (sim_TIM[n].MCR & 0x01)) ? TRUE : FALSE;
+        period = ((sim_time_t)(sim_TIM[n].PR + 1) * (sim_TIM[n].MR0 + 1) * SIM_NS_PER_S)
+                / CLKPWR_GetPCLK(timerPclk[n]);
+        schedule(&timer[n], on, period);
+    }
+
+    schedule(&rtc, (LPC_RTC->CCR & 0x01) ? TRUE : FALSE, SIM_NS_PER_S);
+    schedule(&motor, TRUE, MOTOR_PULSE_NS);
+}
+
+/* Delivers all events due at the current virtual time, earliest first */
+static void dispatch(void)
+{
+    event_t *ev[7] = {&sysTick, &timer[0], &timer[1], &timer[2], &timer[3], &rtc, &motor};
+    event_t *due;
+    uint32_t i;
+    uint32_t which = 0;
+
+    do {
+        while ((keyNext < keyCount) && (keyEvents[keyNext].time <= sim_now)) {
+            bus_press(keyEvents[keyNext].key, keyEvents[keyNext].down);
+            keyNext++;
+        }
+        updateSchedule();
+        due = NULL;
+        for (i = 0; i < 7; i++) {
+            if (ev[i]->active && (ev[i]->next <= sim_now)
+                    && ((due == NULL) || (ev[i]->next < due->next))) {
+                due = ev[i];
+                which = i;
+            }
+        }
+        if (due != NULL) {
+            due->next += due->period;
+            if (which == 0) {
+                irqCount[0]++;
+                callHandler(SysTick_Handler, SYSTICK_VECTOR);
+            } else if (which <= 4) {
+                timerMatch(which - 1);
+            } else if (which == 5) {
+                rtcTick();
+            } else {
+                motorPulse();
+            }
+        }
+    } while (due != NULL);
+
+    if (emac_service() && irqEnabled(ENET_IRQn)) {
+        callHandler(ENET_IRQHandler, IRQ_VECTOR(ENET_IRQn));
+    }
+}
+
+static void finish(void)
+{
+    RAMDISK_STAT sd;
+
+    if (trace != NULL) {
+        fflush(trace);
+    }
+    if (!quiet) {
+        printf("simulated %.3f s\n", (double)sim_now / SIM_NS_PER_S);
+        bus_report(stdout);
+        if (sdOpen) {
+            ramdisk_get_stat(&sd);
+            printf("sd card: %lu reads (%lu sectors), %lu writes (%lu sectors), %lu syncs, %.3f ms\n",
+                    (unsigned long)sd.rd_cmds, (unsigned long)sd.rd_sects, (unsigned long)sd.wr_cmds,
+                    (unsigned long)sd.wr_sects, (unsigned long)sd.syncs, (double)sd.time_ns / SIM_NS_PER_MS);
+        }
+        printf("interrupts: systick %llu, timer0 %llu, timer1 %llu, timer2 %llu, timer3 %llu, rtc %llu\n",
+                irqCount[0], irqCount[1], irqCount[2], irqCount[3], irqCount[4], irqCount[5]);
+        printf("rtc: %04u-%02u-%02u %02u:%02u:%02u, motor position %d of %d\n",
+                LPC_RTC->YEAR, LPC_RTC->MONTH, LPC_RTC->DOM, LPC_RTC->HOUR, LPC_RTC->MIN,
+                LPC_RTC->SEC, (int)motorPos, MOTOR_TRAVEL);
+        ssd1305_dump(stdout);
+    }
+    if ((pbmFile != NULL) && !ssd1305_savePbm(pbmFile)) {
+        fprintf(stderr, "sim: cannot write %s\n", pbmFile);
+    }
+    if ((eepromFile != NULL) && !eeprom24_save(eepromFile)) {
+        fprintf(stderr, "sim: cannot write %s\n", eepromFile);
+    }
+    if (sdOpen) {
+        ramdisk_close();
+    }
+    exit(0);
+}
+
+static int compareKeys(const void *a, const void *b)
+{
+    const key_event_t *ka = (const key_event_t *)a;
+    const key_event_t *kb = (const key_event_t *)b;
+
+    return (ka->time < kb->time) ? -1 : ((ka->time > kb->time) ? 1 : 0);
+}
+
+static Bool addKey(const char *arg)
+{
+    unsigned long at;
+    unsigned long hold = 100;
+    char key;
+    int n = sscanf(arg, "%lu:%c:%lu", &at, &key, &hold);
+
+    if ((n < 2) || (keyCount >= MAX_KEYS * 2) || (strchr("cudlr12", key) == NULL)) {
+        return FALSE;
+    }
+    keyEvents[keyCount].time = at * SIM_NS_PER_MS;
+    keyEvents[keyCount].key = key;
+    keyEvents[keyCount].down = TRUE;
+    keyCount++;
+    keyEvents[keyCount].time = (at + hold) * SIM_NS_PER_MS;
+    keyEvents[keyCount].key = key;
+    keyEvents[keyCount].down = FALSE;
+    keyCount++;
+    return TRUE;
+}
+
+/* Opens the SD card image, a new image is created and formatted */
+static Bool openSd(const char *path)
+{
+    struct stat st;
+    Bool fresh = ((stat(path, &st) != 0) || (st.st_size == 0)) ? TRUE : FALSE;
+    FATFS fs;
+    Bool output = FALSE;
+
+    if (ramdisk_open(path, fresh ? SD_SECTORS : 0) == 0) {
+        output = TRUE;
+        if (fresh) {
+            f_mount(0, &fs);
+            output = (f_mkfs(0, 1, 4096) == FR_OK) ? TRUE : FALSE;
+            f_mount(0, NULL);
+        }
+        ramdisk_reset_stat();
+    }
+    return output;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage: sim [options]\n"
+        "  -s sec      simulated time in seconds (10)\n"
+        "  -o file     write the bus trace to file, - for stdout\n"
+        "  -n          no time stamps in the trace\n"
+        "  -g          trace GPIO output changes\n"
+        "  -t temp     temperature in tenths of a degree C (220), none for no sensor\n"
+        "  -l lux      illuminance at the light sensor (300)\n"
+        "  -e file     EEPROM contents, loaded at start and saved at the end\n"
+        "  -w us       EEPROM write cycle time (0)\n"
+        "  -d file     SD card image, created and formatted when missing\n"
+        "  -f file     save the final OLED picture as PBM\n"
+        "  -k ms:key[:hold]  press a key at ms for hold ms (100), keys c u d l r\n"
+        "              (joystick) and 1 2 (buttons), may be repeated\n"
+        "  -u          UART3 on a pseudo terminal, its path is printed\n"
+        "  -i name     EMAC on the TAP interface name, created if missing\n"
+        "  -q          no summary\n"
+        "  -x test     run a host test instead of the firmware: kvstore, proto,\n"
+        "              uart2, cangroup, net, boot, profile\n");
+    exit(1);
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Advance the virtual time and deliver the interrupts that became due
+ *
+ * Params:
+ *   [in] ns - time taken by the hooked call
+ *
+ *****************************************************************************/
+void sim_spend(sim_time_t ns)
+{
+    RAMDISK_STAT sd;
+
+    sim_now += ns;
+    if (sdOpen) {
+        ramdisk_get_stat(&sd);
+        sim_now += sd.time_ns - sdTime;
+        sdTime = sd.time_ns;
+    }
+    updateCtime();
+    if ((sim_DWT.CTRL & 0x01) != 0) {         /* CYCCNTENA, see demo/src/dwt.h */
+        sim_DWT.CYCCNT = (uint32_t)((sim_now * (SystemCoreClock / 1000000U)) / SIM_NS_PER_US);
+    }
+    if (sim_now >= endTime) {
+        finish();
+    }
+    if (!inHandler) {
+        inHandler = TRUE;
+        dispatch();
+        inHandler = FALSE;
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Sleep until the next interrupt (__WFI): advance the virtual time to
+ *    the earliest scheduled event or key press and deliver it. Ends the run
+ *    if nothing is scheduled.
+ *
+ *****************************************************************************/
+void sim_wfi(void)
+{
+    event_t *ev[7] = {&sysTick, &timer[0], &timer[1], &timer[2], &timer[3], &rtc, &motor};
+    sim_time_t wake = endTime;
+    uint32_t i;
+
+    updateSchedule();
+    for (i = 0; i < 7; i++) {
+        if (ev[i]->active && (ev[i]->next < wake)) {
+            wake = ev[i]->next;
+        }
+    }
+    if ((keyNext < keyCount) && (keyEvents[keyNext].time < wake)) {
+        wake = keyEvents[keyNext].time;
+    }
+    sim_spend((wake > sim_now) ? (wake - sim_now) : SIM_HOOK_NS);
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Write a line to the trace, prefixed with the virtual time unless -n
+ *
+ *****************************************************************************/
+void sim_trace(const char *fmt, ...)
+{
+    va_list args;
+
+    if (trace != NULL) {
+        if (traceTime) {
+            fprintf(trace, "%5llu.%06llu ", sim_now / SIM_NS_PER_S,
+                    (sim_now % SIM_NS_PER_S) / SIM_NS_PER_US);
+        }
+        va_start(args, fmt);
+        vfprintf(trace, fmt, args);
+        va_end(args);
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    TRUE if GPIO output changes are traced
+ *
+ *****************************************************************************/
+Bool sim_traceGpio(void)
+{
+    return traceGpio;
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Parameter check of the driver library failed
+ *
+ *****************************************************************************/
+void check_failed(uint8_t *file, uint32_t line)
+{
+    fprintf(stderr, "sim: parameter check failed at %s:%u\n", (const char *)file, (unsigned)line);
+    abort();
+}
+
+int main(int argc, char *argv[])
+{
+    int c;
+    uint32_t i;
+    const char *test = NULL;
+
+    while ((c = getopt(argc, argv, "s:o:ngt:l:e:w:d:f:k:ui:qx:")) != -1) {
+        switch (c) {
+        case 's': endTime = (sim_time_t)(strtod(optarg, NULL) * SIM_NS_PER_S); break;
+        case 'o':
+            trace = (strcmp(optarg, "-") == 0) ? stdout : fopen(optarg, "w");
+            if (trace == NULL) {
+                fprintf(stderr, "sim: cannot write %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'n': traceTime = FALSE; break;
+        case 'g': traceGpio = TRUE; break;
+        case 't':
+            if (strcmp(optarg, "none") == 0) {
+                max6576_disconnect();
+            } else {
+                max6576_setTemp((int32_t)strtol(optarg, NULL, 0));
+            }
+            break;
+        case 'l': isl29003_setLux((uint32_t)strtoul(optarg, NULL, 0)); break;
+        case 'e': eepromFile = optarg; break;
+        case 'w': eeprom24_setWriteTime(strtoull(optarg, NULL, 0) * SIM_NS_PER_US); break;
+        case 'd':
+            if (!openSd(optarg)) {
+                fprintf(stderr, "sim: cannot open %s\n", optarg);
+                return 1;
+            }
+            sdOpen = TRUE;
+            break;
+        case 'f': pbmFile = optarg; break;
+        case 'k':
+            if (!addKey(optarg)) {
+                usage();
+            }
+            break;
+        case 'u':
+            if (!serial_openPty()) {
+                fprintf(stderr, "sim: cannot open a pseudo terminal\n");
+                return 1;
+            }
+            break;
+        case 'i':
+            if (!emac_openTap(optarg)) {
+                fprintf(stderr, "sim: cannot open TAP interface %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'q': quiet = TRUE; break;
+        case 'x': test = optarg; break;
+        default: usage(); break;
+        }
+    }
+    if (optind != argc) {
+        usage();
+    }
+    if (eepromFile != NULL) {
+        (void)eeprom24_load(eepromFile);
+    }
+    qsort(keyEvents, keyCount, sizeof(keyEvents[0]), compareKeys);
+
+    if (test != NULL) {
+        endTime = ~(sim_time_t)0;
+        for (i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+            if (strcmp(tests[i].name, test) == 0) {
+                return tests[i].run();
+            }
+        }
+        usage();
+    }
+    (void)firmware_main();
+    finish();
+    return 0;
+}
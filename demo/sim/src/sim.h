@@ -0,0 +1,135 @@
+/*****************************************************************************
+ *   sim.h:  Host simulator of the LPCXpresso base board, internal interface
+ *
+ ******************************************************************************/
+#ifndef __SIM_H
+#define __SIM_H
+
+#include <stdio.h>
+#include "lpc_types.h"
+
+/*
+ * Virtual time in nanoseconds. It only advances when the firmware calls a
+ * hooked driver function (GPIO, SSP, I2C, DAC) by the time the transfer
+ * would take on the bus, so traces do not depend on the host speed.
+ */
+typedef unsigned long long sim_time_t;
+
+#define SIM_NS_PER_US       1000ULL
+#define SIM_NS_PER_MS       1000000ULL
+#define SIM_NS_PER_S        1000000000ULL
+
+#define SIM_HOOK_NS         250U    /* cost of a hooked call without bus traffic */
+
+/* Columns of the controller RAM the 96x64 panel is connected to, see oled.c */
+#define SIM_OLED_X0         18U
+#define SIM_OLED_WIDTH      96U
+#define SIM_OLED_HEIGHT     64U
+
+/* sim.c */
+extern sim_time_t sim_now;
+void sim_spend(sim_time_t ns);
+void sim_trace(const char *fmt, ...) __attribute__ ((format (printf, 1, 2)));
+Bool sim_traceGpio(void);
+
+/* bus.c */
+uint32_t bus_outputs(uint8_t port);
+void bus_press(char key, Bool down);
+void bus_report(FILE *out);
+
+/* ssd1305.c */
+void ssd1305_write(uint8_t byte, Bool data);
+void ssd1305_dump(FILE *out);
+Bool ssd1305_savePbm(const char *path);
+
+/* isl29003.c */
+void isl29003_setLux(uint32_t lux);
+Bool isl29003_write(uint8_t i2cAddr, const uint8_t *buf, uint32_t len);
+Bool isl29003_read(uint8_t i2cAddr, uint8_t *buf, uint32_t len);
+
+/* eeprom24.c */
+void eeprom24_setWriteTime(sim_time_t ns);
+Bool eeprom24_load(const char *path);
+Bool eeprom24_save(const char *path);
+Bool eeprom24_write(uint8_t addr, const uint8_t *buf, uint32_t len);
+Bool eeprom24_read(uint8_t addr, uint8_t *buf, uint32_t len);
+
+/* max6576.c */
+void max6576_setTemp(int32_t tenthsC);
+void max6576_disconnect(void);
+uint32_t max6576_level(sim_time_t now);
+
+/* at45db.c */
+typedef struct
+{
+    uint32_t programs;      /* page program commands */
+    uint32_t erases;        /* block erase commands */
+    uint32_t errors;        /* commands the busy part cannot take */
+} at45db_stat_t;
+
+void at45db_select(Bool active);
+uint8_t at45db_transfer(uint8_t out);
+void at45db_powerFail(uint32_t ops);
+Bool at45db_powerOn(void);
+uint8_t *at45db_memory(uint32_t *size);
+void at45db_getStat(at45db_stat_t *out);
+
+/* sc16is752.c */
+typedef struct
+{
+    uint32_t transfers;     /* I2C transactions, each starts with a write */
+    uint32_t bytes;         /* I2C data bytes, sub-addresses included */
+    uint32_t iirNone;       /* IIR reads with no interrupt pending */
+    uint32_t overruns;      /* characters lost, RX FIFO full */
+    uint32_t txLost;        /* THR writes to a full TX FIFO */
+} sc16is752_stat_t;
+
+Bool sc16is752_write(uint8_t addr, const uint8_t *buf, uint32_t len);
+Bool sc16is752_read(uint8_t addr, uint8_t *buf, uint32_t len);
+uint32_t sc16is752_feed(uint32_t chan, const uint8_t *data, uint32_t len);
+uint32_t sc16is752_sent(uint32_t chan, const uint8_t **data);
+Bool sc16is752_lineBusy(uint32_t chan);
+void sc16is752_reset(void);
+void sc16is752_getStat(sc16is752_stat_t *out);
+
+/* kvtest.c */
+int kvtest_run(void);
+
+/* boottest.c */
+int boottest_run(void);
+
+/* proftest.c */
+int proftest_run(void);
+
+/* prototest.c */
+int prototest_run(void);
+
+/* uart2test.c */
+int uart2test_run(void);
+
+/* cangrouptest.c */
+int cangrouptest_run(void);
+
+/* nettest.c */
+int nettest_run(void);
+
+/* serial.c */
+typedef void (*serial_sink_t)(const uint8_t *data, uint32_t len);
+
+Bool serial_openPty(void);
+uint32_t serial_inject(const uint8_t *data, uint32_t len);
+void serial_setSink(serial_sink_t sink);
+
+/* emac.c */
+typedef void (*emac_sink_t)(const uint8_t *frame, uint32_t len);
+
+Bool emac_openTap(const char *name);
+Bool emac_inject(const uint8_t *frame, uint32_t len, uint32_t flags);
+void emac_setSink(emac_sink_t sink);
+Bool emac_service(void);
+
+
+#endif /* end __SIM_H */
+/****************************************************************************
+**                            End Of File
+*****************************************************************************/
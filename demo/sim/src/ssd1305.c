@@ -0,0 +1,213 @@
+/*****************************************************************************
+ *   ssd1305.c:  Model of the SSD1305 OLED controller (4-wire SPI)
+ *
+ ******************************************************************************/
+
+/*
+ * Keeps the 132x64 display RAM and the addressing state. Commands with
+ * parameters are collected until complete; the bytes following a command
+ * with D/C low are its parameters. Page and horizontal addressing are
+ * modeled, the scroll, colour and timing commands are accepted and
+ * ignored. The dump shows the RAM the way oled.c addresses it (column
+ * SIM_OLED_X0 + x, bit y % 8 of page y / 8), i.e. the picture on the panel
+ * with the segment remap and COM scan direction set by oled_init.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define RAM_COLUMNS     132
+#define RAM_PAGES       8
+
+#define MODE_HORIZONTAL 0
+#define MODE_PAGE       2
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint8_t ram[RAM_PAGES][RAM_COLUMNS];
+
+static uint8_t column = 0;
+static uint8_t page = 0;
+static uint8_t mode = MODE_PAGE;
+static uint8_t colStart = 0;
+static uint8_t colEnd = RAM_COLUMNS - 1;
+static uint8_t pageStart = 0;
+static uint8_t pageEnd = RAM_PAGES - 1;
+
+static Bool displayOn = FALSE;
+static Bool inverse = FALSE;
+
+static uint8_t cmd[5];          /* command being collected */
+static uint8_t cmdLen = 0;      /* bytes collected, 0 - none */
+static uint8_t cmdNeed = 0;     /* bytes of the complete command */
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/* Number of parameter bytes following a command byte */
+static uint8_t paramCount(uint8_t c)
+{
+    switch (c) {
+    case 0x20: case 0x81: case 0x82: case 0xA8: case 0xAD: case 0xD3:
+    case 0xD5: case 0xD8: case 0xD9: case 0xDA: case 0xDB:
+        return 1;
+    case 0x21: case 0x22:
+        return 2;
+    case 0x91: case 0x92: case 0x93:
+        return 4;
+    case 0x26: case 0x27:
+        return 5;
+    default:
+        return 0;
+    }
+}
+
+static void execute(void)
+{
+    uint8_t c = cmd[0];
+
+    if (c <= 0x0F) {
+        column = (column & 0xF0) | c;
+    } else if (c <= 0x1F) {
+        column = (column & 0x0F) | ((c & 0x0F) << 4);
+    } else if ((c >= 0xB0) && (c <= 0xB7)) {
+        page = c & 0x07;
+    } else {
+        switch (c) {
+        case 0x20:
+            mode = cmd[1] & 3;
+            break;
+        case 0x21:
+            colStart = cmd[1];
+            colEnd = cmd[2];
+            column = colStart;
+            break;
+        case 0x22:
+            pageStart = cmd[1] & 7;
+            pageEnd = cmd[2] & 7;
+            page = pageStart;
+            break;
+        case 0xA6:
+        case 0xA7:
+            inverse = (c == 0xA7) ? TRUE : FALSE;
+            break;
+        case 0xAE:
+        case 0xAF:
+            displayOn = (c == 0xAF) ? TRUE : FALSE;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void writeRam(uint8_t byte)
+{
+    if (column < RAM_COLUMNS) {
+        ram[page][column] = byte;
+    }
+    if (mode == MODE_PAGE) {
+        if (column < RAM_COLUMNS - 1) {
+            column++;
+        }
+    } else if (column < colEnd) {
+        column++;
+    } else {
+        column = colStart;
+        page = (page < pageEnd) ? (uint8_t)(page + 1) : pageStart;
+    }
+}
+
+static Bool pixel(uint32_t x, uint32_t y)
+{
+    Bool on = ((ram[y >> 3][SIM_OLED_X0 + x] >> (y & 7)) & 1) ? TRUE : FALSE;
+    return (on != inverse) ? TRUE : FALSE;
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Byte received while the chip select is active
+ *
+ * Params:
+ *   [in] byte - received byte
+ *   [in] data - D/C line, TRUE for display data
+ *
+ *****************************************************************************/
+void ssd1305_write(uint8_t byte, Bool data)
+{
+    if (data) {
+        writeRam(byte);
+    } else {
+        if (cmdLen == 0) {
+            cmdNeed = 1 + paramCount(byte);
+        }
+        cmd[cmdLen++] = byte;
+        if (cmdLen == cmdNeed) {
+            execute();
+            cmdLen = 0;
+        }
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Print the panel contents, '#' for a lit pixel
+ *
+ *****************************************************************************/
+void ssd1305_dump(FILE *out)
+{
+    uint32_t x;
+    uint32_t y;
+
+    fprintf(out, "oled: display %s\n", displayOn ? "on" : "off");
+    for (y = 0; y < SIM_OLED_HEIGHT; y++) {
+        for (x = 0; x < SIM_OLED_WIDTH; x++) {
+            fputc(pixel(x, y) ? '#' : '.', out);
+        }
+        fputc('\n', out);
+    }
+}
+
+/******************************************************************************
+ *
+ * Description:
+ *    Save the panel contents as a plain PBM image
+ *
+ * Returns:
+ *    TRUE on success
+ *
+ *****************************************************************************/
+Bool ssd1305_savePbm(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    uint32_t x;
+    uint32_t y;
+
+    if (f == NULL) {
+        return FALSE;
+    }
+    fprintf(f, "P1\n%u %u\n", SIM_OLED_WIDTH, SIM_OLED_HEIGHT);
+    for (y = 0; y < SIM_OLED_HEIGHT; y++) {
+        for (x = 0; x < SIM_OLED_WIDTH; x++) {
+            fputs(pixel(x, y) ? "1 " : "0 ", f);
+        }
+        fputc('\n', f);
+    }
+    return (fclose(f) == 0) ? TRUE : FALSE;
+}
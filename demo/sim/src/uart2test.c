@@ -0,0 +1,310 @@
+/*****************************************************************************
+ *   uart2test.c:  Host test of Lib_EaBaseBoard/src/uart2.c on the I2C bus
+ *
+ ******************************************************************************/
+
+/*
+ * Run with ./sim -x uart2 instead of the firmware. uart2.c runs unmodified
+ * on I2C2 at the 100 kHz of main.c against the SC16IS752 model
+ * (sc16is752.c); the byte loops of the driver before the FIFO rewrite are
+ * kept here (old*) to compare with. For each baud rate:
+ *
+ *   send      1000 bytes with uart2_send, then uart2_poll until the last
+ *             one left the line (or 100 ms after it should have); the old
+ *             loop reads LSR until THRE and writes THR for every byte
+ *   receive   the other end sends 1000 bytes back to back, uart2_receive
+ *             (blocking) takes them; the old loop reads LSR until RDR and
+ *             then RHR for every byte. The old init did not enable the
+ *             FIFOs, so its RX holding register overruns when the loop is
+ *             slower than the line; both loops give up 100 ms after the
+ *             last byte would have arrived.
+ *
+ * Every phase prints the bytes that arrived and whether they are the data
+ * sent, the I2C transactions and bytes it took, the virtual time and the
+ * characters lost to overruns. Both drivers are called without pause, so
+ * the count is what a blocking call costs. uart2.c is built without
+ * UART2_IRQ_PORT, as the wiring of IRQ# is unknown (see uart2.h), and gets
+ * a ms tick from uart2_setTicks: it asks the chip every 48 character
+ * times, each call of the tick stands for 1 us of the caller's loop.
+ * "idle" is the number of IIR reads that found nothing pending.
+ *
+ * I2C at 100 kHz moves a byte in 9 bit times, 90 us, and a character at
+ * 115200 baud takes 86.8 us: no driver keeps up with a back to back
+ * stream there, the receive at 115200 is expected to lose data and is
+ * printed, not checked. The output is deterministic, make check compares
+ * it.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <string.h>
+#include "lpc17xx_i2c.h"
+#include "uart2.h"
+#include "sim.h"
+
+/******************************************************************************
+ * Defines and typedefs
+ *****************************************************************************/
+
+#define DATA_LEN            1000U
+#define GIVE_UP_NS          (100ULL * SIM_NS_PER_MS)
+#define I2C_HZ              100000U
+#define LOOP_NS             1000U       /* a pass of a polling loop */
+
+#define UART2_ADDR          0x48
+#define SUB_ADDR(reg)       ((uint8_t)((reg) << 3))     /* channel A */
+#define R_RHR               0x00
+#define R_THR               0x00
+#define R_DLL               0x00
+#define R_DLH               0x01
+#define R_LCR               0x03
+#define R_LSR               0x05
+#define LSR_RDR             0x01
+#define LSR_THRE            0x20
+
+typedef struct
+{
+    sc16is752_stat_t stat;
+    sim_time_t start;
+} phase_t;
+
+typedef struct
+{
+    uint32_t baud;
+    Bool receiveOk;         /* the bus is faster than the line */
+} rate_t;
+
+/******************************************************************************
+ * Local variables
+ *****************************************************************************/
+
+static uint32_t failures = 0;
+static uint8_t data[DATA_LEN];
+static uint8_t got[DATA_LEN];
+
+static const rate_t rates[] = {
+    {9600U, TRUE}, {57600U, TRUE}, {115200U, FALSE}
+};
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+static void oldWriteReg(uint8_t reg, uint8_t value)
+{
+    I2C_M_SETUP_Type setup;
+    uint8_t buf[2];
+
+    buf[0] = SUB_ADDR(reg);
+    buf[1] = value;
+    memset(&setup, 0, sizeof(setup));
+    setup.sl_addr7bit = UART2_ADDR;
+    setup.tx_data = buf;
+    setup.tx_length = 2;
+    setup.retransmissions_max = 3;
+    I2C_MasterTransferData(LPC_I2C2, &setup, I2C_TRANSFER_POLLING);
+}
+
+static uint8_t oldReadReg(uint8_t reg)
+{
+    I2C_M_SETUP_Type setup;
+    uint8_t sub = SUB_ADDR(reg);
+    uint8_t value = 0;
+
+    memset(&setup, 0, sizeof(setup));
+    setup.sl_addr7bit = UART2_ADDR;
+    setup.tx_data = &sub;
+    setup.tx_length = 1;
+    setup.rx_data = &value;
+    setup.rx_length = 1;
+    setup.retransmissions_max = 3;
+    I2C_MasterTransferData(LPC_I2C2, &setup, I2C_TRANSFER_POLLING);
+    return value;
+}
+
+/* uart2_init before the FIFO rewrite: baud rate and line control only */
+static void oldInit(uint32_t baud)
+{
+    uint32_t div = 3686400U / (baud * 16U);
+
+    oldWriteReg(R_LCR, 0x80);
+    oldWriteReg(R_DLL, (uint8_t)(div & 0xFFU));
+    oldWriteReg(R_DLH, (uint8_t)((div >> 8) & 0xFFU));
+    oldWriteReg(R_LCR, 0x03);
+}
+
+static sim_time_t lineNs(uint32_t baud, uint32_t bytes)
+{
+    uint32_t div = 3686400U / (baud * 16U);
+
+    return ((sim_time_t)bytes * 10ULL * 16ULL * div * SIM_NS_PER_S) / 3686400ULL;
+}
+
+/* ms tick of uart2.c, each call stands for a pass of the caller's loop */
+static uint32_t getMs(void)
+{
+    sim_spend(LOOP_NS);
+    return (uint32_t)(sim_now / SIM_NS_PER_MS);
+}
+
+/* Moves what left the line since the last call to dst */
+static uint32_t takeSent(uint8_t *dst, uint32_t room)
+{
+    const uint8_t *out;
+    uint32_t n = sc16is752_sent(0, &out);
+
+    if (n > room) {
+        n = room;
+    }
+    memcpy(dst, out, n);
+    return n;
+}
+
+static void begin(phase_t *p)
+{
+    sc16is752_getStat(&p->stat);
+    p->start = sim_now;
+}
+
+/* Prints a phase, returns TRUE when the len bytes are the data sent */
+static Bool report(const char *name, uint32_t baud, const phase_t *p,
+        const uint8_t *out, uint32_t len)
+{
+    sc16is752_stat_t s;
+    Bool ok = (len == DATA_LEN) && (memcmp(out, data, DATA_LEN) == 0);
+
+    sc16is752_getStat(&s);
+    printf("uart2 %6u %-11s %4u bytes %-4s %5u transactions (%4u idle) %6u bus bytes"
+            " %7.1f ms %4u overruns\n",
+            (unsigned)baud, name, (unsigned)len, ok ? "ok" : "lost",
+            (unsigned)(s.transfers - p->stat.transfers), (unsigned)(s.iirNone - p->stat.iirNone),
+            (unsigned)(s.bytes - p->stat.bytes), (double)(sim_now - p->start) / SIM_NS_PER_MS,
+            (unsigned)(s.overruns - p->stat.overruns));
+    return ok;
+}
+
+static void sendOld(uint32_t baud)
+{
+    phase_t p;
+    const uint8_t *out;
+    uint32_t i;
+    uint32_t n;
+
+    sc16is752_reset();
+    oldInit(baud);
+    begin(&p);
+    for (i = 0; i < DATA_LEN; i++) {
+        while ((oldReadReg(R_LSR) & LSR_THRE) == 0) {
+        }
+        oldWriteReg(R_THR, data[i]);
+    }
+    while (sc16is752_lineBusy(0)) {
+        sim_spend(SIM_NS_PER_US);
+    }
+    n = sc16is752_sent(0, &out);
+    report("send old", baud, &p, out, n);
+}
+
+static void sendNew(uint32_t baud)
+{
+    phase_t p;
+    sim_time_t end;
+    uint32_t n;
+
+    sc16is752_reset();
+    uart2_init(baud, CHANNEL_A);
+    uart2_setTicks(getMs);
+    begin(&p);
+    end = sim_now + lineNs(baud, DATA_LEN) + GIVE_UP_NS;
+    uart2_send(data, DATA_LEN);
+    n = takeSent(got, DATA_LEN);
+    /* the line may run dry while the ring still holds data */
+    while ((n < DATA_LEN) && (sim_now < end)) {
+        uart2_poll();
+        n += takeSent(&got[n], DATA_LEN - n);
+    }
+    if (!report("send", baud, &p, got, n)) {
+        failures++;
+    }
+}
+
+static void receiveOld(uint32_t baud)
+{
+    phase_t p;
+    sim_time_t end;
+    uint32_t n = 0;
+
+    sc16is752_reset();
+    oldInit(baud);
+    begin(&p);
+    sc16is752_feed(0, data, DATA_LEN);
+    end = sim_now + lineNs(baud, DATA_LEN) + GIVE_UP_NS;
+    while ((n < DATA_LEN) && (sim_now < end)) {
+        if ((oldReadReg(R_LSR) & LSR_RDR) != 0) {
+            got[n] = oldReadReg(R_RHR);
+            n++;
+        }
+    }
+    report("receive old", baud, &p, got, n);
+}
+
+static void receiveNew(uint32_t baud, Bool expectOk)
+{
+    phase_t p;
+    sim_time_t end;
+    uint32_t n;
+
+    sc16is752_reset();
+    uart2_init(baud, CHANNEL_A);
+    uart2_setTicks(getMs);
+    /* drop what the init found, the read below starts with an empty ring */
+    while (uart2_read(got, DATA_LEN) != 0) {
+    }
+    begin(&p);
+    sc16is752_feed(0, data, DATA_LEN);
+    end = sim_now + lineNs(baud, DATA_LEN) + GIVE_UP_NS;
+    n = uart2_receive(got, DATA_LEN, FALSE);
+    while ((n < DATA_LEN) && (sim_now < end)) {
+        n += uart2_receive(&got[n], DATA_LEN - n, FALSE);
+    }
+    if (!report("receive", baud, &p, got, n) && expectOk) {
+        failures++;
+    }
+}
+
+/******************************************************************************
+ * Public Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ *
+ * Description:
+ *    Run the uart2 comparison
+ *
+ * Returns:
+ *    0 if uart2.c sent all data and received it where the bus allows
+ *
+ *****************************************************************************/
+int uart2test_run(void)
+{
+    uint32_t seed = 1769U;
+    uint32_t i;
+
+    for (i = 0; i < DATA_LEN; i++) {
+        seed = seed * 1103515245U + 12345U;
+        data[i] = (uint8_t)(seed >> 16);
+    }
+    I2C_Init(LPC_I2C2, I2C_HZ);
+    I2C_Cmd(LPC_I2C2, ENABLE);
+
+    for (i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        sendOld(rates[i].baud);
+        sendNew(rates[i].baud);
+        receiveOld(rates[i].baud);
+        receiveNew(rates[i].baud, rates[i].receiveOk);
+    }
+    printf("uart2: %s\n", (failures == 0) ? "all tests pass" : "FAILED");
+    return (failures == 0) ? 0 : 1;
+}